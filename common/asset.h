@@ -0,0 +1,340 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+  * \brief Compressed test assets
+  *
+  * Test images are stored as a small LZ77 stream
+  * with an optional byte-wise delta pre-filter and
+  * are embedded into the binaries by the asset-pack
+  * build tool. Each stream starts with a header that
+  * stores the uncompressed size and the filter used.
+  *
+  * The token format is LZ4-like: the high nibble of
+  * a token holds the literal count, the low nibble
+  * the match length minus four, and both overflow
+  * into additional bytes of 255. Matches reference
+  * up to 64 kB of previously decoded data.
+  */
+namespace asset {
+
+  constexpr uint32_t Magic        = 0x5A4C5341; // 'ASLZ'
+  constexpr uint32_t MinMatch     = 4;
+  constexpr uint32_t MaxOffset    = 0xFFFF;
+  constexpr uint32_t HashBits     = 16;
+  constexpr size_t   Alignment    = 64;
+
+  enum class Filter : uint32_t {
+    None  = 0,
+    Delta = 1,
+  };
+
+  struct Header {
+    uint32_t magic;
+    uint32_t rawSize;
+    Filter   filter;
+  };
+
+
+  inline uint32_t hash4(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return (v * 2654435761u) >> (32 - HashBits);
+  }
+
+
+  inline void writeLength(std::vector<uint8_t>& dst, size_t length) {
+    while (length >= 255) {
+      dst.push_back(255);
+      length -= 255;
+    }
+
+    dst.push_back(uint8_t(length));
+  }
+
+
+  inline void writeSequence(
+          std::vector<uint8_t>& dst,
+    const uint8_t*              literals,
+          size_t                literalCount,
+          size_t                matchLength,
+          size_t                matchOffset) {
+    size_t matchCode = matchLength ? matchLength - MinMatch : 0;
+
+    dst.push_back(uint8_t(
+      (std::min<size_t>(literalCount, 15) << 4) |
+      (std::min<size_t>(matchCode,    15))));
+
+    if (literalCount >= 15)
+      writeLength(dst, literalCount - 15);
+
+    dst.insert(dst.end(), literals, literals + literalCount);
+
+    if (matchLength) {
+      dst.push_back(uint8_t(matchOffset));
+      dst.push_back(uint8_t(matchOffset >> 8));
+
+      if (matchCode >= 15)
+        writeLength(dst, matchCode - 15);
+    }
+  }
+
+
+  /**
+   * \brief Compresses a raw asset
+   *
+   * \param [in] src Raw data
+   * \param [in] size Size of raw data, in bytes
+   * \param [in] filter Pre-filter to apply
+   * \returns Compressed stream, including header
+   */
+  inline std::vector<uint8_t> compress(
+    const uint8_t*  src,
+          size_t    size,
+          Filter    filter) {
+    std::vector<uint8_t> data(src, src + size);
+
+    if (filter == Filter::Delta) {
+      for (size_t i = size; i > 1; i--)
+        data[i - 1] -= data[i - 2];
+    }
+
+    Header header = { Magic, uint32_t(size), filter };
+
+    std::vector<uint8_t> dst(sizeof(header));
+    std::memcpy(dst.data(), &header, sizeof(header));
+    dst.reserve(size + size / 255 + 16);
+
+    std::vector<uint32_t> table(1u << HashBits, ~0u);
+
+    const uint8_t* base = data.data();
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    // Last match must leave room for a trailing literal run
+    size_t limit = size > MinMatch + 1 ? size - MinMatch - 1 : 0;
+
+    while (pos < limit) {
+      uint32_t h = hash4(base + pos);
+      uint32_t candidate = table[h];
+      table[h] = uint32_t(pos);
+
+      if (candidate == ~0u || pos - candidate > MaxOffset
+       || std::memcmp(base + pos, base + candidate, MinMatch)) {
+        pos += 1;
+        continue;
+      }
+
+      size_t length = MinMatch;
+
+      while (pos + length < size && base[pos + length] == base[candidate + length])
+        length += 1;
+
+      writeSequence(dst, base + anchor, pos - anchor, length, pos - candidate);
+
+      pos += length;
+      anchor = pos;
+    }
+
+    writeSequence(dst, base + anchor, size - anchor, 0, 0);
+    return dst;
+  }
+
+
+  /**
+   * \brief Queries uncompressed size of an asset
+   *
+   * \param [in] src Compressed stream
+   * \param [in] size Size of compressed stream
+   * \returns Raw size, or 0 if the header is invalid
+   */
+  inline size_t rawSize(const uint8_t* src, size_t size) {
+    Header header;
+
+    if (size < sizeof(header))
+      return 0;
+
+    std::memcpy(&header, src, sizeof(header));
+    return header.magic == Magic ? header.rawSize : 0;
+  }
+
+
+  /**
+   * \brief Decompresses an asset
+   *
+   * \param [in] src Compressed stream, including header
+   * \param [in] srcSize Size of compressed stream
+   * \param [out] dst Destination buffer
+   * \param [in] dstSize Size of destination buffer
+   * \returns \c true on success, \c false if the
+   *    stream is corrupt or the buffer too small
+   */
+  inline bool decompress(
+    const uint8_t*  src,
+          size_t    srcSize,
+          uint8_t*  dst,
+          size_t    dstSize) {
+    Header header;
+
+    if (srcSize < sizeof(header))
+      return false;
+
+    std::memcpy(&header, src, sizeof(header));
+
+    if (header.magic != Magic || header.rawSize > dstSize)
+      return false;
+
+    const uint8_t* in    = src + sizeof(header);
+    const uint8_t* inEnd = src + srcSize;
+
+    size_t out = 0;
+    size_t end = header.rawSize;
+
+    auto readLength = [&] (size_t& length) {
+      uint8_t b;
+
+      do {
+        if (in >= inEnd)
+          return false;
+
+        b = *(in++);
+        length += b;
+      } while (b == 255);
+
+      return true;
+    };
+
+    while (in < inEnd) {
+      uint8_t token = *(in++);
+
+      size_t literalCount = token >> 4;
+
+      if (literalCount == 15 && !readLength(literalCount))
+        return false;
+
+      if (literalCount > size_t(inEnd - in) || literalCount > end - out)
+        return false;
+
+      std::memcpy(dst + out, in, literalCount);
+      in  += literalCount;
+      out += literalCount;
+
+      if (in == inEnd)
+        break;
+
+      if (inEnd - in < 2)
+        return false;
+
+      size_t offset = size_t(in[0]) | (size_t(in[1]) << 8);
+      in += 2;
+
+      size_t length = token & 0xF;
+
+      if (length == 15 && !readLength(length))
+        return false;
+
+      length += MinMatch;
+
+      if (!offset || offset > out || length > end - out)
+        return false;
+
+      // Matches may overlap the bytes they produce,
+      // so only use memcpy when they cannot
+      const uint8_t* match = dst + out - offset;
+
+      if (offset >= length) {
+        std::memcpy(dst + out, match, length);
+      } else {
+        for (size_t i = 0; i < length; i++)
+          dst[out + i] = match[i];
+      }
+
+      out += length;
+    }
+
+    if (out != end)
+      return false;
+
+    if (header.filter == Filter::Delta) {
+      uint8_t sum = 0;
+
+      for (size_t i = 0; i < end; i++)
+        dst[i] = sum += dst[i];
+    }
+
+    return true;
+  }
+
+
+  /**
+   * \brief Embedded asset
+   *
+   * Wraps a compressed stream and expands it into
+   * an aligned buffer the first time the data is
+   * accessed. Thread-safe.
+   */
+  class Asset {
+
+  public:
+
+    Asset(const uint8_t* data, size_t size)
+    : m_data(data), m_size(size) { }
+
+    ~Asset() {
+      if (m_raw)
+        ::operator delete[](m_raw, std::align_val_t(Alignment));
+    }
+
+    Asset             (const Asset&) = delete;
+    Asset& operator = (const Asset&) = delete;
+
+    /**
+     * \brief Decoded data
+     * \returns Pointer to decoded data, or
+     *    \c nullptr if the asset is corrupt
+     */
+    const uint8_t* data() const {
+      std::call_once(m_once, [this] { decode(); });
+      return m_raw;
+    }
+
+    /**
+     * \brief Decoded size
+     * \returns Size of the decoded data, in bytes
+     */
+    size_t size() const {
+      return rawSize(m_data, m_size);
+    }
+
+  private:
+
+    const uint8_t*          m_data;
+    size_t                  m_size;
+
+    mutable std::once_flag  m_once;
+    mutable uint8_t*        m_raw = nullptr;
+
+    void decode() const {
+      size_t size = this->size();
+
+      if (!size)
+        return;
+
+      auto raw = static_cast<uint8_t*>(
+        ::operator new[](size, std::align_val_t(Alignment)));
+
+      if (decompress(m_data, m_size, raw, size))
+        m_raw = raw;
+      else
+        ::operator delete[](raw, std::align_val_t(Alignment));
+    }
+
+  };
+
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cwchar>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+
+/**
+  * \brief Batch processing helpers
+  *
+  * Shared by the shader tools that process many files
+  * at once: the --threads option, a worker pool that
+  * hands out job indices, and the summary line.
+  */
+namespace batch {
+
+  /**
+   * \brief Parses the thread count option
+   *
+   * \param [in] argc Argument count
+   * \param [in] argv Arguments
+   * \param [in,out] i Index of the current argument, advanced
+   *    past the value if the argument is \c --threads
+   * \param [out] threadCount Thread count, 0 for the default
+   * \returns \c true if the argument was consumed
+   */
+  inline bool parseThreadCount(int argc, const wchar_t* const* argv, int& i, uint32_t& threadCount) {
+    if (std::wcscmp(argv[i], L"--threads") || i + 1 >= argc)
+      return false;
+
+    threadCount = uint32_t(std::wcstoul(argv[++i], nullptr, 10));
+    return true;
+  }
+
+
+  /**
+   * \brief Runs jobs on a worker pool
+   *
+   * Workers pick the next job index until all jobs are
+   * done. Never spawns more threads than there are jobs.
+   * \param [in] jobCount Number of jobs
+   * \param [in] threadCount Thread count, 0 to use all cores
+   * \param [in] proc Called with each job index, from any thread
+   * \returns Number of threads used
+   */
+  template<typename Proc>
+  uint32_t runJobs(size_t jobCount, uint32_t threadCount, const Proc& proc) {
+    if (!threadCount)
+      threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    threadCount = std::min<uint32_t>(threadCount, std::max<size_t>(jobCount, 1));
+
+    std::atomic<size_t> nextJob = { 0 };
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadCount; i++) {
+      threads.emplace_back([&] {
+        size_t index;
+
+        while ((index = nextJob++) < jobCount)
+          proc(index);
+      });
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+
+    return threadCount;
+  }
+
+
+  /**
+   * \brief Prints batch summary
+   *
+   * \param [in] os Output stream
+   * \param [in] action Past tense verb, e.g. "Compiled"
+   * \param [in] jobCount Total number of jobs
+   * \param [in] cachedCount Number of cache hits, omitted if 0
+   * \param [in] threadCount Number of threads used
+   * \param [in] totalUs Wall-clock time of the batch
+   * \param [in] stats Per-job times of successful jobs
+   */
+  inline void printSummary(
+          std::ostream&   os,
+    const char*           action,
+          size_t          jobCount,
+          uint32_t        cachedCount,
+          uint32_t        threadCount,
+          double          totalUs,
+    const bench::Stats&   stats) {
+    auto flags = os.flags();
+    auto precision = os.precision();
+
+    os << action << " " << stats.count() << " of " << jobCount << " shaders";
+
+    if (cachedCount)
+      os << " (" << cachedCount << " cached)";
+
+    os << " on " << threadCount << " threads in "
+       << std::fixed << std::setprecision(1) << (totalUs / 1000.0) << " ms ("
+       << (1000000.0 * double(jobCount) / totalUs) << " shaders/s)" << std::endl
+       << "Per-shader: " << stats << std::endl;
+
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+}
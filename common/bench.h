@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+/**
+  * \brief Benchmark helpers
+  *
+  * Simple wall-clock timer and a latency sample
+  * collection that reports distributions. Times
+  * are always given in microseconds.
+  */
+namespace bench {
+
+  using Clock = std::chrono::high_resolution_clock;
+
+  class Timer {
+
+  public:
+
+    Timer()
+    : m_start(Clock::now()) { }
+
+    void reset() {
+      m_start = Clock::now();
+    }
+
+    double elapsedUs() const {
+      return std::chrono::duration<double, std::micro>(Clock::now() - m_start).count();
+    }
+
+  private:
+
+    Clock::time_point m_start;
+
+  };
+
+
+  class Stats {
+
+  public:
+
+    void add(double us) {
+      m_samples.push_back(us);
+      m_sorted = false;
+    }
+
+    /** Adds all samples of another collection */
+    void add(const Stats& other) {
+      m_samples.insert(m_samples.end(), other.m_samples.begin(), other.m_samples.end());
+      m_sorted = false;
+    }
+
+    void clear() {
+      m_samples.clear();
+    }
+
+    size_t count() const {
+      return m_samples.size();
+    }
+
+    double total() const {
+      double sum = 0.0;
+
+      for (double s : m_samples)
+        sum += s;
+
+      return sum;
+    }
+
+    double mean() const {
+      return m_samples.empty() ? 0.0 : total() / double(m_samples.size());
+    }
+
+    double min() const {
+      return percentile(0.0);
+    }
+
+    double max() const {
+      return percentile(1.0);
+    }
+
+    /**
+     * \brief Computes a percentile
+     * \param [in] p Percentile, between 0 and 1
+     * \returns Nearest-rank sample value
+     */
+    double percentile(double p) const {
+      if (m_samples.empty())
+        return 0.0;
+
+      if (!m_sorted) {
+        std::sort(m_samples.begin(), m_samples.end());
+        m_sorted = true;
+      }
+
+      size_t index = size_t(p * double(m_samples.size() - 1) + 0.5);
+      return m_samples[std::min(index, m_samples.size() - 1)];
+    }
+
+  private:
+
+    mutable std::vector<double> m_samples;
+    mutable bool                m_sorted = true;
+
+  };
+
+
+  inline std::ostream& operator << (std::ostream& os, const Stats& stats) {
+    auto flags = os.flags();
+    auto precision = os.precision();
+
+    os << std::dec << std::fixed << std::setprecision(1)
+       << "n = " << stats.count()
+       << ", avg = " << stats.mean() << " us"
+       << ", min = " << stats.min() << " us"
+       << ", p50 = " << stats.percentile(0.5) << " us"
+       << ", p99 = " << stats.percentile(0.99) << " us"
+       << ", max = " << stats.max() << " us";
+
+    os.flags(flags);
+    os.precision(precision);
+    return os;
+  }
+
+}
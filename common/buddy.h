@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+  * \brief Buddy allocator
+  *
+  * Hands out power-of-two sized blocks from a range of
+  * memory, e.g. a heap for placed resources. Blocks are
+  * always aligned to their own size, so any alignment up
+  * to the block size is satisfied for free. The allocator
+  * only tracks offsets and never touches the memory.
+  */
+namespace buddy {
+
+  constexpr uint64_t InvalidOffset = ~0ull;
+
+  struct Allocation {
+    uint64_t offset = InvalidOffset;
+    uint32_t order  = 0;
+  };
+
+  struct Stats {
+    uint64_t capacity;        ///< Total size managed by the allocator
+    uint64_t allocated;       ///< Sum of allocated block sizes
+    uint64_t requested;       ///< Sum of requested sizes
+    uint64_t largestFree;     ///< Largest allocatable block
+    uint32_t freeBlocks;      ///< Number of free blocks of any size
+    uint32_t allocations;     ///< Number of live allocations
+
+    /** Fraction of allocated memory lost to rounding */
+    double internalFragmentation() const {
+      return allocated ? 1.0 - double(requested) / double(allocated) : 0.0;
+    }
+
+    /** Fraction of free memory not in the largest free block */
+    double externalFragmentation() const {
+      uint64_t freeSize = capacity - allocated;
+      return freeSize ? 1.0 - double(largestFree) / double(freeSize) : 0.0;
+    }
+  };
+
+
+  class Allocator {
+
+    constexpr static uint32_t NotFree = ~0u;
+
+  public:
+
+    /**
+     * \brief Creates allocator
+     *
+     * \param [in] capacity Size of the managed range. Must be
+     *    the minimum block size times a power of two.
+     * \param [in] minBlockSize Smallest block size, must be
+     *    a power of two.
+     */
+    Allocator(uint64_t capacity, uint64_t minBlockSize)
+    : m_minShift(log2(minBlockSize)),
+      m_maxOrder(log2(capacity >> m_minShift)),
+      m_freeLists(m_maxOrder + 1),
+      m_freeSlots(m_maxOrder + 1) {
+      for (uint32_t i = 0; i <= m_maxOrder; i++)
+        m_freeSlots[i].resize(size_t(1) << (m_maxOrder - i), NotFree);
+
+      insertFree(m_maxOrder, 0);
+    }
+
+    uint64_t capacity() const {
+      return blockSize(m_maxOrder);
+    }
+
+    uint64_t blockSize(uint32_t order) const {
+      return uint64_t(1) << (m_minShift + order);
+    }
+
+    /**
+     * \brief Allocates a block
+     *
+     * \param [in] size Requested size
+     * \param [in] alignment Required alignment, power of two
+     * \returns Allocation, with an invalid offset on failure
+     */
+    Allocation alloc(uint64_t size, uint64_t alignment) {
+      Allocation result;
+
+      uint64_t minSize = size > alignment ? size : alignment;
+      uint32_t order = 0;
+
+      while (order <= m_maxOrder && blockSize(order) < minSize)
+        order += 1;
+
+      uint32_t freeOrder = order;
+
+      while (freeOrder <= m_maxOrder && m_freeLists[freeOrder].empty())
+        freeOrder += 1;
+
+      if (freeOrder > m_maxOrder)
+        return result;
+
+      uint32_t index = m_freeLists[freeOrder].back();
+      removeFree(freeOrder, index);
+
+      // Split until the block has the requested size,
+      // keeping the upper half of each split free
+      while (freeOrder > order) {
+        freeOrder -= 1;
+        index *= 2;
+        insertFree(freeOrder, index + 1);
+      }
+
+      result.offset = uint64_t(index) << (m_minShift + order);
+      result.order = order;
+
+      m_allocated += blockSize(order);
+      m_requested += size;
+      m_allocations += 1;
+      return result;
+    }
+
+    /**
+     * \brief Frees a block
+     *
+     * \param [in] allocation Allocation to free
+     * \param [in] size Size originally requested
+     */
+    void free(const Allocation& allocation, uint64_t size) {
+      uint32_t order = allocation.order;
+      uint32_t index = uint32_t(allocation.offset >> (m_minShift + order));
+
+      m_allocated -= blockSize(order);
+      m_requested -= size;
+      m_allocations -= 1;
+
+      // Merge with the buddy for as long as it is free
+      while (order < m_maxOrder && m_freeSlots[order][index ^ 1] != NotFree) {
+        removeFree(order, index ^ 1);
+        order += 1;
+        index /= 2;
+      }
+
+      insertFree(order, index);
+    }
+
+    Stats stats() const {
+      Stats result = { };
+      result.capacity = capacity();
+      result.allocated = m_allocated;
+      result.requested = m_requested;
+      result.allocations = m_allocations;
+
+      for (uint32_t i = 0; i <= m_maxOrder; i++) {
+        result.freeBlocks += uint32_t(m_freeLists[i].size());
+
+        if (!m_freeLists[i].empty())
+          result.largestFree = blockSize(i);
+      }
+
+      return result;
+    }
+
+  private:
+
+    uint32_t m_minShift;
+    uint32_t m_maxOrder;
+
+    // Free block indices per order, and the position of
+    // each block in its free list so that a buddy can be
+    // removed in constant time when merging
+    std::vector<std::vector<uint32_t>> m_freeLists;
+    std::vector<std::vector<uint32_t>> m_freeSlots;
+
+    uint64_t m_allocated   = 0;
+    uint64_t m_requested   = 0;
+    uint32_t m_allocations = 0;
+
+    void insertFree(uint32_t order, uint32_t index) {
+      m_freeSlots[order][index] = uint32_t(m_freeLists[order].size());
+      m_freeLists[order].push_back(index);
+    }
+
+    void removeFree(uint32_t order, uint32_t index) {
+      auto& list = m_freeLists[order];
+      uint32_t slot = m_freeSlots[order][index];
+
+      list[slot] = list.back();
+      m_freeSlots[order][list[slot]] = slot;
+      list.pop_back();
+
+      m_freeSlots[order][index] = NotFree;
+    }
+
+    static uint32_t log2(uint64_t value) {
+      uint32_t result = 0;
+
+      while (value > 1) {
+        value >>= 1;
+        result += 1;
+      }
+
+      return result;
+    }
+
+  };
+
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "file.h"
+#include "hash.h"
+
+/**
+  * \brief Content-addressed on-disk cache
+  *
+  * Stores one file per entry, named after its 64-bit
+  * key. Hits refresh the file's modification time so
+  * that trimming the cache evicts the least recently
+  * used entries first. Entries are written to a temp
+  * file and renamed so that concurrent processes never
+  * observe partially written entries.
+  *
+  * Every store also appends the entry size to a journal
+  * in the cache directory, which lets short-lived processes
+  * decide when to trim without scanning the directory.
+  */
+class DiskCache {
+
+public:
+
+  struct Stats {
+    std::atomic<uint64_t> hits      = { 0 };
+    std::atomic<uint64_t> misses    = { 0 };
+    std::atomic<uint64_t> stores    = { 0 };
+    std::atomic<uint64_t> evictions = { 0 };
+  };
+
+  DiskCache(
+    const std::filesystem::path& directory,
+    const std::string&           extension,
+          uint64_t               maxSize)
+  : m_directory(directory), m_extension(extension), m_maxSize(maxSize),
+    m_journalPath(directory / "stores.journal") {
+    std::error_code ec;
+    std::filesystem::create_directories(m_directory, ec);
+  }
+
+  /**
+   * \brief Looks up an entry
+   *
+   * Entries are read with a single sized read, or mapped
+   * if they are large, so that callers can consume the
+   * contents directly without further copies.
+   * \param [in] key Entry key
+   * \param [out] data Entry contents
+   * \returns \c true on a cache hit
+   */
+  bool lookup(uint64_t key, MappedFile& data) {
+    std::filesystem::path path = entryPath(key);
+
+    if (!data.open(path)) {
+      m_stats.misses += 1;
+      return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::last_write_time(path,
+      std::filesystem::file_time_type::clock::now(), ec);
+
+    m_stats.hits += 1;
+    return true;
+  }
+
+  /**
+   * \brief Stores an entry
+   *
+   * \param [in] key Entry key
+   * \param [in] data Entry contents
+   * \param [in] size Size of entry, in bytes
+   * \returns \c true on success
+   */
+  bool store(uint64_t key, const void* data, size_t size) {
+    if (!writeFileAtomic(entryPath(key), data, size))
+      return false;
+
+    // Appends from other processes sharing the cache may
+    // interleave with this one. A torn record can at worst
+    // trigger an early trim, which is harmless.
+    uint64_t record = size;
+    std::ofstream journal(m_journalPath, std::ios::binary | std::ios::app);
+    journal.write(reinterpret_cast<const char*>(&record), sizeof(record));
+
+    m_stats.stores += 1;
+    return true;
+  }
+
+  /**
+   * \brief Computes size stored since the last trim
+   *
+   * Sums up the journal, so this is an upper bound
+   * if entries were overwritten with the same key.
+   * \returns Number of bytes stored since the last trim
+   */
+  uint64_t storedSinceTrim() const {
+    MappedFile journal(m_journalPath);
+
+    if (!journal.valid())
+      return 0;
+
+    const uint8_t* records = journal.data();
+    uint64_t total = 0;
+
+    for (size_t i = 0; i + sizeof(uint64_t) <= journal.size(); i += sizeof(uint64_t)) {
+      uint64_t record;
+      std::memcpy(&record, &records[i], sizeof(record));
+
+      // Clamp torn records so that they cannot overflow
+      total += std::min(record, m_maxSize);
+    }
+
+    return total;
+  }
+
+  /**
+   * \brief Trims the cache if it may exceed its limit
+   *
+   * A trim leaves the cache at 90% of its limit, so it
+   * can only exceed the limit again once more than 10%
+   * of the limit has been stored since.
+   * \returns \c true if the cache was trimmed
+   */
+  bool trimIfNeeded() {
+    if (storedSinceTrim() <= m_maxSize / 10)
+      return false;
+
+    trim();
+    return true;
+  }
+
+  /**
+   * \brief Evicts least recently used entries
+   *
+   * Removes the oldest entries until the cache
+   * fits within 90% of its size limit.
+   */
+  void trim() {
+    struct Entry {
+      std::filesystem::path           path;
+      std::filesystem::file_time_type time;
+      uint64_t                        size;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+
+    // Reset the journal before scanning, so that entries
+    // stored concurrently are counted again rather than lost
+    std::error_code ec;
+    std::filesystem::remove(m_journalPath, ec);
+
+    for (const auto& file : std::filesystem::directory_iterator(m_directory, ec)) {
+      if (!file.is_regular_file(ec) || file.path().extension() != m_extension)
+        continue;
+
+      Entry entry = { file.path(), file.last_write_time(ec), file.file_size(ec) };
+      totalSize += entry.size;
+      entries.push_back(std::move(entry));
+    }
+
+    if (totalSize <= m_maxSize)
+      return;
+
+    std::sort(entries.begin(), entries.end(),
+      [] (const Entry& a, const Entry& b) { return a.time < b.time; });
+
+    uint64_t targetSize = m_maxSize - m_maxSize / 10;
+
+    for (const auto& entry : entries) {
+      if (totalSize <= targetSize)
+        break;
+
+      if (std::filesystem::remove(entry.path, ec)) {
+        totalSize -= entry.size;
+        m_stats.evictions += 1;
+      }
+    }
+  }
+
+  const Stats& stats() const {
+    return m_stats;
+  }
+
+private:
+
+  std::filesystem::path m_directory;
+  std::string           m_extension;
+  uint64_t              m_maxSize;
+  std::filesystem::path m_journalPath;
+
+  Stats                 m_stats;
+
+  std::filesystem::path entryPath(uint64_t key) const {
+    return m_directory / (hashToString(key) + m_extension);
+  }
+
+};
+
+
+inline std::ostream& operator << (std::ostream& os, const DiskCache::Stats& stats) {
+  return os << stats.hits << " hits, " << stats.misses << " misses, "
+            << stats.stores << " stores, " << stats.evictions << " evictions";
+}
@@ -0,0 +1,692 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define DXBC_CHECKSUM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+  * \brief DXBC container reader
+  *
+  * Validates DXBC containers and indexes their chunks
+  * without copying. All views returned by a container
+  * point into the memory it was created from, which
+  * must stay alive as long as the container is used.
+  */
+namespace dxbc {
+
+  constexpr uint32_t fourcc(char a, char b, char c, char d) {
+    return uint32_t(uint8_t(a))
+        | (uint32_t(uint8_t(b)) << 8)
+        | (uint32_t(uint8_t(c)) << 16)
+        | (uint32_t(uint8_t(d)) << 24);
+  }
+
+  namespace Tag {
+    constexpr uint32_t DXBC = fourcc('D', 'X', 'B', 'C');
+    constexpr uint32_t SHDR = fourcc('S', 'H', 'D', 'R');
+    constexpr uint32_t SHEX = fourcc('S', 'H', 'E', 'X');
+    constexpr uint32_t ISGN = fourcc('I', 'S', 'G', 'N');
+    constexpr uint32_t ISG1 = fourcc('I', 'S', 'G', '1');
+    constexpr uint32_t OSGN = fourcc('O', 'S', 'G', 'N');
+    constexpr uint32_t OSG1 = fourcc('O', 'S', 'G', '1');
+    constexpr uint32_t OSG5 = fourcc('O', 'S', 'G', '5');
+    constexpr uint32_t PCSG = fourcc('P', 'C', 'S', 'G');
+    constexpr uint32_t PSG1 = fourcc('P', 'S', 'G', '1');
+    constexpr uint32_t RDEF = fourcc('R', 'D', 'E', 'F');
+    constexpr uint32_t STAT = fourcc('S', 'T', 'A', 'T');
+    constexpr uint32_t SFI0 = fourcc('S', 'F', 'I', '0');
+    constexpr uint32_t SDBG = fourcc('S', 'D', 'B', 'G');
+    constexpr uint32_t SPDB = fourcc('S', 'P', 'D', 'B');
+  }
+
+  struct Header {
+    uint32_t magic;
+    uint32_t checksum[4];
+    uint32_t version;
+    uint32_t totalSize;
+    uint32_t chunkCount;
+  };
+
+  /** Bytes at the start of the container not covered by the checksum */
+  constexpr size_t ChecksumOffset = 20;
+
+  enum class Error : uint32_t {
+    None,
+    TooSmall,
+    BadMagic,
+    BadVersion,
+    BadSize,
+    BadChunk,
+    BadChecksum,
+  };
+
+  enum class ProgramType : uint32_t {
+    Pixel     = 0,
+    Vertex    = 1,
+    Geometry  = 2,
+    Hull      = 3,
+    Domain    = 4,
+    Compute   = 5,
+  };
+
+  struct Chunk {
+    uint32_t        tag;
+    uint32_t        size;
+    const uint8_t*  data;
+  };
+
+  struct SignatureElement {
+    const char*     semanticName;
+    uint32_t        semanticIndex;
+    uint32_t        systemValue;
+    uint32_t        componentType;
+    uint32_t        registerIndex;
+    uint8_t         mask;
+    uint8_t         rwMask;
+    uint32_t        stream;
+    uint32_t        minPrecision;
+  };
+
+
+  namespace md5 {
+
+    constexpr uint32_t K[64] = {
+      0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+      0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+      0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+      0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+      0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+      0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+      0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+      0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391 };
+
+    constexpr uint32_t R[16] = {
+      7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21 };
+
+    inline uint32_t rotl(uint32_t v, uint32_t r) {
+      return (v << r) | (v >> (32 - r));
+    }
+
+    /**
+     * \brief MD5 block transform
+     *
+     * \param [in,out] state Hash state
+     * \param [in] block 64-byte input block
+     */
+    inline void transform(uint32_t state[4], const uint8_t* block) {
+      uint32_t m[16];
+      std::memcpy(m, block, sizeof(m));
+
+      uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+
+      auto step = [&] (uint32_t i, uint32_t f, uint32_t g) {
+        uint32_t t = d;
+        d = c;
+        c = b;
+        b = b + rotl(a + f + K[i] + m[g], R[((i >> 4) << 2) | (i & 3)]);
+        a = t;
+      };
+
+      for (uint32_t i =  0; i < 16; i++) step(i, (b & c) | (~b & d), i);
+      for (uint32_t i = 16; i < 32; i++) step(i, (d & b) | (~d & c), (5 * i + 1) & 15);
+      for (uint32_t i = 32; i < 48; i++) step(i, b ^ c ^ d,          (3 * i + 5) & 15);
+      for (uint32_t i = 48; i < 64; i++) step(i, c ^ (b | ~d),       (7 * i) & 15);
+
+      state[0] += a;
+      state[1] += b;
+      state[2] += c;
+      state[3] += d;
+    }
+
+  }
+
+
+  /**
+   * \brief Builds final checksum blocks
+   *
+   * DXBC uses MD5 with a custom final block that stores
+   * the bit count at the start rather than the end of the
+   * block, so the padding differs from regular MD5.
+   * \param [in] tail Data past the last full block
+   * \param [in] size Total hashed size, in bytes
+   * \param [out] blocks Final blocks
+   * \returns Number of final blocks, either 1 or 2
+   */
+  inline uint32_t getFinalBlocks(const uint8_t* tail, size_t size, uint32_t blocks[32]) {
+    size_t tailSize = size & 63;
+    uint32_t bitCount = uint32_t(size * 8);
+    uint32_t count = 1;
+
+    std::memset(blocks, 0, 128);
+
+    if (tailSize >= 56) {
+      std::memcpy(blocks, tail, tailSize);
+      reinterpret_cast<uint8_t*>(blocks)[tailSize] = 0x80;
+
+      blocks += 16;
+      count += 1;
+    } else {
+      std::memcpy(&blocks[1], tail, tailSize);
+      reinterpret_cast<uint8_t*>(&blocks[1])[tailSize] = 0x80;
+    }
+
+    blocks[0]  = bitCount;
+    blocks[15] = (bitCount >> 2) | 1;
+    return count;
+  }
+
+
+  /**
+   * \brief Computes DXBC checksum
+   *
+   * Everything past the checksum field is hashed.
+   * \param [in] data Container, including header
+   * \param [in] size Container size, in bytes
+   * \param [out] checksum Checksum
+   */
+  inline void computeChecksum(const void* data, size_t size, uint32_t checksum[4]) {
+    auto src = reinterpret_cast<const uint8_t*>(data) + ChecksumOffset;
+    size -= ChecksumOffset;
+
+    uint32_t state[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+
+    size_t fullSize = size & ~size_t(63);
+
+    for (size_t i = 0; i < fullSize; i += 64)
+      md5::transform(state, src + i);
+
+    uint32_t blocks[32];
+    uint32_t count = getFinalBlocks(src + fullSize, size, blocks);
+
+    for (uint32_t i = 0; i < count; i++)
+      md5::transform(state, reinterpret_cast<const uint8_t*>(&blocks[16 * i]));
+
+    for (uint32_t i = 0; i < 4; i++)
+      checksum[i] = state[i];
+  }
+
+
+#ifdef DXBC_CHECKSUM_SSE2
+  namespace md5 {
+
+    inline __m128i rotl4(__m128i v, uint32_t r) {
+      return _mm_or_si128(
+        _mm_sll_epi32(v, _mm_cvtsi32_si128(int(r))),
+        _mm_srl_epi32(v, _mm_cvtsi32_si128(int(32 - r))));
+    }
+
+    /**
+     * \brief Four-way MD5 block transform
+     *
+     * Hashes one block of four independent messages,
+     * with one message per 32-bit lane.
+     * \param [in,out] state Hash states, one lane per message
+     * \param [in] blocks Pointers to the four input blocks
+     */
+    inline void transform4(__m128i state[4], const uint8_t* const blocks[4]) {
+      // Transpose the blocks so that each vector holds
+      // the same message word for all four lanes
+      __m128i m[16];
+
+      for (uint32_t i = 0; i < 4; i++) {
+        __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[0]) + i);
+        __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[1]) + i);
+        __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[2]) + i);
+        __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[3]) + i);
+
+        __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+        __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+        __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+        __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+        m[4 * i + 0] = _mm_unpacklo_epi64(t0, t1);
+        m[4 * i + 1] = _mm_unpackhi_epi64(t0, t1);
+        m[4 * i + 2] = _mm_unpacklo_epi64(t2, t3);
+        m[4 * i + 3] = _mm_unpackhi_epi64(t2, t3);
+      }
+
+      const __m128i ones = _mm_set1_epi32(-1);
+
+      __m128i a = state[0], b = state[1], c = state[2], d = state[3];
+
+      auto step = [&] (uint32_t i, __m128i f, uint32_t g) {
+        __m128i t = d;
+        d = c;
+        c = b;
+
+        f = _mm_add_epi32(_mm_add_epi32(a, f),
+            _mm_add_epi32(_mm_set1_epi32(int(K[i])), m[g]));
+
+        b = _mm_add_epi32(b, rotl4(f, R[((i >> 4) << 2) | (i & 3)]));
+        a = t;
+      };
+
+      for (uint32_t i =  0; i < 16; i++)
+        step(i, _mm_or_si128(_mm_and_si128(b, c), _mm_andnot_si128(b, d)), i);
+
+      for (uint32_t i = 16; i < 32; i++)
+        step(i, _mm_or_si128(_mm_and_si128(d, b), _mm_andnot_si128(d, c)), (5 * i + 1) & 15);
+
+      for (uint32_t i = 32; i < 48; i++)
+        step(i, _mm_xor_si128(_mm_xor_si128(b, c), d), (3 * i + 5) & 15);
+
+      for (uint32_t i = 48; i < 64; i++)
+        step(i, _mm_xor_si128(c, _mm_or_si128(b, _mm_xor_si128(d, ones))), (7 * i) & 15);
+
+      state[0] = _mm_add_epi32(state[0], a);
+      state[1] = _mm_add_epi32(state[1], b);
+      state[2] = _mm_add_epi32(state[2], c);
+      state[3] = _mm_add_epi32(state[3], d);
+    }
+
+  }
+#endif
+
+
+  /**
+   * \brief Computes checksums of multiple containers
+   *
+   * Hashes four containers at a time using SSE2, with
+   * each lane picking up the next container as soon as
+   * it finishes its current one, so that containers of
+   * different sizes keep all lanes busy. Falls back to
+   * the scalar implementation without SSE2.
+   * \param [in] count Number of containers
+   * \param [in] data Container pointers
+   * \param [in] sizes Container sizes, in bytes
+   * \param [out] checksums Four words per container
+   */
+  inline void computeChecksums(size_t count, const void* const* data, const size_t* sizes, uint32_t* checksums) {
+#ifdef DXBC_CHECKSUM_SSE2
+    struct Lane {
+      size_t          job;
+      const uint8_t*  src;
+      size_t          fullBlocks;
+      size_t          totalBlocks;
+      size_t          block;
+      uint32_t        final[32];
+    };
+
+    static const uint32_t initState[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+    static const uint8_t dummy[64] = { };
+
+    Lane lanes[4];
+    alignas(16) uint32_t state[4][4];
+
+    size_t next = 0;
+    uint32_t active = 0;
+
+    auto assign = [&] (uint32_t l) {
+      if (next == count)
+        return false;
+
+      Lane& lane = lanes[l];
+      lane.job = next++;
+
+      size_t size = sizes[lane.job] - ChecksumOffset;
+      lane.src = reinterpret_cast<const uint8_t*>(data[lane.job]) + ChecksumOffset;
+      lane.fullBlocks = size / 64;
+      lane.totalBlocks = lane.fullBlocks + getFinalBlocks(lane.src + 64 * lane.fullBlocks, size, lane.final);
+      lane.block = 0;
+
+      for (uint32_t i = 0; i < 4; i++)
+        state[i][l] = initState[i];
+
+      return true;
+    };
+
+    bool laneActive[4];
+
+    for (uint32_t l = 0; l < 4; l++) {
+      laneActive[l] = assign(l);
+      active += laneActive[l] ? 1 : 0;
+    }
+
+    while (active) {
+      const uint8_t* blocks[4];
+
+      for (uint32_t l = 0; l < 4; l++) {
+        const Lane& lane = lanes[l];
+
+        if (!laneActive[l])
+          blocks[l] = dummy;
+        else if (lane.block < lane.fullBlocks)
+          blocks[l] = lane.src + 64 * lane.block;
+        else
+          blocks[l] = reinterpret_cast<const uint8_t*>(&lane.final[16 * (lane.block - lane.fullBlocks)]);
+      }
+
+      __m128i v[4];
+
+      for (uint32_t i = 0; i < 4; i++)
+        v[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(state[i]));
+
+      md5::transform4(v, blocks);
+
+      for (uint32_t i = 0; i < 4; i++)
+        _mm_store_si128(reinterpret_cast<__m128i*>(state[i]), v[i]);
+
+      for (uint32_t l = 0; l < 4; l++) {
+        Lane& lane = lanes[l];
+
+        if (!laneActive[l] || ++lane.block < lane.totalBlocks)
+          continue;
+
+        for (uint32_t i = 0; i < 4; i++)
+          checksums[4 * lane.job + i] = state[i][l];
+
+        if (!assign(l)) {
+          laneActive[l] = false;
+          active -= 1;
+        }
+      }
+    }
+#else
+    for (size_t i = 0; i < count; i++)
+      computeChecksum(data[i], sizes[i], &checksums[4 * i]);
+#endif
+  }
+
+
+  /**
+   * \brief DXBC container
+   *
+   * Parses the container header and chunk table. Use
+   * \c error to check whether the container is valid
+   * before accessing any chunks.
+   */
+  class Container {
+
+  public:
+
+    Container() { }
+
+    /**
+     * \brief Parses container
+     *
+     * \param [in] data Container data
+     * \param [in] size Size of the data, in bytes
+     * \param [in] verifyChecksum Whether to validate the checksum
+     */
+    Container(const void* data, size_t size, bool verifyChecksum = true)
+    : m_data(reinterpret_cast<const uint8_t*>(data)), m_size(size) {
+      m_error = parse(verifyChecksum);
+
+      if (m_error != Error::None)
+        m_chunks.clear();
+    }
+
+    Error error() const {
+      return m_error;
+    }
+
+    bool valid() const {
+      return m_error == Error::None;
+    }
+
+    const uint8_t* data() const {
+      return m_data;
+    }
+
+    size_t size() const {
+      return m_size;
+    }
+
+    const Header* header() const {
+      return reinterpret_cast<const Header*>(m_data);
+    }
+
+    const std::vector<Chunk>& chunks() const {
+      return m_chunks;
+    }
+
+    /**
+     * \brief Finds chunk by tag
+     *
+     * \param [in] tag Chunk FourCC
+     * \returns Chunk, or \c nullptr if not present
+     */
+    const Chunk* findChunk(uint32_t tag) const {
+      for (const auto& chunk : m_chunks) {
+        if (chunk.tag == tag)
+          return &chunk;
+      }
+
+      return nullptr;
+    }
+
+    /**
+     * \brief Finds shader code chunk
+     * \returns SHEX or SHDR chunk, or \c nullptr
+     */
+    const Chunk* findShaderChunk() const {
+      const Chunk* chunk = findChunk(Tag::SHEX);
+      return chunk ? chunk : findChunk(Tag::SHDR);
+    }
+
+    /**
+     * \brief Reads shader version token
+     *
+     * \param [out] type Program type
+     * \param [out] major Shader model major version
+     * \param [out] minor Shader model minor version
+     * \returns \c true if the container has shader code
+     */
+    bool getProgramInfo(ProgramType& type, uint32_t& major, uint32_t& minor) const {
+      const Chunk* chunk = findShaderChunk();
+
+      if (!chunk || chunk->size < 8)
+        return false;
+
+      uint32_t token;
+      std::memcpy(&token, chunk->data, sizeof(token));
+
+      type  = ProgramType(token >> 16);
+      major = (token >> 4) & 0xF;
+      minor = (token >> 0) & 0xF;
+      return type <= ProgramType::Compute;
+    }
+
+    /**
+     * \brief Parses signature chunk
+     *
+     * Supports the ISGN, OSGN and PCSG layouts as well as
+     * the extended ISG1, OSG1, OSG5 and PSG1 variants.
+     * \param [in] tag Signature chunk FourCC
+     * \param [out] elements Signature elements
+     * \returns \c true if the chunk exists and is valid
+     */
+    bool parseSignature(uint32_t tag, std::vector<SignatureElement>& elements) const {
+      elements.clear();
+
+      const Chunk* chunk = findChunk(tag);
+
+      if (!chunk || chunk->size < 8)
+        return false;
+
+      bool hasStream = tag == Tag::OSG5 || tag == Tag::ISG1 || tag == Tag::OSG1 || tag == Tag::PSG1;
+      bool hasMinPrecision = tag == Tag::ISG1 || tag == Tag::OSG1 || tag == Tag::PSG1;
+
+      size_t elementSize = 24 + (hasStream ? 4 : 0) + (hasMinPrecision ? 4 : 0);
+
+      uint32_t count = read32(chunk->data);
+      uint32_t offset = read32(chunk->data + 4);
+
+      if (offset > chunk->size || count > (chunk->size - offset) / elementSize)
+        return false;
+
+      elements.reserve(count);
+
+      for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* src = chunk->data + offset + i * elementSize;
+
+        SignatureElement element = { };
+
+        if (hasStream) {
+          element.stream = read32(src);
+          src += 4;
+        }
+
+        uint32_t nameOffset     = read32(src +  0);
+        element.semanticIndex   = read32(src +  4);
+        element.systemValue     = read32(src +  8);
+        element.componentType   = read32(src + 12);
+        element.registerIndex   = read32(src + 16);
+        element.mask            = src[20];
+        element.rwMask          = src[21];
+
+        if (hasMinPrecision)
+          element.minPrecision  = read32(src + 24);
+
+        if (nameOffset >= chunk->size
+         || !std::memchr(chunk->data + nameOffset, '\0', chunk->size - nameOffset))
+          return false;
+
+        element.semanticName = reinterpret_cast<const char*>(chunk->data + nameOffset);
+        elements.push_back(element);
+      }
+
+      return true;
+    }
+
+  private:
+
+    const uint8_t*      m_data  = nullptr;
+    size_t              m_size  = 0;
+    Error               m_error = Error::TooSmall;
+
+    std::vector<Chunk>  m_chunks;
+
+    static uint32_t read32(const uint8_t* p) {
+      uint32_t v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    Error parse(bool verifyChecksum) {
+      if (!m_data || m_size < sizeof(Header))
+        return Error::TooSmall;
+
+      Header header;
+      std::memcpy(&header, m_data, sizeof(header));
+
+      if (header.magic != Tag::DXBC)
+        return Error::BadMagic;
+
+      if (header.version != 1)
+        return Error::BadVersion;
+
+      if (header.totalSize > m_size || header.totalSize < sizeof(Header)
+       || header.chunkCount > (header.totalSize - sizeof(Header)) / 4)
+        return Error::BadSize;
+
+      // Ignore any trailing data past the container
+      m_size = header.totalSize;
+      m_chunks.reserve(header.chunkCount);
+
+      for (uint32_t i = 0; i < header.chunkCount; i++) {
+        uint32_t offset = read32(m_data + sizeof(Header) + 4 * i);
+
+        if ((offset & 3) || offset > m_size - 8)
+          return Error::BadChunk;
+
+        Chunk chunk;
+        chunk.tag  = read32(m_data + offset);
+        chunk.size = read32(m_data + offset + 4);
+        chunk.data = m_data + offset + 8;
+
+        if (chunk.size > m_size - offset - 8)
+          return Error::BadChunk;
+
+        m_chunks.push_back(chunk);
+      }
+
+      if (verifyChecksum) {
+        uint32_t checksum[4];
+        computeChecksum(m_data, m_size, checksum);
+
+        if (std::memcmp(checksum, header.checksum, sizeof(checksum)))
+          return Error::BadChecksum;
+      }
+
+      return Error::None;
+    }
+
+  };
+
+
+  /**
+   * \brief Rebuilds container with a subset of chunks
+   *
+   * Copies all chunks accepted by the predicate into
+   * a new container, in their original order, and signs
+   * the result with a freshly computed checksum.
+   * \param [in] container Valid source container
+   * \param [in] keep Predicate taking a \c Chunk
+   * \returns New container
+   */
+  template<typename Pred>
+  std::vector<uint8_t> filterChunks(const Container& container, const Pred& keep) {
+    std::vector<const Chunk*> chunks;
+    size_t size = sizeof(Header);
+
+    for (const auto& chunk : container.chunks()) {
+      if (keep(chunk)) {
+        chunks.push_back(&chunk);
+        size += 4 + 8 + ((size_t(chunk.size) + 3) & ~size_t(3));
+      }
+    }
+
+    std::vector<uint8_t> result(size);
+
+    Header header = { };
+    header.magic      = Tag::DXBC;
+    header.version    = 1;
+    header.totalSize  = uint32_t(size);
+    header.chunkCount = uint32_t(chunks.size());
+
+    size_t offset = sizeof(Header) + 4 * chunks.size();
+
+    for (size_t i = 0; i < chunks.size(); i++) {
+      uint32_t chunkOffset = uint32_t(offset);
+      std::memcpy(&result[sizeof(Header) + 4 * i], &chunkOffset, 4);
+
+      std::memcpy(&result[offset + 0], &chunks[i]->tag, 4);
+      std::memcpy(&result[offset + 4], &chunks[i]->size, 4);
+      std::memcpy(&result[offset + 8], chunks[i]->data, chunks[i]->size);
+
+      offset += 8 + ((size_t(chunks[i]->size) + 3) & ~size_t(3));
+    }
+
+    std::memcpy(result.data(), &header, sizeof(header));
+    computeChecksum(result.data(), size, header.checksum);
+    std::memcpy(result.data(), &header, sizeof(header));
+    return result;
+  }
+
+
+  inline const char* errorString(Error error) {
+    switch (error) {
+      case Error::None:         return "No error";
+      case Error::TooSmall:     return "Container too small";
+      case Error::BadMagic:     return "Not a DXBC container";
+      case Error::BadVersion:   return "Unsupported container version";
+      case Error::BadSize:      return "Invalid container size";
+      case Error::BadChunk:     return "Invalid chunk table";
+      case Error::BadChecksum:  return "Checksum mismatch";
+    }
+
+    return "Unknown error";
+  }
+
+  inline std::ostream& operator << (std::ostream& os, Error error) {
+    return os << errorString(error);
+  }
+
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+  * \brief Read-only file view
+  *
+  * Maps large files into memory, so that their contents
+  * can be handed to consumers without intermediate copies.
+  * Small files are read with a single read call instead,
+  * since mapping and unmapping them costs more than the
+  * copy. Also used as a fallback if mapping fails.
+  */
+class MappedFile {
+
+public:
+
+  /** Files smaller than this are read rather than mapped */
+  constexpr static size_t MapThreshold = 256 << 10;
+
+  MappedFile() { }
+
+  explicit MappedFile(const std::filesystem::path& path) {
+    open(path);
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator = (const MappedFile&) = delete;
+
+  ~MappedFile() {
+    close();
+  }
+
+  /**
+   * \brief Opens file
+   *
+   * \param [in] path File path
+   * \returns \c true on success
+   */
+  bool open(const std::filesystem::path& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+      return false;
+
+    LARGE_INTEGER size;
+
+    if (GetFileSizeEx(file, &size)) {
+      m_size = size_t(size.QuadPart);
+      m_valid = (m_size >= MapThreshold && map(file)) || read(file);
+    }
+
+    CloseHandle(file);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+      return false;
+
+    struct stat st;
+
+    if (!fstat(fd, &st) && S_ISREG(st.st_mode)) {
+      m_size = size_t(st.st_size);
+      m_valid = (m_size >= MapThreshold && map(fd)) || read(fd);
+    }
+
+    ::close(fd);
+#endif
+
+    if (!m_valid)
+      close();
+
+    return m_valid;
+  }
+
+  void close() {
+#ifdef _WIN32
+    if (m_mapped)
+      UnmapViewOfFile(m_data);
+#else
+    if (m_mapped)
+      munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+    m_buffer.reset();
+    m_data   = nullptr;
+    m_size   = 0;
+    m_mapped = false;
+    m_valid  = false;
+  }
+
+  bool valid() const {
+    return m_valid;
+  }
+
+  bool mapped() const {
+    return m_mapped;
+  }
+
+  const uint8_t* data() const {
+    return m_data;
+  }
+
+  size_t size() const {
+    return m_size;
+  }
+
+private:
+
+  const uint8_t*              m_data   = nullptr;
+  size_t                      m_size   = 0;
+  bool                        m_mapped = false;
+  bool                        m_valid  = false;
+
+  std::unique_ptr<uint8_t[]>  m_buffer;
+
+#ifdef _WIN32
+  bool map(HANDLE file) {
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (!mapping)
+      return false;
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (!data)
+      return false;
+
+    m_data   = reinterpret_cast<const uint8_t*>(data);
+    m_mapped = true;
+    return true;
+  }
+
+  bool read(HANDLE file) {
+    m_buffer = std::make_unique<uint8_t[]>(m_size ? m_size : 1);
+    m_data = m_buffer.get();
+
+    size_t offset = 0;
+
+    while (offset < m_size) {
+      DWORD chunk = DWORD(std::min<size_t>(m_size - offset, 1u << 30));
+      DWORD count = 0;
+
+      if (!ReadFile(file, m_buffer.get() + offset, chunk, &count, nullptr) || !count)
+        return false;
+
+      offset += count;
+    }
+
+    return true;
+  }
+#else
+  bool map(int fd) {
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (data == MAP_FAILED)
+      return false;
+
+    m_data   = reinterpret_cast<const uint8_t*>(data);
+    m_mapped = true;
+    return true;
+  }
+
+  bool read(int fd) {
+    m_buffer = std::make_unique<uint8_t[]>(m_size ? m_size : 1);
+    m_data = m_buffer.get();
+
+    size_t offset = 0;
+
+    while (offset < m_size) {
+      ssize_t count = ::read(fd, m_buffer.get() + offset, m_size - offset);
+
+      if (count <= 0)
+        return false;
+
+      offset += size_t(count);
+    }
+
+    return true;
+  }
+#endif
+
+};
+
+
+/**
+ * \brief Writes file atomically
+ *
+ * Writes the data to a temp file next to the target
+ * and renames it into place, so that readers, including
+ * concurrent processes, never observe partial files.
+ * \param [in] path File path
+ * \param [in] data File contents
+ * \param [in] size File size, in bytes
+ * \returns \c true on success
+ */
+inline bool writeFileAtomic(const std::filesystem::path& path, const void* data, size_t size) {
+  std::filesystem::path temp = path;
+
+  // Process ID and a per-process counter keep temp names
+  // unique across threads and concurrent processes
+  static std::atomic<uint64_t> s_counter = { 0 };
+
+#ifdef _WIN32
+  uint64_t processId = GetCurrentProcessId();
+#else
+  uint64_t processId = uint64_t(getpid());
+#endif
+
+  temp += "." + std::to_string(processId) + "-" + std::to_string(s_counter++) + ".tmp";
+
+  { std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+
+    if (!file.write(reinterpret_cast<const char*>(data), size)) {
+      file.close();
+
+      std::error_code ec;
+      std::filesystem::remove(temp, ec);
+      return false;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(temp, path, ec);
+
+  if (ec) {
+    std::filesystem::remove(temp, ec);
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,444 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "file.h"
+
+/**
+  * \brief Format capability database
+  *
+  * Compact binary snapshot of what d3d11-formats probes
+  * on a device: support flags for every DXGI format, the
+  * feature level and the raw feature data structs. Files
+  * are keyed by adapter, driver version and the versions
+  * of the loaded D3D runtime, so that tools can skip device
+  * creation and probing entirely as long as neither the
+  * driver nor a translation layer like DXVK changes.
+  *
+  * The layout is a header, a format table indexed by the
+  * \c DXGI_FORMAT value, a feature table indexed by the
+  * \c D3D11_FEATURE value, the feature data blobs and an
+  * optional multisample table, again indexed by format.
+  * All lookups are plain array accesses. This header does
+  * not depend on any D3D headers so that databases can be
+  * read and compared on any platform.
+  */
+namespace formatdb {
+
+  constexpr uint32_t Magic   = 0x42444646; // 'FFDB'
+  constexpr uint32_t Version = 3;
+
+  /** Sample counts 1, 2, 4, ..., 32 are stored */
+  constexpr uint32_t SampleCountCount = 6;
+
+  /**
+   * \brief Adapter identity
+   *
+   * A database is only valid for the exact adapter and
+   * user-mode driver version it was generated with. Since
+   * translation layers may report a fixed driver version,
+   * the runtime DLL versions are hashed in as well.
+   */
+  struct AdapterKey {
+    uint32_t vendorId;
+    uint32_t deviceId;
+    uint32_t subSysId;
+    uint32_t revision;
+    uint64_t driverVersion;
+    uint64_t runtimeHash;
+
+    bool operator == (const AdapterKey& other) const {
+      return vendorId      == other.vendorId
+          && deviceId      == other.deviceId
+          && subSysId      == other.subSysId
+          && revision      == other.revision
+          && driverVersion == other.driverVersion
+          && runtimeHash   == other.runtimeHash;
+    }
+
+    bool operator != (const AdapterKey& other) const {
+      return !(*this == other);
+    }
+  };
+
+  struct Header {
+    uint32_t   magic;
+    uint32_t   version;
+    AdapterKey adapter;
+    uint32_t   featureLevel;
+    uint32_t   formatCount;
+    uint32_t   featureCount;
+    uint32_t   multisampleCount;
+    uint64_t   formatOffset;
+    uint64_t   featureOffset;
+    uint64_t   multisampleOffset;
+  };
+
+  /**
+   * \brief Per-format support flags
+   *
+   * Bit masks of \c D3D11_FORMAT_SUPPORT and
+   * \c D3D11_FORMAT_SUPPORT2 values, respectively.
+   * Both are zero if the format is not supported.
+   */
+  struct FormatRecord {
+    uint32_t support;
+    uint32_t support2;
+  };
+
+  /**
+   * \brief Per-format multisample quality levels
+   *
+   * Results of \c CheckMultisampleQualityLevels for each
+   * power-of-two sample count, with and without the tiled
+   * resource flag. Zero means the combination is invalid.
+   */
+  struct MultisampleRecord {
+    uint32_t qualityLevels[SampleCountCount];
+    uint32_t tiledQualityLevels[SampleCountCount];
+  };
+
+  /**
+   * \brief Computes sample count table index
+   *
+   * \param [in] sampleCount Sample count
+   * \returns Index, or \c SampleCountCount if the
+   *    sample count is not a power of two up to 32
+   */
+  inline uint32_t getSampleCountIndex(uint32_t sampleCount) {
+    for (uint32_t i = 0; i < SampleCountCount; i++) {
+      if (sampleCount == (1u << i))
+        return i;
+    }
+
+    return SampleCountCount;
+  }
+
+  /**
+   * \brief Feature data location
+   *
+   * Size is zero if the feature query failed.
+   */
+  struct FeatureRecord {
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  /**
+   * \brief Formats driver version
+   *
+   * \param [in] version UMD version as returned by
+   *    \c IDXGIAdapter::CheckInterfaceSupport
+   * \returns Dotted version string
+   */
+  inline std::string driverVersionString(uint64_t version) {
+    return std::to_string((version >> 48) & 0xFFFF) + "."
+         + std::to_string((version >> 32) & 0xFFFF) + "."
+         + std::to_string((version >> 16) & 0xFFFF) + "."
+         + std::to_string((version >>  0) & 0xFFFF);
+  }
+
+  /**
+   * \brief Computes database file name for an adapter
+   *
+   * \param [in] key Adapter key
+   * \returns File name, without directory
+   */
+  inline std::string getFileName(const AdapterKey& key) {
+    static const char digits[] = "0123456789abcdef";
+
+    auto hex = [] (uint32_t value, uint32_t count) {
+      std::string str(count, '0');
+
+      for (uint32_t i = 0; i < count; i++)
+        str[count - i - 1] = digits[(value >> (4 * i)) & 0xF];
+
+      return str;
+    };
+
+    return hex(key.vendorId, 4) + "-" + hex(key.deviceId, 4) + "-"
+         + hex(key.subSysId, 8) + "-" + hex(key.revision, 2) + "-"
+         + driverVersionString(key.driverVersion) + "-"
+         + hex(uint32_t(key.runtimeHash >> 32), 8) + hex(uint32_t(key.runtimeHash), 8) + ".fmtdb";
+  }
+
+
+  /**
+   * \brief Database builder
+   *
+   * Collects probe results and serializes them into the
+   * binary layout. Formats and features can be set in
+   * any order, tables grow as needed.
+   */
+  class Builder {
+
+  public:
+
+    Builder(const AdapterKey& adapter, uint32_t featureLevel)
+    : m_adapter(adapter), m_featureLevel(featureLevel) { }
+
+    void setFormat(uint32_t format, uint32_t support, uint32_t support2) {
+      if (format >= m_formats.size())
+        m_formats.resize(format + 1, FormatRecord());
+
+      m_formats[format] = { support, support2 };
+    }
+
+    void setFeature(uint32_t feature, const void* data, size_t size) {
+      if (feature >= m_features.size())
+        m_features.resize(feature + 1);
+
+      auto bytes = reinterpret_cast<const uint8_t*>(data);
+      m_features[feature].assign(bytes, bytes + size);
+    }
+
+    void setMultisample(uint32_t format, const MultisampleRecord& record) {
+      if (format >= m_multisample.size())
+        m_multisample.resize(format + 1, MultisampleRecord());
+
+      m_multisample[format] = record;
+    }
+
+    /**
+     * \brief Serializes database
+     * \returns File contents
+     */
+    std::vector<uint8_t> serialize() const {
+      Header header = { };
+      header.magic            = Magic;
+      header.version          = Version;
+      header.adapter          = m_adapter;
+      header.featureLevel     = m_featureLevel;
+      header.formatCount      = uint32_t(m_formats.size());
+      header.featureCount     = uint32_t(m_features.size());
+      header.multisampleCount = uint32_t(m_multisample.size());
+      header.formatOffset     = sizeof(header);
+      header.featureOffset    = header.formatOffset + sizeof(FormatRecord) * m_formats.size();
+
+      std::vector<FeatureRecord> features(m_features.size());
+      size_t dataOffset = header.featureOffset + sizeof(FeatureRecord) * m_features.size();
+      size_t dataSize = 0;
+
+      for (size_t i = 0; i < m_features.size(); i++) {
+        // Keep blobs dword-aligned so that readers
+        // can copy them straight into D3D structs
+        features[i].offset = uint32_t(dataOffset + dataSize);
+        features[i].size = uint32_t(m_features[i].size());
+        dataSize += (m_features[i].size() + 3) & ~size_t(3);
+      }
+
+      header.multisampleOffset = dataOffset + dataSize;
+
+      std::vector<uint8_t> result(header.multisampleOffset + sizeof(MultisampleRecord) * m_multisample.size());
+      std::memcpy(&result[0], &header, sizeof(header));
+
+      if (!m_formats.empty())
+        std::memcpy(&result[header.formatOffset], m_formats.data(), sizeof(FormatRecord) * m_formats.size());
+
+      if (!features.empty())
+        std::memcpy(&result[header.featureOffset], features.data(), sizeof(FeatureRecord) * features.size());
+
+      for (size_t i = 0; i < m_features.size(); i++) {
+        if (!m_features[i].empty())
+          std::memcpy(&result[features[i].offset], m_features[i].data(), m_features[i].size());
+      }
+
+      if (!m_multisample.empty())
+        std::memcpy(&result[header.multisampleOffset], m_multisample.data(), sizeof(MultisampleRecord) * m_multisample.size());
+
+      return result;
+    }
+
+  private:
+
+    AdapterKey                        m_adapter;
+    uint32_t                          m_featureLevel;
+
+    std::vector<FormatRecord>         m_formats;
+    std::vector<std::vector<uint8_t>> m_features;
+    std::vector<MultisampleRecord>    m_multisample;
+
+  };
+
+
+  /**
+   * \brief Database reader
+   *
+   * Validates the file once on load, after which all
+   * queries are bounds-checked array lookups.
+   */
+  class Database {
+
+  public:
+
+    Database() { }
+
+    explicit Database(const std::filesystem::path& path) {
+      open(path);
+    }
+
+    /**
+     * \brief Opens database file
+     *
+     * \param [in] path File path
+     * \returns \c true if the file is a valid database
+     */
+    bool open(const std::filesystem::path& path) {
+      m_header = nullptr;
+      m_buffer.clear();
+
+      if (!m_file.open(path))
+        return false;
+
+      return parse(m_file.data(), m_file.size());
+    }
+
+    /**
+     * \brief Loads database from memory
+     *
+     * \param [in] data Serialized database
+     * \returns \c true if the data is a valid database
+     */
+    bool load(std::vector<uint8_t> data) {
+      m_header = nullptr;
+      m_file.close();
+      m_buffer = std::move(data);
+      return parse(m_buffer.data(), m_buffer.size());
+    }
+
+    bool valid() const {
+      return m_header != nullptr;
+    }
+
+    /** Serialized database, e.g. for writing it to disk */
+    const uint8_t* data() const {
+      return m_data;
+    }
+
+    size_t size() const {
+      return m_size;
+    }
+
+    const AdapterKey& adapter() const {
+      return m_header->adapter;
+    }
+
+    uint32_t featureLevel() const {
+      return m_header->featureLevel;
+    }
+
+    uint32_t formatCount() const {
+      return m_header->formatCount;
+    }
+
+    /**
+     * \brief Queries format support
+     *
+     * \param [in] format \c DXGI_FORMAT value
+     * \returns Support flags, zero for unknown formats
+     */
+    FormatRecord getFormat(uint32_t format) const {
+      return format < m_header->formatCount
+        ? m_formats[format]
+        : FormatRecord();
+    }
+
+    /**
+     * \brief Checks for multisample data
+     *
+     * Only present if the database was generated
+     * with the multisample matrix enabled.
+     */
+    bool hasMultisample() const {
+      return m_header->multisampleCount != 0;
+    }
+
+    /**
+     * \brief Queries multisample quality levels
+     *
+     * \param [in] format \c DXGI_FORMAT value
+     * \param [in] sampleCount Sample count
+     * \param [in] tiled Whether to query tiled resource support
+     * \returns Number of quality levels, as returned
+     *    by \c CheckMultisampleQualityLevels
+     */
+    uint32_t getQualityLevels(uint32_t format, uint32_t sampleCount, bool tiled) const {
+      uint32_t index = getSampleCountIndex(sampleCount);
+
+      if (format >= m_header->multisampleCount || index >= SampleCountCount)
+        return 0;
+
+      return tiled
+        ? m_multisample[format].tiledQualityLevels[index]
+        : m_multisample[format].qualityLevels[index];
+    }
+
+    /**
+     * \brief Queries feature data
+     *
+     * Behaves like \c CheckFeatureSupport, i.e. the
+     * size must match the stored struct exactly.
+     * \param [in] feature \c D3D11_FEATURE value
+     * \param [out] data Feature data
+     * \param [in] size Size of the feature struct
+     * \returns \c true if the feature data is present
+     */
+    bool getFeature(uint32_t feature, void* data, size_t size) const {
+      if (feature >= m_header->featureCount || !m_features[feature].size
+       || m_features[feature].size != size)
+        return false;
+
+      std::memcpy(data, m_data + m_features[feature].offset, size);
+      return true;
+    }
+
+  private:
+
+    MappedFile                m_file;
+    std::vector<uint8_t>      m_buffer;
+    const uint8_t*            m_data        = nullptr;
+    size_t                    m_size        = 0;
+
+    const Header*             m_header      = nullptr;
+    const FormatRecord*       m_formats     = nullptr;
+    const FeatureRecord*      m_features    = nullptr;
+    const MultisampleRecord*  m_multisample = nullptr;
+
+    bool parse(const uint8_t* data, size_t size) {
+      if (size < sizeof(Header))
+        return false;
+
+      auto header = reinterpret_cast<const Header*>(data);
+
+      if (header->magic != Magic || header->version != Version)
+        return false;
+
+      if (header->formatOffset > size || (size - header->formatOffset) / sizeof(FormatRecord) < header->formatCount
+       || header->featureOffset > size || (size - header->featureOffset) / sizeof(FeatureRecord) < header->featureCount
+       || header->multisampleOffset > size || (size - header->multisampleOffset) / sizeof(MultisampleRecord) < header->multisampleCount)
+        return false;
+
+      auto features = reinterpret_cast<const FeatureRecord*>(data + header->featureOffset);
+
+      for (uint32_t i = 0; i < header->featureCount; i++) {
+        if (features[i].offset > size || size - features[i].offset < features[i].size)
+          return false;
+      }
+
+      m_data        = data;
+      m_size        = size;
+      m_header      = header;
+      m_formats     = reinterpret_cast<const FormatRecord*>(data + header->formatOffset);
+      m_features    = features;
+      m_multisample = reinterpret_cast<const MultisampleRecord*>(data + header->multisampleOffset);
+      return true;
+    }
+
+  };
+
+}
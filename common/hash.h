@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/**
+  * \brief XXH64 hash
+  *
+  * Streaming implementation of the 64-bit xxHash
+  * algorithm, used to key on-disk caches. Output
+  * matches the reference implementation.
+  */
+class Xxh64 {
+
+  constexpr static uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+  constexpr static uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+  constexpr static uint64_t Prime3 = 0x165667B19E3779F9ull;
+  constexpr static uint64_t Prime4 = 0x85EBCA77C2B2AE63ull;
+  constexpr static uint64_t Prime5 = 0x27D4EB2F165667C5ull;
+
+public:
+
+  Xxh64(uint64_t seed = 0)
+  : m_seed(seed) {
+    m_acc[0] = seed + Prime1 + Prime2;
+    m_acc[1] = seed + Prime2;
+    m_acc[2] = seed;
+    m_acc[3] = seed - Prime1;
+  }
+
+  void update(const void* data, size_t size) {
+    auto src = reinterpret_cast<const uint8_t*>(data);
+    m_length += size;
+
+    if (m_bufferSize) {
+      size_t count = std::min(size, sizeof(m_buffer) - m_bufferSize);
+      std::memcpy(m_buffer + m_bufferSize, src, count);
+
+      m_bufferSize += count;
+      src += count;
+      size -= count;
+
+      if (m_bufferSize < sizeof(m_buffer))
+        return;
+
+      stripe(m_buffer);
+      m_bufferSize = 0;
+    }
+
+    while (size >= sizeof(m_buffer)) {
+      stripe(src);
+      src += sizeof(m_buffer);
+      size -= sizeof(m_buffer);
+    }
+
+    std::memcpy(m_buffer, src, size);
+    m_bufferSize = size;
+  }
+
+  void update(const std::string& str) {
+    // Include the terminator so that consecutive
+    // strings cannot alias each other
+    update(str.c_str(), str.size() + 1);
+  }
+
+  uint64_t digest() const {
+    uint64_t h;
+
+    if (m_length >= sizeof(m_buffer)) {
+      h = rotl(m_acc[0], 1) + rotl(m_acc[1], 7)
+        + rotl(m_acc[2], 12) + rotl(m_acc[3], 18);
+
+      for (uint32_t i = 0; i < 4; i++) {
+        h ^= round(0, m_acc[i]);
+        h = h * Prime1 + Prime4;
+      }
+    } else {
+      h = m_seed + Prime5;
+    }
+
+    h += m_length;
+
+    const uint8_t* p = m_buffer;
+    size_t remaining = m_bufferSize;
+
+    while (remaining >= 8) {
+      h ^= round(0, read64(p));
+      h = rotl(h, 27) * Prime1 + Prime4;
+      p += 8;
+      remaining -= 8;
+    }
+
+    if (remaining >= 4) {
+      h ^= uint64_t(read32(p)) * Prime1;
+      h = rotl(h, 23) * Prime2 + Prime3;
+      p += 4;
+      remaining -= 4;
+    }
+
+    while (remaining) {
+      h ^= uint64_t(*(p++)) * Prime5;
+      h = rotl(h, 11) * Prime1;
+      remaining -= 1;
+    }
+
+    h ^= h >> 33;
+    h *= Prime2;
+    h ^= h >> 29;
+    h *= Prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  static uint64_t hash(const void* data, size_t size, uint64_t seed = 0) {
+    Xxh64 state(seed);
+    state.update(data, size);
+    return state.digest();
+  }
+
+private:
+
+  uint64_t m_seed;
+  uint64_t m_acc[4];
+  uint64_t m_length = 0;
+
+  uint8_t  m_buffer[32];
+  size_t   m_bufferSize = 0;
+
+  static uint64_t rotl(uint64_t v, uint32_t r) {
+    return (v << r) | (v >> (64 - r));
+  }
+
+  static uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  static uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  static uint64_t round(uint64_t acc, uint64_t input) {
+    acc += input * Prime2;
+    acc = rotl(acc, 31);
+    return acc * Prime1;
+  }
+
+  void stripe(const uint8_t* p) {
+    for (uint32_t i = 0; i < 4; i++)
+      m_acc[i] = round(m_acc[i], read64(p + 8 * i));
+  }
+
+};
+
+
+inline std::string hashToString(uint64_t hash) {
+  static const char digits[] = "0123456789abcdef";
+
+  std::string result(16, '0');
+
+  for (uint32_t i = 0; i < 16; i++)
+    result[15 - i] = digits[(hash >> (4 * i)) & 0xF];
+
+  return result;
+}
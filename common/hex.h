@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define HEX_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+  * \brief Hex formatting
+  *
+  * Renders binary data as lists of C hex literals,
+  * e.g. for embedding shaders in source files. All
+  * output is built in one preallocated string rather
+  * than through stream manipulators.
+  */
+namespace hex {
+
+  struct ListLayout {
+    const char* indent;
+    uint32_t    perLine;
+  };
+
+  /** Two lower-case hex digits for every byte value */
+  struct ByteTable {
+    char digits[512];
+
+    ByteTable() {
+      static const char chars[] = "0123456789abcdef";
+
+      for (uint32_t i = 0; i < 256; i++) {
+        digits[2 * i + 0] = chars[i >> 4];
+        digits[2 * i + 1] = chars[i & 0xF];
+      }
+    }
+  };
+
+  inline const char* getByteDigits(uint8_t byte) {
+    static const ByteTable table;
+    return &table.digits[2 * byte];
+  }
+
+  /**
+   * \brief Encodes bytes as hex digits
+   *
+   * \param [out] dst Two characters per byte
+   * \param [in] src Source bytes
+   * \param [in] count Number of bytes
+   */
+  inline void encodeBytes(char* dst, const uint8_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++)
+      std::memcpy(&dst[2 * i], getByteDigits(src[i]), 2);
+  }
+
+#ifdef HEX_SSE2
+  /**
+   * \brief Converts nibbles to hex digits
+   * \param [in] n Vector of values between 0 and 15
+   * \returns Lower-case ASCII hex digits
+   */
+  inline __m128i nibblesToAscii(__m128i n) {
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), letters);
+  }
+#endif
+
+  /**
+   * \brief Encodes dwords as hex digits
+   *
+   * Most significant digit first, as in a literal.
+   * \param [out] dst Eight characters per dword
+   * \param [in] src Source dwords
+   * \param [in] count Number of dwords
+   */
+  inline void encodeDwords(char* dst, const uint32_t* src, size_t count) {
+    size_t i = 0;
+
+#ifdef HEX_SSE2
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    for ( ; i + 4 <= count; i += 4) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+
+      // Byte-swap each dword so that the most significant
+      // byte comes first, SSE2 has no byte shuffle for this
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+      v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+
+      __m128i hi = nibblesToAscii(_mm_and_si128(_mm_srli_epi16(v, 4), mask));
+      __m128i lo = nibblesToAscii(_mm_and_si128(v, mask));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[8 * i +  0]), _mm_unpacklo_epi8(hi, lo));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[8 * i + 16]), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+
+    for ( ; i < count; i++) {
+      for (uint32_t j = 0; j < 4; j++)
+        std::memcpy(&dst[8 * i + 2 * j], getByteDigits(uint8_t(src[i] >> (24 - 8 * j))), 2);
+    }
+  }
+
+  /**
+   * \brief Formats list of hex literals
+   *
+   * Every element is written as \c 0x followed by its
+   * digits and a comma. Elements on the same line are
+   * separated by a space, and every line, including the
+   * last one, ends with a line break.
+   * \param [in] src Source data
+   * \param [in] count Number of elements
+   * \param [in] layout Line layout
+   * \returns Formatted text
+   */
+  template<typename T>
+  std::string formatList(const T* src, size_t count, const ListLayout& layout) {
+    constexpr size_t Digits = 2 * sizeof(T);
+    constexpr size_t Batch = 256;
+
+    size_t indentSize = std::strlen(layout.indent);
+    size_t lineCount = (count + layout.perLine - 1) / layout.perLine;
+
+    // "0x" + digits + "," per element, plus a space between
+    // elements and the indent and line break for each line
+    std::string result(count * (Digits + 4) + lineCount * (indentSize + 1), '\0');
+    char* dst = &result[0];
+
+    char digits[Batch * Digits];
+
+    for (size_t i = 0; i < count; i += Batch) {
+      size_t batchSize = std::min(count - i, Batch);
+
+      if constexpr (sizeof(T) == 4)
+        encodeDwords(digits, reinterpret_cast<const uint32_t*>(&src[i]), batchSize);
+      else
+        encodeBytes(digits, reinterpret_cast<const uint8_t*>(&src[i]), batchSize);
+
+      for (size_t j = 0; j < batchSize; j++) {
+        size_t column = (i + j) % layout.perLine;
+
+        if (!column) {
+          std::memcpy(dst, layout.indent, indentSize);
+          dst += indentSize;
+        } else {
+          *(dst++) = ' ';
+        }
+
+        dst[0] = '0';
+        dst[1] = 'x';
+        std::memcpy(dst + 2, &digits[j * Digits], Digits);
+        dst[2 + Digits] = ',';
+        dst += 3 + Digits;
+
+        if (column == layout.perLine - 1 || i + j == count - 1)
+          *(dst++) = '\n';
+      }
+    }
+
+    result.resize(dst - result.data());
+    return result;
+  }
+
+}
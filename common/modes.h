@@ -0,0 +1,510 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+/**
+  * \brief Display mode matching
+  *
+  * CPU reference for \c FindClosestMatchingMode that
+  * works on a cached copy of an output's mode list.
+  * Mirrors the DXGI types without depending on them,
+  * so that it can be built and checked on any platform.
+  *
+  * Matching follows the documented DXGI rules: fields are
+  * resolved in the order scanline ordering, scaling, format,
+  * resolution, refresh rate, and each step only considers
+  * the modes left over by the previous ones. Unspecified
+  * fields, i.e. zero, are then resolved against the desktop
+  * mode in a second pass with the same rules.
+  */
+namespace modes {
+
+  struct Rational {
+    uint32_t numerator;
+    uint32_t denominator;
+  };
+
+  struct Mode {
+    uint32_t width;
+    uint32_t height;
+    Rational refreshRate;
+    uint32_t format;
+    uint32_t scanlineOrdering;
+    uint32_t scaling;
+  };
+
+  constexpr uint32_t InvalidIndex = ~0u;
+
+  inline bool hasResolution(const Mode& mode) {
+    return mode.width || mode.height;
+  }
+
+  inline bool hasRefreshRate(const Mode& mode) {
+    return mode.refreshRate.numerator && mode.refreshRate.denominator;
+  }
+
+  /**
+   * \brief Resolution distance
+   * \returns Sum of width and height differences
+   */
+  inline uint32_t getResolutionDiff(uint32_t width, uint32_t height, const Mode& target) {
+    return uint32_t(std::abs(int64_t(width)  - int64_t(target.width)))
+         + uint32_t(std::abs(int64_t(height) - int64_t(target.height)));
+  }
+
+  /**
+   * \brief Refresh rate distance
+   *
+   * Converts the mode's rate to the target's denominator
+   * and compares numerators, so that equivalent rationals
+   * such as 60/1 and 60000/1000 compare equal.
+   * \returns Numerator difference
+   */
+  inline uint64_t getRefreshDiff(const Rational& rate, const Rational& target) {
+    if (!rate.denominator)
+      return std::numeric_limits<uint64_t>::max();
+
+    uint64_t scaled = uint64_t(rate.numerator) * uint64_t(target.denominator) / uint64_t(rate.denominator);
+    return scaled > target.numerator ? scaled - target.numerator : target.numerator - scaled;
+  }
+
+  /**
+   * \brief Compares refresh rates
+   * \returns \c true if \c a is lower than \c b
+   */
+  inline bool isRefreshLess(const Rational& a, const Rational& b) {
+    return uint64_t(a.numerator) * uint64_t(b.denominator)
+         < uint64_t(b.numerator) * uint64_t(a.denominator);
+  }
+
+
+  /**
+   * \brief Filters modes against a target
+   *
+   * One matching pass over a candidate list. Specified
+   * scanline ordering, scaling and format only filter if
+   * at least one candidate has the requested value.
+   * \param [in] modes Mode list
+   * \param [in,out] candidates Indices of candidate modes
+   * \param [in] target Mode to match
+   */
+  inline void filterModes(const std::vector<Mode>& modes, std::vector<uint32_t>& candidates, const Mode& target) {
+    bool testScanline = false;
+    bool testScaling  = false;
+    bool testFormat   = false;
+
+    for (uint32_t index : candidates) {
+      const Mode& mode = modes[index];
+      testScanline |= target.scanlineOrdering && mode.scanlineOrdering == target.scanlineOrdering;
+      testScaling  |= target.scaling          && mode.scaling          == target.scaling;
+      testFormat   |= target.format           && mode.format           == target.format;
+    }
+
+    auto remove = [&] (auto pred) {
+      candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+        [&] (uint32_t index) { return pred(modes[index]); }), candidates.end());
+    };
+
+    remove([&] (const Mode& mode) {
+      return (testScanline && mode.scanlineOrdering != target.scanlineOrdering)
+          || (testScaling  && mode.scaling          != target.scaling)
+          || (testFormat   && mode.format           != target.format);
+    });
+
+    if (hasResolution(target)) {
+      uint32_t best = std::numeric_limits<uint32_t>::max();
+
+      for (uint32_t index : candidates)
+        best = std::min(best, getResolutionDiff(modes[index].width, modes[index].height, target));
+
+      remove([&] (const Mode& mode) {
+        return getResolutionDiff(mode.width, mode.height, target) != best;
+      });
+    }
+
+    if (hasRefreshRate(target)) {
+      uint64_t best = std::numeric_limits<uint64_t>::max();
+
+      for (uint32_t index : candidates)
+        best = std::min(best, getRefreshDiff(modes[index].refreshRate, target.refreshRate));
+
+      remove([&] (const Mode& mode) {
+        return getRefreshDiff(mode.refreshRate, target.refreshRate) != best;
+      });
+    }
+  }
+
+  /**
+   * \brief Finds closest mode with a linear scan
+   *
+   * Straightforward implementation of the rules over the
+   * whole list. Used to validate \c ModeTable and as a
+   * baseline for its cost.
+   * \param [in] modes Mode list
+   * \param [in] target Mode to match
+   * \param [in] desktop Current desktop mode
+   * \returns Index into the list, or \c InvalidIndex
+   */
+  inline uint32_t findClosestLinear(const std::vector<Mode>& modes, const Mode& target, const Mode& desktop) {
+    std::vector<uint32_t> candidates(modes.size());
+
+    for (uint32_t i = 0; i < candidates.size(); i++)
+      candidates[i] = i;
+
+    filterModes(modes, candidates, target);
+    filterModes(modes, candidates, desktop);
+
+    return candidates.empty() ? InvalidIndex : candidates.front();
+  }
+
+
+  /**
+   * \brief Generates non-exact queries
+   *
+   * Perturbs resolution and refresh rate of random modes
+   * from the list, and leaves fields unspecified at random.
+   * The format is always kept since DXGI requires it unless
+   * a device is passed in.
+   * \param [in] modes Modes to derive queries from
+   * \param [in] count Number of queries
+   * \param [in] seed Random seed
+   * \returns Queries
+   */
+  inline std::vector<Mode> generateQueries(const std::vector<Mode>& modes, uint32_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<Mode> queries;
+
+    for (uint32_t i = 0; i < count && !modes.empty(); i++) {
+      Mode query = modes[rng() % modes.size()];
+
+      if (rng() % 8) {
+        query.width  = uint32_t(std::max<int32_t>(1, int32_t(query.width)  + int32_t(rng() % 129) - 64));
+        query.height = uint32_t(std::max<int32_t>(1, int32_t(query.height) + int32_t(rng() % 129) - 64));
+      } else {
+        query.width  = 0;
+        query.height = 0;
+      }
+
+      switch (rng() % 4) {
+        case 0: query.refreshRate = { 0, 0 }; break;
+        case 1: query.refreshRate = { 30 + uint32_t(rng() % 150), 1 }; break;
+        default: query.refreshRate = { 30000 + uint32_t(rng() % 150000), 1000 };
+      }
+
+      query.scanlineOrdering = (rng() & 1) ? uint32_t(rng() % 4) : 0;
+      query.scaling          = (rng() & 1) ? uint32_t(rng() % 3) : 0;
+      queries.push_back(query);
+    }
+
+    return queries;
+  }
+
+
+  /**
+   * \brief Indexed mode table
+   *
+   * Keeps modes sorted by scanline ordering, scaling,
+   * format, resolution and refresh rate. Each distinct
+   * combination of the first three forms a group with a
+   * sorted list of distinct resolutions. A query searches
+   * outwards from the requested width in every matching
+   * group, only as far as the best distance allows, then
+   * binary-searches refresh rates. Ties resolve to the
+   * mode listed first, like a linear scan would.
+   */
+  class ModeTable {
+
+  public:
+
+    ModeTable() { }
+
+    explicit ModeTable(std::vector<Mode> modes)
+    : m_modes(std::move(modes)) {
+      m_order.resize(m_modes.size());
+
+      for (uint32_t i = 0; i < m_order.size(); i++)
+        m_order[i] = i;
+
+      std::sort(m_order.begin(), m_order.end(), [this] (uint32_t a, uint32_t b) {
+        const Mode& ma = m_modes[a];
+        const Mode& mb = m_modes[b];
+
+        if (ma.scanlineOrdering != mb.scanlineOrdering) return ma.scanlineOrdering < mb.scanlineOrdering;
+        if (ma.scaling != mb.scaling) return ma.scaling < mb.scaling;
+        if (ma.format  != mb.format)  return ma.format  < mb.format;
+        if (ma.width   != mb.width)   return ma.width   < mb.width;
+        if (ma.height  != mb.height)  return ma.height  < mb.height;
+
+        if (isRefreshLess(ma.refreshRate, mb.refreshRate)) return true;
+        if (isRefreshLess(mb.refreshRate, ma.refreshRate)) return false;
+        return a < b;
+      });
+
+      for (uint32_t i = 0; i < m_order.size(); i++) {
+        const Mode& mode = m_modes[m_order[i]];
+
+        if (m_groups.empty()
+         || m_groups.back().scanlineOrdering != mode.scanlineOrdering
+         || m_groups.back().scaling          != mode.scaling
+         || m_groups.back().format           != mode.format) {
+          uint32_t first = uint32_t(m_resolutions.size());
+          m_groups.push_back({ mode.scanlineOrdering, mode.scaling, mode.format, first, first });
+        }
+
+        Group& group = m_groups.back();
+
+        if (group.begin == group.end
+         || m_resolutions.back().width  != mode.width
+         || m_resolutions.back().height != mode.height) {
+          m_resolutions.push_back({ uint32_t(m_groups.size() - 1), mode.width, mode.height, i, i });
+          group.end += 1;
+        }
+
+        m_resolutions.back().end = i + 1;
+      }
+    }
+
+    size_t size() const {
+      return m_modes.size();
+    }
+
+    const Mode& operator [] (uint32_t index) const {
+      return m_modes[index];
+    }
+
+    /**
+     * \brief Finds closest mode
+     *
+     * \param [in] target Mode to match
+     * \param [in] desktop Current desktop mode
+     * \returns Index into the original list, or
+     *    \c InvalidIndex if no mode matches
+     */
+    uint32_t findClosest(const Mode& target, const Mode& desktop) const {
+      std::vector<uint32_t> groups(m_groups.size());
+      std::vector<Span> spans;
+
+      for (uint32_t i = 0; i < groups.size(); i++)
+        groups[i] = i;
+
+      // If the target leaves resolution and refresh rate
+      // unspecified, only whole groups are filtered out, so
+      // the desktop pass can still use the index. Otherwise,
+      // the desktop pass usually sees a handful of spans.
+      if (!hasResolution(target) && !hasRefreshRate(target)) {
+        selectGroups(groups, target);
+        searchGroups(spans, groups, desktop);
+      } else {
+        searchGroups(spans, groups, target);
+        filterSpans(spans, desktop);
+      }
+
+      uint32_t bestIndex = InvalidIndex;
+
+      for (const auto& span : spans) {
+        for (uint32_t i = span.begin; i < span.end; i++)
+          bestIndex = std::min(bestIndex, m_order[i]);
+      }
+
+      return bestIndex;
+    }
+
+  private:
+
+    struct Group {
+      uint32_t scanlineOrdering;
+      uint32_t scaling;
+      uint32_t format;
+      uint32_t begin;
+      uint32_t end;
+    };
+
+    struct Resolution {
+      uint32_t group;
+      uint32_t width;
+      uint32_t height;
+      uint32_t begin;
+      uint32_t end;
+    };
+
+    /** Sorted range of modes with one resolution */
+    struct Span {
+      const Resolution* res;
+      uint32_t          begin;
+      uint32_t          end;
+    };
+
+    std::vector<Mode>         m_modes;
+    std::vector<uint32_t>     m_order;
+    std::vector<Group>        m_groups;
+    std::vector<Resolution>   m_resolutions;
+
+    /**
+     * \brief Filters groups against a target
+     *
+     * \param [in,out] groups Candidate groups
+     * \param [in] target Mode to match
+     */
+    void selectGroups(std::vector<uint32_t>& groups, const Mode& target) const {
+      bool testScanline = false;
+      bool testScaling  = false;
+      bool testFormat   = false;
+
+      for (uint32_t index : groups) {
+        const Group& group = m_groups[index];
+        testScanline |= target.scanlineOrdering && group.scanlineOrdering == target.scanlineOrdering;
+        testScaling  |= target.scaling          && group.scaling          == target.scaling;
+        testFormat   |= target.format           && group.format           == target.format;
+      }
+
+      groups.erase(std::remove_if(groups.begin(), groups.end(), [&] (uint32_t index) {
+        const Group& group = m_groups[index];
+
+        return (testScanline && group.scanlineOrdering != target.scanlineOrdering)
+            || (testScaling  && group.scaling          != target.scaling)
+            || (testFormat   && group.format           != target.format);
+      }), groups.end());
+    }
+
+    /**
+     * \brief Matching pass over whole groups
+     *
+     * Uses the resolution index if the target specifies
+     * a resolution. Otherwise, this is linear in the number
+     * of distinct resolutions.
+     * \param [out] spans Matching modes
+     * \param [in] groups Candidate groups
+     * \param [in] target Mode to match
+     */
+    void searchGroups(std::vector<Span>& spans, std::vector<uint32_t>& groups, const Mode& target) const {
+      selectGroups(groups, target);
+
+      uint32_t bestDiff = std::numeric_limits<uint32_t>::max();
+      spans.clear();
+
+      for (uint32_t index : groups) {
+        const Group& group = m_groups[index];
+
+        const Resolution* begin = m_resolutions.data() + group.begin;
+        const Resolution* end   = m_resolutions.data() + group.end;
+
+        if (!hasResolution(target)) {
+          for (auto res = begin; res != end; res++)
+            spans.push_back({ res, res->begin, res->end });
+          continue;
+        }
+
+        // The width difference alone bounds the distance,
+        // so stop in either direction once it exceeds it
+        auto start = std::lower_bound(begin, end, target.width,
+          [] (const Resolution& res, uint32_t width) { return res.width < width; });
+
+        for (auto res = start; res != end && res->width - target.width <= bestDiff; res++)
+          addResolution(spans, res, target, bestDiff);
+
+        for (auto res = start; res != begin && target.width - (res - 1)->width <= bestDiff; res--)
+          addResolution(spans, res - 1, target, bestDiff);
+      }
+
+      filterRefresh(spans, target);
+    }
+
+    void addResolution(std::vector<Span>& spans, const Resolution* res, const Mode& target, uint32_t& bestDiff) const {
+      uint32_t diff = getResolutionDiff(res->width, res->height, target);
+
+      if (diff < bestDiff) {
+        bestDiff = diff;
+        spans.clear();
+      }
+
+      if (diff == bestDiff)
+        spans.push_back({ res, res->begin, res->end });
+    }
+
+    void filterSpans(std::vector<Span>& spans, const Mode& target) const {
+      bool testScanline = false;
+      bool testScaling  = false;
+      bool testFormat   = false;
+
+      for (const auto& span : spans) {
+        const Group& group = m_groups[span.res->group];
+        testScanline |= target.scanlineOrdering && group.scanlineOrdering == target.scanlineOrdering;
+        testScaling  |= target.scaling          && group.scaling          == target.scaling;
+        testFormat   |= target.format           && group.format           == target.format;
+      }
+
+      spans.erase(std::remove_if(spans.begin(), spans.end(), [&] (const Span& span) {
+        const Group& group = m_groups[span.res->group];
+
+        return (testScanline && group.scanlineOrdering != target.scanlineOrdering)
+            || (testScaling  && group.scaling          != target.scaling)
+            || (testFormat   && group.format           != target.format);
+      }), spans.end());
+
+      if (hasResolution(target)) {
+        uint32_t best = std::numeric_limits<uint32_t>::max();
+
+        for (const auto& span : spans)
+          best = std::min(best, getResolutionDiff(span.res->width, span.res->height, target));
+
+        spans.erase(std::remove_if(spans.begin(), spans.end(), [&] (const Span& span) {
+          return getResolutionDiff(span.res->width, span.res->height, target) != best;
+        }), spans.end());
+      }
+
+      filterRefresh(spans, target);
+    }
+
+    void filterRefresh(std::vector<Span>& spans, const Mode& target) const {
+      if (!hasRefreshRate(target))
+        return;
+
+      uint64_t best = std::numeric_limits<uint64_t>::max();
+
+      for (auto& span : spans)
+        best = std::min(best, trimRefresh(span, target.refreshRate));
+
+      spans.erase(std::remove_if(spans.begin(), spans.end(), [&] (const Span& span) {
+        return getRefreshDiff(m_modes[m_order[span.begin]].refreshRate, target.refreshRate) != best;
+      }), spans.end());
+    }
+
+    /**
+     * \brief Trims span to its closest refresh rates
+     *
+     * Scaled rates are monotonic in the sorted order, so the
+     * closest ones are right around the partition point.
+     * \returns Refresh rate difference of remaining modes
+     */
+    uint64_t trimRefresh(Span& span, const Rational& target) const {
+      const uint32_t* order = m_order.data();
+
+      uint32_t mid = uint32_t(std::partition_point(order + span.begin, order + span.end,
+        [&] (uint32_t index) { return isRefreshLess(m_modes[index].refreshRate, target); }) - order);
+
+      uint64_t diff = std::numeric_limits<uint64_t>::max();
+
+      if (mid > span.begin)
+        diff = std::min(diff, getRefreshDiff(m_modes[order[mid - 1]].refreshRate, target));
+
+      if (mid < span.end)
+        diff = std::min(diff, getRefreshDiff(m_modes[order[mid]].refreshRate, target));
+
+      // Equal scaled rates can span several entries
+      while (span.begin < mid && getRefreshDiff(m_modes[order[span.begin]].refreshRate, target) != diff)
+        span.begin++;
+
+      while (span.end > mid && getRefreshDiff(m_modes[order[span.end - 1]].refreshRate, target) != diff)
+        span.end--;
+
+      return diff;
+    }
+
+  };
+
+}
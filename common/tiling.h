@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+  * \brief Reference model of D3D tiled resource layouts
+  *
+  * Computes the standard tile shapes, subresource tiling
+  * and packed mip layout of tiled resources the way the
+  * D3D11.2 specification defines them. Formats are only
+  * described by their block size and extent so that the
+  * model does not depend on any Windows headers.
+  *
+  * The number of tiles used by the packed mip tail is
+  * implementation-defined, so the model only provides a
+  * lower bound for it.
+  */
+namespace tiling {
+
+  constexpr uint32_t TileSize   = 65536;
+  constexpr uint32_t PackedTile = ~0u;
+
+  enum class Dimension : uint32_t {
+    Buffer    = 0,
+    Texture2D = 1,
+    Texture3D = 2,
+  };
+
+  struct ElementInfo {
+    uint32_t elementSize;   ///< Size of one texel or block, in bytes
+    uint32_t blockWidth;    ///< Block width, 1 for uncompressed formats
+    uint32_t blockHeight;   ///< Block height, 1 for uncompressed formats
+  };
+
+  struct ResourceDesc {
+    Dimension   dimension;
+    ElementInfo format;
+    uint32_t    width;      ///< Byte width for buffers
+    uint32_t    height;
+    uint32_t    depth;
+    uint32_t    mipLevels;
+    uint32_t    arraySize;
+  };
+
+  struct TileShape {
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+  };
+
+  struct SubresourceTiling {
+    uint32_t widthInTiles;
+    uint32_t heightInTiles;
+    uint32_t depthInTiles;
+    uint32_t startTile;
+  };
+
+  struct ResourceTiling {
+    TileShape shape;
+    uint32_t  tileCount;          ///< Total tile count, including mip tails
+    uint32_t  standardMips;
+    uint32_t  packedMips;
+    uint32_t  packedTilesMin;     ///< Lower bound of tiles per packed mip tail
+    uint32_t  packedStartTile;    ///< First tile of the mip tail of slice 0
+    uint32_t  sliceStandardTiles; ///< Tiles used by standard mips of one slice
+    std::vector<SubresourceTiling> subresources;
+  };
+
+
+  inline uint32_t divCeil(uint32_t a, uint32_t b) {
+    return (a + b - 1) / b;
+  }
+
+
+  inline uint32_t mipExtent(uint32_t extent, uint32_t mip) {
+    return std::max(extent >> mip, 1u);
+  }
+
+
+  /**
+   * \brief Computes standard tile shape
+   *
+   * Tile shapes are expressed in texels. Buffers use
+   * a 64k x 1 x 1 shape, texture shapes only depend on
+   * the element size and dimension.
+   * \param [in] dimension Resource dimension
+   * \param [in] format Element properties
+   * \param [out] shape Standard tile shape
+   * \returns \c false if no standard shape exists
+   */
+  inline bool getTileShape(
+          Dimension     dimension,
+    const ElementInfo&  format,
+          TileShape&    shape) {
+    if (dimension == Dimension::Buffer) {
+      shape = { TileSize, 1, 1 };
+      return true;
+    }
+
+    // Shapes in elements, indexed by log2 of the element size
+    static const TileShape shapes2D[] = {
+      { 256, 256, 1 }, { 256, 128, 1 }, { 128, 128, 1 },
+      { 128,  64, 1 }, {  64,  64, 1 },
+    };
+
+    static const TileShape shapes3D[] = {
+      {  64,  32, 32 }, {  32,  32, 32 }, {  32,  32, 16 },
+      {  32,  16, 16 }, {  16,  16, 16 },
+    };
+
+    uint32_t index = 0;
+
+    while (index < 5 && (1u << index) != format.elementSize)
+      index += 1;
+
+    if (index == 5)
+      return false;
+
+    shape = dimension == Dimension::Texture3D
+      ? shapes3D[index]
+      : shapes2D[index];
+
+    shape.width  *= format.blockWidth;
+    shape.height *= format.blockHeight;
+    return true;
+  }
+
+
+  /**
+   * \brief Computes reference tiling for a resource
+   *
+   * Standard mips are all leading mips that span at least
+   * one full tile in every dimension. Subresources are
+   * ordered by array slice first, then mip level, and the
+   * mip tail of each slice directly follows its standard
+   * mips in the overall tile range.
+   * \param [in] desc Resource description
+   * \param [out] tiling Reference tiling
+   * \param [in] packedTiles Tiles per mip tail as reported
+   *    by the implementation, or 0 to use the lower bound
+   * \returns \c false if the format has no standard shape
+   */
+  inline bool computeTiling(
+    const ResourceDesc&   desc,
+          ResourceTiling& tiling,
+          uint32_t        packedTiles = 0) {
+    tiling.subresources.clear();
+
+    if (!getTileShape(desc.dimension, desc.format, tiling.shape))
+      return false;
+
+    if (desc.dimension == Dimension::Buffer) {
+      uint32_t tileCount = divCeil(desc.width, TileSize);
+
+      tiling.tileCount = tileCount;
+      tiling.standardMips = 1;
+      tiling.packedMips = 0;
+      tiling.packedTilesMin = 0;
+      tiling.packedStartTile = 0;
+      tiling.sliceStandardTiles = tileCount;
+      tiling.subresources.push_back({ tileCount, 1, 1, 0 });
+      return true;
+    }
+
+    const TileShape& shape = tiling.shape;
+    const ElementInfo& fmt = desc.format;
+
+    uint32_t depth = desc.dimension == Dimension::Texture3D ? desc.depth : 1;
+
+    uint32_t standardMips = 0;
+    uint32_t standardTiles = 0;
+    uint64_t packedBytes = 0;
+
+    for (uint32_t m = 0; m < desc.mipLevels; m++) {
+      uint32_t w = mipExtent(desc.width,  m);
+      uint32_t h = mipExtent(desc.height, m);
+      uint32_t d = mipExtent(depth,       m);
+
+      if (standardMips == m && w >= shape.width && h >= shape.height && d >= shape.depth) {
+        uint32_t tiles = divCeil(w, shape.width)
+                       * divCeil(h, shape.height)
+                       * divCeil(d, shape.depth);
+
+        standardMips += 1;
+        standardTiles += tiles;
+      } else {
+        packedBytes += divCeil(w, fmt.blockWidth)
+                     * divCeil(h, fmt.blockHeight)
+                     * uint64_t(d * fmt.elementSize);
+      }
+    }
+
+    tiling.standardMips = standardMips;
+    tiling.packedMips = desc.mipLevels - standardMips;
+    tiling.packedTilesMin = tiling.packedMips ? uint32_t((packedBytes + TileSize - 1) / TileSize) : 0;
+    tiling.packedStartTile = tiling.packedMips ? standardTiles : 0;
+    tiling.sliceStandardTiles = standardTiles;
+
+    if (!tiling.packedMips)
+      packedTiles = 0;
+    else if (!packedTiles)
+      packedTiles = tiling.packedTilesMin;
+
+    uint32_t sliceTiles = standardTiles + packedTiles;
+    tiling.tileCount = sliceTiles * desc.arraySize;
+
+    for (uint32_t a = 0; a < desc.arraySize; a++) {
+      uint32_t tileIndex = a * sliceTiles;
+
+      for (uint32_t m = 0; m < desc.mipLevels; m++) {
+        if (m < standardMips) {
+          SubresourceTiling sub;
+          sub.widthInTiles  = divCeil(mipExtent(desc.width,  m), shape.width);
+          sub.heightInTiles = divCeil(mipExtent(desc.height, m), shape.height);
+          sub.depthInTiles  = divCeil(mipExtent(depth,       m), shape.depth);
+          sub.startTile     = tileIndex;
+
+          tileIndex += sub.widthInTiles * sub.heightInTiles * sub.depthInTiles;
+          tiling.subresources.push_back(sub);
+        } else {
+          tiling.subresources.push_back({ 0, 0, 0, PackedTile });
+        }
+      }
+    }
+
+    return true;
+  }
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <windows.h>
+#include <winver.h>
+
+#include "str.h"
+
+/**
+ * \brief Queries file version of a loaded module
+ *
+ * Useful as part of cache keys, so that updating a
+ * DLL invalidates results it previously produced.
+ * \param [in] moduleName Module name, e.g. \c d3dcompiler_47.dll
+ * \returns Version string, or the module path if the
+ *    module has no version info
+ */
+inline std::string getModuleVersion(const WCHAR* moduleName) {
+  HMODULE module = GetModuleHandleW(moduleName);
+
+  std::vector<WCHAR> path(MAX_PATH);
+
+  if (!module || !GetModuleFileNameW(module, path.data(), path.size()))
+    return "unknown";
+
+  DWORD handle = 0;
+  DWORD size = GetFileVersionInfoSizeW(path.data(), &handle);
+
+  std::vector<char> info(size);
+  VS_FIXEDFILEINFO* fixedInfo = nullptr;
+  UINT fixedInfoSize = 0;
+
+  if (!size || !GetFileVersionInfoW(path.data(), 0, size, info.data())
+   || !VerQueryValueW(info.data(), L"\\", reinterpret_cast<void**>(&fixedInfo), &fixedInfoSize)
+   || !fixedInfo)
+    return fromws(path.data());
+
+  return format(
+    HIWORD(fixedInfo->dwFileVersionMS), ".", LOWORD(fixedInfo->dwFileVersionMS), ".",
+    HIWORD(fixedInfo->dwFileVersionLS), ".", LOWORD(fixedInfo->dwFileVersionLS));
+}
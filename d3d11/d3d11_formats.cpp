@@ -1,6 +1,13 @@
 #include <iostream>
+#include <iomanip>
 #include <cstring>
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <thread>
+#include <vector>
 
 #include <d3dcompiler.h>
 #include <d3d11_4.h>
@@ -8,8 +15,13 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include "../common/bench.h"
 #include "../common/com.h"
+#include "../common/file.h"
+#include "../common/formatdb.h"
+#include "../common/hash.h"
 #include "../common/str.h"
+#include "../common/version.h"
 
 #undef ENUM_NAME
 #define ENUM_NAME(e) case e: return #e;
@@ -194,31 +206,355 @@ std::string GetFormatFlagName2(UINT Flag) {
 }
 
 
-int main(int, char**) {
-  Com<ID3D11Device> device;
+/**
+ * \brief Queries adapter identity
+ *
+ * DXVK reports a fixed driver version, so the versions
+ * of the loaded d3d11.dll and dxgi.dll are part of the
+ * key as well, so that updating either invalidates it.
+ * \param [in] adapter DXGI adapter
+ * \param [out] key Adapter key
+ * \returns \c true on success
+ */
+bool getAdapterKey(IDXGIAdapter1* adapter, formatdb::AdapterKey& key) {
+  DXGI_ADAPTER_DESC1 desc;
+  LARGE_INTEGER driverVersion;
 
-  std::array<D3D_FEATURE_LEVEL, 9> featureLevels = {
-    D3D_FEATURE_LEVEL_12_1,
-    D3D_FEATURE_LEVEL_12_0,
-    D3D_FEATURE_LEVEL_11_1,
-    D3D_FEATURE_LEVEL_11_0,
-    D3D_FEATURE_LEVEL_10_1,
-    D3D_FEATURE_LEVEL_10_0,
-    D3D_FEATURE_LEVEL_9_3,
-    D3D_FEATURE_LEVEL_9_2,
-    D3D_FEATURE_LEVEL_9_1,
+  if (FAILED(adapter->GetDesc1(&desc))
+   || FAILED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driverVersion)))
+    return false;
+
+  key.vendorId      = desc.VendorId;
+  key.deviceId      = desc.DeviceId;
+  key.subSysId      = desc.SubSysId;
+  key.revision      = desc.Revision;
+  key.driverVersion = uint64_t(driverVersion.QuadPart);
+
+  Xxh64 runtimeHash;
+  runtimeHash.update(getModuleVersion(L"d3d11.dll"));
+  runtimeHash.update(getModuleVersion(L"dxgi.dll"));
+  key.runtimeHash = runtimeHash.digest();
+  return true;
+}
+
+
+template<D3D11_FEATURE Feature, typename T>
+void probeFeature(ID3D11Device* device, formatdb::Builder& builder) {
+  T data = { };
+
+  if (SUCCEEDED(device->CheckFeatureSupport(Feature, &data, sizeof(data))))
+    builder.setFeature(Feature, &data, sizeof(data));
+}
+
+
+/**
+ * \brief Probes device capabilities
+ *
+ * \param [in] device D3D11 device
+ * \param [in] builder Database to fill
+ */
+void probeDevice(ID3D11Device* device, formatdb::Builder& builder) {
+  probeFeature<D3D11_FEATURE_THREADING,                    D3D11_FEATURE_DATA_THREADING>                   (device, builder);
+  probeFeature<D3D11_FEATURE_DOUBLES,                      D3D11_FEATURE_DATA_DOUBLES>                     (device, builder);
+  probeFeature<D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT, D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT>(device, builder);
+  probeFeature<D3D11_FEATURE_D3D11_OPTIONS,                D3D11_FEATURE_DATA_D3D11_OPTIONS>               (device, builder);
+  probeFeature<D3D11_FEATURE_D3D11_OPTIONS1,               D3D11_FEATURE_DATA_D3D11_OPTIONS1>              (device, builder);
+  probeFeature<D3D11_FEATURE_D3D11_OPTIONS2,               D3D11_FEATURE_DATA_D3D11_OPTIONS2>              (device, builder);
+  probeFeature<D3D11_FEATURE_D3D11_OPTIONS3,               D3D11_FEATURE_DATA_D3D11_OPTIONS3>              (device, builder);
+  probeFeature<D3D11_FEATURE_D3D11_OPTIONS4,               D3D11_FEATURE_DATA_D3D11_OPTIONS4>              (device, builder);
+  probeFeature<D3D11_FEATURE_D3D11_OPTIONS5,               D3D11_FEATURE_DATA_D3D11_OPTIONS5>              (device, builder);
+
+  for (UINT i  = UINT(DXGI_FORMAT_UNKNOWN);
+            i <= UINT(DXGI_FORMAT_B4G4R4A4_UNORM);
+            i++) {
+    DXGI_FORMAT format = DXGI_FORMAT(i);
+    UINT        flags  = 0;
+
+    D3D11_FEATURE_DATA_FORMAT_SUPPORT2 support2 = { };
+    support2.InFormat = format;
+
+    if (SUCCEEDED(device->CheckFormatSupport(format, &flags))) {
+      if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_FORMAT_SUPPORT2, &support2, sizeof(support2))))
+        support2.OutFormatSupport2 = 0;
+    }
+
+    builder.setFormat(i, flags, support2.OutFormatSupport2);
+  }
+}
+
+
+/**
+ * \brief Probes multisample quality levels
+ *
+ * Queries every format at every power-of-two sample
+ * count, for regular and tiled resources. D3D11 device
+ * methods are free-threaded, so the queries are spread
+ * across worker threads. Prints what the probe cost.
+ * \param [in] device D3D11 device
+ * \param [in] builder Database to fill
+ * \param [in] threadCount Worker thread count, or 0
+ */
+void probeMultisample(ID3D11Device* device, formatdb::Builder& builder, uint32_t threadCount) {
+  struct Query {
+    DXGI_FORMAT format;
+    UINT        sampleIndex;
+    bool        tiled;
+    UINT        levels;
+    double      timeUs;
   };
 
-  D3D_FEATURE_LEVEL featureLevel = D3D_FEATURE_LEVEL();
+  // Tiled queries need CheckMultisampleQualityLevels1
+  Com<ID3D11Device2> device2;
+  device->QueryInterface(__uuidof(ID3D11Device2), reinterpret_cast<void**>(&device2));
 
-  if (FAILED(D3D11CreateDevice(
-        nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, 0,
-        featureLevels.data(), featureLevels.size(),
-        D3D11_SDK_VERSION, &device, &featureLevel, nullptr))) {
-    std::cerr << "Failed to create D3D11 device" << std::endl;
-    return 1;
+  std::vector<Query> queries;
+
+  for (UINT i  = UINT(DXGI_FORMAT_UNKNOWN);
+            i <= UINT(DXGI_FORMAT_B4G4R4A4_UNORM);
+            i++) {
+    for (UINT s = 0; s < formatdb::SampleCountCount; s++) {
+      queries.push_back({ DXGI_FORMAT(i), s, false });
+
+      if (device2 != nullptr)
+        queries.push_back({ DXGI_FORMAT(i), s, true });
+    }
+  }
+
+  if (!threadCount)
+    threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+  std::atomic<size_t> nextQuery = { 0 };
+
+  bench::Timer timer;
+
+  auto worker = [&] {
+    size_t index;
+
+    while ((index = nextQuery++) < queries.size()) {
+      auto& query = queries[index];
+      UINT sampleCount = 1u << query.sampleIndex;
+
+      bench::Timer queryTimer;
+      HRESULT hr;
+
+      if (query.tiled) {
+        hr = device2->CheckMultisampleQualityLevels1(query.format, sampleCount,
+          D3D11_CHECK_MULTISAMPLE_QUALITY_LEVELS_TILED_RESOURCE, &query.levels);
+      } else {
+        hr = device->CheckMultisampleQualityLevels(query.format, sampleCount, &query.levels);
+      }
+
+      query.timeUs = queryTimer.elapsedUs();
+
+      if (FAILED(hr))
+        query.levels = 0;
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  for (uint32_t i = 0; i < threadCount; i++)
+    threads.emplace_back(worker);
+
+  for (auto& thread : threads)
+    thread.join();
+
+  double totalUs = timer.elapsedUs();
+
+  std::vector<formatdb::MultisampleRecord> records(UINT(DXGI_FORMAT_B4G4R4A4_UNORM) + 1);
+  std::vector<double> formatUs(records.size());
+
+  bench::Stats stats;
+
+  for (const auto& query : queries) {
+    auto& record = records[query.format];
+
+    if (query.tiled)
+      record.tiledQualityLevels[query.sampleIndex] = query.levels;
+    else
+      record.qualityLevels[query.sampleIndex] = query.levels;
+
+    formatUs[query.format] += query.timeUs;
+    stats.add(query.timeUs);
+  }
+
+  for (size_t i = 0; i < records.size(); i++)
+    builder.setMultisample(uint32_t(i), records[i]);
+
+  std::vector<size_t> order(records.size());
+
+  for (size_t i = 0; i < order.size(); i++)
+    order[i] = i;
+
+  std::sort(order.begin(), order.end(), [&] (size_t a, size_t b) {
+    return formatUs[a] > formatUs[b];
+  });
+
+  std::cout << "Probed " << queries.size() << " multisample queries on " << threadCount << " threads in "
+            << std::fixed << std::setprecision(1) << (totalUs / 1000.0) << " ms" << std::endl
+            << "Per-query: " << stats << std::endl
+            << "Slowest formats:" << std::endl;
+
+  for (size_t i = 0; i < std::min<size_t>(order.size(), 5); i++) {
+    std::cout << "  " << GetFormatName(DXGI_FORMAT(order[i])) << ": "
+              << (formatUs[order[i]] / 1000.0) << " ms" << std::endl;
+  }
+
+  std::cout << std::defaultfloat;
+}
+
+
+struct BenchQuery {
+  std::string               name;
+  std::string               category;
+  std::function<HRESULT()>  query;
+  double                    firstUs = 0.0;
+  bench::Stats              stats;
+};
+
+
+template<D3D11_FEATURE Feature, typename T>
+BenchQuery benchFeature(ID3D11Device* device, const char* name) {
+  return { std::string("CheckFeatureSupport(") + name + ")", "CheckFeatureSupport", [device] {
+    T data = { };
+    return device->CheckFeatureSupport(Feature, &data, sizeof(data));
+  } };
+}
+
+#define BENCH_FEATURE(feature, type) benchFeature<feature, type>(device, #feature)
+
+
+/**
+ * \brief Measures capability query latency
+ *
+ * Runs every query that d3d11-formats issues, in the same
+ * interleaved order in which an application would issue
+ * them at startup, once per iteration. The first call is
+ * reported separately since implementations may cache
+ * results after it.
+ * \param [in] device D3D11 device
+ * \param [in] iterations Number of times to run each query
+ * \returns Process exit code
+ */
+int runBench(ID3D11Device* device, uint32_t iterations) {
+  std::vector<BenchQuery> queries = {
+    BENCH_FEATURE(D3D11_FEATURE_THREADING,                    D3D11_FEATURE_DATA_THREADING),
+    BENCH_FEATURE(D3D11_FEATURE_DOUBLES,                      D3D11_FEATURE_DATA_DOUBLES),
+    BENCH_FEATURE(D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT, D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT),
+    BENCH_FEATURE(D3D11_FEATURE_D3D11_OPTIONS,                D3D11_FEATURE_DATA_D3D11_OPTIONS),
+    BENCH_FEATURE(D3D11_FEATURE_D3D11_OPTIONS1,               D3D11_FEATURE_DATA_D3D11_OPTIONS1),
+    BENCH_FEATURE(D3D11_FEATURE_D3D11_OPTIONS2,               D3D11_FEATURE_DATA_D3D11_OPTIONS2),
+    BENCH_FEATURE(D3D11_FEATURE_D3D11_OPTIONS3,               D3D11_FEATURE_DATA_D3D11_OPTIONS3),
+    BENCH_FEATURE(D3D11_FEATURE_D3D11_OPTIONS4,               D3D11_FEATURE_DATA_D3D11_OPTIONS4),
+    BENCH_FEATURE(D3D11_FEATURE_D3D11_OPTIONS5,               D3D11_FEATURE_DATA_D3D11_OPTIONS5),
+  };
+
+  for (UINT i  = UINT(DXGI_FORMAT_UNKNOWN);
+            i <= UINT(DXGI_FORMAT_B4G4R4A4_UNORM);
+            i++) {
+    DXGI_FORMAT format = DXGI_FORMAT(i);
+
+    queries.push_back({ "CheckFormatSupport(" + GetFormatName(format) + ")", "CheckFormatSupport", [device, format] {
+      UINT flags = 0;
+      return device->CheckFormatSupport(format, &flags);
+    } });
+
+    queries.push_back({ "FORMAT_SUPPORT2(" + GetFormatName(format) + ")", "FORMAT_SUPPORT2", [device, format] {
+      D3D11_FEATURE_DATA_FORMAT_SUPPORT2 support2 = { };
+      support2.InFormat = format;
+      return device->CheckFeatureSupport(D3D11_FEATURE_FORMAT_SUPPORT2, &support2, sizeof(support2));
+    } });
+  }
+
+  bench::Timer timer;
+
+  for (uint32_t i = 0; i <= iterations; i++) {
+    for (auto& query : queries) {
+      bench::Timer queryTimer;
+      query.query();
+      double us = queryTimer.elapsedUs();
+
+      if (i)
+        query.stats.add(us);
+      else
+        query.firstUs = us;
+    }
+  }
+
+  double totalUs = timer.elapsedUs();
+
+  std::cout << "Ran " << queries.size() << " queries " << iterations << " times in "
+            << std::fixed << std::setprecision(1) << (totalUs / 1000.0) << " ms" << std::endl;
+
+  // Cost of one full pass per category, i.e. roughly what
+  // an application pays for probing everything once
+  std::vector<std::pair<std::string, bench::Stats>> categories;
+
+  for (const auto& query : queries) {
+    auto entry = std::find_if(categories.begin(), categories.end(),
+      [&] (const auto& c) { return c.first == query.category; });
+
+    if (entry == categories.end())
+      entry = categories.insert(categories.end(), { query.category, bench::Stats() });
+
+    entry->second.add(query.stats.mean());
+  }
+
+  for (const auto& c : categories) {
+    std::cout << "  " << c.first << ": " << c.second.count() << " queries, "
+              << c.second.total() << " us per pass" << std::endl;
+  }
+
+  std::sort(queries.begin(), queries.end(), [] (const BenchQuery& a, const BenchQuery& b) {
+    return a.stats.mean() > b.stats.mean();
+  });
+
+  std::cout << "Slowest queries:" << std::endl << std::setprecision(2);
+
+  for (size_t i = 0; i < std::min<size_t>(queries.size(), 20); i++) {
+    const auto& query = queries[i];
+
+    std::cout << "  " << query.name << ": first = " << query.firstUs
+              << " us, avg = " << query.stats.mean()
+              << " us, p50 = " << query.stats.percentile(0.5)
+              << " us, max = " << query.stats.max() << " us" << std::endl;
   }
 
+  std::cout << std::defaultfloat;
+  return 0;
+}
+
+
+/**
+ * \brief Prints multisample support of a format
+ *
+ * \param [in] db Database with multisample data
+ * \param [in] dxgiFormat Format to print
+ * \param [in] tiled Whether to print tiled resource support
+ */
+void printMultisample(const formatdb::Database& db, UINT dxgiFormat, bool tiled) {
+  std::string line;
+
+  for (UINT s = 0; s < formatdb::SampleCountCount; s++) {
+    UINT levels = db.getQualityLevels(dxgiFormat, 1u << s, tiled);
+
+    if (levels)
+      line += format(" ", 1u << s, "x (", levels, ")");
+  }
+
+  if (!line.empty())
+    std::cout << (tiled ? "  Multisample (tiled):" : "  Multisample:") << line << std::endl;
+}
+
+
+/**
+ * \brief Prints capability database
+ * \param [in] db Database, either probed or loaded
+ * \param [in] multisample Whether to print multisample
+ *    support, so that the output does not depend on what
+ *    a cached database happens to contain
+ */
+void printDatabase(const formatdb::Database& db, bool multisample) {
   D3D11_FEATURE_DATA_THREADING                    featureThreading     = { };
   D3D11_FEATURE_DATA_DOUBLES                      featureDoubles       = { };
   D3D11_FEATURE_DATA_SHADER_MIN_PRECISION_SUPPORT featureMinPrecision  = { };
@@ -229,26 +565,32 @@ int main(int, char**) {
   D3D11_FEATURE_DATA_D3D11_OPTIONS4               featureD3D11Options4 = { };
   D3D11_FEATURE_DATA_D3D11_OPTIONS5               featureD3D11Options5 = { };
 
-  std::cout << "Feature level: " << (featureLevel >> 12) << "_" << ((featureLevel >> 8) & 0xf) << std::endl;
+  const auto& adapter = db.adapter();
+
+  std::cout << "Adapter: " << std::hex << std::setfill('0')
+            << std::setw(4) << adapter.vendorId << ":"
+            << std::setw(4) << adapter.deviceId << std::dec << std::setfill(' ')
+            << ", driver " << formatdb::driverVersionString(adapter.driverVersion) << std::endl;
+  std::cout << "Feature level: " << (db.featureLevel() >> 12) << "_" << ((db.featureLevel() >> 8) & 0xf) << std::endl;
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &featureThreading, sizeof(featureThreading)))) {
+  if (db.getFeature(D3D11_FEATURE_THREADING, &featureThreading, sizeof(featureThreading))) {
     std::cout << "D3D11_FEATURE_THREADING:" << std::endl
               << "  DriverConcurrentCreates:          " << featureThreading.DriverConcurrentCreates << std::endl
               << "  DriverCommandLists:               " << featureThreading.DriverCommandLists << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_DOUBLES, &featureDoubles, sizeof(featureDoubles)))) {
+  if (db.getFeature(D3D11_FEATURE_DOUBLES, &featureDoubles, sizeof(featureDoubles))) {
     std::cout << "D3D11_FEATURE_DOUBLES:" << std::endl
               << "  DoublePrecisionFloatShaderOps:    " << featureDoubles.DoublePrecisionFloatShaderOps << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT, &featureMinPrecision, sizeof(featureMinPrecision)))) {
+  if (db.getFeature(D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT, &featureMinPrecision, sizeof(featureMinPrecision))) {
     std::cout << "D3D11_FEATURE_SHADER_MIN_PRECISION_SUPPORT:" << std::endl
               << "  PixelShaderMinPrecision:          " << featureMinPrecision.PixelShaderMinPrecision << std::endl
               << "  AllOtherShaderStagesMinPrecision: " << featureMinPrecision.AllOtherShaderStagesMinPrecision << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &featureD3D11Options, sizeof(featureD3D11Options)))) {
+  if (db.getFeature(D3D11_FEATURE_D3D11_OPTIONS, &featureD3D11Options, sizeof(featureD3D11Options))) {
     std::cout << "D3D11_FEATURE_D3D11_OPTIONS:" << std::endl
               << "  OutputMergerLogicOp:              " << featureD3D11Options.OutputMergerLogicOp << std::endl
               << "  UAVOnlyRenderingForcedSampleCount: " << featureD3D11Options.UAVOnlyRenderingForcedSampleCount << std::endl
@@ -266,7 +608,7 @@ int main(int, char**) {
               << "  ExtendedResourceSharing:          " << featureD3D11Options.ExtendedResourceSharing << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS1, &featureD3D11Options1, sizeof(featureD3D11Options1)))) {
+  if (db.getFeature(D3D11_FEATURE_D3D11_OPTIONS1, &featureD3D11Options1, sizeof(featureD3D11Options1))) {
     std::cout << "D3D11_FEATURE_D3D11_OPTIONS1:" << std::endl
               << "  TiledResourcesTier:               " << featureD3D11Options1.TiledResourcesTier << std::endl
               << "  MinMaxFiltering:                  " << featureD3D11Options1.MinMaxFiltering << std::endl
@@ -275,7 +617,7 @@ int main(int, char**) {
 
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS2, &featureD3D11Options2, sizeof(featureD3D11Options2)))) {
+  if (db.getFeature(D3D11_FEATURE_D3D11_OPTIONS2, &featureD3D11Options2, sizeof(featureD3D11Options2))) {
     std::cout << "D3D11_FEATURE_D3D11_OPTIONS2:" << std::endl
               << "  PSSpecifiedStencilRefSupported:   " << featureD3D11Options2.PSSpecifiedStencilRefSupported << std::endl
               << "  TypedUAVLoadAdditionalFormats:    " << featureD3D11Options2.TypedUAVLoadAdditionalFormats << std::endl
@@ -287,17 +629,17 @@ int main(int, char**) {
               << "  UnifiedMemoryArchitecture:        " << featureD3D11Options2.UnifiedMemoryArchitecture << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS3, &featureD3D11Options3, sizeof(featureD3D11Options3)))) {
+  if (db.getFeature(D3D11_FEATURE_D3D11_OPTIONS3, &featureD3D11Options3, sizeof(featureD3D11Options3))) {
     std::cout << "D3D11_FEATURE_D3D11_OPTIONS3:" << std::endl
               << "  VPAndRTArrayIndexFromAnyShaderFeedingRasterizer: " << featureD3D11Options3.VPAndRTArrayIndexFromAnyShaderFeedingRasterizer << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS4, &featureD3D11Options4, sizeof(featureD3D11Options4)))) {
+  if (db.getFeature(D3D11_FEATURE_D3D11_OPTIONS4, &featureD3D11Options4, sizeof(featureD3D11Options4))) {
     std::cout << "D3D11_FEATURE_D3D11_OPTIONS4:" << std::endl
               << "  ExtendedNV12SharedTextureSupported: " << featureD3D11Options4.ExtendedNV12SharedTextureSupported << std::endl;
   }
 
-  if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS5, &featureD3D11Options5, sizeof(featureD3D11Options5)))) {
+  if (db.getFeature(D3D11_FEATURE_D3D11_OPTIONS5, &featureD3D11Options5, sizeof(featureD3D11Options5))) {
     std::cout << "D3D11_FEATURE_D3D11_OPTIONS5:" << std::endl
               << "  SharedResourceTier:               " << featureD3D11Options5.SharedResourceTier << std::endl;
   }
@@ -306,35 +648,181 @@ int main(int, char**) {
             i <= UINT(DXGI_FORMAT_B4G4R4A4_UNORM);
             i++) {
     DXGI_FORMAT format = DXGI_FORMAT(i);
-    UINT        flags  = 0;
-    
+    auto        record = db.getFormat(i);
+
     std::cout << GetFormatName(format) << ": " << std::endl;
-    
-    if (SUCCEEDED(device->CheckFormatSupport(format, &flags))) {
+
+    if (record.support) {
       for (uint32_t i = 0; i < 32; i++) {
-        if (flags & (1 << i)) {
+        if (record.support & (1u << i)) {
           std::cout << "  "
-                    << GetFormatFlagName(D3D11_FORMAT_SUPPORT(1 << i))
+                    << GetFormatFlagName(D3D11_FORMAT_SUPPORT(1u << i))
                     << std::endl;
         }
       }
 
-      D3D11_FEATURE_DATA_FORMAT_SUPPORT2 support2 = { };
-      support2.InFormat = format;
-
-      if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_FORMAT_SUPPORT2, &support2, sizeof(support2)))) {
-        for (uint32_t i = 0; i < 32; i++) {
-          if (support2.OutFormatSupport2 & (1u << i)) {
-            std::cout << "  "
-                      << GetFormatFlagName2(1u << i)
-                      << std::endl;
-          }
+      for (uint32_t i = 0; i < 32; i++) {
+        if (record.support2 & (1u << i)) {
+          std::cout << "  "
+                    << GetFormatFlagName2(1u << i)
+                    << std::endl;
         }
       }
+
+      if (multisample && db.hasMultisample()) {
+        printMultisample(db, i, false);
+        printMultisample(db, i, true);
+      }
     } else {
       std::cout << "  Not supported" << std::endl;
     }
   }
-  
+}
+
+
+int main(int argc, char** argv) {
+  std::string dbPath;
+  std::string loadPath;
+  std::string cacheDir;
+  bool        multisample = false;
+  uint32_t    threadCount = 0;
+  bool        benchmark   = false;
+  uint32_t    iterations  = 100;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (i + 1 < argc && arg == "--db") {
+      dbPath = argv[++i];
+    } else if (i + 1 < argc && arg == "--load") {
+      loadPath = argv[++i];
+    } else if (i + 1 < argc && arg == "--cache") {
+      cacheDir = argv[++i];
+    } else if (arg == "--msaa") {
+      multisample = true;
+    } else if (i + 1 < argc && arg == "--threads") {
+      threadCount = std::stoul(argv[++i]);
+    } else if (arg == "--bench") {
+      benchmark = true;
+    } else if (i + 1 < argc && arg == "--iterations") {
+      iterations = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: d3d11-formats [--db file] [--load file] [--cache dir] [--msaa [--threads n]]" << std::endl
+                << "       d3d11-formats --bench [--iterations n]" << std::endl;
+      return 1;
+    }
+  }
+
+  formatdb::Database db;
+
+  // Print a previously written database,
+  // e.g. to diff two drivers' capabilities
+  if (!loadPath.empty()) {
+    if (!db.open(loadPath)) {
+      std::cerr << "Failed to load " << loadPath << std::endl;
+      return 1;
+    }
+
+    printDatabase(db, multisample);
+    return 0;
+  }
+
+  Com<IDXGIFactory1> factory;
+  Com<IDXGIAdapter1> adapter;
+
+  if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&factory)))
+   || FAILED(factory->EnumAdapters1(0, &adapter))) {
+    std::cerr << "Failed to get DXGI adapter" << std::endl;
+    return 1;
+  }
+
+  // The key only matters for files that outlive this run,
+  // plain probing can do without it
+  formatdb::AdapterKey key = { };
+
+  if (!getAdapterKey(adapter.ptr(), key)) {
+    if ((!cacheDir.empty() && !benchmark) || !dbPath.empty()) {
+      std::cerr << "Failed to query adapter" << std::endl;
+      return 1;
+    }
+
+    key = formatdb::AdapterKey();
+  }
+
+  // A cached database for the same adapter and driver
+  // makes creating a device and probing unnecessary
+  std::filesystem::path cachePath;
+
+  if (!cacheDir.empty() && !benchmark) {
+    cachePath = std::filesystem::path(cacheDir) / formatdb::getFileName(key);
+
+    if (db.open(cachePath) && db.adapter() == key && (db.hasMultisample() || !multisample)) {
+      if (dbPath.empty())
+        printDatabase(db, multisample);
+      else if (!writeFileAtomic(dbPath, db.data(), db.size())) {
+        std::cerr << "Failed to write " << dbPath << std::endl;
+        return 1;
+      }
+
+      return 0;
+    }
+  }
+
+  Com<ID3D11Device> device;
+
+  std::array<D3D_FEATURE_LEVEL, 9> featureLevels = {
+    D3D_FEATURE_LEVEL_12_1,
+    D3D_FEATURE_LEVEL_12_0,
+    D3D_FEATURE_LEVEL_11_1,
+    D3D_FEATURE_LEVEL_11_0,
+    D3D_FEATURE_LEVEL_10_1,
+    D3D_FEATURE_LEVEL_10_0,
+    D3D_FEATURE_LEVEL_9_3,
+    D3D_FEATURE_LEVEL_9_2,
+    D3D_FEATURE_LEVEL_9_1,
+  };
+
+  D3D_FEATURE_LEVEL featureLevel = D3D_FEATURE_LEVEL();
+
+  if (FAILED(D3D11CreateDevice(
+        adapter.ptr(), D3D_DRIVER_TYPE_UNKNOWN, nullptr, 0,
+        featureLevels.data(), featureLevels.size(),
+        D3D11_SDK_VERSION, &device, &featureLevel, nullptr))) {
+    std::cerr << "Failed to create D3D11 device" << std::endl;
+    return 1;
+  }
+
+  if (benchmark)
+    return runBench(device.ptr(), iterations);
+
+  formatdb::Builder builder(key, featureLevel);
+  probeDevice(device.ptr(), builder);
+
+  if (multisample)
+    probeMultisample(device.ptr(), builder, threadCount);
+
+  if (!db.load(builder.serialize())) {
+    std::cerr << "Failed to build capability database" << std::endl;
+    return 1;
+  }
+
+  if (!cachePath.empty()) {
+    std::error_code ec;
+    std::filesystem::create_directories(cacheDir, ec);
+
+    if (!writeFileAtomic(cachePath, db.data(), db.size()))
+      std::cerr << "Failed to write " << cachePath.string() << std::endl;
+  }
+
+  if (!dbPath.empty()) {
+    if (!writeFileAtomic(dbPath, db.data(), db.size())) {
+      std::cerr << "Failed to write " << dbPath << std::endl;
+      return 1;
+    }
+
+    return 0;
+  }
+
+  printDatabase(db, multisample);
   return 0;
 }
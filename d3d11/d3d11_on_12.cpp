@@ -1,7 +1,12 @@
+#include <algorithm>
 #include <cstring>
+#include <iomanip>
 #include <iostream>
 #include <functional>
 #include <array>
+#include <random>
+#include <string>
+#include <vector>
 
 #include <dxgi1_6.h>
 #include <d3d11on12.h>
@@ -10,6 +15,8 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include "../common/bench.h"
+#include "../common/buddy.h"
 #include "../common/com.h"
 #include "../common/str.h"
 
@@ -27,11 +34,72 @@ struct Vertex {
   float x, y;
 };
 
+constexpr uint32_t MaxWrapBenchResources = 1000;
+
 class D3D11On12App {
 
+  /**
+   * \brief Per-frame command allocator
+   *
+   * An allocator can only be reset once the GPU has
+   * finished the frame that used it, which is tracked
+   * with the fence value signaled after that frame.
+   */
+  struct FrameSlot {
+    Com<ID3D12CommandAllocator> allocator;
+    UINT64                      fenceValue = 0;
+    bool                        pending = false;
+    bench::Timer                submitTimer;
+  };
+
+  /**
+   * \brief Set of heaps for one kind of placed resource
+   *
+   * Heap tier 1 hardware cannot mix buffers and textures
+   * in one heap, so each kind gets its own heaps, each
+   * with a buddy allocator for its address range.
+   */
+  struct HeapPool {
+    const char*                       name;
+    D3D12_HEAP_FLAGS                  flags;
+    std::vector<Com<ID3D12Heap>>      heaps;
+    std::vector<buddy::Allocator>     allocators;
+  };
+
+  struct PlacedResource {
+    uint32_t                          pool;
+    uint32_t                          heap;
+    uint64_t                          size;
+    buddy::Allocation                 allocation;
+    Com<ID3D12Resource>               d3d12Resource;
+    Com<ID3D11Resource>               d3d11Resource;
+  };
+
+  struct HeapStressStats {
+    bench::Stats                      place;
+    bench::Stats                      wrap;
+    bench::Stats                      destroy;
+    double                            allocUs = 0.0;
+    double                            freeUs  = 0.0;
+    uint64_t                          allocCount = 0;
+    uint64_t                          freeCount = 0;
+    uint32_t                          failed = 0;
+  };
+
 public:
 
-  D3D11On12App(HINSTANCE hInstance, int nCmdShow) {
+  struct Options {
+    uint32_t framesInFlight   = 1;
+    uint32_t benchFrames      = 1000;
+    uint32_t benchIterations  = 100;
+    uint32_t stressResources  = 2048;
+    uint32_t stressHeaps      = 2;
+    uint32_t stressHeapSize   = 0;    // MiB, 0 to fit stressResources
+    uint32_t stressRounds     = 8;
+  };
+
+  D3D11On12App(HINSTANCE hInstance, int nCmdShow, const Options& options)
+  : m_options(options) {
     m_initialized =
       createWindow(hInstance, nCmdShow) &&
       createDXGIFactory() &&
@@ -44,45 +112,38 @@ public:
   }
 
   ~D3D11On12App() {
+    if (m_d3d12Fence)
+      waitForIdle();
+
     if (m_d3d12Event)
       CloseHandle(m_d3d12Event);
   }
 
   bool renderFrame() {
-    m_d3d12Allocator->Reset();
-    m_d3d12CommandList->Reset(m_d3d12Allocator.ptr(), nullptr);
+    bench::Timer frameTimer;
 
-    // Use D3D11 to render to the shared image
-    std::vector<ID3D11Resource*> resources = { m_d3d11RenderTarget.ptr(), m_d3d11VertexBuffer.ptr(), m_d3d11IndexBuffer.ptr() };
+    // Only block if the GPU is still using the allocator
+    // of the frame we submitted framesInFlight frames ago
+    FrameSlot& slot = m_frames[m_frameId % m_framesInFlight];
 
-    m_d3d11on12Device->AcquireWrappedResources(resources.data(), resources.size());
-    m_d3d11Context->ClearState();
-
-    FLOAT color[4] = { 0.5f, 0.5f, 0.5f, 1.0f };
-    m_d3d11Context->OMSetRenderTargets(1, &m_d3d11RenderTargetView, nullptr);
-    m_d3d11Context->ClearRenderTargetView(m_d3d11RenderTargetView.ptr(), color);
+    retireFrames();
 
-    m_d3d11Context->VSSetShader(m_d3d11VertexShader.ptr(), nullptr, 0);
-    m_d3d11Context->PSSetShader(m_d3d11PixelShader.ptr(), nullptr, 0);
+    if (slot.pending) {
+      bench::Timer waitTimer;
+      waitForFrame(slot);
 
-    m_d3d11Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-    m_d3d11Context->IASetInputLayout(m_d3d11InputLayout.ptr());
+      if (m_collectStats)
+        m_waitStats.add(waitTimer.elapsedUs());
+    }
 
-    D3D11_VIEWPORT viewport;
-    viewport.TopLeftX = 0.0f;
-    viewport.TopLeftY = 0.0f;
-    viewport.Width = 1280.0f;
-    viewport.Height = 720.0f;
-    viewport.MinDepth = 0.0f;
-    viewport.MaxDepth = 1.0f;
-    m_d3d11Context->RSSetViewports(1, &viewport);
+    slot.allocator->Reset();
+    m_d3d12CommandList->Reset(slot.allocator.ptr(), nullptr);
 
-    uint32_t vsStride = sizeof(Vertex);
-    uint32_t vsOffset = 0;
+    // Use D3D11 to render to the shared image
+    std::array<ID3D11Resource*, 3> resources = {{ m_d3d11RenderTarget.ptr(), m_d3d11VertexBuffer.ptr(), m_d3d11IndexBuffer.ptr() }};
 
-    m_d3d11Context->IASetVertexBuffers(0, 1, &m_d3d11VertexBuffer, &vsStride, &vsOffset);
-    m_d3d11Context->IASetIndexBuffer(m_d3d11IndexBuffer.ptr(), DXGI_FORMAT_R32_UINT, 0);
-    m_d3d11Context->DrawIndexed(3, 0, 0);
+    m_d3d11on12Device->AcquireWrappedResources(resources.data(), resources.size());
+    recordDraws(1);
 
     m_d3d11on12Device->ReleaseWrappedResources(resources.data(), resources.size());
     m_d3d11Context->Flush();
@@ -137,15 +198,45 @@ public:
     ID3D12CommandList* cmdList = m_d3d12CommandList.ptr();
     m_d3d12Queue->ExecuteCommandLists(1, &cmdList);
 
-    m_dxgiSwapChain->Present(1, 0);
+    m_dxgiSwapChain->Present(m_syncInterval, 0);
 
-    // We're lazy with synchronization, just stall at the end of each frame
     m_d3d12Queue->Signal(m_d3d12Fence.ptr(), ++m_frameId);
-    m_d3d12Fence->SetEventOnCompletion(m_frameId, m_d3d12Event);
 
-    while (WaitForSingleObject(m_d3d12Event, INFINITE))
-      continue;
+    slot.fenceValue = m_frameId;
+    slot.pending = true;
+    slot.submitTimer.reset();
+
+    if (m_collectStats)
+      m_frameStats.add(frameTimer.elapsedUs());
+
+    return true;
+  }
+
+  /**
+   * \brief Changes the number of frames in flight
+   *
+   * Drains the queue first so that no allocator is
+   * in use while the ring is resized.
+   * \param [in] count Number of frames in flight
+   * \returns \c true on success
+   */
+  bool setFramesInFlight(uint32_t count) {
+    waitForIdle();
+
+    count = std::max(count, 1u);
+
+    while (m_frames.size() < count) {
+      FrameSlot slot;
+
+      if (FAILED(m_d3d12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&slot.allocator)))) {
+        std::cerr << "Failed to create D3D12 command allocator" << std::endl;
+        return false;
+      }
+
+      m_frames.push_back(slot);
+    }
 
+    m_framesInFlight = count;
     return true;
   }
 
@@ -171,9 +262,413 @@ public:
     return msg.wParam;
   }
 
+  /**
+   * \brief Measures frame pacing for 1 to 3 frames in flight
+   *
+   * Presents without vsync so that throughput is bound by
+   * the CPU and GPU work rather than the display. Latency
+   * is the time between submitting a frame and the CPU
+   * observing its fence value, so it is an upper bound
+   * with the granularity of one frame.
+   * \returns Process exit code
+   */
+  int runBench() {
+    if (!m_initialized)
+      return 1;
+
+    m_syncInterval = 0;
+
+    for (uint32_t framesInFlight = 1; framesInFlight <= 3; framesInFlight++) {
+      if (!setFramesInFlight(framesInFlight))
+        return 1;
+
+      // Warm up the swap chain and the D3D11on12 internals
+      // before collecting any samples
+      for (uint32_t i = 0; i < 16; i++) {
+        if (!renderFrame())
+          return 1;
+      }
+
+      waitForIdle();
+
+      m_frameStats.clear();
+      m_waitStats.clear();
+      m_latencyStats.clear();
+
+      m_collectStats = true;
+
+      bench::Timer timer;
+
+      for (uint32_t i = 0; i < m_options.benchFrames; i++) {
+        MSG msg;
+
+        while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
+          TranslateMessage(&msg);
+          DispatchMessageW(&msg);
+
+          if (msg.message == WM_QUIT)
+            return 1;
+        }
+
+        if (!renderFrame())
+          return 1;
+      }
+
+      waitForIdle();
+
+      double totalUs = timer.elapsedUs();
+      m_collectStats = false;
+
+      std::cout << "Bench: " << framesInFlight << " frame(s) in flight: "
+                << std::fixed << std::setprecision(1)
+                << (1000000.0 * double(m_options.benchFrames) / totalUs) << " frames/s" << std::endl
+                << "  frame:   " << m_frameStats << std::endl
+                << "  wait:    " << m_waitStats << std::endl
+                << "  latency: " << m_latencyStats << std::endl;
+    }
+
+    return 0;
+  }
+
+  /**
+   * \brief Measures AcquireWrappedResources overhead
+   *
+   * Acquires a varying number of wrapped buffers on top of
+   * the resources the triangle needs, records a varying
+   * number of draws, then releases everything and flushes.
+   *
+   * The queue is held back with a fence until the CPU side
+   * is done, so that the GPU executes the whole section in
+   * one go. The idle gap is the GPU time between D3D12
+   * timestamps around the section minus the D3D11 timestamps
+   * around the draws, i.e. the cost of the synchronization
+   * that D3D11on12 inserts for acquire, release and flush.
+   * \returns Process exit code
+   */
+  int runWrapBench() {
+    if (!m_initialized || !createWrapBenchResources())
+      return 1;
+
+    waitForIdle();
+
+    D3D12_QUERY_HEAP_DESC queryHeapDesc = { };
+    queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+    queryHeapDesc.Count = 2;
+
+    D3D12_HEAP_PROPERTIES readbackHeapProperties = { };
+    readbackHeapProperties.Type = D3D12_HEAP_TYPE_READBACK;
+
+    D3D12_RESOURCE_DESC readbackDesc = { };
+    readbackDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    readbackDesc.Width = 2 * sizeof(UINT64);
+    readbackDesc.Height = 1;
+    readbackDesc.DepthOrArraySize = 1;
+    readbackDesc.SampleDesc = { 1, 0 };
+    readbackDesc.MipLevels = 1;
+    readbackDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+    Com<ID3D12QueryHeap> queryHeap;
+    Com<ID3D12Resource> readbackBuffer;
+    Com<ID3D12Fence> gateFence;
+
+    if (FAILED(m_d3d12Device->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&queryHeap)))
+     || FAILED(m_d3d12Device->CreateCommittedResource(&readbackHeapProperties, D3D12_HEAP_FLAG_NONE, &readbackDesc,
+          D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&readbackBuffer)))
+     || FAILED(m_d3d12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&gateFence)))) {
+      std::cerr << "Failed to create D3D12 timestamp resources" << std::endl;
+      return 1;
+    }
+
+    // The timestamp lists never change, so record them once
+    // and resubmit them after the previous submission is done
+    Com<ID3D12CommandAllocator> allocator;
+    Com<ID3D12GraphicsCommandList> beginList;
+    Com<ID3D12GraphicsCommandList> endList;
+
+    if (FAILED(m_d3d12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&allocator)))
+     || FAILED(m_d3d12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, allocator.ptr(), nullptr, IID_PPV_ARGS(&beginList)))
+     || FAILED(m_d3d12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, allocator.ptr(), nullptr, IID_PPV_ARGS(&endList)))) {
+      std::cerr << "Failed to create D3D12 timestamp command lists" << std::endl;
+      return 1;
+    }
+
+    beginList->EndQuery(queryHeap.ptr(), D3D12_QUERY_TYPE_TIMESTAMP, 0);
+    beginList->Close();
+
+    endList->EndQuery(queryHeap.ptr(), D3D12_QUERY_TYPE_TIMESTAMP, 1);
+    endList->ResolveQueryData(queryHeap.ptr(), D3D12_QUERY_TYPE_TIMESTAMP, 0, 2, readbackBuffer.ptr(), 0);
+    endList->Close();
+
+    UINT64 d3d12Frequency = 0;
+
+    if (FAILED(m_d3d12Queue->GetTimestampFrequency(&d3d12Frequency))) {
+      std::cerr << "Failed to query D3D12 timestamp frequency" << std::endl;
+      return 1;
+    }
+
+    D3D11_QUERY_DESC disjointDesc = { D3D11_QUERY_TIMESTAMP_DISJOINT, 0 };
+    D3D11_QUERY_DESC timestampDesc = { D3D11_QUERY_TIMESTAMP, 0 };
+
+    Com<ID3D11Query> disjointQuery;
+    Com<ID3D11Query> drawBeginQuery;
+    Com<ID3D11Query> drawEndQuery;
+
+    if (FAILED(m_d3d11Device->CreateQuery(&disjointDesc, &disjointQuery))
+     || FAILED(m_d3d11Device->CreateQuery(&timestampDesc, &drawBeginQuery))
+     || FAILED(m_d3d11Device->CreateQuery(&timestampDesc, &drawEndQuery))) {
+      std::cerr << "Failed to create D3D11 timestamp queries" << std::endl;
+      return 1;
+    }
+
+    const std::array<uint32_t, 4> resourceCounts = {{ 1, 10, 100, MaxWrapBenchResources }};
+    const std::array<uint32_t, 4> drawCounts = {{ 0, 1, 16, 256 }};
+
+    std::vector<ID3D11Resource*> resources;
+    UINT64 gateValue = 0;
+
+    for (uint32_t resourceCount : resourceCounts) {
+      resources.clear();
+
+      for (uint32_t i = 0; i < resourceCount; i++)
+        resources.push_back(m_wrapBenchResources[i].ptr());
+
+      resources.push_back(m_d3d11RenderTarget.ptr());
+      resources.push_back(m_d3d11VertexBuffer.ptr());
+      resources.push_back(m_d3d11IndexBuffer.ptr());
+
+      for (uint32_t drawCount : drawCounts) {
+        bench::Stats acquireStats;
+        bench::Stats releaseStats;
+        bench::Stats flushStats;
+        bench::Stats drawGpuStats;
+        bench::Stats gapStats;
+
+        // The first iteration only warms up internal state
+        for (uint32_t i = 0; i <= m_options.benchIterations; i++) {
+          ID3D12CommandList* cmdList = beginList.ptr();
+
+          m_d3d12Queue->Wait(gateFence.ptr(), ++gateValue);
+          m_d3d12Queue->ExecuteCommandLists(1, &cmdList);
+
+          bench::Timer timer;
+          m_d3d11on12Device->AcquireWrappedResources(resources.data(), resources.size());
+          double acquireUs = timer.elapsedUs();
+
+          m_d3d11Context->Begin(disjointQuery.ptr());
+          m_d3d11Context->End(drawBeginQuery.ptr());
+          recordDraws(drawCount);
+          m_d3d11Context->End(drawEndQuery.ptr());
+          m_d3d11Context->End(disjointQuery.ptr());
+
+          timer.reset();
+          m_d3d11on12Device->ReleaseWrappedResources(resources.data(), resources.size());
+          double releaseUs = timer.elapsedUs();
+
+          timer.reset();
+          m_d3d11Context->Flush();
+          double flushUs = timer.elapsedUs();
+
+          cmdList = endList.ptr();
+          m_d3d12Queue->ExecuteCommandLists(1, &cmdList);
+          m_d3d12Queue->Signal(m_d3d12Fence.ptr(), ++m_frameId);
+
+          gateFence->Signal(gateValue);
+
+          m_d3d12Fence->SetEventOnCompletion(m_frameId, m_d3d12Event);
+
+          while (WaitForSingleObject(m_d3d12Event, INFINITE))
+            continue;
+
+          D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint = { };
+          UINT64 drawBegin = 0;
+          UINT64 drawEnd = 0;
+
+          while (m_d3d11Context->GetData(disjointQuery.ptr(), &disjoint, sizeof(disjoint), 0) != S_OK)
+            continue;
+          while (m_d3d11Context->GetData(drawBeginQuery.ptr(), &drawBegin, sizeof(drawBegin), 0) != S_OK)
+            continue;
+          while (m_d3d11Context->GetData(drawEndQuery.ptr(), &drawEnd, sizeof(drawEnd), 0) != S_OK)
+            continue;
+
+          D3D12_RANGE readRange = { 0, 2 * sizeof(UINT64) };
+          D3D12_RANGE writeRange = { 0, 0 };
+          UINT64* timestamps = nullptr;
+
+          if (FAILED(readbackBuffer->Map(0, &readRange, reinterpret_cast<void**>(&timestamps)))) {
+            std::cerr << "Failed to map D3D12 timestamp buffer" << std::endl;
+            return 1;
+          }
+
+          double sectionUs = 1000000.0 * double(timestamps[1] - timestamps[0]) / double(d3d12Frequency);
+          readbackBuffer->Unmap(0, &writeRange);
+
+          if (!i || disjoint.Disjoint)
+            continue;
+
+          double drawUs = 1000000.0 * double(drawEnd - drawBegin) / double(disjoint.Frequency);
+
+          acquireStats.add(acquireUs);
+          releaseStats.add(releaseUs);
+          flushStats.add(flushUs);
+          drawGpuStats.add(drawUs);
+          gapStats.add(std::max(sectionUs - drawUs, 0.0));
+        }
+
+        double perResource = 1000.0 / double(resources.size());
+
+        std::cout << "Bench: " << resourceCount << " resource(s), " << drawCount << " draw(s):" << std::endl
+                  << "  acquire: " << acquireStats << " ("
+                  << std::fixed << std::setprecision(1) << (acquireStats.percentile(0.5) * perResource) << " ns/resource)" << std::endl
+                  << "  release: " << releaseStats << " ("
+                  << std::fixed << std::setprecision(1) << (releaseStats.percentile(0.5) * perResource) << " ns/resource)" << std::endl
+                  << "  flush:   " << flushStats << std::endl
+                  << "  draws:   " << drawGpuStats << std::endl
+                  << "  gap:     " << gapStats << std::endl;
+      }
+    }
+
+    return 0;
+  }
+
+  /**
+   * \brief Stresses placed resources in large heaps
+   *
+   * Fills a few large heaps per resource kind with placed
+   * buffers and textures of random sizes, suballocated with
+   * a buddy allocator, and wraps each of them for D3D11.
+   * Every round then destroys a quarter of the resources
+   * at random and refills the heaps, which fragments them
+   * the way streaming engines do.
+   * \returns Process exit code
+   */
+  int runHeapStress() {
+    if (!m_initialized)
+      return 1;
+
+    std::array<HeapPool, 2> pools;
+    pools[0].name = "buffers";
+    pools[0].flags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+    pools[1].name = "textures";
+    pools[1].flags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+
+    uint64_t heapSize = uint64_t(m_options.stressHeapSize) << 20;
+
+    if (!heapSize)
+      heapSize = getStressHeapSize();
+
+    for (auto& pool : pools) {
+      D3D12_HEAP_DESC heapDesc = { };
+      heapDesc.SizeInBytes = heapSize;
+      heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+      heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+      heapDesc.Flags = pool.flags;
+
+      for (uint32_t i = 0; i < m_options.stressHeaps; i++) {
+        Com<ID3D12Heap> heap;
+
+        if (FAILED(m_d3d12Device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap)))) {
+          std::cerr << "Failed to create D3D12 heap" << std::endl;
+          return 1;
+        }
+
+        pool.heaps.push_back(heap);
+        pool.allocators.emplace_back(heapSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+      }
+    }
+
+    std::mt19937 rng(0x4ea95);
+    std::vector<PlacedResource> resources;
+    HeapStressStats stats;
+
+    std::cout << "Heap stress: " << m_options.stressResources << " resources, "
+              << m_options.stressHeaps << " x " << (heapSize >> 20) << " MiB heaps per kind" << std::endl;
+
+    for (uint32_t round = 0; round <= m_options.stressRounds; round++) {
+      if (round) {
+        size_t destroyCount = resources.size() / 4;
+
+        for (size_t i = 0; i < destroyCount; i++) {
+          size_t index = rng() % resources.size();
+          destroyPlacedResource(pools, resources[index], stats);
+
+          resources[index] = std::move(resources.back());
+          resources.pop_back();
+        }
+      }
+
+      // A failed allocation only means that one pool is
+      // full, so keep filling the other one until it is
+      // full as well or the target is reached
+      std::array<bool, 2> poolFull = { };
+
+      while (resources.size() < m_options.stressResources && !(poolFull[0] && poolFull[1])) {
+        D3D12_RESOURCE_DESC desc = getRandomResourceDesc(rng);
+        uint32_t pool = getHeapPoolIndex(desc);
+
+        if (poolFull[pool])
+          continue;
+
+        PlacedResource resource = { };
+
+        if (!createPlacedResource(pools, desc, resource, stats)) {
+          poolFull[pool] = true;
+          continue;
+        }
+
+        resources.push_back(std::move(resource));
+      }
+
+      if (!round || round == m_options.stressRounds || resources.size() < m_options.stressResources) {
+        if (round)
+          std::cout << "After " << round << " rounds: ";
+        else
+          std::cout << "Initial fill: ";
+
+        std::cout << resources.size() << " of " << m_options.stressResources << " resources live" << std::endl;
+
+        for (const auto& pool : pools)
+          printHeapPool(pool);
+      }
+    }
+
+    // Using all wrapped resources at once shows whether
+    // the number of live wrappers affects acquire costs
+    std::vector<ID3D11Resource*> d3d11Resources;
+
+    for (const auto& resource : resources)
+      d3d11Resources.push_back(resource.d3d11Resource.ptr());
+
+    bench::Timer timer;
+    m_d3d11on12Device->AcquireWrappedResources(d3d11Resources.data(), d3d11Resources.size());
+    double acquireUs = timer.elapsedUs();
+
+    timer.reset();
+    m_d3d11on12Device->ReleaseWrappedResources(d3d11Resources.data(), d3d11Resources.size());
+    double releaseUs = timer.elapsedUs();
+
+    m_d3d11Context->Flush();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "  alloc:   " << (1000.0 * stats.allocUs / double(std::max<uint64_t>(stats.allocCount, 1))) << " ns avg, "
+              << stats.allocCount << " allocations, " << stats.failed << " failed" << std::endl
+              << "  free:    " << (1000.0 * stats.freeUs / double(std::max<uint64_t>(stats.freeCount, 1))) << " ns avg" << std::endl
+              << "  place:   " << stats.place << std::endl
+              << "  wrap:    " << stats.wrap << std::endl
+              << "  destroy: " << stats.destroy << std::endl
+              << "  wrap / place: " << (stats.wrap.percentile(0.5) / std::max(stats.place.percentile(0.5), 0.1)) << "x (p50)" << std::endl
+              << "  acquire: " << acquireUs << " us, release: " << releaseUs << " us for "
+              << d3d11Resources.size() << " resources" << std::endl;
+
+    for (auto& resource : resources)
+      destroyPlacedResource(pools, resource, stats);
+
+    return 0;
+  }
 
 private:
 
+  Options                         m_options;
+
   HWND                            m_window = nullptr;
 
   Com<IDXGIFactory6>              m_dxgiFactory;
@@ -193,7 +688,6 @@ private:
 
   Com<ID3D12Device>               m_d3d12Device;
   Com<ID3D12CommandQueue>         m_d3d12Queue;
-  Com<ID3D12CommandAllocator>     m_d3d12Allocator;
   Com<ID3D12GraphicsCommandList>  m_d3d12CommandList;
   Com<ID3D12Resource>             m_d3d12RenderTarget;
   Com<ID3D12Heap>                 m_d3d12Heap;
@@ -205,8 +699,102 @@ private:
 
   UINT64                          m_frameId = 0;
 
+  std::vector<FrameSlot>          m_frames;
+  uint32_t                        m_framesInFlight = 1;
+  UINT                            m_syncInterval = 1;
+
+  bench::Stats                    m_frameStats;
+  bench::Stats                    m_waitStats;
+  bench::Stats                    m_latencyStats;
+
+  // Only set while runBench measures, so that the
+  // interactive loop does not accumulate samples
+  bool                            m_collectStats = false;
+
+  std::vector<Com<ID3D12Resource>> m_wrapBenchBuffers;
+  std::vector<Com<ID3D11Resource>> m_wrapBenchResources;
+
   bool m_initialized = false;
 
+  /**
+   * \brief Records the triangle draw on the D3D11 side
+   *
+   * The render target, vertex buffer and index buffer
+   * must have been acquired by the caller.
+   * \param [in] drawCount Number of times to draw the triangle
+   */
+  void recordDraws(uint32_t drawCount) {
+    m_d3d11Context->ClearState();
+
+    FLOAT color[4] = { 0.5f, 0.5f, 0.5f, 1.0f };
+    m_d3d11Context->OMSetRenderTargets(1, &m_d3d11RenderTargetView, nullptr);
+    m_d3d11Context->ClearRenderTargetView(m_d3d11RenderTargetView.ptr(), color);
+
+    m_d3d11Context->VSSetShader(m_d3d11VertexShader.ptr(), nullptr, 0);
+    m_d3d11Context->PSSetShader(m_d3d11PixelShader.ptr(), nullptr, 0);
+
+    m_d3d11Context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    m_d3d11Context->IASetInputLayout(m_d3d11InputLayout.ptr());
+
+    D3D11_VIEWPORT viewport;
+    viewport.TopLeftX = 0.0f;
+    viewport.TopLeftY = 0.0f;
+    viewport.Width = 1280.0f;
+    viewport.Height = 720.0f;
+    viewport.MinDepth = 0.0f;
+    viewport.MaxDepth = 1.0f;
+    m_d3d11Context->RSSetViewports(1, &viewport);
+
+    uint32_t vsStride = sizeof(Vertex);
+    uint32_t vsOffset = 0;
+
+    m_d3d11Context->IASetVertexBuffers(0, 1, &m_d3d11VertexBuffer, &vsStride, &vsOffset);
+    m_d3d11Context->IASetIndexBuffer(m_d3d11IndexBuffer.ptr(), DXGI_FORMAT_R32_UINT, 0);
+
+    for (uint32_t i = 0; i < drawCount; i++)
+      m_d3d11Context->DrawIndexed(3, 0, 0);
+  }
+
+  /**
+   * \brief Records latency of completed frames
+   *
+   * Marks every slot whose fence value the GPU
+   * has reached as free without blocking.
+   */
+  void retireFrames() {
+    UINT64 completed = m_d3d12Fence->GetCompletedValue();
+
+    for (auto& slot : m_frames) {
+      if (slot.pending && slot.fenceValue <= completed) {
+        if (m_collectStats)
+          m_latencyStats.add(slot.submitTimer.elapsedUs());
+
+        slot.pending = false;
+      }
+    }
+  }
+
+  void waitForFrame(FrameSlot& slot) {
+    if (m_d3d12Fence->GetCompletedValue() < slot.fenceValue) {
+      m_d3d12Fence->SetEventOnCompletion(slot.fenceValue, m_d3d12Event);
+
+      while (WaitForSingleObject(m_d3d12Event, INFINITE))
+        continue;
+    }
+
+    if (m_collectStats)
+      m_latencyStats.add(slot.submitTimer.elapsedUs());
+
+    slot.pending = false;
+  }
+
+  void waitForIdle() {
+    for (auto& slot : m_frames) {
+      if (slot.pending)
+        waitForFrame(slot);
+    }
+  }
+
   bool createWindow(HINSTANCE hInstance, int nCmdShow) {
     WNDCLASSEXW wc = { };
     wc.cbSize = sizeof(wc);
@@ -267,21 +855,21 @@ private:
   }
 
   bool createD3D12CommandList() {
-    HRESULT hr = m_d3d12Device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_d3d12Allocator));
-
-    if (FAILED(hr)) {
-      std::cerr << "Failed to create D3D12 command allocator" << std::endl;
+    if (!setFramesInFlight(m_options.framesInFlight))
       return false;
-    }
 
-    hr = m_d3d12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
-      m_d3d12Allocator.ptr(), nullptr, IID_PPV_ARGS(&m_d3d12CommandList));
+    // A command list can be reset as soon as it has been
+    // submitted, so one list is enough for all frames
+    HRESULT hr = m_d3d12Device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+      m_frames[0].allocator.ptr(), nullptr, IID_PPV_ARGS(&m_d3d12CommandList));
 
     if (FAILED(hr)) {
       std::cerr << "Failed to create D3D12 command list" << std::endl;
       return false;
     }
 
+    m_d3d12CommandList->Close();
+
     hr = m_d3d12Device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_d3d12Fence));
 
     if (FAILED(hr)) {
@@ -499,6 +1087,253 @@ private:
     return true;
   }
 
+  bool createWrapBenchResources() {
+    D3D12_HEAP_PROPERTIES deviceHeapProperties = { };
+    deviceHeapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+    D3D12_RESOURCE_DESC bufferDesc = { };
+    bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    bufferDesc.Width = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    bufferDesc.Height = 1;
+    bufferDesc.DepthOrArraySize = 1;
+    bufferDesc.SampleDesc = { 1, 0 };
+    bufferDesc.MipLevels = 1;
+    bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+    D3D11_RESOURCE_FLAGS d3d11Flags = { D3D11_BIND_SHADER_RESOURCE };
+
+    for (uint32_t i = 0; i < MaxWrapBenchResources; i++) {
+      Com<ID3D12Resource> buffer;
+      Com<ID3D11Resource> resource;
+
+      HRESULT hr = m_d3d12Device->CreateCommittedResource(&deviceHeapProperties, D3D12_HEAP_FLAG_NONE, &bufferDesc,
+        D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&buffer));
+
+      if (FAILED(hr)) {
+        std::cerr << "Failed to create D3D12 buffer" << std::endl;
+        return false;
+      }
+
+      hr = m_d3d11on12Device->CreateWrappedResource(
+        buffer.ptr(), &d3d11Flags,
+        D3D12_RESOURCE_STATE_COMMON,
+        D3D12_RESOURCE_STATE_COMMON,
+        IID_PPV_ARGS(&resource));
+
+      if (FAILED(hr)) {
+        std::cerr << "Failed to create D3D11 wrapped buffer" << std::endl;
+        return false;
+      }
+
+      m_wrapBenchBuffers.push_back(buffer);
+      m_wrapBenchResources.push_back(resource);
+    }
+
+    return true;
+  }
+
+  D3D12_RESOURCE_DESC getRandomResourceDesc(std::mt19937& rng) {
+    D3D12_RESOURCE_DESC desc = { };
+    desc.SampleDesc = { 1, 0 };
+
+    if (rng() & 1) {
+      // Anything from 16 kB to 1 MB, mostly small
+      desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+      desc.Width = (1 + rng() % 16) * 16384ull << (rng() % 3);
+      desc.Height = 1;
+      desc.DepthOrArraySize = 1;
+      desc.MipLevels = 1;
+      desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    } else {
+      desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+      desc.Width = 64u << (rng() % 4);
+      desc.Height = 64u << (rng() % 4);
+      desc.DepthOrArraySize = 1;
+      desc.MipLevels = 1 + rng() % 3;
+      desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+      desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    }
+
+    return desc;
+  }
+
+  static uint32_t getHeapPoolIndex(const D3D12_RESOURCE_DESC& desc) {
+    return desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER ? 0 : 1;
+  }
+
+  /**
+   * \brief Computes heap size for the heap stress test
+   *
+   * Sums up the buddy block sizes of a sample of as many
+   * resources as the test keeps alive, with the same size
+   * distribution, and spreads the larger of the two pools
+   * over its heaps. Leaves 25% headroom, since the heaps
+   * fragment over the rounds. The defaults need 1 GiB of
+   * heaps in total, but the size is clamped so that all
+   * heaps fit into the local video memory budget.
+   * \returns Heap size, in bytes
+   */
+  uint64_t getStressHeapSize() {
+    std::mt19937 rng(0x4ea95);
+    std::array<uint64_t, 2> poolSizes = { };
+
+    for (uint32_t i = 0; i < m_options.stressResources; i++) {
+      D3D12_RESOURCE_DESC desc = getRandomResourceDesc(rng);
+      D3D12_RESOURCE_ALLOCATION_INFO info = m_d3d12Device->GetResourceAllocationInfo(0, 1, &desc);
+
+      uint64_t blockSize = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+
+      while (blockSize < std::max(info.SizeInBytes, info.Alignment))
+        blockSize *= 2;
+
+      poolSizes[getHeapPoolIndex(desc)] += blockSize;
+    }
+
+    uint32_t heapCount = 2 * std::max(m_options.stressHeaps, 1u);
+
+    uint64_t required = std::max(poolSizes[0], poolSizes[1]) * 5 / 4 / (heapCount / 2);
+    uint64_t heapSize = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+
+    while (heapSize < required)
+      heapSize *= 2;
+
+    // Oversubscribing video memory would measure paging
+    // rather than placement, so leave a quarter of the
+    // remaining budget to the swap chain and the driver
+    DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = { };
+
+    if (SUCCEEDED(m_dxgiAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memoryInfo))) {
+      uint64_t available = memoryInfo.Budget > memoryInfo.CurrentUsage
+        ? memoryInfo.Budget - memoryInfo.CurrentUsage : 0;
+      uint64_t maxHeapSize = available * 3 / 4 / heapCount;
+      uint64_t fullSize = heapSize;
+
+      while (heapSize > maxHeapSize && heapSize > D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT)
+        heapSize /= 2;
+
+      if (heapSize != fullSize) {
+        std::cout << "Heap size clamped from " << (fullSize >> 20) << " to " << (heapSize >> 20)
+                  << " MiB by the video memory budget (" << (available >> 20) << " MiB available),"
+                  << " fewer than " << m_options.stressResources << " resources may fit" << std::endl;
+      }
+    }
+
+    return heapSize;
+  }
+
+  bool createPlacedResource(
+          std::array<HeapPool, 2>&  pools,
+    const D3D12_RESOURCE_DESC&      desc,
+          PlacedResource&           resource,
+          HeapStressStats&          stats) {
+    D3D12_RESOURCE_ALLOCATION_INFO info = m_d3d12Device->GetResourceAllocationInfo(0, 1, &desc);
+
+    resource.pool = getHeapPoolIndex(desc);
+    resource.size = info.SizeInBytes;
+
+    HeapPool& pool = pools[resource.pool];
+
+    bench::Timer timer;
+
+    for (resource.heap = 0; resource.heap < pool.heaps.size(); resource.heap++) {
+      resource.allocation = pool.allocators[resource.heap].alloc(info.SizeInBytes, info.Alignment);
+
+      if (resource.allocation.offset != buddy::InvalidOffset)
+        break;
+    }
+
+    stats.allocUs += timer.elapsedUs();
+    stats.allocCount += 1;
+
+    if (resource.heap == pool.heaps.size()) {
+      stats.failed += 1;
+      return false;
+    }
+
+    timer.reset();
+
+    HRESULT hr = m_d3d12Device->CreatePlacedResource(pool.heaps[resource.heap].ptr(), resource.allocation.offset,
+      &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&resource.d3d12Resource));
+
+    stats.place.add(timer.elapsedUs());
+
+    if (FAILED(hr)) {
+      std::cerr << "Failed to create D3D12 placed resource" << std::endl;
+      pool.allocators[resource.heap].free(resource.allocation, resource.size);
+      stats.failed += 1;
+      return false;
+    }
+
+    D3D11_RESOURCE_FLAGS d3d11Flags = { D3D11_BIND_SHADER_RESOURCE };
+
+    timer.reset();
+
+    hr = m_d3d11on12Device->CreateWrappedResource(
+      resource.d3d12Resource.ptr(), &d3d11Flags,
+      D3D12_RESOURCE_STATE_COMMON,
+      D3D12_RESOURCE_STATE_COMMON,
+      IID_PPV_ARGS(&resource.d3d11Resource));
+
+    stats.wrap.add(timer.elapsedUs());
+
+    if (FAILED(hr)) {
+      std::cerr << "Failed to create D3D11 wrapped resource" << std::endl;
+      resource.d3d12Resource = nullptr;
+      pool.allocators[resource.heap].free(resource.allocation, resource.size);
+      stats.failed += 1;
+      return false;
+    }
+
+    return true;
+  }
+
+  void destroyPlacedResource(
+          std::array<HeapPool, 2>&  pools,
+          PlacedResource&           resource,
+          HeapStressStats&          stats) {
+    bench::Timer timer;
+    resource.d3d11Resource = nullptr;
+    resource.d3d12Resource = nullptr;
+    stats.destroy.add(timer.elapsedUs());
+
+    timer.reset();
+    pools[resource.pool].allocators[resource.heap].free(resource.allocation, resource.size);
+    stats.freeUs += timer.elapsedUs();
+    stats.freeCount += 1;
+  }
+
+  static void printHeapPool(const HeapPool& pool) {
+    uint64_t capacity = 0;
+    uint64_t allocated = 0;
+    uint64_t requested = 0;
+    uint64_t freeSize = 0;
+    uint64_t largestFree = 0;
+    uint32_t allocations = 0;
+    uint32_t freeBlocks = 0;
+    double externalSum = 0.0;
+
+    for (const auto& allocator : pool.allocators) {
+      buddy::Stats stats = allocator.stats();
+
+      capacity += stats.capacity;
+      allocated += stats.allocated;
+      requested += stats.requested;
+      freeSize += stats.capacity - stats.allocated;
+      largestFree = std::max(largestFree, stats.largestFree);
+      allocations += stats.allocations;
+      freeBlocks += stats.freeBlocks;
+      externalSum += stats.externalFragmentation();
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "  " << pool.name << ": " << allocations << " live, "
+              << (double(allocated) / 1048576.0) << " of " << (double(capacity) / 1048576.0) << " MiB used, "
+              << (double(freeSize) / 1048576.0) << " MiB free in " << freeBlocks << " blocks, largest "
+              << (double(largestFree) / 1048576.0) << " MiB" << std::endl
+              << "    internal fragmentation: " << (allocated ? 100.0 * (1.0 - double(requested) / double(allocated)) : 0.0) << "%"
+              << ", external fragmentation: " << (100.0 * externalSum / double(std::max<size_t>(pool.allocators.size(), 1))) << "% (avg per heap)" << std::endl;
+  }
+
   bool createDXGISwapChain() {
     Com<IDXGISwapChain1> swapChain;
 
@@ -542,8 +1377,57 @@ private:
 };
 
 int main(int argc, char** argv) {
+  D3D11On12App::Options options;
+  bool bench = false;
+  bool benchWrap = false;
+  bool stressHeaps = false;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "--bench") {
+      bench = true;
+    } else if (arg == "--bench-wrap") {
+      benchWrap = true;
+    } else if (arg == "--stress-heaps") {
+      stressHeaps = true;
+    } else if (i + 1 < argc && arg == "--resources") {
+      options.stressResources = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--heaps") {
+      options.stressHeaps = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--heap-size") {
+      options.stressHeapSize = std::stoul(argv[++i]);
+
+      // The buddy allocator needs 64 kB times a power of two
+      if (options.stressHeapSize & (options.stressHeapSize - 1)) {
+        std::cerr << "Heap size must be a power of two, got " << options.stressHeapSize << " MiB" << std::endl;
+        return 1;
+      }
+    } else if (i + 1 < argc && arg == "--rounds") {
+      options.stressRounds = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--iterations") {
+      options.benchIterations = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--frames") {
+      options.benchFrames = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--frames-in-flight") {
+      options.framesInFlight = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: d3d11-on-12 [--frames-in-flight n] [--bench] [--frames n]" << std::endl
+                << "       d3d11-on-12 --bench-wrap [--iterations n]" << std::endl
+                << "       d3d11-on-12 --stress-heaps [--resources n] [--heaps n] [--heap-size MiB] [--rounds n]" << std::endl;
+      return 1;
+    }
+  }
+
   HINSTANCE hInstance = GetModuleHandle(nullptr);
   int nCmdShow = SW_SHOWDEFAULT;
-  D3D11On12App app(hInstance, nCmdShow);
-  return app.run();
+  D3D11On12App app(hInstance, nCmdShow, options);
+
+  if (benchWrap)
+    return app.runWrapBench();
+
+  if (stressHeaps)
+    return app.runHeapStress();
+
+  return bench ? app.runBench() : app.run();
 }
@@ -0,0 +1,527 @@
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <d3d11.h>
+#include <d3dcompiler.h>
+
+#include <windows.h>
+
+#include "../common/bench.h"
+#include "../common/com.h"
+#include "../common/dxbc.h"
+#include "../common/file.h"
+#include "../common/str.h"
+
+/**
+  * \brief Shader creation and first-use benchmark
+  *
+  * Loads a directory of DXBC shaders, creates all of them,
+  * optionally from multiple threads, and then uses each one
+  * in a draw or dispatch. The first use of a shader is where
+  * pipelines get compiled, so it is timed separately from a
+  * second, warm use. Every pass uses a fresh device, so that
+  * passes after the first one measure how well shader and
+  * pipeline caches work.
+  */
+class ShaderBenchApp {
+
+  constexpr static uint32_t StageCount = 6;
+
+  struct ShaderBlob {
+    std::string                 name;
+    std::unique_ptr<MappedFile> file;
+    dxbc::ProgramType           type;
+    std::vector<char>           vertexShaderCode;
+    Com<ID3D11DeviceChild>      shader;
+    Com<ID3D11InputLayout>      inputLayout;
+    Com<ID3D11VertexShader>     vertexShader;
+    double                      createUs = 0.0;
+    bool                        created  = false;
+  };
+
+  struct StageStats {
+    bench::Stats  create;
+    bench::Stats  firstUse;
+    bench::Stats  warmUse;
+    uint32_t      failed = 0;
+  };
+
+public:
+
+  struct Options {
+    std::string directory;
+    uint32_t    threads = 1;
+    uint32_t    passes  = 1;
+  };
+
+  ShaderBenchApp(const Options& options)
+  : m_options(options) {
+    m_initialized = loadShaders();
+  }
+
+  int run() {
+    if (!m_initialized)
+      return 1;
+
+    for (uint32_t i = 0; i < m_options.passes; i++) {
+      if (!runPass(i))
+        return 1;
+    }
+
+    return 0;
+  }
+
+private:
+
+  Options                         m_options;
+  std::vector<ShaderBlob>         m_blobs;
+
+  Com<ID3D11Device>               m_device;
+  Com<ID3D11DeviceContext>        m_context;
+  Com<ID3D11Query>                m_query;
+  Com<ID3D11RenderTargetView>     m_rtv;
+  Com<ID3D11Buffer>               m_vertexBuffer;
+
+  bool                            m_initialized = false;
+
+  static const char* getStageName(dxbc::ProgramType type) {
+    switch (type) {
+      case dxbc::ProgramType::Vertex:   return "Vertex";
+      case dxbc::ProgramType::Hull:     return "Hull";
+      case dxbc::ProgramType::Domain:   return "Domain";
+      case dxbc::ProgramType::Geometry: return "Geometry";
+      case dxbc::ProgramType::Pixel:    return "Pixel";
+      case dxbc::ProgramType::Compute:  return "Compute";
+    }
+
+    return "Unknown";
+  }
+
+  bool loadShaders() {
+    std::error_code ec;
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(m_options.directory, ec)) {
+      if (!entry.is_regular_file(ec) || entry.path().extension() != ".dxbc")
+        continue;
+
+      ShaderBlob blob;
+      blob.name = entry.path().lexically_relative(m_options.directory).generic_string();
+      blob.file = std::make_unique<MappedFile>(entry.path());
+
+      dxbc::Container container(blob.file->data(), blob.file->size(), false);
+      uint32_t major, minor;
+
+      if (!container.valid() || !container.getProgramInfo(blob.type, major, minor)) {
+        std::cout << blob.name << ": Invalid shader" << std::endl;
+        continue;
+      }
+
+      // Pixel shaders need a vertex shader that writes all
+      // of their inputs in order to be used in a draw
+      if (blob.type == dxbc::ProgramType::Pixel)
+        blob.vertexShaderCode = compileVertexShader(container);
+
+      m_blobs.push_back(std::move(blob));
+    }
+
+    if (m_blobs.empty()) {
+      std::cout << "No shaders found in " << m_options.directory << std::endl;
+      return false;
+    }
+
+    std::cout << "Loaded " << m_blobs.size() << " shaders" << std::endl;
+    return true;
+  }
+
+  /**
+   * \brief Compiles vertex shader for a pixel shader
+   *
+   * Generates a vertex shader whose outputs match the
+   * pixel shader's input signature, skipping values that
+   * are generated by the rasterizer.
+   */
+  std::vector<char> compileVertexShader(const dxbc::Container& container) {
+    std::vector<dxbc::SignatureElement> elements;
+
+    if (!container.parseSignature(dxbc::Tag::ISGN, elements)
+     && !container.parseSignature(dxbc::Tag::ISG1, elements))
+      return std::vector<char>();
+
+    std::string code = "struct VS_OUTPUT {\n";
+
+    for (size_t i = 0; i < elements.size(); i++) {
+      const auto& e = elements[i];
+
+      // D3D_NAME_PRIMITIVE_ID and up are system-generated
+      if (e.systemValue >= D3D_NAME_PRIMITIVE_ID)
+        continue;
+
+      static const char* types[] = { "float", "uint", "int", "float" };
+      uint32_t width = std::max<uint32_t>(1, std::bitset<4>(e.mask).count());
+
+      code += format("  ", types[std::min(e.componentType, 3u)],
+        width > 1 ? format(width) : std::string(), " o", i, " : ",
+        e.semanticName, e.semanticIndex, ";\n");
+    }
+
+    code += "};\n"
+      "VS_OUTPUT main() {\n"
+      "  VS_OUTPUT o = (VS_OUTPUT)0;\n"
+      "  return o;\n"
+      "}\n";
+
+    Com<ID3DBlob> binary;
+
+    if (FAILED(D3DCompile(code.data(), code.size(), "Shader", nullptr, nullptr,
+        "main", "vs_5_0", 0, 0, &binary, nullptr)))
+      return std::vector<char>();
+
+    auto data = reinterpret_cast<const char*>(binary->GetBufferPointer());
+    return std::vector<char>(data, data + binary->GetBufferSize());
+  }
+
+  bool createDevice() {
+    m_vertexBuffer = nullptr;
+    m_rtv = nullptr;
+    m_query = nullptr;
+    m_context = nullptr;
+    m_device = nullptr;
+
+    if (FAILED(D3D11CreateDevice(
+          nullptr, D3D_DRIVER_TYPE_HARDWARE,
+          nullptr, 0, nullptr, 0, D3D11_SDK_VERSION,
+          &m_device, nullptr, &m_context))) {
+      std::cout << "Failed to create D3D11 device" << std::endl;
+      return false;
+    }
+
+    D3D11_QUERY_DESC queryDesc = { D3D11_QUERY_EVENT, 0 };
+
+    if (FAILED(m_device->CreateQuery(&queryDesc, &m_query))) {
+      std::cout << "Failed to create event query" << std::endl;
+      return false;
+    }
+
+    D3D11_TEXTURE2D_DESC rtDesc = { };
+    rtDesc.Width            = 64;
+    rtDesc.Height           = 64;
+    rtDesc.MipLevels        = 1;
+    rtDesc.ArraySize        = 1;
+    rtDesc.Format           = DXGI_FORMAT_R8G8B8A8_UNORM;
+    rtDesc.SampleDesc       = { 1, 0 };
+    rtDesc.Usage            = D3D11_USAGE_DEFAULT;
+    rtDesc.BindFlags        = D3D11_BIND_RENDER_TARGET;
+
+    Com<ID3D11Texture2D> rt;
+
+    if (FAILED(m_device->CreateTexture2D(&rtDesc, nullptr, &rt))
+     || FAILED(m_device->CreateRenderTargetView(rt.ptr(), nullptr, &m_rtv))) {
+      std::cout << "Failed to create render target" << std::endl;
+      return false;
+    }
+
+    // Large enough for any input layout, all inputs read zero
+    std::vector<char> zero(4096);
+
+    D3D11_BUFFER_DESC vbDesc = { };
+    vbDesc.ByteWidth        = zero.size();
+    vbDesc.Usage            = D3D11_USAGE_IMMUTABLE;
+    vbDesc.BindFlags        = D3D11_BIND_VERTEX_BUFFER;
+
+    D3D11_SUBRESOURCE_DATA vbData = { zero.data() };
+
+    if (FAILED(m_device->CreateBuffer(&vbDesc, &vbData, &m_vertexBuffer))) {
+      std::cout << "Failed to create vertex buffer" << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  bool createShader(ShaderBlob& blob) {
+    const void* code = blob.file->data();
+    size_t size = blob.file->size();
+
+    bench::Timer timer;
+    HRESULT hr = E_INVALIDARG;
+
+    switch (blob.type) {
+      case dxbc::ProgramType::Vertex: {
+        Com<ID3D11VertexShader> vs;
+        hr = m_device->CreateVertexShader(code, size, nullptr, &vs);
+        blob.shader = vs.ptr();
+      } break;
+
+      case dxbc::ProgramType::Hull: {
+        Com<ID3D11HullShader> hs;
+        hr = m_device->CreateHullShader(code, size, nullptr, &hs);
+        blob.shader = hs.ptr();
+      } break;
+
+      case dxbc::ProgramType::Domain: {
+        Com<ID3D11DomainShader> ds;
+        hr = m_device->CreateDomainShader(code, size, nullptr, &ds);
+        blob.shader = ds.ptr();
+      } break;
+
+      case dxbc::ProgramType::Geometry: {
+        Com<ID3D11GeometryShader> gs;
+        hr = m_device->CreateGeometryShader(code, size, nullptr, &gs);
+        blob.shader = gs.ptr();
+      } break;
+
+      case dxbc::ProgramType::Pixel: {
+        Com<ID3D11PixelShader> ps;
+        hr = m_device->CreatePixelShader(code, size, nullptr, &ps);
+        blob.shader = ps.ptr();
+      } break;
+
+      case dxbc::ProgramType::Compute: {
+        Com<ID3D11ComputeShader> cs;
+        hr = m_device->CreateComputeShader(code, size, nullptr, &cs);
+        blob.shader = cs.ptr();
+      } break;
+    }
+
+    blob.createUs = timer.elapsedUs();
+    blob.created = SUCCEEDED(hr) && blob.shader != nullptr;
+    return blob.created;
+  }
+
+  /**
+   * \brief Creates objects needed to use a shader
+   *
+   * Vertex shaders get an input layout built from their
+   * input signature, pixel shaders the generated vertex
+   * shader. Not timed, since it is not what we measure.
+   */
+  bool prepareUse(ShaderBlob& blob) {
+    if (blob.type == dxbc::ProgramType::Vertex) {
+      dxbc::Container container(blob.file->data(), blob.file->size(), false);
+      std::vector<dxbc::SignatureElement> elements;
+
+      if (!container.parseSignature(dxbc::Tag::ISGN, elements))
+        return false;
+
+      static const DXGI_FORMAT formats[3][4] = {
+        { DXGI_FORMAT_R32_UINT,  DXGI_FORMAT_R32G32_UINT,  DXGI_FORMAT_R32G32B32_UINT,  DXGI_FORMAT_R32G32B32A32_UINT  },
+        { DXGI_FORMAT_R32_SINT,  DXGI_FORMAT_R32G32_SINT,  DXGI_FORMAT_R32G32B32_SINT,  DXGI_FORMAT_R32G32B32A32_SINT  },
+        { DXGI_FORMAT_R32_FLOAT, DXGI_FORMAT_R32G32_FLOAT, DXGI_FORMAT_R32G32B32_FLOAT, DXGI_FORMAT_R32G32B32A32_FLOAT },
+      };
+
+      std::vector<D3D11_INPUT_ELEMENT_DESC> layout;
+
+      for (const auto& e : elements) {
+        // Skip SV_VertexID and friends
+        if (e.systemValue || e.componentType < 1 || e.componentType > 3)
+          continue;
+
+        // Cover all components up to the last one used
+        uint32_t width = 4;
+
+        while (width > 1 && !(e.mask & (1u << (width - 1))))
+          width -= 1;
+
+        D3D11_INPUT_ELEMENT_DESC desc = { };
+        desc.SemanticName       = e.semanticName;
+        desc.SemanticIndex      = e.semanticIndex;
+        desc.Format             = formats[e.componentType - 1][width - 1];
+        desc.AlignedByteOffset  = D3D11_APPEND_ALIGNED_ELEMENT;
+        desc.InputSlotClass     = D3D11_INPUT_PER_VERTEX_DATA;
+        layout.push_back(desc);
+      }
+
+      if (!layout.empty() && FAILED(m_device->CreateInputLayout(layout.data(), layout.size(),
+          blob.file->data(), blob.file->size(), &blob.inputLayout)))
+        return false;
+    }
+
+    if (blob.type == dxbc::ProgramType::Pixel) {
+      if (blob.vertexShaderCode.empty() || FAILED(m_device->CreateVertexShader(
+          blob.vertexShaderCode.data(), blob.vertexShaderCode.size(), nullptr, &blob.vertexShader)))
+        return false;
+    }
+
+    return true;
+  }
+
+  void waitForIdle() {
+    m_context->End(m_query.ptr());
+    m_context->Flush();
+
+    while (m_context->GetData(m_query.ptr(), nullptr, 0, 0) == S_FALSE)
+      continue;
+  }
+
+  /**
+   * \brief Uses shader in a draw or dispatch
+   *
+   * \returns Time until the GPU finished the work, in us
+   */
+  double useShader(const ShaderBlob& blob) {
+    m_context->ClearState();
+
+    D3D11_VIEWPORT viewport = { 0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f };
+    m_context->RSSetViewports(1, &viewport);
+    m_context->OMSetRenderTargets(1, &m_rtv, nullptr);
+    m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+
+    UINT stride = 0;
+    UINT offset = 0;
+    m_context->IASetVertexBuffers(0, 1, &m_vertexBuffer, &stride, &offset);
+
+    Com<ID3D11VertexShader> vs;
+    Com<ID3D11PixelShader> ps;
+    Com<ID3D11ComputeShader> cs;
+
+    blob.shader->QueryInterface(IID_PPV_ARGS(&vs));
+    blob.shader->QueryInterface(IID_PPV_ARGS(&ps));
+    blob.shader->QueryInterface(IID_PPV_ARGS(&cs));
+
+    if (vs != nullptr) {
+      m_context->IASetInputLayout(blob.inputLayout.ptr());
+      m_context->VSSetShader(vs.ptr(), nullptr, 0);
+    } else if (ps != nullptr) {
+      m_context->VSSetShader(blob.vertexShader.ptr(), nullptr, 0);
+      m_context->PSSetShader(ps.ptr(), nullptr, 0);
+    } else {
+      m_context->CSSetShader(cs.ptr(), nullptr, 0);
+    }
+
+    bench::Timer timer;
+
+    if (cs != nullptr)
+      m_context->Dispatch(1, 1, 1);
+    else
+      m_context->Draw(1, 0);
+
+    waitForIdle();
+    return timer.elapsedUs();
+  }
+
+  bool runPass(uint32_t pass) {
+    if (!createDevice())
+      return false;
+
+    for (auto& blob : m_blobs) {
+      blob.shader = nullptr;
+      blob.inputLayout = nullptr;
+      blob.vertexShader = nullptr;
+      blob.created = false;
+    }
+
+    // Create all shaders up front, the same way games
+    // create them from multiple threads during loading
+    uint32_t threadCount = std::max(1u, std::min<uint32_t>(m_options.threads, m_blobs.size()));
+    std::atomic<size_t> nextBlob = { 0 };
+
+    bench::Timer createTimer;
+
+    auto worker = [&] {
+      size_t index;
+
+      while ((index = nextBlob++) < m_blobs.size())
+        createShader(m_blobs[index]);
+    };
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadCount; i++)
+      threads.emplace_back(worker);
+
+    for (auto& thread : threads)
+      thread.join();
+
+    double createTotalUs = createTimer.elapsedUs();
+
+    StageStats stats[StageCount];
+
+    for (auto& blob : m_blobs) {
+      auto& stageStats = stats[uint32_t(blob.type)];
+
+      if (!blob.created) {
+        std::cout << blob.name << ": Failed to create shader" << std::endl;
+        stageStats.failed += 1;
+        continue;
+      }
+
+      stageStats.create.add(blob.createUs);
+
+      // Hull, domain and geometry shaders need a matching
+      // pipeline around them, only their creation is timed
+      if (blob.type == dxbc::ProgramType::Hull
+       || blob.type == dxbc::ProgramType::Domain
+       || blob.type == dxbc::ProgramType::Geometry)
+        continue;
+
+      if (!prepareUse(blob)) {
+        std::cout << blob.name << ": Failed to set up draw" << std::endl;
+        continue;
+      }
+
+      stageStats.firstUse.add(useShader(blob));
+      stageStats.warmUse.add(useShader(blob));
+    }
+
+    std::cout << std::endl << "Pass " << pass << (pass ? " (warm)" : " (cold)") << ": created "
+              << m_blobs.size() << " shaders on " << threadCount << " threads in "
+              << uint32_t(createTotalUs / 1000.0) << " ms" << std::endl;
+
+    for (uint32_t i = 0; i < StageCount; i++) {
+      const auto& s = stats[i];
+
+      if (!s.create.count() && !s.failed)
+        continue;
+
+      std::cout << getStageName(dxbc::ProgramType(i)) << " shaders";
+
+      if (s.failed)
+        std::cout << " (" << s.failed << " failed)";
+
+      std::cout << ":" << std::endl
+                << "  Create:    " << s.create << std::endl;
+
+      if (s.firstUse.count()) {
+        std::cout << "  First use: " << s.firstUse << std::endl
+                  << "  Warm use:  " << s.warmUse << std::endl;
+      }
+    }
+
+    return true;
+  }
+
+};
+
+int main(int argc, char** argv) {
+  ShaderBenchApp::Options options;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (i + 1 < argc && arg == "--threads") {
+      options.threads = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--passes") {
+      options.passes = std::stoul(argv[++i]);
+    } else if (options.directory.empty() && arg[0] != '-') {
+      options.directory = arg;
+    } else {
+      options.directory.clear();
+      break;
+    }
+  }
+
+  if (options.directory.empty()) {
+    std::cerr << "Usage: d3d11-shader-bench shader-dir [--threads n] [--passes n]" << std::endl;
+    return 1;
+  }
+
+  ShaderBenchApp app(options);
+  return app.run();
+}
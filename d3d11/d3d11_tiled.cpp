@@ -1,7 +1,10 @@
+#include <chrono>
 #include <cstring>
 #include <iostream>
-#include <functional>
+#include <algorithm>
 #include <array>
+#include <random>
+#include <string>
 
 #include <d3dcompiler.h>
 #include <d3d11_2.h>
@@ -9,8 +12,25 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include <emmintrin.h>
+
+#include "../common/bench.h"
 #include "../common/com.h"
 #include "../common/str.h"
+#include "../common/tiling.h"
+
+// Gathers the first dword of each 64k tile of the
+// source buffer, bounded by the output buffer size
+const std::string g_tileGatherShaderCode =
+  "Buffer<uint4> t_src : register(t0);\n"
+  "RWBuffer<uint> u_dst : register(u0);\n"
+  "[numthreads(64,1,1)]\n"
+  "void main(uint tile : SV_DispatchThreadID) {\n"
+  "  uint count;\n"
+  "  u_dst.GetDimensions(count);\n"
+  "  if (tile < count)\n"
+  "    u_dst[tile] = t_src[tile * 4096].x;\n"
+  "}\n";
 
 class TiledResourceTestApp {
 
@@ -44,6 +64,30 @@ public:
     m_tier = options1.TiledResourcesTier;
 
     std::cout << "Device supports tiled resources tier " << m_tier << std::endl;
+
+    Com<ID3DBlob> gatherShaderBlob;
+
+    if (FAILED(D3DCompile(g_tileGatherShaderCode.data(), g_tileGatherShaderCode.size(),
+        "Tile gather shader", nullptr, nullptr, "main", "cs_5_0", 0, 0, &gatherShaderBlob, nullptr))) {
+      std::cout << "Failed to compile tile gather shader" << std::endl;
+      return;
+    }
+
+    if (FAILED(m_device->CreateComputeShader(
+        gatherShaderBlob->GetBufferPointer(),
+        gatherShaderBlob->GetBufferSize(),
+        nullptr, &m_gatherShader))) {
+      std::cout << "Failed to create tile gather shader" << std::endl;
+      return;
+    }
+
+    D3D11_QUERY_DESC queryDesc = { D3D11_QUERY_EVENT, 0 };
+
+    if (FAILED(m_device->CreateQuery(&queryDesc, &m_idleQuery))) {
+      std::cout << "Failed to create event query" << std::endl;
+      return;
+    }
+
     m_initialized = true;
   }
 
@@ -57,7 +101,9 @@ public:
     testCreateTiledImage3D();
     testCreateMinMaxSampler();
     testGetResourceTiling();
+    testGetResourceTilingReference();
     testMapBufferTiles();
+    testMapLargeBufferTiles();
     testMapImageTiles();
     return 0;
   }
@@ -295,11 +341,212 @@ public:
     }
   }
 
+  void testGetResourceTilingReference() {
+    struct FormatEntry {
+      DXGI_FORMAT         Format;
+      tiling::ElementInfo Element;
+    };
+
+    static const std::array<FormatEntry, 9> formats = {{
+      { DXGI_FORMAT_R8_UNORM,             {  1, 1, 1 } },
+      { DXGI_FORMAT_R16_FLOAT,            {  2, 1, 1 } },
+      { DXGI_FORMAT_R8G8B8A8_UNORM,       {  4, 1, 1 } },
+      { DXGI_FORMAT_R16G16B16A16_FLOAT,   {  8, 1, 1 } },
+      { DXGI_FORMAT_R32G32B32A32_FLOAT,   { 16, 1, 1 } },
+      { DXGI_FORMAT_BC1_UNORM,            {  8, 4, 4 } },
+      { DXGI_FORMAT_BC4_UNORM,            {  8, 4, 4 } },
+      { DXGI_FORMAT_BC3_UNORM,            { 16, 4, 4 } },
+      { DXGI_FORMAT_BC7_UNORM,            { 16, 4, 4 } },
+    }};
+
+    // Fixed seed so that failures are reproducible
+    std::mt19937 rng(0x7117ed);
+
+    auto log2 = [] (uint32_t n) {
+      uint32_t result = 0;
+
+      while (n >>= 1)
+        result += 1;
+
+      return result;
+    };
+
+    auto randomExtent = [&rng, &log2] (uint32_t maxExtent, uint32_t alignment) {
+      // Bias towards small extents to exercise mip tails
+      uint32_t bits = std::uniform_int_distribution<uint32_t>(0, log2(maxExtent))(rng);
+      uint32_t extent = std::uniform_int_distribution<uint32_t>(1u << bits, std::min(2u << bits, maxExtent))(rng);
+      return std::max(alignment, extent & ~(alignment - 1));
+    };
+
+    auto maxMipCount = [&log2] (uint32_t w, uint32_t h, uint32_t d) {
+      return log2(std::max(std::max(w, h), d)) + 1;
+    };
+
+    constexpr uint32_t TestCount = 4096;
+
+    std::vector<tiling::ResourceDesc> descs;
+    std::vector<DXGI_FORMAT> descFormats;
+    descs.reserve(TestCount);
+    descFormats.reserve(TestCount);
+
+    for (uint32_t i = 0; i < TestCount; i++) {
+      const auto& format = formats[rng() % formats.size()];
+
+      tiling::ResourceDesc desc = { };
+      desc.dimension = (i % 8 == 7 && m_tier >= D3D11_TILED_RESOURCES_TIER_3)
+        ? tiling::Dimension::Texture3D
+        : tiling::Dimension::Texture2D;
+      desc.format = format.Element;
+
+      uint32_t maxExtent = desc.dimension == tiling::Dimension::Texture3D ? 2048 : 16384;
+
+      desc.width  = randomExtent(maxExtent, format.Element.blockWidth);
+      desc.height = randomExtent(maxExtent, format.Element.blockHeight);
+      desc.depth  = desc.dimension == tiling::Dimension::Texture3D ? randomExtent(256, 1) : 1;
+
+      // Keep individual resources reasonably small
+      while (uint64_t(desc.width) * desc.height * desc.depth > (64u << 20)) {
+        desc.width  = std::max(desc.width  / 2, format.Element.blockWidth);
+        desc.height = std::max(desc.height / 2, format.Element.blockHeight);
+      }
+
+      uint32_t mipCount = maxMipCount(desc.width, desc.height, desc.depth);
+      desc.mipLevels = std::uniform_int_distribution<uint32_t>(1, mipCount)(rng);
+      desc.arraySize = desc.dimension == tiling::Dimension::Texture2D && (rng() % 4 == 0)
+        ? std::uniform_int_distribution<uint32_t>(2, 16)(rng) : 1;
+
+      // Tier 1 does not support arrays with packed mips
+      if (m_tier < D3D11_TILED_RESOURCES_TIER_2 && desc.arraySize > 1)
+        desc.mipLevels = 1;
+
+      descs.push_back(desc);
+      descFormats.push_back(format.Format);
+    }
+
+    // Time the reference model on its own to keep it honest
+    tiling::ResourceTiling reference;
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+
+    for (const auto& desc : descs)
+      tiling::computeTiling(desc, reference);
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    uint32_t tested = 0;
+    uint32_t skipped = 0;
+    uint32_t mismatches = 0;
+
+    std::vector<D3D11_SUBRESOURCE_TILING> tilings;
+
+    for (uint32_t i = 0; i < descs.size(); i++) {
+      const auto& desc = descs[i];
+      Com<ID3D11Resource> resource;
+
+      if (desc.dimension == tiling::Dimension::Texture3D) {
+        D3D11_TEXTURE3D_DESC desc3D = { };
+        desc3D.Width = desc.width;
+        desc3D.Height = desc.height;
+        desc3D.Depth = desc.depth;
+        desc3D.MipLevels = desc.mipLevels;
+        desc3D.Format = descFormats[i];
+        desc3D.Usage = D3D11_USAGE_DEFAULT;
+        desc3D.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        desc3D.MiscFlags = D3D11_RESOURCE_MISC_TILED;
+
+        Com<ID3D11Texture3D> tex3D;
+
+        if (FAILED(m_device->CreateTexture3D(&desc3D, nullptr, &tex3D))) {
+          skipped += 1;
+          continue;
+        }
+
+        tex3D->QueryInterface(IID_PPV_ARGS(&resource));
+      } else {
+        D3D11_TEXTURE2D_DESC desc2D = { };
+        desc2D.Width = desc.width;
+        desc2D.Height = desc.height;
+        desc2D.MipLevels = desc.mipLevels;
+        desc2D.ArraySize = desc.arraySize;
+        desc2D.SampleDesc = { 1, 0 };
+        desc2D.Format = descFormats[i];
+        desc2D.Usage = D3D11_USAGE_DEFAULT;
+        desc2D.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        desc2D.MiscFlags = D3D11_RESOURCE_MISC_TILED;
+
+        Com<ID3D11Texture2D> tex2D;
+
+        if (FAILED(m_device->CreateTexture2D(&desc2D, nullptr, &tex2D))) {
+          skipped += 1;
+          continue;
+        }
+
+        tex2D->QueryInterface(IID_PPV_ARGS(&resource));
+      }
+
+      uint32_t subresourceCount = desc.mipLevels * desc.arraySize;
+      tilings.resize(subresourceCount);
+
+      uint32_t tileCount = 0;
+      D3D11_PACKED_MIP_DESC packedInfo = { };
+      D3D11_TILE_SHAPE tileShape = { };
+
+      m_device->GetResourceTiling(resource.ptr(),
+        &tileCount, &packedInfo, &tileShape,
+        &subresourceCount, 0, tilings.data());
+
+      tiling::computeTiling(desc, reference, packedInfo.NumTilesForPackedMips);
+      tested += 1;
+
+      std::string error;
+
+      if (tileShape.WidthInTexels  != reference.shape.width
+       || tileShape.HeightInTexels != reference.shape.height
+       || tileShape.DepthInTexels  != reference.shape.depth)
+        error = format("tile shape ", tileShape.WidthInTexels, "x", tileShape.HeightInTexels, "x", tileShape.DepthInTexels,
+          ", expected ", reference.shape.width, "x", reference.shape.height, "x", reference.shape.depth);
+      else if (packedInfo.NumStandardMips != reference.standardMips
+            || packedInfo.NumPackedMips   != reference.packedMips)
+        error = format("mips ", uint32_t(packedInfo.NumStandardMips), "+", uint32_t(packedInfo.NumPackedMips),
+          ", expected ", reference.standardMips, "+", reference.packedMips);
+      else if (reference.packedMips && packedInfo.NumTilesForPackedMips < reference.packedTilesMin)
+        error = format("packed tiles ", packedInfo.NumTilesForPackedMips, ", expected at least ", reference.packedTilesMin);
+      else if (reference.packedMips && packedInfo.StartTileIndexInOverallResource != reference.packedStartTile)
+        error = format("packed start tile ", packedInfo.StartTileIndexInOverallResource, ", expected ", reference.packedStartTile);
+      else if (tileCount != reference.tileCount)
+        error = format("tile count ", tileCount, ", expected ", reference.tileCount);
+
+      for (uint32_t s = 0; s < subresourceCount && error.empty(); s++) {
+        const auto& a = tilings[s];
+        const auto& b = reference.subresources[s];
+
+        if (a.WidthInTiles != b.widthInTiles || a.HeightInTiles != b.heightInTiles
+         || a.DepthInTiles != b.depthInTiles || a.StartTileIndexInOverallResource != b.startTile) {
+          error = format("subresource ", s, ": ", a.WidthInTiles, "x", a.HeightInTiles, "x", a.DepthInTiles,
+            " @ ", a.StartTileIndexInOverallResource, ", expected ", b.widthInTiles, "x", b.heightInTiles,
+            "x", b.depthInTiles, " @ ", b.startTile);
+        }
+      }
+
+      if (!error.empty() && (mismatches++) < 16) {
+        std::cout << "GetResourceTiling: Reference " << std::dec << i << " (format " << descFormats[i]
+                  << ", " << desc.width << "x" << desc.height << "x" << desc.depth
+                  << ", " << desc.mipLevels << ", " << desc.arraySize << "): " << error << std::endl;
+      }
+    }
+
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    std::cout << "GetResourceTiling: Reference sweep: " << std::dec << tested << " tested, "
+              << skipped << " skipped, " << mismatches << " mismatches, model "
+              << std::chrono::duration<double, std::micro>(t1 - t0).count() << " us, driver "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+  }
+
   void testMapBufferTiles() {
     Com<ID3D11Buffer> tilePool;
     Com<ID3D11Buffer> buffer1;
     Com<ID3D11Buffer> buffer2;
-    Com<ID3D11Buffer> readback;
 
     D3D11_BUFFER_DESC tilePoolDesc = { };
     tilePoolDesc.ByteWidth = 64 << 16;
@@ -323,16 +570,6 @@ public:
       return;
     }
 
-    D3D11_BUFFER_DESC readbackDesc = { };
-    readbackDesc.ByteWidth = 256;
-    readbackDesc.Usage = D3D11_USAGE_STAGING;
-    readbackDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-
-    if (FAILED(m_device->CreateBuffer(&readbackDesc, nullptr, &readback))) {
-      std::cout << "Failed to create readback buffer" << std::endl;
-      return;
-    }
-
     // Map entire buffer to whole tile pool first
     D3D11_TILED_RESOURCE_COORDINATE regionCoord = { 0, 0, 0, 0 };
     D3D11_TILE_REGION_SIZE regionSize = { 64, FALSE };
@@ -369,8 +606,12 @@ public:
       m_context->ClearUnorderedAccessViewUint(uav.ptr(), color.data());
     }
 
-    validateBufferTileData(buffer1.ptr(), readback.ptr(), 64,
-      [] (uint32_t tile) { return tile + 1; });
+    std::array<uint32_t, 64> linear;
+
+    for (uint32_t i = 0; i < 64; i++)
+      linear[i] = i + 1;
+
+    validateBufferTileData(buffer1.ptr(), 64, linear.data());
 
     // Test complex UpdateResourceTiling on the other buffer
     std::cout << "Test: Complex UpdateTileMappings on buffer" << std::endl;
@@ -415,8 +656,7 @@ public:
      35, 36, 37,  0,  0,  0,  0, 19,
     }};
 
-    validateBufferTileData(buffer2.ptr(), readback.ptr(), 64,
-      [&expected] (uint32_t tile) { return expected[tile]; });
+    validateBufferTileData(buffer2.ptr(), 64, expected.data());
 
     // Test unmapping first buffer
     std::cout << "Test: Unmap all tiles" << std::endl;
@@ -431,8 +671,8 @@ public:
       return;
     }
 
-    validateBufferTileData(buffer1.ptr(), readback.ptr(), 64,
-      [&expected] (uint32_t tile) { return 0; });
+    std::array<uint32_t, 64> unmapped = { };
+    validateBufferTileData(buffer1.ptr(), 64, unmapped.data());
 
     // Test CopyTileMappings by copying some tiles from the second buffer to
     // the first, but with some offsets applied to keep things interesting
@@ -447,13 +687,106 @@ public:
       buffer2.ptr(), &srcCopyCoord,
       &copyRegionSize, 0);
 
-    validateBufferTileData(buffer1.ptr(), readback.ptr(), 64,
-      [&expected] (uint32_t tile) {
-        if (tile >= 1 && tile < 61)
-          return expected[tile + 1];
-        else
-          return 0u;
-      });
+    std::array<uint32_t, 64> copied = { };
+
+    for (uint32_t i = 1; i < 61; i++)
+      copied[i] = expected[i + 1];
+
+    validateBufferTileData(buffer1.ptr(), 64, copied.data());
+  }
+
+  void testMapLargeBufferTiles() {
+    constexpr uint32_t PoolTiles   = 1024;
+    constexpr uint32_t BufferTiles = 16384;
+
+    Com<ID3D11Buffer> tilePool;
+    Com<ID3D11Buffer> poolBuffer;
+    Com<ID3D11Buffer> buffer;
+
+    D3D11_BUFFER_DESC tilePoolDesc = { };
+    tilePoolDesc.ByteWidth = PoolTiles * tiling::TileSize;
+    tilePoolDesc.Usage = D3D11_USAGE_DEFAULT;
+    tilePoolDesc.MiscFlags = D3D11_RESOURCE_MISC_TILE_POOL;
+
+    if (FAILED(m_device->CreateBuffer(&tilePoolDesc, nullptr, &tilePool))) {
+      std::cout << "Failed to create tile pool" << std::endl;
+      return;
+    }
+
+    D3D11_BUFFER_DESC bufferDesc = { };
+    bufferDesc.ByteWidth = PoolTiles * tiling::TileSize;
+    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_TILED;
+
+    if (FAILED(m_device->CreateBuffer(&bufferDesc, nullptr, &poolBuffer))) {
+      std::cout << "Failed to create tiled buffer" << std::endl;
+      return;
+    }
+
+    bufferDesc.ByteWidth = BufferTiles * tiling::TileSize;
+
+    if (FAILED(m_device->CreateBuffer(&bufferDesc, nullptr, &buffer))) {
+      std::cout << "Failed to create tiled buffer" << std::endl;
+      return;
+    }
+
+    std::cout << "Test: Map " << std::dec << BufferTiles << " buffer tiles to " << PoolTiles << " pool tiles" << std::endl;
+
+    // Initialize every pool tile with its index, counting from 1,
+    // through a buffer that is mapped linearly to the tile pool
+    D3D11_TILED_RESOURCE_COORDINATE regionCoord = { 0, 0, 0, 0 };
+    D3D11_TILE_REGION_SIZE regionSize = { PoolTiles, FALSE };
+
+    UINT rangeFlags = 0;
+    UINT rangeOffset = 0;
+    UINT rangeSize = PoolTiles;
+
+    HRESULT hr = m_context->UpdateTileMappings(poolBuffer.ptr(),
+      1, &regionCoord, &regionSize, tilePool.ptr(),
+      1, &rangeFlags, &rangeOffset, &rangeSize, 0);
+
+    if (FAILED(hr)) {
+      std::cout << "UpdateTileMappings failed: 0x" << std::hex << hr << std::endl;
+      return;
+    }
+
+    constexpr uint32_t DwordsPerTile = tiling::TileSize / sizeof(uint32_t);
+
+    std::vector<uint32_t> poolData(PoolTiles * DwordsPerTile);
+
+    for (uint32_t i = 0; i < poolData.size(); i++)
+      poolData[i] = i / DwordsPerTile + 1;
+
+    m_context->UpdateSubresource(poolBuffer.ptr(), 0, nullptr, poolData.data(), 0, 0);
+
+    // Scatter buffer tiles across the pool one tile at a time
+    std::vector<D3D11_TILE_REGION_SIZE> regionSizes(BufferTiles, D3D11_TILE_REGION_SIZE { 1, FALSE });
+    std::vector<D3D11_TILED_RESOURCE_COORDINATE> regionCoords(BufferTiles);
+    std::vector<UINT> rangeFlagsArray(BufferTiles, 0);
+    std::vector<UINT> rangeOffsets(BufferTiles);
+    std::vector<UINT> rangeSizes(BufferTiles, 1);
+    std::vector<uint32_t> expected(BufferTiles);
+
+    for (uint32_t i = 0; i < BufferTiles; i++) {
+      regionCoords[i] = { i, 0, 0, 0 };
+      rangeOffsets[i] = (i * 7919) % PoolTiles;
+      expected[i] = rangeOffsets[i] + 1;
+    }
+
+    hr = m_context->UpdateTileMappings(buffer.ptr(),
+      BufferTiles, regionCoords.data(), regionSizes.data(), tilePool.ptr(),
+      BufferTiles, rangeFlagsArray.data(), rangeOffsets.data(), rangeSizes.data(), 0);
+
+    if (FAILED(hr)) {
+      std::cout << "UpdateTileMappings failed: 0x" << std::hex << hr << std::endl;
+      return;
+    }
+
+    bench::Timer timer;
+    validateBufferTileData(buffer.ptr(), BufferTiles, expected.data());
+
+    std::cout << "Validated " << std::dec << BufferTiles << " tiles in " << timer.elapsedUs() << " us" << std::endl;
   }
 
   void testMapImageTiles() {
@@ -591,6 +924,183 @@ public:
       D3D11_TILE_COPY_SWIZZLED_TILED_RESOURCE_TO_LINEAR_BUFFER);
   }
 
+  int runBenchmark() {
+    if (!m_initialized)
+      return 1;
+
+    benchResizeTilePool();
+    benchUpdateTileMappings();
+    return 0;
+  }
+
+  void benchResizeTilePool() {
+    Com<ID3D11Buffer> tilePool;
+
+    D3D11_BUFFER_DESC tilePoolDesc = { };
+    tilePoolDesc.ByteWidth  = 256u << 20;
+    tilePoolDesc.Usage      = D3D11_USAGE_DEFAULT;
+    tilePoolDesc.MiscFlags  = D3D11_RESOURCE_MISC_TILE_POOL;
+
+    bench::Timer timer;
+
+    if (FAILED(m_device->CreateBuffer(&tilePoolDesc, nullptr, &tilePool))) {
+      std::cout << "Failed to create tile pool" << std::endl;
+      return;
+    }
+
+    std::cout << "Bench: CreateBuffer (tile pool, 256 MB): " << timer.elapsedUs() << " us" << std::endl;
+
+    // Grow in 256 MB steps up to 3 GB, which is as far
+    // as a 32-bit ByteWidth comfortably goes
+    bench::Stats stats;
+    UINT64 size = tilePoolDesc.ByteWidth;
+
+    while (size < (3ull << 30)) {
+      size += 256ull << 20;
+      timer.reset();
+
+      HRESULT hr = m_context->ResizeTilePool(tilePool.ptr(), size);
+      double us = timer.elapsedUs();
+
+      if (FAILED(hr)) {
+        std::cout << "Bench: ResizeTilePool to " << std::dec << (size >> 20) << " MB failed: hr = 0x" << std::hex << hr << std::endl;
+        break;
+      }
+
+      stats.add(us);
+    }
+
+    std::cout << "Bench: ResizeTilePool (+256 MB, up to " << std::dec << (size >> 20) << " MB): " << stats << std::endl;
+  }
+
+  void benchUpdateTileMappings() {
+    // 16k x 16k RGBA32F uses 64x64 tiles, so each array layer
+    // has 65536 tiles and two layers cover over 100k tiles
+    D3D11_TEXTURE2D_DESC texDesc = { };
+    texDesc.Width      = 16384;
+    texDesc.Height     = 16384;
+    texDesc.MipLevels  = 1;
+    texDesc.ArraySize  = 2;
+    texDesc.SampleDesc = { 1, 0 };
+    texDesc.Format     = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    texDesc.Usage      = D3D11_USAGE_DEFAULT;
+    texDesc.BindFlags  = D3D11_BIND_SHADER_RESOURCE;
+    texDesc.MiscFlags  = D3D11_RESOURCE_MISC_TILED;
+
+    Com<ID3D11Texture2D> texture1;
+    Com<ID3D11Texture2D> texture2;
+
+    if (FAILED(m_device->CreateTexture2D(&texDesc, nullptr, &texture1))
+     || FAILED(m_device->CreateTexture2D(&texDesc, nullptr, &texture2))) {
+      std::cout << "Failed to create tiled 2D texture" << std::endl;
+      return;
+    }
+
+    constexpr uint32_t TilesPerRow   = 256;
+    constexpr uint32_t TilesPerLayer = TilesPerRow * TilesPerRow;
+
+    // Try to get a multi-GB tile pool, but fall back to
+    // smaller sizes if the implementation refuses
+    Com<ID3D11Buffer> tilePool;
+
+    D3D11_BUFFER_DESC tilePoolDesc = { };
+    tilePoolDesc.ByteWidth  = 3u << 30;
+    tilePoolDesc.Usage      = D3D11_USAGE_DEFAULT;
+    tilePoolDesc.MiscFlags  = D3D11_RESOURCE_MISC_TILE_POOL;
+
+    while (FAILED(m_device->CreateBuffer(&tilePoolDesc, nullptr, &tilePool))) {
+      tilePoolDesc.ByteWidth /= 2;
+
+      if (tilePoolDesc.ByteWidth < (64u << 20)) {
+        std::cout << "Failed to create tile pool" << std::endl;
+        return;
+      }
+    }
+
+    uint32_t poolTiles = tilePoolDesc.ByteWidth / tiling::TileSize;
+    std::cout << "Bench: Using tile pool with " << std::dec << poolTiles << " tiles" << std::endl;
+
+    std::mt19937 rng(0x5ca77e4);
+
+    // Contiguous: one linear region over the first layer,
+    // backed by a varying number of consecutive pool runs
+    uint32_t contiguousTiles = std::min(TilesPerLayer, poolTiles);
+
+    for (uint32_t rangeCount : { 1u, 16u, 256u, 4096u, 65536u }) {
+      uint32_t rangeSize = contiguousTiles / rangeCount;
+
+      if (!rangeSize) {
+        std::cout << "Bench: contiguous, " << std::dec << rangeCount << " ranges: skipped, only "
+                  << contiguousTiles << " tiles available" << std::endl;
+        continue;
+      }
+
+      D3D11_TILED_RESOURCE_COORDINATE regionCoord = { 0, 0, 0, 0 };
+      D3D11_TILE_REGION_SIZE regionSize = { rangeSize * rangeCount, FALSE };
+
+      std::vector<UINT> rangeFlags(rangeCount, 0);
+      std::vector<UINT> rangeOffsets(rangeCount);
+      std::vector<UINT> rangeSizes(rangeCount, rangeSize);
+
+      for (uint32_t i = 0; i < rangeCount; i++)
+        rangeOffsets[i] = i * rangeSize;
+
+      benchTileMappingCall(format("contiguous, ", rangeCount, " ranges"), regionSize.NumTiles, [&] {
+        return m_context->UpdateTileMappings(texture1.ptr(),
+          1, &regionCoord, &regionSize, tilePool.ptr(),
+          rangeCount, rangeFlags.data(), rangeOffsets.data(), rangeSizes.data(), 0);
+      });
+    }
+
+    // Scatter: single-tile regions at random, unique locations
+    // across both layers, each backed by a random pool tile
+    std::vector<uint32_t> tileIndices(2 * TilesPerLayer);
+
+    for (uint32_t i = 0; i < tileIndices.size(); i++)
+      tileIndices[i] = i;
+
+    std::shuffle(tileIndices.begin(), tileIndices.end(), rng);
+
+    for (uint32_t rangeCount : { 1u, 100u, 1000u, 10000u, 100000u }) {
+      std::vector<D3D11_TILED_RESOURCE_COORDINATE> regionCoords(rangeCount);
+      std::vector<D3D11_TILE_REGION_SIZE> regionSizes(rangeCount, D3D11_TILE_REGION_SIZE { 1, FALSE });
+
+      std::vector<UINT> rangeFlags(rangeCount, 0);
+      std::vector<UINT> rangeOffsets(rangeCount);
+      std::vector<UINT> rangeSizes(rangeCount, 1);
+
+      for (uint32_t i = 0; i < rangeCount; i++) {
+        uint32_t tile = tileIndices[i];
+
+        regionCoords[i].X = tile % TilesPerRow;
+        regionCoords[i].Y = (tile % TilesPerLayer) / TilesPerRow;
+        regionCoords[i].Z = 0;
+        regionCoords[i].Subresource = tile / TilesPerLayer;
+
+        rangeOffsets[i] = rng() % poolTiles;
+      }
+
+      benchTileMappingCall(format("scatter, ", rangeCount, " ranges"), rangeCount, [&] {
+        return m_context->UpdateTileMappings(texture1.ptr(),
+          rangeCount, regionCoords.data(), regionSizes.data(), tilePool.ptr(),
+          rangeCount, rangeFlags.data(), rangeOffsets.data(), rangeSizes.data(), 0);
+      });
+    }
+
+    // Copy the now heavily fragmented mappings of both layers
+    for (uint32_t tileCount : { 1u, 256u, TilesPerLayer, 2 * TilesPerLayer }) {
+      D3D11_TILED_RESOURCE_COORDINATE coord = { 0, 0, 0, 0 };
+      D3D11_TILE_REGION_SIZE regionSize = { tileCount, FALSE };
+
+      benchTileMappingCall(format("CopyTileMappings, ", tileCount, " tiles"), tileCount, [&] {
+        return m_context->CopyTileMappings(
+          texture2.ptr(), &coord,
+          texture1.ptr(), &coord,
+          &regionSize, 0);
+      });
+    }
+  }
+
 private:
 
   Com<ID3D11Device2>          m_device;
@@ -598,39 +1108,160 @@ private:
 
   D3D11_TILED_RESOURCES_TIER  m_tier;
 
+  Com<ID3D11ComputeShader>    m_gatherShader;
+  Com<ID3D11Query>            m_idleQuery;
+
   bool m_initialized = false;
 
+  void waitForIdle() {
+    m_context->End(m_idleQuery.ptr());
+
+    BOOL done = FALSE;
+
+    while (m_context->GetData(m_idleQuery.ptr(), &done, sizeof(done), 0) != S_OK || !done)
+      continue;
+  }
+
+  template<typename Proc>
+  void benchTileMappingCall(const std::string& name, uint32_t tileCount, const Proc& proc) {
+    constexpr uint32_t Iterations = 32;
+
+    bench::Stats callStats;
+    bench::Stats totalStats;
+
+    for (uint32_t i = 0; i < Iterations; i++) {
+      waitForIdle();
+
+      bench::Timer timer;
+      HRESULT hr = proc();
+      callStats.add(timer.elapsedUs());
+
+      if (FAILED(hr)) {
+        std::cout << "Bench: " << name << ": failed, hr = 0x" << std::hex << hr << std::endl;
+        return;
+      }
+
+      // Include the time until the mapping has actually
+      // been processed, since it may be deferred
+      waitForIdle();
+      totalStats.add(timer.elapsedUs());
+    }
+
+    double tilesPerSec = 1000000.0 * double(tileCount) / totalStats.percentile(0.5);
+
+    std::cout << "Bench: " << name << ": " << std::dec << uint64_t(tilesPerSec) << " tiles/s" << std::endl
+              << "  call:  " << callStats << std::endl
+              << "  total: " << totalStats << std::endl;
+  }
+
   void validateBufferTileData(
           ID3D11Buffer*       tiledBuffer,
-          ID3D11Buffer*       readbackBuffer,
           uint32_t            tileCount,
-    const std::function<uint32_t (uint32_t)>& proc) {
-    for (uint32_t i = 0; i < tileCount; i++) {
-      D3D11_BOX box = { (i << 16), 0, 0, (i << 16) + uint32_t(sizeof(uint32_t)), 1, 1 };
-      m_context->CopySubresourceRegion(readbackBuffer, 0,
-        sizeof(uint32_t) * i, 0, 0, tiledBuffer, 0, &box);
+    const uint32_t*           expected) {
+    // Gather one dword per tile on the GPU so that validation
+    // costs one dispatch and one copy regardless of tile count
+    D3D11_BUFFER_DESC gatherDesc = { };
+    gatherDesc.ByteWidth = sizeof(uint32_t) * tileCount;
+    gatherDesc.Usage = D3D11_USAGE_DEFAULT;
+    gatherDesc.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
+
+    D3D11_BUFFER_DESC readbackDesc = { };
+    readbackDesc.ByteWidth = sizeof(uint32_t) * tileCount;
+    readbackDesc.Usage = D3D11_USAGE_STAGING;
+    readbackDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+    Com<ID3D11Buffer> gatherBuffer;
+    Com<ID3D11Buffer> readbackBuffer;
+
+    if (FAILED(m_device->CreateBuffer(&gatherDesc, nullptr, &gatherBuffer))
+     || FAILED(m_device->CreateBuffer(&readbackDesc, nullptr, &readbackBuffer))) {
+      std::cout << "Failed to create tile validation buffers" << std::endl;
+      return;
+    }
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = { };
+    // Use a 16-byte format so that views can cover more than
+    // the 2^27 texels a buffer view is limited to otherwise
+    srvDesc.Format = DXGI_FORMAT_R32G32B32A32_UINT;
+    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+    srvDesc.Buffer.FirstElement = 0;
+    srvDesc.Buffer.NumElements = tileCount * (tiling::TileSize / 16);
+
+    D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc = { };
+    uavDesc.Format = DXGI_FORMAT_R32_UINT;
+    uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+    uavDesc.Buffer.FirstElement = 0;
+    uavDesc.Buffer.NumElements = tileCount;
+
+    Com<ID3D11ShaderResourceView> srv;
+    Com<ID3D11UnorderedAccessView> uav;
+
+    if (FAILED(m_device->CreateShaderResourceView(tiledBuffer, &srvDesc, &srv))
+     || FAILED(m_device->CreateUnorderedAccessView(gatherBuffer.ptr(), &uavDesc, &uav))) {
+      std::cout << "Failed to create tile validation views" << std::endl;
+      return;
     }
 
+    ID3D11ShaderResourceView* srvPtr = srv.ptr();
+    ID3D11UnorderedAccessView* uavPtr = uav.ptr();
+
+    m_context->CSSetShader(m_gatherShader.ptr(), nullptr, 0);
+    m_context->CSSetShaderResources(0, 1, &srvPtr);
+    m_context->CSSetUnorderedAccessViews(0, 1, &uavPtr, nullptr);
+    m_context->Dispatch((tileCount + 63) / 64, 1, 1);
+
+    srvPtr = nullptr;
+    uavPtr = nullptr;
+
+    m_context->CSSetShaderResources(0, 1, &srvPtr);
+    m_context->CSSetUnorderedAccessViews(0, 1, &uavPtr, nullptr);
+
+    m_context->CopyResource(readbackBuffer.ptr(), gatherBuffer.ptr());
+
     D3D11_MAPPED_SUBRESOURCE mapped = { };
-    m_context->Map(readbackBuffer, 0, D3D11_MAP_READ, 0, &mapped);
+
+    if (FAILED(m_context->Map(readbackBuffer.ptr(), 0, D3D11_MAP_READ, 0, &mapped))) {
+      std::cout << "Failed to map tile validation buffer" << std::endl;
+      return;
+    }
 
     auto data = reinterpret_cast<const uint32_t*>(mapped.pData);
 
-    for (uint32_t i = 0; i < tileCount; i++) {
-      if (data[i] != proc(i)) {
-        std::cout << "At tile " << std::dec << i
-                  << ", expected 0x" << std::hex << proc(i)
-                  << ", got 0x" << std::hex << data[i] << std::endl;
+    // Compare four tiles at a time and only fall back
+    // to scalar code to locate the first mismatch
+    uint32_t first = 0;
+
+    while (first + 4 <= tileCount) {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&data[first]));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&expected[first]));
+
+      if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) != 0xFFFF)
         break;
-      }
+
+      first += 4;
     }
 
-    m_context->Unmap(readbackBuffer, 0);
+    while (first < tileCount && data[first] == expected[first])
+      first += 1;
+
+    if (first < tileCount) {
+      std::cout << "At tile " << std::dec << first
+                << ", expected 0x" << std::hex << expected[first]
+                << ", got 0x" << std::hex << data[first] << std::endl;
+    }
+
+    m_context->Unmap(readbackBuffer.ptr(), 0);
   }
 
 };
 
-int main(int, char**) {
+int main(int argc, char** argv) {
   TiledResourceTestApp app;
+
+  for (int i = 1; i < argc; i++) {
+    if (std::string(argv[i]) == "--bench")
+      return app.runBenchmark();
+  }
+
   return app.run();
 }
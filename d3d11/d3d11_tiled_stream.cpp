@@ -0,0 +1,392 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <d3d11_2.h>
+
+#include <windows.h>
+
+#include "../common/bench.h"
+#include "../common/com.h"
+#include "../common/str.h"
+#include "../common/tiling.h"
+
+/**
+  * \brief Virtual texturing workload
+  *
+  * Streams tiles of a 16k x 16k tiled texture into a
+  * fixed-size tile pool. A camera moves along a path
+  * over the texture and requests a window of tiles
+  * around it on every mip level, clipmap-style. Tiles
+  * that are not resident are mapped to free pool tiles
+  * or evict the least recently used ones, and their
+  * contents are uploaded with UpdateTiles or CopyTiles.
+  */
+class TiledStreamApp {
+
+  constexpr static uint32_t TextureSize   = 16384;
+  constexpr static uint32_t TileExtent    = 128;  // RGBA8 standard tile shape
+  constexpr static uint32_t MipCount      = 8;    // Down to a single tile
+  constexpr static int32_t  FeedbackRange = 4;    // Tiles around camera per mip
+
+  struct TileKey {
+    uint32_t mip;
+    uint32_t x;
+    uint32_t y;
+
+    uint32_t pack() const {
+      return (mip << 28) | (y << 14) | x;
+    }
+  };
+
+  struct ResidentTile {
+    TileKey  key;
+    uint32_t poolTile;
+    uint32_t lastUsed;
+  };
+
+public:
+
+  struct Options {
+    uint32_t frames     = 1000;
+    uint32_t poolTiles  = 2048;
+    uint32_t budget     = 256;
+    bool     copyTiles  = false;
+  };
+
+  TiledStreamApp(const Options& options)
+  : m_options(options) {
+    Com<ID3D11Device> device;
+
+    std::vector<D3D_FEATURE_LEVEL> fl = {
+      D3D_FEATURE_LEVEL_12_1,
+      D3D_FEATURE_LEVEL_12_0,
+      D3D_FEATURE_LEVEL_11_1,
+    };
+
+    if (FAILED(D3D11CreateDevice(
+          nullptr, D3D_DRIVER_TYPE_HARDWARE,
+          nullptr, 0, fl.data(), fl.size(), D3D11_SDK_VERSION,
+          &device, nullptr, nullptr))) {
+      std::cout << "Failed to create D3D11 device" << std::endl;
+      return;
+    }
+
+    if (FAILED(device->QueryInterface(IID_PPV_ARGS(&m_device)))) {
+      std::cout << "Failed to query ID3D11Device2" << std::endl;
+      return;
+    }
+
+    m_device->GetImmediateContext2(&m_context);
+
+    D3D11_FEATURE_DATA_D3D11_OPTIONS1 options1 = { };
+    m_device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS1, &options1, sizeof(options1));
+
+    if (options1.TiledResourcesTier == D3D11_TILED_RESOURCES_NOT_SUPPORTED) {
+      std::cout << "Tiled resources not supported" << std::endl;
+      return;
+    }
+
+    D3D11_TEXTURE2D_DESC texDesc = { };
+    texDesc.Width      = TextureSize;
+    texDesc.Height     = TextureSize;
+    texDesc.MipLevels  = MipCount;
+    texDesc.ArraySize  = 1;
+    texDesc.SampleDesc = { 1, 0 };
+    texDesc.Format     = DXGI_FORMAT_R8G8B8A8_UNORM;
+    texDesc.Usage      = D3D11_USAGE_DEFAULT;
+    texDesc.BindFlags  = D3D11_BIND_SHADER_RESOURCE;
+    texDesc.MiscFlags  = D3D11_RESOURCE_MISC_TILED;
+
+    if (FAILED(m_device->CreateTexture2D(&texDesc, nullptr, &m_texture))) {
+      std::cout << "Failed to create tiled texture" << std::endl;
+      return;
+    }
+
+    D3D11_BUFFER_DESC tilePoolDesc = { };
+    tilePoolDesc.ByteWidth  = m_options.poolTiles * tiling::TileSize;
+    tilePoolDesc.Usage      = D3D11_USAGE_DEFAULT;
+    tilePoolDesc.MiscFlags  = D3D11_RESOURCE_MISC_TILE_POOL;
+
+    if (FAILED(m_device->CreateBuffer(&tilePoolDesc, nullptr, &m_tilePool))) {
+      std::cout << "Failed to create tile pool" << std::endl;
+      return;
+    }
+
+    if (m_options.copyTiles) {
+      D3D11_BUFFER_DESC uploadDesc = { };
+      uploadDesc.ByteWidth  = m_options.budget * tiling::TileSize;
+      uploadDesc.Usage      = D3D11_USAGE_DEFAULT;
+
+      if (FAILED(m_device->CreateBuffer(&uploadDesc, nullptr, &m_uploadBuffer))) {
+        std::cout << "Failed to create upload buffer" << std::endl;
+        return;
+      }
+    }
+
+    D3D11_QUERY_DESC queryDesc = { D3D11_QUERY_EVENT, 0 };
+
+    if (FAILED(m_device->CreateQuery(&queryDesc, &m_query))) {
+      std::cout << "Failed to create event query" << std::endl;
+      return;
+    }
+
+    for (uint32_t i = 0; i < m_options.poolTiles; i++)
+      m_freeTiles.push_back(m_options.poolTiles - i - 1);
+
+    m_tileData.resize(size_t(m_options.budget) * tiling::TileSize);
+
+    std::cout << "Streaming " << TextureSize << "x" << TextureSize << " texture, "
+              << MipCount << " mips, " << m_options.poolTiles << " pool tiles, "
+              << m_options.budget << " tiles/frame budget, "
+              << (m_options.copyTiles ? "CopyTiles" : "UpdateTiles") << std::endl;
+
+    m_initialized = true;
+  }
+
+  int run() {
+    if (!m_initialized)
+      return 1;
+
+    for (uint32_t f = 0; f < m_options.frames; f++)
+      runFrame(f);
+
+    std::cout << "Frames:         " << m_options.frames << std::endl
+              << "Frame time:     " << m_frameStats << std::endl
+              << "Mapping calls:  " << m_mappingStats << std::endl
+              << "Uploads:        " << m_uploadStats << std::endl
+              << "Tile data:      " << m_generateStats << " (not in frame time)" << std::endl
+              << "Tiles streamed: " << m_streamedTiles << " total, "
+              << double(m_streamedTiles) / double(m_options.frames) << " per frame, "
+              << m_maxStreamedTiles << " max" << std::endl
+              << "Tiles evicted:  " << m_evictedTiles << std::endl
+              << "Residency:      " << std::fixed
+              << 100.0 * m_residencySum / (double(m_options.frames) * double(m_options.poolTiles)) << "% of pool on average, "
+              << m_missedTiles << " requests deferred by budget, "
+              << m_thrashedTiles << " requests dropped by full pool" << std::endl;
+    return 0;
+  }
+
+private:
+
+  Options                   m_options;
+
+  Com<ID3D11Device2>        m_device;
+  Com<ID3D11DeviceContext2> m_context;
+  Com<ID3D11Texture2D>      m_texture;
+  Com<ID3D11Buffer>         m_tilePool;
+  Com<ID3D11Buffer>         m_uploadBuffer;
+  Com<ID3D11Query>          m_query;
+
+  // Most recently used tiles are at the front
+  std::list<ResidentTile>   m_lru;
+  std::unordered_map<uint32_t, std::list<ResidentTile>::iterator> m_resident;
+  std::vector<uint32_t>     m_freeTiles;
+
+  std::vector<TileKey>      m_feedback;
+  std::vector<uint8_t>      m_tileData;
+
+  bench::Stats              m_frameStats;
+  bench::Stats              m_mappingStats;
+  bench::Stats              m_uploadStats;
+  bench::Stats              m_generateStats;
+
+  uint64_t                  m_streamedTiles = 0;
+  uint32_t                  m_maxStreamedTiles = 0;
+  uint64_t                  m_evictedTiles = 0;
+  uint64_t                  m_missedTiles = 0;
+  uint64_t                  m_thrashedTiles = 0;
+  double                    m_residencySum = 0.0;
+
+  bool                      m_initialized = false;
+
+  void gatherFeedback(uint32_t frame) {
+    m_feedback.clear();
+
+    // Camera position in mip 0 tile coordinates
+    float t = float(frame) * 0.01f;
+    float tilesPerRow = float(TextureSize / TileExtent);
+
+    float cx = tilesPerRow * (0.5f + 0.4f * std::sin(0.7f * t));
+    float cy = tilesPerRow * (0.5f + 0.4f * std::sin(1.1f * t + 0.5f));
+
+    for (uint32_t m = 0; m < MipCount; m++) {
+      int32_t mipTiles = int32_t(std::max((TextureSize >> m) / TileExtent, 1u));
+      int32_t x = int32_t(cx) >> m;
+      int32_t y = int32_t(cy) >> m;
+
+      for (int32_t ty = std::max(y - FeedbackRange, 0); ty <= std::min(y + FeedbackRange, mipTiles - 1); ty++) {
+        for (int32_t tx = std::max(x - FeedbackRange, 0); tx <= std::min(x + FeedbackRange, mipTiles - 1); tx++)
+          m_feedback.push_back({ m, uint32_t(tx), uint32_t(ty) });
+      }
+    }
+  }
+
+  void runFrame(uint32_t frame) {
+    bench::Timer frameTimer;
+
+    gatherFeedback(frame);
+
+    std::vector<D3D11_TILED_RESOURCE_COORDINATE> coords;
+    std::vector<UINT> rangeFlags;
+    std::vector<UINT> rangeOffsets;
+    std::vector<TileKey> streamed;
+    std::vector<TileKey> misses;
+
+    // Touch every resident tile of this frame first, so that
+    // a miss early in the feedback list can never evict a tile
+    // that is requested further down the list
+    for (const auto& key : m_feedback) {
+      auto entry = m_resident.find(key.pack());
+
+      if (entry != m_resident.end()) {
+        entry->second->lastUsed = frame;
+        m_lru.splice(m_lru.begin(), m_lru, entry->second);
+      } else {
+        misses.push_back(key);
+      }
+    }
+
+    for (const auto& key : misses) {
+      if (streamed.size() >= m_options.budget) {
+        m_missedTiles += 1;
+        continue;
+      }
+
+      uint32_t poolTile;
+
+      if (!m_freeTiles.empty()) {
+        poolTile = m_freeTiles.back();
+        m_freeTiles.pop_back();
+      } else if (!m_lru.empty() && m_lru.back().lastUsed != frame) {
+        const ResidentTile& victim = m_lru.back();
+        poolTile = victim.poolTile;
+
+        coords.push_back({ victim.key.x, victim.key.y, 0, victim.key.mip });
+        rangeFlags.push_back(D3D11_TILE_RANGE_NULL);
+        rangeOffsets.push_back(0);
+
+        m_resident.erase(victim.key.pack());
+        m_lru.pop_back();
+        m_evictedTiles += 1;
+      } else {
+        // Everything in the pool is needed this frame
+        m_thrashedTiles += 1;
+        continue;
+      }
+
+      coords.push_back({ key.x, key.y, 0, key.mip });
+      rangeFlags.push_back(0);
+      rangeOffsets.push_back(poolTile);
+
+      m_lru.push_front({ key, poolTile, frame });
+      m_resident.insert({ key.pack(), m_lru.begin() });
+      streamed.push_back(key);
+    }
+
+    if (!coords.empty()) {
+      std::vector<D3D11_TILE_REGION_SIZE> regionSizes(coords.size(), D3D11_TILE_REGION_SIZE { 1, FALSE });
+      std::vector<UINT> rangeSizes(coords.size(), 1);
+
+      bench::Timer timer;
+
+      HRESULT hr = m_context->UpdateTileMappings(m_texture.ptr(),
+        coords.size(), coords.data(), regionSizes.data(), m_tilePool.ptr(),
+        coords.size(), rangeFlags.data(), rangeOffsets.data(), rangeSizes.data(), 0);
+
+      m_mappingStats.add(timer.elapsedUs());
+
+      if (FAILED(hr))
+        std::cout << "UpdateTileMappings failed: 0x" << std::hex << hr << std::dec << std::endl;
+    }
+
+    double generateUs = 0.0;
+
+    if (!streamed.empty()) {
+      // Producing the test data stands in for decompression
+      // and is not part of what the frame time measures
+      bench::Timer timer;
+      generateTileData(streamed);
+      generateUs = timer.elapsedUs();
+      m_generateStats.add(generateUs);
+
+      uploadTiles(streamed);
+    }
+
+    m_context->End(m_query.ptr());
+
+    BOOL done = FALSE;
+
+    while (m_context->GetData(m_query.ptr(), &done, sizeof(done), 0) != S_OK || !done)
+      continue;
+
+    m_frameStats.add(frameTimer.elapsedUs() - generateUs);
+    m_streamedTiles += streamed.size();
+    m_maxStreamedTiles = std::max(m_maxStreamedTiles, uint32_t(streamed.size()));
+    m_residencySum += double(m_resident.size());
+  }
+
+  void generateTileData(const std::vector<TileKey>& tiles) {
+    // Stand-in for decompressed tile data: a solid
+    // color derived from the tile coordinates
+    for (uint32_t i = 0; i < tiles.size(); i++) {
+      uint32_t color = tiles[i].pack() * 2654435761u;
+      auto dst = reinterpret_cast<uint32_t*>(&m_tileData[size_t(i) * tiling::TileSize]);
+      std::fill(dst, dst + tiling::TileSize / sizeof(uint32_t), color);
+    }
+  }
+
+  void uploadTiles(const std::vector<TileKey>& tiles) {
+    bench::Timer timer;
+
+    if (m_options.copyTiles) {
+      D3D11_BOX box = { 0, 0, 0, uint32_t(tiles.size()) * tiling::TileSize, 1, 1 };
+      m_context->UpdateSubresource(m_uploadBuffer.ptr(), 0, &box, m_tileData.data(), 0, 0);
+    }
+
+    for (uint32_t i = 0; i < tiles.size(); i++) {
+      D3D11_TILED_RESOURCE_COORDINATE coord = { tiles[i].x, tiles[i].y, 0, tiles[i].mip };
+      D3D11_TILE_REGION_SIZE size = { 1, FALSE };
+
+      if (m_options.copyTiles) {
+        m_context->CopyTiles(m_texture.ptr(), &coord, &size,
+          m_uploadBuffer.ptr(), UINT64(i) * tiling::TileSize,
+          D3D11_TILE_COPY_LINEAR_BUFFER_TO_SWIZZLED_TILED_RESOURCE);
+      } else {
+        m_context->UpdateTiles(m_texture.ptr(), &coord, &size,
+          &m_tileData[size_t(i) * tiling::TileSize], 0);
+      }
+    }
+
+    m_uploadStats.add(timer.elapsedUs());
+  }
+
+};
+
+int main(int argc, char** argv) {
+  TiledStreamApp::Options options;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "--copy-tiles") {
+      options.copyTiles = true;
+    } else if (i + 1 < argc && arg == "--frames") {
+      options.frames = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--pool-tiles") {
+      options.poolTiles = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--budget") {
+      options.budget = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: d3d11-tiled-stream [--frames n] [--pool-tiles n] [--budget n] [--copy-tiles]" << std::endl;
+      return 1;
+    }
+  }
+
+  TiledStreamApp app(options);
+  return app.run();
+}
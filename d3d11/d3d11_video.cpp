@@ -1,7 +1,6 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -10,9 +9,12 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include "../common/asset.h"
 #include "../common/com.h"
 #include "../common/str.h"
 
+#include "video_image_raw.h"
+
 class VideoApp {
   
 public:
@@ -135,14 +137,14 @@ public:
     size_t imageSizeNv12 = pixelCount + pixelCount / 2;
     size_t imageSizeYuy2 = textureDesc.Height * rowSizeYuy2;
 
-    std::vector<uint8_t> srcData(pixelCount * 3);
     std::vector<uint8_t> imgDataRgba(imageSizeRgba);
     std::vector<uint8_t> imgDataNv12(imageSizeNv12);
     std::vector<uint8_t> imgDataYuy2(imageSizeYuy2);
-    std::ifstream ifile("video_image.raw", std::ios::binary);
 
-    if (!ifile || !ifile.read(reinterpret_cast<char*>(srcData.data()), srcData.size())) {
-      std::cerr << "Failed to read image file" << std::endl;
+    const uint8_t* srcData = video_image.data();
+
+    if (!srcData || video_image.size() < pixelCount * 3) {
+      std::cerr << "Failed to decode image data" << std::endl;
       return;
     }
 
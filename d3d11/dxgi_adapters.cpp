@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include <dxgi1_6.h>
@@ -6,10 +11,562 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include "../common/bench.h"
 #include "../common/com.h"
+#include "../common/modes.h"
 #include "../common/str.h"
 
+modes::Mode toMode(const DXGI_MODE_DESC& desc) {
+  modes::Mode mode;
+  mode.width            = desc.Width;
+  mode.height           = desc.Height;
+  mode.refreshRate      = { desc.RefreshRate.Numerator, desc.RefreshRate.Denominator };
+  mode.format           = desc.Format;
+  mode.scanlineOrdering = desc.ScanlineOrdering;
+  mode.scaling          = desc.Scaling;
+  return mode;
+}
+
+DXGI_MODE_DESC toDesc(const modes::Mode& mode) {
+  DXGI_MODE_DESC desc;
+  desc.Width                   = mode.width;
+  desc.Height                  = mode.height;
+  desc.RefreshRate.Numerator   = mode.refreshRate.numerator;
+  desc.RefreshRate.Denominator = mode.refreshRate.denominator;
+  desc.Format                  = DXGI_FORMAT(mode.format);
+  desc.ScanlineOrdering        = DXGI_MODE_SCANLINE_ORDER(mode.scanlineOrdering);
+  desc.Scaling                 = DXGI_MODE_SCALING(mode.scaling);
+  return desc;
+}
+
+bool isSameMode(const DXGI_MODE_DESC& a, const DXGI_MODE_DESC& b) {
+  return a.Width                   == b.Width
+      && a.Height                  == b.Height
+      && a.RefreshRate.Numerator   == b.RefreshRate.Numerator
+      && a.RefreshRate.Denominator == b.RefreshRate.Denominator
+      && a.Format                  == b.Format
+      && a.ScanlineOrdering        == b.ScanlineOrdering
+      && a.Scaling                 == b.Scaling;
+}
+
+std::string getModeName(const DXGI_MODE_DESC& mode) {
+  return format(mode.Width, "x", mode.Height, " @ ",
+    mode.RefreshRate.Numerator, "/", mode.RefreshRate.Denominator,
+    ", format ", mode.Format, ", scanline ", mode.ScanlineOrdering,
+    ", scaling ", mode.Scaling);
+}
+
+HRESULT getDisplayModes(IDXGIOutput* output, DXGI_FORMAT format, std::vector<DXGI_MODE_DESC>& modes) {
+  HRESULT status = S_OK;
+  UINT    displayModeCount = 0;
+
+  do {
+    status = output->GetDisplayModeList(format,
+      DXGI_ENUM_MODES_SCALING, &displayModeCount, nullptr);
+
+    if (FAILED(status))
+      return status;
+
+    modes.resize(displayModeCount);
+
+    status = output->GetDisplayModeList(format,
+      DXGI_ENUM_MODES_SCALING, &displayModeCount, modes.data());
+  } while (status == DXGI_ERROR_MORE_DATA);
+
+  modes.resize(displayModeCount);
+  return status;
+}
+
+/**
+ * \brief Queries modes for all formats
+ *
+ * \param [in] output DXGI output
+ * \param [out] modes Modes of all formats
+ * \param [out] formatUs Time spent per format, may be \c nullptr
+ * \param [out] stats Per-call times, may be \c nullptr
+ */
+void getAllDisplayModes(IDXGIOutput* output, std::vector<DXGI_MODE_DESC>& modes, std::vector<double>* formatUs, bench::Stats* stats) {
+  std::vector<DXGI_MODE_DESC> formatModes;
+  modes.clear();
+
+  for (UINT f = UINT(DXGI_FORMAT_R32G32B32A32_TYPELESS); f <= UINT(DXGI_FORMAT_B4G4R4A4_UNORM); f++) {
+    bench::Timer modeTimer;
+    HRESULT hr = getDisplayModes(output, DXGI_FORMAT(f), formatModes);
+    double us = modeTimer.elapsedUs();
+
+    if (stats)
+      stats->add(us);
+
+    if (formatUs)
+      (*formatUs)[f] += us;
+
+    if (SUCCEEDED(hr))
+      modes.insert(modes.end(), formatModes.begin(), formatModes.end());
+  }
+}
+
+/**
+ * \brief Queries current desktop mode of an output
+ *
+ * Unspecified fields of a query resolve towards this.
+ * GDI does not report a DXGI format, so assume the
+ * 8-bit RGBA format any 32-bit desktop maps to.
+ * \param [in] output DXGI output
+ * \param [out] mode Desktop mode
+ * \returns \c true on success
+ */
+bool getDesktopMode(IDXGIOutput* output, modes::Mode& mode) {
+  DXGI_OUTPUT_DESC desc;
+
+  if (FAILED(output->GetDesc(&desc)))
+    return false;
+
+  DEVMODEW devMode = { };
+  devMode.dmSize = sizeof(devMode);
+
+  if (!EnumDisplaySettingsW(desc.DeviceName, ENUM_CURRENT_SETTINGS, &devMode))
+    return false;
+
+  mode.width            = devMode.dmPelsWidth;
+  mode.height           = devMode.dmPelsHeight;
+  mode.refreshRate      = { devMode.dmDisplayFrequency, 1 };
+  mode.format           = DXGI_FORMAT_R8G8B8A8_UNORM;
+  mode.scanlineOrdering = DXGI_MODE_SCANLINE_ORDER_PROGRESSIVE;
+  mode.scaling          = DXGI_MODE_SCALING_UNSPECIFIED;
+  return true;
+}
+
+struct MatchStats {
+  bench::Stats driver;
+  bench::Stats table;
+  bench::Stats linear;
+  uint32_t     queries    = 0;
+  uint32_t     mismatches = 0;
+};
+
+/**
+ * \brief Compares driver mode matching against the CPU
+ *
+ * Fires randomized, non-exact queries at the output and
+ * at both CPU implementations, and checks that all three
+ * agree on every field of the result.
+ * \param [in] output DXGI output
+ * \param [in] outputModes Modes of all formats
+ * \param [in] queryCount Number of queries
+ * \param [in] stats Statistics to add to
+ */
+void matchModes(IDXGIOutput* output, const std::vector<DXGI_MODE_DESC>& outputModes, uint32_t queryCount, MatchStats& stats) {
+  modes::Mode desktop = { };
+
+  if (!getDesktopMode(output, desktop)) {
+    std::cerr << "Failed to get desktop mode" << std::endl;
+    return;
+  }
+
+  std::vector<modes::Mode> cpuModes;
+
+  for (const auto& mode : outputModes)
+    cpuModes.push_back(toMode(mode));
+
+  modes::ModeTable table(cpuModes);
+
+  auto queries = modes::generateQueries(cpuModes, queryCount, queryCount);
+
+  if (queries.empty())
+    return;
+
+  std::vector<uint32_t> tableResults(queries.size());
+  std::vector<uint32_t> linearResults(queries.size());
+
+  bench::Timer tableTimer;
+
+  for (size_t q = 0; q < queries.size(); q++)
+    tableResults[q] = table.findClosest(queries[q], desktop);
+
+  stats.table.add(tableTimer.elapsedUs() / double(queries.size()));
+
+  bench::Timer linearTimer;
+
+  for (size_t q = 0; q < queries.size(); q++)
+    linearResults[q] = modes::findClosestLinear(cpuModes, queries[q], desktop);
+
+  stats.linear.add(linearTimer.elapsedUs() / double(queries.size()));
+
+  for (size_t q = 0; q < queries.size(); q++) {
+    DXGI_MODE_DESC query = toDesc(queries[q]);
+    DXGI_MODE_DESC match = { };
+
+    bench::Timer findTimer;
+    HRESULT hr = output->FindClosestMatchingMode(&query, &match, nullptr);
+    stats.driver.add(findTimer.elapsedUs());
+
+    stats.queries += 1;
+
+    bool matches = tableResults[q] == linearResults[q]
+      && tableResults[q] != modes::InvalidIndex
+      && SUCCEEDED(hr)
+      && isSameMode(match, outputModes[tableResults[q]]);
+
+    if (!matches && stats.mismatches++ < 10) {
+      std::cerr << "Mismatch for " << getModeName(query) << ":" << std::endl
+                << "  driver:  " << (SUCCEEDED(hr) ? getModeName(match) : format("error ", std::hex, hr)) << std::endl
+                << "  table:   " << (tableResults[q] != modes::InvalidIndex ? getModeName(outputModes[tableResults[q]]) : "none") << std::endl
+                << "  linear:  " << (linearResults[q] != modes::InvalidIndex ? getModeName(outputModes[linearResults[q]]) : "none") << std::endl;
+    }
+  }
+}
+
+/**
+ * \brief Measures adapter and mode enumeration
+ *
+ * Times every enumeration call, including mode lists
+ * for every format, and compares the driver's closest
+ * mode matching against a CPU lookup in a cached, sorted
+ * copy of the mode list.
+ * \param [in] iterations Number of enumeration passes
+ * \returns Process exit code
+ */
+int runBench(uint32_t iterations) {
+  Com<IDXGIFactory1> factory;
+
+  if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&factory)))) {
+    std::cerr << "Failed to create DXGI factory" << std::endl;
+    return 1;
+  }
+
+  constexpr uint32_t QueriesPerOutput = 256;
+
+  bench::Stats enumAdapters;
+  bench::Stats enumOutputs;
+  bench::Stats modeLists;
+  MatchStats   matchStats;
+
+  std::vector<double> formatUs(UINT(DXGI_FORMAT_B4G4R4A4_UNORM) + 1);
+
+  uint32_t outputCount = 0;
+  uint32_t modeCount = 0;
+
+  for (uint32_t n = 0; n < iterations; n++) {
+    outputCount = 0;
+    modeCount = 0;
+
+    for (UINT i = 0; ; i++) {
+      Com<IDXGIAdapter1> adapter;
+
+      bench::Timer adapterTimer;
+      HRESULT hr = factory->EnumAdapters1(i, &adapter);
+      enumAdapters.add(adapterTimer.elapsedUs());
+
+      if (FAILED(hr))
+        break;
+
+      for (UINT j = 0; ; j++) {
+        Com<IDXGIOutput> output;
+
+        bench::Timer outputTimer;
+        hr = adapter->EnumOutputs(j, &output);
+        enumOutputs.add(outputTimer.elapsedUs());
+
+        if (FAILED(hr))
+          break;
+
+        std::vector<DXGI_MODE_DESC> outputModes;
+        getAllDisplayModes(output.ptr(), outputModes, &formatUs, &modeLists);
+
+        outputCount += 1;
+        modeCount += uint32_t(outputModes.size());
+
+        matchModes(output.ptr(), outputModes, QueriesPerOutput, matchStats);
+      }
+    }
+  }
+
+  std::cout << outputCount << " outputs, " << modeCount << " modes, "
+            << iterations << " iterations" << std::endl
+            << "EnumAdapters1:           " << enumAdapters << std::endl
+            << "EnumOutputs:             " << enumOutputs << std::endl
+            << "GetDisplayModeList:      " << modeLists << std::endl
+            << "FindClosestMatchingMode: " << matchStats.driver << std::endl
+            << "CPU table lookup:        " << matchStats.table << std::endl
+            << "CPU linear scan:         " << matchStats.linear << std::endl
+            << "Mismatches:              " << matchStats.mismatches << " of " << matchStats.queries << std::endl;
+
+  std::vector<UINT> order;
+
+  for (UINT f = 0; f < formatUs.size(); f++)
+    order.push_back(f);
+
+  std::sort(order.begin(), order.end(), [&] (UINT a, UINT b) {
+    return formatUs[a] > formatUs[b];
+  });
+
+  std::cout << "Slowest GetDisplayModeList formats:" << std::endl;
+
+  for (size_t i = 0; i < std::min<size_t>(order.size(), 5); i++) {
+    std::cout << "  " << order[i] << ": " << std::fixed << std::setprecision(1)
+              << (formatUs[order[i]] / double(iterations)) << " us per pass" << std::endl;
+  }
+
+  return matchStats.mismatches ? 1 : 0;
+}
+
+/**
+ * \brief Validates driver mode matching
+ *
+ * Runs a large number of randomized queries against
+ * every output, with unspecified fields, and compares
+ * the results against the CPU reference.
+ * \param [in] queryCount Number of queries per output
+ * \returns Process exit code
+ */
+int runValidate(uint32_t queryCount) {
+  Com<IDXGIFactory1> factory;
+
+  if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&factory)))) {
+    std::cerr << "Failed to create DXGI factory" << std::endl;
+    return 1;
+  }
+
+  MatchStats stats;
+
+  for (UINT i = 0; ; i++) {
+    Com<IDXGIAdapter1> adapter;
+
+    if (FAILED(factory->EnumAdapters1(i, &adapter)))
+      break;
+
+    for (UINT j = 0; ; j++) {
+      Com<IDXGIOutput> output;
+
+      if (FAILED(adapter->EnumOutputs(j, &output)))
+        break;
+
+      std::vector<DXGI_MODE_DESC> outputModes;
+      getAllDisplayModes(output.ptr(), outputModes, nullptr, nullptr);
+
+      uint32_t mismatches = stats.mismatches;
+      matchModes(output.ptr(), outputModes, queryCount, stats);
+
+      std::cout << "Adapter " << i << ", output " << j << ": " << outputModes.size() << " modes, "
+                << (stats.mismatches - mismatches) << " mismatches" << std::endl;
+    }
+  }
+
+  std::cout << "FindClosestMatchingMode: " << stats.driver << std::endl
+            << "CPU table lookup:        " << stats.table << std::endl
+            << "CPU linear scan:         " << stats.linear << std::endl
+            << "Mismatches:              " << stats.mismatches << " of " << stats.queries << std::endl;
+
+  return stats.mismatches ? 1 : 0;
+}
+
+struct EnumStats {
+  bench::Stats createFactory;
+  bench::Stats enumAdapters;
+  bench::Stats enumOutputs;
+  bench::Stats getDesc;
+  bench::Stats pass;
+
+  void add(const EnumStats& other) {
+    createFactory.add(other.createFactory);
+    enumAdapters.add(other.enumAdapters);
+    enumOutputs.add(other.enumOutputs);
+    getDesc.add(other.getDesc);
+    pass.add(other.pass);
+  }
+};
+
+/**
+ * \brief Enumerates all adapters and outputs once
+ *
+ * Same calls as the default mode, with each one timed.
+ * \param [in] factory DXGI factory
+ * \param [in] stats Statistics to add to
+ */
+void enumerateOnce(IDXGIFactory1* factory, EnumStats& stats) {
+  for (UINT i = 0; ; i++) {
+    Com<IDXGIAdapter1> adapter;
+
+    bench::Timer adapterTimer;
+    HRESULT hr = factory->EnumAdapters1(i, &adapter);
+    stats.enumAdapters.add(adapterTimer.elapsedUs());
+
+    if (FAILED(hr))
+      break;
+
+    for (UINT j = 0; ; j++) {
+      Com<IDXGIOutput> baseOutput;
+
+      bench::Timer outputTimer;
+      hr = adapter->EnumOutputs(j, &baseOutput);
+      stats.enumOutputs.add(outputTimer.elapsedUs());
+
+      if (FAILED(hr))
+        break;
+
+      Com<IDXGIOutput6> output;
+
+      if (FAILED(baseOutput->QueryInterface(__uuidof(IDXGIOutput6), reinterpret_cast<void**>(&output))))
+        continue;
+
+      DXGI_OUTPUT_DESC1 desc;
+
+      bench::Timer descTimer;
+      output->GetDesc1(&desc);
+      stats.getDesc.add(descTimer.elapsedUs());
+    }
+  }
+}
+
+/**
+ * \brief Measures concurrent enumeration
+ *
+ * Runs full enumeration passes on an increasing number
+ * of threads, all released at the same time, either on
+ * one shared factory or on a new factory per pass. The
+ * slowdown of a pass relative to the single-threaded
+ * run shows how much the threads contend.
+ * \param [in] maxThreads Highest thread count to test
+ * \param [in] iterations Enumeration passes per thread
+ * \returns Process exit code
+ */
+int runFanout(uint32_t maxThreads, uint32_t iterations) {
+  double baseUs[2] = { };
+
+  // Powers of two, plus the requested maximum
+  for (uint32_t threadCount = 1; threadCount <= maxThreads;
+       threadCount = (threadCount < maxThreads && 2 * threadCount > maxThreads) ? maxThreads : 2 * threadCount) {
+    for (uint32_t recreate = 0; recreate < 2; recreate++) {
+      Com<IDXGIFactory1> sharedFactory;
+
+      if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&sharedFactory)))) {
+        std::cerr << "Failed to create DXGI factory" << std::endl;
+        return 1;
+      }
+
+      EnumStats stats;
+      std::mutex statsMutex;
+      std::atomic<uint32_t> ready = { 0 };
+      std::atomic<bool> failed = { false };
+
+      auto worker = [&] {
+        EnumStats local;
+
+        // Spin until all threads exist so that
+        // they actually hit DXGI concurrently
+        ready += 1;
+
+        while (ready.load() < threadCount)
+          std::this_thread::yield();
+
+        for (uint32_t n = 0; n < iterations; n++) {
+          bench::Timer passTimer;
+
+          // Use the shared factory without taking a reference,
+          // so that threads only contend inside DXGI itself
+          IDXGIFactory1*     factory = sharedFactory.ptr();
+          Com<IDXGIFactory1> ownFactory;
+
+          if (recreate) {
+            bench::Timer factoryTimer;
+            HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&ownFactory));
+            local.createFactory.add(factoryTimer.elapsedUs());
+
+            if (FAILED(hr)) {
+              failed = true;
+              return;
+            }
+
+            factory = ownFactory.ptr();
+          }
+
+          enumerateOnce(factory, local);
+          local.pass.add(passTimer.elapsedUs());
+        }
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.add(local);
+      };
+
+      bench::Timer timer;
+      std::vector<std::thread> threads;
+
+      for (uint32_t i = 0; i < threadCount; i++)
+        threads.emplace_back(worker);
+
+      for (auto& thread : threads)
+        thread.join();
+
+      double totalUs = timer.elapsedUs();
+
+      if (failed) {
+        std::cerr << "Failed to create DXGI factory" << std::endl;
+        return 1;
+      }
+
+      double passUs = stats.pass.percentile(0.5);
+
+      if (threadCount == 1)
+        baseUs[recreate] = passUs;
+
+      std::cout << threadCount << (threadCount == 1 ? " thread, " : " threads, ")
+                << (recreate ? "new factory per pass" : "shared factory") << ": "
+                << std::fixed << std::setprecision(1)
+                << (1000000.0 * double(stats.pass.count()) / totalUs) << " passes/s, slowdown "
+                << std::setprecision(2) << (passUs / baseUs[recreate]) << "x" << std::endl;
+
+      if (recreate)
+        std::cout << "  CreateDXGIFactory1: " << stats.createFactory << std::endl;
+
+      std::cout << "  EnumAdapters1:      " << stats.enumAdapters << std::endl
+                << "  EnumOutputs:        " << stats.enumOutputs << std::endl
+                << "  GetDesc1:           " << stats.getDesc << std::endl
+                << "  Pass:               " << stats.pass << std::endl;
+    }
+  }
+
+  return 0;
+}
+
 int main(int argc, char **argv) {
+  bool     benchmark  = false;
+  bool     validate   = false;
+  bool     fanout     = false;
+  uint32_t threads    = std::max(std::thread::hardware_concurrency(), 1u);
+  uint32_t iterations = 10;
+  uint32_t queries    = 4096;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "--bench") {
+      benchmark = true;
+    } else if (arg == "--validate") {
+      validate = true;
+    } else if (arg == "--fanout") {
+      fanout = true;
+    } else if (i + 1 < argc && arg == "--threads") {
+      threads = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--iterations") {
+      iterations = std::stoul(argv[++i]);
+    } else if (i + 1 < argc && arg == "--queries") {
+      queries = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: dxgi-adapters [--bench [--iterations n]] [--validate [--queries n]]" << std::endl
+                << "       dxgi-adapters --fanout [--threads n] [--iterations n]" << std::endl;
+      return 1;
+    }
+  }
+
+  if (benchmark)
+    return runBench(std::max(iterations, 1u));
+
+  if (validate)
+    return runValidate(std::max(queries, 1u));
+
+  if (fanout)
+    return runFanout(std::max(threads, 1u), std::max(iterations, 1u));
+
   Com<IDXGIFactory1> factory;
   
   if (CreateDXGIFactory1(__uuidof(IDXGIFactory1),
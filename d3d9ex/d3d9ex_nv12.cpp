@@ -6,11 +6,12 @@
 #include <d3d9.h>
 #include <d3dcompiler.h>
 
+#include "../common/asset.h"
 #include "../common/com.h"
 #include "../common/error.h"
 #include "../common/str.h"
 
-#include "d3d9ex_nv12.yuv.h"
+#include "d3d9ex_nv12_yuv.h"
 
 struct Extent2D {
   uint32_t w, h;
@@ -197,10 +198,14 @@ public:
 
     Com<IDirect3DSurface9> nv12Surf;
     status = m_device->CreateOffscreenPlainSurface(imageSize, imageSize, (D3DFORMAT)MAKEFOURCC('N', 'V', '1', '2'), D3DPOOL_DEFAULT, &nv12Surf, nullptr);
+
+    if (!test_d3d9_nv12_yuv.data())
+      throw Error("Failed to decode NV12 image");
+
     D3DLOCKED_RECT rect;
     nv12Surf->LockRect(&rect, nullptr, 0);
     char* dst = (char*)rect.pBits;
-    char* src = (char*)test_d3d9_nv12_yuv;
+    const char* src = (const char*)test_d3d9_nv12_yuv.data();
     for (uint32_t i = 0; i < imageSize; i++)
     {
       std::memcpy(dst, src, imageSize);
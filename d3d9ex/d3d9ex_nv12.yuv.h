@@ -1,12803 +0,0 @@
-unsigned char test_d3d9_nv12_yuv[] = {
-  0x7a, 0x78, 0x77, 0x75, 0x73, 0x72, 0x72, 0x70, 0x6f, 0x6f, 0x6e, 0x6d,
-  0x6d, 0x6d, 0x6c, 0x6c, 0x6a, 0x69, 0x6a, 0x6b, 0x6b, 0x6a, 0x69, 0x69,
-  0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x6a, 0x70, 0x76, 0x7a, 0x80, 0x87,
-  0x89, 0x8a, 0x8a, 0x8c, 0x8d, 0x8a, 0x87, 0x86, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x81,
-  0x7f, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x77, 0x76, 0x75, 0x74, 0x72, 0x72,
-  0x74, 0x76, 0x76, 0x77, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x83,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7b, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x82,
-  0x84, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x7f,
-  0x7d, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x81,
-  0x82, 0x83, 0x84, 0x84, 0x85, 0x87, 0x86, 0x87, 0x89, 0x8a, 0x8a, 0x8a,
-  0x8b, 0x8d, 0x8d, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x90, 0x8f,
-  0x90, 0x92, 0x93, 0x93, 0x93, 0x95, 0x96, 0x95, 0x95, 0x98, 0x99, 0x99,
-  0x9a, 0x9b, 0x9a, 0x9d, 0x9e, 0x9e, 0x9e, 0x9d, 0x9e, 0xa1, 0xa2, 0xa2,
-  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1, 0x9f, 0x9d, 0x9c, 0x9c, 0x9a,
-  0x97, 0x96, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94,
-  0x94, 0x94, 0x94, 0x94, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x91, 0x92,
-  0x92, 0x92, 0x92, 0x91, 0x91, 0x94, 0x94, 0x93, 0x92, 0x92, 0x90, 0x8f,
-  0x91, 0x91, 0x90, 0x8f, 0x90, 0x8f, 0x8d, 0x8a, 0x87, 0x85, 0x84, 0x84,
-  0x83, 0x84, 0x88, 0x8a, 0x89, 0x88, 0x85, 0x7d, 0x71, 0x69, 0x65, 0x62,
-  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x64, 0x63, 0x62, 0x63,
-  0x63, 0x62, 0x60, 0x5f, 0x5d, 0x5a, 0x59, 0x56, 0x52, 0x4f, 0x4d, 0x4c,
-  0x47, 0x41, 0x3c, 0x39, 0x36, 0x30, 0x27, 0x1d, 0x17, 0x14, 0x12, 0x12,
-  0x11, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x12, 0x13, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x11, 0x12, 0x13, 0x13, 0x13, 0x14, 0x79, 0x76, 0x75, 0x74,
-  0x72, 0x71, 0x71, 0x71, 0x70, 0x6f, 0x6e, 0x6e, 0x6e, 0x6d, 0x6c, 0x6d,
-  0x6d, 0x6c, 0x6c, 0x6b, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x6a, 0x69, 0x6a,
-  0x6a, 0x6a, 0x6e, 0x76, 0x7a, 0x7d, 0x82, 0x87, 0x8a, 0x8c, 0x8d, 0x8e,
-  0x8d, 0x8a, 0x89, 0x88, 0x86, 0x87, 0x86, 0x86, 0x86, 0x87, 0x88, 0x88,
-  0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x82, 0x81, 0x7e, 0x7c, 0x7b, 0x7a,
-  0x79, 0x78, 0x76, 0x75, 0x75, 0x74, 0x73, 0x74, 0x76, 0x77, 0x79, 0x79,
-  0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x84, 0x84, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x81, 0x82, 0x83, 0x83, 0x84,
-  0x85, 0x87, 0x86, 0x87, 0x88, 0x8a, 0x8a, 0x8a, 0x8b, 0x8d, 0x8d, 0x8c,
-  0x8d, 0x8e, 0x8e, 0x8e, 0x90, 0x90, 0x91, 0x90, 0x90, 0x91, 0x92, 0x92,
-  0x93, 0x95, 0x95, 0x95, 0x95, 0x97, 0x98, 0x98, 0x98, 0x99, 0x9c, 0x9c,
-  0x9c, 0x9d, 0x9e, 0x9d, 0x9e, 0xa0, 0xa1, 0xa1, 0xa3, 0xa4, 0xa4, 0xa4,
-  0xa4, 0xa3, 0xa1, 0x9f, 0x9d, 0x9c, 0x9c, 0x9a, 0x97, 0x96, 0x95, 0x94,
-  0x95, 0x94, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
-  0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x91, 0x92, 0x92, 0x94, 0x93, 0x92,
-  0x92, 0x91, 0x92, 0x91, 0x91, 0x90, 0x8e, 0x8e, 0x90, 0x90, 0x91, 0x91,
-  0x8f, 0x8f, 0x8e, 0x8b, 0x88, 0x86, 0x86, 0x85, 0x84, 0x86, 0x89, 0x8a,
-  0x89, 0x88, 0x84, 0x7c, 0x71, 0x69, 0x66, 0x64, 0x65, 0x65, 0x65, 0x64,
-  0x65, 0x65, 0x65, 0x66, 0x65, 0x65, 0x64, 0x62, 0x63, 0x63, 0x62, 0x60,
-  0x5c, 0x59, 0x58, 0x56, 0x52, 0x4e, 0x4d, 0x4c, 0x48, 0x43, 0x3e, 0x3b,
-  0x37, 0x31, 0x29, 0x20, 0x18, 0x16, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11,
-  0x10, 0x11, 0x10, 0x11, 0x12, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x13,
-  0x12, 0x12, 0x12, 0x14, 0x79, 0x77, 0x76, 0x75, 0x73, 0x71, 0x72, 0x71,
-  0x71, 0x6f, 0x6f, 0x6f, 0x6e, 0x6d, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c,
-  0x6b, 0x6b, 0x6a, 0x69, 0x6a, 0x6a, 0x6a, 0x69, 0x6a, 0x6b, 0x70, 0x79,
-  0x7e, 0x81, 0x83, 0x86, 0x8a, 0x8e, 0x8f, 0x8f, 0x8e, 0x8a, 0x89, 0x89,
-  0x87, 0x87, 0x87, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x88, 0x85,
-  0x84, 0x83, 0x82, 0x80, 0x7e, 0x7b, 0x7a, 0x79, 0x77, 0x76, 0x75, 0x76,
-  0x75, 0x74, 0x74, 0x75, 0x77, 0x78, 0x79, 0x79, 0x7b, 0x7d, 0x7e, 0x7f,
-  0x80, 0x82, 0x82, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x80, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x84, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7f, 0x82, 0x82, 0x83, 0x83, 0x84, 0x85, 0x87, 0x87, 0x87,
-  0x89, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
-  0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x91, 0x91, 0x93, 0x94, 0x94, 0x94, 0x94,
-  0x95, 0x97, 0x97, 0x97, 0x98, 0x99, 0x9b, 0x9c, 0x9d, 0x9d, 0x9e, 0x9e,
-  0x9f, 0xa1, 0xa1, 0xa2, 0xa3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1, 0x9f,
-  0x9e, 0x9c, 0x9b, 0x99, 0x97, 0x96, 0x95, 0x94, 0x93, 0x93, 0x92, 0x92,
-  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x92, 0x92, 0x92,
-  0x90, 0x90, 0x91, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x91, 0x91, 0x90,
-  0x8f, 0x90, 0x8e, 0x8d, 0x8f, 0x90, 0x91, 0x90, 0x91, 0x90, 0x8f, 0x8c,
-  0x88, 0x87, 0x87, 0x86, 0x86, 0x87, 0x8b, 0x8c, 0x8a, 0x88, 0x83, 0x7a,
-  0x71, 0x69, 0x66, 0x64, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x66, 0x67,
-  0x66, 0x65, 0x64, 0x62, 0x62, 0x62, 0x63, 0x60, 0x5c, 0x59, 0x58, 0x56,
-  0x52, 0x4f, 0x4c, 0x4b, 0x47, 0x43, 0x3f, 0x3b, 0x37, 0x32, 0x2a, 0x20,
-  0x18, 0x15, 0x13, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x11, 0x11,
-  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x13, 0x13, 0x13, 0x13,
-  0x7a, 0x77, 0x76, 0x76, 0x74, 0x71, 0x72, 0x72, 0x71, 0x6f, 0x6f, 0x6e,
-  0x6d, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6b, 0x6b, 0x6a, 0x6a,
-  0x6a, 0x6a, 0x6a, 0x69, 0x6a, 0x6c, 0x72, 0x7a, 0x7f, 0x81, 0x84, 0x87,
-  0x8b, 0x8e, 0x8f, 0x8f, 0x8e, 0x8b, 0x8a, 0x8a, 0x88, 0x88, 0x87, 0x88,
-  0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x85, 0x84, 0x83, 0x82, 0x80,
-  0x7d, 0x7a, 0x7a, 0x79, 0x77, 0x76, 0x75, 0x75, 0x75, 0x74, 0x74, 0x76,
-  0x77, 0x79, 0x79, 0x79, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b,
-  0x7a, 0x7b, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83, 0x84, 0x83, 0x82, 0x82,
-  0x83, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82,
-  0x82, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8a, 0x8b, 0x8b, 0x8c,
-  0x8c, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x90, 0x91, 0x93, 0x94, 0x94, 0x93, 0x94, 0x95, 0x96, 0x96, 0x96,
-  0x97, 0x99, 0x9a, 0x9c, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa0, 0xa0, 0xa1,
-  0xa2, 0xa4, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1, 0xa0, 0x9e, 0x9d, 0x9c, 0x99,
-  0x96, 0x95, 0x95, 0x93, 0x93, 0x93, 0x92, 0x92, 0x93, 0x94, 0x94, 0x94,
-  0x94, 0x94, 0x94, 0x94, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x90, 0x91,
-  0x91, 0x93, 0x92, 0x92, 0x92, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x8e, 0x8d,
-  0x8f, 0x90, 0x91, 0x90, 0x91, 0x90, 0x90, 0x8d, 0x89, 0x87, 0x87, 0x87,
-  0x86, 0x87, 0x8b, 0x8c, 0x8a, 0x88, 0x82, 0x79, 0x70, 0x69, 0x66, 0x65,
-  0x66, 0x67, 0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x67, 0x66, 0x65, 0x63,
-  0x62, 0x62, 0x63, 0x61, 0x5d, 0x5a, 0x59, 0x56, 0x53, 0x4f, 0x4d, 0x4b,
-  0x48, 0x44, 0x3f, 0x3b, 0x37, 0x33, 0x2b, 0x21, 0x18, 0x14, 0x12, 0x11,
-  0x11, 0x12, 0x12, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x14, 0x7a, 0x78, 0x77, 0x76,
-  0x75, 0x72, 0x72, 0x73, 0x72, 0x6f, 0x6e, 0x6e, 0x6e, 0x6d, 0x6e, 0x6d,
-  0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a,
-  0x6b, 0x6f, 0x75, 0x7c, 0x80, 0x82, 0x85, 0x88, 0x8d, 0x8f, 0x90, 0x8f,
-  0x8f, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x8b, 0x8b, 0x8a, 0x8a, 0x89,
-  0x8a, 0x8a, 0x89, 0x85, 0x83, 0x82, 0x81, 0x7e, 0x7b, 0x7a, 0x78, 0x78,
-  0x76, 0x76, 0x76, 0x77, 0x76, 0x76, 0x76, 0x77, 0x79, 0x7a, 0x7a, 0x7a,
-  0x7c, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81,
-  0x7f, 0x7e, 0x7e, 0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x78, 0x7a, 0x7a, 0x7b,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x83, 0x82,
-  0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83,
-  0x83, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x83, 0x83, 0x84, 0x84,
-  0x85, 0x86, 0x86, 0x87, 0x89, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8f,
-  0x8e, 0x8d, 0x8d, 0x8c, 0x8d, 0x8e, 0x8f, 0x8e, 0x8e, 0x8f, 0x91, 0x93,
-  0x93, 0x93, 0x93, 0x93, 0x94, 0x95, 0x96, 0x96, 0x97, 0x98, 0x99, 0x9a,
-  0x9b, 0x9c, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0xa1, 0xa1, 0xa3, 0xa3, 0xa3,
-  0xa3, 0xa3, 0xa2, 0xa0, 0x9e, 0x9e, 0x9c, 0x98, 0x96, 0x94, 0x93, 0x94,
-  0x93, 0x92, 0x92, 0x92, 0x92, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
-  0x92, 0x92, 0x92, 0x92, 0x91, 0x90, 0x90, 0x90, 0x91, 0x92, 0x93, 0x92,
-  0x92, 0x91, 0x91, 0x90, 0x90, 0x90, 0x8e, 0x8d, 0x8f, 0x90, 0x90, 0x90,
-  0x91, 0x91, 0x91, 0x8e, 0x8a, 0x88, 0x88, 0x88, 0x87, 0x88, 0x8b, 0x8c,
-  0x8a, 0x88, 0x82, 0x79, 0x6f, 0x68, 0x66, 0x65, 0x67, 0x67, 0x69, 0x69,
-  0x68, 0x69, 0x67, 0x67, 0x67, 0x67, 0x65, 0x65, 0x63, 0x63, 0x63, 0x62,
-  0x5e, 0x5b, 0x59, 0x57, 0x54, 0x51, 0x4e, 0x4c, 0x49, 0x45, 0x40, 0x3a,
-  0x37, 0x33, 0x2c, 0x22, 0x18, 0x14, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11,
-  0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x15, 0x7b, 0x79, 0x79, 0x78, 0x76, 0x74, 0x72, 0x72,
-  0x72, 0x6f, 0x6e, 0x6e, 0x6e, 0x6d, 0x6e, 0x6c, 0x6d, 0x6e, 0x6e, 0x6d,
-  0x6d, 0x6b, 0x6b, 0x6b, 0x6a, 0x69, 0x6a, 0x6b, 0x6d, 0x72, 0x79, 0x7f,
-  0x82, 0x83, 0x86, 0x8b, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8e, 0x8d, 0x8c,
-  0x8b, 0x8b, 0x8b, 0x8d, 0x8d, 0x8c, 0x8c, 0x89, 0x8a, 0x8a, 0x88, 0x84,
-  0x82, 0x81, 0x80, 0x7d, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x76, 0x77, 0x76,
-  0x77, 0x78, 0x78, 0x77, 0x79, 0x7a, 0x7b, 0x7b, 0x7d, 0x7f, 0x81, 0x83,
-  0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x80, 0x80, 0x7e, 0x7d, 0x7c, 0x7a,
-  0x7a, 0x7a, 0x79, 0x77, 0x77, 0x79, 0x7a, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x7f, 0x80, 0x80, 0x82, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x84, 0x84, 0x83,
-  0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7e, 0x80, 0x82, 0x82, 0x83, 0x85, 0x84, 0x85, 0x86, 0x86, 0x87,
-  0x89, 0x8b, 0x8c, 0x8c, 0x8b, 0x8c, 0x8e, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8f, 0x8f, 0x91, 0x91, 0x92, 0x91, 0x92,
-  0x93, 0x93, 0x95, 0x95, 0x95, 0x97, 0x97, 0x99, 0x9a, 0x9b, 0x9b, 0x9d,
-  0x9d, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa1, 0xa1, 0xa2, 0xa3, 0xa2, 0xa0,
-  0x9e, 0x9d, 0x9c, 0x98, 0x96, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93,
-  0x91, 0x91, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x92, 0x91, 0x92, 0x92,
-  0x90, 0x90, 0x90, 0x90, 0x93, 0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x90,
-  0x90, 0x90, 0x8e, 0x8d, 0x8f, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x90, 0x8e,
-  0x8c, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8c, 0x8c, 0x8a, 0x88, 0x83, 0x7a,
-  0x70, 0x68, 0x66, 0x66, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x68,
-  0x68, 0x68, 0x66, 0x65, 0x64, 0x64, 0x64, 0x62, 0x5e, 0x5c, 0x5a, 0x57,
-  0x54, 0x52, 0x4f, 0x4c, 0x49, 0x44, 0x41, 0x3b, 0x37, 0x31, 0x2c, 0x23,
-  0x19, 0x14, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x12, 0x12, 0x11, 0x11, 0x11, 0x10, 0x11, 0x12, 0x14, 0x15,
-  0x7b, 0x79, 0x79, 0x78, 0x76, 0x74, 0x73, 0x72, 0x71, 0x70, 0x6f, 0x6f,
-  0x6e, 0x6d, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d, 0x6e, 0x6c, 0x6c, 0x6d, 0x6c,
-  0x6b, 0x6a, 0x6a, 0x6d, 0x71, 0x76, 0x7d, 0x81, 0x82, 0x83, 0x88, 0x8d,
-  0x90, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8d, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x89, 0x88, 0x87, 0x86, 0x84, 0x82, 0x80, 0x7f, 0x7c,
-  0x7a, 0x78, 0x77, 0x76, 0x76, 0x77, 0x77, 0x76, 0x76, 0x77, 0x79, 0x79,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x77,
-  0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82,
-  0x82, 0x84, 0x84, 0x82, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x81, 0x80,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x86, 0x88, 0x87, 0x87, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8f, 0x8f, 0x8f, 0x8f, 0x90,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x91, 0x90, 0x90, 0x91, 0x93, 0x93, 0x94,
-  0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9a, 0x9b, 0x9d, 0x9d, 0x9d, 0x9e,
-  0xa0, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0xa0, 0x9f, 0x9e, 0x9c, 0x9a,
-  0x97, 0x96, 0x95, 0x94, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x94,
-  0x95, 0x95, 0x95, 0x94, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91,
-  0x93, 0x94, 0x93, 0x93, 0x93, 0x91, 0x91, 0x90, 0x90, 0x91, 0x90, 0x8e,
-  0x8e, 0x8f, 0x90, 0x8f, 0x90, 0x91, 0x90, 0x8e, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8b, 0x8c, 0x8d, 0x8c, 0x8a, 0x88, 0x83, 0x79, 0x6f, 0x69, 0x68, 0x69,
-  0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x69, 0x6a, 0x6a, 0x68, 0x67,
-  0x67, 0x66, 0x65, 0x62, 0x5f, 0x5d, 0x5b, 0x5a, 0x57, 0x52, 0x50, 0x4e,
-  0x4a, 0x46, 0x41, 0x3c, 0x38, 0x33, 0x2c, 0x24, 0x1a, 0x16, 0x13, 0x12,
-  0x11, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x12, 0x11, 0x12, 0x11, 0x13, 0x13, 0x14, 0x14, 0x7c, 0x7a, 0x79, 0x78,
-  0x76, 0x76, 0x75, 0x73, 0x72, 0x71, 0x70, 0x70, 0x6e, 0x6d, 0x6c, 0x6c,
-  0x6d, 0x6e, 0x6e, 0x6d, 0x6d, 0x6c, 0x6d, 0x6e, 0x6d, 0x6b, 0x6c, 0x71,
-  0x74, 0x7a, 0x80, 0x82, 0x83, 0x85, 0x8a, 0x8f, 0x91, 0x90, 0x90, 0x90,
-  0x90, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8a, 0x89,
-  0x87, 0x86, 0x85, 0x82, 0x81, 0x80, 0x7e, 0x7c, 0x79, 0x78, 0x77, 0x76,
-  0x77, 0x78, 0x78, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x7b,
-  0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x76, 0x76, 0x78, 0x7a, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7f, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x81, 0x81, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82,
-  0x81, 0x82, 0x81, 0x82, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x81, 0x83, 0x84, 0x85, 0x85,
-  0x87, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8d, 0x8d,
-  0x8d, 0x8c, 0x8d, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90,
-  0x90, 0x8f, 0x90, 0x90, 0x90, 0x92, 0x92, 0x93, 0x94, 0x96, 0x96, 0x97,
-  0x98, 0x99, 0x99, 0x9a, 0x9c, 0x9c, 0x9c, 0x9d, 0x9f, 0x9f, 0xa0, 0xa1,
-  0xa1, 0xa1, 0xa0, 0x9f, 0x9f, 0x9f, 0x9d, 0x9b, 0x97, 0x96, 0x96, 0x94,
-  0x92, 0x92, 0x92, 0x93, 0x93, 0x92, 0x92, 0x94, 0x95, 0x96, 0x96, 0x96,
-  0x94, 0x94, 0x93, 0x92, 0x93, 0x93, 0x92, 0x91, 0x93, 0x94, 0x93, 0x92,
-  0x92, 0x91, 0x91, 0x90, 0x90, 0x91, 0x91, 0x8e, 0x8e, 0x8e, 0x90, 0x90,
-  0x91, 0x91, 0x90, 0x8f, 0x8d, 0x8c, 0x8e, 0x8e, 0x8d, 0x8e, 0x8e, 0x8c,
-  0x8a, 0x87, 0x82, 0x79, 0x6f, 0x69, 0x68, 0x69, 0x6b, 0x6c, 0x6b, 0x6b,
-  0x69, 0x69, 0x6a, 0x6a, 0x69, 0x69, 0x68, 0x68, 0x69, 0x67, 0x65, 0x63,
-  0x60, 0x5e, 0x5d, 0x5c, 0x58, 0x53, 0x51, 0x4f, 0x4a, 0x46, 0x43, 0x3d,
-  0x39, 0x34, 0x2c, 0x24, 0x1b, 0x16, 0x13, 0x11, 0x11, 0x10, 0x11, 0x11,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x13, 0x14, 0x13, 0x14, 0x7c, 0x7a, 0x79, 0x79, 0x77, 0x76, 0x75, 0x73,
-  0x72, 0x71, 0x70, 0x70, 0x6f, 0x6d, 0x6c, 0x6c, 0x6c, 0x6e, 0x6e, 0x6e,
-  0x6d, 0x6c, 0x6e, 0x6e, 0x6d, 0x6c, 0x6e, 0x72, 0x76, 0x7b, 0x82, 0x83,
-  0x84, 0x87, 0x8c, 0x90, 0x91, 0x90, 0x90, 0x91, 0x91, 0x8f, 0x8f, 0x8f,
-  0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x8a, 0x88, 0x86, 0x86, 0x84, 0x82,
-  0x80, 0x7f, 0x7e, 0x7b, 0x78, 0x77, 0x76, 0x77, 0x78, 0x78, 0x78, 0x77,
-  0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7a, 0x7a, 0x79, 0x78, 0x78,
-  0x76, 0x75, 0x75, 0x75, 0x78, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x80, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x82,
-  0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x81, 0x83, 0x84, 0x85, 0x85, 0x87, 0x88, 0x88, 0x88,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x90,
-  0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x90,
-  0x90, 0x91, 0x90, 0x92, 0x93, 0x95, 0x96, 0x97, 0x97, 0x97, 0x98, 0x9a,
-  0x9c, 0x9c, 0x9b, 0x9c, 0x9e, 0x9e, 0xa0, 0xa0, 0xa1, 0xa0, 0xa0, 0x9f,
-  0x9f, 0x9f, 0x9d, 0x9b, 0x97, 0x96, 0x95, 0x94, 0x92, 0x92, 0x92, 0x93,
-  0x93, 0x92, 0x92, 0x94, 0x95, 0x96, 0x96, 0x96, 0x95, 0x94, 0x94, 0x93,
-  0x93, 0x93, 0x92, 0x91, 0x93, 0x94, 0x93, 0x93, 0x93, 0x91, 0x91, 0x90,
-  0x90, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x91, 0x8f,
-  0x8e, 0x8d, 0x8e, 0x8e, 0x8e, 0x8f, 0x8f, 0x8c, 0x89, 0x86, 0x81, 0x79,
-  0x6f, 0x69, 0x68, 0x69, 0x6b, 0x6c, 0x6b, 0x6a, 0x69, 0x69, 0x6a, 0x6a,
-  0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x64, 0x63, 0x61, 0x5f, 0x5e, 0x5c,
-  0x58, 0x54, 0x51, 0x4f, 0x4b, 0x46, 0x43, 0x3e, 0x3a, 0x35, 0x2d, 0x24,
-  0x1b, 0x16, 0x13, 0x11, 0x10, 0x11, 0x11, 0x12, 0x10, 0x10, 0x10, 0x10,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x14, 0x14, 0x13, 0x14,
-  0x7d, 0x7b, 0x79, 0x78, 0x78, 0x77, 0x75, 0x75, 0x73, 0x72, 0x71, 0x71,
-  0x6f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6e, 0x6f, 0x6e, 0x6d, 0x6e, 0x6d, 0x6d,
-  0x6e, 0x6d, 0x6f, 0x75, 0x79, 0x7e, 0x82, 0x83, 0x86, 0x89, 0x8c, 0x90,
-  0x91, 0x90, 0x90, 0x91, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e,
-  0x8d, 0x8b, 0x89, 0x87, 0x86, 0x85, 0x84, 0x81, 0x7f, 0x7d, 0x7c, 0x7a,
-  0x79, 0x76, 0x76, 0x76, 0x78, 0x79, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7b,
-  0x7b, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x81, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7b, 0x78, 0x78, 0x78, 0x77, 0x77, 0x75, 0x74, 0x74, 0x75,
-  0x78, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7f, 0x7f, 0x80, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x84, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x82, 0x83, 0x81, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82,
-  0x84, 0x84, 0x85, 0x85, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8c,
-  0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x90,
-  0x90, 0x90, 0x90, 0x8e, 0x8f, 0x90, 0x90, 0x8f, 0x8f, 0x90, 0x90, 0x92,
-  0x92, 0x94, 0x96, 0x97, 0x96, 0x96, 0x98, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b,
-  0x9d, 0x9d, 0x9f, 0x9f, 0xa0, 0x9f, 0xa0, 0x9f, 0x9f, 0x9e, 0x9c, 0x99,
-  0x97, 0x97, 0x96, 0x95, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x95,
-  0x95, 0x95, 0x96, 0x96, 0x95, 0x95, 0x94, 0x93, 0x94, 0x93, 0x92, 0x91,
-  0x92, 0x94, 0x94, 0x94, 0x94, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x8f, 0x91,
-  0x91, 0x91, 0x91, 0x90, 0x91, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x90, 0x90, 0x8c, 0x89, 0x85, 0x80, 0x77, 0x6e, 0x68, 0x67, 0x68,
-  0x6b, 0x6c, 0x6a, 0x69, 0x69, 0x69, 0x6a, 0x69, 0x69, 0x6a, 0x6a, 0x69,
-  0x69, 0x68, 0x65, 0x64, 0x62, 0x61, 0x5f, 0x5e, 0x59, 0x55, 0x50, 0x4e,
-  0x4b, 0x47, 0x43, 0x3f, 0x3b, 0x36, 0x2e, 0x25, 0x1c, 0x17, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x13,
-  0x13, 0x11, 0x12, 0x13, 0x12, 0x12, 0x13, 0x13, 0x7d, 0x7b, 0x7a, 0x79,
-  0x77, 0x76, 0x74, 0x74, 0x73, 0x72, 0x71, 0x72, 0x70, 0x6f, 0x6e, 0x6e,
-  0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x6e, 0x73, 0x78,
-  0x7c, 0x7f, 0x83, 0x85, 0x88, 0x8b, 0x8e, 0x8e, 0x91, 0x91, 0x91, 0x91,
-  0x91, 0x90, 0x91, 0x91, 0x90, 0x91, 0x8f, 0x8e, 0x8d, 0x8a, 0x89, 0x87,
-  0x86, 0x85, 0x83, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a, 0x77, 0x76, 0x77,
-  0x79, 0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x77,
-  0x76, 0x77, 0x76, 0x74, 0x74, 0x74, 0x74, 0x76, 0x77, 0x7a, 0x7a, 0x7b,
-  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x83, 0x82,
-  0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x84, 0x84, 0x83,
-  0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x85,
-  0x87, 0x88, 0x89, 0x89, 0x8a, 0x8b, 0x8c, 0x8b, 0x8c, 0x8c, 0x8e, 0x8f,
-  0x8f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8e,
-  0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x95, 0x96,
-  0x96, 0x96, 0x98, 0x99, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9e,
-  0x9e, 0x9f, 0xa0, 0x9f, 0x9f, 0x9e, 0x9d, 0x9a, 0x99, 0x98, 0x98, 0x96,
-  0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x96,
-  0x96, 0x96, 0x95, 0x93, 0x94, 0x94, 0x93, 0x92, 0x93, 0x94, 0x94, 0x94,
-  0x94, 0x93, 0x92, 0x90, 0x8f, 0x8e, 0x8f, 0x91, 0x92, 0x92, 0x91, 0x90,
-  0x90, 0x8f, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x91, 0x90, 0x8c,
-  0x89, 0x86, 0x80, 0x77, 0x6e, 0x69, 0x68, 0x6a, 0x6c, 0x6c, 0x6b, 0x6b,
-  0x6d, 0x6d, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x69, 0x68, 0x66, 0x65,
-  0x62, 0x62, 0x61, 0x5e, 0x5a, 0x56, 0x51, 0x4f, 0x4b, 0x48, 0x43, 0x40,
-  0x3d, 0x38, 0x31, 0x27, 0x1e, 0x18, 0x14, 0x11, 0x12, 0x11, 0x11, 0x12,
-  0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x13, 0x13, 0x12, 0x13,
-  0x13, 0x13, 0x12, 0x14, 0x7e, 0x7b, 0x7b, 0x7a, 0x79, 0x77, 0x75, 0x75,
-  0x75, 0x74, 0x72, 0x71, 0x71, 0x70, 0x6f, 0x6e, 0x6f, 0x6e, 0x6f, 0x70,
-  0x6f, 0x6d, 0x6d, 0x6d, 0x6e, 0x6f, 0x76, 0x7c, 0x7f, 0x82, 0x84, 0x87,
-  0x8b, 0x8d, 0x8f, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93,
-  0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x8a, 0x88, 0x86, 0x85, 0x83, 0x82, 0x7f,
-  0x7d, 0x7b, 0x7a, 0x7a, 0x7a, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x81,
-  0x80, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x75, 0x74, 0x73, 0x73, 0x73,
-  0x73, 0x74, 0x74, 0x76, 0x76, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x84, 0x84, 0x84,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x83,
-  0x84, 0x84, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x81, 0x84, 0x84, 0x84, 0x85, 0x85, 0x87, 0x87, 0x88, 0x8a,
-  0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x8c, 0x8d, 0x8d, 0x8c,
-  0x8c, 0x8c, 0x8d, 0x8f, 0x8f, 0x91, 0x94, 0x95, 0x94, 0x95, 0x96, 0x98,
-  0x98, 0x99, 0x9a, 0x99, 0x9a, 0x99, 0x9b, 0x9d, 0x9d, 0x9d, 0x9e, 0x9f,
-  0x9f, 0x9e, 0x9d, 0x9c, 0x9a, 0x99, 0x99, 0x97, 0x94, 0x92, 0x92, 0x92,
-  0x93, 0x93, 0x94, 0x94, 0x94, 0x94, 0x95, 0x96, 0x96, 0x96, 0x94, 0x93,
-  0x94, 0x93, 0x93, 0x93, 0x92, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x92,
-  0x91, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x90,
-  0x91, 0x90, 0x8f, 0x8f, 0x91, 0x93, 0x91, 0x8c, 0x87, 0x84, 0x7e, 0x75,
-  0x6d, 0x6a, 0x6a, 0x6b, 0x6d, 0x6c, 0x6d, 0x6d, 0x6e, 0x6d, 0x6e, 0x6d,
-  0x6d, 0x6c, 0x6b, 0x6b, 0x6b, 0x6a, 0x67, 0x65, 0x63, 0x62, 0x62, 0x5f,
-  0x5a, 0x57, 0x53, 0x51, 0x4d, 0x49, 0x45, 0x41, 0x3f, 0x39, 0x32, 0x28,
-  0x20, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11,
-  0x12, 0x12, 0x11, 0x12, 0x13, 0x13, 0x11, 0x13, 0x13, 0x12, 0x13, 0x11,
-  0x7f, 0x7c, 0x7b, 0x7b, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72, 0x71,
-  0x70, 0x70, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x70, 0x6f, 0x6c, 0x6c, 0x6d,
-  0x6e, 0x71, 0x78, 0x7d, 0x80, 0x83, 0x85, 0x89, 0x8d, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x90, 0x91, 0x92, 0x93, 0x93, 0x93, 0x93, 0x91, 0x8f, 0x8e, 0x8d,
-  0x8b, 0x89, 0x87, 0x84, 0x83, 0x82, 0x80, 0x7e, 0x7b, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7c, 0x7b, 0x7b,
-  0x7a, 0x79, 0x77, 0x74, 0x73, 0x72, 0x72, 0x71, 0x72, 0x73, 0x74, 0x76,
-  0x76, 0x78, 0x7a, 0x7b, 0x7b, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x80,
-  0x82, 0x82, 0x82, 0x81, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x84, 0x84, 0x84, 0x82,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x83,
-  0x84, 0x84, 0x85, 0x85, 0x87, 0x88, 0x89, 0x8b, 0x8b, 0x8c, 0x8b, 0x8b,
-  0x8c, 0x8d, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90,
-  0x8f, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8e, 0x8f,
-  0x90, 0x91, 0x92, 0x94, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x99, 0x99,
-  0x98, 0x9a, 0x9a, 0x9b, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9c,
-  0x9b, 0x9a, 0x99, 0x98, 0x95, 0x94, 0x93, 0x93, 0x92, 0x92, 0x94, 0x94,
-  0x95, 0x94, 0x95, 0x95, 0x96, 0x96, 0x95, 0x94, 0x93, 0x94, 0x94, 0x94,
-  0x93, 0x93, 0x93, 0x94, 0x95, 0x94, 0x93, 0x92, 0x91, 0x91, 0x90, 0x92,
-  0x92, 0x92, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x91, 0x91, 0x91, 0x92,
-  0x92, 0x94, 0x91, 0x8c, 0x87, 0x83, 0x7c, 0x75, 0x6d, 0x6b, 0x6b, 0x6c,
-  0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6c, 0x6c, 0x6b,
-  0x6b, 0x6a, 0x67, 0x66, 0x63, 0x62, 0x62, 0x5e, 0x5c, 0x57, 0x55, 0x53,
-  0x50, 0x4b, 0x45, 0x42, 0x40, 0x3a, 0x32, 0x2a, 0x22, 0x1b, 0x14, 0x11,
-  0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11,
-  0x11, 0x12, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12, 0x7f, 0x7c, 0x7c, 0x7b,
-  0x79, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72, 0x71, 0x70, 0x70, 0x70, 0x6f,
-  0x70, 0x6f, 0x6f, 0x70, 0x6f, 0x6c, 0x6c, 0x6d, 0x6e, 0x73, 0x7a, 0x7f,
-  0x81, 0x83, 0x86, 0x8b, 0x8e, 0x90, 0x90, 0x8f, 0x8f, 0x90, 0x91, 0x93,
-  0x93, 0x93, 0x93, 0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x88, 0x86, 0x84,
-  0x82, 0x81, 0x7f, 0x7d, 0x7b, 0x7a, 0x7a, 0x7b, 0x7a, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x76, 0x74,
-  0x73, 0x72, 0x71, 0x70, 0x71, 0x73, 0x75, 0x76, 0x77, 0x78, 0x7a, 0x7a,
-  0x7a, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x84, 0x84, 0x84, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85,
-  0x87, 0x89, 0x89, 0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8c, 0x8d, 0x8d, 0x8e,
-  0x8e, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8e, 0x8d, 0x8d,
-  0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8d, 0x8f, 0x8f, 0x91, 0x91, 0x93,
-  0x94, 0x94, 0x96, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x9a,
-  0x9b, 0x9b, 0x9c, 0x9c, 0x9d, 0x9d, 0x9c, 0x9d, 0x9b, 0x9a, 0x9a, 0x98,
-  0x96, 0x95, 0x93, 0x92, 0x91, 0x91, 0x93, 0x94, 0x94, 0x95, 0x95, 0x94,
-  0x96, 0x96, 0x96, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x92, 0x93,
-  0x94, 0x94, 0x93, 0x91, 0x91, 0x91, 0x91, 0x92, 0x93, 0x93, 0x92, 0x92,
-  0x90, 0x8f, 0x8e, 0x8e, 0x91, 0x91, 0x92, 0x93, 0x93, 0x94, 0x91, 0x8c,
-  0x87, 0x83, 0x7c, 0x75, 0x6d, 0x6b, 0x6b, 0x6c, 0x6d, 0x6d, 0x6d, 0x6e,
-  0x6e, 0x6e, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x6b, 0x6a, 0x68, 0x67,
-  0x64, 0x63, 0x62, 0x5f, 0x5c, 0x58, 0x56, 0x55, 0x51, 0x4c, 0x46, 0x42,
-  0x40, 0x3a, 0x33, 0x2b, 0x21, 0x1c, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12, 0x11, 0x13,
-  0x13, 0x13, 0x12, 0x13, 0x80, 0x7d, 0x7d, 0x7c, 0x7a, 0x78, 0x78, 0x77,
-  0x76, 0x75, 0x73, 0x72, 0x71, 0x71, 0x72, 0x71, 0x71, 0x6f, 0x6e, 0x6f,
-  0x6f, 0x6d, 0x6c, 0x6d, 0x6f, 0x75, 0x7c, 0x81, 0x83, 0x85, 0x88, 0x8d,
-  0x90, 0x90, 0x8f, 0x8f, 0x8e, 0x8f, 0x90, 0x93, 0x93, 0x93, 0x93, 0x93,
-  0x91, 0x8e, 0x8c, 0x8b, 0x89, 0x87, 0x84, 0x83, 0x81, 0x80, 0x7e, 0x7d,
-  0x7a, 0x79, 0x79, 0x79, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-  0x7e, 0x7c, 0x7b, 0x79, 0x79, 0x77, 0x75, 0x73, 0x71, 0x70, 0x6f, 0x70,
-  0x72, 0x73, 0x75, 0x77, 0x77, 0x79, 0x79, 0x79, 0x7a, 0x7d, 0x7f, 0x80,
-  0x80, 0x80, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x83, 0x85, 0x85, 0x85, 0x85, 0x84,
-  0x85, 0x84, 0x84, 0x83, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x81, 0x82, 0x83, 0x85, 0x85, 0x85, 0x86, 0x86, 0x88, 0x8a, 0x8a, 0x8c,
-  0x8c, 0x8c, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x90, 0x90, 0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x8b,
-  0x8b, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x91, 0x92, 0x94, 0x95, 0x96,
-  0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99, 0x99, 0x9a, 0x9a, 0x9b,
-  0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9a, 0x9a, 0x99, 0x97, 0x96, 0x94, 0x93,
-  0x92, 0x92, 0x92, 0x93, 0x94, 0x95, 0x95, 0x95, 0x96, 0x97, 0x95, 0x96,
-  0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x92, 0x93, 0x94, 0x93, 0x93, 0x92,
-  0x91, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x90, 0x8f, 0x8e, 0x8f,
-  0x91, 0x92, 0x93, 0x93, 0x93, 0x93, 0x91, 0x8b, 0x86, 0x81, 0x7b, 0x74,
-  0x6d, 0x6c, 0x6c, 0x6d, 0x6e, 0x6d, 0x6e, 0x6f, 0x6f, 0x6e, 0x6e, 0x6d,
-  0x6d, 0x6c, 0x6c, 0x6b, 0x6b, 0x6a, 0x68, 0x68, 0x66, 0x65, 0x63, 0x60,
-  0x5d, 0x59, 0x57, 0x55, 0x52, 0x4d, 0x46, 0x42, 0x40, 0x3a, 0x34, 0x2b,
-  0x22, 0x1c, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11,
-  0x11, 0x12, 0x11, 0x13, 0x13, 0x11, 0x11, 0x12, 0x12, 0x12, 0x13, 0x11,
-  0x81, 0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73,
-  0x72, 0x72, 0x73, 0x72, 0x72, 0x71, 0x70, 0x71, 0x70, 0x6f, 0x6e, 0x6f,
-  0x70, 0x76, 0x7e, 0x83, 0x86, 0x87, 0x8a, 0x8d, 0x90, 0x90, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x90, 0x92, 0x94, 0x93, 0x92, 0x92, 0x91, 0x8e, 0x8c, 0x89,
-  0x88, 0x86, 0x84, 0x81, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7a, 0x79,
-  0x78, 0x76, 0x73, 0x71, 0x70, 0x6f, 0x6f, 0x70, 0x72, 0x74, 0x75, 0x77,
-  0x77, 0x78, 0x78, 0x79, 0x79, 0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x81, 0x81,
-  0x80, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x83, 0x82,
-  0x83, 0x82, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x83, 0x84, 0x85,
-  0x85, 0x85, 0x86, 0x86, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8e, 0x8e, 0x8f, 0x8e, 0x8e, 0x8f, 0x8f,
-  0x8f, 0x8e, 0x8d, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8c, 0x8d, 0x8e, 0x90, 0x92, 0x93, 0x93, 0x95, 0x96, 0x95, 0x95, 0x96,
-  0x97, 0x96, 0x97, 0x98, 0x99, 0x99, 0x99, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c,
-  0x9b, 0x99, 0x99, 0x99, 0x97, 0x96, 0x95, 0x94, 0x95, 0x94, 0x93, 0x93,
-  0x94, 0x95, 0x95, 0x95, 0x96, 0x96, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95,
-  0x95, 0x94, 0x92, 0x93, 0x94, 0x94, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93,
-  0x93, 0x93, 0x93, 0x92, 0x90, 0x8f, 0x8e, 0x8e, 0x90, 0x92, 0x93, 0x93,
-  0x94, 0x94, 0x8f, 0x89, 0x84, 0x80, 0x79, 0x72, 0x6d, 0x6c, 0x6d, 0x6e,
-  0x6e, 0x6e, 0x6f, 0x70, 0x70, 0x6e, 0x6f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6b,
-  0x6c, 0x6c, 0x6b, 0x69, 0x67, 0x66, 0x64, 0x62, 0x5f, 0x5a, 0x58, 0x56,
-  0x52, 0x4e, 0x49, 0x45, 0x41, 0x3b, 0x34, 0x2a, 0x21, 0x1b, 0x14, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x12, 0x13,
-  0x13, 0x13, 0x11, 0x12, 0x13, 0x13, 0x13, 0x11, 0x80, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x79, 0x7a, 0x79, 0x78, 0x74, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71,
-  0x71, 0x70, 0x70, 0x71, 0x71, 0x70, 0x6e, 0x6f, 0x71, 0x79, 0x81, 0x85,
-  0x86, 0x87, 0x8a, 0x8e, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x91,
-  0x92, 0x92, 0x92, 0x92, 0x91, 0x8e, 0x8c, 0x89, 0x87, 0x85, 0x81, 0x80,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0x7c, 0x7d, 0x7f, 0x7f, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7c, 0x7c, 0x7a, 0x78, 0x76, 0x74, 0x73, 0x70,
-  0x6f, 0x6f, 0x6f, 0x70, 0x72, 0x75, 0x76, 0x77, 0x77, 0x77, 0x78, 0x7a,
-  0x7b, 0x7b, 0x7c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x80,
-  0x81, 0x80, 0x81, 0x82, 0x81, 0x82, 0x84, 0x86, 0x86, 0x86, 0x85, 0x86,
-  0x87, 0x85, 0x85, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x83, 0x84, 0x84,
-  0x83, 0x82, 0x81, 0x82, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86,
-  0x88, 0x8a, 0x8b, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8d,
-  0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8e, 0x8f, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b,
-  0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8e, 0x8f,
-  0x90, 0x91, 0x93, 0x93, 0x93, 0x93, 0x94, 0x95, 0x96, 0x96, 0x96, 0x96,
-  0x96, 0x98, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9c, 0x9b, 0x9a, 0x9a, 0x99,
-  0x98, 0x96, 0x95, 0x95, 0x95, 0x94, 0x93, 0x94, 0x94, 0x94, 0x95, 0x94,
-  0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x94, 0x94, 0x95, 0x95, 0x94, 0x93,
-  0x93, 0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x93, 0x94, 0x94, 0x94, 0x92,
-  0x91, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x92, 0x94, 0x95, 0x93, 0x8f, 0x88,
-  0x83, 0x7f, 0x79, 0x71, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
-  0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6c, 0x6c, 0x6d, 0x6c, 0x6b, 0x6c, 0x6a,
-  0x67, 0x66, 0x65, 0x63, 0x5f, 0x5b, 0x58, 0x55, 0x50, 0x4c, 0x49, 0x46,
-  0x42, 0x3c, 0x35, 0x2b, 0x22, 0x1c, 0x15, 0x11, 0x11, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12,
-  0x12, 0x12, 0x12, 0x11, 0x80, 0x7e, 0x7d, 0x7d, 0x7c, 0x79, 0x79, 0x79,
-  0x78, 0x74, 0x73, 0x74, 0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x71,
-  0x71, 0x6f, 0x6e, 0x6f, 0x73, 0x7b, 0x82, 0x86, 0x87, 0x88, 0x8b, 0x90,
-  0x91, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x91, 0x92, 0x91, 0x91, 0x91,
-  0x90, 0x8c, 0x8b, 0x89, 0x86, 0x84, 0x81, 0x7f, 0x7d, 0x7c, 0x7c, 0x7d,
-  0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7c, 0x7a, 0x77, 0x76, 0x73, 0x72, 0x70, 0x6f, 0x6f, 0x70, 0x70,
-  0x72, 0x75, 0x76, 0x77, 0x77, 0x77, 0x78, 0x7a, 0x7b, 0x7b, 0x7c, 0x7e,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x81, 0x80, 0x81, 0x82,
-  0x81, 0x82, 0x84, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87,
-  0x85, 0x85, 0x84, 0x82, 0x83, 0x83, 0x84, 0x85, 0x84, 0x83, 0x82, 0x83,
-  0x84, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8c, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x8d, 0x8d,
-  0x8e, 0x8e, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x89,
-  0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8e, 0x8f, 0x8f, 0x90, 0x92, 0x93,
-  0x92, 0x92, 0x93, 0x94, 0x95, 0x94, 0x95, 0x95, 0x95, 0x97, 0x97, 0x98,
-  0x98, 0x99, 0x9a, 0x99, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x98, 0x97, 0x96,
-  0x97, 0x95, 0x95, 0x94, 0x94, 0x94, 0x96, 0x96, 0x95, 0x95, 0x96, 0x96,
-  0x96, 0x95, 0x94, 0x94, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x94, 0x94,
-  0x94, 0x94, 0x94, 0x93, 0x93, 0x94, 0x94, 0x92, 0x92, 0x91, 0x90, 0x8f,
-  0x90, 0x90, 0x92, 0x93, 0x94, 0x92, 0x8e, 0x87, 0x81, 0x7e, 0x78, 0x70,
-  0x6d, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x70, 0x70, 0x6f, 0x6f, 0x6e,
-  0x6d, 0x6c, 0x6c, 0x6d, 0x6c, 0x6b, 0x6c, 0x6b, 0x67, 0x66, 0x65, 0x63,
-  0x60, 0x5c, 0x59, 0x57, 0x52, 0x4d, 0x4b, 0x47, 0x43, 0x3c, 0x36, 0x2b,
-  0x23, 0x1d, 0x15, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x12, 0x13, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x13, 0x11,
-  0x81, 0x7e, 0x7d, 0x7c, 0x7c, 0x79, 0x79, 0x79, 0x78, 0x75, 0x73, 0x74,
-  0x73, 0x72, 0x72, 0x71, 0x71, 0x70, 0x70, 0x71, 0x71, 0x6f, 0x6f, 0x70,
-  0x73, 0x7c, 0x83, 0x86, 0x87, 0x89, 0x8c, 0x90, 0x91, 0x91, 0x90, 0x90,
-  0x8f, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x91, 0x90, 0x8f, 0x8c, 0x8b, 0x88,
-  0x86, 0x83, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7b, 0x79, 0x77,
-  0x75, 0x73, 0x71, 0x6f, 0x6f, 0x70, 0x70, 0x70, 0x73, 0x75, 0x76, 0x77,
-  0x77, 0x77, 0x78, 0x79, 0x7b, 0x7b, 0x7c, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e,
-  0x80, 0x80, 0x7f, 0x7f, 0x81, 0x80, 0x81, 0x82, 0x82, 0x82, 0x84, 0x86,
-  0x86, 0x86, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87,
-  0x87, 0x87, 0x87, 0x88, 0x8a, 0x8a, 0x8b, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8c, 0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8f, 0x8f, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x88, 0x89, 0x89, 0x8a,
-  0x8a, 0x8a, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93,
-  0x94, 0x93, 0x94, 0x94, 0x95, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99, 0x99,
-  0x9a, 0x9c, 0x9c, 0x9c, 0x9a, 0x99, 0x98, 0x97, 0x97, 0x96, 0x95, 0x94,
-  0x93, 0x94, 0x96, 0x97, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x95, 0x94,
-  0x95, 0x95, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93,
-  0x94, 0x94, 0x94, 0x93, 0x92, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x92, 0x93,
-  0x94, 0x91, 0x8d, 0x87, 0x81, 0x7d, 0x77, 0x70, 0x6d, 0x6e, 0x6f, 0x70,
-  0x70, 0x6f, 0x71, 0x71, 0x71, 0x70, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
-  0x6d, 0x6c, 0x6c, 0x6b, 0x68, 0x66, 0x65, 0x63, 0x61, 0x5d, 0x59, 0x57,
-  0x52, 0x4e, 0x4b, 0x47, 0x43, 0x3d, 0x36, 0x2b, 0x22, 0x1d, 0x15, 0x11,
-  0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x11, 0x81, 0x7e, 0x7d, 0x7c,
-  0x7c, 0x7a, 0x7a, 0x7a, 0x78, 0x76, 0x74, 0x75, 0x74, 0x73, 0x73, 0x71,
-  0x71, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x71, 0x74, 0x7d, 0x84, 0x88,
-  0x89, 0x8a, 0x8d, 0x91, 0x92, 0x92, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90,
-  0x91, 0x90, 0x90, 0x8f, 0x8d, 0x8c, 0x89, 0x87, 0x86, 0x83, 0x80, 0x7e,
-  0x7c, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7b, 0x7a, 0x78, 0x76, 0x74, 0x72, 0x71, 0x70,
-  0x70, 0x70, 0x71, 0x71, 0x73, 0x75, 0x77, 0x78, 0x79, 0x77, 0x78, 0x79,
-  0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x81, 0x83, 0x85, 0x86, 0x86, 0x85, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x83, 0x84, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88, 0x89,
-  0x8b, 0x8a, 0x8b, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8d, 0x8e,
-  0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c,
-  0x8c, 0x8a, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x89, 0x89, 0x8a, 0x8d, 0x8f,
-  0x8e, 0x8f, 0x90, 0x92, 0x92, 0x91, 0x91, 0x93, 0x93, 0x93, 0x94, 0x94,
-  0x94, 0x95, 0x96, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9b, 0x9c, 0x9c, 0x9c,
-  0x9b, 0x99, 0x98, 0x98, 0x97, 0x96, 0x95, 0x95, 0x94, 0x95, 0x97, 0x97,
-  0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x97, 0x95, 0x96, 0x96, 0x94, 0x93,
-  0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94,
-  0x92, 0x91, 0x90, 0x90, 0x90, 0x90, 0x92, 0x93, 0x93, 0x90, 0x8b, 0x86,
-  0x80, 0x7c, 0x76, 0x70, 0x6e, 0x6e, 0x70, 0x71, 0x71, 0x70, 0x71, 0x71,
-  0x70, 0x70, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6c, 0x6a,
-  0x69, 0x66, 0x65, 0x64, 0x61, 0x5c, 0x5a, 0x57, 0x53, 0x50, 0x4c, 0x48,
-  0x44, 0x3e, 0x37, 0x2d, 0x23, 0x1d, 0x15, 0x11, 0x11, 0x11, 0x11, 0x10,
-  0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11,
-  0x12, 0x12, 0x12, 0x13, 0x81, 0x7f, 0x7e, 0x7e, 0x7d, 0x7b, 0x7a, 0x79,
-  0x78, 0x78, 0x76, 0x76, 0x75, 0x75, 0x74, 0x73, 0x73, 0x72, 0x71, 0x6f,
-  0x6f, 0x70, 0x70, 0x71, 0x76, 0x7e, 0x85, 0x89, 0x8b, 0x8d, 0x8f, 0x91,
-  0x91, 0x91, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8e,
-  0x8d, 0x8a, 0x88, 0x86, 0x84, 0x82, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c,
-  0x7b, 0x79, 0x77, 0x75, 0x74, 0x72, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72,
-  0x73, 0x75, 0x76, 0x77, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x81, 0x84, 0x86, 0x86, 0x87, 0x86, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x86, 0x86, 0x85, 0x86, 0x85, 0x86, 0x86, 0x86, 0x86, 0x87, 0x86, 0x85,
-  0x86, 0x88, 0x88, 0x87, 0x89, 0x89, 0x88, 0x89, 0x8b, 0x8b, 0x8b, 0x8d,
-  0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d,
-  0x8e, 0x8e, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8b, 0x89, 0x87, 0x86,
-  0x87, 0x88, 0x89, 0x88, 0x89, 0x8b, 0x8c, 0x8d, 0x8d, 0x8e, 0x8f, 0x91,
-  0x91, 0x90, 0x90, 0x91, 0x91, 0x91, 0x92, 0x92, 0x92, 0x93, 0x95, 0x95,
-  0x96, 0x97, 0x98, 0x99, 0x9b, 0x9c, 0x9c, 0x9b, 0x99, 0x99, 0x99, 0x99,
-  0x99, 0x97, 0x97, 0x97, 0x97, 0x96, 0x97, 0x96, 0x97, 0x97, 0x97, 0x98,
-  0x98, 0x98, 0x97, 0x96, 0x97, 0x97, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95,
-  0x96, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x95, 0x93, 0x91, 0x91, 0x91,
-  0x91, 0x91, 0x92, 0x93, 0x93, 0x8e, 0x8a, 0x84, 0x7f, 0x7b, 0x76, 0x70,
-  0x6e, 0x6f, 0x70, 0x71, 0x70, 0x71, 0x72, 0x72, 0x71, 0x71, 0x71, 0x70,
-  0x70, 0x70, 0x6f, 0x6d, 0x6e, 0x6d, 0x6b, 0x6a, 0x6a, 0x68, 0x67, 0x66,
-  0x62, 0x5e, 0x5b, 0x58, 0x55, 0x51, 0x4c, 0x48, 0x45, 0x3f, 0x37, 0x2d,
-  0x23, 0x1c, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x12, 0x13, 0x14, 0x14,
-  0x82, 0x80, 0x80, 0x7f, 0x7e, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x77, 0x77,
-  0x76, 0x76, 0x75, 0x74, 0x74, 0x73, 0x72, 0x71, 0x70, 0x6f, 0x70, 0x72,
-  0x77, 0x7f, 0x86, 0x8a, 0x8c, 0x8d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8f,
-  0x8f, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x89, 0x87, 0x85,
-  0x83, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-  0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x76,
-  0x74, 0x72, 0x71, 0x73, 0x72, 0x73, 0x73, 0x74, 0x75, 0x76, 0x76, 0x77,
-  0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x84, 0x86, 0x86,
-  0x85, 0x86, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x86, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x89, 0x8a, 0x89,
-  0x8a, 0x8a, 0x89, 0x8b, 0x8c, 0x8d, 0x8d, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
-  0x8e, 0x8d, 0x8d, 0x8b, 0x89, 0x89, 0x87, 0x86, 0x86, 0x88, 0x89, 0x89,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x91,
-  0x91, 0x90, 0x91, 0x91, 0x91, 0x92, 0x95, 0x95, 0x96, 0x97, 0x98, 0x99,
-  0x9b, 0x9c, 0x9c, 0x9c, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x98, 0x98, 0x98,
-  0x98, 0x98, 0x97, 0x96, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x97, 0x96,
-  0x96, 0x97, 0x96, 0x95, 0x96, 0x94, 0x95, 0x95, 0x95, 0x94, 0x94, 0x95,
-  0x95, 0x95, 0x95, 0x95, 0x94, 0x93, 0x92, 0x93, 0x92, 0x91, 0x92, 0x93,
-  0x92, 0x8d, 0x89, 0x83, 0x7d, 0x7a, 0x75, 0x70, 0x6e, 0x6f, 0x70, 0x71,
-  0x6f, 0x70, 0x72, 0x72, 0x73, 0x71, 0x72, 0x71, 0x71, 0x70, 0x6f, 0x6e,
-  0x6e, 0x6d, 0x6c, 0x6a, 0x6a, 0x68, 0x67, 0x65, 0x63, 0x5f, 0x5b, 0x59,
-  0x56, 0x52, 0x4e, 0x4a, 0x46, 0x40, 0x37, 0x2d, 0x23, 0x1c, 0x14, 0x11,
-  0x12, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x12, 0x11,
-  0x11, 0x11, 0x10, 0x11, 0x12, 0x13, 0x14, 0x13, 0x82, 0x80, 0x80, 0x7f,
-  0x7d, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x77, 0x76, 0x75, 0x76, 0x74,
-  0x74, 0x73, 0x72, 0x71, 0x72, 0x71, 0x71, 0x73, 0x78, 0x81, 0x88, 0x8b,
-  0x8c, 0x8e, 0x92, 0x93, 0x92, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8e, 0x8e, 0x8c, 0x89, 0x86, 0x84, 0x84, 0x82, 0x81, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7b, 0x79, 0x77, 0x77, 0x75, 0x74, 0x74, 0x75,
-  0x74, 0x74, 0x74, 0x75, 0x76, 0x76, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x86, 0x86, 0x86, 0x88, 0x89, 0x89,
-  0x89, 0x89, 0x89, 0x89, 0x88, 0x86, 0x86, 0x87, 0x88, 0x87, 0x87, 0x88,
-  0x8a, 0x8a, 0x8a, 0x88, 0x89, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b,
-  0x8c, 0x8c, 0x8c, 0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8d,
-  0x8d, 0x8c, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8a, 0x88, 0x87, 0x87, 0x86, 0x87, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8b,
-  0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x90,
-  0x91, 0x92, 0x94, 0x94, 0x96, 0x96, 0x97, 0x98, 0x9a, 0x9b, 0x9c, 0x9d,
-  0x9c, 0x9d, 0x9c, 0x9c, 0x99, 0x99, 0x98, 0x97, 0x97, 0x97, 0x98, 0x99,
-  0x99, 0x99, 0x98, 0x97, 0x97, 0x98, 0x98, 0x97, 0x97, 0x98, 0x97, 0x97,
-  0x97, 0x95, 0x96, 0x95, 0x94, 0x94, 0x94, 0x96, 0x96, 0x96, 0x95, 0x95,
-  0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x92, 0x8e, 0x8a, 0x82,
-  0x7e, 0x79, 0x74, 0x6f, 0x6f, 0x70, 0x70, 0x71, 0x70, 0x71, 0x71, 0x72,
-  0x73, 0x72, 0x72, 0x72, 0x71, 0x70, 0x6f, 0x6f, 0x6e, 0x6d, 0x6e, 0x6c,
-  0x6a, 0x68, 0x67, 0x66, 0x62, 0x60, 0x5c, 0x59, 0x56, 0x53, 0x4d, 0x48,
-  0x46, 0x41, 0x39, 0x2e, 0x23, 0x1d, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x13, 0x12, 0x12, 0x12, 0x11, 0x11,
-  0x12, 0x13, 0x13, 0x14, 0x82, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x7b, 0x7a,
-  0x79, 0x79, 0x78, 0x77, 0x76, 0x75, 0x76, 0x75, 0x74, 0x73, 0x72, 0x71,
-  0x72, 0x71, 0x71, 0x73, 0x79, 0x82, 0x88, 0x8b, 0x8c, 0x8f, 0x92, 0x94,
-  0x93, 0x91, 0x90, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
-  0x8c, 0x88, 0x85, 0x84, 0x84, 0x82, 0x82, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7c, 0x7c, 0x7d,
-  0x7a, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76,
-  0x76, 0x77, 0x78, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7c, 0x7c, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81,
-  0x83, 0x84, 0x85, 0x86, 0x86, 0x88, 0x89, 0x89, 0x88, 0x89, 0x89, 0x8a,
-  0x88, 0x86, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8a, 0x89,
-  0x89, 0x8b, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
-  0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8c, 0x8d,
-  0x8e, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x88, 0x87, 0x87,
-  0x86, 0x86, 0x88, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8b, 0x8b, 0x8c, 0x8e,
-  0x8f, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x91, 0x93, 0x94,
-  0x96, 0x96, 0x97, 0x98, 0x9a, 0x9a, 0x9b, 0x9d, 0x9d, 0x9d, 0x9c, 0x9c,
-  0x9a, 0x9a, 0x98, 0x97, 0x96, 0x97, 0x99, 0x99, 0x9a, 0x9a, 0x98, 0x98,
-  0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x96, 0x97, 0x95,
-  0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x96, 0x94, 0x93, 0x93, 0x93,
-  0x93, 0x92, 0x93, 0x93, 0x92, 0x8e, 0x89, 0x82, 0x7d, 0x79, 0x73, 0x6e,
-  0x6e, 0x6f, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x73, 0x73, 0x73, 0x72,
-  0x70, 0x70, 0x6f, 0x6f, 0x6d, 0x6d, 0x6e, 0x6d, 0x6a, 0x68, 0x67, 0x66,
-  0x62, 0x60, 0x5c, 0x59, 0x56, 0x52, 0x4d, 0x49, 0x46, 0x42, 0x3a, 0x2e,
-  0x24, 0x1e, 0x16, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11,
-  0x10, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x15,
-  0x82, 0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x7a, 0x79, 0x78, 0x79, 0x77, 0x77,
-  0x76, 0x76, 0x77, 0x76, 0x74, 0x73, 0x73, 0x72, 0x72, 0x70, 0x71, 0x73,
-  0x79, 0x82, 0x88, 0x8c, 0x8d, 0x8f, 0x92, 0x93, 0x93, 0x91, 0x90, 0x91,
-  0x90, 0x8f, 0x8e, 0x8e, 0x8f, 0x8e, 0x8e, 0x8d, 0x8c, 0x88, 0x85, 0x84,
-  0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x78, 0x76, 0x76,
-  0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x76, 0x75, 0x75, 0x77, 0x78, 0x79,
-  0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x87,
-  0x86, 0x87, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x88, 0x87, 0x88, 0x89,
-  0x89, 0x89, 0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8b, 0x8b, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8b, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d,
-  0x8c, 0x8c, 0x8b, 0x8c, 0x8b, 0x88, 0x88, 0x87, 0x87, 0x86, 0x87, 0x88,
-  0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8b, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x92, 0x93, 0x95, 0x96, 0x98, 0x98,
-  0x9a, 0x9a, 0x9b, 0x9d, 0x9d, 0x9c, 0x9c, 0x9b, 0x9b, 0x9b, 0x99, 0x98,
-  0x97, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x99, 0x98, 0x97, 0x97, 0x97, 0x98,
-  0x98, 0x98, 0x98, 0x98, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95,
-  0x95, 0x96, 0x96, 0x96, 0x95, 0x93, 0x92, 0x93, 0x93, 0x92, 0x92, 0x92,
-  0x91, 0x8d, 0x88, 0x81, 0x7c, 0x78, 0x72, 0x6d, 0x6d, 0x6e, 0x6e, 0x6f,
-  0x70, 0x71, 0x71, 0x71, 0x73, 0x74, 0x72, 0x71, 0x71, 0x71, 0x71, 0x70,
-  0x6d, 0x6d, 0x6d, 0x6d, 0x6a, 0x68, 0x67, 0x66, 0x63, 0x60, 0x5c, 0x59,
-  0x56, 0x52, 0x4d, 0x49, 0x46, 0x42, 0x3a, 0x2f, 0x24, 0x1e, 0x16, 0x11,
-  0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x12, 0x11,
-  0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x14, 0x82, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7b, 0x79, 0x79, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x77, 0x74,
-  0x74, 0x74, 0x73, 0x72, 0x72, 0x71, 0x71, 0x73, 0x7a, 0x83, 0x8a, 0x8d,
-  0x8e, 0x8f, 0x92, 0x93, 0x92, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8e, 0x8e,
-  0x8f, 0x8e, 0x8c, 0x8b, 0x8a, 0x89, 0x86, 0x85, 0x84, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7e,
-  0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x80, 0x81, 0x80, 0x7f,
-  0x7f, 0x7d, 0x7c, 0x7c, 0x7a, 0x79, 0x77, 0x76, 0x76, 0x75, 0x75, 0x77,
-  0x77, 0x77, 0x77, 0x76, 0x76, 0x78, 0x78, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88, 0x89, 0x89,
-  0x89, 0x8a, 0x8b, 0x8b, 0x88, 0x87, 0x88, 0x8a, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8d, 0x8d, 0x8c, 0x8c, 0x8d, 0x8d,
-  0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8d,
-  0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8d, 0x8d, 0x8c, 0x8b, 0x8c,
-  0x8a, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86, 0x87, 0x88, 0x88, 0x8a, 0x8a,
-  0x89, 0x89, 0x8a, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8e, 0x8e, 0x8f,
-  0x8f, 0x8f, 0x91, 0x93, 0x95, 0x96, 0x97, 0x98, 0x9a, 0x9a, 0x9b, 0x9d,
-  0x9e, 0x9d, 0x9b, 0x9b, 0x9b, 0x9c, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x99,
-  0x9a, 0x9a, 0x99, 0x99, 0x98, 0x98, 0x98, 0x97, 0x98, 0x98, 0x97, 0x97,
-  0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x97, 0x98, 0x97,
-  0x95, 0x95, 0x95, 0x94, 0x93, 0x94, 0x93, 0x93, 0x91, 0x8c, 0x86, 0x7f,
-  0x7a, 0x76, 0x71, 0x6d, 0x6e, 0x6d, 0x6e, 0x70, 0x71, 0x71, 0x72, 0x72,
-  0x73, 0x73, 0x73, 0x71, 0x70, 0x71, 0x71, 0x71, 0x6f, 0x6e, 0x6e, 0x6d,
-  0x6b, 0x67, 0x66, 0x66, 0x63, 0x61, 0x5e, 0x5b, 0x57, 0x53, 0x4e, 0x4a,
-  0x47, 0x43, 0x3b, 0x2e, 0x23, 0x1d, 0x16, 0x11, 0x10, 0x11, 0x11, 0x10,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x12, 0x11,
-  0x11, 0x12, 0x13, 0x12, 0x83, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7d, 0x7b,
-  0x7a, 0x7a, 0x79, 0x79, 0x77, 0x76, 0x77, 0x75, 0x75, 0x73, 0x72, 0x71,
-  0x72, 0x71, 0x70, 0x72, 0x79, 0x83, 0x8b, 0x8e, 0x8f, 0x90, 0x92, 0x93,
-  0x91, 0x91, 0x90, 0x91, 0x90, 0x8f, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8a, 0x89, 0x88, 0x86, 0x86, 0x85, 0x85, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x80, 0x7d, 0x7d, 0x7d,
-  0x7b, 0x7a, 0x78, 0x77, 0x77, 0x76, 0x77, 0x78, 0x79, 0x79, 0x78, 0x78,
-  0x78, 0x79, 0x79, 0x79, 0x7b, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x80, 0x82, 0x82, 0x83,
-  0x85, 0x85, 0x87, 0x88, 0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x8c, 0x8c,
-  0x8a, 0x89, 0x88, 0x89, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d,
-  0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8e, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8c, 0x8c, 0x8d, 0x8e, 0x8d, 0x8c,
-  0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8a, 0x87, 0x88, 0x87,
-  0x86, 0x86, 0x86, 0x87, 0x88, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-  0x8c, 0x8c, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8f, 0x8f, 0x90, 0x92, 0x94,
-  0x95, 0x96, 0x97, 0x97, 0x99, 0x9b, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-  0x9c, 0x9c, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0x9a, 0x99, 0x99, 0x99, 0x99,
-  0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x99,
-  0x99, 0x99, 0x98, 0x96, 0x96, 0x97, 0x98, 0x98, 0x95, 0x96, 0x96, 0x95,
-  0x93, 0x94, 0x93, 0x92, 0x8f, 0x8a, 0x85, 0x7e, 0x78, 0x74, 0x70, 0x6e,
-  0x6e, 0x6e, 0x6d, 0x6e, 0x70, 0x70, 0x72, 0x73, 0x73, 0x74, 0x74, 0x72,
-  0x71, 0x71, 0x71, 0x70, 0x6f, 0x6e, 0x6f, 0x6d, 0x6b, 0x68, 0x67, 0x65,
-  0x62, 0x60, 0x5e, 0x5c, 0x58, 0x53, 0x4f, 0x4c, 0x49, 0x44, 0x3b, 0x2e,
-  0x24, 0x1d, 0x17, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x11, 0x11, 0x13, 0x12,
-  0x83, 0x81, 0x80, 0x81, 0x7f, 0x7d, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-  0x77, 0x76, 0x76, 0x77, 0x76, 0x74, 0x73, 0x72, 0x73, 0x71, 0x70, 0x72,
-  0x79, 0x83, 0x8a, 0x8e, 0x8f, 0x90, 0x92, 0x93, 0x92, 0x91, 0x90, 0x91,
-  0x90, 0x90, 0x8e, 0x8d, 0x8d, 0x8b, 0x8c, 0x8c, 0x8a, 0x89, 0x89, 0x87,
-  0x87, 0x87, 0x86, 0x84, 0x84, 0x84, 0x84, 0x83, 0x80, 0x81, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x79, 0x78,
-  0x79, 0x79, 0x7a, 0x79, 0x79, 0x79, 0x78, 0x7a, 0x79, 0x78, 0x78, 0x79,
-  0x7b, 0x7c, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x80, 0x82, 0x82, 0x83, 0x85, 0x86, 0x87, 0x87,
-  0x87, 0x87, 0x89, 0x89, 0x89, 0x89, 0x8c, 0x8d, 0x8b, 0x8b, 0x8a, 0x8b,
-  0x8b, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e,
-  0x8d, 0x8e, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x8f, 0x90, 0x90,
-  0x8f, 0x8f, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8b, 0x8c, 0x8c, 0x8c, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x8c, 0x8a, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x87,
-  0x88, 0x87, 0x88, 0x88, 0x8a, 0x8a, 0x8b, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c,
-  0x8d, 0x8c, 0x8d, 0x8e, 0x8f, 0x91, 0x92, 0x94, 0x95, 0x95, 0x95, 0x96,
-  0x9a, 0x9b, 0x9c, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b,
-  0x9a, 0x9a, 0x9b, 0x9b, 0x9a, 0x9a, 0x99, 0x98, 0x98, 0x98, 0x98, 0x97,
-  0x97, 0x97, 0x98, 0x99, 0x9a, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98, 0x96,
-  0x96, 0x97, 0x98, 0x98, 0x96, 0x96, 0x96, 0x94, 0x94, 0x94, 0x93, 0x91,
-  0x8e, 0x8a, 0x84, 0x7d, 0x77, 0x74, 0x6f, 0x6c, 0x6d, 0x6d, 0x6c, 0x6d,
-  0x70, 0x71, 0x73, 0x73, 0x72, 0x74, 0x74, 0x73, 0x72, 0x72, 0x70, 0x70,
-  0x6f, 0x6e, 0x6e, 0x6c, 0x6c, 0x69, 0x69, 0x66, 0x62, 0x60, 0x5d, 0x5c,
-  0x59, 0x55, 0x4f, 0x4b, 0x48, 0x44, 0x3b, 0x2f, 0x25, 0x1e, 0x17, 0x12,
-  0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x13, 0x83, 0x81, 0x81, 0x81,
-  0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x77, 0x78,
-  0x77, 0x74, 0x73, 0x73, 0x72, 0x71, 0x71, 0x73, 0x7a, 0x83, 0x8a, 0x8d,
-  0x8e, 0x90, 0x92, 0x93, 0x92, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8d,
-  0x8d, 0x8b, 0x8c, 0x8c, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88, 0x87, 0x84,
-  0x84, 0x84, 0x85, 0x83, 0x80, 0x81, 0x81, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7a,
-  0x7a, 0x7a, 0x79, 0x7a, 0x79, 0x78, 0x77, 0x78, 0x7b, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x80, 0x82, 0x82, 0x83, 0x85, 0x86, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89,
-  0x89, 0x8a, 0x8c, 0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8c, 0x8e, 0x8e, 0x8e,
-  0x8d, 0x8d, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8f, 0x90, 0x90,
-  0x8e, 0x8f, 0x8f, 0x8d, 0x8e, 0x8f, 0x90, 0x90, 0x8e, 0x8e, 0x8c, 0x8b,
-  0x8c, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8b,
-  0x8a, 0x88, 0x88, 0x87, 0x86, 0x87, 0x87, 0x88, 0x88, 0x87, 0x88, 0x88,
-  0x8a, 0x8a, 0x8b, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8f,
-  0x8f, 0x91, 0x91, 0x93, 0x94, 0x95, 0x94, 0x96, 0x9a, 0x9b, 0x9c, 0x9d,
-  0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b, 0x9a, 0x9a, 0x9c, 0x9c,
-  0x9b, 0x9a, 0x98, 0x98, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97, 0x99, 0x99,
-  0x9a, 0x99, 0x9a, 0x99, 0x98, 0x99, 0x99, 0x97, 0x97, 0x98, 0x99, 0x98,
-  0x97, 0x96, 0x95, 0x94, 0x95, 0x94, 0x92, 0x90, 0x8d, 0x89, 0x83, 0x7c,
-  0x77, 0x73, 0x6f, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x70, 0x71, 0x72, 0x73,
-  0x73, 0x74, 0x74, 0x73, 0x73, 0x72, 0x71, 0x71, 0x6f, 0x6e, 0x6e, 0x6c,
-  0x6c, 0x6a, 0x69, 0x67, 0x63, 0x60, 0x5d, 0x5c, 0x5a, 0x55, 0x4f, 0x4b,
-  0x48, 0x44, 0x3c, 0x30, 0x26, 0x1f, 0x17, 0x13, 0x11, 0x11, 0x11, 0x10,
-  0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x13, 0x83, 0x82, 0x81, 0x81, 0x81, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7b, 0x79, 0x78, 0x78, 0x79, 0x78, 0x75, 0x75, 0x74, 0x73,
-  0x71, 0x70, 0x71, 0x73, 0x79, 0x82, 0x8a, 0x8c, 0x8e, 0x8f, 0x92, 0x93,
-  0x92, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8c, 0x8d, 0x8c, 0x8c,
-  0x8c, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x86, 0x86, 0x84, 0x84, 0x84, 0x84,
-  0x81, 0x81, 0x81, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7b, 0x79,
-  0x79, 0x78, 0x78, 0x79, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x80, 0x82, 0x82, 0x83,
-  0x84, 0x86, 0x87, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x89, 0x8b, 0x8c, 0x8d,
-  0x8d, 0x8c, 0x8b, 0x8c, 0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f,
-  0x90, 0x90, 0x90, 0x8e, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x90, 0x90, 0x8e,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8d, 0x8e, 0x8c, 0x8c, 0x8d, 0x8e, 0x8e, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x8d, 0x8d, 0x8c, 0x8b, 0x8a, 0x89, 0x89, 0x88, 0x88,
-  0x87, 0x88, 0x87, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b,
-  0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x91,
-  0x93, 0x94, 0x94, 0x97, 0x9a, 0x9a, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c,
-  0x9c, 0x9c, 0x9d, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0x9c, 0x9b, 0x99, 0x99,
-  0x9a, 0x99, 0x98, 0x97, 0x96, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x9a,
-  0x9a, 0x9a, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x97, 0x96, 0x95, 0x94,
-  0x94, 0x93, 0x92, 0x90, 0x8c, 0x87, 0x81, 0x79, 0x74, 0x71, 0x6e, 0x6c,
-  0x6c, 0x6d, 0x6e, 0x6e, 0x70, 0x71, 0x71, 0x72, 0x73, 0x72, 0x74, 0x74,
-  0x74, 0x73, 0x73, 0x72, 0x6f, 0x6e, 0x6e, 0x6c, 0x6c, 0x6a, 0x69, 0x69,
-  0x64, 0x60, 0x5e, 0x5c, 0x59, 0x55, 0x4f, 0x4a, 0x47, 0x43, 0x3b, 0x2f,
-  0x27, 0x21, 0x17, 0x12, 0x12, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x83, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x79,
-  0x78, 0x79, 0x79, 0x77, 0x75, 0x75, 0x74, 0x73, 0x71, 0x70, 0x71, 0x74,
-  0x79, 0x82, 0x88, 0x8c, 0x8d, 0x8e, 0x92, 0x93, 0x92, 0x91, 0x91, 0x8f,
-  0x8f, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8b, 0x8c, 0x8a, 0x8a, 0x89,
-  0x88, 0x88, 0x87, 0x87, 0x85, 0x84, 0x83, 0x83, 0x81, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x83, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7d, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7a, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x80, 0x81, 0x81, 0x83, 0x83, 0x86, 0x87, 0x88,
-  0x89, 0x8b, 0x8c, 0x8a, 0x8b, 0x8d, 0x8e, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c,
-  0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x90, 0x8f, 0x90, 0x91, 0x91, 0x90,
-  0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x90, 0x91, 0x90, 0x8f, 0x90, 0x8f,
-  0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d,
-  0x8d, 0x8c, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x87, 0x87,
-  0x87, 0x87, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8c, 0x8d,
-  0x8c, 0x8c, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x91, 0x92, 0x93, 0x94, 0x97,
-  0x99, 0x9a, 0x9b, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c, 0x9c, 0x9d, 0x9d,
-  0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x99, 0x9a, 0x99, 0x97, 0x96,
-  0x97, 0x99, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x99, 0x9a, 0x9b, 0x9b, 0x9a,
-  0x9a, 0x9a, 0x9a, 0x9a, 0x97, 0x96, 0x96, 0x97, 0x96, 0x94, 0x90, 0x8e,
-  0x8b, 0x85, 0x7e, 0x77, 0x72, 0x6f, 0x6b, 0x6b, 0x6c, 0x6d, 0x6d, 0x6e,
-  0x6e, 0x70, 0x70, 0x71, 0x72, 0x72, 0x74, 0x75, 0x74, 0x74, 0x74, 0x72,
-  0x71, 0x70, 0x70, 0x6f, 0x6d, 0x6c, 0x6a, 0x69, 0x65, 0x62, 0x5e, 0x5c,
-  0x59, 0x55, 0x4f, 0x4a, 0x47, 0x43, 0x3a, 0x2f, 0x27, 0x21, 0x17, 0x11,
-  0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7a, 0x7a, 0x7a, 0x79, 0x77,
-  0x76, 0x74, 0x74, 0x73, 0x71, 0x70, 0x71, 0x74, 0x7b, 0x82, 0x88, 0x8c,
-  0x8d, 0x8f, 0x92, 0x93, 0x92, 0x91, 0x90, 0x90, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x88,
-  0x88, 0x86, 0x84, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81,
-  0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x83,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8d, 0x8d, 0x8f, 0x90, 0x90,
-  0x8f, 0x90, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x91,
-  0x91, 0x90, 0x90, 0x91, 0x91, 0x90, 0x91, 0x90, 0x8f, 0x8f, 0x90, 0x90,
-  0x90, 0x8f, 0x8e, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a,
-  0x8a, 0x89, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x89, 0x89,
-  0x87, 0x87, 0x88, 0x88, 0x8a, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8e, 0x8f,
-  0x90, 0x8f, 0x91, 0x92, 0x92, 0x92, 0x93, 0x95, 0x98, 0x9a, 0x9b, 0x9c,
-  0x9b, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9c, 0x9c,
-  0x9c, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0x98, 0x97, 0x97, 0x97, 0x99, 0x99,
-  0x9a, 0x9b, 0x9b, 0x9a, 0x9b, 0x9c, 0x9c, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a,
-  0x97, 0x96, 0x97, 0x97, 0x96, 0x92, 0x8f, 0x8c, 0x88, 0x82, 0x7d, 0x76,
-  0x70, 0x6c, 0x6a, 0x6a, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x70,
-  0x72, 0x73, 0x75, 0x75, 0x75, 0x74, 0x74, 0x73, 0x72, 0x71, 0x71, 0x6f,
-  0x6e, 0x6c, 0x6a, 0x67, 0x65, 0x62, 0x5e, 0x5b, 0x59, 0x55, 0x4f, 0x4a,
-  0x47, 0x43, 0x3b, 0x2f, 0x26, 0x20, 0x18, 0x12, 0x11, 0x10, 0x10, 0x10,
-  0x10, 0x11, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x12, 0x12, 0x83, 0x83, 0x82, 0x82, 0x80, 0x80, 0x7f, 0x7e,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x77, 0x76, 0x75, 0x73,
-  0x72, 0x71, 0x72, 0x74, 0x7a, 0x83, 0x89, 0x8d, 0x8e, 0x8f, 0x92, 0x93,
-  0x92, 0x91, 0x90, 0x90, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8d, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x88, 0x85, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x85,
-  0x85, 0x86, 0x87, 0x87, 0x86, 0x86, 0x86, 0x85, 0x83, 0x82, 0x82, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x81, 0x80, 0x81, 0x7f, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x83,
-  0x85, 0x87, 0x88, 0x89, 0x8a, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8f, 0x8f,
-  0x8f, 0x8d, 0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91,
-  0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x91, 0x92, 0x91, 0x90, 0x91,
-  0x90, 0x91, 0x92, 0x91, 0x90, 0x90, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x8d,
-  0x8e, 0x8f, 0x8e, 0x8d, 0x8e, 0x8c, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a,
-  0x89, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87, 0x87, 0x86, 0x87, 0x88,
-  0x8a, 0x8a, 0x8b, 0x8c, 0x8b, 0x8d, 0x8e, 0x8f, 0x8f, 0x90, 0x92, 0x92,
-  0x92, 0x92, 0x93, 0x96, 0x98, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x9c, 0x9c,
-  0x9d, 0x9c, 0x9d, 0x9e, 0x9e, 0x9d, 0x9c, 0x9c, 0x9d, 0x9d, 0x9c, 0x9c,
-  0x9a, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x9c, 0x9c,
-  0x9c, 0x9d, 0x9d, 0x9b, 0x9b, 0x9b, 0x9c, 0x9b, 0x98, 0x97, 0x98, 0x98,
-  0x95, 0x90, 0x8d, 0x8a, 0x86, 0x80, 0x7b, 0x73, 0x6e, 0x6b, 0x68, 0x68,
-  0x6a, 0x6b, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x72, 0x72, 0x74, 0x74,
-  0x74, 0x74, 0x74, 0x74, 0x72, 0x71, 0x72, 0x70, 0x6e, 0x6c, 0x6a, 0x68,
-  0x64, 0x62, 0x5e, 0x5b, 0x58, 0x55, 0x50, 0x4b, 0x48, 0x42, 0x3b, 0x30,
-  0x26, 0x20, 0x19, 0x13, 0x12, 0x12, 0x12, 0x10, 0x11, 0x10, 0x10, 0x11,
-  0x12, 0x12, 0x13, 0x12, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x13, 0x13,
-  0x82, 0x83, 0x82, 0x82, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7b, 0x7a,
-  0x7a, 0x7a, 0x79, 0x79, 0x78, 0x76, 0x75, 0x73, 0x72, 0x71, 0x71, 0x74,
-  0x7a, 0x83, 0x89, 0x8c, 0x8e, 0x8f, 0x92, 0x93, 0x92, 0x91, 0x90, 0x8f,
-  0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b,
-  0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x86, 0x84, 0x83, 0x83, 0x83, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x84, 0x83, 0x84, 0x86, 0x86, 0x87, 0x88, 0x88,
-  0x87, 0x87, 0x87, 0x85, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x82, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7d, 0x7d, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x89, 0x8a,
-  0x8b, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e,
-  0x8e, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-  0x91, 0x91, 0x91, 0x91, 0x92, 0x91, 0x90, 0x90, 0x90, 0x91, 0x92, 0x91,
-  0x90, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8d, 0x8e, 0x8f, 0x8f, 0x8e,
-  0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8a, 0x8b, 0x8a, 0x8a, 0x88, 0x8a, 0x8a,
-  0x8a, 0x8a, 0x87, 0x87, 0x87, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-  0x8b, 0x8c, 0x8d, 0x8f, 0x8f, 0x8f, 0x92, 0x92, 0x92, 0x92, 0x93, 0x96,
-  0x98, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0x9b, 0x9c, 0x9d, 0x9c, 0x9d, 0x9e,
-  0x9e, 0x9d, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c, 0x99, 0x99, 0x99, 0x99,
-  0x99, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c, 0x9c,
-  0x9c, 0x9c, 0x9d, 0x9c, 0x99, 0x98, 0x98, 0x98, 0x94, 0x8f, 0x8c, 0x89,
-  0x84, 0x7f, 0x79, 0x71, 0x6c, 0x69, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
-  0x6c, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x74, 0x74, 0x74, 0x73, 0x74, 0x74,
-  0x72, 0x71, 0x72, 0x6f, 0x6e, 0x6c, 0x6a, 0x68, 0x64, 0x62, 0x5e, 0x5c,
-  0x58, 0x55, 0x50, 0x4b, 0x48, 0x41, 0x3b, 0x30, 0x26, 0x20, 0x18, 0x13,
-  0x12, 0x12, 0x12, 0x10, 0x11, 0x10, 0x10, 0x11, 0x12, 0x12, 0x13, 0x12,
-  0x11, 0x11, 0x12, 0x13, 0x12, 0x12, 0x13, 0x14, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x79,
-  0x77, 0x77, 0x76, 0x73, 0x72, 0x71, 0x71, 0x73, 0x79, 0x82, 0x88, 0x8b,
-  0x8c, 0x8e, 0x91, 0x92, 0x91, 0x91, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e,
-  0x8d, 0x8e, 0x8e, 0x8d, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b,
-  0x8a, 0x89, 0x87, 0x85, 0x84, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84,
-  0x85, 0x85, 0x86, 0x87, 0x87, 0x87, 0x88, 0x89, 0x87, 0x88, 0x88, 0x86,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x82,
-  0x81, 0x80, 0x7f, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7d, 0x7d, 0x7e, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x85, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e,
-  0x8d, 0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8f, 0x90, 0x91,
-  0x91, 0x92, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x91, 0x91, 0x91, 0x91,
-  0x91, 0x91, 0x90, 0x90, 0x91, 0x91, 0x92, 0x91, 0x90, 0x90, 0x91, 0x91,
-  0x91, 0x90, 0x8f, 0x8d, 0x8e, 0x8e, 0x8f, 0x8d, 0x8d, 0x8c, 0x8b, 0x8b,
-  0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x87,
-  0x86, 0x87, 0x88, 0x89, 0x8a, 0x89, 0x8a, 0x8b, 0x8b, 0x8d, 0x8d, 0x8f,
-  0x8f, 0x8f, 0x91, 0x92, 0x92, 0x92, 0x93, 0x96, 0x98, 0x98, 0x99, 0x9a,
-  0x99, 0x9a, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0x9d, 0x9c, 0x9c,
-  0x9c, 0x9d, 0x9d, 0x9c, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b,
-  0x9b, 0x9a, 0x9b, 0x9d, 0x9d, 0x9c, 0x9b, 0x9c, 0x9b, 0x9c, 0x9d, 0x9c,
-  0x9a, 0x9a, 0x99, 0x96, 0x92, 0x8d, 0x89, 0x87, 0x82, 0x7b, 0x76, 0x6e,
-  0x69, 0x67, 0x66, 0x66, 0x69, 0x69, 0x6a, 0x6b, 0x6b, 0x6d, 0x6e, 0x6f,
-  0x70, 0x70, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x72, 0x71, 0x71, 0x6f,
-  0x6e, 0x6c, 0x6b, 0x69, 0x64, 0x61, 0x5e, 0x5c, 0x58, 0x55, 0x50, 0x4a,
-  0x46, 0x42, 0x3a, 0x2f, 0x26, 0x20, 0x17, 0x13, 0x11, 0x11, 0x11, 0x10,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x14, 0x83, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x7d, 0x7b, 0x79, 0x79, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75,
-  0x73, 0x72, 0x72, 0x73, 0x77, 0x80, 0x86, 0x89, 0x8a, 0x8c, 0x8f, 0x92,
-  0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e,
-  0x8e, 0x8d, 0x8e, 0x8e, 0x8f, 0x8e, 0x8c, 0x8c, 0x8c, 0x8b, 0x88, 0x87,
-  0x86, 0x85, 0x84, 0x83, 0x84, 0x85, 0x86, 0x86, 0x85, 0x86, 0x88, 0x89,
-  0x88, 0x88, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x88, 0x87, 0x86, 0x86, 0x86,
-  0x85, 0x86, 0x85, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x84,
-  0x86, 0x87, 0x88, 0x89, 0x8b, 0x8c, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x8f,
-  0x8f, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94, 0x94,
-  0x94, 0x93, 0x93, 0x93, 0x92, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92,
-  0x93, 0x93, 0x92, 0x92, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8f, 0x8e,
-  0x8e, 0x8e, 0x8f, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a,
-  0x8b, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x87, 0x88, 0x88,
-  0x8a, 0x8a, 0x8a, 0x8a, 0x8c, 0x8d, 0x8c, 0x8e, 0x8e, 0x8f, 0x91, 0x92,
-  0x92, 0x93, 0x94, 0x95, 0x96, 0x96, 0x97, 0x98, 0x9b, 0x9c, 0x9b, 0x9c,
-  0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0x9d, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d,
-  0x9c, 0x9c, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x9c, 0x9b, 0x9b,
-  0x9c, 0x9c, 0x9c, 0x9d, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9a, 0x96,
-  0x91, 0x8b, 0x85, 0x82, 0x7d, 0x79, 0x72, 0x6b, 0x67, 0x66, 0x65, 0x66,
-  0x68, 0x69, 0x69, 0x69, 0x6b, 0x6c, 0x6e, 0x6e, 0x6f, 0x70, 0x73, 0x74,
-  0x74, 0x73, 0x73, 0x72, 0x72, 0x72, 0x71, 0x70, 0x6e, 0x6d, 0x6c, 0x69,
-  0x64, 0x61, 0x5f, 0x5d, 0x58, 0x54, 0x4f, 0x4a, 0x46, 0x41, 0x38, 0x2f,
-  0x26, 0x20, 0x19, 0x13, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10,
-  0x10, 0x11, 0x12, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x11, 0x12, 0x13,
-  0x84, 0x84, 0x83, 0x82, 0x80, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7d, 0x7b,
-  0x79, 0x79, 0x79, 0x78, 0x79, 0x78, 0x77, 0x75, 0x73, 0x72, 0x72, 0x73,
-  0x77, 0x7f, 0x85, 0x88, 0x8a, 0x8c, 0x8f, 0x92, 0x92, 0x91, 0x90, 0x8f,
-  0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8f,
-  0x90, 0x8f, 0x8d, 0x8d, 0x8d, 0x8c, 0x8a, 0x88, 0x87, 0x86, 0x85, 0x86,
-  0x85, 0x86, 0x87, 0x87, 0x87, 0x89, 0x8b, 0x8b, 0x8a, 0x8a, 0x8b, 0x8a,
-  0x8a, 0x8b, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87,
-  0x88, 0x87, 0x85, 0x83, 0x82, 0x81, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x80, 0x82, 0x82, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8a, 0x8a,
-  0x8b, 0x8d, 0x8d, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x8f,
-  0x91, 0x92, 0x92, 0x93, 0x94, 0x94, 0x93, 0x94, 0x94, 0x93, 0x94, 0x93,
-  0x93, 0x93, 0x93, 0x93, 0x94, 0x93, 0x93, 0x92, 0x94, 0x94, 0x92, 0x91,
-  0x91, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x8a,
-  0x8a, 0x89, 0x89, 0x87, 0x87, 0x88, 0x87, 0x87, 0x88, 0x89, 0x89, 0x89,
-  0x8c, 0x8d, 0x8d, 0x8e, 0x8e, 0x8f, 0x91, 0x92, 0x92, 0x93, 0x94, 0x95,
-  0x95, 0x96, 0x97, 0x98, 0x9b, 0x9d, 0x9c, 0x9c, 0x9d, 0x9c, 0x9d, 0x9d,
-  0x9d, 0x9d, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b, 0x9a,
-  0x9b, 0x9c, 0x9c, 0x9c, 0x9b, 0x9c, 0x9b, 0x9a, 0x9b, 0x9c, 0x9c, 0x9c,
-  0x9c, 0x9c, 0x9e, 0x9e, 0x9c, 0x9a, 0x98, 0x94, 0x8e, 0x87, 0x81, 0x7e,
-  0x7a, 0x75, 0x6e, 0x69, 0x65, 0x65, 0x65, 0x65, 0x66, 0x68, 0x69, 0x68,
-  0x6a, 0x6b, 0x6d, 0x6e, 0x6d, 0x6e, 0x71, 0x73, 0x73, 0x72, 0x72, 0x72,
-  0x72, 0x72, 0x71, 0x71, 0x6e, 0x6d, 0x6c, 0x68, 0x65, 0x62, 0x60, 0x5d,
-  0x58, 0x54, 0x4f, 0x4b, 0x48, 0x41, 0x37, 0x2e, 0x26, 0x21, 0x18, 0x12,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x12, 0x11, 0x10, 0x10, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83, 0x83, 0x83, 0x83,
-  0x81, 0x7f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7c, 0x7a, 0x7a, 0x79, 0x79, 0x78,
-  0x79, 0x78, 0x77, 0x75, 0x73, 0x73, 0x72, 0x73, 0x77, 0x7e, 0x83, 0x86,
-  0x88, 0x8b, 0x90, 0x93, 0x93, 0x92, 0x91, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d,
-  0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f, 0x90, 0x8f, 0x8e, 0x8d,
-  0x8d, 0x8d, 0x8b, 0x89, 0x88, 0x87, 0x87, 0x87, 0x86, 0x86, 0x88, 0x88,
-  0x89, 0x8a, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x8a,
-  0x89, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x88, 0x87, 0x85, 0x83,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x86, 0x88, 0x8a, 0x8b, 0x8c, 0x8b, 0x8d, 0x8e, 0x8f,
-  0x8f, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x91, 0x93, 0x93, 0x94,
-  0x95, 0x95, 0x94, 0x95, 0x94, 0x94, 0x94, 0x94, 0x93, 0x92, 0x93, 0x93,
-  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x91, 0x91, 0x90, 0x91,
-  0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0x8a, 0x89, 0x89, 0x88, 0x89, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x88, 0x89, 0x8b, 0x8d, 0x8d, 0x8e,
-  0x8f, 0x8f, 0x92, 0x92, 0x93, 0x93, 0x94, 0x95, 0x95, 0x96, 0x98, 0x99,
-  0x9b, 0x9c, 0x9c, 0x9c, 0x9d, 0x9c, 0x9d, 0x9e, 0x9e, 0x9d, 0x9c, 0x9b,
-  0x9c, 0x9c, 0x9b, 0x9c, 0x9c, 0x9b, 0x9b, 0x9a, 0x9c, 0x9d, 0x9d, 0x9d,
-  0x9c, 0x9b, 0x9c, 0x9b, 0x9c, 0x9d, 0x9c, 0x9c, 0x9c, 0x9d, 0x9f, 0x9e,
-  0x9c, 0x99, 0x97, 0x93, 0x8c, 0x84, 0x7f, 0x7b, 0x78, 0x73, 0x6c, 0x66,
-  0x64, 0x64, 0x65, 0x65, 0x66, 0x67, 0x68, 0x68, 0x68, 0x6a, 0x6b, 0x6c,
-  0x6c, 0x6d, 0x70, 0x71, 0x71, 0x71, 0x71, 0x73, 0x73, 0x73, 0x72, 0x71,
-  0x6f, 0x6d, 0x6c, 0x69, 0x66, 0x62, 0x60, 0x5e, 0x59, 0x54, 0x4f, 0x4a,
-  0x46, 0x3f, 0x38, 0x2e, 0x27, 0x22, 0x19, 0x12, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11,
-  0x10, 0x11, 0x11, 0x10, 0x83, 0x83, 0x82, 0x82, 0x81, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x79, 0x78, 0x77, 0x75,
-  0x73, 0x72, 0x72, 0x73, 0x77, 0x7d, 0x83, 0x85, 0x87, 0x8b, 0x90, 0x92,
-  0x93, 0x92, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8e, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8c, 0x8a,
-  0x89, 0x88, 0x88, 0x88, 0x87, 0x87, 0x88, 0x89, 0x8a, 0x8c, 0x8d, 0x8e,
-  0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x8a, 0x8b,
-  0x89, 0x88, 0x88, 0x88, 0x88, 0x87, 0x85, 0x83, 0x83, 0x83, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x85, 0x86, 0x86,
-  0x88, 0x8a, 0x8b, 0x8c, 0x8c, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x90,
-  0x8f, 0x90, 0x90, 0x90, 0x92, 0x93, 0x93, 0x94, 0x95, 0x95, 0x94, 0x95,
-  0x94, 0x94, 0x95, 0x95, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
-  0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x8b,
-  0x8b, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x89, 0x88, 0x88, 0x88, 0x87, 0x86,
-  0x87, 0x87, 0x88, 0x89, 0x8a, 0x8d, 0x8d, 0x8e, 0x8e, 0x8f, 0x92, 0x93,
-  0x94, 0x94, 0x95, 0x95, 0x96, 0x96, 0x97, 0x99, 0x9b, 0x9c, 0x9c, 0x9c,
-  0x9d, 0x9c, 0x9d, 0x9e, 0x9e, 0x9d, 0x9c, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b,
-  0x9b, 0x9a, 0x9b, 0x9b, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9d, 0x9c,
-  0x9c, 0x9d, 0x9c, 0x9d, 0x9d, 0x9e, 0x9f, 0x9e, 0x9b, 0x98, 0x96, 0x91,
-  0x8b, 0x82, 0x7c, 0x7a, 0x76, 0x71, 0x6a, 0x65, 0x63, 0x63, 0x64, 0x64,
-  0x65, 0x66, 0x67, 0x67, 0x68, 0x69, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
-  0x71, 0x70, 0x70, 0x73, 0x73, 0x72, 0x72, 0x71, 0x6f, 0x6d, 0x6c, 0x69,
-  0x67, 0x63, 0x60, 0x5e, 0x5a, 0x55, 0x4f, 0x4a, 0x46, 0x3f, 0x38, 0x2f,
-  0x28, 0x22, 0x19, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10,
-  0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11,
-  0x84, 0x84, 0x83, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7a, 0x7a, 0x79, 0x79, 0x79, 0x78, 0x76, 0x75, 0x74, 0x73, 0x71, 0x72,
-  0x76, 0x7d, 0x81, 0x84, 0x86, 0x8a, 0x8e, 0x92, 0x93, 0x93, 0x91, 0x8f,
-  0x8f, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x90, 0x8f, 0x8f,
-  0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8d, 0x8b, 0x8a, 0x8a, 0x8a, 0x89,
-  0x89, 0x88, 0x8a, 0x8a, 0x8b, 0x8d, 0x8e, 0x8f, 0x90, 0x90, 0x8e, 0x8e,
-  0x8e, 0x8d, 0x8c, 0x8c, 0x8b, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x8b, 0x8a,
-  0x89, 0x87, 0x86, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f,
-  0x7e, 0x7f, 0x7e, 0x7e, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x86, 0x89, 0x8a, 0x8b, 0x8b,
-  0x8b, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x92,
-  0x93, 0x94, 0x94, 0x93, 0x94, 0x94, 0x95, 0x95, 0x95, 0x94, 0x95, 0x95,
-  0x94, 0x94, 0x94, 0x92, 0x93, 0x92, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92,
-  0x91, 0x91, 0x92, 0x91, 0x91, 0x8f, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x8f,
-  0x8f, 0x8e, 0x8d, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x89, 0x89,
-  0x89, 0x89, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87,
-  0x89, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x91, 0x94, 0x95, 0x95, 0x95, 0x96,
-  0x96, 0x96, 0x96, 0x97, 0x9a, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9d,
-  0x9e, 0x9d, 0x9c, 0x9b, 0x9a, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9c,
-  0x9d, 0x9d, 0x9d, 0x9c, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9d, 0x9e,
-  0x9e, 0x9e, 0x9e, 0x9d, 0x9a, 0x96, 0x93, 0x8f, 0x87, 0x7e, 0x78, 0x76,
-  0x73, 0x6e, 0x66, 0x63, 0x62, 0x62, 0x63, 0x65, 0x66, 0x65, 0x66, 0x67,
-  0x67, 0x69, 0x6b, 0x6c, 0x6d, 0x6d, 0x6f, 0x70, 0x70, 0x71, 0x71, 0x72,
-  0x72, 0x71, 0x71, 0x70, 0x6e, 0x6d, 0x6c, 0x69, 0x67, 0x62, 0x5f, 0x5d,
-  0x5a, 0x54, 0x4e, 0x4a, 0x46, 0x3f, 0x38, 0x2f, 0x27, 0x21, 0x1a, 0x12,
-  0x10, 0x10, 0x10, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x10, 0x10, 0x11, 0x11, 0x11, 0x12, 0x84, 0x84, 0x83, 0x82,
-  0x82, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x79,
-  0x79, 0x78, 0x77, 0x76, 0x75, 0x73, 0x71, 0x71, 0x74, 0x7b, 0x7e, 0x82,
-  0x84, 0x88, 0x8c, 0x91, 0x93, 0x93, 0x91, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e,
-  0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91,
-  0x91, 0x91, 0x90, 0x8d, 0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8d, 0x8d,
-  0x8d, 0x8f, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8d,
-  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8b, 0x8b, 0x89, 0x87, 0x86,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7f, 0x80, 0x7f, 0x80, 0x81, 0x84,
-  0x86, 0x87, 0x87, 0x87, 0x88, 0x8a, 0x8c, 0x8c, 0x8d, 0x8f, 0x90, 0x90,
-  0x8f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x91, 0x93, 0x94, 0x95, 0x95, 0x95,
-  0x95, 0x96, 0x94, 0x94, 0x94, 0x95, 0x94, 0x95, 0x94, 0x94, 0x94, 0x92,
-  0x91, 0x91, 0x91, 0x91, 0x93, 0x92, 0x92, 0x91, 0x91, 0x91, 0x92, 0x91,
-  0x91, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8d, 0x8d,
-  0x8c, 0x8d, 0x8c, 0x8c, 0x8b, 0x8b, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x89,
-  0x88, 0x87, 0x86, 0x86, 0x87, 0x88, 0x87, 0x87, 0x89, 0x8c, 0x8c, 0x8d,
-  0x8e, 0x8f, 0x91, 0x94, 0x95, 0x96, 0x95, 0x97, 0x97, 0x97, 0x96, 0x97,
-  0x9a, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9d, 0x9e, 0x9d, 0x9c, 0x9b,
-  0x9a, 0x99, 0x9a, 0x9b, 0x9a, 0x9a, 0x9a, 0x9d, 0x9e, 0x9d, 0x9d, 0x9d,
-  0x9d, 0x9d, 0x9d, 0x9d, 0x9e, 0x9e, 0x9d, 0x9f, 0x9f, 0x9e, 0x9d, 0x9b,
-  0x97, 0x93, 0x90, 0x8a, 0x81, 0x7a, 0x76, 0x73, 0x6f, 0x67, 0x62, 0x61,
-  0x61, 0x61, 0x62, 0x64, 0x65, 0x65, 0x66, 0x67, 0x67, 0x68, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6e, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x70, 0x70,
-  0x6e, 0x6e, 0x6d, 0x6a, 0x67, 0x61, 0x5f, 0x5c, 0x58, 0x52, 0x4e, 0x49,
-  0x45, 0x3f, 0x38, 0x2e, 0x27, 0x22, 0x1b, 0x13, 0x10, 0x11, 0x11, 0x12,
-  0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x10, 0x10,
-  0x11, 0x11, 0x12, 0x14, 0x83, 0x83, 0x83, 0x83, 0x81, 0x7f, 0x7f, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x78, 0x77,
-  0x74, 0x71, 0x70, 0x71, 0x73, 0x78, 0x7c, 0x80, 0x83, 0x88, 0x8c, 0x90,
-  0x93, 0x93, 0x93, 0x90, 0x8e, 0x8f, 0x8e, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d,
-  0x8e, 0x8f, 0x8f, 0x91, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x91, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x93, 0x94,
-  0x93, 0x92, 0x91, 0x90, 0x8e, 0x8e, 0x8e, 0x8f, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8c, 0x8d, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x86, 0x85, 0x85, 0x85,
-  0x84, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x82, 0x84, 0x86, 0x87, 0x87, 0x88,
-  0x89, 0x8a, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x91,
-  0x91, 0x92, 0x92, 0x94, 0x95, 0x96, 0x95, 0x95, 0x95, 0x96, 0x95, 0x95,
-  0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94, 0x93, 0x91, 0x92, 0x92, 0x92,
-  0x92, 0x93, 0x92, 0x92, 0x90, 0x91, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f,
-  0x90, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x8d, 0x8c, 0x8c,
-  0x8c, 0x8c, 0x8b, 0x8b, 0x8a, 0x89, 0x89, 0x89, 0x87, 0x87, 0x85, 0x85,
-  0x87, 0x88, 0x88, 0x87, 0x88, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x91, 0x94,
-  0x95, 0x96, 0x96, 0x97, 0x98, 0x98, 0x98, 0x98, 0x9a, 0x9c, 0x9d, 0x9d,
-  0x9d, 0x9d, 0x9c, 0x9d, 0x9e, 0x9d, 0x9b, 0x9a, 0x9b, 0x9a, 0x99, 0x9a,
-  0x9a, 0x9b, 0x9c, 0x9d, 0x9c, 0x9e, 0x9e, 0x9e, 0x9d, 0x9f, 0x9e, 0x9e,
-  0x9d, 0x9d, 0x9e, 0x9e, 0x9e, 0x9d, 0x9c, 0x99, 0x95, 0x91, 0x8e, 0x86,
-  0x7e, 0x77, 0x72, 0x6e, 0x69, 0x62, 0x60, 0x60, 0x61, 0x62, 0x63, 0x64,
-  0x64, 0x65, 0x65, 0x67, 0x68, 0x69, 0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d,
-  0x6e, 0x6f, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x6e, 0x6e, 0x6d, 0x69,
-  0x67, 0x62, 0x5e, 0x5c, 0x58, 0x52, 0x4d, 0x4a, 0x46, 0x3f, 0x38, 0x2f,
-  0x27, 0x22, 0x1a, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x11, 0x10, 0x10, 0x12, 0x13, 0x13, 0x12, 0x13,
-  0x82, 0x82, 0x83, 0x83, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7b, 0x79, 0x79, 0x79, 0x77, 0x74, 0x71, 0x70, 0x70,
-  0x71, 0x75, 0x7c, 0x7f, 0x82, 0x86, 0x8b, 0x8e, 0x91, 0x92, 0x92, 0x91,
-  0x8f, 0x8f, 0x8e, 0x8d, 0x8e, 0x8d, 0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x91,
-  0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x90, 0x90, 0x91, 0x91, 0x91,
-  0x91, 0x90, 0x91, 0x91, 0x93, 0x93, 0x94, 0x95, 0x93, 0x93, 0x93, 0x92,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c,
-  0x8b, 0x89, 0x87, 0x87, 0x86, 0x85, 0x85, 0x85, 0x83, 0x82, 0x81, 0x81,
-  0x81, 0x7f, 0x80, 0x7f, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80,
-  0x81, 0x82, 0x83, 0x84, 0x86, 0x87, 0x87, 0x88, 0x8a, 0x8a, 0x8c, 0x8d,
-  0x8e, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x91, 0x92, 0x93, 0x95,
-  0x96, 0x96, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97, 0x97, 0x95, 0x94, 0x95,
-  0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92, 0x91, 0x91,
-  0x90, 0x91, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x90,
-  0x90, 0x8f, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8c, 0x8c,
-  0x8b, 0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x87, 0x88, 0x87, 0x88,
-  0x89, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x91, 0x94, 0x96, 0x96, 0x96, 0x97,
-  0x97, 0x98, 0x99, 0x98, 0x9a, 0x9c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9d,
-  0x9e, 0x9d, 0x9b, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0x9a, 0x9b, 0x9d, 0x9d,
-  0x9d, 0x9f, 0x9f, 0x9f, 0x9e, 0x9f, 0x9f, 0x9d, 0x9c, 0x9c, 0x9d, 0x9e,
-  0x9d, 0x9c, 0x9b, 0x97, 0x91, 0x8d, 0x89, 0x82, 0x7a, 0x74, 0x6e, 0x6a,
-  0x64, 0x5f, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x63, 0x63, 0x64, 0x65, 0x65,
-  0x67, 0x69, 0x6a, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6e, 0x6f, 0x6f, 0x6f,
-  0x70, 0x71, 0x71, 0x70, 0x6e, 0x6e, 0x6d, 0x6a, 0x66, 0x62, 0x5e, 0x5c,
-  0x59, 0x53, 0x4d, 0x49, 0x46, 0x40, 0x36, 0x2e, 0x26, 0x21, 0x1a, 0x14,
-  0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x12, 0x11, 0x82, 0x82, 0x83, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b,
-  0x79, 0x79, 0x78, 0x77, 0x74, 0x72, 0x70, 0x70, 0x6f, 0x74, 0x7a, 0x7f,
-  0x82, 0x85, 0x8a, 0x8d, 0x91, 0x92, 0x92, 0x92, 0x90, 0x8f, 0x8f, 0x8d,
-  0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x94,
-  0x94, 0x94, 0x92, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x91, 0x92, 0x92,
-  0x94, 0x95, 0x95, 0x95, 0x94, 0x93, 0x94, 0x92, 0x90, 0x8f, 0x8f, 0x90,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x89, 0x87, 0x86,
-  0x86, 0x85, 0x85, 0x85, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x84,
-  0x86, 0x87, 0x87, 0x88, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91,
-  0x91, 0x90, 0x90, 0x90, 0x91, 0x92, 0x93, 0x95, 0x96, 0x96, 0x95, 0x96,
-  0x95, 0x96, 0x97, 0x98, 0x97, 0x94, 0x94, 0x94, 0x93, 0x92, 0x92, 0x93,
-  0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x91, 0x91, 0x92, 0x91, 0x90,
-  0x90, 0x8f, 0x8f, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8d,
-  0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b, 0x89, 0x89, 0x88,
-  0x87, 0x86, 0x85, 0x85, 0x87, 0x87, 0x87, 0x88, 0x89, 0x8c, 0x8c, 0x8e,
-  0x8e, 0x8f, 0x91, 0x94, 0x96, 0x96, 0x96, 0x96, 0x96, 0x98, 0x99, 0x98,
-  0x99, 0x9c, 0x9c, 0x9c, 0x9d, 0x9d, 0x9c, 0x9d, 0x9e, 0x9d, 0x9b, 0x99,
-  0x9a, 0x9a, 0x98, 0x98, 0x99, 0x9b, 0x9d, 0x9d, 0x9d, 0x9e, 0x9f, 0x9f,
-  0x9e, 0xa0, 0x9f, 0x9d, 0x9c, 0x9c, 0x9e, 0x9e, 0x9c, 0x9b, 0x9a, 0x95,
-  0x8f, 0x8a, 0x86, 0x7f, 0x78, 0x71, 0x6b, 0x67, 0x61, 0x5e, 0x5f, 0x5f,
-  0x60, 0x61, 0x62, 0x63, 0x63, 0x64, 0x65, 0x65, 0x67, 0x6a, 0x69, 0x6a,
-  0x6b, 0x6c, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x6f, 0x70, 0x71, 0x70, 0x70,
-  0x6e, 0x6e, 0x6d, 0x6b, 0x66, 0x62, 0x5e, 0x5c, 0x59, 0x53, 0x4d, 0x49,
-  0x46, 0x3f, 0x36, 0x2e, 0x25, 0x20, 0x19, 0x14, 0x11, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x12, 0x12, 0x11, 0x82, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7b, 0x78, 0x78, 0x77, 0x76,
-  0x74, 0x72, 0x70, 0x6f, 0x6e, 0x72, 0x79, 0x7e, 0x81, 0x84, 0x88, 0x8c,
-  0x90, 0x91, 0x92, 0x91, 0x8f, 0x8f, 0x8e, 0x8d, 0x8e, 0x8e, 0x8e, 0x8f,
-  0x8e, 0x90, 0x90, 0x91, 0x92, 0x94, 0x95, 0x94, 0x95, 0x95, 0x94, 0x94,
-  0x94, 0x94, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94, 0x95, 0x96, 0x96, 0x96,
-  0x95, 0x94, 0x94, 0x93, 0x91, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x90,
-  0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8a, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86,
-  0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7d, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7f, 0x81, 0x81, 0x82, 0x83, 0x84, 0x86, 0x86, 0x87, 0x88,
-  0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8e, 0x8f, 0x91, 0x91, 0x91, 0x91, 0x90,
-  0x92, 0x93, 0x94, 0x94, 0x95, 0x96, 0x96, 0x96, 0x95, 0x96, 0x98, 0x98,
-  0x97, 0x95, 0x94, 0x95, 0x94, 0x93, 0x93, 0x93, 0x91, 0x91, 0x92, 0x93,
-  0x93, 0x93, 0x92, 0x92, 0x91, 0x92, 0x91, 0x90, 0x90, 0x8f, 0x90, 0x8f,
-  0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8d, 0x8b, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x85, 0x85,
-  0x87, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e, 0x8f, 0x91, 0x94,
-  0x94, 0x95, 0x95, 0x96, 0x96, 0x98, 0x99, 0x97, 0x98, 0x9b, 0x9b, 0x9b,
-  0x9c, 0x9c, 0x9c, 0x9d, 0x9e, 0x9d, 0x9b, 0x9a, 0x9a, 0x9a, 0x99, 0x99,
-  0x99, 0x9b, 0x9c, 0x9d, 0x9d, 0x9e, 0x9f, 0xa0, 0xa0, 0x9f, 0x9f, 0x9e,
-  0x9d, 0x9c, 0x9e, 0x9e, 0x9b, 0x99, 0x97, 0x93, 0x8b, 0x86, 0x82, 0x7b,
-  0x75, 0x6d, 0x66, 0x62, 0x5d, 0x5b, 0x5d, 0x5e, 0x5e, 0x60, 0x61, 0x61,
-  0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x69, 0x69, 0x6b, 0x6b, 0x6d, 0x6d,
-  0x6e, 0x70, 0x70, 0x6f, 0x70, 0x70, 0x6f, 0x6f, 0x6e, 0x6e, 0x6d, 0x6a,
-  0x66, 0x62, 0x5e, 0x5c, 0x59, 0x53, 0x4c, 0x48, 0x45, 0x3e, 0x35, 0x2e,
-  0x26, 0x20, 0x19, 0x13, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7c, 0x7c, 0x79, 0x77, 0x77, 0x76, 0x73, 0x71, 0x6d, 0x6c,
-  0x6c, 0x6f, 0x76, 0x7c, 0x7e, 0x82, 0x86, 0x8b, 0x8e, 0x8f, 0x91, 0x91,
-  0x91, 0x90, 0x8f, 0x8e, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x90, 0x92,
-  0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96,
-  0x95, 0x97, 0x97, 0x97, 0x97, 0x97, 0x98, 0x97, 0x96, 0x96, 0x95, 0x94,
-  0x93, 0x93, 0x92, 0x91, 0x92, 0x91, 0x90, 0x90, 0x91, 0x8f, 0x8f, 0x8e,
-  0x8d, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x87, 0x87, 0x84, 0x83, 0x83, 0x84,
-  0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x81,
-  0x81, 0x82, 0x84, 0x86, 0x87, 0x87, 0x88, 0x89, 0x8a, 0x8c, 0x8e, 0x8d,
-  0x8d, 0x8e, 0x90, 0x90, 0x91, 0x91, 0x90, 0x91, 0x93, 0x95, 0x95, 0x95,
-  0x95, 0x95, 0x96, 0x96, 0x96, 0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x95,
-  0x94, 0x94, 0x94, 0x92, 0x91, 0x91, 0x92, 0x93, 0x94, 0x93, 0x92, 0x91,
-  0x91, 0x91, 0x91, 0x90, 0x90, 0x90, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x8d,
-  0x8d, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c,
-  0x8b, 0x8b, 0x8b, 0x8a, 0x88, 0x87, 0x86, 0x86, 0x86, 0x86, 0x87, 0x89,
-  0x8a, 0x8c, 0x8c, 0x8d, 0x8f, 0x90, 0x93, 0x94, 0x94, 0x94, 0x95, 0x96,
-  0x97, 0x98, 0x98, 0x97, 0x98, 0x9a, 0x9a, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c,
-  0x9c, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9b, 0x99, 0x99, 0x9b, 0x9c, 0x9e,
-  0x9e, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9e, 0x9d, 0x9c, 0x9b,
-  0x98, 0x96, 0x93, 0x8e, 0x87, 0x82, 0x7e, 0x77, 0x6f, 0x66, 0x60, 0x5e,
-  0x5b, 0x5b, 0x5b, 0x5d, 0x5e, 0x5f, 0x61, 0x62, 0x62, 0x64, 0x65, 0x67,
-  0x67, 0x69, 0x69, 0x6a, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6f, 0x6f, 0x70,
-  0x70, 0x70, 0x70, 0x6e, 0x6e, 0x6d, 0x6c, 0x68, 0x66, 0x62, 0x5e, 0x5c,
-  0x58, 0x54, 0x4d, 0x48, 0x44, 0x3e, 0x36, 0x2f, 0x27, 0x21, 0x1a, 0x13,
-  0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x13,
-  0x13, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x12, 0x7f, 0x80, 0x82, 0x82,
-  0x82, 0x83, 0x82, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7b,
-  0x79, 0x78, 0x77, 0x76, 0x72, 0x6e, 0x6c, 0x6c, 0x6b, 0x6d, 0x74, 0x79,
-  0x7c, 0x80, 0x85, 0x8a, 0x8c, 0x8e, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x90,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8f, 0x90, 0x92, 0x93, 0x94, 0x95, 0x96,
-  0x97, 0x97, 0x97, 0x96, 0x96, 0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98,
-  0x98, 0x99, 0x99, 0x99, 0x97, 0x97, 0x96, 0x95, 0x93, 0x94, 0x94, 0x94,
-  0x94, 0x93, 0x92, 0x92, 0x92, 0x91, 0x8f, 0x8e, 0x8c, 0x8a, 0x89, 0x89,
-  0x89, 0x89, 0x89, 0x88, 0x85, 0x84, 0x84, 0x84, 0x82, 0x81, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x87,
-  0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8d, 0x8e, 0x8e, 0x8d, 0x8e, 0x90, 0x91,
-  0x92, 0x92, 0x92, 0x91, 0x92, 0x95, 0x95, 0x95, 0x96, 0x95, 0x96, 0x96,
-  0x96, 0x96, 0x98, 0x98, 0x98, 0x99, 0x99, 0x96, 0x95, 0x94, 0x94, 0x92,
-  0x91, 0x91, 0x92, 0x93, 0x94, 0x93, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91,
-  0x91, 0x91, 0x92, 0x91, 0x8f, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8d, 0x8e,
-  0x8e, 0x8e, 0x8e, 0x8e, 0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a,
-  0x88, 0x87, 0x86, 0x86, 0x86, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8d,
-  0x8f, 0x90, 0x92, 0x92, 0x94, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x97,
-  0x98, 0x9a, 0x9a, 0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9b, 0x9a,
-  0x9b, 0x9b, 0x9b, 0x99, 0x99, 0x9a, 0x9c, 0x9d, 0x9f, 0xa0, 0xa1, 0xa1,
-  0xa1, 0x9f, 0x9f, 0xa0, 0x9f, 0x9d, 0x9b, 0x98, 0x95, 0x92, 0x8e, 0x88,
-  0x82, 0x7d, 0x79, 0x72, 0x6a, 0x61, 0x5c, 0x5a, 0x59, 0x59, 0x59, 0x5c,
-  0x5f, 0x61, 0x61, 0x62, 0x62, 0x64, 0x65, 0x67, 0x67, 0x69, 0x69, 0x6a,
-  0x6c, 0x6d, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x6e,
-  0x6e, 0x6e, 0x6c, 0x68, 0x66, 0x62, 0x5c, 0x5a, 0x57, 0x54, 0x4d, 0x48,
-  0x45, 0x3f, 0x36, 0x2d, 0x27, 0x22, 0x1a, 0x13, 0x11, 0x11, 0x10, 0x11,
-  0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x12, 0x13,
-  0x12, 0x12, 0x11, 0x13, 0x80, 0x80, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7b, 0x79, 0x79, 0x78, 0x75,
-  0x70, 0x6c, 0x6b, 0x6b, 0x6a, 0x6c, 0x73, 0x77, 0x7a, 0x7e, 0x83, 0x89,
-  0x8b, 0x8d, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8e, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x97, 0x97, 0x97, 0x98, 0x98,
-  0x97, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x99, 0x99, 0x99,
-  0x99, 0x97, 0x96, 0x95, 0x94, 0x94, 0x94, 0x95, 0x94, 0x94, 0x93, 0x93,
-  0x92, 0x92, 0x90, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x89,
-  0x86, 0x86, 0x85, 0x85, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x82, 0x83, 0x84, 0x87, 0x89, 0x8a, 0x8a, 0x8b,
-  0x8a, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x91, 0x92, 0x92, 0x93, 0x92, 0x92,
-  0x93, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x99, 0x99,
-  0x99, 0x99, 0x99, 0x97, 0x96, 0x96, 0x95, 0x93, 0x92, 0x92, 0x92, 0x93,
-  0x93, 0x93, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x8f, 0x8e, 0x8d, 0x8d, 0x8e,
-  0x8c, 0x8c, 0x8c, 0x8d, 0x8c, 0x8d, 0x8b, 0x89, 0x88, 0x88, 0x87, 0x87,
-  0x87, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8c, 0x8d, 0x8f, 0x8f, 0x91, 0x93,
-  0x95, 0x96, 0x98, 0x99, 0x98, 0x99, 0x99, 0x98, 0x99, 0x9a, 0x9b, 0x9c,
-  0x9d, 0x9d, 0x9c, 0x9d, 0x9d, 0x9b, 0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0x9a,
-  0x9a, 0x9c, 0x9c, 0x9e, 0xa0, 0xa1, 0xa1, 0xa1, 0xa0, 0x9f, 0xa0, 0x9f,
-  0x9f, 0x9d, 0x9a, 0x96, 0x92, 0x8f, 0x8b, 0x84, 0x7d, 0x78, 0x76, 0x6f,
-  0x65, 0x5c, 0x59, 0x58, 0x58, 0x57, 0x59, 0x5c, 0x5f, 0x60, 0x61, 0x61,
-  0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6c, 0x6d,
-  0x6d, 0x6e, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x6f, 0x6e, 0x6e, 0x6c, 0x68,
-  0x64, 0x61, 0x5c, 0x5a, 0x57, 0x54, 0x4d, 0x48, 0x44, 0x3e, 0x38, 0x2e,
-  0x25, 0x21, 0x1b, 0x14, 0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11,
-  0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x12, 0x12, 0x14,
-  0x80, 0x81, 0x82, 0x83, 0x83, 0x84, 0x83, 0x83, 0x82, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7b, 0x79, 0x78, 0x77, 0x74, 0x6f, 0x6c, 0x6b, 0x6a,
-  0x6a, 0x6b, 0x72, 0x76, 0x79, 0x7c, 0x82, 0x88, 0x8b, 0x8c, 0x8e, 0x8f,
-  0x91, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x92, 0x92,
-  0x93, 0x95, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x99, 0x9a, 0x9b, 0x9a,
-  0x9b, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x95, 0x95,
-  0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x91, 0x8e,
-  0x8d, 0x8b, 0x8a, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x87, 0x86, 0x86, 0x85,
-  0x83, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x83, 0x85, 0x87, 0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x8c, 0x8e, 0x8f,
-  0x8f, 0x8f, 0x90, 0x92, 0x92, 0x93, 0x93, 0x93, 0x94, 0x95, 0x95, 0x96,
-  0x96, 0x97, 0x96, 0x97, 0x97, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x97,
-  0x97, 0x96, 0x95, 0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92,
-  0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8e,
-  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8d, 0x8d, 0x8a, 0x88, 0x88, 0x88, 0x87, 0x88, 0x87, 0x87, 0x88, 0x88,
-  0x8a, 0x8a, 0x8c, 0x8e, 0x8f, 0x8f, 0x90, 0x93, 0x95, 0x96, 0x98, 0x99,
-  0x98, 0x99, 0x99, 0x98, 0x99, 0x9a, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x9d,
-  0x9d, 0x9c, 0x9b, 0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e,
-  0xa0, 0xa1, 0xa1, 0xa1, 0xa0, 0x9f, 0xa0, 0x9f, 0x9e, 0x9c, 0x98, 0x94,
-  0x90, 0x8d, 0x89, 0x81, 0x79, 0x75, 0x72, 0x6c, 0x62, 0x5a, 0x58, 0x58,
-  0x58, 0x57, 0x59, 0x5c, 0x5f, 0x60, 0x60, 0x61, 0x64, 0x66, 0x67, 0x67,
-  0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x6d, 0x6c, 0x6d, 0x6e, 0x6e, 0x6e, 0x6f,
-  0x70, 0x70, 0x70, 0x6f, 0x6e, 0x6e, 0x6c, 0x68, 0x63, 0x61, 0x5d, 0x5b,
-  0x57, 0x53, 0x4c, 0x48, 0x45, 0x3f, 0x39, 0x2e, 0x25, 0x20, 0x1b, 0x14,
-  0x11, 0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11,
-  0x11, 0x11, 0x13, 0x13, 0x12, 0x12, 0x13, 0x14, 0x81, 0x82, 0x82, 0x82,
-  0x83, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x7f, 0x7e, 0x7e, 0x7c, 0x7b,
-  0x78, 0x77, 0x76, 0x74, 0x6f, 0x6c, 0x6a, 0x6a, 0x6a, 0x6a, 0x6f, 0x74,
-  0x77, 0x7a, 0x81, 0x87, 0x8a, 0x8b, 0x8c, 0x8e, 0x91, 0x92, 0x91, 0x90,
-  0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x91, 0x92, 0x92, 0x93, 0x95, 0x95, 0x97,
-  0x97, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x9d, 0x9d,
-  0x9c, 0x9b, 0x99, 0x9a, 0x99, 0x98, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95,
-  0x93, 0x94, 0x94, 0x93, 0x92, 0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x89,
-  0x89, 0x89, 0x88, 0x89, 0x87, 0x86, 0x86, 0x85, 0x82, 0x81, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x85, 0x87,
-  0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8c, 0x8e, 0x8f, 0x8f, 0x8f, 0x90, 0x91,
-  0x92, 0x93, 0x94, 0x93, 0x95, 0x95, 0x96, 0x97, 0x97, 0x98, 0x97, 0x97,
-  0x97, 0x98, 0x9a, 0x9a, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x95, 0x94,
-  0x93, 0x93, 0x93, 0x91, 0x91, 0x92, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x90,
-  0x8f, 0x8d, 0x8c, 0x8d, 0x8e, 0x8d, 0x8c, 0x8d, 0x8d, 0x8c, 0x8a, 0x87,
-  0x88, 0x87, 0x87, 0x87, 0x86, 0x87, 0x87, 0x88, 0x8a, 0x8a, 0x8d, 0x8e,
-  0x8e, 0x8f, 0x90, 0x92, 0x94, 0x96, 0x98, 0x99, 0x98, 0x99, 0x98, 0x98,
-  0x98, 0x99, 0x9b, 0x9b, 0x9a, 0x9a, 0x9b, 0x9c, 0x9c, 0x9c, 0x9a, 0x99,
-  0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9d, 0x9e, 0x9e, 0xa0, 0xa0, 0xa1, 0xa2,
-  0xa2, 0xa0, 0xa0, 0x9e, 0x9d, 0x9a, 0x94, 0x90, 0x8c, 0x89, 0x85, 0x7d,
-  0x75, 0x71, 0x6e, 0x66, 0x5c, 0x58, 0x57, 0x57, 0x57, 0x57, 0x5a, 0x5b,
-  0x5e, 0x5e, 0x5f, 0x60, 0x64, 0x65, 0x66, 0x67, 0x67, 0x69, 0x68, 0x69,
-  0x6a, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x70,
-  0x6e, 0x6d, 0x6b, 0x67, 0x63, 0x61, 0x5d, 0x5b, 0x56, 0x51, 0x4b, 0x47,
-  0x45, 0x40, 0x38, 0x2e, 0x25, 0x20, 0x1a, 0x14, 0x11, 0x11, 0x11, 0x10,
-  0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13,
-  0x12, 0x12, 0x13, 0x12, 0x84, 0x84, 0x83, 0x84, 0x84, 0x85, 0x84, 0x84,
-  0x84, 0x83, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x79, 0x76, 0x75, 0x74, 0x72,
-  0x70, 0x6d, 0x6b, 0x6a, 0x6a, 0x6a, 0x6c, 0x70, 0x74, 0x77, 0x7f, 0x84,
-  0x87, 0x88, 0x8a, 0x8e, 0x91, 0x92, 0x92, 0x91, 0x8f, 0x8e, 0x8f, 0x8f,
-  0x8f, 0x90, 0x90, 0x92, 0x93, 0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x99,
-  0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9e, 0x9b, 0x9a, 0x9a,
-  0x9a, 0x9a, 0x98, 0x97, 0x97, 0x97, 0x97, 0x95, 0x93, 0x93, 0x93, 0x93,
-  0x92, 0x91, 0x8f, 0x8d, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89,
-  0x87, 0x85, 0x85, 0x84, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x83, 0x85, 0x87, 0x89, 0x89, 0x89, 0x8a,
-  0x8a, 0x8c, 0x8e, 0x8f, 0x8f, 0x8f, 0x90, 0x91, 0x92, 0x94, 0x94, 0x92,
-  0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x99, 0x98, 0x98, 0x98, 0x99, 0x9a,
-  0x9a, 0x98, 0x97, 0x96, 0x97, 0x97, 0x95, 0x95, 0x93, 0x93, 0x93, 0x91,
-  0x92, 0x92, 0x92, 0x91, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x90,
-  0x90, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8d, 0x8d, 0x8d,
-  0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8a, 0x87, 0x88, 0x87, 0x87, 0x87,
-  0x86, 0x86, 0x87, 0x88, 0x8a, 0x8a, 0x8c, 0x8e, 0x8f, 0x8f, 0x90, 0x93,
-  0x94, 0x96, 0x98, 0x99, 0x98, 0x99, 0x99, 0x98, 0x98, 0x97, 0x99, 0x99,
-  0x99, 0x99, 0x9a, 0x9b, 0x9b, 0x9c, 0x9a, 0x99, 0x9a, 0x9a, 0x9a, 0x99,
-  0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa2, 0xa2, 0xa2, 0xa1, 0x9e, 0x9b,
-  0x9a, 0x97, 0x91, 0x8b, 0x87, 0x84, 0x7e, 0x77, 0x70, 0x6a, 0x66, 0x5f,
-  0x58, 0x56, 0x56, 0x56, 0x57, 0x57, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x60,
-  0x62, 0x64, 0x65, 0x66, 0x66, 0x68, 0x68, 0x69, 0x6b, 0x6d, 0x6c, 0x6d,
-  0x6d, 0x6d, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6d, 0x6b, 0x68,
-  0x65, 0x61, 0x5d, 0x5a, 0x55, 0x50, 0x4b, 0x47, 0x45, 0x40, 0x37, 0x2d,
-  0x26, 0x20, 0x1a, 0x13, 0x12, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13,
-  0x84, 0x85, 0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7e,
-  0x7e, 0x7c, 0x79, 0x77, 0x75, 0x74, 0x73, 0x72, 0x70, 0x6e, 0x6d, 0x6c,
-  0x6a, 0x68, 0x6a, 0x6d, 0x71, 0x75, 0x7b, 0x80, 0x83, 0x85, 0x88, 0x8c,
-  0x8f, 0x92, 0x93, 0x93, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x91, 0x93,
-  0x94, 0x94, 0x96, 0x96, 0x96, 0x97, 0x99, 0x9a, 0x9c, 0x9c, 0x9d, 0x9f,
-  0x9f, 0xa0, 0xa0, 0xa0, 0x9e, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a, 0x9a, 0x98,
-  0x97, 0x97, 0x97, 0x96, 0x96, 0x94, 0x94, 0x94, 0x92, 0x91, 0x8f, 0x8e,
-  0x8e, 0x8d, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x88, 0x87, 0x85, 0x84,
-  0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x86, 0x89, 0x89, 0x89, 0x89, 0x8b, 0x8b, 0x8d, 0x8e,
-  0x90, 0x90, 0x91, 0x92, 0x93, 0x93, 0x94, 0x93, 0x94, 0x95, 0x96, 0x97,
-  0x98, 0x99, 0x99, 0x9a, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x99, 0x98, 0x98,
-  0x97, 0x96, 0x97, 0x96, 0x93, 0x93, 0x93, 0x91, 0x92, 0x92, 0x92, 0x92,
-  0x91, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x90,
-  0x90, 0x8f, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 0x8d,
-  0x8d, 0x8b, 0x8b, 0x89, 0x89, 0x88, 0x87, 0x87, 0x88, 0x88, 0x88, 0x87,
-  0x88, 0x8a, 0x8b, 0x8d, 0x8e, 0x8f, 0x90, 0x93, 0x95, 0x96, 0x97, 0x97,
-  0x98, 0x99, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x99, 0x9a, 0x99, 0x9a,
-  0x9b, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b, 0x99, 0x9a, 0x9b, 0x9b, 0x9c, 0x9e,
-  0xa0, 0xa0, 0xa2, 0xa2, 0xa1, 0xa0, 0x9c, 0x99, 0x97, 0x93, 0x8e, 0x86,
-  0x81, 0x7d, 0x78, 0x73, 0x6a, 0x64, 0x60, 0x5a, 0x55, 0x54, 0x55, 0x56,
-  0x57, 0x57, 0x58, 0x5a, 0x5c, 0x5d, 0x5d, 0x5f, 0x62, 0x64, 0x65, 0x65,
-  0x67, 0x67, 0x69, 0x6a, 0x6c, 0x6d, 0x6d, 0x6d, 0x6e, 0x6f, 0x6f, 0x71,
-  0x71, 0x71, 0x70, 0x6f, 0x6d, 0x6c, 0x6b, 0x67, 0x64, 0x5e, 0x5b, 0x58,
-  0x56, 0x51, 0x4b, 0x47, 0x44, 0x3f, 0x38, 0x30, 0x26, 0x20, 0x1a, 0x14,
-  0x12, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x11, 0x12, 0x12, 0x13, 0x13, 0x12, 0x86, 0x86, 0x87, 0x87,
-  0x86, 0x85, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7d, 0x7c, 0x7b, 0x77, 0x76,
-  0x75, 0x74, 0x74, 0x72, 0x70, 0x70, 0x6e, 0x6d, 0x6a, 0x68, 0x69, 0x6b,
-  0x6d, 0x72, 0x78, 0x7d, 0x81, 0x83, 0x87, 0x8a, 0x8e, 0x92, 0x93, 0x93,
-  0x93, 0x93, 0x92, 0x91, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x95,
-  0x96, 0x97, 0x99, 0x9b, 0x9d, 0x9d, 0x9e, 0xa0, 0xa1, 0xa1, 0xa1, 0xa1,
-  0x9f, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b, 0x9b, 0x99, 0x98, 0x99, 0x98, 0x96,
-  0x96, 0x94, 0x94, 0x94, 0x93, 0x92, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b,
-  0x8b, 0x8a, 0x89, 0x8a, 0x89, 0x87, 0x86, 0x85, 0x82, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x84, 0x84, 0x86,
-  0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8d, 0x8e, 0x90, 0x90, 0x91, 0x93,
-  0x93, 0x94, 0x95, 0x94, 0x95, 0x95, 0x96, 0x97, 0x98, 0x9a, 0x9a, 0x9a,
-  0x99, 0x9a, 0x9b, 0x9a, 0x9a, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97,
-  0x93, 0x92, 0x92, 0x91, 0x91, 0x93, 0x93, 0x92, 0x91, 0x92, 0x92, 0x91,
-  0x91, 0x90, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x8e, 0x8f,
-  0x8f, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x8d, 0x8e, 0x8e, 0x8c, 0x8a, 0x89,
-  0x89, 0x89, 0x89, 0x87, 0x88, 0x88, 0x88, 0x87, 0x89, 0x89, 0x8b, 0x8d,
-  0x8e, 0x8f, 0x91, 0x94, 0x96, 0x96, 0x97, 0x97, 0x98, 0x99, 0x99, 0x99,
-  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x9b, 0x9a, 0x99, 0x99,
-  0x9b, 0x9b, 0x99, 0x9a, 0x9b, 0x9b, 0x9c, 0x9f, 0xa0, 0xa0, 0xa1, 0xa2,
-  0xa0, 0x9d, 0x9a, 0x97, 0x94, 0x8f, 0x89, 0x81, 0x7b, 0x78, 0x74, 0x6e,
-  0x65, 0x60, 0x5c, 0x58, 0x55, 0x54, 0x55, 0x56, 0x57, 0x57, 0x57, 0x59,
-  0x5c, 0x5d, 0x5d, 0x5f, 0x61, 0x64, 0x64, 0x64, 0x67, 0x68, 0x68, 0x69,
-  0x6b, 0x6c, 0x6d, 0x6d, 0x6d, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x70, 0x6f,
-  0x6e, 0x6c, 0x6b, 0x68, 0x64, 0x5e, 0x5a, 0x58, 0x56, 0x52, 0x4b, 0x47,
-  0x45, 0x40, 0x39, 0x31, 0x27, 0x21, 0x1b, 0x14, 0x12, 0x11, 0x10, 0x10,
-  0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12,
-  0x12, 0x12, 0x13, 0x13, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84,
-  0x83, 0x82, 0x80, 0x7d, 0x7c, 0x7a, 0x77, 0x75, 0x76, 0x75, 0x74, 0x72,
-  0x70, 0x6f, 0x6e, 0x6d, 0x6b, 0x69, 0x68, 0x69, 0x6b, 0x6f, 0x76, 0x7c,
-  0x80, 0x82, 0x86, 0x89, 0x8e, 0x91, 0x93, 0x93, 0x95, 0x95, 0x93, 0x92,
-  0x91, 0x92, 0x92, 0x93, 0x93, 0x95, 0x96, 0x95, 0x96, 0x97, 0x99, 0x9b,
-  0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa1, 0xa1, 0xa0, 0x9e, 0x9e, 0x9e,
-  0x9d, 0x9c, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x97, 0x96, 0x94, 0x94, 0x94,
-  0x93, 0x91, 0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x8b, 0x8a, 0x8a, 0x8a,
-  0x89, 0x87, 0x85, 0x84, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x82, 0x83, 0x84, 0x84, 0x84, 0x86, 0x89, 0x89, 0x89, 0x8a,
-  0x8b, 0x8b, 0x8d, 0x8e, 0x90, 0x90, 0x92, 0x93, 0x93, 0x94, 0x95, 0x95,
-  0x95, 0x95, 0x96, 0x97, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a,
-  0x9a, 0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x96, 0x93, 0x92, 0x92, 0x92,
-  0x92, 0x93, 0x93, 0x92, 0x91, 0x92, 0x92, 0x91, 0x91, 0x90, 0x90, 0x90,
-  0x91, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x90,
-  0x90, 0x8e, 0x8e, 0x8f, 0x8e, 0x8d, 0x8b, 0x89, 0x89, 0x89, 0x88, 0x87,
-  0x88, 0x88, 0x88, 0x87, 0x89, 0x89, 0x8b, 0x8d, 0x8d, 0x8f, 0x91, 0x94,
-  0x95, 0x96, 0x96, 0x97, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98,
-  0x98, 0x98, 0x99, 0x9a, 0x9b, 0x9a, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x9a,
-  0x9b, 0x9b, 0x9c, 0x9f, 0xa0, 0xa1, 0xa1, 0xa1, 0xa0, 0x9d, 0x99, 0x95,
-  0x92, 0x8d, 0x86, 0x7e, 0x79, 0x75, 0x72, 0x6b, 0x61, 0x5d, 0x5a, 0x57,
-  0x54, 0x54, 0x56, 0x57, 0x58, 0x57, 0x58, 0x5a, 0x5c, 0x5d, 0x5d, 0x5f,
-  0x61, 0x64, 0x64, 0x64, 0x67, 0x68, 0x67, 0x68, 0x6b, 0x6c, 0x6d, 0x6d,
-  0x6d, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x70, 0x6f, 0x6e, 0x6c, 0x6b, 0x68,
-  0x64, 0x5e, 0x5b, 0x58, 0x56, 0x52, 0x4c, 0x47, 0x45, 0x41, 0x38, 0x31,
-  0x28, 0x22, 0x1b, 0x14, 0x12, 0x11, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11,
-  0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12, 0x13, 0x12,
-  0x88, 0x88, 0x87, 0x86, 0x86, 0x87, 0x86, 0x84, 0x83, 0x82, 0x7f, 0x7c,
-  0x7a, 0x79, 0x76, 0x75, 0x75, 0x75, 0x74, 0x72, 0x6f, 0x6e, 0x6f, 0x6f,
-  0x6d, 0x69, 0x67, 0x68, 0x69, 0x6c, 0x74, 0x7a, 0x7e, 0x81, 0x83, 0x88,
-  0x8d, 0x91, 0x93, 0x94, 0x97, 0x97, 0x95, 0x93, 0x92, 0x92, 0x93, 0x94,
-  0x94, 0x94, 0x94, 0x94, 0x95, 0x96, 0x98, 0x9b, 0x9d, 0x9e, 0x9f, 0xa1,
-  0xa2, 0xa3, 0xa2, 0xa1, 0xa1, 0x9e, 0x9e, 0x9e, 0x9d, 0x9c, 0x9c, 0x9a,
-  0x99, 0x9a, 0x99, 0x98, 0x96, 0x94, 0x94, 0x93, 0x91, 0x90, 0x8f, 0x90,
-  0x8f, 0x8e, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x86, 0x85, 0x83,
-  0x82, 0x81, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x82, 0x83,
-  0x84, 0x84, 0x84, 0x86, 0x87, 0x87, 0x88, 0x89, 0x8b, 0x8b, 0x8d, 0x8e,
-  0x90, 0x91, 0x93, 0x94, 0x94, 0x94, 0x95, 0x94, 0x95, 0x96, 0x96, 0x97,
-  0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9a, 0x99, 0x99,
-  0x98, 0x97, 0x98, 0x97, 0x93, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x92,
-  0x91, 0x92, 0x92, 0x91, 0x91, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91,
-  0x91, 0x8f, 0x8f, 0x90, 0x90, 0x8e, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x90,
-  0x8f, 0x8d, 0x8b, 0x89, 0x89, 0x88, 0x86, 0x86, 0x88, 0x88, 0x88, 0x87,
-  0x89, 0x8a, 0x8b, 0x8d, 0x8e, 0x8f, 0x91, 0x93, 0x94, 0x95, 0x95, 0x97,
-  0x99, 0x9a, 0x9a, 0x99, 0x98, 0x97, 0x97, 0x97, 0x98, 0x98, 0x9a, 0x9b,
-  0x9b, 0x9a, 0x99, 0x98, 0x99, 0x99, 0x9a, 0x9b, 0x9b, 0x9b, 0x9c, 0x9e,
-  0x9f, 0xa0, 0xa1, 0xa0, 0x9e, 0x9b, 0x97, 0x93, 0x90, 0x8a, 0x83, 0x7c,
-  0x76, 0x73, 0x6f, 0x66, 0x5d, 0x5a, 0x58, 0x56, 0x54, 0x54, 0x56, 0x58,
-  0x59, 0x58, 0x5a, 0x5b, 0x5c, 0x5d, 0x5d, 0x5f, 0x62, 0x63, 0x63, 0x63,
-  0x66, 0x67, 0x67, 0x67, 0x6a, 0x6c, 0x6d, 0x6d, 0x6d, 0x6f, 0x70, 0x70,
-  0x70, 0x70, 0x70, 0x6f, 0x6e, 0x6c, 0x6b, 0x68, 0x62, 0x5f, 0x5a, 0x58,
-  0x56, 0x52, 0x4c, 0x48, 0x45, 0x41, 0x39, 0x30, 0x28, 0x22, 0x1b, 0x14,
-  0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12, 0x11, 0x8a, 0x8a, 0x89, 0x88,
-  0x88, 0x87, 0x85, 0x83, 0x82, 0x7f, 0x7c, 0x7a, 0x78, 0x77, 0x76, 0x73,
-  0x73, 0x73, 0x73, 0x72, 0x70, 0x6f, 0x6f, 0x6f, 0x6d, 0x69, 0x67, 0x66,
-  0x68, 0x6a, 0x70, 0x77, 0x7a, 0x7d, 0x80, 0x86, 0x8c, 0x90, 0x93, 0x95,
-  0x98, 0x98, 0x97, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93,
-  0x94, 0x96, 0x98, 0x9b, 0x9d, 0x9e, 0x9f, 0xa1, 0xa2, 0xa4, 0xa3, 0xa3,
-  0xa2, 0xa1, 0x9f, 0xa0, 0x9f, 0x9e, 0x9c, 0x9b, 0x9a, 0x99, 0x99, 0x98,
-  0x96, 0x94, 0x93, 0x92, 0x91, 0x8f, 0x90, 0x90, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8c, 0x8a, 0x8a, 0x87, 0x86, 0x86, 0x83, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x82, 0x81, 0x83, 0x83, 0x83, 0x85,
-  0x86, 0x86, 0x87, 0x89, 0x8b, 0x8b, 0x8d, 0x8e, 0x90, 0x92, 0x94, 0x94,
-  0x95, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97, 0x97, 0x99, 0x9b, 0x9a, 0x9a,
-  0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x98, 0x99, 0x99, 0x98, 0x98, 0x97,
-  0x97, 0x96, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x91, 0x92, 0x92, 0x91,
-  0x91, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90,
-  0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8d, 0x8d, 0x8b,
-  0x8a, 0x89, 0x87, 0x86, 0x88, 0x88, 0x88, 0x87, 0x89, 0x8b, 0x8c, 0x8d,
-  0x8e, 0x8e, 0x90, 0x92, 0x93, 0x94, 0x95, 0x96, 0x99, 0x99, 0x98, 0x97,
-  0x97, 0x96, 0x95, 0x96, 0x97, 0x98, 0x99, 0x99, 0x99, 0x99, 0x98, 0x97,
-  0x98, 0x99, 0x9a, 0x99, 0x9a, 0x9c, 0x9e, 0x9f, 0x9f, 0xa0, 0xa0, 0x9e,
-  0x9c, 0x98, 0x93, 0x8f, 0x8b, 0x84, 0x7d, 0x77, 0x72, 0x6f, 0x69, 0x61,
-  0x5a, 0x58, 0x58, 0x56, 0x54, 0x54, 0x56, 0x57, 0x59, 0x5b, 0x5b, 0x5b,
-  0x5c, 0x5d, 0x5e, 0x60, 0x60, 0x62, 0x62, 0x62, 0x64, 0x64, 0x66, 0x67,
-  0x69, 0x6a, 0x6d, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x6f,
-  0x6e, 0x6c, 0x6b, 0x68, 0x62, 0x5f, 0x5a, 0x58, 0x56, 0x52, 0x4c, 0x47,
-  0x44, 0x40, 0x38, 0x30, 0x29, 0x24, 0x1c, 0x14, 0x12, 0x11, 0x10, 0x10,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12,
-  0x11, 0x11, 0x12, 0x11, 0x8c, 0x8b, 0x8a, 0x88, 0x88, 0x86, 0x84, 0x81,
-  0x80, 0x7d, 0x79, 0x78, 0x77, 0x76, 0x75, 0x72, 0x72, 0x72, 0x72, 0x71,
-  0x6f, 0x6f, 0x6e, 0x6e, 0x6b, 0x68, 0x65, 0x65, 0x65, 0x67, 0x6c, 0x72,
-  0x77, 0x7a, 0x7e, 0x84, 0x8b, 0x90, 0x92, 0x95, 0x99, 0x9a, 0x99, 0x98,
-  0x96, 0x95, 0x95, 0x95, 0x95, 0x94, 0x93, 0x94, 0x95, 0x96, 0x98, 0x9b,
-  0x9d, 0x9e, 0x9f, 0xa0, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa1, 0xa0, 0xa0,
-  0xa0, 0x9f, 0x9d, 0x9c, 0x9b, 0x9b, 0x9a, 0x98, 0x95, 0x93, 0x94, 0x93,
-  0x91, 0x8f, 0x90, 0x90, 0x8f, 0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x8b, 0x8b,
-  0x88, 0x86, 0x85, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x86, 0x86, 0x86, 0x89,
-  0x8a, 0x8b, 0x8d, 0x8e, 0x91, 0x92, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95,
-  0x96, 0x97, 0x97, 0x97, 0x99, 0x9b, 0x9a, 0x99, 0x9a, 0x9b, 0x9b, 0x9b,
-  0x9b, 0x9a, 0x9a, 0x9a, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x95, 0x93,
-  0x92, 0x92, 0x92, 0x92, 0x91, 0x91, 0x92, 0x91, 0x91, 0x8f, 0x90, 0x8f,
-  0x90, 0x90, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x90, 0x8e, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8e, 0x8e, 0x8c, 0x8b, 0x89, 0x87, 0x87,
-  0x88, 0x87, 0x87, 0x87, 0x89, 0x8b, 0x8c, 0x8d, 0x8e, 0x8e, 0x90, 0x92,
-  0x93, 0x93, 0x95, 0x96, 0x98, 0x99, 0x98, 0x98, 0x97, 0x96, 0x97, 0x97,
-  0x96, 0x96, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x99, 0x9a, 0x9a, 0x99,
-  0x9a, 0x9c, 0x9d, 0x9d, 0xa0, 0x9f, 0x9d, 0x9b, 0x99, 0x94, 0x8d, 0x89,
-  0x85, 0x7e, 0x77, 0x70, 0x6c, 0x68, 0x62, 0x5c, 0x59, 0x58, 0x58, 0x57,
-  0x56, 0x56, 0x57, 0x58, 0x59, 0x5b, 0x5a, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f,
-  0x61, 0x62, 0x62, 0x63, 0x64, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6c, 0x6d,
-  0x6d, 0x6c, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x6f, 0x6d, 0x6b, 0x6a, 0x68,
-  0x62, 0x5f, 0x5a, 0x58, 0x56, 0x52, 0x4c, 0x47, 0x44, 0x3f, 0x38, 0x30,
-  0x29, 0x24, 0x1c, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x13, 0x12, 0x12, 0x12, 0x11, 0x10, 0x11, 0x13,
-  0x8e, 0x8c, 0x8b, 0x8a, 0x88, 0x86, 0x84, 0x82, 0x7f, 0x7c, 0x79, 0x77,
-  0x76, 0x76, 0x75, 0x73, 0x72, 0x70, 0x70, 0x71, 0x6f, 0x6f, 0x6d, 0x6c,
-  0x69, 0x68, 0x66, 0x63, 0x63, 0x64, 0x68, 0x6e, 0x74, 0x78, 0x7c, 0x81,
-  0x89, 0x8e, 0x91, 0x94, 0x99, 0x9a, 0x9a, 0x99, 0x98, 0x96, 0x96, 0x95,
-  0x95, 0x93, 0x93, 0x95, 0x95, 0x96, 0x98, 0x9b, 0x9d, 0x9e, 0x9f, 0xa0,
-  0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0x9e, 0x9c,
-  0x9c, 0x9b, 0x9b, 0x98, 0x96, 0x94, 0x94, 0x93, 0x90, 0x8f, 0x8e, 0x8f,
-  0x8f, 0x8e, 0x8e, 0x8f, 0x8f, 0x8e, 0x8c, 0x8c, 0x89, 0x85, 0x83, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x82, 0x82,
-  0x82, 0x83, 0x84, 0x85, 0x87, 0x87, 0x87, 0x87, 0x8a, 0x8c, 0x8c, 0x8e,
-  0x90, 0x92, 0x93, 0x93, 0x94, 0x96, 0x95, 0x96, 0x97, 0x98, 0x98, 0x98,
-  0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a, 0x9a,
-  0x99, 0x99, 0x99, 0x97, 0x97, 0x96, 0x95, 0x95, 0x93, 0x93, 0x93, 0x93,
-  0x92, 0x92, 0x91, 0x90, 0x90, 0x91, 0x90, 0x90, 0x91, 0x91, 0x90, 0x91,
-  0x90, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8b, 0x89, 0x87, 0x87, 0x87, 0x87, 0x87,
-  0x88, 0x8a, 0x8a, 0x8c, 0x8d, 0x8e, 0x90, 0x91, 0x93, 0x94, 0x95, 0x96,
-  0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x96, 0x96, 0x95, 0x95, 0x97, 0x97,
-  0x96, 0x95, 0x96, 0x98, 0x99, 0x99, 0x9a, 0x9a, 0x9b, 0x9d, 0x9e, 0x9e,
-  0x9f, 0x9e, 0x9b, 0x99, 0x96, 0x91, 0x8a, 0x85, 0x81, 0x7b, 0x74, 0x6d,
-  0x67, 0x63, 0x5e, 0x5a, 0x58, 0x58, 0x57, 0x57, 0x56, 0x57, 0x57, 0x58,
-  0x59, 0x5b, 0x5c, 0x5b, 0x5c, 0x5d, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x64,
-  0x65, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6b, 0x6b, 0x6c, 0x6e, 0x6f, 0x70,
-  0x70, 0x70, 0x70, 0x6f, 0x6d, 0x6b, 0x69, 0x66, 0x63, 0x5e, 0x5b, 0x5a,
-  0x56, 0x52, 0x4d, 0x47, 0x44, 0x3f, 0x37, 0x30, 0x29, 0x24, 0x1d, 0x14,
-  0x11, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12,
-  0x13, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x12, 0x8f, 0x8c, 0x8b, 0x8a,
-  0x88, 0x85, 0x83, 0x81, 0x7f, 0x7c, 0x78, 0x77, 0x76, 0x75, 0x73, 0x73,
-  0x71, 0x70, 0x6f, 0x70, 0x70, 0x70, 0x6d, 0x6b, 0x69, 0x68, 0x65, 0x62,
-  0x62, 0x63, 0x66, 0x6c, 0x72, 0x76, 0x7b, 0x81, 0x88, 0x8d, 0x90, 0x93,
-  0x99, 0x9a, 0x9a, 0x99, 0x98, 0x96, 0x96, 0x95, 0x94, 0x92, 0x93, 0x95,
-  0x95, 0x95, 0x98, 0x9a, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa3, 0xa3, 0xa3,
-  0xa3, 0xa2, 0xa2, 0xa0, 0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0x9b, 0x9a, 0x98,
-  0x96, 0x94, 0x94, 0x93, 0x91, 0x90, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x90,
-  0x8f, 0x8e, 0x8d, 0x8c, 0x88, 0x84, 0x82, 0x82, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x84, 0x85,
-  0x87, 0x87, 0x87, 0x87, 0x8a, 0x8c, 0x8d, 0x8e, 0x90, 0x91, 0x93, 0x93,
-  0x95, 0x95, 0x96, 0x96, 0x98, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x9b, 0x9b,
-  0x9b, 0x9a, 0x9b, 0x9c, 0x9c, 0x9c, 0x9a, 0x9a, 0x9a, 0x9a, 0x99, 0x97,
-  0x97, 0x96, 0x96, 0x96, 0x94, 0x94, 0x94, 0x94, 0x93, 0x92, 0x90, 0x90,
-  0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90,
-  0x91, 0x90, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8c,
-  0x8c, 0x8c, 0x8a, 0x88, 0x86, 0x87, 0x87, 0x87, 0x87, 0x89, 0x8a, 0x8b,
-  0x8c, 0x8e, 0x90, 0x91, 0x92, 0x93, 0x95, 0x96, 0x96, 0x97, 0x96, 0x97,
-  0x97, 0x95, 0x96, 0x96, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x96, 0x98,
-  0x98, 0x99, 0x9a, 0x9a, 0x9c, 0x9e, 0x9e, 0x9e, 0x9e, 0x9c, 0x9a, 0x98,
-  0x94, 0x8f, 0x88, 0x83, 0x7f, 0x79, 0x71, 0x6a, 0x64, 0x60, 0x5c, 0x59,
-  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x5a, 0x5b, 0x5c, 0x5b,
-  0x5c, 0x5d, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x64, 0x64, 0x64, 0x66, 0x67,
-  0x68, 0x68, 0x6b, 0x6b, 0x6b, 0x6e, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x6f,
-  0x6c, 0x6a, 0x68, 0x66, 0x63, 0x5e, 0x5c, 0x5a, 0x56, 0x52, 0x4d, 0x47,
-  0x43, 0x3f, 0x37, 0x30, 0x28, 0x23, 0x1d, 0x14, 0x11, 0x10, 0x10, 0x10,
-  0x11, 0x10, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x11,
-  0x11, 0x10, 0x11, 0x12, 0x90, 0x8d, 0x8b, 0x89, 0x87, 0x84, 0x82, 0x7f,
-  0x7d, 0x7a, 0x76, 0x76, 0x75, 0x74, 0x72, 0x72, 0x70, 0x6e, 0x6e, 0x6f,
-  0x6e, 0x6e, 0x6b, 0x69, 0x68, 0x68, 0x65, 0x63, 0x62, 0x61, 0x62, 0x68,
-  0x6f, 0x73, 0x78, 0x7e, 0x85, 0x8b, 0x8e, 0x91, 0x97, 0x9a, 0x9a, 0x9a,
-  0x99, 0x97, 0x97, 0x96, 0x95, 0x93, 0x93, 0x95, 0x95, 0x95, 0x96, 0x9a,
-  0x9c, 0x9e, 0x9f, 0xa0, 0xa1, 0xa3, 0xa3, 0xa4, 0xa4, 0xa2, 0xa2, 0xa1,
-  0xa0, 0x9f, 0x9f, 0x9d, 0x9d, 0x9b, 0x9a, 0x99, 0x96, 0x94, 0x94, 0x93,
-  0x92, 0x8f, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8d, 0x8b,
-  0x87, 0x83, 0x82, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86,
-  0x89, 0x8c, 0x8d, 0x8e, 0x90, 0x91, 0x93, 0x93, 0x95, 0x95, 0x96, 0x97,
-  0x97, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a, 0x9c, 0x9d,
-  0x9c, 0x9c, 0x9a, 0x9a, 0x9a, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x97,
-  0x94, 0x94, 0x94, 0x94, 0x93, 0x91, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x90,
-  0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91,
-  0x90, 0x91, 0x90, 0x90, 0x8f, 0x8e, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x89,
-  0x87, 0x87, 0x87, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x90, 0x90,
-  0x91, 0x92, 0x94, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95,
-  0x94, 0x94, 0x96, 0x97, 0x97, 0x96, 0x96, 0x98, 0x97, 0x98, 0x99, 0x99,
-  0x9b, 0x9d, 0x9d, 0x9d, 0x9c, 0x9a, 0x97, 0x95, 0x92, 0x8b, 0x84, 0x7e,
-  0x7a, 0x74, 0x6d, 0x65, 0x60, 0x5d, 0x5a, 0x59, 0x57, 0x57, 0x57, 0x58,
-  0x58, 0x58, 0x59, 0x59, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5f, 0x60,
-  0x60, 0x61, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x67, 0x67, 0x6a, 0x6b,
-  0x6b, 0x6d, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x6f, 0x6c, 0x6a, 0x68, 0x66,
-  0x63, 0x5e, 0x5c, 0x59, 0x56, 0x52, 0x4d, 0x47, 0x44, 0x3f, 0x36, 0x31,
-  0x29, 0x24, 0x1c, 0x14, 0x11, 0x10, 0x10, 0x11, 0x11, 0x10, 0x10, 0x10,
-  0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x91, 0x8e, 0x8b, 0x89, 0x87, 0x83, 0x80, 0x7d, 0x7b, 0x78, 0x76, 0x74,
-  0x73, 0x72, 0x71, 0x70, 0x6f, 0x6d, 0x6d, 0x6e, 0x6d, 0x6b, 0x69, 0x68,
-  0x66, 0x66, 0x64, 0x62, 0x61, 0x60, 0x61, 0x66, 0x6c, 0x70, 0x75, 0x7d,
-  0x84, 0x89, 0x8c, 0x8f, 0x95, 0x98, 0x9a, 0x9a, 0x9b, 0x99, 0x97, 0x97,
-  0x97, 0x95, 0x93, 0x94, 0x94, 0x94, 0x95, 0x99, 0x9b, 0x9e, 0x9f, 0x9f,
-  0xa1, 0xa3, 0xa3, 0xa4, 0xa5, 0xa5, 0xa4, 0xa2, 0xa1, 0xa1, 0xa0, 0x9f,
-  0x9d, 0x9a, 0x99, 0x98, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0x90, 0x8f,
-  0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8c, 0x89, 0x87, 0x85, 0x83, 0x82,
-  0x81, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x87, 0x89, 0x8c, 0x8c, 0x8e,
-  0x90, 0x91, 0x93, 0x93, 0x95, 0x95, 0x95, 0x96, 0x97, 0x98, 0x99, 0x99,
-  0x9a, 0x9a, 0x9a, 0x9a, 0x99, 0x9a, 0x9d, 0x9d, 0x9d, 0x9c, 0x9d, 0x9c,
-  0x9a, 0x99, 0x9a, 0x99, 0x99, 0x98, 0x98, 0x97, 0x95, 0x93, 0x93, 0x93,
-  0x92, 0x92, 0x92, 0x92, 0x91, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x91,
-  0x90, 0x90, 0x91, 0x92, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x91, 0x91,
-  0x90, 0x8f, 0x8f, 0x8d, 0x8d, 0x8b, 0x8a, 0x8a, 0x88, 0x89, 0x88, 0x88,
-  0x87, 0x89, 0x89, 0x8b, 0x8c, 0x8d, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x95,
-  0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x95, 0x94, 0x94, 0x95, 0x96,
-  0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x99, 0x99, 0x9a, 0x9a, 0x9b, 0x9c,
-  0x9b, 0x97, 0x94, 0x92, 0x8e, 0x86, 0x7e, 0x78, 0x73, 0x6d, 0x67, 0x5f,
-  0x5b, 0x5a, 0x58, 0x59, 0x58, 0x59, 0x59, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b,
-  0x5b, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f, 0x5f, 0x61, 0x61, 0x61, 0x62,
-  0x62, 0x65, 0x66, 0x66, 0x66, 0x67, 0x69, 0x6b, 0x6b, 0x6c, 0x6d, 0x6f,
-  0x6f, 0x6f, 0x6f, 0x6f, 0x6d, 0x6b, 0x69, 0x67, 0x64, 0x5e, 0x5c, 0x59,
-  0x55, 0x50, 0x4b, 0x47, 0x44, 0x40, 0x38, 0x31, 0x2c, 0x26, 0x1d, 0x15,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x13, 0x11, 0x90, 0x8d, 0x8b, 0x89,
-  0x86, 0x82, 0x7f, 0x7c, 0x7a, 0x78, 0x76, 0x72, 0x70, 0x70, 0x70, 0x70,
-  0x6e, 0x6d, 0x6c, 0x6c, 0x6b, 0x68, 0x67, 0x66, 0x66, 0x65, 0x64, 0x62,
-  0x61, 0x61, 0x62, 0x64, 0x68, 0x6b, 0x72, 0x7a, 0x82, 0x87, 0x8a, 0x8f,
-  0x93, 0x96, 0x98, 0x9a, 0x9b, 0x9a, 0x99, 0x98, 0x97, 0x96, 0x93, 0x93,
-  0x92, 0x93, 0x95, 0x97, 0x9b, 0x9e, 0x9f, 0xa0, 0xa1, 0xa4, 0xa4, 0xa5,
-  0xa6, 0xa6, 0xa5, 0xa4, 0xa3, 0xa1, 0x9f, 0x9e, 0x9d, 0x9b, 0x99, 0x98,
-  0x95, 0x94, 0x93, 0x92, 0x90, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x90,
-  0x8f, 0x8e, 0x8c, 0x89, 0x87, 0x85, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x83,
-  0x83, 0x85, 0x86, 0x87, 0x88, 0x8b, 0x8b, 0x8c, 0x8e, 0x91, 0x93, 0x94,
-  0x94, 0x95, 0x95, 0x96, 0x98, 0x98, 0x99, 0x99, 0x9b, 0x9b, 0x9a, 0x9a,
-  0x9a, 0x9c, 0x9e, 0x9e, 0x9d, 0x9d, 0x9d, 0x9b, 0x9b, 0x9c, 0x9b, 0x9a,
-  0x9a, 0x98, 0x98, 0x97, 0x95, 0x94, 0x93, 0x92, 0x93, 0x92, 0x93, 0x93,
-  0x92, 0x91, 0x92, 0x92, 0x91, 0x90, 0x90, 0x91, 0x92, 0x91, 0x92, 0x93,
-  0x93, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92, 0x91, 0x91, 0x8f, 0x90, 0x8e,
-  0x8d, 0x8d, 0x8c, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x8a, 0x8b, 0x8a, 0x8b,
-  0x8c, 0x8d, 0x8f, 0x8f, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x96, 0x95,
-  0x96, 0x94, 0x94, 0x95, 0x96, 0x95, 0x96, 0x95, 0x95, 0x95, 0x96, 0x96,
-  0x97, 0x97, 0x97, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x99, 0x95, 0x91, 0x8e,
-  0x89, 0x81, 0x78, 0x72, 0x6e, 0x68, 0x60, 0x5b, 0x5a, 0x59, 0x57, 0x57,
-  0x58, 0x59, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5b, 0x5c, 0x5f,
-  0x60, 0x60, 0x60, 0x60, 0x61, 0x60, 0x5f, 0x60, 0x62, 0x64, 0x65, 0x65,
-  0x65, 0x67, 0x68, 0x6a, 0x6a, 0x6b, 0x6c, 0x6e, 0x6d, 0x6e, 0x6f, 0x6f,
-  0x6e, 0x6d, 0x6b, 0x68, 0x65, 0x61, 0x5c, 0x59, 0x56, 0x50, 0x4c, 0x49,
-  0x46, 0x41, 0x3a, 0x32, 0x2c, 0x27, 0x1f, 0x16, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x11,
-  0x12, 0x12, 0x12, 0x13, 0x8f, 0x8c, 0x8a, 0x88, 0x85, 0x81, 0x7e, 0x7b,
-  0x7a, 0x78, 0x75, 0x71, 0x70, 0x6f, 0x6f, 0x6f, 0x6e, 0x6b, 0x6a, 0x6a,
-  0x69, 0x67, 0x65, 0x65, 0x64, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63,
-  0x65, 0x68, 0x6f, 0x77, 0x7f, 0x85, 0x88, 0x8d, 0x92, 0x95, 0x98, 0x99,
-  0x9b, 0x9b, 0x9b, 0x99, 0x98, 0x97, 0x94, 0x93, 0x92, 0x93, 0x94, 0x96,
-  0x9a, 0x9d, 0x9e, 0x9f, 0xa1, 0xa3, 0xa4, 0xa5, 0xa6, 0xa5, 0xa6, 0xa4,
-  0xa4, 0xa3, 0xa0, 0x9f, 0x9d, 0x9b, 0x99, 0x99, 0x96, 0x94, 0x93, 0x92,
-  0x90, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x90, 0x90, 0x8f, 0x8f, 0x8c, 0x8a,
-  0x87, 0x84, 0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x80, 0x82, 0x81, 0x80, 0x80, 0x82, 0x83, 0x84, 0x86, 0x86,
-  0x87, 0x8a, 0x8b, 0x8c, 0x8e, 0x91, 0x93, 0x94, 0x95, 0x95, 0x96, 0x97,
-  0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9b, 0x9d, 0x9d, 0x9d,
-  0x9d, 0x9d, 0x9d, 0x9b, 0x9c, 0x9c, 0x9c, 0x9a, 0x9b, 0x99, 0x99, 0x98,
-  0x97, 0x95, 0x94, 0x93, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92,
-  0x92, 0x91, 0x91, 0x93, 0x93, 0x92, 0x92, 0x94, 0x94, 0x93, 0x93, 0x93,
-  0x93, 0x94, 0x93, 0x92, 0x92, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8c, 0x8a,
-  0x8b, 0x8a, 0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x8b, 0x8c, 0x8c, 0x8e, 0x8f,
-  0x90, 0x92, 0x93, 0x95, 0x96, 0x96, 0x96, 0x95, 0x96, 0x94, 0x94, 0x95,
-  0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x96, 0x95, 0x96, 0x96, 0x96, 0x99,
-  0x9b, 0x9b, 0x9a, 0x99, 0x97, 0x93, 0x8f, 0x8b, 0x84, 0x7b, 0x73, 0x6d,
-  0x69, 0x62, 0x5c, 0x5a, 0x59, 0x58, 0x57, 0x57, 0x57, 0x58, 0x59, 0x59,
-  0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x5d, 0x60, 0x61, 0x61, 0x5f, 0x60,
-  0x61, 0x60, 0x60, 0x61, 0x61, 0x63, 0x64, 0x64, 0x64, 0x65, 0x67, 0x68,
-  0x68, 0x69, 0x6b, 0x6d, 0x6e, 0x6e, 0x6f, 0x6f, 0x6e, 0x6e, 0x6c, 0x69,
-  0x67, 0x62, 0x5c, 0x59, 0x56, 0x52, 0x4d, 0x4a, 0x46, 0x41, 0x3b, 0x34,
-  0x2b, 0x27, 0x1f, 0x16, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11,
-  0x12, 0x12, 0x12, 0x11, 0x11, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x13,
-  0x90, 0x8c, 0x89, 0x87, 0x84, 0x80, 0x7c, 0x7a, 0x79, 0x77, 0x74, 0x70,
-  0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6b, 0x6a, 0x69, 0x68, 0x66, 0x64, 0x64,
-  0x63, 0x62, 0x62, 0x62, 0x62, 0x61, 0x62, 0x62, 0x64, 0x66, 0x6c, 0x75,
-  0x7d, 0x83, 0x87, 0x8b, 0x90, 0x93, 0x96, 0x98, 0x9a, 0x9b, 0x9b, 0x9a,
-  0x99, 0x97, 0x95, 0x94, 0x93, 0x93, 0x93, 0x95, 0x99, 0x9c, 0x9d, 0x9f,
-  0xa1, 0xa2, 0xa4, 0xa5, 0xa7, 0xa6, 0xa6, 0xa5, 0xa4, 0xa3, 0xa1, 0x9f,
-  0x9d, 0x9b, 0x99, 0x98, 0x96, 0x94, 0x93, 0x92, 0x90, 0x91, 0x90, 0x90,
-  0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8f, 0x8d, 0x8a, 0x87, 0x84, 0x83, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x82, 0x84, 0x84, 0x85, 0x86, 0x8a, 0x8c, 0x8c,
-  0x8e, 0x91, 0x93, 0x94, 0x95, 0x96, 0x96, 0x97, 0x99, 0x9a, 0x9a, 0x9a,
-  0x9a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0x9d, 0x9e, 0x9e, 0x9e, 0x9d, 0x9c,
-  0x9c, 0x9c, 0x9c, 0x9b, 0x9b, 0x9a, 0x99, 0x99, 0x97, 0x96, 0x95, 0x94,
-  0x94, 0x94, 0x94, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x93,
-  0x93, 0x93, 0x92, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x95, 0x94, 0x93,
-  0x93, 0x92, 0x91, 0x8f, 0x8f, 0x8f, 0x8d, 0x8b, 0x8b, 0x8a, 0x89, 0x89,
-  0x8a, 0x8b, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x91, 0x92, 0x94, 0x95,
-  0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96,
-  0x96, 0x95, 0x95, 0x94, 0x95, 0x95, 0x96, 0x98, 0x9a, 0x9b, 0x9a, 0x98,
-  0x95, 0x91, 0x8e, 0x89, 0x81, 0x79, 0x70, 0x6a, 0x66, 0x5f, 0x59, 0x58,
-  0x58, 0x57, 0x56, 0x56, 0x57, 0x58, 0x59, 0x59, 0x5b, 0x5d, 0x5d, 0x5c,
-  0x5c, 0x5b, 0x5d, 0x60, 0x61, 0x61, 0x5f, 0x60, 0x61, 0x61, 0x60, 0x61,
-  0x61, 0x61, 0x63, 0x63, 0x63, 0x65, 0x67, 0x67, 0x68, 0x69, 0x6a, 0x6d,
-  0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6d, 0x6c, 0x6a, 0x67, 0x62, 0x5c, 0x5a,
-  0x56, 0x52, 0x4d, 0x49, 0x46, 0x41, 0x3b, 0x34, 0x2c, 0x26, 0x1f, 0x15,
-  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12,
-  0x12, 0x12, 0x12, 0x13, 0x12, 0x12, 0x12, 0x13, 0x90, 0x8b, 0x88, 0x85,
-  0x82, 0x7e, 0x7a, 0x78, 0x78, 0x76, 0x73, 0x6e, 0x6d, 0x6d, 0x6e, 0x6e,
-  0x6b, 0x6a, 0x69, 0x67, 0x66, 0x65, 0x64, 0x63, 0x61, 0x60, 0x62, 0x61,
-  0x61, 0x61, 0x62, 0x62, 0x63, 0x64, 0x69, 0x72, 0x7b, 0x81, 0x84, 0x88,
-  0x8e, 0x92, 0x94, 0x96, 0x99, 0x9b, 0x9c, 0x9b, 0x9a, 0x98, 0x96, 0x96,
-  0x94, 0x93, 0x94, 0x95, 0x98, 0x9a, 0x9c, 0x9f, 0xa1, 0xa1, 0xa3, 0xa5,
-  0xa7, 0xa7, 0xa6, 0xa6, 0xa5, 0xa4, 0xa2, 0xa0, 0x9e, 0x9c, 0x9a, 0x97,
-  0x95, 0x93, 0x92, 0x92, 0x90, 0x90, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x8f,
-  0x8f, 0x8f, 0x8d, 0x89, 0x87, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x81,
-  0x83, 0x83, 0x83, 0x84, 0x86, 0x89, 0x8b, 0x8c, 0x8d, 0x90, 0x93, 0x94,
-  0x94, 0x95, 0x95, 0x97, 0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c,
-  0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9f, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b,
-  0x9b, 0x9a, 0x99, 0x99, 0x98, 0x97, 0x96, 0x95, 0x95, 0x95, 0x95, 0x94,
-  0x94, 0x93, 0x93, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93,
-  0x93, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x93, 0x92, 0x91,
-  0x90, 0x90, 0x8f, 0x8d, 0x8c, 0x8b, 0x8a, 0x89, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8b, 0x8d, 0x8e, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x96, 0x96,
-  0x96, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x95, 0x94,
-  0x95, 0x95, 0x96, 0x97, 0x99, 0x9a, 0x99, 0x97, 0x93, 0x8e, 0x8a, 0x86,
-  0x7f, 0x75, 0x6c, 0x65, 0x61, 0x5b, 0x58, 0x56, 0x56, 0x56, 0x57, 0x57,
-  0x57, 0x59, 0x5a, 0x5a, 0x5d, 0x5e, 0x5e, 0x5d, 0x5c, 0x5c, 0x5d, 0x60,
-  0x61, 0x61, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x62, 0x62, 0x61, 0x62, 0x63,
-  0x63, 0x66, 0x65, 0x67, 0x68, 0x69, 0x6a, 0x6d, 0x6e, 0x6f, 0x6f, 0x70,
-  0x6e, 0x6c, 0x6b, 0x6a, 0x67, 0x62, 0x5d, 0x5a, 0x57, 0x53, 0x4d, 0x49,
-  0x46, 0x42, 0x3c, 0x34, 0x2d, 0x28, 0x20, 0x15, 0x11, 0x11, 0x11, 0x10,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x12, 0x13, 0x11,
-  0x12, 0x12, 0x12, 0x14, 0x8f, 0x8a, 0x86, 0x84, 0x80, 0x7c, 0x79, 0x77,
-  0x76, 0x74, 0x70, 0x6c, 0x6b, 0x6b, 0x6c, 0x6b, 0x69, 0x68, 0x67, 0x64,
-  0x63, 0x63, 0x62, 0x61, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x60, 0x61,
-  0x62, 0x63, 0x67, 0x6d, 0x77, 0x7d, 0x81, 0x85, 0x8b, 0x90, 0x92, 0x94,
-  0x98, 0x9b, 0x9b, 0x9b, 0x9a, 0x99, 0x98, 0x97, 0x94, 0x93, 0x93, 0x94,
-  0x96, 0x98, 0x9a, 0x9e, 0xa0, 0xa1, 0xa3, 0xa5, 0xa7, 0xa8, 0xa6, 0xa6,
-  0xa5, 0xa4, 0xa3, 0xa1, 0x9e, 0x9b, 0x99, 0x97, 0x95, 0x93, 0x92, 0x92,
-  0x90, 0x90, 0x8f, 0x90, 0x90, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8c, 0x88,
-  0x87, 0x85, 0x83, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x7d, 0x7d, 0x7f, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x83, 0x83, 0x83, 0x83,
-  0x86, 0x87, 0x8a, 0x8c, 0x8f, 0x92, 0x93, 0x94, 0x95, 0x97, 0x97, 0x99,
-  0x9a, 0x9b, 0x9c, 0x9c, 0x9d, 0x9d, 0x9c, 0x9c, 0x9d, 0x9f, 0x9f, 0x9f,
-  0x9f, 0x9e, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d, 0x9b, 0x9c, 0x9b, 0x9a, 0x9a,
-  0x99, 0x98, 0x96, 0x95, 0x96, 0x95, 0x96, 0x95, 0x94, 0x93, 0x92, 0x93,
-  0x93, 0x93, 0x93, 0x92, 0x93, 0x94, 0x95, 0x94, 0x94, 0x96, 0x96, 0x96,
-  0x96, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x92, 0x92, 0x91, 0x91, 0x8f,
-  0x8d, 0x8c, 0x8b, 0x89, 0x8a, 0x89, 0x8a, 0x8c, 0x8c, 0x8d, 0x8f, 0x90,
-  0x91, 0x92, 0x93, 0x94, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95,
-  0x95, 0x95, 0x96, 0x95, 0x94, 0x94, 0x94, 0x95, 0x96, 0x97, 0x97, 0x96,
-  0x98, 0x98, 0x97, 0x94, 0x90, 0x89, 0x85, 0x81, 0x7a, 0x6f, 0x66, 0x5f,
-  0x5c, 0x59, 0x58, 0x56, 0x56, 0x57, 0x58, 0x58, 0x5a, 0x5b, 0x5b, 0x5b,
-  0x5d, 0x5f, 0x5e, 0x5e, 0x5e, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x61, 0x5f,
-  0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x63, 0x63, 0x63, 0x65, 0x65, 0x66,
-  0x67, 0x69, 0x6b, 0x6e, 0x6f, 0x70, 0x70, 0x70, 0x6f, 0x6c, 0x6b, 0x6b,
-  0x67, 0x63, 0x5f, 0x5d, 0x59, 0x53, 0x4f, 0x4b, 0x48, 0x43, 0x3d, 0x34,
-  0x2f, 0x2b, 0x21, 0x16, 0x12, 0x11, 0x10, 0x11, 0x10, 0x12, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x14, 0x15, 0x13, 0x13, 0x11, 0x11, 0x11, 0x13, 0x14,
-  0x8e, 0x8a, 0x86, 0x83, 0x7e, 0x7a, 0x77, 0x75, 0x73, 0x71, 0x6e, 0x6a,
-  0x69, 0x69, 0x6a, 0x69, 0x67, 0x66, 0x65, 0x63, 0x62, 0x62, 0x62, 0x61,
-  0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5f, 0x60, 0x61, 0x63, 0x64, 0x69,
-  0x72, 0x79, 0x7d, 0x81, 0x88, 0x8d, 0x91, 0x94, 0x97, 0x9a, 0x9b, 0x9b,
-  0x9a, 0x9a, 0x99, 0x96, 0x95, 0x94, 0x94, 0x93, 0x95, 0x98, 0x9a, 0x9d,
-  0xa0, 0xa2, 0xa4, 0xa6, 0xa7, 0xa8, 0xa7, 0xa8, 0xa7, 0xa6, 0xa4, 0xa2,
-  0x9e, 0x9b, 0x99, 0x96, 0x95, 0x93, 0x92, 0x91, 0x91, 0x90, 0x8f, 0x90,
-  0x90, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8c, 0x89, 0x86, 0x84, 0x83, 0x82,
-  0x81, 0x7f, 0x7f, 0x7f, 0x7d, 0x7d, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x84, 0x83, 0x85, 0x86, 0x88, 0x8a,
-  0x8e, 0x91, 0x93, 0x94, 0x95, 0x97, 0x97, 0x98, 0x9a, 0x9b, 0x9c, 0x9d,
-  0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9f, 0x9f, 0x9e, 0x9e,
-  0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b, 0x9b, 0x9b, 0x99, 0x98, 0x96, 0x96,
-  0x96, 0x95, 0x96, 0x95, 0x95, 0x93, 0x94, 0x95, 0x95, 0x95, 0x95, 0x94,
-  0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x96, 0x97, 0x96, 0x96, 0x95,
-  0x95, 0x95, 0x95, 0x94, 0x92, 0x92, 0x91, 0x8f, 0x8f, 0x8d, 0x8c, 0x8a,
-  0x8a, 0x89, 0x89, 0x8b, 0x8c, 0x8d, 0x8f, 0x90, 0x91, 0x91, 0x92, 0x93,
-  0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95,
-  0x95, 0x94, 0x95, 0x95, 0x96, 0x96, 0x95, 0x96, 0x97, 0x97, 0x96, 0x93,
-  0x8d, 0x86, 0x81, 0x7d, 0x75, 0x6b, 0x61, 0x5b, 0x59, 0x57, 0x58, 0x59,
-  0x58, 0x58, 0x59, 0x59, 0x5b, 0x5b, 0x5b, 0x5a, 0x5c, 0x5e, 0x5e, 0x5e,
-  0x5e, 0x5f, 0x60, 0x60, 0x61, 0x61, 0x61, 0x5f, 0x60, 0x60, 0x5f, 0x60,
-  0x61, 0x64, 0x65, 0x65, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6a, 0x6b, 0x6e,
-  0x6f, 0x70, 0x70, 0x71, 0x70, 0x6f, 0x6d, 0x6b, 0x68, 0x64, 0x60, 0x5d,
-  0x5a, 0x54, 0x50, 0x4d, 0x49, 0x43, 0x3d, 0x34, 0x2f, 0x2b, 0x22, 0x17,
-  0x12, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12,
-  0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x13, 0x13, 0x8c, 0x88, 0x85, 0x81,
-  0x7b, 0x77, 0x74, 0x71, 0x6f, 0x6d, 0x6c, 0x69, 0x68, 0x67, 0x68, 0x67,
-  0x65, 0x64, 0x64, 0x63, 0x61, 0x60, 0x60, 0x5f, 0x5f, 0x60, 0x5f, 0x5f,
-  0x5f, 0x5f, 0x5f, 0x5f, 0x60, 0x62, 0x64, 0x67, 0x6e, 0x75, 0x78, 0x7d,
-  0x85, 0x8a, 0x8e, 0x91, 0x95, 0x97, 0x9a, 0x9a, 0x9a, 0x99, 0x99, 0x96,
-  0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x98, 0x9b, 0x9e, 0xa2, 0xa4, 0xa4,
-  0xa5, 0xa6, 0xa7, 0xa8, 0xa7, 0xa6, 0xa5, 0xa2, 0x9f, 0x9b, 0x99, 0x98,
-  0x95, 0x94, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x91, 0x91, 0x90, 0x90, 0x90,
-  0x8e, 0x8d, 0x8b, 0x88, 0x86, 0x86, 0x85, 0x83, 0x81, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7d, 0x7f,
-  0x82, 0x83, 0x83, 0x82, 0x84, 0x87, 0x89, 0x8a, 0x8c, 0x8e, 0x92, 0x94,
-  0x96, 0x97, 0x97, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0xa0, 0xa0, 0xa0,
-  0x9f, 0x9e, 0xa0, 0x9f, 0x9e, 0x9f, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9d,
-  0x9b, 0x9b, 0x9b, 0x9b, 0x9a, 0x99, 0x98, 0x98, 0x96, 0x96, 0x95, 0x95,
-  0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97,
-  0x97, 0x95, 0x95, 0x96, 0x98, 0x97, 0x98, 0x96, 0x96, 0x97, 0x95, 0x95,
-  0x94, 0x94, 0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8c, 0x8a, 0x89, 0x89, 0x8b,
-  0x8c, 0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x92, 0x93, 0x95, 0x95, 0x95, 0x95,
-  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x96, 0x96, 0x95, 0x95, 0x95,
-  0x96, 0x96, 0x96, 0x96, 0x96, 0x95, 0x93, 0x90, 0x89, 0x82, 0x7d, 0x79,
-  0x72, 0x67, 0x5e, 0x58, 0x57, 0x56, 0x57, 0x59, 0x5a, 0x5a, 0x5a, 0x5b,
-  0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5e, 0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f,
-  0x60, 0x61, 0x61, 0x60, 0x61, 0x60, 0x60, 0x60, 0x61, 0x64, 0x65, 0x64,
-  0x63, 0x64, 0x66, 0x68, 0x68, 0x6a, 0x6b, 0x6e, 0x6f, 0x70, 0x70, 0x71,
-  0x71, 0x6f, 0x6e, 0x6a, 0x68, 0x64, 0x61, 0x5e, 0x5b, 0x57, 0x51, 0x4d,
-  0x4a, 0x44, 0x3d, 0x35, 0x2f, 0x2b, 0x23, 0x18, 0x12, 0x11, 0x10, 0x11,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11,
-  0x12, 0x12, 0x12, 0x14, 0x8b, 0x87, 0x82, 0x7f, 0x79, 0x75, 0x72, 0x6f,
-  0x6e, 0x6b, 0x68, 0x68, 0x66, 0x66, 0x65, 0x64, 0x63, 0x62, 0x61, 0x61,
-  0x60, 0x5d, 0x5e, 0x5f, 0x5e, 0x5f, 0x5e, 0x5e, 0x5f, 0x5e, 0x5f, 0x60,
-  0x60, 0x61, 0x64, 0x68, 0x6c, 0x70, 0x73, 0x79, 0x81, 0x87, 0x8b, 0x8e,
-  0x92, 0x96, 0x98, 0x99, 0x9a, 0x9a, 0x99, 0x98, 0x96, 0x96, 0x95, 0x95,
-  0x95, 0x96, 0x97, 0x9a, 0x9d, 0xa1, 0xa3, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
-  0xa6, 0xa6, 0xa4, 0xa1, 0x9e, 0x9c, 0x99, 0x97, 0x95, 0x94, 0x91, 0x91,
-  0x91, 0x90, 0x90, 0x91, 0x91, 0x91, 0x90, 0x90, 0x8e, 0x8d, 0x8b, 0x88,
-  0x86, 0x86, 0x85, 0x83, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7f, 0x81,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81,
-  0x83, 0x87, 0x89, 0x8a, 0x8d, 0x8f, 0x92, 0x94, 0x96, 0x97, 0x97, 0x99,
-  0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa1, 0xa1, 0xa0, 0x9f, 0x9f, 0xa0, 0x9f,
-  0x9e, 0x9e, 0x9f, 0x9f, 0x9e, 0x9f, 0x9f, 0x9d, 0x9b, 0x9c, 0x9c, 0x9b,
-  0x9a, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x95,
-  0x96, 0x96, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97, 0x97, 0x96, 0x97, 0x98,
-  0x98, 0x98, 0x99, 0x98, 0x97, 0x98, 0x96, 0x96, 0x95, 0x95, 0x94, 0x92,
-  0x91, 0x90, 0x8e, 0x8c, 0x8c, 0x8b, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8e,
-  0x8f, 0x90, 0x92, 0x92, 0x94, 0x95, 0x95, 0x95, 0x97, 0x97, 0x97, 0x97,
-  0x97, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96,
-  0x95, 0x93, 0x91, 0x8d, 0x85, 0x7e, 0x7a, 0x76, 0x6f, 0x64, 0x5c, 0x58,
-  0x57, 0x58, 0x57, 0x59, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c,
-  0x5b, 0x5e, 0x5f, 0x5f, 0x5d, 0x5d, 0x5d, 0x5d, 0x5f, 0x60, 0x61, 0x60,
-  0x61, 0x61, 0x61, 0x62, 0x62, 0x63, 0x64, 0x64, 0x62, 0x64, 0x66, 0x68,
-  0x68, 0x6a, 0x6b, 0x6e, 0x6f, 0x70, 0x70, 0x71, 0x71, 0x70, 0x6f, 0x6b,
-  0x68, 0x63, 0x61, 0x5f, 0x5c, 0x57, 0x51, 0x4e, 0x4b, 0x46, 0x3e, 0x36,
-  0x31, 0x2c, 0x23, 0x1a, 0x13, 0x11, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11,
-  0x11, 0x12, 0x12, 0x11, 0x12, 0x13, 0x13, 0x11, 0x12, 0x12, 0x11, 0x13,
-  0x8b, 0x85, 0x81, 0x7e, 0x78, 0x74, 0x71, 0x6e, 0x6c, 0x6a, 0x67, 0x66,
-  0x65, 0x64, 0x64, 0x62, 0x61, 0x60, 0x60, 0x60, 0x5f, 0x5c, 0x5d, 0x5e,
-  0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x60, 0x61, 0x61, 0x63, 0x67,
-  0x6b, 0x6e, 0x71, 0x76, 0x7e, 0x85, 0x89, 0x8c, 0x90, 0x95, 0x96, 0x98,
-  0x99, 0x9a, 0x99, 0x98, 0x97, 0x96, 0x94, 0x95, 0x94, 0x95, 0x96, 0x99,
-  0x9c, 0xa1, 0xa2, 0xa3, 0xa3, 0xa5, 0xa5, 0xa6, 0xa6, 0xa5, 0xa4, 0xa1,
-  0x9e, 0x9b, 0x99, 0x97, 0x95, 0x94, 0x92, 0x91, 0x91, 0x90, 0x8f, 0x91,
-  0x91, 0x91, 0x90, 0x90, 0x8e, 0x8c, 0x8b, 0x88, 0x86, 0x85, 0x85, 0x83,
-  0x81, 0x80, 0x7e, 0x7e, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x7f, 0x80, 0x80,
-  0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x83, 0x87, 0x89, 0x8a,
-  0x8d, 0x8f, 0x92, 0x95, 0x95, 0x96, 0x97, 0x9a, 0x9c, 0x9d, 0x9d, 0x9f,
-  0x9f, 0xa1, 0xa1, 0xa1, 0xa0, 0xa0, 0xa1, 0x9f, 0x9e, 0x9e, 0x9f, 0x9f,
-  0x9e, 0x9e, 0x9e, 0x9d, 0x9c, 0x9c, 0x9c, 0x9b, 0x99, 0x9a, 0x99, 0x99,
-  0x98, 0x97, 0x97, 0x96, 0x96, 0x97, 0x97, 0x95, 0x95, 0x95, 0x96, 0x95,
-  0x96, 0x96, 0x96, 0x98, 0x97, 0x98, 0x98, 0x98, 0x99, 0x99, 0x99, 0x99,
-  0x98, 0x98, 0x97, 0x97, 0x95, 0x94, 0x94, 0x93, 0x92, 0x90, 0x8f, 0x8d,
-  0x8c, 0x8c, 0x8b, 0x8b, 0x8c, 0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x91,
-  0x94, 0x96, 0x96, 0x95, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x95,
-  0x95, 0x95, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x94, 0x92, 0x90, 0x8b,
-  0x83, 0x7c, 0x77, 0x74, 0x6d, 0x62, 0x5a, 0x57, 0x58, 0x58, 0x57, 0x5a,
-  0x5b, 0x5a, 0x5a, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5b, 0x5d, 0x5e, 0x5e,
-  0x5d, 0x5d, 0x5c, 0x5d, 0x5f, 0x5f, 0x60, 0x60, 0x61, 0x61, 0x61, 0x62,
-  0x63, 0x63, 0x64, 0x64, 0x63, 0x64, 0x67, 0x67, 0x68, 0x6a, 0x6a, 0x6d,
-  0x6f, 0x70, 0x70, 0x71, 0x71, 0x70, 0x6f, 0x6c, 0x68, 0x63, 0x60, 0x5f,
-  0x5c, 0x58, 0x52, 0x4f, 0x4b, 0x46, 0x3e, 0x36, 0x31, 0x2b, 0x23, 0x1a,
-  0x14, 0x11, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x13, 0x13, 0x11, 0x12, 0x12, 0x11, 0x13, 0x8a, 0x83, 0x7e, 0x7b,
-  0x77, 0x72, 0x6e, 0x6b, 0x69, 0x66, 0x64, 0x64, 0x63, 0x62, 0x60, 0x5f,
-  0x5f, 0x5e, 0x5d, 0x5e, 0x5d, 0x5b, 0x5c, 0x5c, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x5d, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x63, 0x66, 0x68, 0x6c, 0x6e, 0x73,
-  0x7b, 0x82, 0x87, 0x8b, 0x8f, 0x92, 0x95, 0x97, 0x99, 0x9a, 0x99, 0x99,
-  0x96, 0x95, 0x94, 0x95, 0x95, 0x95, 0x95, 0x97, 0x9a, 0x9e, 0xa0, 0xa1,
-  0xa3, 0xa5, 0xa6, 0xa6, 0xa5, 0xa5, 0xa4, 0xa2, 0x9e, 0x9a, 0x99, 0x96,
-  0x95, 0x94, 0x92, 0x92, 0x90, 0x90, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x8e,
-  0x8d, 0x8c, 0x8b, 0x88, 0x85, 0x85, 0x84, 0x82, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x80, 0x81, 0x81, 0x81, 0x83, 0x86, 0x88, 0x89, 0x8c, 0x8f, 0x93, 0x95,
-  0x95, 0x95, 0x97, 0x9a, 0x9c, 0x9d, 0x9d, 0x9e, 0x9f, 0xa2, 0xa2, 0xa2,
-  0xa2, 0xa1, 0xa1, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0x9d, 0x9d,
-  0x9d, 0x9c, 0x9c, 0x9a, 0x99, 0x9b, 0x9a, 0x9a, 0x98, 0x97, 0x96, 0x96,
-  0x96, 0x97, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x98,
-  0x98, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x99, 0x97, 0x97,
-  0x96, 0x95, 0x95, 0x94, 0x92, 0x8f, 0x8e, 0x8e, 0x8c, 0x8b, 0x8c, 0x8c,
-  0x8c, 0x8c, 0x8e, 0x8f, 0x8f, 0x90, 0x91, 0x91, 0x94, 0x94, 0x95, 0x96,
-  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x96, 0x96, 0x96, 0x95, 0x95,
-  0x95, 0x96, 0x96, 0x95, 0x93, 0x90, 0x8e, 0x89, 0x81, 0x7a, 0x75, 0x70,
-  0x69, 0x60, 0x59, 0x57, 0x58, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-  0x5b, 0x5b, 0x5c, 0x5c, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d,
-  0x5d, 0x5e, 0x5f, 0x5e, 0x60, 0x60, 0x61, 0x62, 0x63, 0x63, 0x63, 0x63,
-  0x64, 0x65, 0x66, 0x66, 0x67, 0x68, 0x6a, 0x6c, 0x6e, 0x6e, 0x6f, 0x71,
-  0x71, 0x70, 0x6f, 0x6c, 0x69, 0x64, 0x61, 0x5e, 0x5c, 0x56, 0x52, 0x4e,
-  0x4b, 0x46, 0x3f, 0x37, 0x30, 0x2b, 0x23, 0x1a, 0x14, 0x11, 0x11, 0x10,
-  0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x13, 0x86, 0x7f, 0x7a, 0x78, 0x73, 0x6e, 0x6a, 0x67,
-  0x66, 0x64, 0x62, 0x61, 0x61, 0x60, 0x5e, 0x5e, 0x5d, 0x5c, 0x5c, 0x5c,
-  0x5b, 0x5b, 0x5b, 0x5c, 0x5d, 0x5e, 0x5e, 0x5d, 0x5d, 0x5e, 0x5e, 0x60,
-  0x61, 0x60, 0x62, 0x66, 0x68, 0x69, 0x6b, 0x6f, 0x77, 0x7e, 0x83, 0x86,
-  0x8b, 0x90, 0x93, 0x95, 0x97, 0x98, 0x98, 0x99, 0x97, 0x95, 0x94, 0x95,
-  0x95, 0x95, 0x95, 0x97, 0x99, 0x9d, 0x9f, 0xa0, 0xa2, 0xa3, 0xa5, 0xa4,
-  0xa4, 0xa4, 0xa4, 0xa1, 0x9e, 0x9a, 0x99, 0x97, 0x97, 0x96, 0x94, 0x93,
-  0x91, 0x90, 0x8f, 0x90, 0x90, 0x8f, 0x8f, 0x8c, 0x8b, 0x8b, 0x8a, 0x88,
-  0x86, 0x85, 0x84, 0x82, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x82, 0x85, 0x87, 0x88, 0x8a, 0x8f, 0x92, 0x94, 0x95, 0x95, 0x97, 0x9a,
-  0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0xa0,
-  0x9f, 0x9f, 0x9e, 0x9e, 0x9d, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b, 0x9a,
-  0x9b, 0x9b, 0x9a, 0x99, 0x98, 0x97, 0x98, 0x98, 0x97, 0x96, 0x96, 0x96,
-  0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x95, 0x96, 0x98, 0x9a, 0x9a, 0x9a,
-  0x99, 0x99, 0x9a, 0x9b, 0x9c, 0x9a, 0x98, 0x98, 0x97, 0x97, 0x96, 0x93,
-  0x92, 0x90, 0x8f, 0x8f, 0x8e, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f,
-  0x8f, 0x90, 0x91, 0x91, 0x93, 0x94, 0x95, 0x97, 0x97, 0x96, 0x96, 0x96,
-  0x96, 0x96, 0x97, 0x96, 0x96, 0x96, 0x95, 0x95, 0x96, 0x96, 0x96, 0x94,
-  0x91, 0x8e, 0x8c, 0x87, 0x7d, 0x75, 0x70, 0x6b, 0x65, 0x5d, 0x59, 0x57,
-  0x58, 0x59, 0x59, 0x5a, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b,
-  0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5d, 0x5e, 0x5e,
-  0x60, 0x61, 0x61, 0x61, 0x62, 0x63, 0x62, 0x63, 0x64, 0x65, 0x64, 0x65,
-  0x66, 0x68, 0x6a, 0x6b, 0x6d, 0x6e, 0x6e, 0x70, 0x70, 0x6f, 0x6e, 0x6b,
-  0x69, 0x65, 0x62, 0x61, 0x5d, 0x56, 0x52, 0x4f, 0x4c, 0x47, 0x40, 0x38,
-  0x32, 0x2c, 0x24, 0x1a, 0x13, 0x11, 0x10, 0x11, 0x12, 0x10, 0x10, 0x10,
-  0x10, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11,
-  0x82, 0x7b, 0x76, 0x74, 0x71, 0x6b, 0x67, 0x64, 0x63, 0x61, 0x5e, 0x5d,
-  0x5f, 0x5f, 0x5d, 0x5d, 0x5c, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b,
-  0x5d, 0x5f, 0x5f, 0x5d, 0x5d, 0x5d, 0x5d, 0x5f, 0x60, 0x61, 0x61, 0x64,
-  0x67, 0x68, 0x69, 0x6c, 0x72, 0x79, 0x80, 0x83, 0x88, 0x8d, 0x91, 0x92,
-  0x94, 0x96, 0x98, 0x98, 0x98, 0x97, 0x96, 0x95, 0x95, 0x95, 0x95, 0x96,
-  0x98, 0x9b, 0x9e, 0x9f, 0xa0, 0xa3, 0xa4, 0xa4, 0xa3, 0xa3, 0xa2, 0xa0,
-  0x9e, 0x9b, 0x9a, 0x9a, 0x98, 0x97, 0x94, 0x93, 0x92, 0x90, 0x8f, 0x90,
-  0x8f, 0x8e, 0x8d, 0x8c, 0x8a, 0x8a, 0x89, 0x87, 0x86, 0x85, 0x84, 0x82,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x82, 0x84, 0x85, 0x86,
-  0x89, 0x8e, 0x91, 0x93, 0x94, 0x95, 0x97, 0x9a, 0x9d, 0x9e, 0x9f, 0xa1,
-  0xa2, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa2, 0xa0, 0x9f, 0x9f, 0x9e, 0x9e,
-  0x9d, 0x9d, 0x9d, 0x9c, 0x9d, 0x9c, 0x9b, 0x9a, 0x99, 0x98, 0x96, 0x95,
-  0x94, 0x94, 0x94, 0x95, 0x95, 0x96, 0x95, 0x96, 0x97, 0x97, 0x96, 0x96,
-  0x97, 0x96, 0x96, 0x96, 0x98, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9c, 0x9c,
-  0x9c, 0x9b, 0x9b, 0x99, 0x98, 0x97, 0x96, 0x94, 0x92, 0x91, 0x90, 0x90,
-  0x8f, 0x8e, 0x8c, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f, 0x90, 0x90, 0x91, 0x91,
-  0x93, 0x94, 0x95, 0x96, 0x95, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95,
-  0x95, 0x95, 0x97, 0x97, 0x96, 0x96, 0x95, 0x93, 0x90, 0x8c, 0x89, 0x83,
-  0x79, 0x70, 0x6a, 0x66, 0x62, 0x5c, 0x58, 0x57, 0x57, 0x58, 0x59, 0x5a,
-  0x5b, 0x5b, 0x5b, 0x59, 0x5a, 0x5b, 0x5b, 0x5a, 0x5c, 0x5b, 0x5c, 0x5c,
-  0x5b, 0x5b, 0x5c, 0x5c, 0x5d, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x61,
-  0x63, 0x63, 0x62, 0x63, 0x64, 0x65, 0x64, 0x65, 0x66, 0x67, 0x6a, 0x6b,
-  0x6d, 0x6e, 0x6e, 0x70, 0x71, 0x70, 0x6f, 0x6c, 0x6a, 0x66, 0x63, 0x62,
-  0x5e, 0x58, 0x53, 0x50, 0x4d, 0x48, 0x40, 0x39, 0x33, 0x2f, 0x26, 0x1a,
-  0x13, 0x11, 0x10, 0x10, 0x11, 0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11,
-  0x12, 0x13, 0x13, 0x11, 0x12, 0x12, 0x13, 0x11, 0x81, 0x79, 0x74, 0x71,
-  0x6d, 0x66, 0x63, 0x62, 0x61, 0x5f, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c, 0x5a,
-  0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x59, 0x58, 0x59, 0x5c, 0x5f, 0x5f, 0x5e,
-  0x5d, 0x5d, 0x5c, 0x5e, 0x60, 0x61, 0x62, 0x63, 0x67, 0x69, 0x6a, 0x6c,
-  0x70, 0x76, 0x7c, 0x7f, 0x84, 0x8a, 0x8e, 0x90, 0x92, 0x94, 0x97, 0x98,
-  0x98, 0x98, 0x96, 0x96, 0x95, 0x94, 0x94, 0x95, 0x97, 0x9b, 0x9d, 0x9e,
-  0xa0, 0xa1, 0xa4, 0xa4, 0xa4, 0xa3, 0xa2, 0xa0, 0x9d, 0x9c, 0x9b, 0x9a,
-  0x98, 0x97, 0x95, 0x94, 0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8e, 0x8d, 0x8c,
-  0x8a, 0x89, 0x87, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x7f, 0x7f,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x88, 0x8c, 0x90, 0x92,
-  0x93, 0x94, 0x98, 0x9c, 0x9e, 0x9e, 0x9f, 0xa1, 0xa2, 0xa2, 0xa2, 0xa3,
-  0xa2, 0xa3, 0xa2, 0xa0, 0x9f, 0x9f, 0x9d, 0x9d, 0x9e, 0x9e, 0x9d, 0x9d,
-  0x9c, 0x9b, 0x9a, 0x97, 0x95, 0x90, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8d, 0x8f, 0x92, 0x94, 0x96, 0x97, 0x97, 0x98, 0x97, 0x96, 0x96, 0x98,
-  0x99, 0x9b, 0x9b, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a,
-  0x98, 0x97, 0x95, 0x94, 0x93, 0x92, 0x92, 0x90, 0x8f, 0x8e, 0x8c, 0x8c,
-  0x8c, 0x8e, 0x8e, 0x90, 0x90, 0x91, 0x91, 0x93, 0x94, 0x95, 0x95, 0x96,
-  0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x95, 0x95, 0x95, 0x97, 0x98,
-  0x97, 0x97, 0x95, 0x91, 0x8d, 0x89, 0x86, 0x81, 0x78, 0x6e, 0x67, 0x63,
-  0x5f, 0x5a, 0x57, 0x56, 0x57, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-  0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x5c,
-  0x5d, 0x5d, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x63,
-  0x65, 0x65, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6c, 0x6e, 0x6e, 0x6e, 0x70,
-  0x71, 0x70, 0x6f, 0x6c, 0x6a, 0x66, 0x63, 0x61, 0x5e, 0x59, 0x54, 0x50,
-  0x4e, 0x48, 0x3f, 0x38, 0x33, 0x30, 0x27, 0x1b, 0x13, 0x11, 0x10, 0x10,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x13, 0x12, 0x12,
-  0x12, 0x12, 0x12, 0x13, 0x80, 0x77, 0x72, 0x6f, 0x6a, 0x62, 0x60, 0x60,
-  0x5f, 0x5d, 0x5b, 0x5a, 0x5b, 0x5b, 0x5b, 0x5a, 0x59, 0x59, 0x59, 0x5a,
-  0x5a, 0x58, 0x57, 0x58, 0x5b, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5f,
-  0x5f, 0x60, 0x62, 0x64, 0x67, 0x68, 0x69, 0x6b, 0x6e, 0x74, 0x79, 0x7c,
-  0x81, 0x87, 0x8c, 0x8e, 0x90, 0x92, 0x95, 0x97, 0x98, 0x97, 0x96, 0x96,
-  0x95, 0x94, 0x94, 0x95, 0x97, 0x9a, 0x9b, 0x9c, 0x9e, 0xa0, 0xa2, 0xa3,
-  0xa3, 0xa3, 0xa2, 0xa0, 0x9d, 0x9c, 0x9b, 0x9a, 0x98, 0x97, 0x95, 0x94,
-  0x92, 0x91, 0x90, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x89, 0x87, 0x86,
-  0x85, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x81, 0x82, 0x84, 0x85, 0x88, 0x8c, 0x8f, 0x92, 0x93, 0x94, 0x98, 0x9c,
-  0x9e, 0x9f, 0x9f, 0xa1, 0xa2, 0xa1, 0xa2, 0xa3, 0xa2, 0xa3, 0xa2, 0xa0,
-  0x9f, 0x9f, 0x9d, 0x9d, 0x9e, 0x9e, 0x9c, 0x9b, 0x98, 0x97, 0x96, 0x92,
-  0x8e, 0x88, 0x85, 0x84, 0x83, 0x82, 0x82, 0x83, 0x84, 0x87, 0x8b, 0x90,
-  0x93, 0x95, 0x97, 0x98, 0x98, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9b, 0x9b,
-  0x9b, 0x9d, 0x9c, 0x9b, 0x9c, 0x9c, 0x9c, 0x9a, 0x99, 0x97, 0x95, 0x94,
-  0x94, 0x93, 0x92, 0x90, 0x90, 0x8e, 0x8c, 0x8c, 0x8c, 0x8e, 0x8e, 0x90,
-  0x91, 0x90, 0x90, 0x93, 0x94, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x98,
-  0x98, 0x98, 0x97, 0x95, 0x95, 0x95, 0x97, 0x98, 0x97, 0x96, 0x94, 0x90,
-  0x8c, 0x87, 0x84, 0x7f, 0x76, 0x6c, 0x65, 0x61, 0x5d, 0x59, 0x56, 0x56,
-  0x57, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x5c, 0x5c, 0x5b,
-  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5d, 0x5d, 0x5e, 0x5e,
-  0x61, 0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x63, 0x65, 0x65, 0x65, 0x66,
-  0x67, 0x68, 0x69, 0x6c, 0x6e, 0x6e, 0x6e, 0x70, 0x71, 0x70, 0x6f, 0x6d,
-  0x6b, 0x66, 0x62, 0x60, 0x5e, 0x59, 0x54, 0x51, 0x4e, 0x48, 0x40, 0x39,
-  0x34, 0x30, 0x28, 0x1c, 0x13, 0x11, 0x11, 0x10, 0x11, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x12, 0x13, 0x12, 0x12, 0x12, 0x12, 0x12, 0x14,
-  0x7b, 0x74, 0x6e, 0x6b, 0x65, 0x5f, 0x5d, 0x5d, 0x5d, 0x5b, 0x59, 0x59,
-  0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x58, 0x59, 0x5a, 0x58, 0x58, 0x59,
-  0x5c, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x60, 0x61, 0x64, 0x65,
-  0x66, 0x67, 0x68, 0x6a, 0x6d, 0x70, 0x74, 0x77, 0x7e, 0x84, 0x89, 0x8b,
-  0x8e, 0x91, 0x93, 0x95, 0x95, 0x96, 0x97, 0x97, 0x95, 0x94, 0x95, 0x95,
-  0x96, 0x98, 0x9a, 0x9a, 0x9c, 0x9e, 0xa0, 0xa0, 0xa2, 0xa2, 0xa1, 0x9f,
-  0x9d, 0x9c, 0x9b, 0x9a, 0x98, 0x97, 0x95, 0x94, 0x92, 0x91, 0x91, 0x8e,
-  0x8e, 0x8d, 0x8d, 0x8c, 0x89, 0x89, 0x88, 0x87, 0x85, 0x84, 0x82, 0x81,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80,
-  0x81, 0x80, 0x7f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x83, 0x84, 0x86,
-  0x88, 0x8b, 0x8f, 0x92, 0x93, 0x94, 0x97, 0x9c, 0x9d, 0xa0, 0xa1, 0xa2,
-  0xa2, 0xa2, 0xa3, 0xa3, 0xa2, 0xa2, 0xa1, 0x9f, 0x9f, 0x9f, 0x9e, 0x9c,
-  0x9c, 0x9b, 0x98, 0x93, 0x8f, 0x8c, 0x89, 0x84, 0x80, 0x79, 0x74, 0x72,
-  0x6f, 0x6f, 0x71, 0x71, 0x73, 0x75, 0x7b, 0x83, 0x88, 0x8c, 0x92, 0x96,
-  0x98, 0x99, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9d, 0x9c, 0x9c,
-  0x9b, 0x9c, 0x9c, 0x9a, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x91,
-  0x90, 0x8f, 0x8c, 0x8c, 0x8c, 0x8d, 0x8e, 0x90, 0x91, 0x90, 0x90, 0x93,
-  0x94, 0x95, 0x95, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x96,
-  0x95, 0x95, 0x97, 0x98, 0x97, 0x95, 0x92, 0x8f, 0x8a, 0x85, 0x82, 0x7c,
-  0x73, 0x68, 0x63, 0x5f, 0x5b, 0x58, 0x57, 0x57, 0x58, 0x59, 0x5a, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b,
-  0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x5e, 0x60, 0x61, 0x61, 0x61,
-  0x62, 0x61, 0x62, 0x63, 0x66, 0x67, 0x66, 0x67, 0x67, 0x6a, 0x6b, 0x6b,
-  0x6d, 0x6e, 0x6e, 0x70, 0x71, 0x70, 0x6f, 0x6d, 0x6b, 0x66, 0x63, 0x61,
-  0x5f, 0x5a, 0x55, 0x52, 0x4f, 0x48, 0x42, 0x3a, 0x35, 0x31, 0x28, 0x1c,
-  0x13, 0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x13, 0x11, 0x11, 0x12, 0x12, 0x12, 0x14, 0x75, 0x6d, 0x68, 0x64,
-  0x61, 0x5d, 0x5b, 0x5c, 0x5b, 0x58, 0x57, 0x56, 0x56, 0x56, 0x56, 0x56,
-  0x56, 0x57, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x60,
-  0x60, 0x60, 0x60, 0x60, 0x61, 0x62, 0x63, 0x65, 0x66, 0x67, 0x68, 0x69,
-  0x6c, 0x6d, 0x70, 0x73, 0x79, 0x81, 0x86, 0x89, 0x8b, 0x8e, 0x91, 0x93,
-  0x94, 0x95, 0x95, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x97, 0x98,
-  0x9a, 0x9c, 0x9e, 0xa0, 0x9f, 0x9f, 0x9e, 0x9e, 0x9d, 0x9c, 0x9c, 0x9b,
-  0x9a, 0x97, 0x96, 0x95, 0x93, 0x91, 0x90, 0x8e, 0x8d, 0x8d, 0x8c, 0x8a,
-  0x89, 0x88, 0x88, 0x87, 0x85, 0x83, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7e,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x80, 0x83, 0x84, 0x85, 0x87, 0x8b, 0x90, 0x92,
-  0x93, 0x95, 0x99, 0x9c, 0x9e, 0xa0, 0xa2, 0xa3, 0xa2, 0xa2, 0xa3, 0xa3,
-  0xa3, 0xa2, 0xa1, 0xa0, 0xa0, 0x9f, 0x9d, 0x9a, 0x96, 0x93, 0x8c, 0x82,
-  0x7a, 0x74, 0x71, 0x6c, 0x67, 0x62, 0x5f, 0x5d, 0x5b, 0x5c, 0x5e, 0x60,
-  0x60, 0x63, 0x68, 0x6f, 0x76, 0x7a, 0x82, 0x8d, 0x96, 0x99, 0x9a, 0x9b,
-  0x9b, 0x9a, 0x9a, 0x9b, 0x9b, 0x9d, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9a,
-  0x9a, 0x99, 0x99, 0x98, 0x96, 0x95, 0x93, 0x93, 0x91, 0x90, 0x8d, 0x8c,
-  0x8c, 0x8d, 0x8d, 0x8f, 0x90, 0x91, 0x92, 0x92, 0x94, 0x94, 0x95, 0x96,
-  0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97,
-  0x97, 0x95, 0x92, 0x8e, 0x88, 0x83, 0x7f, 0x79, 0x6f, 0x66, 0x60, 0x5d,
-  0x5a, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x59, 0x58, 0x58,
-  0x59, 0x5a, 0x5b, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5b,
-  0x5d, 0x5e, 0x5f, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x62, 0x63, 0x64, 0x64,
-  0x65, 0x68, 0x69, 0x68, 0x68, 0x6a, 0x6b, 0x6b, 0x6c, 0x6d, 0x6f, 0x70,
-  0x70, 0x70, 0x6f, 0x6d, 0x6b, 0x67, 0x64, 0x62, 0x60, 0x5b, 0x56, 0x53,
-  0x50, 0x4a, 0x43, 0x3c, 0x37, 0x33, 0x2a, 0x1d, 0x14, 0x12, 0x12, 0x12,
-  0x12, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x12,
-  0x12, 0x12, 0x12, 0x14, 0x6e, 0x65, 0x5f, 0x5c, 0x5a, 0x59, 0x58, 0x59,
-  0x59, 0x56, 0x55, 0x55, 0x54, 0x54, 0x55, 0x55, 0x56, 0x57, 0x57, 0x58,
-  0x5a, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x60, 0x60, 0x61, 0x61,
-  0x62, 0x63, 0x63, 0x65, 0x67, 0x68, 0x69, 0x69, 0x6c, 0x6d, 0x6e, 0x70,
-  0x76, 0x7c, 0x81, 0x85, 0x88, 0x8b, 0x8e, 0x91, 0x92, 0x92, 0x92, 0x94,
-  0x94, 0x94, 0x95, 0x95, 0x94, 0x94, 0x96, 0x96, 0x98, 0x9b, 0x9c, 0x9e,
-  0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0x9b, 0x9a, 0x9b, 0x99, 0x98, 0x97, 0x96,
-  0x94, 0x92, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x89, 0x88, 0x88, 0x88, 0x86,
-  0x84, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x83,
-  0x84, 0x84, 0x84, 0x82, 0x81, 0x81, 0x80, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x80, 0x82, 0x83, 0x84, 0x87, 0x8b, 0x8f, 0x92, 0x93, 0x96, 0x9a, 0x9d,
-  0x9f, 0xa0, 0xa1, 0xa2, 0xa2, 0xa3, 0xa3, 0xa3, 0xa2, 0xa3, 0xa1, 0xa0,
-  0x9f, 0x9c, 0x97, 0x90, 0x88, 0x82, 0x77, 0x69, 0x61, 0x5d, 0x5a, 0x58,
-  0x58, 0x57, 0x57, 0x57, 0x58, 0x5b, 0x60, 0x62, 0x61, 0x60, 0x61, 0x64,
-  0x68, 0x6b, 0x73, 0x7f, 0x8b, 0x91, 0x94, 0x97, 0x9b, 0x9b, 0x9b, 0x9b,
-  0x9b, 0x9b, 0x9d, 0x9c, 0x9d, 0x9c, 0x9b, 0x99, 0x99, 0x99, 0x99, 0x97,
-  0x95, 0x94, 0x94, 0x93, 0x92, 0x92, 0x90, 0x8e, 0x8e, 0x8f, 0x8e, 0x8f,
-  0x90, 0x91, 0x92, 0x92, 0x94, 0x95, 0x94, 0x94, 0x96, 0x97, 0x97, 0x97,
-  0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x96, 0x97, 0x96, 0x95, 0x91, 0x8c,
-  0x86, 0x7f, 0x7b, 0x75, 0x6c, 0x64, 0x5d, 0x5b, 0x58, 0x56, 0x57, 0x59,
-  0x59, 0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x58, 0x59, 0x5a, 0x5b,
-  0x5a, 0x5a, 0x5b, 0x5a, 0x5a, 0x5b, 0x5a, 0x5b, 0x5d, 0x5e, 0x5f, 0x5e,
-  0x5f, 0x5f, 0x5f, 0x60, 0x63, 0x64, 0x65, 0x65, 0x67, 0x68, 0x69, 0x69,
-  0x69, 0x6a, 0x69, 0x6a, 0x6c, 0x6e, 0x6f, 0x71, 0x70, 0x70, 0x70, 0x6d,
-  0x6b, 0x67, 0x64, 0x62, 0x5f, 0x5a, 0x57, 0x52, 0x4f, 0x4a, 0x44, 0x3f,
-  0x38, 0x33, 0x2a, 0x1e, 0x14, 0x12, 0x11, 0x12, 0x10, 0x11, 0x10, 0x11,
-  0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x14,
-  0x68, 0x61, 0x5b, 0x58, 0x57, 0x57, 0x56, 0x57, 0x56, 0x55, 0x55, 0x54,
-  0x53, 0x54, 0x55, 0x56, 0x57, 0x57, 0x56, 0x58, 0x5a, 0x5a, 0x5c, 0x5c,
-  0x5d, 0x5e, 0x5f, 0x60, 0x60, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65,
-  0x67, 0x69, 0x69, 0x6a, 0x6b, 0x6d, 0x6d, 0x6e, 0x72, 0x78, 0x7e, 0x83,
-  0x86, 0x89, 0x8c, 0x8d, 0x8e, 0x8f, 0x91, 0x92, 0x93, 0x95, 0x95, 0x96,
-  0x95, 0x94, 0x95, 0x95, 0x97, 0x98, 0x99, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c,
-  0x9c, 0x9b, 0x9b, 0x9b, 0x98, 0x96, 0x96, 0x96, 0x94, 0x91, 0x90, 0x8f,
-  0x8e, 0x8d, 0x8b, 0x89, 0x89, 0x89, 0x88, 0x86, 0x83, 0x82, 0x80, 0x7f,
-  0x7e, 0x7f, 0x7f, 0x80, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x84, 0x82,
-  0x81, 0x80, 0x80, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x84,
-  0x86, 0x8a, 0x8e, 0x91, 0x93, 0x96, 0x9a, 0x9d, 0x9f, 0xa0, 0xa1, 0xa3,
-  0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0x9f, 0x9c, 0x97, 0x8e, 0x81,
-  0x77, 0x6f, 0x65, 0x5b, 0x56, 0x53, 0x52, 0x52, 0x53, 0x56, 0x58, 0x58,
-  0x5a, 0x5e, 0x63, 0x66, 0x65, 0x64, 0x62, 0x64, 0x66, 0x68, 0x6b, 0x73,
-  0x7b, 0x80, 0x83, 0x89, 0x92, 0x98, 0x9b, 0x9c, 0x9d, 0x9c, 0x9d, 0x9c,
-  0x9b, 0x9a, 0x9b, 0x9a, 0x9b, 0x9a, 0x9a, 0x98, 0x95, 0x94, 0x94, 0x94,
-  0x92, 0x93, 0x92, 0x8f, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x91, 0x92, 0x92,
-  0x94, 0x94, 0x94, 0x94, 0x96, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
-  0x98, 0x98, 0x96, 0x97, 0x96, 0x94, 0x90, 0x8a, 0x83, 0x7d, 0x78, 0x72,
-  0x69, 0x62, 0x5c, 0x5a, 0x58, 0x57, 0x58, 0x59, 0x59, 0x59, 0x58, 0x57,
-  0x57, 0x57, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5a, 0x58, 0x58, 0x59, 0x59,
-  0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x61,
-  0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a,
-  0x6c, 0x6e, 0x6f, 0x71, 0x70, 0x70, 0x70, 0x6d, 0x6a, 0x67, 0x64, 0x62,
-  0x5f, 0x5a, 0x57, 0x52, 0x4f, 0x4b, 0x45, 0x3e, 0x38, 0x33, 0x2a, 0x1e,
-  0x14, 0x11, 0x10, 0x11, 0x10, 0x10, 0x12, 0x12, 0x11, 0x11, 0x13, 0x13,
-  0x13, 0x13, 0x12, 0x13, 0x13, 0x13, 0x12, 0x13, 0x64, 0x5f, 0x59, 0x56,
-  0x55, 0x55, 0x54, 0x55, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x55, 0x55,
-  0x57, 0x57, 0x56, 0x57, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5d, 0x5f, 0x60,
-  0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6a,
-  0x6b, 0x6c, 0x6c, 0x6d, 0x6f, 0x75, 0x7c, 0x81, 0x84, 0x87, 0x8a, 0x8b,
-  0x8d, 0x8e, 0x8f, 0x91, 0x92, 0x94, 0x95, 0x95, 0x95, 0x94, 0x94, 0x95,
-  0x96, 0x98, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x9b, 0x9a,
-  0x97, 0x95, 0x96, 0x95, 0x93, 0x91, 0x90, 0x8e, 0x8e, 0x8d, 0x8b, 0x89,
-  0x89, 0x89, 0x87, 0x85, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x85, 0x86, 0x86, 0x84, 0x82, 0x81, 0x81, 0x80, 0x7e,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x83, 0x86, 0x8a, 0x8d, 0x90,
-  0x93, 0x95, 0x9a, 0x9c, 0x9f, 0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3,
-  0xa3, 0xa3, 0xa1, 0x9e, 0x9a, 0x92, 0x85, 0x76, 0x6a, 0x64, 0x5c, 0x55,
-  0x53, 0x50, 0x50, 0x51, 0x53, 0x57, 0x58, 0x5a, 0x5b, 0x5e, 0x63, 0x66,
-  0x66, 0x65, 0x64, 0x66, 0x69, 0x69, 0x69, 0x6b, 0x6f, 0x71, 0x73, 0x7a,
-  0x83, 0x8b, 0x92, 0x95, 0x98, 0x9b, 0x9d, 0x9c, 0x9c, 0x9a, 0x9b, 0x9a,
-  0x9b, 0x9b, 0x9a, 0x98, 0x97, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x90, 0x91, 0x91, 0x92, 0x92, 0x94, 0x95, 0x95, 0x95,
-  0x97, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97,
-  0x95, 0x93, 0x8f, 0x89, 0x82, 0x7c, 0x77, 0x70, 0x67, 0x5f, 0x5b, 0x59,
-  0x58, 0x57, 0x58, 0x58, 0x58, 0x59, 0x58, 0x57, 0x56, 0x57, 0x57, 0x57,
-  0x57, 0x59, 0x59, 0x59, 0x57, 0x58, 0x59, 0x59, 0x59, 0x5a, 0x5b, 0x5b,
-  0x5c, 0x5c, 0x5d, 0x5e, 0x5e, 0x5f, 0x5f, 0x61, 0x64, 0x64, 0x66, 0x67,
-  0x67, 0x69, 0x6a, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a, 0x6c, 0x6e, 0x6f, 0x71,
-  0x71, 0x70, 0x70, 0x6d, 0x6a, 0x67, 0x65, 0x63, 0x60, 0x5b, 0x57, 0x52,
-  0x4f, 0x4c, 0x45, 0x3d, 0x38, 0x33, 0x2a, 0x1e, 0x15, 0x11, 0x10, 0x11,
-  0x10, 0x11, 0x12, 0x12, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x12, 0x13,
-  0x13, 0x13, 0x12, 0x12, 0x5d, 0x5a, 0x57, 0x55, 0x54, 0x53, 0x52, 0x52,
-  0x52, 0x52, 0x53, 0x53, 0x52, 0x52, 0x54, 0x56, 0x56, 0x56, 0x57, 0x57,
-  0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5e, 0x60, 0x60, 0x60, 0x61, 0x62, 0x62,
-  0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6a, 0x6b, 0x6c, 0x6d, 0x6c,
-  0x6c, 0x71, 0x78, 0x7e, 0x80, 0x82, 0x86, 0x88, 0x8b, 0x8c, 0x8d, 0x8e,
-  0x90, 0x92, 0x93, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x97, 0x98, 0x9a,
-  0x9a, 0x9a, 0x9b, 0x9a, 0x9a, 0x9b, 0x9a, 0x98, 0x96, 0x95, 0x94, 0x93,
-  0x92, 0x92, 0x90, 0x8d, 0x8d, 0x8c, 0x8b, 0x8a, 0x88, 0x87, 0x86, 0x84,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x85, 0x86,
-  0x86, 0x87, 0x86, 0x84, 0x83, 0x82, 0x7f, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d,
-  0x7f, 0x81, 0x82, 0x83, 0x85, 0x89, 0x8c, 0x8f, 0x91, 0x94, 0x99, 0x9b,
-  0x9e, 0x9e, 0xa0, 0xa1, 0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0x9b,
-  0x95, 0x87, 0x74, 0x65, 0x5e, 0x5b, 0x56, 0x53, 0x52, 0x50, 0x50, 0x52,
-  0x56, 0x58, 0x5a, 0x5a, 0x5a, 0x5b, 0x60, 0x62, 0x63, 0x64, 0x63, 0x66,
-  0x68, 0x68, 0x64, 0x60, 0x5e, 0x5d, 0x5d, 0x5f, 0x64, 0x6b, 0x75, 0x7b,
-  0x86, 0x90, 0x98, 0x9b, 0x9c, 0x9b, 0x9b, 0x99, 0x96, 0x94, 0x93, 0x94,
-  0x96, 0x97, 0x97, 0x94, 0x92, 0x93, 0x91, 0x8f, 0x8f, 0x8f, 0x8f, 0x91,
-  0x92, 0x92, 0x93, 0x93, 0x95, 0x96, 0x96, 0x96, 0x97, 0x97, 0x98, 0x98,
-  0x98, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x96, 0x93, 0x91, 0x8e, 0x87,
-  0x7f, 0x78, 0x74, 0x6d, 0x64, 0x5d, 0x59, 0x57, 0x57, 0x56, 0x57, 0x57,
-  0x57, 0x58, 0x57, 0x56, 0x57, 0x57, 0x57, 0x57, 0x56, 0x58, 0x58, 0x58,
-  0x57, 0x59, 0x59, 0x59, 0x58, 0x58, 0x5a, 0x59, 0x5a, 0x5a, 0x5b, 0x5d,
-  0x5f, 0x5f, 0x60, 0x61, 0x63, 0x65, 0x66, 0x66, 0x67, 0x68, 0x6b, 0x6c,
-  0x6c, 0x6c, 0x6a, 0x6b, 0x6c, 0x6e, 0x6f, 0x71, 0x72, 0x71, 0x6f, 0x6d,
-  0x6b, 0x68, 0x66, 0x64, 0x5f, 0x5b, 0x57, 0x52, 0x50, 0x4d, 0x46, 0x3e,
-  0x3a, 0x35, 0x2c, 0x1f, 0x15, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x11, 0x11, 0x11, 0x13, 0x14, 0x13, 0x13, 0x13, 0x12, 0x11, 0x11, 0x13,
-  0x58, 0x57, 0x55, 0x54, 0x54, 0x53, 0x51, 0x51, 0x51, 0x51, 0x51, 0x52,
-  0x52, 0x52, 0x53, 0x56, 0x56, 0x58, 0x58, 0x58, 0x59, 0x5b, 0x5b, 0x5b,
-  0x5c, 0x5e, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63, 0x64, 0x65, 0x66,
-  0x66, 0x67, 0x68, 0x69, 0x6a, 0x6c, 0x6b, 0x6b, 0x6b, 0x6e, 0x73, 0x78,
-  0x7a, 0x7d, 0x80, 0x84, 0x87, 0x88, 0x89, 0x8b, 0x8e, 0x8f, 0x90, 0x91,
-  0x92, 0x93, 0x92, 0x92, 0x94, 0x96, 0x96, 0x98, 0x98, 0x98, 0x99, 0x99,
-  0x9a, 0x9a, 0x99, 0x97, 0x96, 0x94, 0x93, 0x92, 0x91, 0x91, 0x8f, 0x8d,
-  0x8d, 0x8d, 0x8b, 0x8a, 0x88, 0x88, 0x86, 0x84, 0x82, 0x81, 0x81, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x85, 0x85, 0x85, 0x86, 0x86, 0x85,
-  0x84, 0x82, 0x80, 0x7d, 0x7b, 0x7c, 0x7c, 0x7c, 0x7e, 0x81, 0x82, 0x82,
-  0x85, 0x89, 0x8c, 0x8e, 0x90, 0x93, 0x97, 0x9b, 0x9e, 0x9f, 0xa1, 0xa1,
-  0xa2, 0xa3, 0xa3, 0xa3, 0xa3, 0xa2, 0x9d, 0x95, 0x8b, 0x77, 0x62, 0x5a,
-  0x5a, 0x58, 0x54, 0x53, 0x52, 0x52, 0x53, 0x55, 0x59, 0x5b, 0x5c, 0x5c,
-  0x5b, 0x5b, 0x5a, 0x59, 0x5a, 0x59, 0x59, 0x5b, 0x5c, 0x5a, 0x56, 0x54,
-  0x54, 0x51, 0x50, 0x4f, 0x50, 0x51, 0x55, 0x5b, 0x64, 0x70, 0x7d, 0x8b,
-  0x92, 0x97, 0x93, 0x89, 0x7f, 0x79, 0x71, 0x75, 0x84, 0x91, 0x95, 0x95,
-  0x93, 0x92, 0x92, 0x91, 0x90, 0x90, 0x91, 0x90, 0x92, 0x92, 0x92, 0x93,
-  0x95, 0x96, 0x96, 0x97, 0x96, 0x97, 0x97, 0x97, 0x97, 0x96, 0x98, 0x98,
-  0x98, 0x97, 0x97, 0x95, 0x92, 0x90, 0x8d, 0x86, 0x7c, 0x76, 0x71, 0x69,
-  0x61, 0x5b, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x59, 0x57, 0x55,
-  0x56, 0x56, 0x55, 0x56, 0x55, 0x57, 0x57, 0x57, 0x56, 0x58, 0x59, 0x58,
-  0x58, 0x58, 0x59, 0x59, 0x5a, 0x5a, 0x5b, 0x5d, 0x5f, 0x5f, 0x60, 0x63,
-  0x65, 0x65, 0x67, 0x68, 0x69, 0x69, 0x6b, 0x6d, 0x6e, 0x6e, 0x6c, 0x6c,
-  0x6e, 0x6f, 0x6f, 0x71, 0x72, 0x70, 0x6f, 0x6d, 0x6b, 0x67, 0x66, 0x65,
-  0x61, 0x5c, 0x58, 0x53, 0x50, 0x4c, 0x47, 0x40, 0x3b, 0x36, 0x2f, 0x23,
-  0x15, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13,
-  0x14, 0x13, 0x13, 0x11, 0x12, 0x12, 0x11, 0x13, 0x57, 0x57, 0x54, 0x53,
-  0x54, 0x53, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x55,
-  0x56, 0x58, 0x58, 0x58, 0x59, 0x5b, 0x5b, 0x5c, 0x5d, 0x5e, 0x60, 0x62,
-  0x61, 0x60, 0x61, 0x64, 0x64, 0x65, 0x66, 0x67, 0x66, 0x67, 0x69, 0x69,
-  0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6d, 0x71, 0x74, 0x78, 0x7b, 0x80,
-  0x83, 0x84, 0x86, 0x88, 0x8b, 0x8c, 0x8d, 0x8f, 0x90, 0x91, 0x91, 0x91,
-  0x93, 0x95, 0x94, 0x95, 0x95, 0x96, 0x97, 0x98, 0x98, 0x98, 0x97, 0x96,
-  0x94, 0x93, 0x93, 0x93, 0x91, 0x90, 0x8e, 0x8d, 0x8c, 0x8c, 0x8b, 0x89,
-  0x88, 0x87, 0x86, 0x84, 0x83, 0x82, 0x81, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-  0x84, 0x85, 0x85, 0x86, 0x86, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7c,
-  0x7b, 0x7c, 0x7c, 0x7b, 0x7d, 0x80, 0x81, 0x81, 0x83, 0x88, 0x8c, 0x8e,
-  0x90, 0x93, 0x96, 0x9a, 0x9d, 0x9f, 0xa0, 0xa1, 0xa2, 0xa2, 0xa2, 0xa3,
-  0xa3, 0xa3, 0x9b, 0x8f, 0x82, 0x6c, 0x5d, 0x5a, 0x5a, 0x58, 0x54, 0x54,
-  0x55, 0x57, 0x58, 0x5b, 0x5c, 0x5c, 0x5c, 0x5d, 0x5c, 0x5a, 0x59, 0x58,
-  0x57, 0x59, 0x60, 0x60, 0x5d, 0x5b, 0x59, 0x54, 0x52, 0x4e, 0x4d, 0x4d,
-  0x4d, 0x4c, 0x4f, 0x52, 0x57, 0x5d, 0x67, 0x73, 0x7b, 0x7e, 0x79, 0x84,
-  0x8a, 0x83, 0x6c, 0x5b, 0x62, 0x73, 0x81, 0x93, 0x94, 0x93, 0x93, 0x91,
-  0x90, 0x90, 0x91, 0x91, 0x92, 0x93, 0x94, 0x94, 0x95, 0x95, 0x95, 0x95,
-  0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x95,
-  0x92, 0x8f, 0x8b, 0x83, 0x7a, 0x73, 0x6e, 0x67, 0x5e, 0x58, 0x56, 0x56,
-  0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x57, 0x55, 0x56, 0x55, 0x54, 0x55,
-  0x54, 0x55, 0x56, 0x56, 0x55, 0x56, 0x58, 0x58, 0x57, 0x58, 0x59, 0x5a,
-  0x5a, 0x5b, 0x5b, 0x5d, 0x5f, 0x5f, 0x60, 0x63, 0x66, 0x67, 0x68, 0x69,
-  0x69, 0x6a, 0x6c, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x72,
-  0x71, 0x70, 0x6f, 0x6e, 0x6c, 0x68, 0x66, 0x65, 0x60, 0x5e, 0x59, 0x54,
-  0x51, 0x4e, 0x48, 0x40, 0x3b, 0x37, 0x2f, 0x21, 0x15, 0x11, 0x11, 0x11,
-  0x10, 0x11, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x12, 0x13, 0x11,
-  0x11, 0x11, 0x11, 0x13, 0x56, 0x56, 0x55, 0x53, 0x53, 0x53, 0x53, 0x53,
-  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x55, 0x57, 0x58, 0x59,
-  0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x62, 0x63, 0x63, 0x62, 0x63, 0x65,
-  0x65, 0x66, 0x66, 0x67, 0x67, 0x67, 0x68, 0x68, 0x6a, 0x6a, 0x6a, 0x6a,
-  0x6b, 0x6b, 0x6b, 0x6d, 0x70, 0x74, 0x77, 0x7c, 0x7f, 0x81, 0x83, 0x85,
-  0x88, 0x89, 0x8b, 0x8d, 0x8e, 0x90, 0x91, 0x92, 0x93, 0x93, 0x95, 0x95,
-  0x94, 0x94, 0x95, 0x96, 0x96, 0x95, 0x95, 0x94, 0x94, 0x92, 0x93, 0x92,
-  0x91, 0x8f, 0x8d, 0x8c, 0x8c, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x86, 0x83,
-  0x81, 0x81, 0x80, 0x7e, 0x7e, 0x81, 0x83, 0x83, 0x84, 0x85, 0x86, 0x88,
-  0x88, 0x89, 0x86, 0x84, 0x82, 0x81, 0x7f, 0x7d, 0x7b, 0x7b, 0x7b, 0x7a,
-  0x7c, 0x7f, 0x81, 0x81, 0x83, 0x87, 0x8b, 0x8e, 0x91, 0x93, 0x95, 0x99,
-  0x9c, 0x9e, 0x9f, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2, 0xa3, 0xa2, 0x98, 0x8a,
-  0x7d, 0x69, 0x5e, 0x5b, 0x59, 0x58, 0x55, 0x57, 0x59, 0x5b, 0x5c, 0x5d,
-  0x5b, 0x5b, 0x5d, 0x5d, 0x5b, 0x58, 0x58, 0x5b, 0x63, 0x75, 0x83, 0x76,
-  0x68, 0x65, 0x65, 0x5e, 0x5a, 0x53, 0x4f, 0x4d, 0x4b, 0x49, 0x4e, 0x51,
-  0x56, 0x5c, 0x67, 0x6f, 0x6f, 0x68, 0x75, 0xa8, 0xb6, 0xac, 0x89, 0x5e,
-  0x52, 0x58, 0x6a, 0x8f, 0x96, 0x93, 0x91, 0x90, 0x91, 0x90, 0x90, 0x92,
-  0x94, 0x94, 0x95, 0x96, 0x97, 0x96, 0x95, 0x96, 0x97, 0x98, 0x98, 0x98,
-  0x97, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x93, 0x91, 0x8e, 0x89, 0x81,
-  0x77, 0x70, 0x6c, 0x66, 0x5d, 0x56, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56,
-  0x56, 0x56, 0x57, 0x55, 0x56, 0x55, 0x54, 0x54, 0x55, 0x56, 0x56, 0x55,
-  0x55, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x5a, 0x5a, 0x5b, 0x5b, 0x5d,
-  0x5e, 0x60, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6c, 0x6e,
-  0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6f, 0x71, 0x72, 0x71, 0x70, 0x70, 0x6e,
-  0x6b, 0x69, 0x67, 0x65, 0x61, 0x5d, 0x58, 0x55, 0x52, 0x4e, 0x48, 0x42,
-  0x3e, 0x3a, 0x31, 0x22, 0x16, 0x12, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10,
-  0x11, 0x12, 0x13, 0x12, 0x12, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x13,
-  0x56, 0x56, 0x55, 0x54, 0x53, 0x53, 0x54, 0x53, 0x53, 0x54, 0x54, 0x53,
-  0x53, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5d, 0x5d, 0x5e,
-  0x5f, 0x61, 0x63, 0x64, 0x64, 0x63, 0x64, 0x65, 0x65, 0x66, 0x66, 0x66,
-  0x67, 0x67, 0x67, 0x68, 0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c,
-  0x6d, 0x70, 0x74, 0x79, 0x7d, 0x7e, 0x81, 0x82, 0x86, 0x87, 0x88, 0x8b,
-  0x8e, 0x8f, 0x91, 0x91, 0x92, 0x92, 0x94, 0x94, 0x93, 0x92, 0x93, 0x94,
-  0x94, 0x93, 0x93, 0x93, 0x92, 0x91, 0x91, 0x91, 0x90, 0x8e, 0x8d, 0x8c,
-  0x8c, 0x8c, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x82, 0x81, 0x81, 0x80, 0x7e,
-  0x7f, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x89, 0x8a, 0x89, 0x86, 0x83,
-  0x82, 0x81, 0x7f, 0x7d, 0x7b, 0x7b, 0x7b, 0x7a, 0x7c, 0x7e, 0x80, 0x81,
-  0x83, 0x87, 0x8a, 0x8e, 0x90, 0x92, 0x96, 0x9a, 0x9c, 0x9d, 0x9f, 0xa1,
-  0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0x96, 0x87, 0x7a, 0x68, 0x5e, 0x5b,
-  0x59, 0x57, 0x56, 0x59, 0x5c, 0x5c, 0x5d, 0x5d, 0x5b, 0x5b, 0x5d, 0x5d,
-  0x5b, 0x5b, 0x63, 0x6b, 0x75, 0x8a, 0x97, 0x83, 0x74, 0x6f, 0x6a, 0x61,
-  0x61, 0x56, 0x51, 0x4f, 0x4b, 0x4a, 0x4f, 0x53, 0x57, 0x5e, 0x69, 0x73,
-  0x70, 0x66, 0x80, 0xbd, 0xca, 0xbd, 0x95, 0x61, 0x4d, 0x4c, 0x5d, 0x87,
-  0x95, 0x93, 0x91, 0x90, 0x91, 0x90, 0x90, 0x92, 0x94, 0x95, 0x95, 0x96,
-  0x97, 0x96, 0x95, 0x96, 0x97, 0x98, 0x98, 0x98, 0x97, 0x96, 0x96, 0x96,
-  0x96, 0x96, 0x96, 0x93, 0x8f, 0x8c, 0x87, 0x7f, 0x75, 0x6e, 0x6a, 0x64,
-  0x5b, 0x56, 0x55, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x55,
-  0x55, 0x55, 0x54, 0x54, 0x55, 0x55, 0x55, 0x54, 0x54, 0x57, 0x58, 0x58,
-  0x59, 0x58, 0x59, 0x5a, 0x5a, 0x5b, 0x5b, 0x5d, 0x5e, 0x60, 0x61, 0x63,
-  0x64, 0x68, 0x69, 0x6a, 0x6b, 0x6b, 0x6c, 0x6e, 0x6f, 0x6f, 0x6e, 0x6e,
-  0x6e, 0x6f, 0x72, 0x72, 0x72, 0x71, 0x70, 0x6e, 0x6b, 0x6a, 0x67, 0x65,
-  0x61, 0x5d, 0x57, 0x54, 0x51, 0x4e, 0x49, 0x43, 0x3f, 0x3a, 0x31, 0x22,
-  0x16, 0x12, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11,
-  0x12, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x13, 0x56, 0x56, 0x56, 0x55,
-  0x54, 0x54, 0x55, 0x54, 0x54, 0x55, 0x55, 0x54, 0x54, 0x54, 0x55, 0x56,
-  0x57, 0x58, 0x5a, 0x5b, 0x5c, 0x5e, 0x5e, 0x5f, 0x60, 0x62, 0x63, 0x64,
-  0x64, 0x64, 0x65, 0x64, 0x65, 0x66, 0x66, 0x66, 0x67, 0x68, 0x68, 0x69,
-  0x69, 0x69, 0x69, 0x69, 0x6a, 0x6a, 0x69, 0x69, 0x6a, 0x6c, 0x70, 0x75,
-  0x77, 0x7a, 0x7c, 0x7e, 0x82, 0x84, 0x86, 0x89, 0x8c, 0x8d, 0x8f, 0x90,
-  0x91, 0x91, 0x92, 0x92, 0x90, 0x90, 0x91, 0x91, 0x91, 0x92, 0x91, 0x91,
-  0x90, 0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a,
-  0x88, 0x87, 0x85, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x83,
-  0x84, 0x85, 0x87, 0x8a, 0x8b, 0x8a, 0x87, 0x83, 0x82, 0x81, 0x7f, 0x7d,
-  0x7b, 0x7b, 0x7a, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x83, 0x86, 0x89, 0x8d,
-  0x8e, 0x91, 0x96, 0x9a, 0x9c, 0x9e, 0x9f, 0xa1, 0xa2, 0xa2, 0xa2, 0xa2,
-  0xa2, 0xa0, 0x93, 0x83, 0x77, 0x69, 0x5f, 0x5a, 0x57, 0x57, 0x59, 0x5c,
-  0x5e, 0x5e, 0x5d, 0x5c, 0x5b, 0x5d, 0x5e, 0x5d, 0x5c, 0x65, 0x7d, 0x8b,
-  0x92, 0x9a, 0x9b, 0x8b, 0x85, 0x7d, 0x6a, 0x61, 0x67, 0x58, 0x51, 0x51,
-  0x4d, 0x4d, 0x53, 0x55, 0x59, 0x60, 0x6c, 0x7c, 0x7d, 0x79, 0x9d, 0xc7,
-  0xc6, 0xb6, 0x92, 0x64, 0x4c, 0x46, 0x51, 0x74, 0x92, 0x94, 0x92, 0x91,
-  0x92, 0x91, 0x91, 0x93, 0x94, 0x95, 0x95, 0x97, 0x97, 0x96, 0x95, 0x96,
-  0x97, 0x98, 0x98, 0x98, 0x98, 0x97, 0x97, 0x97, 0x97, 0x97, 0x95, 0x91,
-  0x8e, 0x8b, 0x85, 0x7c, 0x72, 0x6b, 0x67, 0x61, 0x5a, 0x55, 0x55, 0x55,
-  0x56, 0x57, 0x57, 0x57, 0x56, 0x55, 0x55, 0x54, 0x55, 0x54, 0x53, 0x53,
-  0x54, 0x55, 0x55, 0x53, 0x53, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x5a,
-  0x5a, 0x5b, 0x5b, 0x5d, 0x5e, 0x5f, 0x61, 0x63, 0x64, 0x67, 0x69, 0x6b,
-  0x6c, 0x6c, 0x6d, 0x6e, 0x6f, 0x6e, 0x6e, 0x6f, 0x6e, 0x6f, 0x72, 0x72,
-  0x72, 0x71, 0x70, 0x6e, 0x6b, 0x6a, 0x68, 0x66, 0x63, 0x5e, 0x57, 0x54,
-  0x52, 0x4e, 0x49, 0x42, 0x3e, 0x39, 0x30, 0x22, 0x16, 0x12, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13,
-  0x11, 0x11, 0x11, 0x13, 0x56, 0x56, 0x56, 0x55, 0x54, 0x55, 0x56, 0x57,
-  0x56, 0x57, 0x57, 0x55, 0x55, 0x57, 0x58, 0x57, 0x59, 0x5a, 0x5b, 0x5d,
-  0x5f, 0x5e, 0x5e, 0x5f, 0x61, 0x63, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64,
-  0x65, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x67, 0x68, 0x69, 0x69, 0x69,
-  0x6a, 0x69, 0x66, 0x67, 0x67, 0x68, 0x6c, 0x6e, 0x72, 0x74, 0x76, 0x79,
-  0x7e, 0x81, 0x82, 0x86, 0x88, 0x8b, 0x8d, 0x8e, 0x8e, 0x90, 0x90, 0x90,
-  0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x88, 0x88, 0x86, 0x83,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x82, 0x84, 0x83, 0x86, 0x88, 0x8a,
-  0x8a, 0x8b, 0x89, 0x86, 0x84, 0x82, 0x80, 0x7e, 0x7b, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7d, 0x7e, 0x7f, 0x82, 0x85, 0x8a, 0x8c, 0x8d, 0x91, 0x95, 0x99,
-  0x9c, 0x9e, 0x9f, 0xa0, 0xa1, 0xa1, 0xa2, 0xa2, 0xa2, 0x9f, 0x8f, 0x7f,
-  0x74, 0x68, 0x5f, 0x5a, 0x58, 0x59, 0x5d, 0x61, 0x61, 0x5e, 0x5d, 0x5b,
-  0x5e, 0x5f, 0x5c, 0x5b, 0x5f, 0x6f, 0x7f, 0x84, 0x82, 0x7f, 0x83, 0x85,
-  0x84, 0x7e, 0x73, 0x71, 0x6d, 0x5a, 0x52, 0x4f, 0x4d, 0x4e, 0x51, 0x53,
-  0x58, 0x60, 0x6c, 0x83, 0x8f, 0x9d, 0xbb, 0xbb, 0x9e, 0x91, 0x88, 0x67,
-  0x50, 0x48, 0x4d, 0x62, 0x83, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92, 0x94,
-  0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97, 0x97, 0x98, 0x98, 0x98, 0x98,
-  0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x93, 0x8e, 0x8a, 0x87, 0x81, 0x78,
-  0x6f, 0x69, 0x65, 0x5f, 0x58, 0x55, 0x55, 0x54, 0x54, 0x56, 0x56, 0x56,
-  0x56, 0x55, 0x55, 0x54, 0x52, 0x51, 0x50, 0x51, 0x53, 0x54, 0x54, 0x53,
-  0x54, 0x54, 0x55, 0x56, 0x56, 0x58, 0x59, 0x5a, 0x5b, 0x5b, 0x5b, 0x5e,
-  0x5f, 0x61, 0x62, 0x62, 0x64, 0x68, 0x69, 0x6a, 0x6b, 0x6e, 0x6f, 0x70,
-  0x70, 0x6f, 0x70, 0x6f, 0x6f, 0x70, 0x72, 0x73, 0x71, 0x71, 0x71, 0x70,
-  0x6d, 0x69, 0x67, 0x66, 0x63, 0x5e, 0x59, 0x55, 0x53, 0x4e, 0x49, 0x42,
-  0x3d, 0x39, 0x31, 0x23, 0x16, 0x13, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x12, 0x11, 0x11, 0x13,
-  0x57, 0x58, 0x57, 0x56, 0x55, 0x55, 0x57, 0x58, 0x58, 0x58, 0x58, 0x56,
-  0x57, 0x58, 0x59, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5f, 0x5f, 0x61, 0x61,
-  0x62, 0x63, 0x64, 0x64, 0x64, 0x64, 0x65, 0x66, 0x67, 0x68, 0x68, 0x68,
-  0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x6a, 0x68, 0x65, 0x65,
-  0x65, 0x65, 0x67, 0x68, 0x6c, 0x6e, 0x6f, 0x73, 0x77, 0x7b, 0x7e, 0x81,
-  0x85, 0x89, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8d,
-  0x8c, 0x8d, 0x8d, 0x8b, 0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c,
-  0x8c, 0x8d, 0x8b, 0x88, 0x87, 0x87, 0x86, 0x83, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x83, 0x84, 0x84, 0x87, 0x89, 0x8b, 0x8b, 0x8a, 0x89, 0x86,
-  0x84, 0x83, 0x80, 0x7e, 0x7b, 0x7a, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f,
-  0x82, 0x85, 0x89, 0x8b, 0x8c, 0x90, 0x95, 0x99, 0x9c, 0x9d, 0x9e, 0xa0,
-  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9b, 0x8b, 0x7b, 0x72, 0x68, 0x5f, 0x5b,
-  0x59, 0x5b, 0x60, 0x65, 0x65, 0x62, 0x5f, 0x5e, 0x61, 0x5f, 0x5d, 0x5d,
-  0x63, 0x6b, 0x6c, 0x6a, 0x69, 0x69, 0x6e, 0x6e, 0x75, 0x7c, 0x85, 0x7f,
-  0x7b, 0x67, 0x5a, 0x51, 0x4d, 0x4b, 0x4c, 0x4d, 0x50, 0x56, 0x64, 0x86,
-  0xa0, 0xbe, 0xc5, 0xa6, 0x89, 0x83, 0x84, 0x61, 0x53, 0x56, 0x58, 0x58,
-  0x63, 0x8c, 0x94, 0x92, 0x92, 0x93, 0x93, 0x94, 0x96, 0x96, 0x96, 0x97,
-  0x96, 0x97, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96,
-  0x95, 0x93, 0x90, 0x8b, 0x86, 0x83, 0x7d, 0x74, 0x6c, 0x65, 0x61, 0x5b,
-  0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x53, 0x52,
-  0x51, 0x50, 0x50, 0x51, 0x50, 0x52, 0x52, 0x52, 0x53, 0x53, 0x55, 0x56,
-  0x57, 0x59, 0x59, 0x5a, 0x5b, 0x5a, 0x5b, 0x5e, 0x5f, 0x61, 0x62, 0x62,
-  0x65, 0x68, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x6f, 0x70, 0x72, 0x72,
-  0x72, 0x72, 0x71, 0x72, 0x71, 0x71, 0x71, 0x70, 0x6d, 0x69, 0x67, 0x65,
-  0x62, 0x5f, 0x59, 0x56, 0x53, 0x4e, 0x4a, 0x43, 0x3d, 0x3a, 0x32, 0x24,
-  0x17, 0x13, 0x12, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x13, 0x13,
-  0x13, 0x13, 0x13, 0x13, 0x12, 0x11, 0x12, 0x14, 0x58, 0x59, 0x58, 0x57,
-  0x56, 0x56, 0x57, 0x58, 0x58, 0x58, 0x57, 0x57, 0x58, 0x59, 0x5a, 0x5a,
-  0x5c, 0x5d, 0x5d, 0x5d, 0x5f, 0x60, 0x62, 0x62, 0x62, 0x64, 0x64, 0x64,
-  0x64, 0x64, 0x65, 0x67, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x68,
-  0x68, 0x69, 0x69, 0x69, 0x6a, 0x68, 0x66, 0x64, 0x63, 0x64, 0x63, 0x64,
-  0x67, 0x69, 0x6b, 0x6e, 0x73, 0x78, 0x7b, 0x7e, 0x82, 0x87, 0x8a, 0x8b,
-  0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8c, 0x8d, 0x8c, 0x8a,
-  0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8c, 0x8b, 0x88,
-  0x87, 0x86, 0x84, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83,
-  0x85, 0x88, 0x8b, 0x8c, 0x8c, 0x8a, 0x88, 0x85, 0x84, 0x82, 0x80, 0x7e,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x7b, 0x7d, 0x7f, 0x80, 0x82, 0x84, 0x88, 0x8a,
-  0x8b, 0x8f, 0x94, 0x99, 0x9c, 0x9c, 0x9d, 0x9f, 0x9f, 0xa0, 0x9f, 0xa0,
-  0xa0, 0x98, 0x89, 0x78, 0x6f, 0x68, 0x60, 0x5b, 0x5a, 0x5c, 0x62, 0x68,
-  0x68, 0x62, 0x61, 0x60, 0x5f, 0x5e, 0x60, 0x62, 0x65, 0x65, 0x65, 0x65,
-  0x65, 0x64, 0x65, 0x63, 0x6b, 0x75, 0x82, 0x80, 0x7c, 0x70, 0x69, 0x61,
-  0x54, 0x47, 0x46, 0x48, 0x4a, 0x52, 0x66, 0x84, 0x9f, 0xc4, 0xc5, 0x99,
-  0x82, 0x78, 0x6c, 0x5b, 0x56, 0x5f, 0x59, 0x41, 0x43, 0x86, 0x95, 0x92,
-  0x91, 0x94, 0x94, 0x94, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x98, 0x98,
-  0x98, 0x96, 0x97, 0x97, 0x97, 0x97, 0x97, 0x96, 0x95, 0x93, 0x8f, 0x89,
-  0x84, 0x80, 0x7a, 0x71, 0x69, 0x62, 0x5e, 0x59, 0x54, 0x54, 0x54, 0x54,
-  0x54, 0x53, 0x54, 0x55, 0x54, 0x53, 0x51, 0x52, 0x51, 0x50, 0x51, 0x50,
-  0x50, 0x51, 0x52, 0x51, 0x53, 0x54, 0x55, 0x56, 0x56, 0x58, 0x59, 0x5b,
-  0x5c, 0x5b, 0x5c, 0x5e, 0x60, 0x62, 0x62, 0x63, 0x66, 0x68, 0x6a, 0x6c,
-  0x6d, 0x6e, 0x70, 0x70, 0x71, 0x72, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72,
-  0x72, 0x71, 0x71, 0x6f, 0x6d, 0x69, 0x66, 0x65, 0x62, 0x5f, 0x5a, 0x57,
-  0x54, 0x4e, 0x49, 0x44, 0x3e, 0x3a, 0x31, 0x23, 0x16, 0x12, 0x11, 0x10,
-  0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x13, 0x13, 0x12, 0x13, 0x12,
-  0x12, 0x12, 0x11, 0x13, 0x58, 0x59, 0x58, 0x57, 0x56, 0x56, 0x57, 0x58,
-  0x58, 0x58, 0x57, 0x58, 0x59, 0x59, 0x5b, 0x5b, 0x5d, 0x5e, 0x5e, 0x5e,
-  0x5f, 0x60, 0x62, 0x63, 0x62, 0x64, 0x64, 0x65, 0x65, 0x65, 0x66, 0x67,
-  0x68, 0x68, 0x69, 0x69, 0x68, 0x69, 0x69, 0x69, 0x68, 0x68, 0x69, 0x69,
-  0x68, 0x68, 0x66, 0x64, 0x63, 0x63, 0x61, 0x62, 0x64, 0x66, 0x68, 0x6b,
-  0x70, 0x75, 0x78, 0x7c, 0x80, 0x85, 0x88, 0x8a, 0x8a, 0x8c, 0x8d, 0x8e,
-  0x8d, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0x89, 0x88, 0x8a, 0x8a,
-  0x89, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x8b, 0x88, 0x87, 0x86, 0x83, 0x82,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x84, 0x86, 0x89, 0x8c, 0x8d,
-  0x8c, 0x8b, 0x88, 0x85, 0x84, 0x82, 0x80, 0x7e, 0x7b, 0x7b, 0x7a, 0x79,
-  0x7a, 0x7d, 0x7f, 0x80, 0x82, 0x84, 0x87, 0x89, 0x8b, 0x8e, 0x93, 0x98,
-  0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa0, 0xa0, 0xa0, 0x97, 0x87, 0x77,
-  0x6f, 0x68, 0x60, 0x5b, 0x5a, 0x5d, 0x63, 0x6a, 0x69, 0x63, 0x60, 0x60,
-  0x61, 0x67, 0x6f, 0x72, 0x6f, 0x65, 0x61, 0x60, 0x60, 0x5f, 0x5f, 0x61,
-  0x6a, 0x72, 0x7c, 0x77, 0x75, 0x77, 0x76, 0x72, 0x64, 0x48, 0x43, 0x45,
-  0x49, 0x50, 0x66, 0x85, 0xa0, 0xc3, 0xbf, 0x93, 0x7c, 0x6f, 0x5e, 0x58,
-  0x56, 0x5f, 0x55, 0x31, 0x35, 0x82, 0x95, 0x92, 0x92, 0x94, 0x95, 0x95,
-  0x96, 0x96, 0x97, 0x96, 0x96, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x96,
-  0x97, 0x97, 0x97, 0x96, 0x95, 0x93, 0x8e, 0x87, 0x82, 0x7e, 0x78, 0x6f,
-  0x67, 0x61, 0x5c, 0x57, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x53, 0x54,
-  0x53, 0x52, 0x51, 0x52, 0x51, 0x51, 0x52, 0x51, 0x50, 0x51, 0x51, 0x52,
-  0x54, 0x54, 0x56, 0x56, 0x56, 0x58, 0x59, 0x5b, 0x5c, 0x5c, 0x5c, 0x5e,
-  0x60, 0x62, 0x62, 0x63, 0x65, 0x68, 0x6a, 0x6c, 0x6d, 0x6e, 0x70, 0x70,
-  0x71, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x73, 0x73, 0x72, 0x71, 0x70,
-  0x6d, 0x69, 0x67, 0x65, 0x62, 0x5f, 0x5b, 0x57, 0x54, 0x4f, 0x49, 0x45,
-  0x3f, 0x3a, 0x31, 0x23, 0x17, 0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x10,
-  0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x12,
-  0x58, 0x58, 0x57, 0x56, 0x55, 0x57, 0x58, 0x57, 0x57, 0x57, 0x57, 0x59,
-  0x59, 0x5a, 0x5b, 0x5b, 0x5d, 0x5e, 0x5f, 0x5e, 0x5f, 0x60, 0x62, 0x62,
-  0x64, 0x65, 0x64, 0x66, 0x66, 0x65, 0x66, 0x66, 0x67, 0x68, 0x69, 0x69,
-  0x68, 0x69, 0x6a, 0x6a, 0x69, 0x67, 0x68, 0x68, 0x67, 0x68, 0x66, 0x64,
-  0x63, 0x63, 0x60, 0x60, 0x61, 0x61, 0x63, 0x67, 0x6e, 0x72, 0x74, 0x78,
-  0x7c, 0x82, 0x86, 0x87, 0x89, 0x8a, 0x8c, 0x8c, 0x8b, 0x8c, 0x8c, 0x8b,
-  0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x89, 0x89, 0x88, 0x89, 0x8a, 0x8b,
-  0x8b, 0x8b, 0x8b, 0x89, 0x87, 0x85, 0x83, 0x81, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x81, 0x83, 0x84, 0x87, 0x8a, 0x8c, 0x8d, 0x8c, 0x8b, 0x88, 0x86,
-  0x84, 0x83, 0x81, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x7c, 0x7e, 0x7f,
-  0x81, 0x82, 0x86, 0x88, 0x8a, 0x8e, 0x92, 0x96, 0x99, 0x9a, 0x9a, 0x9c,
-  0x9f, 0xa0, 0xa0, 0xa0, 0xa0, 0x96, 0x85, 0x75, 0x6d, 0x67, 0x60, 0x5b,
-  0x5a, 0x5d, 0x65, 0x6d, 0x67, 0x60, 0x5f, 0x64, 0x70, 0x84, 0x97, 0x98,
-  0x8a, 0x71, 0x60, 0x58, 0x55, 0x51, 0x54, 0x5d, 0x6a, 0x71, 0x71, 0x62,
-  0x68, 0x81, 0x8b, 0x8c, 0x84, 0x53, 0x42, 0x42, 0x49, 0x4c, 0x5e, 0x86,
-  0xa2, 0xbc, 0xaf, 0x8d, 0x71, 0x61, 0x55, 0x58, 0x51, 0x53, 0x47, 0x24,
-  0x2d, 0x7c, 0x94, 0x94, 0x93, 0x94, 0x95, 0x96, 0x96, 0x96, 0x96, 0x95,
-  0x95, 0x97, 0x98, 0x98, 0x97, 0x96, 0x95, 0x96, 0x97, 0x98, 0x97, 0x95,
-  0x93, 0x91, 0x8b, 0x84, 0x7f, 0x7b, 0x74, 0x6c, 0x63, 0x5d, 0x59, 0x56,
-  0x53, 0x53, 0x52, 0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x51, 0x51,
-  0x50, 0x51, 0x51, 0x51, 0x50, 0x51, 0x51, 0x51, 0x52, 0x55, 0x56, 0x56,
-  0x56, 0x58, 0x59, 0x5b, 0x5c, 0x5c, 0x5d, 0x5e, 0x60, 0x62, 0x62, 0x63,
-  0x65, 0x67, 0x6a, 0x6c, 0x6d, 0x6f, 0x71, 0x70, 0x71, 0x72, 0x73, 0x73,
-  0x73, 0x73, 0x72, 0x72, 0x73, 0x73, 0x72, 0x70, 0x6d, 0x69, 0x67, 0x66,
-  0x63, 0x5f, 0x5b, 0x57, 0x54, 0x50, 0x4b, 0x44, 0x3f, 0x3b, 0x33, 0x25,
-  0x17, 0x12, 0x10, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x11, 0x12, 0x13, 0x11, 0x12, 0x58, 0x58, 0x57, 0x56,
-  0x56, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x59, 0x5a, 0x5a, 0x5b, 0x5c,
-  0x5e, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x61, 0x62, 0x64, 0x65, 0x64, 0x66,
-  0x66, 0x65, 0x66, 0x66, 0x67, 0x68, 0x69, 0x69, 0x68, 0x69, 0x69, 0x6a,
-  0x69, 0x67, 0x68, 0x68, 0x67, 0x66, 0x64, 0x64, 0x63, 0x61, 0x5e, 0x5e,
-  0x5e, 0x5e, 0x5f, 0x62, 0x68, 0x6b, 0x6d, 0x72, 0x77, 0x7c, 0x80, 0x83,
-  0x85, 0x87, 0x89, 0x8a, 0x8a, 0x8a, 0x8b, 0x89, 0x88, 0x88, 0x88, 0x86,
-  0x87, 0x87, 0x87, 0x87, 0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x89,
-  0x86, 0x85, 0x83, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x84, 0x86,
-  0x88, 0x8a, 0x8b, 0x8c, 0x8c, 0x8b, 0x88, 0x85, 0x83, 0x82, 0x80, 0x7d,
-  0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x81, 0x85, 0x87,
-  0x89, 0x8d, 0x90, 0x92, 0x94, 0x95, 0x96, 0x97, 0x9a, 0x9e, 0xa0, 0xa0,
-  0x9d, 0x93, 0x82, 0x72, 0x6b, 0x65, 0x5f, 0x5b, 0x5c, 0x5f, 0x66, 0x6e,
-  0x65, 0x60, 0x65, 0x79, 0x96, 0xa8, 0xbc, 0xbc, 0xa3, 0x8b, 0x78, 0x6c,
-  0x5f, 0x4c, 0x45, 0x50, 0x5c, 0x63, 0x67, 0x58, 0x67, 0x87, 0x97, 0x9e,
-  0x94, 0x6a, 0x48, 0x41, 0x4b, 0x48, 0x57, 0x73, 0x88, 0x9c, 0x90, 0x86,
-  0x68, 0x57, 0x50, 0x56, 0x46, 0x3c, 0x30, 0x1a, 0x29, 0x75, 0x93, 0x95,
-  0x94, 0x94, 0x96, 0x96, 0x97, 0x97, 0x96, 0x95, 0x95, 0x97, 0x97, 0x96,
-  0x97, 0x96, 0x95, 0x96, 0x97, 0x97, 0x95, 0x93, 0x91, 0x8d, 0x87, 0x80,
-  0x7a, 0x75, 0x6f, 0x68, 0x5e, 0x59, 0x56, 0x52, 0x51, 0x52, 0x51, 0x51,
-  0x52, 0x51, 0x51, 0x51, 0x51, 0x50, 0x50, 0x4f, 0x50, 0x50, 0x4f, 0x50,
-  0x4f, 0x50, 0x51, 0x50, 0x52, 0x55, 0x56, 0x56, 0x56, 0x58, 0x59, 0x5b,
-  0x5c, 0x5c, 0x5e, 0x5e, 0x5f, 0x61, 0x61, 0x62, 0x66, 0x67, 0x6a, 0x6c,
-  0x6d, 0x6f, 0x71, 0x70, 0x71, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72,
-  0x73, 0x73, 0x72, 0x70, 0x6d, 0x69, 0x67, 0x66, 0x63, 0x5d, 0x5a, 0x57,
-  0x54, 0x50, 0x4a, 0x42, 0x3c, 0x38, 0x32, 0x26, 0x17, 0x12, 0x10, 0x11,
-  0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11,
-  0x12, 0x12, 0x12, 0x11, 0x58, 0x58, 0x58, 0x57, 0x56, 0x56, 0x58, 0x58,
-  0x57, 0x57, 0x58, 0x5a, 0x5a, 0x5a, 0x5c, 0x5d, 0x5d, 0x5f, 0x5f, 0x5f,
-  0x5f, 0x5f, 0x61, 0x62, 0x63, 0x64, 0x65, 0x65, 0x65, 0x66, 0x67, 0x67,
-  0x68, 0x69, 0x69, 0x69, 0x68, 0x68, 0x69, 0x69, 0x68, 0x66, 0x67, 0x67,
-  0x67, 0x64, 0x63, 0x63, 0x62, 0x60, 0x5f, 0x5d, 0x5b, 0x5b, 0x5c, 0x5d,
-  0x61, 0x65, 0x69, 0x6d, 0x72, 0x77, 0x7a, 0x7d, 0x81, 0x84, 0x86, 0x89,
-  0x89, 0x8a, 0x8a, 0x89, 0x87, 0x88, 0x87, 0x86, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x87, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x88, 0x86, 0x85, 0x83, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x84, 0x86, 0x87, 0x89, 0x8b, 0x8c, 0x8d,
-  0x8d, 0x8c, 0x89, 0x85, 0x83, 0x81, 0x7f, 0x7c, 0x7b, 0x7a, 0x7a, 0x79,
-  0x7a, 0x79, 0x7c, 0x7d, 0x7e, 0x80, 0x83, 0x87, 0x89, 0x8a, 0x8c, 0x8c,
-  0x8c, 0x8d, 0x8e, 0x90, 0x95, 0x9c, 0x9f, 0x9f, 0x9b, 0x90, 0x7f, 0x71,
-  0x6a, 0x65, 0x5f, 0x5d, 0x5e, 0x61, 0x67, 0x6c, 0x65, 0x68, 0x77, 0x96,
-  0xa0, 0xa2, 0xab, 0xa6, 0x8e, 0x81, 0x8d, 0x8b, 0x7c, 0x58, 0x3f, 0x42,
-  0x4d, 0x53, 0x58, 0x5a, 0x6a, 0x81, 0x94, 0xa7, 0x92, 0x78, 0x51, 0x47,
-  0x51, 0x4c, 0x55, 0x5b, 0x64, 0x77, 0x7d, 0x78, 0x5f, 0x53, 0x50, 0x4f,
-  0x38, 0x29, 0x20, 0x17, 0x29, 0x75, 0x94, 0x94, 0x93, 0x94, 0x96, 0x97,
-  0x97, 0x98, 0x98, 0x96, 0x96, 0x98, 0x98, 0x96, 0x97, 0x97, 0x97, 0x97,
-  0x97, 0x95, 0x93, 0x91, 0x8e, 0x89, 0x83, 0x7c, 0x76, 0x72, 0x6c, 0x64,
-  0x5b, 0x56, 0x53, 0x51, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x51, 0x50,
-  0x50, 0x4f, 0x50, 0x4f, 0x50, 0x50, 0x4f, 0x4e, 0x4e, 0x50, 0x51, 0x52,
-  0x53, 0x55, 0x56, 0x56, 0x56, 0x58, 0x58, 0x59, 0x5b, 0x5d, 0x5e, 0x5e,
-  0x61, 0x62, 0x62, 0x63, 0x66, 0x67, 0x69, 0x6a, 0x6c, 0x6f, 0x71, 0x70,
-  0x71, 0x73, 0x73, 0x72, 0x72, 0x72, 0x74, 0x75, 0x74, 0x71, 0x70, 0x6f,
-  0x6d, 0x68, 0x66, 0x65, 0x61, 0x5e, 0x5b, 0x58, 0x55, 0x50, 0x4a, 0x42,
-  0x3c, 0x37, 0x30, 0x25, 0x17, 0x12, 0x10, 0x10, 0x11, 0x10, 0x10, 0x10,
-  0x11, 0x10, 0x11, 0x12, 0x13, 0x13, 0x13, 0x13, 0x12, 0x11, 0x12, 0x11,
-  0x59, 0x58, 0x58, 0x57, 0x56, 0x56, 0x59, 0x59, 0x5a, 0x59, 0x59, 0x5b,
-  0x5a, 0x5b, 0x5d, 0x5f, 0x5e, 0x5f, 0x60, 0x60, 0x5f, 0x61, 0x62, 0x63,
-  0x64, 0x65, 0x65, 0x65, 0x66, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6a, 0x69,
-  0x69, 0x69, 0x69, 0x6a, 0x69, 0x67, 0x67, 0x67, 0x66, 0x64, 0x63, 0x62,
-  0x61, 0x61, 0x5f, 0x5c, 0x5a, 0x5a, 0x59, 0x5a, 0x5e, 0x61, 0x65, 0x6a,
-  0x6f, 0x73, 0x77, 0x79, 0x7d, 0x81, 0x84, 0x87, 0x88, 0x89, 0x89, 0x88,
-  0x88, 0x88, 0x87, 0x86, 0x84, 0x85, 0x84, 0x84, 0x85, 0x86, 0x87, 0x87,
-  0x87, 0x88, 0x89, 0x88, 0x86, 0x85, 0x83, 0x80, 0x7f, 0x80, 0x80, 0x81,
-  0x82, 0x85, 0x86, 0x88, 0x8a, 0x8c, 0x8d, 0x8e, 0x8e, 0x8d, 0x8a, 0x85,
-  0x82, 0x81, 0x7e, 0x7c, 0x7b, 0x79, 0x79, 0x7a, 0x7a, 0x79, 0x7b, 0x7d,
-  0x7e, 0x80, 0x84, 0x86, 0x88, 0x88, 0x87, 0x86, 0x85, 0x86, 0x88, 0x8b,
-  0x90, 0x98, 0x9d, 0x9e, 0x99, 0x8d, 0x7c, 0x6f, 0x68, 0x64, 0x5f, 0x5d,
-  0x60, 0x63, 0x67, 0x69, 0x6a, 0x77, 0x86, 0x95, 0x90, 0xa3, 0xa9, 0xa5,
-  0x9b, 0x94, 0x98, 0x94, 0x86, 0x65, 0x44, 0x3d, 0x45, 0x4a, 0x4f, 0x57,
-  0x65, 0x75, 0x89, 0xa4, 0x8a, 0x66, 0x50, 0x4d, 0x55, 0x51, 0x51, 0x50,
-  0x53, 0x5c, 0x65, 0x67, 0x5a, 0x53, 0x50, 0x47, 0x2c, 0x22, 0x1d, 0x18,
-  0x2d, 0x78, 0x94, 0x95, 0x94, 0x94, 0x96, 0x97, 0x98, 0x98, 0x98, 0x98,
-  0x98, 0x99, 0x99, 0x98, 0x97, 0x97, 0x97, 0x97, 0x96, 0x94, 0x92, 0x8f,
-  0x8c, 0x87, 0x80, 0x7a, 0x73, 0x6f, 0x69, 0x60, 0x58, 0x53, 0x51, 0x50,
-  0x4f, 0x4f, 0x4f, 0x50, 0x51, 0x4f, 0x4f, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e,
-  0x4f, 0x4f, 0x4e, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x55, 0x56, 0x56,
-  0x56, 0x58, 0x58, 0x59, 0x5b, 0x5c, 0x5e, 0x5e, 0x61, 0x62, 0x63, 0x63,
-  0x66, 0x67, 0x69, 0x6a, 0x6c, 0x6f, 0x71, 0x70, 0x71, 0x73, 0x74, 0x72,
-  0x72, 0x73, 0x75, 0x75, 0x74, 0x71, 0x70, 0x70, 0x6d, 0x68, 0x67, 0x64,
-  0x61, 0x5d, 0x5b, 0x58, 0x55, 0x50, 0x4a, 0x43, 0x3d, 0x38, 0x2f, 0x24,
-  0x18, 0x12, 0x10, 0x10, 0x12, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12,
-  0x13, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x11, 0x59, 0x59, 0x59, 0x58,
-  0x57, 0x56, 0x5a, 0x5a, 0x5b, 0x5a, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f,
-  0x5e, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x63, 0x63, 0x65, 0x65, 0x65, 0x66,
-  0x66, 0x68, 0x68, 0x68, 0x69, 0x6a, 0x6a, 0x69, 0x68, 0x69, 0x69, 0x6a,
-  0x69, 0x68, 0x68, 0x67, 0x66, 0x64, 0x64, 0x62, 0x61, 0x61, 0x5f, 0x5d,
-  0x5b, 0x5a, 0x58, 0x59, 0x5c, 0x5f, 0x62, 0x67, 0x6c, 0x71, 0x74, 0x76,
-  0x7b, 0x80, 0x83, 0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86,
-  0x83, 0x84, 0x83, 0x84, 0x84, 0x85, 0x87, 0x86, 0x87, 0x87, 0x88, 0x88,
-  0x86, 0x85, 0x83, 0x80, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x85, 0x87, 0x88,
-  0x8a, 0x8c, 0x8e, 0x8e, 0x8e, 0x8d, 0x8a, 0x85, 0x82, 0x81, 0x7e, 0x7c,
-  0x7b, 0x79, 0x79, 0x7a, 0x7a, 0x79, 0x7b, 0x7d, 0x7e, 0x80, 0x83, 0x86,
-  0x87, 0x86, 0x85, 0x82, 0x80, 0x80, 0x82, 0x85, 0x8c, 0x95, 0x9b, 0x9c,
-  0x97, 0x8b, 0x7a, 0x6d, 0x67, 0x63, 0x5f, 0x5e, 0x61, 0x64, 0x67, 0x69,
-  0x6f, 0x82, 0x8c, 0x8e, 0x8f, 0xa7, 0xab, 0xaa, 0xa7, 0x9f, 0x97, 0x8e,
-  0x82, 0x66, 0x47, 0x3e, 0x44, 0x48, 0x4d, 0x58, 0x67, 0x71, 0x80, 0x97,
-  0x85, 0x60, 0x52, 0x52, 0x5a, 0x58, 0x51, 0x4e, 0x4f, 0x52, 0x59, 0x5c,
-  0x55, 0x51, 0x4e, 0x40, 0x26, 0x23, 0x24, 0x25, 0x38, 0x7d, 0x94, 0x95,
-  0x95, 0x94, 0x96, 0x97, 0x98, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x99,
-  0x97, 0x97, 0x97, 0x97, 0x95, 0x94, 0x91, 0x8d, 0x8a, 0x85, 0x7e, 0x77,
-  0x71, 0x6c, 0x66, 0x5d, 0x55, 0x51, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f,
-  0x50, 0x4f, 0x4e, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4e, 0x4f, 0x4e, 0x4e,
-  0x4f, 0x50, 0x51, 0x52, 0x53, 0x55, 0x56, 0x56, 0x56, 0x58, 0x58, 0x5a,
-  0x5b, 0x5c, 0x5e, 0x5e, 0x61, 0x62, 0x63, 0x63, 0x66, 0x67, 0x69, 0x6a,
-  0x6c, 0x6f, 0x71, 0x70, 0x71, 0x74, 0x74, 0x73, 0x73, 0x74, 0x75, 0x75,
-  0x74, 0x71, 0x70, 0x70, 0x6d, 0x69, 0x67, 0x64, 0x60, 0x5d, 0x5b, 0x58,
-  0x55, 0x50, 0x4a, 0x43, 0x3e, 0x39, 0x2f, 0x24, 0x17, 0x12, 0x10, 0x10,
-  0x12, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x12, 0x12,
-  0x13, 0x13, 0x12, 0x11, 0x5c, 0x5c, 0x5b, 0x5a, 0x58, 0x58, 0x5b, 0x5c,
-  0x5c, 0x5c, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x5e, 0x5f, 0x60, 0x61,
-  0x60, 0x62, 0x64, 0x65, 0x65, 0x65, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69,
-  0x6a, 0x6a, 0x69, 0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x69, 0x68, 0x68, 0x68,
-  0x67, 0x64, 0x64, 0x62, 0x61, 0x61, 0x5f, 0x5d, 0x5b, 0x59, 0x57, 0x57,
-  0x58, 0x5a, 0x5d, 0x63, 0x68, 0x6e, 0x71, 0x73, 0x76, 0x7c, 0x80, 0x84,
-  0x86, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x85, 0x83, 0x82, 0x82, 0x83,
-  0x83, 0x85, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x86, 0x85, 0x82, 0x81,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8d, 0x8e, 0x8f,
-  0x8e, 0x8d, 0x89, 0x86, 0x83, 0x81, 0x7e, 0x7c, 0x7a, 0x79, 0x79, 0x7a,
-  0x7a, 0x79, 0x7b, 0x7d, 0x7e, 0x7f, 0x82, 0x84, 0x84, 0x83, 0x80, 0x7c,
-  0x78, 0x77, 0x78, 0x7b, 0x84, 0x90, 0x97, 0x99, 0x95, 0x88, 0x77, 0x6a,
-  0x65, 0x64, 0x60, 0x60, 0x63, 0x66, 0x69, 0x6c, 0x79, 0x8d, 0x8f, 0x85,
-  0x99, 0xa6, 0xa5, 0xa7, 0xaa, 0x9c, 0x8d, 0x83, 0x79, 0x63, 0x4a, 0x43,
-  0x4a, 0x4e, 0x51, 0x5c, 0x71, 0x72, 0x74, 0x7b, 0x7f, 0x66, 0x59, 0x59,
-  0x63, 0x62, 0x52, 0x4e, 0x4f, 0x50, 0x50, 0x51, 0x4d, 0x4b, 0x48, 0x33,
-  0x22, 0x2a, 0x34, 0x40, 0x4f, 0x86, 0x95, 0x96, 0x96, 0x95, 0x96, 0x97,
-  0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x97, 0x97, 0x96, 0x96,
-  0x94, 0x92, 0x8e, 0x8b, 0x88, 0x83, 0x7a, 0x73, 0x6d, 0x69, 0x62, 0x5a,
-  0x53, 0x4f, 0x4e, 0x4f, 0x4e, 0x4e, 0x4e, 0x4e, 0x4f, 0x4e, 0x4d, 0x4d,
-  0x4d, 0x4e, 0x4d, 0x4d, 0x4d, 0x4e, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x52,
-  0x53, 0x55, 0x54, 0x55, 0x56, 0x58, 0x59, 0x5b, 0x5b, 0x5b, 0x5d, 0x5e,
-  0x61, 0x62, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6a, 0x6c, 0x6f, 0x71, 0x70,
-  0x71, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x74, 0x72, 0x71, 0x70,
-  0x6e, 0x69, 0x66, 0x64, 0x61, 0x5e, 0x5b, 0x58, 0x55, 0x50, 0x4a, 0x43,
-  0x3d, 0x38, 0x2f, 0x25, 0x18, 0x12, 0x11, 0x10, 0x11, 0x10, 0x10, 0x10,
-  0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11,
-  0x5e, 0x5d, 0x5d, 0x5d, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5d, 0x5d, 0x5e,
-  0x5e, 0x5f, 0x60, 0x61, 0x60, 0x61, 0x61, 0x61, 0x61, 0x64, 0x65, 0x65,
-  0x64, 0x64, 0x66, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x69, 0x69,
-  0x6a, 0x6b, 0x6b, 0x6b, 0x69, 0x68, 0x67, 0x66, 0x66, 0x64, 0x64, 0x63,
-  0x62, 0x61, 0x5f, 0x5d, 0x5b, 0x5a, 0x58, 0x56, 0x55, 0x56, 0x58, 0x5c,
-  0x62, 0x69, 0x6c, 0x6e, 0x72, 0x78, 0x7d, 0x82, 0x83, 0x84, 0x85, 0x88,
-  0x88, 0x87, 0x87, 0x86, 0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x86,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x82, 0x81, 0x82, 0x81, 0x82, 0x83,
-  0x86, 0x88, 0x89, 0x8a, 0x8c, 0x8f, 0x91, 0x90, 0x8f, 0x8c, 0x89, 0x84,
-  0x83, 0x81, 0x7e, 0x7c, 0x7c, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7b, 0x7b,
-  0x7c, 0x7e, 0x81, 0x83, 0x83, 0x81, 0x7c, 0x75, 0x70, 0x6b, 0x6a, 0x6e,
-  0x7a, 0x89, 0x91, 0x92, 0x8f, 0x81, 0x72, 0x68, 0x65, 0x64, 0x63, 0x63,
-  0x67, 0x6b, 0x6e, 0x73, 0x83, 0x85, 0x81, 0x7f, 0x91, 0x90, 0x8f, 0x92,
-  0x96, 0x89, 0x8c, 0x8c, 0x85, 0x70, 0x51, 0x4b, 0x5b, 0x63, 0x63, 0x63,
-  0x74, 0x72, 0x71, 0x76, 0x80, 0x71, 0x5d, 0x58, 0x5e, 0x5f, 0x51, 0x49,
-  0x49, 0x4d, 0x52, 0x50, 0x4b, 0x46, 0x3c, 0x22, 0x1f, 0x2f, 0x3a, 0x45,
-  0x5e, 0x8d, 0x96, 0x96, 0x96, 0x97, 0x96, 0x98, 0x99, 0x99, 0x98, 0x9a,
-  0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x96, 0x94, 0x93, 0x8f, 0x8a, 0x87,
-  0x84, 0x7e, 0x75, 0x6c, 0x67, 0x64, 0x5e, 0x56, 0x50, 0x4d, 0x4d, 0x4d,
-  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4c, 0x4d, 0x4d, 0x4c,
-  0x4e, 0x4e, 0x4e, 0x50, 0x50, 0x4f, 0x50, 0x51, 0x52, 0x54, 0x54, 0x55,
-  0x57, 0x59, 0x59, 0x5b, 0x5b, 0x5c, 0x5c, 0x60, 0x61, 0x61, 0x61, 0x63,
-  0x65, 0x67, 0x69, 0x6a, 0x6c, 0x6f, 0x71, 0x73, 0x73, 0x74, 0x74, 0x77,
-  0x77, 0x76, 0x75, 0x74, 0x74, 0x74, 0x73, 0x72, 0x6d, 0x69, 0x66, 0x65,
-  0x63, 0x60, 0x5b, 0x56, 0x54, 0x50, 0x4b, 0x43, 0x3d, 0x38, 0x31, 0x26,
-  0x19, 0x14, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x11, 0x11, 0x11, 0x10, 0x10, 0x12, 0x60, 0x5f, 0x5e, 0x5e,
-  0x5c, 0x5c, 0x5d, 0x5e, 0x5e, 0x5d, 0x5d, 0x5e, 0x5f, 0x5f, 0x5f, 0x60,
-  0x60, 0x61, 0x61, 0x61, 0x62, 0x64, 0x66, 0x66, 0x65, 0x65, 0x66, 0x66,
-  0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a,
-  0x6a, 0x69, 0x67, 0x66, 0x66, 0x64, 0x64, 0x64, 0x62, 0x60, 0x5e, 0x5c,
-  0x5b, 0x5a, 0x58, 0x56, 0x55, 0x53, 0x54, 0x56, 0x5b, 0x62, 0x67, 0x6a,
-  0x6e, 0x73, 0x7a, 0x7f, 0x82, 0x83, 0x84, 0x86, 0x86, 0x88, 0x88, 0x87,
-  0x85, 0x83, 0x81, 0x81, 0x82, 0x83, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83,
-  0x84, 0x83, 0x82, 0x81, 0x82, 0x82, 0x83, 0x84, 0x87, 0x89, 0x8a, 0x8b,
-  0x8c, 0x8f, 0x91, 0x90, 0x90, 0x8d, 0x89, 0x85, 0x83, 0x81, 0x7e, 0x7c,
-  0x7c, 0x7a, 0x79, 0x79, 0x79, 0x78, 0x7a, 0x7a, 0x7c, 0x7d, 0x80, 0x81,
-  0x81, 0x7e, 0x78, 0x72, 0x6b, 0x67, 0x66, 0x66, 0x71, 0x82, 0x88, 0x89,
-  0x84, 0x77, 0x6b, 0x67, 0x65, 0x65, 0x65, 0x66, 0x6c, 0x6e, 0x71, 0x7b,
-  0x89, 0x78, 0x70, 0x76, 0x8f, 0x96, 0xad, 0xac, 0x8f, 0x7f, 0x7b, 0x7d,
-  0x80, 0x7c, 0x5f, 0x53, 0x5e, 0x6d, 0x7d, 0x73, 0x81, 0x75, 0x7a, 0x92,
-  0x7d, 0x6d, 0x61, 0x5a, 0x58, 0x5f, 0x51, 0x45, 0x44, 0x4c, 0x51, 0x4f,
-  0x4a, 0x43, 0x33, 0x1c, 0x1f, 0x32, 0x3d, 0x4b, 0x75, 0x93, 0x95, 0x94,
-  0x95, 0x97, 0x98, 0x97, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x99, 0x98, 0x99,
-  0x98, 0x96, 0x94, 0x93, 0x91, 0x8c, 0x86, 0x82, 0x7f, 0x79, 0x71, 0x68,
-  0x62, 0x5f, 0x58, 0x51, 0x4d, 0x4c, 0x4c, 0x4c, 0x4d, 0x4c, 0x4b, 0x4a,
-  0x4a, 0x4b, 0x4a, 0x4a, 0x4a, 0x4a, 0x4b, 0x4b, 0x4c, 0x4d, 0x4e, 0x50,
-  0x50, 0x50, 0x50, 0x51, 0x52, 0x54, 0x54, 0x55, 0x57, 0x58, 0x59, 0x5b,
-  0x5b, 0x5c, 0x5e, 0x60, 0x60, 0x60, 0x61, 0x62, 0x65, 0x67, 0x69, 0x6a,
-  0x6b, 0x6e, 0x71, 0x73, 0x73, 0x73, 0x75, 0x77, 0x77, 0x77, 0x77, 0x76,
-  0x74, 0x74, 0x74, 0x72, 0x6d, 0x6a, 0x68, 0x67, 0x64, 0x60, 0x5b, 0x56,
-  0x54, 0x50, 0x4a, 0x43, 0x3d, 0x39, 0x33, 0x27, 0x19, 0x14, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12,
-  0x11, 0x10, 0x10, 0x12, 0x60, 0x5e, 0x5e, 0x5d, 0x5b, 0x5c, 0x5e, 0x5f,
-  0x5e, 0x5d, 0x5c, 0x5e, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x62, 0x62, 0x62,
-  0x63, 0x64, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x67, 0x68, 0x69, 0x6a,
-  0x6a, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x69, 0x68,
-  0x67, 0x64, 0x64, 0x63, 0x62, 0x60, 0x5e, 0x5b, 0x5a, 0x59, 0x58, 0x56,
-  0x54, 0x53, 0x52, 0x52, 0x57, 0x5d, 0x63, 0x67, 0x6b, 0x71, 0x77, 0x7d,
-  0x81, 0x83, 0x84, 0x85, 0x87, 0x89, 0x89, 0x87, 0x84, 0x81, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x82,
-  0x82, 0x83, 0x84, 0x85, 0x87, 0x8a, 0x8b, 0x8c, 0x8d, 0x8f, 0x90, 0x8f,
-  0x8e, 0x8c, 0x89, 0x85, 0x83, 0x81, 0x7f, 0x7c, 0x7b, 0x7a, 0x79, 0x79,
-  0x79, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x81, 0x80, 0x7c, 0x76, 0x6f,
-  0x68, 0x65, 0x63, 0x63, 0x6a, 0x79, 0x7f, 0x7f, 0x7a, 0x6e, 0x67, 0x66,
-  0x66, 0x65, 0x65, 0x68, 0x6d, 0x70, 0x73, 0x7e, 0x85, 0x6c, 0x60, 0x5f,
-  0x64, 0x81, 0xa8, 0xac, 0x8e, 0x76, 0x7a, 0x7f, 0x80, 0x78, 0x62, 0x58,
-  0x62, 0x6f, 0x7f, 0x76, 0x85, 0x94, 0x9e, 0xa3, 0x8d, 0x75, 0x6b, 0x64,
-  0x5c, 0x63, 0x5a, 0x53, 0x53, 0x58, 0x50, 0x4d, 0x4e, 0x48, 0x34, 0x1c,
-  0x1f, 0x34, 0x41, 0x58, 0x87, 0x95, 0x94, 0x94, 0x94, 0x97, 0x99, 0x98,
-  0x99, 0x9a, 0x99, 0x9a, 0x9a, 0x99, 0x99, 0x98, 0x97, 0x94, 0x93, 0x92,
-  0x8e, 0x89, 0x84, 0x7e, 0x7a, 0x75, 0x6e, 0x65, 0x5f, 0x5b, 0x55, 0x4e,
-  0x4b, 0x4b, 0x4b, 0x4b, 0x4c, 0x4b, 0x4a, 0x4a, 0x4b, 0x4b, 0x4a, 0x4b,
-  0x4a, 0x4a, 0x4b, 0x4b, 0x4c, 0x4c, 0x4c, 0x4e, 0x50, 0x4f, 0x50, 0x51,
-  0x52, 0x54, 0x55, 0x55, 0x55, 0x57, 0x59, 0x5a, 0x5b, 0x5c, 0x5e, 0x5e,
-  0x5f, 0x61, 0x62, 0x64, 0x66, 0x68, 0x6a, 0x6b, 0x6c, 0x6d, 0x70, 0x72,
-  0x72, 0x72, 0x74, 0x76, 0x75, 0x76, 0x77, 0x77, 0x75, 0x75, 0x74, 0x72,
-  0x6e, 0x6b, 0x69, 0x68, 0x63, 0x5f, 0x5a, 0x56, 0x53, 0x50, 0x48, 0x43,
-  0x3f, 0x3b, 0x33, 0x25, 0x1a, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12, 0x11, 0x11, 0x11,
-  0x61, 0x5e, 0x5e, 0x5e, 0x5c, 0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5e,
-  0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x62, 0x62, 0x62, 0x63, 0x64, 0x65, 0x66,
-  0x67, 0x67, 0x67, 0x67, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b,
-  0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x67, 0x65, 0x64, 0x63,
-  0x62, 0x60, 0x5e, 0x5c, 0x5a, 0x59, 0x58, 0x56, 0x54, 0x52, 0x51, 0x50,
-  0x54, 0x5a, 0x61, 0x65, 0x69, 0x6f, 0x75, 0x7c, 0x80, 0x82, 0x84, 0x84,
-  0x87, 0x89, 0x89, 0x88, 0x84, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x81, 0x82, 0x83, 0x84, 0x86,
-  0x88, 0x8a, 0x8c, 0x8c, 0x8d, 0x90, 0x90, 0x8f, 0x8e, 0x8b, 0x89, 0x85,
-  0x83, 0x82, 0x80, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x79, 0x79, 0x79, 0x7a,
-  0x7c, 0x7e, 0x80, 0x80, 0x7f, 0x7b, 0x75, 0x6d, 0x67, 0x65, 0x63, 0x62,
-  0x67, 0x73, 0x77, 0x77, 0x72, 0x69, 0x67, 0x6b, 0x6c, 0x6a, 0x65, 0x67,
-  0x6c, 0x6f, 0x72, 0x7b, 0x7a, 0x64, 0x57, 0x4d, 0x47, 0x69, 0x8c, 0x90,
-  0x79, 0x6e, 0x76, 0x79, 0x78, 0x6f, 0x60, 0x5a, 0x61, 0x6c, 0x79, 0x74,
-  0x89, 0xaa, 0xb4, 0xa9, 0x8e, 0x77, 0x71, 0x6b, 0x60, 0x61, 0x5e, 0x5f,
-  0x61, 0x60, 0x52, 0x4b, 0x4c, 0x47, 0x33, 0x1d, 0x1f, 0x30, 0x41, 0x62,
-  0x8e, 0x95, 0x93, 0x94, 0x95, 0x98, 0x99, 0x98, 0x99, 0x9a, 0x99, 0x9a,
-  0x9a, 0x99, 0x99, 0x98, 0x96, 0x94, 0x92, 0x90, 0x8d, 0x87, 0x81, 0x7c,
-  0x78, 0x73, 0x6c, 0x62, 0x5d, 0x59, 0x52, 0x4d, 0x4a, 0x4a, 0x4a, 0x4a,
-  0x4b, 0x4a, 0x49, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x4b,
-  0x4c, 0x4c, 0x4c, 0x4d, 0x4f, 0x4f, 0x50, 0x52, 0x52, 0x53, 0x54, 0x54,
-  0x54, 0x56, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5d, 0x5f, 0x61, 0x62, 0x64,
-  0x66, 0x67, 0x69, 0x6a, 0x6c, 0x6d, 0x70, 0x72, 0x72, 0x72, 0x74, 0x75,
-  0x74, 0x75, 0x77, 0x77, 0x76, 0x74, 0x73, 0x72, 0x6f, 0x6b, 0x69, 0x67,
-  0x63, 0x5f, 0x5b, 0x56, 0x54, 0x50, 0x48, 0x42, 0x3f, 0x3c, 0x32, 0x24,
-  0x1a, 0x14, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x11,
-  0x11, 0x11, 0x12, 0x13, 0x12, 0x12, 0x11, 0x11, 0x62, 0x5f, 0x5f, 0x5f,
-  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5d, 0x5e, 0x60,
-  0x61, 0x62, 0x62, 0x62, 0x64, 0x64, 0x65, 0x66, 0x67, 0x67, 0x67, 0x68,
-  0x68, 0x67, 0x68, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a, 0x6b, 0x6c,
-  0x6b, 0x6b, 0x6a, 0x69, 0x67, 0x66, 0x63, 0x62, 0x61, 0x5f, 0x5e, 0x5c,
-  0x5a, 0x59, 0x58, 0x56, 0x54, 0x53, 0x52, 0x50, 0x52, 0x57, 0x5d, 0x61,
-  0x66, 0x6e, 0x74, 0x7b, 0x7f, 0x81, 0x83, 0x85, 0x87, 0x89, 0x89, 0x89,
-  0x86, 0x82, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x82,
-  0x84, 0x83, 0x82, 0x81, 0x81, 0x83, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8d,
-  0x8e, 0x90, 0x90, 0x8e, 0x8d, 0x8a, 0x87, 0x84, 0x83, 0x82, 0x80, 0x7d,
-  0x7b, 0x79, 0x79, 0x78, 0x79, 0x79, 0x78, 0x79, 0x7b, 0x7e, 0x7f, 0x7e,
-  0x7c, 0x79, 0x74, 0x6d, 0x68, 0x64, 0x62, 0x62, 0x65, 0x6b, 0x6d, 0x6b,
-  0x67, 0x63, 0x6e, 0x7e, 0x84, 0x7e, 0x6b, 0x64, 0x69, 0x6d, 0x6f, 0x6f,
-  0x64, 0x5b, 0x50, 0x3b, 0x2e, 0x42, 0x4e, 0x4b, 0x42, 0x5c, 0x63, 0x5e,
-  0x5b, 0x59, 0x5b, 0x58, 0x5d, 0x65, 0x6c, 0x6c, 0x92, 0xbd, 0xc5, 0xad,
-  0x84, 0x74, 0x75, 0x70, 0x60, 0x55, 0x59, 0x67, 0x6a, 0x64, 0x5c, 0x4b,
-  0x43, 0x3b, 0x2b, 0x1f, 0x22, 0x27, 0x3b, 0x6c, 0x93, 0x95, 0x95, 0x96,
-  0x97, 0x97, 0x99, 0x99, 0x9a, 0x9b, 0x99, 0x99, 0x9a, 0x9a, 0x99, 0x96,
-  0x94, 0x92, 0x91, 0x8f, 0x8b, 0x84, 0x7e, 0x79, 0x75, 0x6e, 0x67, 0x5d,
-  0x56, 0x53, 0x4e, 0x4b, 0x4a, 0x49, 0x49, 0x49, 0x4a, 0x49, 0x48, 0x48,
-  0x48, 0x48, 0x48, 0x49, 0x49, 0x48, 0x48, 0x4b, 0x4c, 0x4c, 0x4b, 0x4c,
-  0x4f, 0x4f, 0x50, 0x53, 0x53, 0x52, 0x52, 0x53, 0x54, 0x55, 0x58, 0x59,
-  0x5a, 0x5b, 0x5c, 0x5c, 0x5e, 0x61, 0x62, 0x63, 0x65, 0x67, 0x68, 0x69,
-  0x6b, 0x6c, 0x6f, 0x71, 0x72, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75,
-  0x75, 0x74, 0x73, 0x73, 0x70, 0x6c, 0x69, 0x67, 0x63, 0x60, 0x5c, 0x58,
-  0x55, 0x50, 0x48, 0x43, 0x3f, 0x3a, 0x31, 0x23, 0x19, 0x14, 0x12, 0x11,
-  0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x13, 0x12, 0x11, 0x11, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
-  0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5d, 0x5d, 0x5f, 0x60, 0x62, 0x62, 0x62,
-  0x63, 0x64, 0x65, 0x66, 0x67, 0x67, 0x67, 0x68, 0x67, 0x67, 0x69, 0x6b,
-  0x6b, 0x6a, 0x69, 0x69, 0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6a, 0x69, 0x68,
-  0x67, 0x66, 0x64, 0x62, 0x62, 0x60, 0x5e, 0x5c, 0x5a, 0x58, 0x57, 0x55,
-  0x54, 0x53, 0x51, 0x4f, 0x4f, 0x53, 0x58, 0x5c, 0x64, 0x6b, 0x73, 0x7a,
-  0x7e, 0x80, 0x83, 0x85, 0x88, 0x89, 0x89, 0x89, 0x86, 0x83, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x82, 0x83, 0x84, 0x82, 0x82,
-  0x83, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8d, 0x8e, 0x8e, 0x90, 0x90, 0x8e,
-  0x8d, 0x8a, 0x87, 0x84, 0x82, 0x82, 0x81, 0x7e, 0x7c, 0x7a, 0x79, 0x78,
-  0x78, 0x79, 0x78, 0x78, 0x7a, 0x7d, 0x7e, 0x7b, 0x79, 0x77, 0x72, 0x6d,
-  0x66, 0x63, 0x61, 0x61, 0x61, 0x62, 0x61, 0x60, 0x5e, 0x66, 0x82, 0xa7,
-  0xb5, 0xb0, 0x8c, 0x6a, 0x67, 0x68, 0x66, 0x5f, 0x4f, 0x56, 0x58, 0x48,
-  0x22, 0x1a, 0x1b, 0x1a, 0x1d, 0x37, 0x41, 0x40, 0x3e, 0x40, 0x55, 0x55,
-  0x6b, 0x74, 0x6b, 0x62, 0x94, 0xbf, 0xc8, 0xb5, 0x96, 0x70, 0x6a, 0x64,
-  0x52, 0x49, 0x4a, 0x57, 0x5e, 0x67, 0x6e, 0x52, 0x3e, 0x32, 0x23, 0x1e,
-  0x24, 0x28, 0x39, 0x66, 0x92, 0x96, 0x95, 0x96, 0x98, 0x99, 0x9b, 0x9a,
-  0x99, 0x99, 0x99, 0x9a, 0x9a, 0x99, 0x97, 0x95, 0x94, 0x90, 0x8e, 0x8b,
-  0x87, 0x7f, 0x79, 0x74, 0x6f, 0x69, 0x61, 0x57, 0x51, 0x4d, 0x49, 0x48,
-  0x48, 0x48, 0x48, 0x48, 0x49, 0x48, 0x46, 0x47, 0x46, 0x47, 0x47, 0x48,
-  0x49, 0x47, 0x48, 0x4b, 0x4c, 0x4d, 0x4c, 0x4c, 0x4f, 0x50, 0x51, 0x53,
-  0x53, 0x52, 0x53, 0x53, 0x55, 0x56, 0x58, 0x58, 0x59, 0x59, 0x5b, 0x5c,
-  0x5e, 0x5f, 0x60, 0x61, 0x63, 0x65, 0x68, 0x6a, 0x6c, 0x6d, 0x6f, 0x71,
-  0x73, 0x74, 0x74, 0x75, 0x74, 0x74, 0x76, 0x76, 0x76, 0x75, 0x74, 0x73,
-  0x70, 0x6b, 0x69, 0x67, 0x65, 0x60, 0x5b, 0x58, 0x55, 0x51, 0x49, 0x43,
-  0x3e, 0x3a, 0x33, 0x26, 0x1a, 0x14, 0x12, 0x11, 0x11, 0x10, 0x10, 0x11,
-  0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x13, 0x14, 0x13, 0x11, 0x11, 0x11,
-  0x61, 0x61, 0x61, 0x62, 0x61, 0x60, 0x61, 0x61, 0x60, 0x5e, 0x5e, 0x5e,
-  0x5e, 0x5e, 0x5d, 0x5e, 0x60, 0x61, 0x62, 0x63, 0x63, 0x63, 0x65, 0x66,
-  0x68, 0x67, 0x67, 0x66, 0x67, 0x68, 0x6a, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a,
-  0x6c, 0x6c, 0x6c, 0x6a, 0x69, 0x6a, 0x6a, 0x69, 0x68, 0x67, 0x65, 0x64,
-  0x63, 0x61, 0x5e, 0x5c, 0x5a, 0x59, 0x57, 0x56, 0x55, 0x52, 0x51, 0x4e,
-  0x4e, 0x51, 0x56, 0x5a, 0x60, 0x67, 0x70, 0x77, 0x7d, 0x80, 0x83, 0x84,
-  0x87, 0x89, 0x89, 0x89, 0x87, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7f,
-  0x7f, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x86, 0x87, 0x88,
-  0x89, 0x8c, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8b, 0x88, 0x85,
-  0x82, 0x82, 0x81, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x79, 0x78, 0x79,
-  0x7a, 0x7c, 0x7e, 0x7b, 0x78, 0x75, 0x71, 0x6c, 0x64, 0x5f, 0x5e, 0x5e,
-  0x5e, 0x5d, 0x5b, 0x5b, 0x60, 0x6c, 0x89, 0xb2, 0xc5, 0xc6, 0xa9, 0x78,
-  0x66, 0x5f, 0x58, 0x53, 0x4d, 0x57, 0x63, 0x68, 0x37, 0x19, 0x15, 0x19,
-  0x24, 0x2d, 0x31, 0x33, 0x34, 0x3a, 0x45, 0x4a, 0x76, 0x89, 0x7f, 0x61,
-  0x7d, 0x9a, 0xa8, 0xb4, 0xa7, 0x69, 0x54, 0x50, 0x51, 0x4c, 0x4a, 0x53,
-  0x60, 0x77, 0x82, 0x5f, 0x40, 0x30, 0x21, 0x1f, 0x28, 0x30, 0x3d, 0x5d,
-  0x90, 0x98, 0x96, 0x97, 0x98, 0x9a, 0x9b, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a,
-  0x99, 0x96, 0x95, 0x95, 0x92, 0x8d, 0x8a, 0x87, 0x82, 0x7a, 0x73, 0x6d,
-  0x69, 0x63, 0x5c, 0x52, 0x4c, 0x48, 0x45, 0x47, 0x47, 0x47, 0x47, 0x47,
-  0x47, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x48, 0x49, 0x49, 0x4b,
-  0x4c, 0x4d, 0x4e, 0x4e, 0x50, 0x50, 0x51, 0x52, 0x53, 0x53, 0x54, 0x55,
-  0x56, 0x56, 0x57, 0x59, 0x59, 0x59, 0x59, 0x5c, 0x5c, 0x5d, 0x5e, 0x61,
-  0x63, 0x64, 0x67, 0x69, 0x6b, 0x6b, 0x6d, 0x70, 0x71, 0x72, 0x74, 0x75,
-  0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x75, 0x72, 0x70, 0x6b, 0x68, 0x67,
-  0x64, 0x5f, 0x5b, 0x56, 0x54, 0x50, 0x4a, 0x43, 0x40, 0x3d, 0x35, 0x27,
-  0x1a, 0x13, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x12, 0x13,
-  0x13, 0x12, 0x13, 0x13, 0x12, 0x12, 0x11, 0x11, 0x61, 0x62, 0x62, 0x62,
-  0x62, 0x61, 0x62, 0x61, 0x60, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-  0x60, 0x62, 0x62, 0x63, 0x63, 0x63, 0x65, 0x66, 0x67, 0x67, 0x67, 0x66,
-  0x67, 0x69, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x69,
-  0x69, 0x6a, 0x6a, 0x69, 0x69, 0x67, 0x64, 0x64, 0x63, 0x61, 0x5f, 0x5c,
-  0x59, 0x59, 0x57, 0x56, 0x54, 0x52, 0x50, 0x4e, 0x4d, 0x4f, 0x55, 0x59,
-  0x5e, 0x65, 0x6d, 0x75, 0x7b, 0x7f, 0x82, 0x85, 0x88, 0x8a, 0x8b, 0x8a,
-  0x88, 0x85, 0x84, 0x83, 0x81, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x82, 0x84, 0x86, 0x87, 0x88, 0x8a, 0x8d, 0x8f, 0x90,
-  0x91, 0x91, 0x8f, 0x8f, 0x8d, 0x8b, 0x88, 0x84, 0x83, 0x82, 0x80, 0x7e,
-  0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79, 0x7b, 0x7c, 0x7b,
-  0x79, 0x76, 0x71, 0x6a, 0x61, 0x5d, 0x5c, 0x5c, 0x5d, 0x5c, 0x5a, 0x5b,
-  0x63, 0x6e, 0x81, 0xa3, 0xb4, 0xbc, 0xab, 0x7e, 0x65, 0x5a, 0x4e, 0x4c,
-  0x4f, 0x55, 0x63, 0x79, 0x5d, 0x2d, 0x24, 0x30, 0x4a, 0x48, 0x3b, 0x35,
-  0x31, 0x2f, 0x34, 0x3a, 0x5c, 0x6f, 0x73, 0x5e, 0x59, 0x62, 0x7a, 0xac,
-  0xb6, 0x6d, 0x51, 0x4e, 0x55, 0x5b, 0x63, 0x79, 0x88, 0x93, 0x79, 0x52,
-  0x3c, 0x2f, 0x21, 0x21, 0x2a, 0x36, 0x40, 0x58, 0x8f, 0x99, 0x97, 0x98,
-  0x99, 0x9a, 0x9b, 0x9a, 0x9a, 0x9a, 0x9b, 0x9a, 0x98, 0x96, 0x94, 0x93,
-  0x90, 0x8a, 0x85, 0x82, 0x7d, 0x76, 0x6f, 0x69, 0x65, 0x60, 0x58, 0x4e,
-  0x48, 0x46, 0x45, 0x45, 0x45, 0x45, 0x45, 0x44, 0x45, 0x45, 0x45, 0x45,
-  0x45, 0x44, 0x45, 0x46, 0x47, 0x49, 0x49, 0x49, 0x4a, 0x4b, 0x4d, 0x4e,
-  0x50, 0x50, 0x51, 0x53, 0x53, 0x53, 0x54, 0x55, 0x55, 0x57, 0x58, 0x5a,
-  0x5a, 0x5a, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5f, 0x62, 0x63, 0x66, 0x67,
-  0x69, 0x6c, 0x6d, 0x70, 0x72, 0x73, 0x74, 0x75, 0x74, 0x74, 0x76, 0x76,
-  0x76, 0x76, 0x75, 0x72, 0x70, 0x6c, 0x68, 0x67, 0x64, 0x5f, 0x5a, 0x56,
-  0x53, 0x50, 0x49, 0x43, 0x3f, 0x3c, 0x34, 0x27, 0x1a, 0x12, 0x11, 0x11,
-  0x10, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x12, 0x12, 0x12, 0x13, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x61, 0x62, 0x63, 0x63, 0x63, 0x62, 0x61, 0x60,
-  0x60, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x61, 0x62, 0x64,
-  0x63, 0x63, 0x65, 0x66, 0x67, 0x67, 0x67, 0x67, 0x68, 0x69, 0x6b, 0x6b,
-  0x6b, 0x6b, 0x6a, 0x6a, 0x6c, 0x6c, 0x6c, 0x69, 0x69, 0x6a, 0x69, 0x69,
-  0x68, 0x67, 0x64, 0x63, 0x63, 0x61, 0x5f, 0x5c, 0x5a, 0x59, 0x58, 0x56,
-  0x54, 0x52, 0x51, 0x4e, 0x4c, 0x4f, 0x54, 0x58, 0x5d, 0x64, 0x6c, 0x74,
-  0x7a, 0x7d, 0x81, 0x86, 0x89, 0x8b, 0x8b, 0x8a, 0x88, 0x86, 0x84, 0x83,
-  0x81, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x82,
-  0x83, 0x85, 0x86, 0x88, 0x8a, 0x8c, 0x8f, 0x90, 0x91, 0x90, 0x8f, 0x8e,
-  0x8d, 0x8b, 0x89, 0x85, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a,
-  0x78, 0x79, 0x78, 0x77, 0x78, 0x7a, 0x7c, 0x7b, 0x79, 0x76, 0x70, 0x68,
-  0x5f, 0x5c, 0x5b, 0x5c, 0x5d, 0x5c, 0x5a, 0x5c, 0x64, 0x6f, 0x79, 0x92,
-  0xa1, 0xab, 0xa3, 0x7f, 0x64, 0x57, 0x4c, 0x4b, 0x50, 0x53, 0x60, 0x7b,
-  0x71, 0x4d, 0x41, 0x49, 0x5f, 0x59, 0x46, 0x3a, 0x34, 0x2d, 0x30, 0x34,
-  0x49, 0x57, 0x61, 0x5a, 0x54, 0x57, 0x6d, 0xa3, 0xb4, 0x73, 0x5b, 0x5c,
-  0x67, 0x72, 0x7d, 0x90, 0x98, 0x92, 0x67, 0x47, 0x37, 0x2d, 0x22, 0x23,
-  0x2b, 0x3a, 0x42, 0x57, 0x8e, 0x9a, 0x98, 0x99, 0x9a, 0x9b, 0x9b, 0x9a,
-  0x9a, 0x9a, 0x9b, 0x9a, 0x98, 0x96, 0x94, 0x92, 0x8e, 0x87, 0x82, 0x7f,
-  0x7b, 0x73, 0x6d, 0x66, 0x62, 0x5d, 0x54, 0x4b, 0x47, 0x45, 0x45, 0x45,
-  0x44, 0x45, 0x45, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46,
-  0x46, 0x49, 0x49, 0x49, 0x4a, 0x4b, 0x4d, 0x4e, 0x50, 0x50, 0x51, 0x52,
-  0x53, 0x53, 0x54, 0x55, 0x55, 0x57, 0x59, 0x5a, 0x5a, 0x59, 0x58, 0x59,
-  0x5a, 0x5b, 0x5c, 0x5e, 0x61, 0x63, 0x65, 0x67, 0x68, 0x6c, 0x6d, 0x70,
-  0x72, 0x73, 0x74, 0x74, 0x74, 0x74, 0x76, 0x76, 0x77, 0x76, 0x75, 0x72,
-  0x70, 0x6d, 0x69, 0x67, 0x64, 0x5f, 0x5b, 0x57, 0x54, 0x50, 0x49, 0x44,
-  0x3f, 0x3b, 0x34, 0x27, 0x19, 0x13, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 0x11,
-  0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x60, 0x60, 0x5f, 0x5e, 0x5f, 0x5f,
-  0x5f, 0x5e, 0x5e, 0x5e, 0x60, 0x61, 0x62, 0x63, 0x64, 0x64, 0x65, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x68, 0x68, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6b, 0x69, 0x68, 0x69, 0x69, 0x68, 0x68, 0x67, 0x65, 0x63,
-  0x63, 0x61, 0x5f, 0x5d, 0x5b, 0x5a, 0x57, 0x55, 0x54, 0x53, 0x51, 0x4d,
-  0x4c, 0x4f, 0x53, 0x57, 0x5c, 0x63, 0x6a, 0x73, 0x78, 0x7c, 0x81, 0x86,
-  0x89, 0x8b, 0x8b, 0x8b, 0x89, 0x86, 0x85, 0x83, 0x81, 0x7e, 0x7c, 0x7b,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x85, 0x87,
-  0x8a, 0x8d, 0x8f, 0x8f, 0x90, 0x90, 0x8e, 0x8e, 0x8d, 0x8c, 0x89, 0x86,
-  0x83, 0x81, 0x80, 0x7e, 0x7c, 0x7a, 0x7a, 0x7a, 0x78, 0x79, 0x78, 0x77,
-  0x77, 0x79, 0x7b, 0x7a, 0x79, 0x76, 0x6e, 0x65, 0x5c, 0x59, 0x59, 0x5b,
-  0x5c, 0x5b, 0x5a, 0x5d, 0x66, 0x70, 0x72, 0x7d, 0x85, 0x91, 0x96, 0x80,
-  0x66, 0x58, 0x4f, 0x51, 0x53, 0x53, 0x5c, 0x72, 0x7d, 0x7f, 0x76, 0x70,
-  0x6c, 0x62, 0x51, 0x45, 0x3e, 0x36, 0x38, 0x35, 0x39, 0x3f, 0x49, 0x53,
-  0x64, 0x6f, 0x7b, 0x92, 0x99, 0x73, 0x6d, 0x76, 0x8b, 0x93, 0x94, 0x92,
-  0x89, 0x70, 0x48, 0x3c, 0x2f, 0x28, 0x25, 0x26, 0x2e, 0x3f, 0x48, 0x56,
-  0x8c, 0x9a, 0x9a, 0x9a, 0x9b, 0x9c, 0x9c, 0x9b, 0x9c, 0x9c, 0x9b, 0x9a,
-  0x97, 0x95, 0x93, 0x90, 0x8b, 0x84, 0x7f, 0x7c, 0x78, 0x71, 0x69, 0x61,
-  0x5d, 0x57, 0x4e, 0x46, 0x45, 0x44, 0x44, 0x44, 0x43, 0x44, 0x44, 0x43,
-  0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 0x47, 0x48, 0x48, 0x49,
-  0x4a, 0x4b, 0x4d, 0x4e, 0x50, 0x50, 0x51, 0x52, 0x52, 0x53, 0x55, 0x55,
-  0x55, 0x58, 0x59, 0x59, 0x58, 0x57, 0x57, 0x58, 0x59, 0x5b, 0x5b, 0x5d,
-  0x61, 0x63, 0x66, 0x67, 0x68, 0x6c, 0x6e, 0x70, 0x72, 0x73, 0x74, 0x73,
-  0x74, 0x74, 0x76, 0x77, 0x77, 0x76, 0x75, 0x72, 0x6f, 0x6d, 0x69, 0x68,
-  0x64, 0x60, 0x5c, 0x58, 0x55, 0x50, 0x49, 0x43, 0x3f, 0x3b, 0x34, 0x28,
-  0x1a, 0x13, 0x11, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x62, 0x62, 0x63, 0x63,
-  0x62, 0x61, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x5f,
-  0x60, 0x61, 0x62, 0x62, 0x64, 0x64, 0x64, 0x65, 0x66, 0x66, 0x66, 0x68,
-  0x68, 0x67, 0x69, 0x6b, 0x6a, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6a,
-  0x69, 0x6a, 0x69, 0x68, 0x68, 0x68, 0x67, 0x64, 0x63, 0x62, 0x60, 0x5d,
-  0x5b, 0x5a, 0x58, 0x56, 0x53, 0x53, 0x52, 0x4f, 0x4c, 0x4e, 0x54, 0x59,
-  0x5e, 0x64, 0x6a, 0x72, 0x78, 0x7b, 0x81, 0x86, 0x88, 0x8a, 0x8a, 0x8b,
-  0x89, 0x87, 0x85, 0x84, 0x82, 0x7e, 0x7b, 0x7a, 0x7b, 0x7c, 0x7c, 0x7e,
-  0x7f, 0x80, 0x80, 0x81, 0x83, 0x83, 0x84, 0x87, 0x8b, 0x8e, 0x90, 0x90,
-  0x91, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x88, 0x86, 0x84, 0x82, 0x81, 0x7f,
-  0x7d, 0x7c, 0x7a, 0x7a, 0x78, 0x79, 0x79, 0x79, 0x78, 0x79, 0x7c, 0x7b,
-  0x7a, 0x76, 0x6f, 0x64, 0x5b, 0x59, 0x5a, 0x5c, 0x5d, 0x5c, 0x5b, 0x5e,
-  0x67, 0x72, 0x73, 0x77, 0x7d, 0x88, 0x97, 0x90, 0x73, 0x63, 0x5c, 0x60,
-  0x5e, 0x5c, 0x5e, 0x67, 0x7b, 0x80, 0x86, 0x84, 0x76, 0x64, 0x50, 0x48,
-  0x47, 0x4a, 0x48, 0x40, 0x3c, 0x3d, 0x43, 0x45, 0x53, 0x6c, 0x76, 0x78,
-  0x78, 0x5e, 0x57, 0x62, 0x7a, 0x72, 0x66, 0x5b, 0x54, 0x49, 0x3a, 0x34,
-  0x23, 0x1e, 0x26, 0x2b, 0x32, 0x42, 0x49, 0x55, 0x85, 0x9a, 0x9b, 0x9b,
-  0x9b, 0x9c, 0x9c, 0x9d, 0x9c, 0x9b, 0x99, 0x98, 0x95, 0x92, 0x90, 0x8c,
-  0x87, 0x81, 0x7b, 0x77, 0x72, 0x6c, 0x63, 0x5c, 0x58, 0x50, 0x48, 0x44,
-  0x43, 0x43, 0x43, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x44,
-  0x45, 0x45, 0x46, 0x47, 0x49, 0x4a, 0x4a, 0x4a, 0x4b, 0x4c, 0x4e, 0x4f,
-  0x51, 0x52, 0x52, 0x52, 0x52, 0x56, 0x57, 0x57, 0x56, 0x57, 0x59, 0x57,
-  0x56, 0x56, 0x57, 0x59, 0x5a, 0x5b, 0x5d, 0x5e, 0x5f, 0x62, 0x65, 0x66,
-  0x67, 0x69, 0x6e, 0x70, 0x71, 0x71, 0x73, 0x73, 0x74, 0x74, 0x75, 0x76,
-  0x76, 0x76, 0x75, 0x74, 0x71, 0x6e, 0x6a, 0x67, 0x63, 0x60, 0x5c, 0x58,
-  0x56, 0x50, 0x4a, 0x43, 0x40, 0x3c, 0x35, 0x29, 0x1a, 0x13, 0x12, 0x12,
-  0x11, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11,
-  0x11, 0x11, 0x12, 0x11, 0x60, 0x61, 0x63, 0x63, 0x61, 0x61, 0x62, 0x61,
-  0x61, 0x61, 0x61, 0x5f, 0x60, 0x60, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x62,
-  0x63, 0x64, 0x65, 0x65, 0x64, 0x66, 0x67, 0x68, 0x68, 0x68, 0x69, 0x6a,
-  0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a,
-  0x69, 0x69, 0x67, 0x65, 0x63, 0x61, 0x5f, 0x5c, 0x5a, 0x59, 0x58, 0x55,
-  0x53, 0x53, 0x52, 0x50, 0x4e, 0x50, 0x56, 0x5a, 0x5f, 0x65, 0x6a, 0x72,
-  0x77, 0x7a, 0x80, 0x85, 0x88, 0x8a, 0x8b, 0x8c, 0x8a, 0x88, 0x86, 0x85,
-  0x82, 0x7e, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x81,
-  0x83, 0x83, 0x84, 0x87, 0x8a, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x8e, 0x8d,
-  0x8c, 0x8b, 0x88, 0x86, 0x85, 0x84, 0x83, 0x80, 0x7e, 0x7d, 0x7c, 0x7b,
-  0x78, 0x78, 0x79, 0x79, 0x78, 0x79, 0x7c, 0x7b, 0x7a, 0x76, 0x6e, 0x63,
-  0x5b, 0x5b, 0x5d, 0x60, 0x60, 0x5c, 0x5a, 0x5e, 0x69, 0x72, 0x75, 0x7c,
-  0x83, 0x91, 0xa1, 0xa2, 0x84, 0x72, 0x69, 0x6d, 0x6c, 0x6a, 0x67, 0x63,
-  0x75, 0x88, 0x8e, 0x8a, 0x7d, 0x6a, 0x41, 0x36, 0x40, 0x57, 0x53, 0x47,
-  0x44, 0x43, 0x43, 0x3d, 0x3c, 0x42, 0x46, 0x50, 0x68, 0x4c, 0x41, 0x43,
-  0x4a, 0x4a, 0x46, 0x46, 0x46, 0x42, 0x38, 0x2e, 0x1d, 0x1b, 0x28, 0x34,
-  0x3b, 0x43, 0x47, 0x51, 0x7d, 0x9b, 0x9d, 0x9c, 0x9d, 0x9e, 0x9e, 0x9d,
-  0x9c, 0x9b, 0x98, 0x96, 0x92, 0x8e, 0x8b, 0x89, 0x84, 0x7c, 0x76, 0x72,
-  0x6c, 0x64, 0x5b, 0x55, 0x51, 0x4a, 0x44, 0x43, 0x43, 0x43, 0x42, 0x41,
-  0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x45, 0x45, 0x45, 0x47,
-  0x49, 0x4a, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4f, 0x50, 0x51, 0x52, 0x53,
-  0x55, 0x56, 0x56, 0x57, 0x57, 0x56, 0x58, 0x58, 0x57, 0x57, 0x57, 0x59,
-  0x5a, 0x5b, 0x5c, 0x5c, 0x5f, 0x63, 0x66, 0x67, 0x67, 0x69, 0x6d, 0x70,
-  0x70, 0x71, 0x73, 0x73, 0x74, 0x74, 0x74, 0x76, 0x76, 0x76, 0x74, 0x73,
-  0x71, 0x6e, 0x6a, 0x67, 0x63, 0x60, 0x5c, 0x58, 0x56, 0x50, 0x49, 0x44,
-  0x40, 0x3d, 0x35, 0x29, 0x1a, 0x12, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12,
-  0x60, 0x60, 0x61, 0x62, 0x62, 0x63, 0x63, 0x62, 0x61, 0x60, 0x60, 0x5f,
-  0x5f, 0x5f, 0x60, 0x60, 0x60, 0x61, 0x62, 0x61, 0x62, 0x65, 0x65, 0x65,
-  0x65, 0x66, 0x67, 0x68, 0x68, 0x67, 0x69, 0x69, 0x69, 0x69, 0x6a, 0x6a,
-  0x6c, 0x6c, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x69, 0x69, 0x66, 0x65,
-  0x64, 0x62, 0x60, 0x5d, 0x5b, 0x59, 0x58, 0x56, 0x53, 0x53, 0x52, 0x50,
-  0x4e, 0x52, 0x58, 0x5c, 0x62, 0x67, 0x6b, 0x72, 0x77, 0x7a, 0x7f, 0x85,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8b, 0x87, 0x85, 0x84, 0x82, 0x7f, 0x7d, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x85, 0x86,
-  0x8a, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8a, 0x88, 0x86,
-  0x85, 0x84, 0x83, 0x80, 0x7e, 0x7d, 0x7c, 0x7b, 0x78, 0x78, 0x79, 0x79,
-  0x79, 0x79, 0x7b, 0x7b, 0x7a, 0x76, 0x6f, 0x64, 0x5c, 0x5f, 0x64, 0x6b,
-  0x65, 0x5c, 0x5a, 0x5f, 0x69, 0x72, 0x76, 0x80, 0x88, 0x93, 0xa2, 0xa6,
-  0x8e, 0x7d, 0x71, 0x77, 0x76, 0x74, 0x70, 0x64, 0x59, 0x66, 0x79, 0x80,
-  0x77, 0x4e, 0x3f, 0x44, 0x4f, 0x62, 0x5b, 0x4b, 0x47, 0x46, 0x41, 0x3b,
-  0x37, 0x39, 0x41, 0x51, 0x54, 0x3f, 0x3d, 0x3e, 0x40, 0x48, 0x4b, 0x46,
-  0x45, 0x45, 0x39, 0x27, 0x1a, 0x19, 0x29, 0x40, 0x48, 0x49, 0x49, 0x50,
-  0x78, 0x9b, 0x9e, 0x9d, 0x9e, 0x9e, 0x9e, 0x9d, 0x9c, 0x9a, 0x98, 0x94,
-  0x8f, 0x8b, 0x88, 0x86, 0x7f, 0x77, 0x72, 0x6e, 0x69, 0x60, 0x56, 0x50,
-  0x4c, 0x45, 0x42, 0x41, 0x42, 0x42, 0x43, 0x42, 0x41, 0x41, 0x42, 0x42,
-  0x43, 0x44, 0x42, 0x42, 0x43, 0x44, 0x46, 0x48, 0x48, 0x48, 0x49, 0x4a,
-  0x4b, 0x4b, 0x4d, 0x4e, 0x51, 0x52, 0x52, 0x53, 0x56, 0x57, 0x57, 0x58,
-  0x58, 0x57, 0x59, 0x59, 0x59, 0x58, 0x58, 0x5a, 0x5a, 0x5c, 0x5d, 0x5d,
-  0x5f, 0x63, 0x65, 0x67, 0x68, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x72, 0x73,
-  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x71, 0x70, 0x6c, 0x6a, 0x68,
-  0x63, 0x5f, 0x5b, 0x58, 0x55, 0x50, 0x49, 0x44, 0x40, 0x3d, 0x36, 0x29,
-  0x1b, 0x14, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x11,
-  0x12, 0x13, 0x13, 0x12, 0x13, 0x13, 0x12, 0x13, 0x60, 0x5f, 0x61, 0x62,
-  0x63, 0x64, 0x64, 0x62, 0x61, 0x60, 0x60, 0x5e, 0x5e, 0x5f, 0x60, 0x60,
-  0x60, 0x61, 0x62, 0x61, 0x62, 0x64, 0x64, 0x64, 0x64, 0x65, 0x66, 0x68,
-  0x68, 0x68, 0x68, 0x6a, 0x69, 0x69, 0x69, 0x6a, 0x6b, 0x6c, 0x6b, 0x6a,
-  0x69, 0x6a, 0x6a, 0x6a, 0x69, 0x68, 0x66, 0x65, 0x65, 0x63, 0x60, 0x5e,
-  0x5a, 0x59, 0x59, 0x56, 0x54, 0x53, 0x52, 0x50, 0x4f, 0x54, 0x59, 0x5d,
-  0x63, 0x68, 0x6b, 0x72, 0x76, 0x79, 0x7f, 0x84, 0x88, 0x8a, 0x8b, 0x8c,
-  0x8b, 0x87, 0x85, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x80, 0x82, 0x83, 0x84, 0x85, 0x8a, 0x8d, 0x8d, 0x8e,
-  0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8a, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81,
-  0x7f, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x78, 0x79, 0x78, 0x78, 0x7a, 0x7b,
-  0x7b, 0x76, 0x6e, 0x64, 0x5e, 0x67, 0x70, 0x78, 0x6c, 0x5d, 0x5b, 0x5f,
-  0x6a, 0x72, 0x77, 0x83, 0x89, 0x90, 0x9b, 0xa1, 0x90, 0x82, 0x77, 0x7d,
-  0x7a, 0x75, 0x71, 0x68, 0x59, 0x56, 0x60, 0x66, 0x62, 0x44, 0x4c, 0x5a,
-  0x62, 0x68, 0x5e, 0x4c, 0x49, 0x47, 0x42, 0x3b, 0x37, 0x38, 0x42, 0x56,
-  0x4a, 0x37, 0x3a, 0x3e, 0x41, 0x49, 0x4e, 0x47, 0x44, 0x43, 0x39, 0x24,
-  0x17, 0x19, 0x29, 0x46, 0x50, 0x50, 0x4e, 0x51, 0x76, 0x9c, 0x9f, 0x9e,
-  0x9e, 0x9e, 0x9e, 0x9d, 0x9b, 0x9a, 0x97, 0x93, 0x8d, 0x89, 0x87, 0x83,
-  0x7d, 0x74, 0x6f, 0x6b, 0x66, 0x5d, 0x53, 0x4d, 0x49, 0x43, 0x41, 0x40,
-  0x42, 0x42, 0x42, 0x41, 0x41, 0x41, 0x41, 0x42, 0x43, 0x44, 0x42, 0x42,
-  0x43, 0x44, 0x46, 0x48, 0x48, 0x48, 0x49, 0x4a, 0x4b, 0x4b, 0x4d, 0x4f,
-  0x52, 0x52, 0x52, 0x53, 0x56, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5a, 0x59,
-  0x58, 0x58, 0x58, 0x5a, 0x5b, 0x5c, 0x5d, 0x5d, 0x60, 0x63, 0x65, 0x66,
-  0x69, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x72, 0x72, 0x74, 0x75, 0x74, 0x74,
-  0x74, 0x74, 0x73, 0x71, 0x6f, 0x6c, 0x6a, 0x68, 0x63, 0x5f, 0x5b, 0x57,
-  0x55, 0x50, 0x49, 0x44, 0x40, 0x3d, 0x36, 0x29, 0x1c, 0x14, 0x12, 0x11,
-  0x11, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x13, 0x13, 0x13,
-  0x13, 0x13, 0x12, 0x13, 0x60, 0x60, 0x61, 0x61, 0x63, 0x64, 0x63, 0x61,
-  0x60, 0x60, 0x60, 0x5e, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x61,
-  0x62, 0x62, 0x62, 0x62, 0x63, 0x65, 0x66, 0x67, 0x67, 0x67, 0x68, 0x6a,
-  0x6a, 0x6a, 0x69, 0x6a, 0x6c, 0x6c, 0x6b, 0x6a, 0x69, 0x6a, 0x6a, 0x6a,
-  0x69, 0x69, 0x66, 0x65, 0x64, 0x62, 0x60, 0x5d, 0x5b, 0x59, 0x59, 0x57,
-  0x54, 0x53, 0x52, 0x50, 0x4f, 0x55, 0x5c, 0x5f, 0x63, 0x68, 0x6c, 0x71,
-  0x75, 0x78, 0x7e, 0x83, 0x87, 0x88, 0x89, 0x8b, 0x8a, 0x87, 0x84, 0x83,
-  0x82, 0x80, 0x7e, 0x7e, 0x7d, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7e, 0x80,
-  0x82, 0x83, 0x84, 0x86, 0x8a, 0x8d, 0x8d, 0x8e, 0x8f, 0x8e, 0x8f, 0x8d,
-  0x8c, 0x8a, 0x88, 0x87, 0x85, 0x84, 0x83, 0x80, 0x7e, 0x7d, 0x7d, 0x7b,
-  0x7a, 0x79, 0x79, 0x79, 0x78, 0x78, 0x7b, 0x7c, 0x7b, 0x76, 0x6e, 0x64,
-  0x67, 0x7d, 0x8b, 0x91, 0x7b, 0x61, 0x5d, 0x61, 0x6c, 0x74, 0x7b, 0x8a,
-  0x8e, 0x88, 0x87, 0x91, 0x8b, 0x84, 0x7c, 0x84, 0x7b, 0x73, 0x71, 0x72,
-  0x7a, 0x63, 0x4c, 0x44, 0x47, 0x54, 0x6f, 0x79, 0x79, 0x6e, 0x5f, 0x51,
-  0x55, 0x55, 0x4b, 0x40, 0x39, 0x38, 0x41, 0x53, 0x42, 0x30, 0x35, 0x3a,
-  0x3f, 0x46, 0x4a, 0x44, 0x40, 0x3d, 0x39, 0x21, 0x16, 0x18, 0x29, 0x4a,
-  0x59, 0x5a, 0x56, 0x54, 0x76, 0x9d, 0xa0, 0x9e, 0x9e, 0x9e, 0x9c, 0x9c,
-  0x9a, 0x98, 0x94, 0x91, 0x8b, 0x88, 0x84, 0x80, 0x77, 0x6f, 0x6a, 0x67,
-  0x61, 0x58, 0x4f, 0x49, 0x45, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40,
-  0x41, 0x41, 0x41, 0x42, 0x43, 0x43, 0x42, 0x42, 0x43, 0x45, 0x46, 0x48,
-  0x49, 0x49, 0x4a, 0x49, 0x4a, 0x4b, 0x4d, 0x50, 0x52, 0x52, 0x52, 0x53,
-  0x55, 0x57, 0x57, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5b,
-  0x5b, 0x5d, 0x5f, 0x60, 0x61, 0x63, 0x63, 0x65, 0x68, 0x6b, 0x6c, 0x6e,
-  0x6e, 0x6f, 0x72, 0x72, 0x74, 0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x71,
-  0x6f, 0x6c, 0x6a, 0x68, 0x63, 0x5f, 0x5a, 0x58, 0x55, 0x51, 0x4a, 0x44,
-  0x41, 0x3d, 0x36, 0x2a, 0x1d, 0x16, 0x12, 0x11, 0x10, 0x10, 0x10, 0x11,
-  0x11, 0x12, 0x13, 0x12, 0x12, 0x13, 0x13, 0x12, 0x13, 0x13, 0x12, 0x13,
-  0x60, 0x60, 0x60, 0x61, 0x62, 0x63, 0x62, 0x60, 0x60, 0x61, 0x61, 0x5e,
-  0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x62,
-  0x63, 0x64, 0x65, 0x66, 0x66, 0x66, 0x69, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a, 0x69, 0x69, 0x68, 0x66,
-  0x65, 0x62, 0x61, 0x5e, 0x5b, 0x5a, 0x58, 0x56, 0x54, 0x52, 0x50, 0x4f,
-  0x51, 0x59, 0x5f, 0x62, 0x65, 0x6b, 0x6f, 0x70, 0x73, 0x76, 0x7c, 0x82,
-  0x85, 0x87, 0x88, 0x89, 0x8a, 0x87, 0x85, 0x84, 0x82, 0x80, 0x80, 0x7f,
-  0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7e, 0x7f, 0x82, 0x83, 0x84, 0x86,
-  0x8a, 0x8c, 0x8e, 0x8e, 0x8f, 0x8f, 0x8d, 0x8c, 0x8b, 0x8b, 0x89, 0x87,
-  0x86, 0x85, 0x83, 0x80, 0x7e, 0x7d, 0x7d, 0x7c, 0x7a, 0x78, 0x78, 0x78,
-  0x78, 0x78, 0x7a, 0x7c, 0x7b, 0x76, 0x6e, 0x69, 0x7a, 0x99, 0xa8, 0xa9,
-  0x8a, 0x67, 0x5f, 0x63, 0x6f, 0x7e, 0x8e, 0x9c, 0x98, 0x7e, 0x6c, 0x78,
-  0x7e, 0x7f, 0x82, 0x8b, 0x81, 0x79, 0x76, 0x7d, 0x94, 0x95, 0x84, 0x7c,
-  0x79, 0x7f, 0x7b, 0x76, 0x73, 0x6c, 0x67, 0x6a, 0x7b, 0x79, 0x5e, 0x49,
-  0x40, 0x3e, 0x3e, 0x3e, 0x33, 0x2c, 0x33, 0x36, 0x37, 0x3c, 0x40, 0x40,
-  0x3e, 0x3b, 0x36, 0x1e, 0x19, 0x1f, 0x32, 0x4e, 0x5a, 0x5d, 0x5a, 0x59,
-  0x7f, 0x9e, 0xa1, 0x9f, 0x9e, 0x9e, 0x9d, 0x9a, 0x98, 0x96, 0x92, 0x8d,
-  0x87, 0x83, 0x80, 0x7a, 0x72, 0x6a, 0x64, 0x60, 0x5a, 0x51, 0x49, 0x45,
-  0x42, 0x3f, 0x3f, 0x40, 0x3f, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x42,
-  0x43, 0x43, 0x42, 0x41, 0x42, 0x44, 0x45, 0x47, 0x49, 0x49, 0x4b, 0x4b,
-  0x4c, 0x4d, 0x4e, 0x50, 0x52, 0x53, 0x53, 0x53, 0x56, 0x57, 0x57, 0x58,
-  0x59, 0x58, 0x58, 0x59, 0x5a, 0x5a, 0x5a, 0x5c, 0x5d, 0x5f, 0x60, 0x61,
-  0x62, 0x63, 0x63, 0x64, 0x67, 0x6c, 0x6d, 0x6d, 0x6d, 0x6e, 0x72, 0x73,
-  0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x70, 0x6c, 0x6a, 0x68,
-  0x64, 0x5f, 0x5b, 0x58, 0x55, 0x50, 0x49, 0x44, 0x40, 0x3c, 0x35, 0x29,
-  0x1c, 0x15, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x13, 0x13, 0x13, 0x13, 0x12, 0x11, 0x13, 0x5e, 0x5f, 0x5f, 0x5f,
-  0x60, 0x61, 0x62, 0x60, 0x60, 0x61, 0x61, 0x5f, 0x5d, 0x5e, 0x5f, 0x5f,
-  0x60, 0x61, 0x61, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x63, 0x64, 0x64,
-  0x65, 0x66, 0x68, 0x68, 0x69, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c,
-  0x6c, 0x6b, 0x69, 0x69, 0x69, 0x6a, 0x69, 0x68, 0x67, 0x64, 0x61, 0x5d,
-  0x5a, 0x59, 0x57, 0x55, 0x52, 0x50, 0x50, 0x50, 0x53, 0x5d, 0x62, 0x64,
-  0x68, 0x6d, 0x6f, 0x71, 0x74, 0x76, 0x7a, 0x80, 0x83, 0x86, 0x87, 0x88,
-  0x89, 0x88, 0x86, 0x84, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7c, 0x7e, 0x7e, 0x80, 0x83, 0x83, 0x85, 0x89, 0x8b, 0x8d, 0x8d,
-  0x8e, 0x8d, 0x8d, 0x8b, 0x8b, 0x8c, 0x8a, 0x87, 0x87, 0x86, 0x84, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7a, 0x7a, 0x78, 0x78, 0x78, 0x78, 0x7a, 0x7c,
-  0x7b, 0x76, 0x6e, 0x6c, 0x83, 0xa1, 0xae, 0xab, 0x8f, 0x6d, 0x63, 0x66,
-  0x72, 0x8a, 0xa4, 0xa7, 0x97, 0x72, 0x62, 0x70, 0x75, 0x79, 0x84, 0x90,
-  0x8a, 0x83, 0x80, 0x82, 0x99, 0xa4, 0xa3, 0x9f, 0x96, 0x8a, 0x7e, 0x78,
-  0x76, 0x78, 0x84, 0x7b, 0x75, 0x6f, 0x63, 0x52, 0x54, 0x51, 0x4c, 0x41,
-  0x36, 0x32, 0x34, 0x32, 0x2e, 0x33, 0x3c, 0x3d, 0x3d, 0x3c, 0x32, 0x1e,
-  0x1f, 0x29, 0x3f, 0x54, 0x5b, 0x59, 0x57, 0x5f, 0x90, 0xa2, 0xa1, 0x9e,
-  0x9d, 0x9e, 0x9b, 0x97, 0x95, 0x93, 0x8f, 0x88, 0x80, 0x7d, 0x79, 0x74,
-  0x6b, 0x63, 0x5c, 0x58, 0x53, 0x4b, 0x45, 0x42, 0x41, 0x3f, 0x3e, 0x3e,
-  0x3d, 0x3d, 0x3e, 0x41, 0x42, 0x41, 0x41, 0x41, 0x43, 0x43, 0x42, 0x41,
-  0x42, 0x44, 0x45, 0x47, 0x48, 0x48, 0x4a, 0x4c, 0x4d, 0x4e, 0x4e, 0x50,
-  0x52, 0x54, 0x54, 0x55, 0x55, 0x57, 0x57, 0x58, 0x59, 0x59, 0x59, 0x5b,
-  0x5b, 0x5b, 0x5b, 0x5d, 0x5e, 0x5e, 0x5f, 0x61, 0x62, 0x63, 0x65, 0x66,
-  0x69, 0x6c, 0x6d, 0x6d, 0x6d, 0x6e, 0x72, 0x73, 0x72, 0x73, 0x74, 0x73,
-  0x73, 0x74, 0x74, 0x73, 0x70, 0x6b, 0x6a, 0x69, 0x65, 0x61, 0x5c, 0x58,
-  0x54, 0x4e, 0x48, 0x43, 0x3f, 0x3b, 0x34, 0x29, 0x1c, 0x15, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x13,
-  0x13, 0x12, 0x11, 0x13, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x62, 0x60,
-  0x60, 0x61, 0x61, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x61,
-  0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x65, 0x67, 0x67, 0x67,
-  0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6a, 0x69,
-  0x69, 0x6a, 0x69, 0x68, 0x67, 0x64, 0x61, 0x5e, 0x5a, 0x58, 0x57, 0x55,
-  0x51, 0x50, 0x50, 0x51, 0x56, 0x5f, 0x64, 0x66, 0x69, 0x6e, 0x71, 0x73,
-  0x75, 0x77, 0x7a, 0x7f, 0x82, 0x85, 0x85, 0x87, 0x89, 0x88, 0x85, 0x83,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x80, 0x82, 0x84, 0x85, 0x88, 0x8a, 0x8c, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c,
-  0x8c, 0x8c, 0x8b, 0x89, 0x89, 0x88, 0x86, 0x82, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7b, 0x79, 0x79, 0x78, 0x78, 0x78, 0x7a, 0x7c, 0x7c, 0x77, 0x6f, 0x6e,
-  0x84, 0xa0, 0xaa, 0xa4, 0x87, 0x6e, 0x65, 0x67, 0x75, 0x94, 0xab, 0xa1,
-  0x89, 0x62, 0x5e, 0x70, 0x71, 0x74, 0x82, 0x94, 0x94, 0x8c, 0x86, 0x86,
-  0x9c, 0xa7, 0xa8, 0xa5, 0x9e, 0x94, 0x8d, 0x8a, 0x8a, 0x92, 0xaa, 0x9a,
-  0x98, 0x93, 0x7d, 0x63, 0x64, 0x5f, 0x58, 0x4b, 0x42, 0x40, 0x3c, 0x35,
-  0x2b, 0x30, 0x3d, 0x3f, 0x40, 0x3e, 0x31, 0x20, 0x26, 0x33, 0x4a, 0x5a,
-  0x5b, 0x53, 0x55, 0x6a, 0x9b, 0xa3, 0x9f, 0x9d, 0x9d, 0x9d, 0x9a, 0x95,
-  0x93, 0x91, 0x8c, 0x84, 0x7c, 0x78, 0x74, 0x6f, 0x67, 0x5f, 0x58, 0x55,
-  0x4f, 0x48, 0x42, 0x40, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3d, 0x3e, 0x41,
-  0x42, 0x41, 0x41, 0x42, 0x44, 0x44, 0x42, 0x42, 0x43, 0x45, 0x46, 0x48,
-  0x48, 0x49, 0x4a, 0x4c, 0x4d, 0x4d, 0x4e, 0x4f, 0x52, 0x53, 0x54, 0x55,
-  0x55, 0x57, 0x57, 0x58, 0x5a, 0x5a, 0x5a, 0x5c, 0x5d, 0x5d, 0x5c, 0x5e,
-  0x5f, 0x5f, 0x5f, 0x60, 0x61, 0x63, 0x65, 0x67, 0x68, 0x6c, 0x6d, 0x6d,
-  0x6d, 0x6f, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72,
-  0x6f, 0x6b, 0x6a, 0x69, 0x65, 0x61, 0x5c, 0x58, 0x54, 0x4e, 0x49, 0x43,
-  0x3e, 0x3a, 0x34, 0x2a, 0x1c, 0x15, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x12, 0x11, 0x11, 0x11, 0x13, 0x13, 0x12, 0x12, 0x12, 0x11, 0x13,
-  0x5e, 0x5e, 0x5d, 0x5d, 0x5e, 0x61, 0x62, 0x61, 0x60, 0x61, 0x61, 0x5f,
-  0x5e, 0x5e, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x61, 0x61, 0x61, 0x63, 0x63,
-  0x63, 0x63, 0x64, 0x64, 0x65, 0x66, 0x66, 0x66, 0x67, 0x69, 0x6a, 0x6a,
-  0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6a, 0x69, 0x69, 0x6a, 0x6a, 0x68,
-  0x67, 0x65, 0x61, 0x5e, 0x5a, 0x58, 0x56, 0x55, 0x52, 0x51, 0x50, 0x52,
-  0x58, 0x61, 0x65, 0x67, 0x6a, 0x70, 0x73, 0x75, 0x76, 0x77, 0x7a, 0x7e,
-  0x81, 0x84, 0x85, 0x86, 0x88, 0x87, 0x85, 0x83, 0x81, 0x7f, 0x7f, 0x80,
-  0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85,
-  0x88, 0x89, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8c, 0x8b, 0x89,
-  0x88, 0x88, 0x86, 0x83, 0x80, 0x7f, 0x7f, 0x7e, 0x7c, 0x7a, 0x79, 0x79,
-  0x78, 0x78, 0x7a, 0x7c, 0x7b, 0x76, 0x70, 0x6e, 0x83, 0xa0, 0xa9, 0xa0,
-  0x82, 0x6c, 0x66, 0x68, 0x78, 0x99, 0xa9, 0x98, 0x7f, 0x59, 0x5f, 0x74,
-  0x74, 0x76, 0x82, 0x97, 0x9a, 0x93, 0x8d, 0x8c, 0x9e, 0xa1, 0xa5, 0xa5,
-  0xa1, 0x9b, 0x97, 0x97, 0x9a, 0xa7, 0xbc, 0xa5, 0xad, 0xad, 0x94, 0x6e,
-  0x6a, 0x69, 0x63, 0x56, 0x50, 0x50, 0x47, 0x3d, 0x2d, 0x2e, 0x3b, 0x40,
-  0x41, 0x3f, 0x31, 0x26, 0x2f, 0x3c, 0x51, 0x5d, 0x59, 0x51, 0x56, 0x71,
-  0x9d, 0xa3, 0x9e, 0x9d, 0x9c, 0x9b, 0x99, 0x94, 0x92, 0x8f, 0x8a, 0x82,
-  0x7a, 0x74, 0x71, 0x6c, 0x64, 0x5c, 0x56, 0x52, 0x4c, 0x45, 0x41, 0x3f,
-  0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x40, 0x41, 0x41, 0x41, 0x43,
-  0x44, 0x44, 0x43, 0x42, 0x43, 0x46, 0x47, 0x49, 0x49, 0x4a, 0x4b, 0x4c,
-  0x4d, 0x4d, 0x4e, 0x50, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
-  0x59, 0x5a, 0x5b, 0x5d, 0x5d, 0x5d, 0x5c, 0x5e, 0x5f, 0x5f, 0x5f, 0x60,
-  0x61, 0x63, 0x65, 0x67, 0x69, 0x6c, 0x6d, 0x6d, 0x6e, 0x70, 0x71, 0x71,
-  0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x6f, 0x6b, 0x6a, 0x69,
-  0x65, 0x61, 0x5c, 0x58, 0x55, 0x4f, 0x49, 0x43, 0x3d, 0x39, 0x33, 0x2a,
-  0x1d, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11,
-  0x12, 0x13, 0x13, 0x12, 0x12, 0x12, 0x11, 0x13, 0x5e, 0x5e, 0x5d, 0x5c,
-  0x5c, 0x60, 0x62, 0x62, 0x61, 0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x60,
-  0x61, 0x61, 0x61, 0x60, 0x60, 0x62, 0x63, 0x64, 0x63, 0x63, 0x64, 0x64,
-  0x65, 0x66, 0x66, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b,
-  0x6c, 0x6b, 0x6a, 0x6a, 0x69, 0x6a, 0x69, 0x69, 0x67, 0x65, 0x61, 0x5f,
-  0x5b, 0x59, 0x57, 0x56, 0x54, 0x51, 0x51, 0x53, 0x5a, 0x62, 0x66, 0x68,
-  0x6c, 0x72, 0x74, 0x76, 0x76, 0x77, 0x79, 0x7d, 0x80, 0x83, 0x84, 0x85,
-  0x87, 0x86, 0x85, 0x83, 0x81, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x82, 0x84, 0x87, 0x88, 0x8a, 0x8b,
-  0x8c, 0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0x88, 0x88, 0x86, 0x83,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7b, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7b,
-  0x7a, 0x76, 0x70, 0x6e, 0x84, 0xa4, 0xae, 0xa3, 0x80, 0x6a, 0x67, 0x6b,
-  0x7b, 0x9a, 0x9d, 0x85, 0x6d, 0x52, 0x62, 0x7e, 0x80, 0x7f, 0x85, 0x98,
-  0xa2, 0x9d, 0x98, 0x96, 0x9f, 0x96, 0xa2, 0xa8, 0xa5, 0xa0, 0x9f, 0xa3,
-  0xaa, 0xb9, 0xbb, 0x9d, 0xac, 0xb4, 0xa6, 0x7c, 0x71, 0x80, 0x81, 0x73,
-  0x70, 0x6d, 0x5d, 0x4d, 0x37, 0x2e, 0x37, 0x3f, 0x43, 0x43, 0x36, 0x32,
-  0x41, 0x4e, 0x5c, 0x60, 0x57, 0x51, 0x57, 0x71, 0x98, 0xa0, 0x9e, 0x9d,
-  0x9c, 0x9a, 0x97, 0x91, 0x8f, 0x8c, 0x86, 0x7d, 0x76, 0x71, 0x6d, 0x68,
-  0x5f, 0x57, 0x51, 0x4d, 0x47, 0x42, 0x40, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3f, 0x3f, 0x3f, 0x40, 0x41, 0x40, 0x41, 0x42, 0x42, 0x43, 0x43, 0x43,
-  0x44, 0x47, 0x49, 0x49, 0x49, 0x4a, 0x4c, 0x4c, 0x4d, 0x4e, 0x4f, 0x51,
-  0x51, 0x52, 0x53, 0x55, 0x56, 0x58, 0x59, 0x59, 0x59, 0x5a, 0x5b, 0x5e,
-  0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x61, 0x63, 0x63, 0x64, 0x66,
-  0x69, 0x6b, 0x6d, 0x6d, 0x6e, 0x70, 0x70, 0x72, 0x72, 0x73, 0x74, 0x74,
-  0x74, 0x74, 0x73, 0x70, 0x6f, 0x6b, 0x6a, 0x69, 0x65, 0x61, 0x5b, 0x58,
-  0x56, 0x51, 0x49, 0x43, 0x3d, 0x39, 0x33, 0x2a, 0x1d, 0x14, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12,
-  0x11, 0x11, 0x12, 0x13, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5f, 0x61, 0x61,
-  0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x60,
-  0x60, 0x61, 0x62, 0x62, 0x62, 0x61, 0x62, 0x63, 0x63, 0x65, 0x66, 0x65,
-  0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x6c, 0x6c, 0x6b, 0x6b,
-  0x6b, 0x6a, 0x69, 0x68, 0x68, 0x65, 0x62, 0x5f, 0x5b, 0x59, 0x56, 0x56,
-  0x54, 0x52, 0x51, 0x53, 0x5e, 0x66, 0x6a, 0x6c, 0x70, 0x74, 0x76, 0x78,
-  0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x81, 0x83, 0x84, 0x86, 0x85, 0x83, 0x82,
-  0x81, 0x7f, 0x7d, 0x7e, 0x7e, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x83, 0x86, 0x88, 0x88, 0x89, 0x8b, 0x8c, 0x8b, 0x8b,
-  0x8b, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x85, 0x85, 0x82, 0x81, 0x80, 0x80,
-  0x7e, 0x7b, 0x79, 0x79, 0x79, 0x78, 0x79, 0x79, 0x78, 0x76, 0x71, 0x6f,
-  0x8b, 0xaf, 0xba, 0xac, 0x7f, 0x67, 0x6a, 0x70, 0x7d, 0x8d, 0x80, 0x67,
-  0x59, 0x4f, 0x66, 0x87, 0x91, 0x91, 0x8f, 0x97, 0xa6, 0xa2, 0x9e, 0x9d,
-  0xa3, 0xa1, 0xa8, 0xaa, 0xa9, 0xa2, 0x9e, 0x9d, 0x9e, 0x9f, 0x9e, 0x8b,
-  0x88, 0x8c, 0x91, 0x8a, 0x93, 0xb5, 0xbf, 0xb2, 0xa8, 0x8d, 0x6e, 0x5c,
-  0x4a, 0x38, 0x38, 0x47, 0x51, 0x56, 0x44, 0x45, 0x57, 0x62, 0x67, 0x61,
-  0x56, 0x4d, 0x4e, 0x5f, 0x8c, 0x9f, 0x9d, 0x9a, 0x99, 0x97, 0x92, 0x8c,
-  0x88, 0x86, 0x81, 0x78, 0x70, 0x6b, 0x67, 0x61, 0x58, 0x51, 0x4b, 0x48,
-  0x44, 0x41, 0x40, 0x3e, 0x3d, 0x3d, 0x3d, 0x3d, 0x3f, 0x40, 0x41, 0x41,
-  0x42, 0x42, 0x42, 0x42, 0x43, 0x44, 0x44, 0x44, 0x45, 0x47, 0x49, 0x49,
-  0x49, 0x4a, 0x4c, 0x4c, 0x4d, 0x4e, 0x4f, 0x51, 0x52, 0x52, 0x52, 0x55,
-  0x56, 0x58, 0x59, 0x59, 0x58, 0x59, 0x5b, 0x5d, 0x5e, 0x5e, 0x5d, 0x5d,
-  0x5f, 0x5f, 0x60, 0x62, 0x63, 0x63, 0x64, 0x67, 0x6a, 0x6c, 0x6d, 0x6e,
-  0x6e, 0x6f, 0x70, 0x72, 0x72, 0x73, 0x74, 0x74, 0x74, 0x74, 0x72, 0x70,
-  0x6f, 0x6b, 0x6a, 0x69, 0x65, 0x60, 0x5b, 0x57, 0x56, 0x51, 0x49, 0x42,
-  0x3d, 0x3a, 0x34, 0x2a, 0x1c, 0x14, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11,
-  0x5c, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x60, 0x60, 0x60,
-  0x60, 0x60, 0x61, 0x60, 0x61, 0x61, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x60,
-  0x60, 0x60, 0x62, 0x62, 0x62, 0x64, 0x65, 0x64, 0x65, 0x66, 0x68, 0x68,
-  0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6b, 0x6b, 0x6a, 0x69, 0x69,
-  0x68, 0x66, 0x62, 0x5f, 0x5c, 0x59, 0x57, 0x56, 0x54, 0x52, 0x52, 0x56,
-  0x61, 0x6a, 0x6e, 0x70, 0x72, 0x77, 0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b,
-  0x7c, 0x7e, 0x80, 0x82, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7d,
-  0x7e, 0x80, 0x82, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x82, 0x83, 0x84,
-  0x85, 0x86, 0x88, 0x88, 0x88, 0x8a, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a,
-  0x89, 0x88, 0x86, 0x85, 0x82, 0x80, 0x80, 0x7f, 0x7d, 0x7b, 0x79, 0x79,
-  0x79, 0x78, 0x78, 0x79, 0x79, 0x77, 0x73, 0x74, 0x92, 0xb4, 0xbf, 0xaf,
-  0x7e, 0x6a, 0x6d, 0x73, 0x7c, 0x80, 0x6a, 0x55, 0x4e, 0x52, 0x64, 0x81,
-  0x99, 0xa0, 0x9e, 0x9b, 0xa4, 0x9c, 0x97, 0x99, 0xa2, 0xab, 0xad, 0xad,
-  0xac, 0xa0, 0x9a, 0x99, 0x9a, 0x9b, 0x98, 0x93, 0x8f, 0x8f, 0x93, 0x9b,
-  0xaa, 0xc2, 0xcc, 0xcb, 0xc2, 0x9d, 0x80, 0x75, 0x6d, 0x55, 0x4c, 0x5c,
-  0x69, 0x6e, 0x59, 0x57, 0x63, 0x69, 0x69, 0x60, 0x52, 0x3e, 0x39, 0x4a,
-  0x7d, 0x99, 0x9b, 0x99, 0x97, 0x93, 0x8e, 0x87, 0x82, 0x7f, 0x7b, 0x73,
-  0x6a, 0x64, 0x61, 0x5a, 0x50, 0x4a, 0x45, 0x43, 0x42, 0x40, 0x3f, 0x3f,
-  0x3e, 0x3d, 0x3d, 0x3e, 0x40, 0x41, 0x42, 0x42, 0x43, 0x43, 0x44, 0x44,
-  0x44, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x47, 0x48, 0x4b, 0x4d, 0x4c,
-  0x4d, 0x4e, 0x4e, 0x50, 0x51, 0x52, 0x52, 0x55, 0x56, 0x58, 0x59, 0x59,
-  0x58, 0x59, 0x5c, 0x5e, 0x5f, 0x5f, 0x5f, 0x5e, 0x60, 0x60, 0x61, 0x62,
-  0x63, 0x63, 0x64, 0x66, 0x69, 0x6b, 0x6d, 0x6e, 0x6e, 0x70, 0x70, 0x71,
-  0x71, 0x72, 0x73, 0x73, 0x74, 0x74, 0x72, 0x70, 0x6f, 0x6b, 0x6a, 0x69,
-  0x66, 0x62, 0x5c, 0x56, 0x53, 0x4f, 0x48, 0x41, 0x3d, 0x3a, 0x36, 0x2a,
-  0x1d, 0x15, 0x12, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12,
-  0x12, 0x12, 0x13, 0x11, 0x11, 0x11, 0x12, 0x12, 0x5c, 0x5d, 0x5e, 0x5d,
-  0x5d, 0x5d, 0x5d, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62,
-  0x61, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x61, 0x61, 0x61,
-  0x62, 0x64, 0x65, 0x64, 0x65, 0x66, 0x66, 0x68, 0x68, 0x6a, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6b, 0x6b, 0x6b, 0x6a, 0x69, 0x68, 0x68, 0x66, 0x62, 0x5f,
-  0x5c, 0x5b, 0x58, 0x55, 0x53, 0x52, 0x54, 0x58, 0x62, 0x6b, 0x70, 0x72,
-  0x75, 0x78, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x82, 0x82, 0x81, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7f, 0x82, 0x83,
-  0x82, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x84, 0x86, 0x86, 0x87, 0x87,
-  0x88, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8a, 0x89, 0x87, 0x86, 0x85,
-  0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x78, 0x78, 0x7a,
-  0x7b, 0x7a, 0x78, 0x7b, 0x93, 0xb1, 0xb9, 0xa9, 0x7b, 0x6b, 0x6d, 0x72,
-  0x7c, 0x80, 0x65, 0x4f, 0x4b, 0x53, 0x5b, 0x70, 0x94, 0xa4, 0xa9, 0xa3,
-  0xa1, 0x97, 0x91, 0x8e, 0x9c, 0xa8, 0xaa, 0xaa, 0xa8, 0x9f, 0x9c, 0x9d,
-  0xa0, 0xa4, 0xa2, 0xa4, 0xa3, 0xa1, 0xa2, 0xaa, 0xb1, 0xbb, 0xbf, 0xbf,
-  0xb9, 0xa0, 0x93, 0x90, 0x8d, 0x79, 0x66, 0x6d, 0x73, 0x70, 0x63, 0x60,
-  0x67, 0x69, 0x66, 0x59, 0x46, 0x39, 0x36, 0x42, 0x71, 0x92, 0x98, 0x97,
-  0x95, 0x91, 0x8b, 0x82, 0x7e, 0x7b, 0x75, 0x6e, 0x65, 0x5f, 0x5b, 0x54,
-  0x4d, 0x47, 0x43, 0x41, 0x41, 0x3f, 0x40, 0x40, 0x3f, 0x3e, 0x3e, 0x40,
-  0x41, 0x42, 0x43, 0x43, 0x43, 0x44, 0x44, 0x44, 0x44, 0x46, 0x47, 0x48,
-  0x47, 0x47, 0x47, 0x48, 0x49, 0x4c, 0x4d, 0x4d, 0x4d, 0x4e, 0x4f, 0x4e,
-  0x50, 0x51, 0x52, 0x55, 0x56, 0x58, 0x59, 0x59, 0x58, 0x5b, 0x5c, 0x5f,
-  0x5f, 0x5f, 0x60, 0x60, 0x60, 0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x66,
-  0x69, 0x6a, 0x6d, 0x6e, 0x6e, 0x70, 0x71, 0x71, 0x70, 0x71, 0x72, 0x72,
-  0x74, 0x73, 0x72, 0x70, 0x6f, 0x6d, 0x6b, 0x69, 0x67, 0x62, 0x5c, 0x56,
-  0x52, 0x4e, 0x49, 0x43, 0x3e, 0x3b, 0x35, 0x29, 0x1e, 0x16, 0x12, 0x11,
-  0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x13, 0x12, 0x11,
-  0x12, 0x12, 0x13, 0x11, 0x5b, 0x5d, 0x5e, 0x5d, 0x5c, 0x5d, 0x5d, 0x5f,
-  0x60, 0x61, 0x61, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61, 0x62, 0x61, 0x60,
-  0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x60, 0x62, 0x63, 0x65, 0x65, 0x64,
-  0x65, 0x66, 0x66, 0x68, 0x68, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6b,
-  0x6b, 0x6a, 0x69, 0x68, 0x68, 0x65, 0x61, 0x5f, 0x5c, 0x5b, 0x58, 0x55,
-  0x53, 0x53, 0x55, 0x5a, 0x64, 0x6c, 0x71, 0x74, 0x77, 0x7a, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x81, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x82, 0x83, 0x82, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x86, 0x86, 0x86, 0x87, 0x87, 0x8a, 0x8a, 0x8b,
-  0x8c, 0x8c, 0x8c, 0x89, 0x88, 0x88, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x78, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f,
-  0x91, 0xaa, 0xb0, 0xa1, 0x7a, 0x6e, 0x6e, 0x72, 0x7d, 0x84, 0x67, 0x4e,
-  0x4a, 0x51, 0x52, 0x5e, 0x87, 0x9f, 0xac, 0xa9, 0xa2, 0x9a, 0x93, 0x8e,
-  0x94, 0x9e, 0xa2, 0xa4, 0xa2, 0x9d, 0x9c, 0x9e, 0xa2, 0xa8, 0xa8, 0xac,
-  0xab, 0xaa, 0xa9, 0xad, 0xb1, 0xb2, 0xb2, 0xb2, 0xae, 0xa1, 0x9d, 0x9d,
-  0x9c, 0x8c, 0x76, 0x75, 0x74, 0x6c, 0x64, 0x61, 0x64, 0x65, 0x60, 0x4e,
-  0x41, 0x3e, 0x3b, 0x40, 0x6a, 0x8b, 0x94, 0x95, 0x94, 0x90, 0x89, 0x80,
-  0x7a, 0x77, 0x71, 0x6a, 0x61, 0x5b, 0x57, 0x50, 0x4a, 0x46, 0x42, 0x41,
-  0x41, 0x40, 0x41, 0x40, 0x40, 0x3e, 0x3f, 0x41, 0x41, 0x42, 0x43, 0x44,
-  0x43, 0x43, 0x44, 0x45, 0x45, 0x46, 0x47, 0x48, 0x48, 0x47, 0x48, 0x49,
-  0x4a, 0x4c, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e, 0x50, 0x51, 0x52, 0x55,
-  0x56, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x5d, 0x5e, 0x5e, 0x5f, 0x60, 0x60,
-  0x60, 0x61, 0x62, 0x62, 0x64, 0x64, 0x66, 0x67, 0x69, 0x6a, 0x6c, 0x6e,
-  0x6e, 0x70, 0x71, 0x70, 0x70, 0x71, 0x72, 0x72, 0x74, 0x73, 0x72, 0x70,
-  0x6f, 0x6d, 0x6b, 0x69, 0x67, 0x61, 0x5c, 0x56, 0x51, 0x4d, 0x4a, 0x44,
-  0x3e, 0x3a, 0x34, 0x29, 0x1e, 0x16, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13, 0x12, 0x13, 0x13, 0x13, 0x11,
-  0x5b, 0x5d, 0x5e, 0x5d, 0x5d, 0x5e, 0x5e, 0x5f, 0x60, 0x61, 0x61, 0x60,
-  0x61, 0x62, 0x62, 0x61, 0x60, 0x61, 0x61, 0x60, 0x60, 0x60, 0x61, 0x61,
-  0x60, 0x61, 0x60, 0x61, 0x62, 0x64, 0x65, 0x64, 0x65, 0x66, 0x66, 0x68,
-  0x68, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6b, 0x6b, 0x6a, 0x68, 0x68,
-  0x67, 0x65, 0x62, 0x60, 0x5e, 0x5c, 0x59, 0x56, 0x53, 0x53, 0x56, 0x5d,
-  0x67, 0x70, 0x75, 0x77, 0x7a, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x81, 0x83, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x82, 0x83,
-  0x85, 0x86, 0x87, 0x87, 0x87, 0x89, 0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x89,
-  0x89, 0x88, 0x87, 0x86, 0x83, 0x83, 0x82, 0x80, 0x7d, 0x7c, 0x7a, 0x7a,
-  0x7a, 0x78, 0x79, 0x7a, 0x7c, 0x7f, 0x84, 0x83, 0x8b, 0x99, 0x9c, 0x90,
-  0x79, 0x70, 0x6e, 0x72, 0x80, 0x8a, 0x6a, 0x4d, 0x48, 0x4d, 0x41, 0x3f,
-  0x69, 0x88, 0xa8, 0xb0, 0xa8, 0xa4, 0xa0, 0x98, 0x8d, 0x8d, 0x92, 0x94,
-  0x95, 0x94, 0x95, 0x98, 0x9c, 0xa3, 0xa7, 0xa9, 0xa7, 0xa7, 0xa8, 0xa8,
-  0xa6, 0xa3, 0xa2, 0xa1, 0xa2, 0xa3, 0xa4, 0xa4, 0xa3, 0x99, 0x83, 0x74,
-  0x6c, 0x63, 0x5f, 0x5d, 0x5e, 0x5b, 0x4e, 0x38, 0x3f, 0x4c, 0x4c, 0x46,
-  0x5e, 0x7d, 0x89, 0x8e, 0x90, 0x8f, 0x88, 0x7d, 0x75, 0x71, 0x6b, 0x64,
-  0x5c, 0x56, 0x52, 0x4c, 0x47, 0x43, 0x42, 0x41, 0x41, 0x40, 0x41, 0x40,
-  0x40, 0x3f, 0x40, 0x41, 0x42, 0x42, 0x43, 0x44, 0x43, 0x43, 0x44, 0x45,
-  0x46, 0x47, 0x48, 0x48, 0x49, 0x49, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
-  0x4f, 0x4f, 0x4e, 0x4e, 0x50, 0x51, 0x52, 0x54, 0x56, 0x58, 0x58, 0x58,
-  0x59, 0x5b, 0x5d, 0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x63,
-  0x65, 0x67, 0x67, 0x67, 0x68, 0x6a, 0x6c, 0x6d, 0x6e, 0x70, 0x71, 0x71,
-  0x71, 0x71, 0x72, 0x72, 0x74, 0x73, 0x72, 0x6f, 0x6e, 0x6c, 0x6a, 0x69,
-  0x67, 0x61, 0x5c, 0x56, 0x51, 0x4d, 0x4a, 0x43, 0x3d, 0x39, 0x34, 0x29,
-  0x1e, 0x16, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12,
-  0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x11, 0x13, 0x5b, 0x5d, 0x5c, 0x5c,
-  0x5c, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61,
-  0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x61, 0x61, 0x61, 0x62, 0x61, 0x63,
-  0x63, 0x63, 0x63, 0x63, 0x64, 0x65, 0x66, 0x68, 0x68, 0x6a, 0x6b, 0x6a,
-  0x6b, 0x6b, 0x6a, 0x6b, 0x6b, 0x6a, 0x69, 0x69, 0x68, 0x66, 0x63, 0x60,
-  0x5d, 0x5b, 0x59, 0x57, 0x55, 0x55, 0x58, 0x60, 0x6b, 0x73, 0x77, 0x79,
-  0x7b, 0x7f, 0x80, 0x84, 0x85, 0x85, 0x84, 0x82, 0x7f, 0x7d, 0x7c, 0x7b,
-  0x7b, 0x7a, 0x79, 0x78, 0x77, 0x79, 0x7b, 0x7c, 0x7c, 0x7d, 0x7f, 0x82,
-  0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x82, 0x85, 0x86, 0x87, 0x87,
-  0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87,
-  0x84, 0x83, 0x82, 0x80, 0x7d, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b,
-  0x7c, 0x82, 0x89, 0x88, 0x81, 0x81, 0x82, 0x80, 0x77, 0x71, 0x6f, 0x75,
-  0x83, 0x85, 0x61, 0x4b, 0x46, 0x45, 0x30, 0x25, 0x40, 0x61, 0x95, 0xb1,
-  0xb1, 0xaa, 0xa4, 0x9c, 0x95, 0x8e, 0x88, 0x87, 0x85, 0x84, 0x85, 0x86,
-  0x89, 0x8d, 0x8e, 0x8a, 0x88, 0x89, 0x8d, 0x91, 0x91, 0x91, 0x90, 0x90,
-  0x95, 0x9a, 0x99, 0x97, 0x94, 0x87, 0x71, 0x61, 0x5b, 0x58, 0x59, 0x59,
-  0x52, 0x45, 0x2e, 0x29, 0x45, 0x5f, 0x62, 0x53, 0x53, 0x67, 0x76, 0x80,
-  0x86, 0x8a, 0x88, 0x7e, 0x74, 0x6e, 0x65, 0x5c, 0x53, 0x4e, 0x4b, 0x47,
-  0x44, 0x42, 0x41, 0x40, 0x40, 0x40, 0x41, 0x41, 0x40, 0x40, 0x42, 0x42,
-  0x43, 0x43, 0x43, 0x44, 0x44, 0x44, 0x45, 0x45, 0x46, 0x47, 0x48, 0x48,
-  0x48, 0x49, 0x4a, 0x4c, 0x4d, 0x4d, 0x4d, 0x4e, 0x50, 0x50, 0x50, 0x50,
-  0x50, 0x51, 0x52, 0x53, 0x56, 0x57, 0x57, 0x58, 0x59, 0x5c, 0x5c, 0x5e,
-  0x5d, 0x5e, 0x5f, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x66, 0x67, 0x67, 0x67,
-  0x68, 0x69, 0x6c, 0x6d, 0x6e, 0x70, 0x71, 0x72, 0x71, 0x71, 0x72, 0x73,
-  0x73, 0x74, 0x73, 0x71, 0x6e, 0x6c, 0x6b, 0x69, 0x66, 0x61, 0x5b, 0x56,
-  0x53, 0x50, 0x4a, 0x42, 0x3b, 0x39, 0x34, 0x2a, 0x1e, 0x16, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x12,
-  0x11, 0x11, 0x12, 0x12, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f, 0x5f, 0x60,
-  0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
-  0x61, 0x60, 0x61, 0x62, 0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x62,
-  0x63, 0x64, 0x66, 0x67, 0x69, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b,
-  0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x67, 0x63, 0x61, 0x5e, 0x5c, 0x5b, 0x58,
-  0x56, 0x57, 0x5b, 0x63, 0x6e, 0x75, 0x79, 0x7b, 0x7d, 0x80, 0x85, 0x87,
-  0x88, 0x88, 0x87, 0x85, 0x82, 0x7f, 0x7e, 0x7b, 0x78, 0x78, 0x77, 0x75,
-  0x72, 0x75, 0x7a, 0x7d, 0x7d, 0x7d, 0x7f, 0x82, 0x84, 0x85, 0x85, 0x84,
-  0x82, 0x83, 0x83, 0x82, 0x83, 0x85, 0x86, 0x86, 0x87, 0x89, 0x89, 0x89,
-  0x89, 0x88, 0x88, 0x88, 0x89, 0x89, 0x88, 0x86, 0x85, 0x83, 0x82, 0x81,
-  0x7f, 0x7c, 0x7c, 0x7c, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x80, 0x89, 0x8c,
-  0x84, 0x7e, 0x7c, 0x7a, 0x72, 0x6d, 0x6e, 0x77, 0x8a, 0x80, 0x54, 0x44,
-  0x40, 0x3a, 0x27, 0x1e, 0x2a, 0x44, 0x79, 0xa4, 0xb0, 0xb0, 0xaa, 0x9d,
-  0x8d, 0x84, 0x82, 0x83, 0x87, 0x8e, 0x8f, 0x8f, 0x90, 0x91, 0x8e, 0x88,
-  0x81, 0x7c, 0x77, 0x73, 0x72, 0x72, 0x73, 0x76, 0x76, 0x76, 0x75, 0x72,
-  0x6b, 0x61, 0x5a, 0x5b, 0x5d, 0x61, 0x61, 0x4e, 0x33, 0x25, 0x22, 0x2b,
-  0x47, 0x65, 0x6c, 0x5e, 0x48, 0x4f, 0x66, 0x79, 0x81, 0x86, 0x84, 0x7e,
-  0x75, 0x6e, 0x62, 0x55, 0x4b, 0x47, 0x45, 0x43, 0x41, 0x40, 0x3f, 0x40,
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x42, 0x43, 0x43, 0x44,
-  0x45, 0x45, 0x45, 0x46, 0x47, 0x48, 0x49, 0x49, 0x48, 0x49, 0x4b, 0x4d,
-  0x4d, 0x4e, 0x4d, 0x4e, 0x50, 0x50, 0x50, 0x51, 0x51, 0x52, 0x53, 0x54,
-  0x56, 0x58, 0x58, 0x58, 0x59, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x60,
-  0x60, 0x63, 0x63, 0x63, 0x65, 0x67, 0x66, 0x67, 0x68, 0x69, 0x6b, 0x6d,
-  0x6e, 0x70, 0x71, 0x72, 0x71, 0x72, 0x73, 0x74, 0x74, 0x74, 0x73, 0x72,
-  0x6e, 0x6c, 0x6b, 0x69, 0x66, 0x60, 0x5b, 0x56, 0x53, 0x50, 0x49, 0x41,
-  0x3d, 0x3a, 0x34, 0x2a, 0x1d, 0x17, 0x14, 0x11, 0x11, 0x12, 0x12, 0x11,
-  0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12,
-  0x5a, 0x5c, 0x5d, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x61,
-  0x61, 0x61, 0x62, 0x63, 0x63, 0x62, 0x62, 0x62, 0x61, 0x61, 0x63, 0x63,
-  0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63, 0x64, 0x66, 0x67,
-  0x68, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a,
-  0x69, 0x67, 0x64, 0x60, 0x5e, 0x5d, 0x5c, 0x5a, 0x57, 0x5a, 0x5e, 0x67,
-  0x70, 0x77, 0x7b, 0x7d, 0x80, 0x83, 0x86, 0x89, 0x8a, 0x8a, 0x89, 0x87,
-  0x84, 0x81, 0x7f, 0x7a, 0x76, 0x76, 0x74, 0x71, 0x6f, 0x73, 0x78, 0x7c,
-  0x7e, 0x80, 0x81, 0x83, 0x85, 0x85, 0x85, 0x85, 0x83, 0x84, 0x84, 0x83,
-  0x83, 0x84, 0x85, 0x86, 0x87, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x88,
-  0x8a, 0x89, 0x88, 0x86, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x79, 0x7b, 0x7b, 0x7c, 0x7d, 0x86, 0x8d, 0x8b, 0x85, 0x80, 0x78,
-  0x6b, 0x68, 0x6c, 0x78, 0x8e, 0x7e, 0x4e, 0x3f, 0x3b, 0x34, 0x26, 0x20,
-  0x26, 0x39, 0x65, 0x93, 0xa8, 0xae, 0xae, 0xa8, 0x9c, 0x90, 0x86, 0x7d,
-  0x72, 0x6d, 0x6e, 0x6f, 0x71, 0x76, 0x7e, 0x80, 0x7c, 0x78, 0x75, 0x74,
-  0x78, 0x7a, 0x7c, 0x7e, 0x78, 0x6e, 0x65, 0x60, 0x5b, 0x5b, 0x61, 0x67,
-  0x6b, 0x6b, 0x57, 0x32, 0x1f, 0x1d, 0x26, 0x31, 0x47, 0x62, 0x6b, 0x60,
-  0x45, 0x46, 0x63, 0x7c, 0x86, 0x86, 0x81, 0x7d, 0x77, 0x70, 0x63, 0x53,
-  0x48, 0x44, 0x42, 0x40, 0x3d, 0x3d, 0x3e, 0x40, 0x42, 0x44, 0x46, 0x45,
-  0x43, 0x42, 0x40, 0x40, 0x42, 0x43, 0x45, 0x46, 0x46, 0x45, 0x45, 0x45,
-  0x48, 0x49, 0x4a, 0x4a, 0x49, 0x49, 0x4c, 0x4d, 0x4e, 0x4f, 0x4f, 0x4f,
-  0x50, 0x50, 0x50, 0x51, 0x52, 0x52, 0x53, 0x55, 0x55, 0x58, 0x58, 0x58,
-  0x5a, 0x5b, 0x5c, 0x5e, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x63, 0x64, 0x65,
-  0x66, 0x67, 0x66, 0x67, 0x68, 0x68, 0x6c, 0x6e, 0x6e, 0x70, 0x70, 0x71,
-  0x71, 0x71, 0x73, 0x74, 0x74, 0x74, 0x73, 0x72, 0x6e, 0x6d, 0x6b, 0x69,
-  0x66, 0x61, 0x5c, 0x56, 0x54, 0x4f, 0x48, 0x41, 0x3d, 0x3a, 0x35, 0x2b,
-  0x1e, 0x17, 0x14, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x12, 0x13, 0x12, 0x11, 0x11, 0x12, 0x11, 0x5a, 0x5c, 0x5d, 0x5d,
-  0x5d, 0x5f, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62, 0x64,
-  0x63, 0x62, 0x62, 0x62, 0x61, 0x62, 0x63, 0x63, 0x62, 0x61, 0x61, 0x63,
-  0x63, 0x62, 0x62, 0x64, 0x63, 0x64, 0x66, 0x66, 0x68, 0x69, 0x6a, 0x6a,
-  0x6b, 0x6b, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x67, 0x64, 0x61,
-  0x5f, 0x5e, 0x5d, 0x59, 0x58, 0x5b, 0x60, 0x68, 0x71, 0x77, 0x7b, 0x7e,
-  0x80, 0x85, 0x87, 0x8b, 0x8c, 0x8c, 0x8b, 0x88, 0x86, 0x82, 0x80, 0x7b,
-  0x76, 0x74, 0x71, 0x70, 0x6e, 0x72, 0x78, 0x7d, 0x7f, 0x80, 0x82, 0x84,
-  0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x84, 0x84, 0x85,
-  0x86, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x89, 0x89, 0x88, 0x87,
-  0x85, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x7d, 0x7c, 0x79, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x83, 0x8b, 0x8c, 0x87, 0x82, 0x74, 0x65, 0x66, 0x6c, 0x7a,
-  0x92, 0x7e, 0x4b, 0x3b, 0x39, 0x35, 0x2a, 0x23, 0x26, 0x34, 0x59, 0x84,
-  0x9d, 0xa8, 0xac, 0xac, 0xa4, 0x99, 0x8b, 0x7f, 0x6c, 0x5e, 0x5b, 0x5b,
-  0x5e, 0x64, 0x6f, 0x74, 0x72, 0x71, 0x6f, 0x71, 0x74, 0x75, 0x76, 0x78,
-  0x75, 0x6d, 0x65, 0x60, 0x5e, 0x61, 0x68, 0x6b, 0x6a, 0x61, 0x47, 0x25,
-  0x1b, 0x1e, 0x29, 0x34, 0x49, 0x65, 0x6e, 0x64, 0x47, 0x44, 0x65, 0x7f,
-  0x88, 0x88, 0x7f, 0x7a, 0x76, 0x71, 0x65, 0x54, 0x47, 0x42, 0x40, 0x40,
-  0x43, 0x4a, 0x4f, 0x52, 0x55, 0x5b, 0x5e, 0x5c, 0x5b, 0x58, 0x4f, 0x45,
-  0x42, 0x42, 0x44, 0x45, 0x45, 0x45, 0x44, 0x45, 0x48, 0x49, 0x4a, 0x4a,
-  0x49, 0x4a, 0x4d, 0x4e, 0x4e, 0x4f, 0x50, 0x4f, 0x50, 0x50, 0x50, 0x51,
-  0x52, 0x53, 0x54, 0x55, 0x55, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5e,
-  0x5e, 0x5f, 0x60, 0x60, 0x61, 0x63, 0x65, 0x66, 0x67, 0x67, 0x67, 0x68,
-  0x69, 0x69, 0x6c, 0x6d, 0x6e, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73,
-  0x74, 0x74, 0x73, 0x72, 0x6e, 0x6d, 0x6b, 0x69, 0x66, 0x60, 0x5b, 0x56,
-  0x53, 0x4f, 0x48, 0x41, 0x3d, 0x3a, 0x34, 0x2a, 0x1e, 0x18, 0x14, 0x12,
-  0x11, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12,
-  0x11, 0x11, 0x12, 0x11, 0x59, 0x5b, 0x5c, 0x5c, 0x5e, 0x5e, 0x60, 0x60,
-  0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x63, 0x64, 0x64, 0x62, 0x62, 0x62,
-  0x61, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61, 0x62, 0x62, 0x61, 0x62, 0x63,
-  0x63, 0x64, 0x66, 0x67, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a,
-  0x6a, 0x6b, 0x6b, 0x6a, 0x69, 0x67, 0x64, 0x61, 0x60, 0x5f, 0x5d, 0x59,
-  0x58, 0x5c, 0x61, 0x6a, 0x73, 0x77, 0x7c, 0x7e, 0x81, 0x85, 0x87, 0x8b,
-  0x8c, 0x8c, 0x8b, 0x89, 0x86, 0x84, 0x81, 0x7c, 0x77, 0x71, 0x6e, 0x6c,
-  0x6d, 0x73, 0x79, 0x7e, 0x7f, 0x81, 0x83, 0x85, 0x86, 0x86, 0x85, 0x84,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x89, 0x89,
-  0x89, 0x88, 0x88, 0x88, 0x87, 0x87, 0x88, 0x88, 0x85, 0x83, 0x83, 0x81,
-  0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x7b, 0x7d, 0x7e, 0x7f, 0x7f, 0x82,
-  0x84, 0x82, 0x7b, 0x6b, 0x5e, 0x65, 0x6e, 0x7e, 0x98, 0x7c, 0x46, 0x37,
-  0x38, 0x40, 0x3a, 0x2b, 0x24, 0x2d, 0x4a, 0x6d, 0x86, 0x98, 0xa0, 0xa7,
-  0xa6, 0x9f, 0x96, 0x8c, 0x78, 0x61, 0x56, 0x53, 0x53, 0x55, 0x5b, 0x60,
-  0x61, 0x62, 0x62, 0x62, 0x60, 0x5b, 0x5a, 0x5b, 0x62, 0x65, 0x65, 0x65,
-  0x65, 0x65, 0x62, 0x5a, 0x51, 0x3e, 0x2f, 0x25, 0x23, 0x24, 0x2b, 0x37,
-  0x50, 0x70, 0x7a, 0x70, 0x4e, 0x48, 0x67, 0x7f, 0x88, 0x8a, 0x7d, 0x76,
-  0x74, 0x72, 0x68, 0x58, 0x49, 0x43, 0x43, 0x4b, 0x60, 0x74, 0x7e, 0x83,
-  0x89, 0x90, 0x92, 0x92, 0x91, 0x8b, 0x79, 0x5a, 0x48, 0x43, 0x43, 0x44,
-  0x46, 0x45, 0x45, 0x47, 0x48, 0x48, 0x4a, 0x4a, 0x49, 0x4c, 0x4e, 0x4f,
-  0x4f, 0x50, 0x50, 0x50, 0x50, 0x51, 0x52, 0x53, 0x52, 0x53, 0x54, 0x54,
-  0x55, 0x57, 0x59, 0x5a, 0x5a, 0x5c, 0x5c, 0x5e, 0x5f, 0x5f, 0x5f, 0x60,
-  0x60, 0x62, 0x64, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x6b, 0x6d, 0x6d,
-  0x6e, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x72, 0x73, 0x73, 0x73, 0x73, 0x72,
-  0x6e, 0x6d, 0x6b, 0x69, 0x65, 0x5f, 0x5a, 0x55, 0x52, 0x4e, 0x47, 0x41,
-  0x3b, 0x38, 0x31, 0x29, 0x1e, 0x17, 0x14, 0x12, 0x12, 0x11, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x12, 0x12, 0x11, 0x12, 0x11, 0x12, 0x12, 0x12, 0x11,
-  0x59, 0x5b, 0x5c, 0x5d, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61,
-  0x61, 0x62, 0x63, 0x64, 0x62, 0x61, 0x61, 0x63, 0x63, 0x62, 0x63, 0x63,
-  0x61, 0x60, 0x61, 0x62, 0x63, 0x63, 0x62, 0x64, 0x63, 0x64, 0x66, 0x66,
-  0x66, 0x68, 0x69, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6a,
-  0x69, 0x67, 0x64, 0x61, 0x5f, 0x5e, 0x5c, 0x59, 0x5a, 0x5f, 0x64, 0x6c,
-  0x75, 0x79, 0x7e, 0x81, 0x84, 0x88, 0x89, 0x8d, 0x8f, 0x8f, 0x8e, 0x8c,
-  0x89, 0x86, 0x83, 0x7e, 0x78, 0x6f, 0x69, 0x68, 0x6c, 0x73, 0x79, 0x7e,
-  0x81, 0x81, 0x83, 0x85, 0x87, 0x87, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84,
-  0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x87, 0x87, 0x87, 0x86, 0x87, 0x86,
-  0x87, 0x87, 0x87, 0x88, 0x86, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7a, 0x7b, 0x7f, 0x81, 0x81, 0x78, 0x71, 0x6e, 0x6b, 0x65, 0x58,
-  0x55, 0x64, 0x74, 0x86, 0x9c, 0x74, 0x3f, 0x35, 0x40, 0x57, 0x56, 0x37,
-  0x23, 0x23, 0x35, 0x53, 0x67, 0x78, 0x84, 0x95, 0xa0, 0xa0, 0x9b, 0x93,
-  0x81, 0x6a, 0x5d, 0x58, 0x56, 0x54, 0x50, 0x53, 0x58, 0x5c, 0x5f, 0x60,
-  0x5e, 0x59, 0x54, 0x4d, 0x47, 0x43, 0x43, 0x46, 0x49, 0x3f, 0x2e, 0x25,
-  0x22, 0x24, 0x35, 0x38, 0x31, 0x2c, 0x2c, 0x38, 0x59, 0x77, 0x80, 0x76,
-  0x56, 0x4d, 0x65, 0x7b, 0x86, 0x87, 0x77, 0x70, 0x73, 0x73, 0x6d, 0x5f,
-  0x56, 0x5b, 0x66, 0x7c, 0x96, 0xa0, 0xa2, 0xa4, 0xa7, 0xa8, 0xaa, 0xaa,
-  0xa9, 0xa6, 0x98, 0x7a, 0x5d, 0x4f, 0x45, 0x44, 0x44, 0x45, 0x45, 0x47,
-  0x48, 0x49, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4e, 0x4f, 0x4f, 0x4f, 0x51,
-  0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x55, 0x55, 0x55, 0x56, 0x59, 0x5a,
-  0x5a, 0x5c, 0x5b, 0x5d, 0x60, 0x60, 0x61, 0x61, 0x62, 0x64, 0x65, 0x65,
-  0x66, 0x67, 0x68, 0x69, 0x69, 0x6b, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
-  0x71, 0x72, 0x74, 0x72, 0x73, 0x74, 0x73, 0x72, 0x6e, 0x6c, 0x6b, 0x69,
-  0x65, 0x5e, 0x59, 0x54, 0x52, 0x4e, 0x47, 0x40, 0x3b, 0x38, 0x31, 0x29,
-  0x1e, 0x18, 0x14, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x12, 0x11, 0x12, 0x11, 0x12, 0x12, 0x11, 0x12, 0x59, 0x5b, 0x5c, 0x5c,
-  0x5d, 0x5e, 0x60, 0x61, 0x61, 0x61, 0x62, 0x61, 0x61, 0x62, 0x63, 0x62,
-  0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x64, 0x64, 0x63, 0x62, 0x62, 0x63,
-  0x63, 0x64, 0x63, 0x64, 0x64, 0x65, 0x66, 0x67, 0x67, 0x68, 0x68, 0x6a,
-  0x6b, 0x6b, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x69, 0x68, 0x66, 0x65, 0x63,
-  0x61, 0x60, 0x5d, 0x59, 0x5c, 0x61, 0x66, 0x6e, 0x76, 0x7d, 0x82, 0x84,
-  0x86, 0x8a, 0x8b, 0x8f, 0x90, 0x91, 0x90, 0x8e, 0x8b, 0x87, 0x84, 0x80,
-  0x79, 0x6e, 0x67, 0x66, 0x6b, 0x73, 0x7a, 0x7e, 0x80, 0x80, 0x81, 0x84,
-  0x86, 0x86, 0x86, 0x87, 0x85, 0x84, 0x84, 0x84, 0x85, 0x85, 0x84, 0x83,
-  0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x82, 0x80, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x81,
-  0x86, 0x88, 0x7b, 0x65, 0x55, 0x4b, 0x45, 0x40, 0x4d, 0x62, 0x75, 0x87,
-  0x94, 0x66, 0x3d, 0x3a, 0x49, 0x6a, 0x65, 0x3c, 0x25, 0x21, 0x29, 0x42,
-  0x53, 0x5c, 0x65, 0x75, 0x88, 0x91, 0x91, 0x8c, 0x7e, 0x69, 0x5d, 0x59,
-  0x58, 0x55, 0x4f, 0x4b, 0x4a, 0x4a, 0x4b, 0x4c, 0x4b, 0x47, 0x42, 0x37,
-  0x2b, 0x22, 0x1e, 0x1e, 0x1f, 0x1c, 0x16, 0x16, 0x19, 0x23, 0x3a, 0x3d,
-  0x35, 0x2f, 0x2d, 0x3a, 0x59, 0x6f, 0x74, 0x6c, 0x58, 0x4f, 0x59, 0x72,
-  0x7d, 0x7d, 0x6e, 0x6b, 0x71, 0x73, 0x70, 0x6d, 0x7a, 0x8d, 0x99, 0xa3,
-  0xac, 0xac, 0xaa, 0xaa, 0xab, 0xae, 0xab, 0xa9, 0xa4, 0x98, 0x8a, 0x7d,
-  0x6f, 0x61, 0x4c, 0x44, 0x44, 0x46, 0x46, 0x47, 0x48, 0x4a, 0x49, 0x49,
-  0x4a, 0x4d, 0x4e, 0x4e, 0x4e, 0x4e, 0x4f, 0x51, 0x53, 0x53, 0x53, 0x54,
-  0x54, 0x55, 0x56, 0x56, 0x56, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5c, 0x5e,
-  0x60, 0x61, 0x61, 0x61, 0x63, 0x65, 0x65, 0x65, 0x66, 0x68, 0x69, 0x69,
-  0x6a, 0x6a, 0x6c, 0x6e, 0x6f, 0x70, 0x71, 0x6f, 0x70, 0x71, 0x74, 0x73,
-  0x73, 0x74, 0x74, 0x72, 0x6e, 0x6c, 0x6a, 0x68, 0x64, 0x5f, 0x5a, 0x54,
-  0x52, 0x4d, 0x46, 0x40, 0x3d, 0x39, 0x33, 0x29, 0x1e, 0x18, 0x15, 0x12,
-  0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12,
-  0x11, 0x11, 0x11, 0x12, 0x58, 0x5b, 0x5c, 0x5c, 0x5c, 0x5e, 0x5f, 0x60,
-  0x60, 0x60, 0x62, 0x61, 0x62, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
-  0x64, 0x63, 0x64, 0x64, 0x64, 0x63, 0x63, 0x62, 0x63, 0x64, 0x64, 0x63,
-  0x64, 0x65, 0x66, 0x66, 0x66, 0x68, 0x69, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b,
-  0x6b, 0x6b, 0x6b, 0x6a, 0x69, 0x67, 0x66, 0x64, 0x62, 0x60, 0x5e, 0x5c,
-  0x5f, 0x65, 0x6b, 0x72, 0x79, 0x80, 0x84, 0x85, 0x87, 0x8b, 0x8d, 0x90,
-  0x92, 0x92, 0x90, 0x8d, 0x8b, 0x88, 0x86, 0x81, 0x79, 0x6f, 0x68, 0x66,
-  0x6a, 0x72, 0x79, 0x7d, 0x7e, 0x7f, 0x80, 0x83, 0x85, 0x86, 0x88, 0x89,
-  0x87, 0x85, 0x85, 0x85, 0x86, 0x85, 0x84, 0x83, 0x84, 0x84, 0x85, 0x85,
-  0x86, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x85, 0x84, 0x84,
-  0x82, 0x80, 0x7f, 0x7e, 0x7d, 0x7a, 0x7d, 0x87, 0x8d, 0x91, 0x84, 0x64,
-  0x47, 0x34, 0x2d, 0x31, 0x53, 0x67, 0x78, 0x84, 0x8a, 0x6b, 0x4e, 0x47,
-  0x53, 0x6d, 0x5e, 0x3a, 0x2e, 0x2c, 0x30, 0x3a, 0x48, 0x4d, 0x50, 0x56,
-  0x65, 0x73, 0x73, 0x71, 0x69, 0x5d, 0x57, 0x54, 0x53, 0x50, 0x4f, 0x4c,
-  0x4a, 0x49, 0x47, 0x3f, 0x38, 0x34, 0x2f, 0x25, 0x1b, 0x16, 0x16, 0x17,
-  0x17, 0x16, 0x14, 0x16, 0x19, 0x1f, 0x2d, 0x34, 0x34, 0x32, 0x30, 0x3d,
-  0x56, 0x63, 0x65, 0x61, 0x5a, 0x52, 0x56, 0x6e, 0x7a, 0x78, 0x67, 0x64,
-  0x6b, 0x71, 0x78, 0x86, 0x9c, 0xa8, 0xac, 0xb0, 0xb4, 0xb5, 0xb4, 0xb2,
-  0xb1, 0xb2, 0xaa, 0xa1, 0x97, 0x83, 0x72, 0x6c, 0x6d, 0x68, 0x56, 0x47,
-  0x45, 0x47, 0x48, 0x49, 0x4a, 0x4a, 0x49, 0x4a, 0x4b, 0x4d, 0x4d, 0x4f,
-  0x4f, 0x4f, 0x50, 0x50, 0x52, 0x53, 0x53, 0x53, 0x53, 0x55, 0x56, 0x57,
-  0x56, 0x57, 0x59, 0x5b, 0x5c, 0x5e, 0x5e, 0x60, 0x60, 0x60, 0x61, 0x62,
-  0x63, 0x64, 0x65, 0x64, 0x67, 0x69, 0x6a, 0x6b, 0x6b, 0x6b, 0x6c, 0x6f,
-  0x70, 0x71, 0x71, 0x70, 0x71, 0x72, 0x74, 0x75, 0x75, 0x75, 0x74, 0x72,
-  0x6e, 0x6b, 0x69, 0x67, 0x63, 0x60, 0x5b, 0x55, 0x52, 0x4e, 0x46, 0x40,
-  0x3d, 0x3a, 0x33, 0x29, 0x1e, 0x18, 0x15, 0x13, 0x11, 0x10, 0x10, 0x10,
-  0x10, 0x11, 0x11, 0x12, 0x13, 0x12, 0x13, 0x12, 0x11, 0x11, 0x11, 0x12,
-  0x59, 0x5b, 0x5c, 0x5c, 0x5c, 0x5d, 0x5f, 0x60, 0x61, 0x61, 0x62, 0x61,
-  0x62, 0x63, 0x64, 0x65, 0x66, 0x65, 0x64, 0x64, 0x65, 0x64, 0x64, 0x65,
-  0x65, 0x64, 0x63, 0x62, 0x63, 0x64, 0x64, 0x63, 0x64, 0x65, 0x65, 0x65,
-  0x67, 0x69, 0x69, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6b, 0x6c, 0x6b,
-  0x6a, 0x68, 0x67, 0x64, 0x61, 0x5f, 0x5f, 0x5e, 0x63, 0x69, 0x6e, 0x76,
-  0x7c, 0x81, 0x84, 0x86, 0x87, 0x8b, 0x8d, 0x91, 0x92, 0x93, 0x92, 0x8e,
-  0x8c, 0x89, 0x87, 0x83, 0x7b, 0x71, 0x6a, 0x69, 0x6b, 0x72, 0x79, 0x7c,
-  0x7d, 0x7e, 0x80, 0x82, 0x84, 0x86, 0x88, 0x89, 0x88, 0x86, 0x86, 0x86,
-  0x86, 0x85, 0x84, 0x83, 0x84, 0x84, 0x85, 0x85, 0x86, 0x87, 0x87, 0x88,
-  0x88, 0x88, 0x87, 0x87, 0x87, 0x85, 0x84, 0x84, 0x82, 0x81, 0x80, 0x7f,
-  0x7c, 0x7b, 0x80, 0x8a, 0x90, 0x93, 0x88, 0x69, 0x48, 0x2f, 0x28, 0x34,
-  0x61, 0x78, 0x85, 0x8b, 0x8d, 0x7b, 0x63, 0x54, 0x57, 0x63, 0x4f, 0x36,
-  0x38, 0x3c, 0x3f, 0x40, 0x46, 0x48, 0x48, 0x49, 0x55, 0x63, 0x5f, 0x59,
-  0x51, 0x4b, 0x49, 0x47, 0x46, 0x45, 0x45, 0x48, 0x49, 0x48, 0x44, 0x38,
-  0x2c, 0x26, 0x22, 0x1a, 0x14, 0x13, 0x15, 0x16, 0x15, 0x14, 0x14, 0x17,
-  0x1a, 0x1f, 0x26, 0x2f, 0x33, 0x33, 0x32, 0x3e, 0x55, 0x5f, 0x61, 0x5e,
-  0x5a, 0x52, 0x57, 0x6e, 0x78, 0x75, 0x61, 0x5d, 0x65, 0x70, 0x82, 0x95,
-  0xa7, 0xb2, 0xb4, 0xb2, 0xb5, 0xba, 0xb9, 0xb7, 0xb3, 0xb1, 0xa7, 0x98,
-  0x88, 0x6d, 0x5f, 0x5d, 0x62, 0x63, 0x5c, 0x4a, 0x46, 0x47, 0x48, 0x49,
-  0x4a, 0x4a, 0x4a, 0x4a, 0x4c, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e, 0x50, 0x50,
-  0x51, 0x53, 0x53, 0x53, 0x53, 0x55, 0x56, 0x56, 0x58, 0x58, 0x59, 0x5a,
-  0x5b, 0x5e, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x63, 0x64, 0x65, 0x65, 0x64,
-  0x67, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x70,
-  0x71, 0x71, 0x74, 0x75, 0x75, 0x74, 0x73, 0x72, 0x6e, 0x6b, 0x6a, 0x67,
-  0x63, 0x60, 0x5b, 0x56, 0x52, 0x4e, 0x46, 0x40, 0x3b, 0x38, 0x31, 0x28,
-  0x1e, 0x18, 0x14, 0x12, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x12, 0x11, 0x58, 0x5b, 0x5b, 0x5c,
-  0x5c, 0x5d, 0x5f, 0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x64, 0x65, 0x66,
-  0x66, 0x66, 0x65, 0x65, 0x66, 0x65, 0x65, 0x65, 0x66, 0x65, 0x62, 0x62,
-  0x63, 0x64, 0x64, 0x63, 0x64, 0x64, 0x64, 0x65, 0x67, 0x68, 0x68, 0x69,
-  0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x69, 0x67, 0x64,
-  0x61, 0x60, 0x60, 0x5f, 0x64, 0x6c, 0x71, 0x78, 0x7e, 0x82, 0x86, 0x87,
-  0x88, 0x8c, 0x8e, 0x92, 0x93, 0x93, 0x93, 0x8f, 0x8c, 0x8a, 0x87, 0x83,
-  0x7c, 0x73, 0x6d, 0x6b, 0x6c, 0x72, 0x78, 0x7b, 0x7c, 0x7d, 0x7f, 0x82,
-  0x84, 0x86, 0x88, 0x89, 0x88, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83,
-  0x84, 0x84, 0x86, 0x85, 0x86, 0x87, 0x87, 0x87, 0x88, 0x88, 0x87, 0x87,
-  0x87, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x81, 0x8b,
-  0x91, 0x95, 0x8a, 0x6e, 0x4c, 0x30, 0x29, 0x39, 0x6b, 0x83, 0x8c, 0x92,
-  0x94, 0x86, 0x6d, 0x5a, 0x57, 0x59, 0x45, 0x35, 0x40, 0x48, 0x4b, 0x49,
-  0x4b, 0x4c, 0x4c, 0x4a, 0x54, 0x60, 0x59, 0x51, 0x46, 0x3d, 0x39, 0x37,
-  0x36, 0x36, 0x38, 0x3c, 0x40, 0x3f, 0x3a, 0x2e, 0x23, 0x1e, 0x1a, 0x15,
-  0x12, 0x13, 0x15, 0x16, 0x15, 0x14, 0x15, 0x19, 0x1b, 0x20, 0x26, 0x2e,
-  0x33, 0x34, 0x32, 0x3e, 0x54, 0x5d, 0x5e, 0x5a, 0x59, 0x51, 0x55, 0x6d,
-  0x78, 0x75, 0x5f, 0x5a, 0x67, 0x74, 0x89, 0x9b, 0xaa, 0xb5, 0xb7, 0xb4,
-  0xb7, 0xbb, 0xbc, 0xbb, 0xb4, 0xad, 0xa1, 0x8e, 0x7c, 0x61, 0x5b, 0x53,
-  0x53, 0x56, 0x58, 0x4b, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4a, 0x4b, 0x4b,
-  0x4d, 0x4e, 0x4d, 0x4f, 0x4f, 0x4f, 0x50, 0x50, 0x52, 0x53, 0x53, 0x53,
-  0x54, 0x55, 0x56, 0x56, 0x58, 0x58, 0x58, 0x59, 0x5a, 0x5d, 0x5f, 0x61,
-  0x62, 0x62, 0x62, 0x63, 0x64, 0x65, 0x65, 0x65, 0x67, 0x69, 0x6a, 0x6b,
-  0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x70, 0x71, 0x72, 0x74, 0x75,
-  0x75, 0x74, 0x73, 0x71, 0x6e, 0x6c, 0x6a, 0x68, 0x63, 0x60, 0x5b, 0x56,
-  0x52, 0x4d, 0x46, 0x41, 0x3a, 0x37, 0x31, 0x28, 0x1e, 0x18, 0x14, 0x12,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x11,
-  0x11, 0x11, 0x12, 0x12, 0x58, 0x5a, 0x5c, 0x5c, 0x5d, 0x5d, 0x60, 0x61,
-  0x61, 0x62, 0x63, 0x63, 0x64, 0x64, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x68, 0x68, 0x68, 0x67, 0x65, 0x65, 0x63, 0x62, 0x63, 0x64, 0x64, 0x64,
-  0x63, 0x63, 0x63, 0x65, 0x65, 0x67, 0x67, 0x68, 0x6a, 0x6a, 0x6b, 0x6b,
-  0x6b, 0x6c, 0x6c, 0x6c, 0x6b, 0x69, 0x67, 0x65, 0x62, 0x61, 0x61, 0x61,
-  0x67, 0x70, 0x75, 0x7b, 0x80, 0x85, 0x88, 0x8a, 0x8c, 0x8d, 0x8f, 0x92,
-  0x94, 0x94, 0x94, 0x91, 0x8e, 0x8a, 0x87, 0x84, 0x7e, 0x75, 0x70, 0x6f,
-  0x6e, 0x72, 0x77, 0x79, 0x7a, 0x7b, 0x7e, 0x81, 0x83, 0x85, 0x88, 0x8a,
-  0x8a, 0x89, 0x88, 0x87, 0x86, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x87, 0x86, 0x85, 0x87, 0x87, 0x86, 0x86, 0x85, 0x86, 0x86, 0x86,
-  0x83, 0x81, 0x80, 0x7f, 0x7c, 0x7e, 0x83, 0x8c, 0x92, 0x96, 0x8e, 0x75,
-  0x53, 0x36, 0x30, 0x43, 0x77, 0x8b, 0x8f, 0x95, 0x9f, 0x96, 0x78, 0x60,
-  0x56, 0x4c, 0x3a, 0x3b, 0x4f, 0x59, 0x5c, 0x5b, 0x5d, 0x5e, 0x5c, 0x59,
-  0x5d, 0x62, 0x59, 0x50, 0x41, 0x2d, 0x1f, 0x1c, 0x1c, 0x1d, 0x1f, 0x23,
-  0x28, 0x28, 0x23, 0x1c, 0x16, 0x15, 0x14, 0x14, 0x13, 0x14, 0x15, 0x15,
-  0x15, 0x15, 0x17, 0x1b, 0x1f, 0x24, 0x2a, 0x30, 0x34, 0x35, 0x34, 0x40,
-  0x53, 0x5a, 0x59, 0x52, 0x52, 0x4f, 0x52, 0x6a, 0x76, 0x75, 0x5f, 0x5e,
-  0x72, 0x82, 0x94, 0xa0, 0xae, 0xb7, 0xb9, 0xba, 0xbe, 0xbd, 0xc3, 0xc1,
-  0xb5, 0xa5, 0x92, 0x7b, 0x6a, 0x5a, 0x5b, 0x46, 0x3e, 0x42, 0x4e, 0x4b,
-  0x47, 0x48, 0x49, 0x49, 0x4a, 0x4b, 0x4c, 0x4c, 0x4c, 0x4e, 0x4e, 0x50,
-  0x50, 0x50, 0x52, 0x52, 0x53, 0x53, 0x53, 0x56, 0x56, 0x56, 0x57, 0x58,
-  0x59, 0x58, 0x59, 0x59, 0x5a, 0x5d, 0x5e, 0x61, 0x62, 0x62, 0x62, 0x64,
-  0x63, 0x65, 0x65, 0x66, 0x67, 0x69, 0x6a, 0x6b, 0x6c, 0x6e, 0x6e, 0x6f,
-  0x71, 0x71, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74, 0x74, 0x73, 0x72, 0x70,
-  0x6e, 0x6b, 0x6a, 0x68, 0x65, 0x5f, 0x5a, 0x55, 0x50, 0x4c, 0x48, 0x41,
-  0x3a, 0x37, 0x31, 0x29, 0x20, 0x18, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x12, 0x11, 0x12, 0x12, 0x11, 0x13, 0x12, 0x12, 0x12, 0x11, 0x13,
-  0x59, 0x5b, 0x5b, 0x5c, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x62, 0x63, 0x64,
-  0x64, 0x65, 0x67, 0x68, 0x67, 0x66, 0x67, 0x68, 0x69, 0x69, 0x69, 0x69,
-  0x68, 0x66, 0x64, 0x63, 0x62, 0x63, 0x64, 0x64, 0x63, 0x63, 0x63, 0x65,
-  0x66, 0x66, 0x67, 0x68, 0x6a, 0x6b, 0x6c, 0x6c, 0x6c, 0x6b, 0x6c, 0x6c,
-  0x6b, 0x69, 0x67, 0x65, 0x64, 0x63, 0x63, 0x64, 0x6b, 0x73, 0x78, 0x7e,
-  0x84, 0x88, 0x8b, 0x8c, 0x8e, 0x90, 0x91, 0x94, 0x95, 0x96, 0x96, 0x93,
-  0x8f, 0x8c, 0x89, 0x87, 0x80, 0x79, 0x75, 0x74, 0x73, 0x73, 0x74, 0x76,
-  0x77, 0x78, 0x7a, 0x7f, 0x82, 0x85, 0x87, 0x89, 0x8a, 0x89, 0x89, 0x8a,
-  0x88, 0x86, 0x86, 0x85, 0x86, 0x86, 0x86, 0x85, 0x86, 0x87, 0x86, 0x85,
-  0x87, 0x87, 0x87, 0x86, 0x86, 0x87, 0x86, 0x86, 0x83, 0x82, 0x81, 0x7f,
-  0x7e, 0x82, 0x88, 0x90, 0x96, 0x99, 0x94, 0x80, 0x5e, 0x42, 0x3d, 0x52,
-  0x81, 0x8a, 0x86, 0x8e, 0xa6, 0xad, 0x88, 0x69, 0x59, 0x49, 0x3d, 0x4e,
-  0x65, 0x71, 0x7a, 0x79, 0x75, 0x74, 0x73, 0x6e, 0x69, 0x60, 0x58, 0x52,
-  0x46, 0x2d, 0x18, 0x12, 0x11, 0x13, 0x14, 0x14, 0x16, 0x17, 0x16, 0x15,
-  0x14, 0x15, 0x16, 0x17, 0x17, 0x19, 0x1b, 0x1a, 0x19, 0x19, 0x1c, 0x20,
-  0x24, 0x29, 0x2e, 0x34, 0x37, 0x38, 0x3b, 0x4a, 0x56, 0x58, 0x56, 0x51,
-  0x50, 0x4f, 0x54, 0x69, 0x74, 0x76, 0x67, 0x6f, 0x85, 0x92, 0x9c, 0xa7,
-  0xb3, 0xb6, 0xba, 0xc2, 0xc6, 0xc7, 0xca, 0xc4, 0xb1, 0x97, 0x79, 0x63,
-  0x5d, 0x5a, 0x44, 0x3f, 0x55, 0x61, 0x62, 0x57, 0x4f, 0x4d, 0x4c, 0x4d,
-  0x4d, 0x4d, 0x4e, 0x4d, 0x4d, 0x4f, 0x4f, 0x50, 0x50, 0x51, 0x53, 0x53,
-  0x54, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x58, 0x5a, 0x5a, 0x5b, 0x5b,
-  0x5c, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x63, 0x65, 0x65, 0x66, 0x67, 0x68,
-  0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x71, 0x72,
-  0x72, 0x73, 0x74, 0x74, 0x74, 0x73, 0x72, 0x70, 0x6e, 0x6b, 0x6a, 0x68,
-  0x65, 0x5f, 0x5a, 0x54, 0x50, 0x4b, 0x47, 0x41, 0x3c, 0x38, 0x32, 0x2a,
-  0x20, 0x17, 0x13, 0x11, 0x10, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x12,
-  0x12, 0x11, 0x13, 0x12, 0x11, 0x12, 0x13, 0x12, 0x59, 0x5c, 0x5c, 0x5c,
-  0x5e, 0x5f, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x63, 0x64, 0x65, 0x67, 0x68,
-  0x66, 0x66, 0x67, 0x69, 0x69, 0x68, 0x68, 0x68, 0x68, 0x67, 0x66, 0x64,
-  0x63, 0x63, 0x64, 0x64, 0x63, 0x63, 0x64, 0x65, 0x65, 0x67, 0x68, 0x69,
-  0x6a, 0x6a, 0x6c, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x6b, 0x6a, 0x68, 0x66,
-  0x65, 0x64, 0x64, 0x67, 0x6e, 0x75, 0x7a, 0x81, 0x86, 0x8a, 0x8c, 0x8e,
-  0x90, 0x92, 0x92, 0x95, 0x97, 0x97, 0x96, 0x94, 0x90, 0x8d, 0x8b, 0x88,
-  0x82, 0x7c, 0x78, 0x77, 0x76, 0x74, 0x74, 0x74, 0x74, 0x75, 0x78, 0x7c,
-  0x81, 0x83, 0x85, 0x89, 0x8a, 0x89, 0x8a, 0x8b, 0x8b, 0x88, 0x87, 0x87,
-  0x85, 0x84, 0x86, 0x86, 0x86, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87,
-  0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x82, 0x84, 0x8b, 0x91, 0x97,
-  0x9b, 0x9e, 0x9a, 0x88, 0x6a, 0x52, 0x50, 0x64, 0x88, 0x88, 0x84, 0x8d,
-  0xa8, 0xba, 0x99, 0x7f, 0x74, 0x6a, 0x61, 0x71, 0x84, 0x92, 0xa1, 0x95,
-  0x7a, 0x71, 0x6d, 0x69, 0x60, 0x53, 0x53, 0x54, 0x50, 0x36, 0x1d, 0x14,
-  0x15, 0x1b, 0x21, 0x20, 0x20, 0x20, 0x20, 0x21, 0x20, 0x21, 0x21, 0x21,
-  0x23, 0x24, 0x25, 0x24, 0x22, 0x21, 0x23, 0x25, 0x27, 0x2b, 0x30, 0x34,
-  0x38, 0x3c, 0x47, 0x5b, 0x62, 0x5c, 0x5b, 0x5d, 0x5c, 0x59, 0x60, 0x72,
-  0x79, 0x77, 0x74, 0x81, 0x91, 0x9a, 0xa2, 0xaf, 0xb9, 0xbb, 0xc0, 0xca,
-  0xd1, 0xd3, 0xca, 0xbd, 0xa4, 0x86, 0x70, 0x65, 0x5d, 0x49, 0x3a, 0x5e,
-  0x81, 0x8b, 0x81, 0x64, 0x58, 0x4e, 0x4d, 0x53, 0x54, 0x53, 0x52, 0x50,
-  0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x52, 0x54, 0x55, 0x55, 0x56, 0x56,
-  0x56, 0x56, 0x56, 0x58, 0x5a, 0x5a, 0x5c, 0x5c, 0x5c, 0x5e, 0x5e, 0x60,
-  0x61, 0x62, 0x63, 0x65, 0x66, 0x66, 0x67, 0x68, 0x6a, 0x6b, 0x6d, 0x6e,
-  0x6e, 0x70, 0x71, 0x71, 0x71, 0x70, 0x71, 0x73, 0x73, 0x73, 0x73, 0x74,
-  0x74, 0x74, 0x74, 0x72, 0x6f, 0x6b, 0x6a, 0x68, 0x64, 0x5e, 0x5a, 0x55,
-  0x51, 0x4c, 0x46, 0x40, 0x3c, 0x38, 0x32, 0x2a, 0x20, 0x17, 0x13, 0x11,
-  0x10, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13,
-  0x12, 0x12, 0x13, 0x14, 0x59, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x5f, 0x60,
-  0x61, 0x62, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x67, 0x67, 0x68, 0x69,
-  0x69, 0x68, 0x67, 0x67, 0x67, 0x67, 0x67, 0x64, 0x64, 0x63, 0x63, 0x63,
-  0x63, 0x64, 0x64, 0x65, 0x65, 0x67, 0x68, 0x6a, 0x6b, 0x6a, 0x6b, 0x6c,
-  0x6c, 0x6d, 0x6d, 0x6c, 0x6c, 0x6b, 0x68, 0x68, 0x66, 0x65, 0x65, 0x69,
-  0x70, 0x78, 0x7c, 0x82, 0x87, 0x8a, 0x8c, 0x8e, 0x91, 0x93, 0x94, 0x96,
-  0x97, 0x97, 0x96, 0x94, 0x90, 0x8e, 0x8d, 0x8a, 0x84, 0x7f, 0x7b, 0x78,
-  0x77, 0x76, 0x74, 0x74, 0x73, 0x73, 0x75, 0x7a, 0x7e, 0x81, 0x84, 0x87,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x86, 0x84, 0x86, 0x87,
-  0x87, 0x88, 0x87, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86,
-  0x84, 0x83, 0x85, 0x88, 0x8e, 0x95, 0x9a, 0x9e, 0xa0, 0xa1, 0x9c, 0x8f,
-  0x76, 0x65, 0x65, 0x77, 0x90, 0x8b, 0x89, 0x8f, 0xa5, 0xb4, 0x97, 0x8b,
-  0x8f, 0x9c, 0x90, 0x85, 0x92, 0xa3, 0xb5, 0x9d, 0x6e, 0x5f, 0x5b, 0x57,
-  0x4e, 0x4a, 0x55, 0x5b, 0x59, 0x3f, 0x24, 0x1c, 0x20, 0x2c, 0x35, 0x33,
-  0x32, 0x32, 0x31, 0x30, 0x2e, 0x2d, 0x2d, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e,
-  0x2c, 0x29, 0x28, 0x2a, 0x2a, 0x2d, 0x2f, 0x33, 0x37, 0x3e, 0x4e, 0x65,
-  0x67, 0x61, 0x5f, 0x63, 0x63, 0x5b, 0x63, 0x71, 0x77, 0x76, 0x7a, 0x88,
-  0x94, 0x9b, 0xa6, 0xb5, 0xbd, 0xbf, 0xc3, 0xcc, 0xd6, 0xd3, 0xc8, 0xb9,
-  0x99, 0x7a, 0x75, 0x70, 0x5e, 0x3c, 0x47, 0x71, 0x96, 0x9a, 0x7e, 0x58,
-  0x4f, 0x4a, 0x4d, 0x58, 0x5c, 0x59, 0x58, 0x57, 0x54, 0x51, 0x50, 0x50,
-  0x51, 0x51, 0x51, 0x53, 0x54, 0x54, 0x55, 0x54, 0x56, 0x56, 0x57, 0x58,
-  0x59, 0x5a, 0x5b, 0x5c, 0x5c, 0x5f, 0x5e, 0x60, 0x61, 0x61, 0x62, 0x65,
-  0x65, 0x66, 0x67, 0x68, 0x69, 0x6c, 0x6e, 0x6e, 0x6e, 0x6f, 0x71, 0x70,
-  0x70, 0x70, 0x72, 0x73, 0x72, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x72,
-  0x6f, 0x6b, 0x69, 0x68, 0x64, 0x5f, 0x58, 0x54, 0x51, 0x4c, 0x46, 0x40,
-  0x3c, 0x38, 0x32, 0x2b, 0x21, 0x18, 0x14, 0x11, 0x10, 0x11, 0x10, 0x11,
-  0x12, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12, 0x13, 0x12, 0x11, 0x12, 0x13,
-  0x58, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x5f, 0x60, 0x61, 0x62, 0x62, 0x64,
-  0x64, 0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x69, 0x69, 0x68, 0x67, 0x67,
-  0x67, 0x67, 0x67, 0x65, 0x64, 0x64, 0x64, 0x63, 0x63, 0x64, 0x64, 0x65,
-  0x65, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x6c, 0x6c, 0x6e, 0x6d, 0x6c,
-  0x6b, 0x6a, 0x68, 0x68, 0x67, 0x66, 0x65, 0x6a, 0x72, 0x7a, 0x7e, 0x83,
-  0x87, 0x8a, 0x8d, 0x8f, 0x91, 0x93, 0x94, 0x96, 0x97, 0x97, 0x96, 0x94,
-  0x90, 0x8f, 0x8e, 0x8c, 0x86, 0x81, 0x7d, 0x7a, 0x79, 0x78, 0x75, 0x73,
-  0x72, 0x72, 0x74, 0x79, 0x7d, 0x7f, 0x83, 0x86, 0x88, 0x8a, 0x8b, 0x8c,
-  0x8c, 0x8a, 0x89, 0x88, 0x86, 0x84, 0x85, 0x87, 0x87, 0x87, 0x87, 0x86,
-  0x86, 0x86, 0x87, 0x88, 0x87, 0x87, 0x86, 0x85, 0x85, 0x8b, 0x93, 0x98,
-  0x9f, 0xa3, 0xa4, 0xa6, 0xa6, 0xa5, 0xa0, 0x96, 0x85, 0x78, 0x78, 0x85,
-  0x97, 0x91, 0x8d, 0x91, 0xa1, 0xad, 0x91, 0x89, 0x95, 0xb2, 0xaa, 0x8b,
-  0x8f, 0x9f, 0xb5, 0x9d, 0x69, 0x58, 0x54, 0x4e, 0x44, 0x45, 0x56, 0x5f,
-  0x5d, 0x44, 0x2c, 0x27, 0x2b, 0x38, 0x40, 0x3f, 0x3e, 0x3e, 0x3c, 0x3a,
-  0x38, 0x36, 0x35, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32, 0x2f, 0x2d, 0x2d,
-  0x2e, 0x2f, 0x31, 0x34, 0x38, 0x3e, 0x4f, 0x65, 0x67, 0x61, 0x61, 0x67,
-  0x69, 0x5f, 0x65, 0x70, 0x74, 0x75, 0x7c, 0x8c, 0x97, 0x9e, 0xa9, 0xb8,
-  0xbe, 0xc1, 0xc4, 0xcd, 0xd6, 0xcf, 0xc4, 0xb4, 0x92, 0x74, 0x74, 0x6e,
-  0x5a, 0x3b, 0x51, 0x71, 0x8d, 0x8c, 0x6d, 0x52, 0x55, 0x55, 0x56, 0x5c,
-  0x61, 0x5f, 0x5d, 0x5b, 0x57, 0x53, 0x50, 0x50, 0x50, 0x51, 0x51, 0x53,
-  0x53, 0x53, 0x54, 0x54, 0x56, 0x57, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5b,
-  0x5c, 0x5f, 0x5e, 0x60, 0x60, 0x61, 0x62, 0x65, 0x66, 0x67, 0x67, 0x67,
-  0x69, 0x6c, 0x6e, 0x6e, 0x6d, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x72, 0x73,
-  0x73, 0x72, 0x72, 0x73, 0x74, 0x74, 0x73, 0x71, 0x6f, 0x6b, 0x69, 0x68,
-  0x64, 0x5f, 0x58, 0x54, 0x51, 0x4c, 0x46, 0x40, 0x3b, 0x37, 0x32, 0x2a,
-  0x20, 0x18, 0x14, 0x11, 0x10, 0x10, 0x11, 0x11, 0x12, 0x10, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x13, 0x12, 0x11, 0x11, 0x12, 0x57, 0x59, 0x5c, 0x5d,
-  0x5e, 0x5f, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x63, 0x64, 0x65, 0x66, 0x66,
-  0x66, 0x67, 0x68, 0x69, 0x69, 0x68, 0x68, 0x68, 0x67, 0x68, 0x67, 0x66,
-  0x65, 0x65, 0x63, 0x63, 0x64, 0x64, 0x64, 0x65, 0x66, 0x67, 0x68, 0x68,
-  0x69, 0x69, 0x6b, 0x6b, 0x6b, 0x6d, 0x6d, 0x6c, 0x6b, 0x6a, 0x68, 0x68,
-  0x68, 0x67, 0x66, 0x6b, 0x74, 0x7b, 0x7f, 0x83, 0x88, 0x8a, 0x8e, 0x90,
-  0x92, 0x94, 0x95, 0x97, 0x98, 0x97, 0x96, 0x94, 0x91, 0x90, 0x8f, 0x8d,
-  0x88, 0x82, 0x7f, 0x7e, 0x7b, 0x7a, 0x76, 0x74, 0x72, 0x70, 0x71, 0x76,
-  0x7a, 0x7d, 0x80, 0x85, 0x87, 0x8a, 0x8b, 0x8c, 0x8c, 0x8b, 0x8a, 0x88,
-  0x85, 0x83, 0x84, 0x86, 0x86, 0x86, 0x87, 0x86, 0x87, 0x88, 0x87, 0x87,
-  0x88, 0x87, 0x86, 0x86, 0x90, 0xa3, 0xb5, 0xbc, 0xc0, 0xbd, 0xb8, 0xb4,
-  0xb1, 0xae, 0xa9, 0xa4, 0xa0, 0x98, 0x94, 0x95, 0x9d, 0x97, 0x91, 0x91,
-  0x99, 0xa6, 0x8d, 0x7c, 0x8b, 0xb8, 0xbe, 0x94, 0x80, 0x88, 0xa2, 0x97,
-  0x6c, 0x5a, 0x53, 0x49, 0x3d, 0x43, 0x58, 0x61, 0x60, 0x4f, 0x3f, 0x3c,
-  0x3f, 0x49, 0x4e, 0x4c, 0x4b, 0x4a, 0x48, 0x45, 0x43, 0x40, 0x3f, 0x3d,
-  0x3c, 0x3c, 0x3d, 0x3c, 0x3a, 0x35, 0x34, 0x33, 0x33, 0x33, 0x35, 0x37,
-  0x39, 0x3c, 0x49, 0x5e, 0x62, 0x5e, 0x60, 0x6a, 0x71, 0x69, 0x69, 0x6f,
-  0x71, 0x75, 0x81, 0x94, 0x9d, 0xa4, 0xaf, 0xba, 0xc1, 0xc4, 0xc7, 0xce,
-  0xd3, 0xc9, 0xbc, 0xaa, 0x87, 0x74, 0x6c, 0x5a, 0x4b, 0x42, 0x62, 0x6f,
-  0x76, 0x6e, 0x55, 0x5c, 0x74, 0x77, 0x70, 0x63, 0x66, 0x68, 0x64, 0x61,
-  0x5c, 0x56, 0x51, 0x50, 0x50, 0x51, 0x51, 0x53, 0x53, 0x54, 0x54, 0x54,
-  0x56, 0x56, 0x57, 0x58, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5e, 0x5e, 0x60,
-  0x60, 0x61, 0x62, 0x65, 0x67, 0x68, 0x68, 0x68, 0x6a, 0x6b, 0x6d, 0x6e,
-  0x6d, 0x6e, 0x70, 0x70, 0x6f, 0x6f, 0x71, 0x72, 0x72, 0x72, 0x72, 0x74,
-  0x73, 0x73, 0x72, 0x70, 0x6f, 0x6b, 0x69, 0x68, 0x64, 0x5f, 0x58, 0x54,
-  0x51, 0x4c, 0x46, 0x40, 0x3b, 0x37, 0x31, 0x29, 0x1e, 0x18, 0x14, 0x11,
-  0x10, 0x10, 0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x13,
-  0x12, 0x11, 0x12, 0x11, 0x57, 0x59, 0x5b, 0x5c, 0x5d, 0x5e, 0x5e, 0x5f,
-  0x60, 0x61, 0x61, 0x63, 0x64, 0x65, 0x67, 0x67, 0x67, 0x69, 0x69, 0x6a,
-  0x6a, 0x69, 0x69, 0x69, 0x67, 0x67, 0x66, 0x65, 0x65, 0x66, 0x65, 0x63,
-  0x63, 0x63, 0x66, 0x66, 0x66, 0x67, 0x68, 0x68, 0x69, 0x6b, 0x6a, 0x6b,
-  0x6c, 0x6d, 0x6d, 0x6b, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x68, 0x68, 0x6e,
-  0x77, 0x7d, 0x80, 0x84, 0x89, 0x8d, 0x8f, 0x90, 0x93, 0x95, 0x95, 0x97,
-  0x97, 0x97, 0x97, 0x95, 0x93, 0x93, 0x92, 0x8f, 0x8a, 0x86, 0x83, 0x81,
-  0x7e, 0x7b, 0x79, 0x75, 0x73, 0x70, 0x6d, 0x72, 0x78, 0x7b, 0x7e, 0x82,
-  0x87, 0x89, 0x8a, 0x8a, 0x8b, 0x8c, 0x8b, 0x8a, 0x88, 0x84, 0x83, 0x85,
-  0x86, 0x87, 0x86, 0x86, 0x87, 0x88, 0x87, 0x87, 0x87, 0x86, 0x8a, 0x99,
-  0xb8, 0xca, 0xd0, 0xd2, 0xd1, 0xd1, 0xce, 0xc8, 0xc2, 0xbb, 0xb5, 0xaf,
-  0xac, 0xa8, 0xa6, 0xa2, 0x9b, 0x95, 0x90, 0x8f, 0x95, 0xb0, 0x9e, 0x78,
-  0x79, 0xa5, 0xca, 0xb5, 0x8a, 0x7a, 0x80, 0x8f, 0x7b, 0x60, 0x53, 0x4a,
-  0x43, 0x4c, 0x5d, 0x63, 0x63, 0x5b, 0x55, 0x54, 0x55, 0x59, 0x5b, 0x58,
-  0x58, 0x57, 0x54, 0x51, 0x4e, 0x4b, 0x49, 0x46, 0x44, 0x44, 0x48, 0x48,
-  0x44, 0x3e, 0x3b, 0x3a, 0x39, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x41, 0x4f,
-  0x57, 0x58, 0x5c, 0x65, 0x70, 0x71, 0x70, 0x72, 0x75, 0x7e, 0x8d, 0x9d,
-  0xa7, 0xab, 0xb3, 0xbd, 0xc3, 0xc7, 0xcb, 0xce, 0xd2, 0xc3, 0xac, 0x98,
-  0x80, 0x89, 0x70, 0x3e, 0x31, 0x4a, 0x7c, 0x92, 0x8b, 0x81, 0x77, 0x88,
-  0x92, 0x8d, 0x82, 0x6e, 0x66, 0x71, 0x70, 0x6c, 0x65, 0x5b, 0x54, 0x51,
-  0x50, 0x51, 0x51, 0x52, 0x54, 0x55, 0x56, 0x56, 0x57, 0x58, 0x58, 0x59,
-  0x5a, 0x5c, 0x5c, 0x5c, 0x5e, 0x60, 0x60, 0x61, 0x61, 0x63, 0x64, 0x65,
-  0x68, 0x69, 0x69, 0x69, 0x6b, 0x6c, 0x6e, 0x6f, 0x6f, 0x70, 0x70, 0x70,
-  0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x72, 0x73, 0x73, 0x72, 0x70, 0x6f,
-  0x6d, 0x6a, 0x69, 0x68, 0x64, 0x5e, 0x56, 0x52, 0x50, 0x4c, 0x46, 0x40,
-  0x3a, 0x37, 0x33, 0x2b, 0x1e, 0x16, 0x13, 0x12, 0x12, 0x11, 0x11, 0x11,
-  0x10, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x13, 0x12, 0x11, 0x12,
-  0x59, 0x5b, 0x5c, 0x5c, 0x5c, 0x5e, 0x5e, 0x60, 0x60, 0x61, 0x60, 0x63,
-  0x64, 0x65, 0x66, 0x66, 0x68, 0x69, 0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a,
-  0x69, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x64, 0x64, 0x65, 0x66, 0x66,
-  0x66, 0x67, 0x68, 0x68, 0x6a, 0x6b, 0x6a, 0x6b, 0x6d, 0x6e, 0x6d, 0x6b,
-  0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6a, 0x6b, 0x70, 0x79, 0x7e, 0x81, 0x85,
-  0x89, 0x8d, 0x8e, 0x8f, 0x93, 0x95, 0x95, 0x98, 0x98, 0x98, 0x98, 0x96,
-  0x95, 0x95, 0x94, 0x90, 0x8b, 0x88, 0x84, 0x82, 0x80, 0x7d, 0x7b, 0x78,
-  0x76, 0x72, 0x6f, 0x72, 0x75, 0x78, 0x7b, 0x80, 0x85, 0x88, 0x89, 0x8a,
-  0x8b, 0x8c, 0x8b, 0x8a, 0x8a, 0x86, 0x84, 0x83, 0x84, 0x85, 0x86, 0x86,
-  0x88, 0x88, 0x87, 0x87, 0x88, 0x93, 0xa3, 0xbe, 0xce, 0xd1, 0xd1, 0xd0,
-  0xd1, 0xd3, 0xd6, 0xdb, 0xd9, 0xd1, 0xc2, 0xb8, 0xb2, 0xaf, 0xab, 0xa5,
-  0xa0, 0x93, 0x8b, 0x88, 0x8c, 0xad, 0xaf, 0x88, 0x78, 0x86, 0xbe, 0xc9,
-  0xad, 0x96, 0x81, 0x83, 0x7a, 0x67, 0x5f, 0x5d, 0x5f, 0x64, 0x68, 0x68,
-  0x64, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x61, 0x60, 0x5f, 0x5e, 0x5c, 0x5a,
-  0x57, 0x54, 0x51, 0x4f, 0x4c, 0x4c, 0x50, 0x51, 0x4c, 0x48, 0x45, 0x43,
-  0x40, 0x3f, 0x3f, 0x3f, 0x40, 0x41, 0x41, 0x46, 0x4d, 0x50, 0x51, 0x54,
-  0x60, 0x6e, 0x75, 0x7b, 0x80, 0x89, 0x96, 0xa2, 0xac, 0xb3, 0xba, 0xc0,
-  0xc4, 0xc9, 0xcb, 0xcd, 0xcc, 0xba, 0x9c, 0x8d, 0x89, 0x95, 0x76, 0x49,
-  0x42, 0x5a, 0x70, 0x71, 0x6c, 0x74, 0x8c, 0x93, 0x8b, 0x88, 0x83, 0x74,
-  0x62, 0x72, 0x7a, 0x78, 0x6f, 0x63, 0x5a, 0x54, 0x53, 0x52, 0x52, 0x52,
-  0x54, 0x55, 0x55, 0x57, 0x57, 0x59, 0x5a, 0x5a, 0x5c, 0x5e, 0x5e, 0x5e,
-  0x5f, 0x5f, 0x5f, 0x61, 0x61, 0x62, 0x63, 0x65, 0x67, 0x69, 0x69, 0x69,
-  0x6b, 0x6d, 0x6f, 0x6f, 0x70, 0x70, 0x71, 0x70, 0x70, 0x71, 0x71, 0x70,
-  0x70, 0x71, 0x72, 0x73, 0x73, 0x72, 0x71, 0x6f, 0x6d, 0x6a, 0x69, 0x67,
-  0x63, 0x5d, 0x56, 0x52, 0x50, 0x4c, 0x46, 0x40, 0x3b, 0x38, 0x34, 0x2d,
-  0x1f, 0x18, 0x14, 0x12, 0x11, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11,
-  0x11, 0x13, 0x13, 0x12, 0x13, 0x12, 0x11, 0x12, 0x59, 0x5b, 0x5b, 0x5b,
-  0x5b, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x60, 0x63, 0x64, 0x65, 0x66, 0x68,
-  0x69, 0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x68,
-  0x68, 0x68, 0x67, 0x65, 0x66, 0x66, 0x65, 0x65, 0x65, 0x67, 0x68, 0x68,
-  0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6e, 0x6e, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c,
-  0x6b, 0x6b, 0x6d, 0x72, 0x7a, 0x80, 0x83, 0x86, 0x8a, 0x8d, 0x8f, 0x90,
-  0x93, 0x94, 0x95, 0x98, 0x9a, 0x9a, 0x99, 0x97, 0x97, 0x96, 0x95, 0x92,
-  0x8c, 0x88, 0x87, 0x85, 0x83, 0x80, 0x7e, 0x7a, 0x78, 0x74, 0x70, 0x72,
-  0x74, 0x77, 0x79, 0x7e, 0x84, 0x86, 0x88, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-  0x8b, 0x88, 0x86, 0x84, 0x83, 0x84, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87,
-  0x90, 0xad, 0xbe, 0xcb, 0xce, 0xd0, 0xcf, 0xcd, 0xcc, 0xcd, 0xd2, 0xd9,
-  0xdc, 0xdd, 0xd2, 0xbf, 0xb6, 0xb1, 0xad, 0xa7, 0xa2, 0x96, 0x8b, 0x85,
-  0x83, 0x9f, 0xb6, 0xa0, 0x8c, 0x7e, 0xa1, 0xb8, 0xbf, 0xb9, 0x9f, 0x7e,
-  0x77, 0x77, 0x76, 0x74, 0x72, 0x73, 0x6f, 0x6c, 0x67, 0x5f, 0x5d, 0x5d,
-  0x5e, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x60, 0x5f, 0x5d, 0x5a, 0x58, 0x57,
-  0x55, 0x55, 0x56, 0x55, 0x52, 0x51, 0x4e, 0x4b, 0x48, 0x46, 0x45, 0x44,
-  0x44, 0x45, 0x46, 0x47, 0x4b, 0x4e, 0x4f, 0x50, 0x5c, 0x70, 0x7b, 0x82,
-  0x86, 0x8f, 0x9b, 0xa7, 0xb1, 0xb8, 0xc0, 0xc2, 0xc5, 0xc6, 0xc9, 0xcc,
-  0xca, 0xb3, 0x90, 0x88, 0x8e, 0x82, 0x87, 0x81, 0x7f, 0x8a, 0x97, 0x7b,
-  0x85, 0x92, 0x9e, 0x9a, 0x86, 0x68, 0x61, 0x67, 0x60, 0x6b, 0x7d, 0x81,
-  0x77, 0x69, 0x5f, 0x58, 0x55, 0x54, 0x53, 0x53, 0x54, 0x55, 0x55, 0x57,
-  0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x60, 0x61,
-  0x62, 0x63, 0x65, 0x66, 0x67, 0x68, 0x69, 0x69, 0x6b, 0x6d, 0x6f, 0x6f,
-  0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x72, 0x73, 0x74,
-  0x73, 0x72, 0x71, 0x6f, 0x6e, 0x6b, 0x69, 0x67, 0x62, 0x5e, 0x57, 0x52,
-  0x50, 0x4d, 0x47, 0x40, 0x3c, 0x39, 0x35, 0x2d, 0x20, 0x18, 0x14, 0x12,
-  0x12, 0x12, 0x12, 0x12, 0x10, 0x11, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13,
-  0x12, 0x12, 0x12, 0x11, 0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f, 0x60,
-  0x60, 0x61, 0x61, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x69, 0x6a, 0x6a,
-  0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x69, 0x68, 0x68, 0x67, 0x66,
-  0x66, 0x66, 0x64, 0x64, 0x66, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6b, 0x6b,
-  0x6c, 0x6d, 0x6e, 0x6d, 0x6d, 0x6d, 0x6c, 0x6c, 0x6b, 0x6b, 0x6d, 0x73,
-  0x7b, 0x81, 0x83, 0x87, 0x8a, 0x8e, 0x90, 0x91, 0x93, 0x94, 0x96, 0x98,
-  0x9a, 0x9a, 0x9a, 0x98, 0x98, 0x98, 0x96, 0x92, 0x8c, 0x88, 0x87, 0x86,
-  0x84, 0x82, 0x7f, 0x7c, 0x79, 0x76, 0x71, 0x72, 0x74, 0x76, 0x79, 0x7d,
-  0x82, 0x85, 0x87, 0x89, 0x8b, 0x8b, 0x8b, 0x8c, 0x8b, 0x88, 0x86, 0x84,
-  0x83, 0x84, 0x86, 0x87, 0x87, 0x87, 0x87, 0x89, 0x9b, 0xbc, 0xca, 0xcb,
-  0xc8, 0xc8, 0xc6, 0xc5, 0xc4, 0xc4, 0xcd, 0xd5, 0xda, 0xde, 0xda, 0xc7,
-  0xbd, 0xb4, 0xb0, 0xaa, 0xa2, 0x98, 0x8f, 0x87, 0x81, 0x96, 0xb7, 0xae,
-  0x9c, 0x85, 0x93, 0xa7, 0xc0, 0xc4, 0xac, 0x82, 0x7d, 0x85, 0x85, 0x7e,
-  0x7a, 0x78, 0x73, 0x6f, 0x69, 0x60, 0x5c, 0x5b, 0x5c, 0x5e, 0x60, 0x62,
-  0x62, 0x62, 0x61, 0x61, 0x61, 0x5f, 0x5e, 0x5e, 0x5d, 0x5b, 0x5b, 0x5b,
-  0x58, 0x57, 0x54, 0x51, 0x4f, 0x4c, 0x49, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
-  0x4e, 0x50, 0x51, 0x53, 0x61, 0x75, 0x80, 0x87, 0x8b, 0x93, 0x9f, 0xac,
-  0xb5, 0xbc, 0xc3, 0xc4, 0xc6, 0xc6, 0xc8, 0xcb, 0xc8, 0xac, 0x8a, 0x87,
-  0x95, 0x7b, 0x96, 0xa5, 0xa8, 0xab, 0xae, 0x83, 0x94, 0xa3, 0xa3, 0x94,
-  0x7d, 0x5b, 0x55, 0x65, 0x64, 0x67, 0x7d, 0x83, 0x7b, 0x6e, 0x61, 0x5a,
-  0x57, 0x55, 0x54, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b,
-  0x5c, 0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x60, 0x62, 0x63, 0x64, 0x65, 0x66,
-  0x66, 0x68, 0x6a, 0x6a, 0x6c, 0x6d, 0x6f, 0x6f, 0x70, 0x70, 0x71, 0x70,
-  0x70, 0x70, 0x71, 0x71, 0x72, 0x73, 0x73, 0x74, 0x73, 0x72, 0x72, 0x70,
-  0x6e, 0x6a, 0x69, 0x67, 0x62, 0x5e, 0x58, 0x53, 0x51, 0x4d, 0x46, 0x40,
-  0x3c, 0x39, 0x35, 0x2c, 0x20, 0x18, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12,
-  0x11, 0x11, 0x12, 0x11, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x11,
-  0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5e, 0x5e, 0x5f, 0x60, 0x62, 0x63, 0x63,
-  0x64, 0x65, 0x66, 0x67, 0x69, 0x6a, 0x6a, 0x6b, 0x6a, 0x6a, 0x6b, 0x6b,
-  0x6b, 0x6b, 0x6a, 0x69, 0x69, 0x69, 0x67, 0x68, 0x67, 0x67, 0x65, 0x65,
-  0x67, 0x68, 0x68, 0x68, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b, 0x6d, 0x6d, 0x6d,
-  0x6d, 0x6c, 0x6d, 0x6c, 0x6c, 0x6d, 0x6f, 0x75, 0x7c, 0x81, 0x84, 0x88,
-  0x8b, 0x8f, 0x91, 0x92, 0x92, 0x94, 0x96, 0x99, 0x9a, 0x9a, 0x99, 0x99,
-  0x99, 0x98, 0x97, 0x92, 0x8e, 0x8b, 0x8a, 0x88, 0x86, 0x83, 0x81, 0x7e,
-  0x7c, 0x78, 0x73, 0x73, 0x75, 0x77, 0x79, 0x7d, 0x80, 0x83, 0x85, 0x88,
-  0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x89, 0x86, 0x85, 0x84, 0x84, 0x85, 0x86,
-  0x86, 0x86, 0x86, 0x8e, 0xad, 0xc6, 0xcc, 0xc2, 0xb5, 0xb0, 0xb1, 0xb3,
-  0xb5, 0xb8, 0xc5, 0xce, 0xd1, 0xd7, 0xdb, 0xd7, 0xc9, 0xbb, 0xb5, 0xae,
-  0xa1, 0x9a, 0x96, 0x90, 0x84, 0x89, 0xaf, 0xb7, 0xae, 0x98, 0x8e, 0x91,
-  0xb0, 0xb7, 0xa4, 0x8d, 0x90, 0x95, 0x91, 0x83, 0x7b, 0x7b, 0x79, 0x75,
-  0x6d, 0x62, 0x5b, 0x5a, 0x5b, 0x5e, 0x61, 0x63, 0x65, 0x65, 0x63, 0x64,
-  0x67, 0x66, 0x65, 0x67, 0x66, 0x62, 0x63, 0x63, 0x61, 0x5e, 0x5a, 0x5a,
-  0x58, 0x55, 0x52, 0x52, 0x53, 0x54, 0x56, 0x56, 0x57, 0x57, 0x58, 0x5d,
-  0x6e, 0x7e, 0x86, 0x8d, 0x92, 0x9a, 0xa7, 0xb4, 0xbd, 0xc0, 0xc3, 0xc5,
-  0xc8, 0xc7, 0xc8, 0xca, 0xc4, 0xa2, 0x81, 0x85, 0x9e, 0x82, 0xa1, 0xbc,
-  0xc4, 0xc3, 0xb4, 0x82, 0x97, 0xa5, 0x9e, 0x82, 0x6f, 0x64, 0x64, 0x6c,
-  0x66, 0x5c, 0x71, 0x7c, 0x7e, 0x72, 0x66, 0x5e, 0x5a, 0x57, 0x55, 0x54,
-  0x54, 0x55, 0x57, 0x57, 0x59, 0x59, 0x5a, 0x5b, 0x5c, 0x5e, 0x5f, 0x5f,
-  0x5e, 0x5f, 0x60, 0x63, 0x65, 0x65, 0x65, 0x66, 0x66, 0x68, 0x69, 0x6b,
-  0x6d, 0x6e, 0x6f, 0x6f, 0x6f, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x73,
-  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x71, 0x6e, 0x6a, 0x68, 0x66,
-  0x63, 0x5e, 0x58, 0x54, 0x52, 0x4d, 0x47, 0x3f, 0x3d, 0x3b, 0x36, 0x2c,
-  0x21, 0x1a, 0x16, 0x13, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10,
-  0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x59, 0x5b, 0x5a, 0x5b,
-  0x5c, 0x5d, 0x5d, 0x5f, 0x60, 0x61, 0x63, 0x63, 0x64, 0x65, 0x66, 0x67,
-  0x69, 0x69, 0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6b, 0x69,
-  0x68, 0x68, 0x68, 0x68, 0x67, 0x67, 0x68, 0x67, 0x67, 0x68, 0x68, 0x68,
-  0x6a, 0x6a, 0x6b, 0x6b, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6d, 0x6c,
-  0x6c, 0x6d, 0x70, 0x77, 0x7f, 0x83, 0x85, 0x89, 0x8d, 0x91, 0x92, 0x92,
-  0x93, 0x94, 0x96, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x98, 0x98, 0x96, 0x92,
-  0x8e, 0x8d, 0x8b, 0x89, 0x88, 0x85, 0x83, 0x80, 0x7d, 0x7a, 0x76, 0x77,
-  0x77, 0x78, 0x7a, 0x7c, 0x7f, 0x81, 0x83, 0x86, 0x88, 0x8b, 0x8c, 0x8c,
-  0x8c, 0x89, 0x87, 0x85, 0x84, 0x84, 0x83, 0x83, 0x85, 0x85, 0x88, 0x9b,
-  0xbf, 0xc4, 0xba, 0xa0, 0x86, 0x88, 0x92, 0x9b, 0xa9, 0xbe, 0xbe, 0xbb,
-  0xbe, 0xca, 0xd3, 0xd9, 0xd2, 0xc5, 0xbc, 0xb1, 0xa6, 0x99, 0x99, 0x96,
-  0x8b, 0x82, 0x94, 0xa9, 0xaf, 0xa7, 0x95, 0x88, 0x86, 0x80, 0x74, 0x82,
-  0x96, 0x9b, 0x96, 0x85, 0x75, 0x80, 0x81, 0x7d, 0x73, 0x68, 0x60, 0x5e,
-  0x5e, 0x61, 0x64, 0x67, 0x6a, 0x6c, 0x6c, 0x6a, 0x6b, 0x6b, 0x6c, 0x6d,
-  0x6d, 0x69, 0x68, 0x68, 0x67, 0x65, 0x61, 0x61, 0x61, 0x5e, 0x5b, 0x5e,
-  0x61, 0x62, 0x62, 0x61, 0x63, 0x63, 0x64, 0x69, 0x77, 0x83, 0x8a, 0x90,
-  0x97, 0xa3, 0xae, 0xba, 0xc1, 0xc4, 0xc6, 0xc8, 0xca, 0xc8, 0xc8, 0xca,
-  0xc0, 0x9e, 0x7c, 0x7d, 0x95, 0x7c, 0x73, 0x93, 0xa1, 0xa3, 0xa3, 0x91,
-  0xa1, 0xa6, 0x97, 0x87, 0x80, 0x8a, 0x81, 0x5b, 0x34, 0x34, 0x4e, 0x65,
-  0x7e, 0x7a, 0x6d, 0x64, 0x5f, 0x59, 0x56, 0x56, 0x55, 0x56, 0x57, 0x57,
-  0x59, 0x5a, 0x5a, 0x5b, 0x5d, 0x5f, 0x60, 0x60, 0x5e, 0x5f, 0x60, 0x63,
-  0x64, 0x64, 0x64, 0x66, 0x66, 0x68, 0x69, 0x6b, 0x6d, 0x6e, 0x6e, 0x6f,
-  0x6f, 0x71, 0x70, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72,
-  0x73, 0x73, 0x73, 0x71, 0x6e, 0x6a, 0x68, 0x67, 0x63, 0x5d, 0x57, 0x53,
-  0x51, 0x4d, 0x47, 0x40, 0x3d, 0x3b, 0x36, 0x2c, 0x22, 0x1a, 0x16, 0x12,
-  0x10, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x10, 0x11, 0x12, 0x11, 0x11,
-  0x13, 0x13, 0x13, 0x11, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5c, 0x5c, 0x5d,
-  0x5f, 0x5f, 0x62, 0x63, 0x63, 0x64, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a,
-  0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6b, 0x6a, 0x69, 0x69, 0x69, 0x67,
-  0x66, 0x67, 0x68, 0x67, 0x69, 0x69, 0x69, 0x68, 0x68, 0x6a, 0x6b, 0x6b,
-  0x6b, 0x6a, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x72, 0x78,
-  0x80, 0x84, 0x87, 0x8a, 0x8e, 0x91, 0x92, 0x92, 0x92, 0x93, 0x97, 0x99,
-  0x9b, 0x9b, 0x9b, 0x9a, 0x98, 0x97, 0x96, 0x92, 0x8f, 0x8e, 0x8c, 0x8b,
-  0x89, 0x87, 0x85, 0x82, 0x80, 0x7c, 0x79, 0x7a, 0x7c, 0x7c, 0x7d, 0x7c,
-  0x7f, 0x81, 0x82, 0x84, 0x86, 0x8a, 0x8b, 0x8b, 0x8b, 0x88, 0x87, 0x85,
-  0x84, 0x83, 0x81, 0x81, 0x84, 0x87, 0x90, 0xad, 0xbb, 0xa4, 0x8d, 0x71,
-  0x61, 0x68, 0x5e, 0x66, 0x91, 0xcb, 0xc9, 0xb5, 0xaf, 0xb7, 0xc9, 0xd1,
-  0xd0, 0xcd, 0xc6, 0xb7, 0xab, 0x9f, 0x99, 0x95, 0x8f, 0x8b, 0x80, 0x85,
-  0x91, 0xa3, 0x9f, 0x93, 0x87, 0x75, 0x5a, 0x67, 0x85, 0x92, 0x97, 0x97,
-  0x83, 0x86, 0x89, 0x86, 0x7b, 0x6e, 0x68, 0x66, 0x65, 0x64, 0x65, 0x68,
-  0x6c, 0x6f, 0x73, 0x72, 0x6e, 0x6e, 0x6f, 0x72, 0x72, 0x70, 0x6d, 0x6c,
-  0x6a, 0x6a, 0x69, 0x69, 0x69, 0x67, 0x66, 0x6a, 0x6c, 0x6c, 0x6c, 0x6e,
-  0x6f, 0x6e, 0x6f, 0x76, 0x82, 0x89, 0x8e, 0x95, 0x9d, 0xa9, 0xb5, 0xbf,
-  0xc4, 0xc6, 0xc8, 0xcc, 0xcc, 0xca, 0xcb, 0xcd, 0xbe, 0x96, 0x74, 0x77,
-  0x8c, 0x5b, 0x54, 0x76, 0x85, 0x8d, 0x9a, 0x89, 0x99, 0x9b, 0x83, 0x70,
-  0x8b, 0x75, 0x59, 0x33, 0x19, 0x1c, 0x2c, 0x47, 0x78, 0x7f, 0x72, 0x69,
-  0x63, 0x5c, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x5c, 0x5c, 0x5d,
-  0x5f, 0x60, 0x5f, 0x5f, 0x60, 0x60, 0x62, 0x61, 0x62, 0x63, 0x66, 0x68,
-  0x68, 0x6a, 0x6b, 0x6c, 0x6c, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x71,
-  0x71, 0x71, 0x70, 0x72, 0x71, 0x72, 0x72, 0x72, 0x73, 0x73, 0x72, 0x70,
-  0x6f, 0x6b, 0x68, 0x66, 0x62, 0x5d, 0x57, 0x54, 0x51, 0x4d, 0x47, 0x40,
-  0x3d, 0x3a, 0x35, 0x2d, 0x24, 0x1c, 0x16, 0x13, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12,
-  0x5a, 0x5a, 0x59, 0x59, 0x5a, 0x5b, 0x5d, 0x5e, 0x5f, 0x5f, 0x60, 0x62,
-  0x63, 0x64, 0x65, 0x67, 0x68, 0x68, 0x68, 0x69, 0x6b, 0x6b, 0x6b, 0x6b,
-  0x6b, 0x6c, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x67, 0x66, 0x67, 0x67,
-  0x69, 0x69, 0x68, 0x68, 0x68, 0x69, 0x6a, 0x6b, 0x6a, 0x6a, 0x6b, 0x6d,
-  0x6d, 0x6c, 0x6d, 0x6d, 0x6e, 0x70, 0x74, 0x7b, 0x82, 0x85, 0x87, 0x8b,
-  0x8e, 0x90, 0x91, 0x91, 0x91, 0x93, 0x97, 0x99, 0x9b, 0x9b, 0x9b, 0x9b,
-  0x98, 0x97, 0x96, 0x92, 0x8f, 0x8e, 0x8c, 0x8b, 0x8a, 0x88, 0x86, 0x84,
-  0x83, 0x80, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x84,
-  0x86, 0x89, 0x89, 0x89, 0x89, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x82,
-  0x87, 0x8c, 0x98, 0xb7, 0xaa, 0x8b, 0x86, 0x97, 0x96, 0x8d, 0x74, 0x7b,
-  0xad, 0xcd, 0xb6, 0xaf, 0xaf, 0xb0, 0xc0, 0xce, 0xcf, 0xce, 0xc9, 0xbb,
-  0xb1, 0xa6, 0x9c, 0x98, 0x95, 0x93, 0x80, 0x72, 0x76, 0x8c, 0xa0, 0xa3,
-  0x9f, 0x8f, 0x6d, 0x5e, 0x70, 0x8c, 0x9e, 0xab, 0x9a, 0x8c, 0x8b, 0x8b,
-  0x86, 0x74, 0x6a, 0x68, 0x67, 0x67, 0x64, 0x65, 0x6c, 0x71, 0x75, 0x73,
-  0x6f, 0x6f, 0x71, 0x75, 0x75, 0x75, 0x74, 0x73, 0x71, 0x72, 0x74, 0x74,
-  0x73, 0x72, 0x72, 0x75, 0x77, 0x77, 0x75, 0x75, 0x75, 0x77, 0x79, 0x7e,
-  0x88, 0x8c, 0x92, 0x9b, 0xa3, 0xaf, 0xbb, 0xc1, 0xc3, 0xc5, 0xc9, 0xce,
-  0xcb, 0xcb, 0xcd, 0xce, 0xbb, 0x8f, 0x6f, 0x77, 0x8f, 0x4c, 0x5a, 0x80,
-  0x8f, 0x8e, 0x82, 0x83, 0x8a, 0x84, 0x6e, 0x69, 0x71, 0x4a, 0x37, 0x30,
-  0x19, 0x16, 0x21, 0x3a, 0x6c, 0x7f, 0x76, 0x6d, 0x68, 0x60, 0x5a, 0x58,
-  0x57, 0x57, 0x57, 0x57, 0x5b, 0x5c, 0x5d, 0x5d, 0x5f, 0x60, 0x5f, 0x5f,
-  0x60, 0x60, 0x61, 0x61, 0x61, 0x63, 0x66, 0x68, 0x68, 0x6a, 0x6b, 0x6b,
-  0x6c, 0x6e, 0x70, 0x70, 0x70, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x70, 0x71,
-  0x70, 0x71, 0x72, 0x72, 0x73, 0x73, 0x72, 0x70, 0x6f, 0x6b, 0x68, 0x66,
-  0x62, 0x5d, 0x57, 0x53, 0x50, 0x4c, 0x47, 0x40, 0x3c, 0x39, 0x34, 0x2b,
-  0x24, 0x1c, 0x18, 0x13, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12,
-  0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x13, 0x12, 0x5a, 0x5a, 0x5a, 0x5a,
-  0x59, 0x5b, 0x5d, 0x5e, 0x5f, 0x5f, 0x60, 0x61, 0x63, 0x64, 0x65, 0x67,
-  0x68, 0x68, 0x68, 0x69, 0x6b, 0x6b, 0x6b, 0x6a, 0x6b, 0x6c, 0x6b, 0x6b,
-  0x6a, 0x6b, 0x6a, 0x69, 0x68, 0x67, 0x66, 0x67, 0x69, 0x69, 0x69, 0x68,
-  0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x6a, 0x6c, 0x6d, 0x6d, 0x6c, 0x6d, 0x6e,
-  0x6f, 0x71, 0x75, 0x7d, 0x83, 0x86, 0x88, 0x8b, 0x8e, 0x90, 0x91, 0x91,
-  0x91, 0x93, 0x97, 0x99, 0x9b, 0x9b, 0x9a, 0x9b, 0x99, 0x98, 0x96, 0x92,
-  0x8f, 0x8e, 0x8c, 0x8b, 0x8a, 0x88, 0x87, 0x85, 0x83, 0x81, 0x7d, 0x7e,
-  0x80, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x86, 0x87, 0x88, 0x88,
-  0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x81, 0x85, 0x8b, 0x90, 0x9e, 0xba,
-  0xaa, 0x94, 0x99, 0xb4, 0xb5, 0xab, 0x96, 0x9d, 0xc2, 0xc3, 0x9c, 0xab,
-  0xb4, 0xb1, 0xba, 0xcb, 0xcf, 0xce, 0xcb, 0xc1, 0xb4, 0xa9, 0x9f, 0x9a,
-  0x95, 0x94, 0x84, 0x72, 0x70, 0x80, 0x99, 0xa6, 0xa6, 0x9b, 0x7f, 0x66,
-  0x6b, 0x8a, 0xa1, 0xb3, 0xa2, 0x8e, 0x8b, 0x8d, 0x8c, 0x74, 0x68, 0x66,
-  0x65, 0x64, 0x61, 0x62, 0x69, 0x6e, 0x75, 0x73, 0x70, 0x70, 0x71, 0x76,
-  0x78, 0x78, 0x79, 0x78, 0x75, 0x77, 0x7a, 0x7a, 0x79, 0x78, 0x79, 0x7b,
-  0x7c, 0x7d, 0x7c, 0x7a, 0x7a, 0x7d, 0x80, 0x84, 0x8c, 0x8f, 0x95, 0x9e,
-  0xa6, 0xb1, 0xbb, 0xc1, 0xc3, 0xc4, 0xc8, 0xce, 0xcc, 0xca, 0xcb, 0xcc,
-  0xb8, 0x89, 0x6f, 0x77, 0x88, 0x47, 0x61, 0x87, 0x91, 0x89, 0x7e, 0x8c,
-  0x88, 0x7c, 0x6a, 0x6b, 0x59, 0x36, 0x2e, 0x34, 0x1c, 0x14, 0x1f, 0x35,
-  0x61, 0x7f, 0x79, 0x71, 0x6b, 0x63, 0x5b, 0x59, 0x58, 0x57, 0x56, 0x57,
-  0x5b, 0x5c, 0x5d, 0x5d, 0x5f, 0x60, 0x5f, 0x5f, 0x60, 0x60, 0x61, 0x61,
-  0x62, 0x63, 0x66, 0x68, 0x68, 0x6a, 0x6b, 0x6b, 0x6c, 0x6e, 0x70, 0x70,
-  0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x70, 0x70, 0x70, 0x71, 0x72, 0x72,
-  0x73, 0x73, 0x72, 0x70, 0x6f, 0x6b, 0x68, 0x66, 0x63, 0x5e, 0x57, 0x53,
-  0x50, 0x4c, 0x47, 0x3f, 0x3b, 0x38, 0x35, 0x2b, 0x24, 0x1c, 0x18, 0x13,
-  0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x11, 0x13,
-  0x13, 0x13, 0x13, 0x12, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5c, 0x5d,
-  0x5e, 0x5f, 0x5f, 0x61, 0x63, 0x64, 0x66, 0x66, 0x67, 0x67, 0x68, 0x69,
-  0x6b, 0x6c, 0x6b, 0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6b, 0x6c, 0x6b, 0x6a,
-  0x68, 0x67, 0x67, 0x68, 0x69, 0x69, 0x6a, 0x69, 0x69, 0x6a, 0x6a, 0x6b,
-  0x6b, 0x6b, 0x6c, 0x6d, 0x6d, 0x6c, 0x6d, 0x6e, 0x71, 0x74, 0x77, 0x7e,
-  0x84, 0x87, 0x89, 0x8c, 0x8e, 0x91, 0x91, 0x91, 0x91, 0x93, 0x96, 0x99,
-  0x9a, 0x9b, 0x9b, 0x9b, 0x99, 0x97, 0x95, 0x92, 0x8f, 0x8d, 0x8b, 0x8a,
-  0x88, 0x88, 0x88, 0x86, 0x85, 0x82, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x82, 0x84, 0x84, 0x86, 0x86, 0x86, 0x87, 0x86, 0x84, 0x83,
-  0x82, 0x80, 0x83, 0x8b, 0x92, 0x98, 0xa4, 0xb5, 0xb1, 0xb2, 0xb9, 0xc5,
-  0xc0, 0xc4, 0xc4, 0xc9, 0xce, 0xb0, 0x85, 0xa6, 0xb5, 0xac, 0xb1, 0xc3,
-  0xcd, 0xd0, 0xd0, 0xcb, 0xb9, 0xab, 0xa4, 0x9d, 0x92, 0x90, 0x8c, 0x7f,
-  0x78, 0x78, 0x88, 0x9d, 0x9c, 0x96, 0x8d, 0x81, 0x77, 0x8e, 0xa4, 0xb8,
-  0xa4, 0x92, 0x90, 0x91, 0x8f, 0x6e, 0x60, 0x5f, 0x5f, 0x5e, 0x5b, 0x5b,
-  0x60, 0x66, 0x6e, 0x73, 0x70, 0x70, 0x71, 0x76, 0x79, 0x7c, 0x7c, 0x7b,
-  0x79, 0x7c, 0x7f, 0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x82, 0x84, 0x85, 0x83,
-  0x84, 0x89, 0x8c, 0x8f, 0x91, 0x92, 0x99, 0xa3, 0xaa, 0xb2, 0xba, 0xc1,
-  0xc3, 0xc4, 0xc6, 0xcb, 0xcc, 0xca, 0xc8, 0xc6, 0xb1, 0x82, 0x74, 0x78,
-  0x76, 0x43, 0x6d, 0x88, 0x87, 0x7d, 0x92, 0xa1, 0x8d, 0x7e, 0x73, 0x68,
-  0x3a, 0x2e, 0x32, 0x37, 0x1d, 0x15, 0x1e, 0x2d, 0x4e, 0x7c, 0x7d, 0x75,
-  0x6f, 0x68, 0x5e, 0x5a, 0x59, 0x58, 0x58, 0x58, 0x5a, 0x5c, 0x5c, 0x5d,
-  0x5f, 0x60, 0x5f, 0x60, 0x61, 0x60, 0x62, 0x61, 0x63, 0x64, 0x66, 0x67,
-  0x67, 0x69, 0x6b, 0x6b, 0x6b, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x71,
-  0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x71, 0x70,
-  0x6f, 0x6b, 0x68, 0x66, 0x63, 0x5e, 0x57, 0x53, 0x51, 0x4b, 0x46, 0x3f,
-  0x3b, 0x39, 0x35, 0x2d, 0x24, 0x1b, 0x16, 0x13, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0x11, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x13, 0x12,
-  0x59, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x5a, 0x5d, 0x5d, 0x5e, 0x60, 0x61,
-  0x63, 0x64, 0x65, 0x67, 0x68, 0x68, 0x69, 0x6b, 0x6b, 0x6c, 0x6d, 0x6d,
-  0x6d, 0x6d, 0x6b, 0x6c, 0x6c, 0x6c, 0x6b, 0x6b, 0x69, 0x69, 0x68, 0x68,
-  0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d,
-  0x6d, 0x6d, 0x6e, 0x6f, 0x73, 0x76, 0x79, 0x80, 0x85, 0x89, 0x8b, 0x8d,
-  0x8e, 0x91, 0x92, 0x92, 0x92, 0x95, 0x96, 0x97, 0x9a, 0x9b, 0x9c, 0x9b,
-  0x99, 0x96, 0x94, 0x91, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x89, 0x88, 0x87,
-  0x86, 0x83, 0x83, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x83, 0x84, 0x85,
-  0x85, 0x86, 0x86, 0x85, 0x84, 0x84, 0x82, 0x81, 0x7f, 0x80, 0x88, 0x93,
-  0x9a, 0xa2, 0xad, 0xab, 0xa1, 0x9c, 0xa4, 0xb9, 0xba, 0xcb, 0xd3, 0xcd,
-  0xbe, 0xc0, 0xb4, 0x98, 0x85, 0x79, 0x98, 0xb4, 0xc5, 0xcf, 0xd3, 0xd2,
-  0xc0, 0xad, 0xac, 0xa8, 0x9c, 0x97, 0x9a, 0x90, 0x86, 0x7b, 0x7e, 0x84,
-  0x7f, 0x7f, 0x88, 0x95, 0x96, 0x9a, 0xa5, 0xb6, 0xad, 0xa0, 0x9b, 0x94,
-  0x7e, 0x5a, 0x58, 0x5d, 0x5f, 0x60, 0x5b, 0x58, 0x5a, 0x5c, 0x62, 0x6a,
-  0x6c, 0x6d, 0x6f, 0x75, 0x7a, 0x7b, 0x7a, 0x79, 0x7a, 0x7f, 0x81, 0x81,
-  0x83, 0x86, 0x87, 0x85, 0x88, 0x8b, 0x8b, 0x89, 0x8e, 0x95, 0x97, 0x97,
-  0x93, 0x96, 0x9e, 0xab, 0xb2, 0xb9, 0xbf, 0xc1, 0xc2, 0xc2, 0xc6, 0xc9,
-  0xca, 0xcb, 0xca, 0xc4, 0xaa, 0x7a, 0x84, 0x8a, 0x77, 0x46, 0x78, 0x86,
-  0x87, 0x8e, 0x9f, 0x9d, 0x86, 0x7e, 0x77, 0x3f, 0x25, 0x33, 0x38, 0x31,
-  0x1c, 0x14, 0x19, 0x21, 0x3a, 0x76, 0x7e, 0x77, 0x73, 0x6c, 0x62, 0x5d,
-  0x5c, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5b, 0x5d, 0x5f, 0x61, 0x62, 0x62,
-  0x61, 0x61, 0x63, 0x63, 0x64, 0x64, 0x64, 0x66, 0x66, 0x67, 0x68, 0x6a,
-  0x6b, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x72, 0x73, 0x73,
-  0x73, 0x73, 0x72, 0x72, 0x73, 0x72, 0x71, 0x70, 0x6e, 0x6a, 0x68, 0x66,
-  0x63, 0x5e, 0x57, 0x53, 0x51, 0x4b, 0x45, 0x40, 0x3c, 0x39, 0x35, 0x2f,
-  0x24, 0x1c, 0x17, 0x13, 0x11, 0x10, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11,
-  0x12, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x58, 0x58, 0x58, 0x59,
-  0x59, 0x59, 0x59, 0x5b, 0x5c, 0x5c, 0x5f, 0x61, 0x63, 0x64, 0x65, 0x67,
-  0x68, 0x69, 0x69, 0x6b, 0x6b, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d,
-  0x6d, 0x6d, 0x6c, 0x6c, 0x6b, 0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x6b, 0x6b,
-  0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6e, 0x6e, 0x6f, 0x71, 0x72,
-  0x76, 0x78, 0x7c, 0x81, 0x86, 0x89, 0x8b, 0x8d, 0x8e, 0x91, 0x92, 0x93,
-  0x93, 0x95, 0x96, 0x97, 0x9a, 0x9c, 0x9c, 0x9a, 0x99, 0x96, 0x94, 0x90,
-  0x8d, 0x8c, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x88, 0x87, 0x85, 0x85, 0x88,
-  0x89, 0x89, 0x89, 0x88, 0x87, 0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82,
-  0x82, 0x81, 0x7f, 0x7d, 0x7d, 0x83, 0x90, 0x9b, 0xa2, 0xa9, 0xb3, 0xb4,
-  0xbf, 0xaf, 0xa2, 0x97, 0x97, 0xc7, 0xd3, 0xc5, 0xab, 0xc2, 0xb8, 0x82,
-  0x64, 0x59, 0x78, 0xa4, 0xbf, 0xcc, 0xd2, 0xd4, 0xc4, 0xb1, 0xae, 0xad,
-  0xa8, 0x9f, 0x9d, 0x95, 0x8c, 0x7f, 0x7c, 0x7a, 0x80, 0x85, 0x8b, 0x96,
-  0x9e, 0xa2, 0xa6, 0xab, 0xa8, 0x9c, 0x8c, 0x7a, 0x5c, 0x52, 0x61, 0x69,
-  0x6c, 0x6c, 0x63, 0x5d, 0x5b, 0x5b, 0x5d, 0x63, 0x68, 0x6c, 0x6f, 0x73,
-  0x79, 0x79, 0x77, 0x77, 0x79, 0x7e, 0x81, 0x81, 0x81, 0x84, 0x87, 0x85,
-  0x8a, 0x8d, 0x90, 0x91, 0x97, 0x9c, 0x9c, 0x99, 0x95, 0x99, 0xa2, 0xac,
-  0xb3, 0xbd, 0xc4, 0xc2, 0xc1, 0xc3, 0xc8, 0xc8, 0xc9, 0xd1, 0xd0, 0xc4,
-  0xa7, 0x78, 0x8f, 0x94, 0x72, 0x43, 0x76, 0x91, 0x95, 0x8c, 0x79, 0x94,
-  0x91, 0x81, 0x5f, 0x28, 0x28, 0x33, 0x33, 0x27, 0x1a, 0x12, 0x12, 0x16,
-  0x2c, 0x6b, 0x7e, 0x79, 0x74, 0x6f, 0x66, 0x60, 0x5e, 0x5d, 0x5c, 0x5b,
-  0x59, 0x5a, 0x5a, 0x5d, 0x5f, 0x61, 0x62, 0x61, 0x60, 0x60, 0x63, 0x63,
-  0x64, 0x65, 0x64, 0x66, 0x66, 0x67, 0x68, 0x6b, 0x6d, 0x6e, 0x6d, 0x6e,
-  0x6f, 0x6f, 0x71, 0x71, 0x71, 0x72, 0x73, 0x74, 0x74, 0x73, 0x73, 0x72,
-  0x73, 0x74, 0x73, 0x71, 0x6f, 0x6a, 0x68, 0x67, 0x64, 0x5e, 0x57, 0x54,
-  0x51, 0x4d, 0x46, 0x40, 0x3d, 0x3a, 0x36, 0x2e, 0x23, 0x1d, 0x18, 0x14,
-  0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12, 0x12, 0x13,
-  0x12, 0x12, 0x12, 0x12, 0x58, 0x57, 0x59, 0x59, 0x5a, 0x58, 0x59, 0x5a,
-  0x5b, 0x5c, 0x5e, 0x61, 0x62, 0x63, 0x65, 0x67, 0x68, 0x68, 0x69, 0x6b,
-  0x6c, 0x6c, 0x6d, 0x6e, 0x6d, 0x6d, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d,
-  0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6c, 0x6c, 0x6d,
-  0x6c, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x72, 0x74, 0x78, 0x7a, 0x7d, 0x83,
-  0x87, 0x8a, 0x8c, 0x8e, 0x8f, 0x91, 0x92, 0x93, 0x94, 0x95, 0x95, 0x98,
-  0x99, 0x9a, 0x9a, 0x99, 0x98, 0x96, 0x94, 0x90, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8c, 0x8c, 0x8a, 0x89, 0x87, 0x88, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b,
-  0x8a, 0x8a, 0x88, 0x87, 0x85, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7b, 0x7b,
-  0x7e, 0x87, 0x96, 0xa1, 0xa6, 0xad, 0xb7, 0xb4, 0xc9, 0xbb, 0xb4, 0xb9,
-  0xc2, 0xd6, 0xcc, 0xc5, 0xc5, 0xc4, 0x9d, 0x82, 0x78, 0x6e, 0x5b, 0x96,
-  0xc3, 0xc7, 0xcc, 0xd4, 0xc6, 0xb6, 0xb0, 0xae, 0xab, 0xa5, 0x9e, 0x98,
-  0x90, 0x83, 0x81, 0x84, 0x86, 0x87, 0x8c, 0x92, 0x9b, 0xa3, 0xa4, 0xa1,
-  0x97, 0x85, 0x76, 0x6a, 0x5a, 0x5d, 0x6d, 0x74, 0x76, 0x74, 0x69, 0x61,
-  0x5e, 0x5c, 0x5d, 0x61, 0x66, 0x6b, 0x6d, 0x72, 0x79, 0x7a, 0x78, 0x77,
-  0x77, 0x7c, 0x7f, 0x7f, 0x7f, 0x81, 0x85, 0x81, 0x85, 0x8b, 0x92, 0x96,
-  0x9b, 0x9e, 0x9e, 0x9a, 0x98, 0xa0, 0xa6, 0xab, 0xb2, 0xbd, 0xc3, 0xbf,
-  0xc1, 0xc5, 0xcb, 0xcc, 0xcb, 0xce, 0xcc, 0xc1, 0xa4, 0x76, 0x8a, 0x8b,
-  0x66, 0x48, 0x78, 0x98, 0x9f, 0x99, 0x86, 0x97, 0x99, 0x80, 0x40, 0x1b,
-  0x25, 0x30, 0x2f, 0x23, 0x18, 0x11, 0x10, 0x13, 0x25, 0x61, 0x7d, 0x7a,
-  0x76, 0x71, 0x69, 0x63, 0x61, 0x5f, 0x5f, 0x5b, 0x59, 0x5a, 0x5b, 0x5c,
-  0x5e, 0x60, 0x61, 0x61, 0x5f, 0x60, 0x63, 0x64, 0x64, 0x65, 0x66, 0x65,
-  0x67, 0x69, 0x69, 0x6a, 0x6d, 0x6e, 0x6e, 0x6e, 0x6f, 0x70, 0x70, 0x72,
-  0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x75, 0x74, 0x72,
-  0x6f, 0x6c, 0x68, 0x66, 0x63, 0x5d, 0x58, 0x54, 0x51, 0x4d, 0x47, 0x41,
-  0x3d, 0x3a, 0x36, 0x2f, 0x25, 0x1c, 0x19, 0x13, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x12, 0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12, 0x13,
-  0x58, 0x58, 0x59, 0x59, 0x59, 0x58, 0x58, 0x5a, 0x5a, 0x5c, 0x5e, 0x61,
-  0x62, 0x63, 0x64, 0x66, 0x68, 0x68, 0x69, 0x6a, 0x6c, 0x6c, 0x6e, 0x6e,
-  0x6d, 0x6d, 0x6c, 0x6b, 0x6c, 0x6d, 0x6d, 0x6e, 0x6d, 0x6d, 0x6c, 0x6d,
-  0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6d, 0x6d, 0x6e,
-  0x6f, 0x71, 0x73, 0x76, 0x79, 0x7c, 0x7e, 0x83, 0x87, 0x8a, 0x8c, 0x8e,
-  0x8f, 0x91, 0x91, 0x92, 0x94, 0x96, 0x95, 0x98, 0x99, 0x9a, 0x9a, 0x98,
-  0x98, 0x96, 0x94, 0x91, 0x8d, 0x8c, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8b,
-  0x8a, 0x89, 0x8a, 0x8c, 0x8c, 0x8d, 0x8c, 0x8d, 0x8c, 0x8b, 0x89, 0x87,
-  0x86, 0x82, 0x81, 0x81, 0x7f, 0x7c, 0x79, 0x7a, 0x7f, 0x8b, 0x9a, 0xa4,
-  0xa9, 0xb0, 0xb9, 0xb3, 0xc9, 0xc0, 0xbd, 0xc9, 0xda, 0xdc, 0xc5, 0xc2,
-  0xd2, 0xca, 0xa3, 0x96, 0x8f, 0x7b, 0x57, 0x95, 0xc3, 0xc2, 0xc6, 0xd3,
-  0xc9, 0xbb, 0xb2, 0xae, 0xac, 0xa9, 0x9f, 0x9a, 0x94, 0x88, 0x83, 0x88,
-  0x88, 0x89, 0x8b, 0x90, 0x97, 0x9f, 0x9f, 0x99, 0x8f, 0x7e, 0x70, 0x68,
-  0x5f, 0x62, 0x70, 0x78, 0x7a, 0x78, 0x6d, 0x66, 0x61, 0x5f, 0x5e, 0x61,
-  0x63, 0x67, 0x6b, 0x6f, 0x79, 0x7c, 0x7a, 0x78, 0x76, 0x7b, 0x7f, 0x7f,
-  0x7e, 0x7f, 0x85, 0x82, 0x84, 0x89, 0x91, 0x96, 0x9c, 0x9d, 0x9c, 0x99,
-  0x99, 0xa0, 0xa9, 0xad, 0xb3, 0xbd, 0xc2, 0xbf, 0xc1, 0xc6, 0xcc, 0xce,
-  0xca, 0xc9, 0xc6, 0xbd, 0xa0, 0x75, 0x8c, 0x89, 0x5c, 0x48, 0x7a, 0x99,
-  0xa0, 0x9a, 0x92, 0x92, 0x8e, 0x71, 0x31, 0x18, 0x21, 0x2e, 0x2e, 0x21,
-  0x17, 0x11, 0x10, 0x12, 0x22, 0x5a, 0x7d, 0x7c, 0x77, 0x71, 0x6a, 0x65,
-  0x62, 0x61, 0x60, 0x5c, 0x5a, 0x5a, 0x5b, 0x5c, 0x5e, 0x5f, 0x61, 0x61,
-  0x60, 0x61, 0x63, 0x64, 0x64, 0x65, 0x66, 0x66, 0x68, 0x6a, 0x6a, 0x6a,
-  0x6c, 0x6e, 0x6e, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x72, 0x72, 0x73, 0x73,
-  0x73, 0x73, 0x74, 0x74, 0x74, 0x75, 0x74, 0x72, 0x6f, 0x6b, 0x68, 0x65,
-  0x62, 0x5d, 0x58, 0x53, 0x50, 0x4d, 0x47, 0x40, 0x3d, 0x3b, 0x36, 0x30,
-  0x25, 0x1d, 0x19, 0x14, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x12, 0x12,
-  0x12, 0x11, 0x13, 0x13, 0x13, 0x12, 0x12, 0x13, 0x58, 0x58, 0x59, 0x59,
-  0x59, 0x58, 0x58, 0x5a, 0x5a, 0x5c, 0x5e, 0x60, 0x62, 0x63, 0x64, 0x65,
-  0x66, 0x68, 0x69, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f, 0x6d, 0x6d, 0x6d, 0x6d,
-  0x6d, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6c, 0x6c, 0x6b, 0x6c, 0x6c, 0x6b,
-  0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6e, 0x70, 0x72, 0x74, 0x76,
-  0x7a, 0x7c, 0x7f, 0x82, 0x86, 0x89, 0x8b, 0x8d, 0x8f, 0x90, 0x91, 0x92,
-  0x94, 0x95, 0x95, 0x97, 0x99, 0x99, 0x99, 0x98, 0x97, 0x95, 0x93, 0x91,
-  0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8c, 0x8c, 0x8b, 0x8b, 0x8d, 0x8e,
-  0x8f, 0x8f, 0x8e, 0x8f, 0x8e, 0x8c, 0x8b, 0x8a, 0x87, 0x84, 0x81, 0x7f,
-  0x7d, 0x78, 0x77, 0x7c, 0x83, 0x91, 0xa0, 0xa8, 0xad, 0xb3, 0xb8, 0xb6,
-  0xc7, 0xc4, 0xbf, 0xc1, 0xdb, 0xd8, 0xbf, 0xbd, 0xd0, 0xd1, 0xcb, 0xc3,
-  0xb4, 0x8e, 0x73, 0xa3, 0xbd, 0xb9, 0xbc, 0xcb, 0xcd, 0xc1, 0xb3, 0xae,
-  0xad, 0xac, 0xa3, 0x9f, 0x99, 0x8d, 0x83, 0x89, 0x8b, 0x8c, 0x8d, 0x8d,
-  0x8f, 0x93, 0x93, 0x8f, 0x8d, 0x83, 0x77, 0x70, 0x69, 0x66, 0x6f, 0x76,
-  0x79, 0x7a, 0x73, 0x6d, 0x68, 0x65, 0x61, 0x62, 0x61, 0x60, 0x62, 0x69,
-  0x75, 0x7c, 0x7d, 0x7a, 0x77, 0x7a, 0x80, 0x7f, 0x7e, 0x7f, 0x85, 0x89,
-  0x87, 0x88, 0x8d, 0x93, 0x99, 0x99, 0x98, 0x98, 0x99, 0x9d, 0xa9, 0xb2,
-  0xb7, 0xbe, 0xc5, 0xc3, 0xc3, 0xc6, 0xcc, 0xce, 0xc6, 0xc2, 0xbf, 0xb4,
-  0x98, 0x77, 0x96, 0x8e, 0x4f, 0x43, 0x7a, 0x98, 0x99, 0x8e, 0x97, 0x85,
-  0x68, 0x4c, 0x23, 0x19, 0x1e, 0x2d, 0x2e, 0x20, 0x14, 0x10, 0x10, 0x12,
-  0x1e, 0x4d, 0x7c, 0x7e, 0x79, 0x72, 0x6b, 0x68, 0x65, 0x64, 0x62, 0x5e,
-  0x5a, 0x5a, 0x5a, 0x5b, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x63, 0x64,
-  0x65, 0x66, 0x66, 0x65, 0x66, 0x69, 0x6a, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f,
-  0x70, 0x71, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73,
-  0x74, 0x74, 0x73, 0x72, 0x6d, 0x6b, 0x68, 0x66, 0x62, 0x5d, 0x57, 0x52,
-  0x50, 0x4b, 0x46, 0x40, 0x3d, 0x3a, 0x37, 0x2f, 0x25, 0x1d, 0x19, 0x14,
-  0x12, 0x11, 0x11, 0x10, 0x10, 0x10, 0x12, 0x12, 0x12, 0x11, 0x12, 0x14,
-  0x13, 0x13, 0x12, 0x14, 0x57, 0x57, 0x58, 0x58, 0x57, 0x59, 0x59, 0x5a,
-  0x5b, 0x5b, 0x5c, 0x5e, 0x60, 0x62, 0x63, 0x63, 0x65, 0x67, 0x68, 0x69,
-  0x6b, 0x6c, 0x6e, 0x6f, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e,
-  0x6d, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6c, 0x6c,
-  0x6c, 0x6c, 0x6c, 0x6e, 0x70, 0x72, 0x76, 0x79, 0x7c, 0x7f, 0x80, 0x83,
-  0x86, 0x88, 0x8a, 0x8c, 0x8d, 0x8f, 0x91, 0x92, 0x92, 0x93, 0x93, 0x96,
-  0x97, 0x98, 0x99, 0x99, 0x97, 0x95, 0x93, 0x90, 0x8e, 0x8c, 0x8c, 0x8c,
-  0x8b, 0x8d, 0x8d, 0x8c, 0x8c, 0x8d, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x93,
-  0x91, 0x8e, 0x8d, 0x8c, 0x89, 0x85, 0x81, 0x7e, 0x7a, 0x75, 0x79, 0x83,
-  0x8c, 0x99, 0xa5, 0xab, 0xb3, 0xb5, 0xb3, 0xb5, 0xba, 0xb7, 0xb8, 0xc1,
-  0xd3, 0xd0, 0xce, 0xc7, 0xb6, 0xbc, 0xcd, 0xda, 0xd8, 0xc8, 0xb9, 0xab,
-  0xa5, 0xa6, 0xae, 0xc0, 0xd1, 0xc8, 0xb7, 0xaf, 0xa9, 0xaa, 0xab, 0xa4,
-  0x9a, 0x8a, 0x84, 0x8c, 0x91, 0x90, 0x8c, 0x8d, 0x8b, 0x8b, 0x8a, 0x88,
-  0x88, 0x85, 0x80, 0x7b, 0x74, 0x6f, 0x74, 0x78, 0x7a, 0x7b, 0x77, 0x74,
-  0x6e, 0x69, 0x66, 0x65, 0x61, 0x5b, 0x5b, 0x60, 0x6a, 0x72, 0x77, 0x78,
-  0x78, 0x7b, 0x81, 0x81, 0x7f, 0x80, 0x85, 0x8a, 0x87, 0x88, 0x8e, 0x94,
-  0x97, 0x96, 0x96, 0x98, 0x9b, 0xa0, 0xaa, 0xb3, 0xb8, 0xbf, 0xc7, 0xcb,
-  0xc9, 0xc9, 0xc9, 0xc8, 0xc3, 0xc1, 0xbe, 0xb0, 0x8e, 0x77, 0x97, 0x8c,
-  0x4b, 0x46, 0x80, 0x8e, 0x8b, 0x85, 0x93, 0x82, 0x49, 0x29, 0x17, 0x15,
-  0x1c, 0x26, 0x29, 0x22, 0x15, 0x10, 0x11, 0x12, 0x1a, 0x42, 0x79, 0x7e,
-  0x7a, 0x74, 0x6e, 0x6b, 0x69, 0x67, 0x65, 0x60, 0x5d, 0x5b, 0x5b, 0x5c,
-  0x5d, 0x5e, 0x5f, 0x61, 0x63, 0x63, 0x63, 0x64, 0x65, 0x65, 0x66, 0x66,
-  0x67, 0x69, 0x69, 0x69, 0x6a, 0x6b, 0x6d, 0x6e, 0x70, 0x71, 0x73, 0x72,
-  0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x73, 0x74, 0x74, 0x73, 0x72,
-  0x6e, 0x6b, 0x68, 0x66, 0x64, 0x5e, 0x58, 0x52, 0x50, 0x4c, 0x45, 0x40,
-  0x3c, 0x3a, 0x36, 0x2e, 0x25, 0x1f, 0x1a, 0x14, 0x13, 0x12, 0x11, 0x10,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x14, 0x13, 0x13, 0x12, 0x13,
-  0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5e,
-  0x60, 0x60, 0x62, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6a, 0x6c, 0x6d, 0x6e,
-  0x6e, 0x6f, 0x70, 0x70, 0x70, 0x6f, 0x70, 0x6f, 0x6e, 0x6e, 0x6d, 0x6e,
-  0x6d, 0x6d, 0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6d, 0x6c, 0x6e,
-  0x71, 0x75, 0x77, 0x7a, 0x7d, 0x7f, 0x81, 0x83, 0x86, 0x88, 0x8a, 0x8c,
-  0x8d, 0x8f, 0x90, 0x91, 0x91, 0x92, 0x92, 0x94, 0x97, 0x98, 0x99, 0x99,
-  0x96, 0x93, 0x91, 0x90, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x8d,
-  0x8d, 0x8e, 0x8f, 0x91, 0x93, 0x93, 0x94, 0x94, 0x92, 0x91, 0x90, 0x8d,
-  0x89, 0x85, 0x80, 0x7d, 0x7a, 0x77, 0x7e, 0x8b, 0x94, 0xa0, 0xa8, 0xac,
-  0xb5, 0xb7, 0xaf, 0xa2, 0xa4, 0x96, 0x9c, 0xbb, 0xc8, 0xc9, 0xc8, 0xb9,
-  0x9c, 0xa7, 0xb0, 0xcd, 0xd9, 0xda, 0xd1, 0x99, 0x70, 0x91, 0xa8, 0xb7,
-  0xcc, 0xc9, 0xb9, 0xae, 0xa7, 0xab, 0xb1, 0xa3, 0x97, 0x8d, 0x8b, 0x91,
-  0x92, 0x93, 0x95, 0x95, 0x8f, 0x89, 0x86, 0x87, 0x89, 0x87, 0x83, 0x80,
-  0x7c, 0x7a, 0x7d, 0x7e, 0x7f, 0x7e, 0x79, 0x79, 0x73, 0x70, 0x70, 0x70,
-  0x69, 0x60, 0x5d, 0x5e, 0x64, 0x6d, 0x70, 0x71, 0x74, 0x79, 0x7f, 0x80,
-  0x80, 0x83, 0x87, 0x8b, 0x8d, 0x8d, 0x90, 0x95, 0x95, 0x90, 0x90, 0x95,
-  0x9b, 0xa3, 0xab, 0xb2, 0xb6, 0xbc, 0xc9, 0xcd, 0xc9, 0xc6, 0xc6, 0xc6,
-  0xc1, 0xc1, 0xbe, 0xad, 0x85, 0x82, 0x9d, 0x8d, 0x4b, 0x4c, 0x81, 0x81,
-  0x7b, 0x81, 0x93, 0x6f, 0x40, 0x28, 0x17, 0x14, 0x1b, 0x1d, 0x1f, 0x23,
-  0x16, 0x10, 0x10, 0x10, 0x17, 0x3c, 0x76, 0x7d, 0x78, 0x73, 0x70, 0x6f,
-  0x6d, 0x6c, 0x6a, 0x64, 0x60, 0x5e, 0x5d, 0x5c, 0x5d, 0x5e, 0x5f, 0x60,
-  0x61, 0x63, 0x64, 0x66, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a,
-  0x6a, 0x6b, 0x6c, 0x6d, 0x6f, 0x70, 0x71, 0x70, 0x71, 0x72, 0x73, 0x74,
-  0x73, 0x73, 0x73, 0x74, 0x74, 0x73, 0x72, 0x70, 0x6e, 0x6b, 0x69, 0x67,
-  0x64, 0x5f, 0x59, 0x53, 0x4f, 0x4b, 0x47, 0x41, 0x3c, 0x39, 0x36, 0x2d,
-  0x26, 0x1f, 0x1a, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x13, 0x12, 0x13, 0x12, 0x11, 0x12, 0x54, 0x56, 0x55, 0x55,
-  0x56, 0x58, 0x59, 0x59, 0x5a, 0x5a, 0x5b, 0x5d, 0x5f, 0x60, 0x62, 0x63,
-  0x64, 0x66, 0x68, 0x69, 0x6b, 0x6c, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f,
-  0x6f, 0x6f, 0x70, 0x70, 0x70, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6f,
-  0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x70, 0x75, 0x78, 0x7b,
-  0x7d, 0x7e, 0x81, 0x83, 0x86, 0x88, 0x89, 0x8b, 0x8c, 0x8e, 0x8f, 0x90,
-  0x90, 0x91, 0x91, 0x94, 0x97, 0x98, 0x98, 0x99, 0x96, 0x92, 0x91, 0x8f,
-  0x90, 0x8f, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8e, 0x8e, 0x8f, 0x90, 0x93,
-  0x95, 0x95, 0x96, 0x96, 0x94, 0x93, 0x92, 0x8e, 0x89, 0x85, 0x80, 0x7e,
-  0x7a, 0x7a, 0x85, 0x92, 0x9a, 0xa3, 0xa9, 0xaa, 0xac, 0xae, 0xb1, 0xab,
-  0x90, 0x80, 0x89, 0xab, 0xbd, 0xc9, 0xc6, 0xc0, 0xb6, 0xac, 0xae, 0xbf,
-  0xc5, 0xc5, 0xd4, 0xa6, 0x5b, 0x81, 0x9e, 0xaf, 0xc6, 0xca, 0xbb, 0xb1,
-  0xaa, 0xb3, 0xb3, 0xa7, 0x9d, 0x93, 0x91, 0x96, 0x94, 0x97, 0xa0, 0x9e,
-  0x92, 0x89, 0x86, 0x85, 0x86, 0x87, 0x84, 0x82, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x7c, 0x78, 0x75, 0x73, 0x75, 0x77, 0x71, 0x6a, 0x65, 0x60,
-  0x65, 0x6f, 0x6f, 0x6f, 0x72, 0x76, 0x7d, 0x80, 0x81, 0x84, 0x89, 0x8b,
-  0x90, 0x91, 0x91, 0x94, 0x93, 0x8d, 0x8e, 0x94, 0x99, 0xa3, 0xa9, 0xaf,
-  0xb5, 0xc0, 0xcb, 0xcb, 0xc6, 0xc4, 0xc3, 0xc3, 0xbe, 0xbd, 0xba, 0xa7,
-  0x7d, 0x85, 0xa3, 0x90, 0x4a, 0x4b, 0x74, 0x7c, 0x7b, 0x81, 0x90, 0x4c,
-  0x2b, 0x20, 0x1a, 0x18, 0x1d, 0x1b, 0x1d, 0x23, 0x16, 0x11, 0x10, 0x10,
-  0x16, 0x39, 0x75, 0x7c, 0x79, 0x74, 0x72, 0x71, 0x70, 0x70, 0x6d, 0x67,
-  0x62, 0x5e, 0x5d, 0x5d, 0x5e, 0x5f, 0x61, 0x61, 0x62, 0x63, 0x64, 0x66,
-  0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6c, 0x6c, 0x6d,
-  0x6e, 0x6f, 0x70, 0x70, 0x71, 0x73, 0x74, 0x74, 0x73, 0x73, 0x72, 0x72,
-  0x73, 0x73, 0x72, 0x70, 0x6e, 0x6b, 0x69, 0x68, 0x64, 0x5f, 0x59, 0x53,
-  0x4f, 0x4b, 0x47, 0x42, 0x3d, 0x39, 0x36, 0x2e, 0x27, 0x20, 0x1b, 0x14,
-  0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13,
-  0x12, 0x11, 0x11, 0x13, 0x55, 0x56, 0x55, 0x55, 0x55, 0x58, 0x59, 0x59,
-  0x59, 0x5a, 0x5b, 0x5d, 0x5f, 0x60, 0x62, 0x62, 0x63, 0x65, 0x67, 0x69,
-  0x6b, 0x6c, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x70,
-  0x70, 0x70, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6d, 0x6d,
-  0x6d, 0x6d, 0x6c, 0x6d, 0x70, 0x75, 0x79, 0x7c, 0x7d, 0x7e, 0x81, 0x83,
-  0x86, 0x88, 0x88, 0x8a, 0x8b, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x94,
-  0x96, 0x97, 0x97, 0x97, 0x95, 0x91, 0x91, 0x8f, 0x90, 0x8f, 0x8d, 0x8d,
-  0x8d, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x92, 0x95, 0x97, 0x97, 0x96, 0x96,
-  0x94, 0x93, 0x92, 0x8e, 0x89, 0x85, 0x81, 0x7e, 0x7b, 0x7c, 0x89, 0x97,
-  0x9e, 0xa5, 0xa9, 0xaa, 0xaa, 0xad, 0xb8, 0xb8, 0x99, 0x8c, 0x90, 0xa1,
-  0xac, 0xbc, 0xc3, 0xc5, 0xc2, 0xae, 0xb4, 0xbb, 0xb7, 0xb1, 0xcb, 0xad,
-  0x5a, 0x73, 0x8f, 0xa8, 0xc2, 0xcb, 0xbf, 0xb6, 0xaf, 0xb6, 0xb3, 0xaa,
-  0xa2, 0x97, 0x95, 0x98, 0x95, 0x99, 0xa5, 0xa2, 0x93, 0x88, 0x85, 0x83,
-  0x83, 0x87, 0x85, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x80, 0x7e, 0x79,
-  0x77, 0x77, 0x77, 0x79, 0x75, 0x6f, 0x6a, 0x64, 0x67, 0x70, 0x71, 0x70,
-  0x72, 0x75, 0x7b, 0x80, 0x82, 0x84, 0x88, 0x8b, 0x91, 0x93, 0x92, 0x94,
-  0x92, 0x8e, 0x8f, 0x93, 0x98, 0xa0, 0xa7, 0xae, 0xb6, 0xc1, 0xc9, 0xc9,
-  0xc4, 0xc2, 0xbf, 0xbd, 0xba, 0xb9, 0xb6, 0xa5, 0x7c, 0x85, 0xa2, 0x8e,
-  0x48, 0x49, 0x6f, 0x7c, 0x7e, 0x82, 0x84, 0x39, 0x20, 0x1d, 0x1c, 0x1d,
-  0x22, 0x1e, 0x1e, 0x22, 0x16, 0x11, 0x10, 0x10, 0x16, 0x39, 0x74, 0x7c,
-  0x79, 0x73, 0x72, 0x73, 0x72, 0x71, 0x6f, 0x69, 0x63, 0x5f, 0x5d, 0x5d,
-  0x5f, 0x60, 0x61, 0x61, 0x62, 0x64, 0x65, 0x67, 0x67, 0x68, 0x69, 0x69,
-  0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6c, 0x6c, 0x6d, 0x6e, 0x6e, 0x70, 0x70,
-  0x71, 0x72, 0x73, 0x74, 0x73, 0x73, 0x72, 0x72, 0x73, 0x73, 0x72, 0x70,
-  0x6e, 0x6b, 0x69, 0x68, 0x64, 0x5f, 0x59, 0x53, 0x50, 0x4c, 0x47, 0x42,
-  0x3d, 0x3a, 0x37, 0x2f, 0x27, 0x20, 0x1b, 0x14, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x12, 0x11, 0x11, 0x13,
-  0x56, 0x57, 0x56, 0x55, 0x55, 0x57, 0x58, 0x58, 0x58, 0x5a, 0x5b, 0x5d,
-  0x5e, 0x60, 0x61, 0x61, 0x63, 0x64, 0x66, 0x69, 0x6b, 0x6c, 0x6d, 0x6d,
-  0x6e, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x6f, 0x70, 0x70, 0x70, 0x6f, 0x70,
-  0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6d, 0x6c, 0x6d, 0x6c, 0x6e,
-  0x71, 0x75, 0x7a, 0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x85, 0x87, 0x88, 0x8a,
-  0x8b, 0x8c, 0x8e, 0x8f, 0x90, 0x90, 0x91, 0x95, 0x97, 0x97, 0x98, 0x96,
-  0x93, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8d, 0x8d, 0x8e, 0x8d, 0x8d, 0x8f,
-  0x8f, 0x90, 0x92, 0x96, 0x98, 0x98, 0x96, 0x97, 0x95, 0x93, 0x92, 0x8f,
-  0x89, 0x85, 0x82, 0x80, 0x7d, 0x81, 0x8f, 0x9c, 0xa2, 0xa6, 0xa9, 0xab,
-  0xaa, 0xac, 0xb4, 0xb5, 0xab, 0xa8, 0xa6, 0x9f, 0x94, 0x9d, 0xb6, 0xbe,
-  0xb5, 0xa7, 0xbd, 0xbf, 0xb4, 0xa2, 0xb4, 0xad, 0x64, 0x5a, 0x6e, 0x9c,
-  0xb9, 0xca, 0xc5, 0xbe, 0xb5, 0xb8, 0xb6, 0xb0, 0xa8, 0x9d, 0x9b, 0x9a,
-  0x97, 0x9c, 0xa9, 0xa6, 0x94, 0x87, 0x82, 0x7f, 0x7e, 0x88, 0x87, 0x83,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x7e, 0x7d, 0x7e, 0x7d, 0x7a, 0x7a,
-  0x78, 0x74, 0x71, 0x6c, 0x6a, 0x6f, 0x74, 0x75, 0x74, 0x75, 0x7a, 0x80,
-  0x82, 0x84, 0x86, 0x8a, 0x90, 0x92, 0x91, 0x91, 0x90, 0x91, 0x91, 0x93,
-  0x98, 0x9e, 0xa2, 0xaf, 0xb8, 0xbf, 0xc4, 0xc5, 0xc3, 0xbf, 0xb9, 0xb5,
-  0xb5, 0xb5, 0xb3, 0xa5, 0x80, 0x84, 0x9a, 0x87, 0x45, 0x49, 0x72, 0x81,
-  0x85, 0x83, 0x64, 0x28, 0x1d, 0x1e, 0x22, 0x23, 0x27, 0x21, 0x21, 0x22,
-  0x15, 0x10, 0x10, 0x10, 0x17, 0x3a, 0x73, 0x7c, 0x79, 0x74, 0x74, 0x74,
-  0x74, 0x74, 0x73, 0x6d, 0x64, 0x5f, 0x5d, 0x5c, 0x5e, 0x60, 0x61, 0x62,
-  0x63, 0x65, 0x66, 0x68, 0x68, 0x69, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
-  0x6b, 0x6c, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x70, 0x71, 0x72, 0x73, 0x74,
-  0x73, 0x73, 0x72, 0x72, 0x73, 0x72, 0x72, 0x70, 0x6e, 0x6a, 0x69, 0x68,
-  0x64, 0x5e, 0x5a, 0x56, 0x52, 0x4d, 0x47, 0x41, 0x3d, 0x3a, 0x37, 0x2e,
-  0x26, 0x1e, 0x19, 0x14, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11,
-  0x11, 0x13, 0x13, 0x12, 0x12, 0x12, 0x12, 0x13, 0x57, 0x57, 0x57, 0x57,
-  0x57, 0x57, 0x56, 0x56, 0x58, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x61, 0x61,
-  0x64, 0x65, 0x66, 0x67, 0x69, 0x6a, 0x6c, 0x6d, 0x6d, 0x6f, 0x70, 0x71,
-  0x71, 0x71, 0x70, 0x71, 0x70, 0x70, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x70,
-  0x70, 0x6f, 0x6e, 0x6d, 0x6c, 0x6c, 0x6d, 0x70, 0x72, 0x76, 0x7a, 0x7d,
-  0x7e, 0x7f, 0x82, 0x83, 0x85, 0x88, 0x8a, 0x8b, 0x8b, 0x8d, 0x8e, 0x8e,
-  0x8f, 0x8f, 0x91, 0x94, 0x96, 0x97, 0x98, 0x96, 0x93, 0x92, 0x91, 0x8f,
-  0x8d, 0x8c, 0x8d, 0x8d, 0x8e, 0x8d, 0x8d, 0x8f, 0x90, 0x93, 0x94, 0x98,
-  0x99, 0x99, 0x99, 0x98, 0x96, 0x93, 0x91, 0x8d, 0x8b, 0x87, 0x85, 0x83,
-  0x83, 0x89, 0x96, 0xa2, 0xa6, 0xa7, 0xaa, 0xa9, 0x93, 0x7f, 0x66, 0x58,
-  0x53, 0x68, 0x7f, 0x9e, 0xa5, 0x97, 0x95, 0x97, 0x9c, 0xa2, 0xb4, 0xcb,
-  0xcc, 0xb6, 0xa7, 0xb7, 0x84, 0x4a, 0x50, 0x8e, 0xab, 0xc5, 0xc5, 0xbf,
-  0xb4, 0xb4, 0xb6, 0xb2, 0xae, 0xa5, 0x9f, 0xa0, 0xa3, 0xa6, 0xaa, 0xa8,
-  0x9e, 0x8e, 0x86, 0x80, 0x7d, 0x84, 0x88, 0x87, 0x82, 0x82, 0x81, 0x82,
-  0x83, 0x85, 0x81, 0x7f, 0x81, 0x83, 0x82, 0x81, 0x7f, 0x7b, 0x78, 0x74,
-  0x6f, 0x71, 0x77, 0x79, 0x77, 0x76, 0x79, 0x7e, 0x82, 0x87, 0x8a, 0x8b,
-  0x8b, 0x8a, 0x8a, 0x8b, 0x8c, 0x90, 0x92, 0x93, 0x99, 0xa1, 0xa6, 0xac,
-  0xb1, 0xba, 0xc0, 0xbf, 0xbf, 0xbc, 0xb5, 0xae, 0xaa, 0xaf, 0xb0, 0xa6,
-  0x87, 0x7e, 0x91, 0x7d, 0x3e, 0x47, 0x74, 0x8a, 0x8d, 0x7b, 0x3c, 0x19,
-  0x1c, 0x23, 0x28, 0x23, 0x22, 0x23, 0x23, 0x20, 0x14, 0x10, 0x10, 0x11,
-  0x17, 0x3c, 0x72, 0x7a, 0x78, 0x74, 0x75, 0x76, 0x79, 0x7a, 0x79, 0x71,
-  0x67, 0x61, 0x5f, 0x5c, 0x5f, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69,
-  0x6a, 0x6a, 0x6a, 0x6b, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6e,
-  0x6f, 0x6f, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x74, 0x73, 0x74, 0x73, 0x74,
-  0x74, 0x73, 0x72, 0x70, 0x6f, 0x6d, 0x6a, 0x68, 0x64, 0x5e, 0x5a, 0x56,
-  0x53, 0x4e, 0x47, 0x41, 0x3c, 0x3a, 0x37, 0x2f, 0x26, 0x1e, 0x1a, 0x15,
-  0x12, 0x11, 0x12, 0x12, 0x12, 0x11, 0x10, 0x11, 0x11, 0x13, 0x13, 0x13,
-  0x12, 0x12, 0x12, 0x11, 0x57, 0x58, 0x58, 0x58, 0x58, 0x57, 0x56, 0x57,
-  0x58, 0x5a, 0x5c, 0x5d, 0x5e, 0x5e, 0x60, 0x61, 0x64, 0x65, 0x66, 0x67,
-  0x68, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x70, 0x71, 0x72,
-  0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x71, 0x71, 0x70, 0x6f,
-  0x6e, 0x6d, 0x6e, 0x71, 0x73, 0x76, 0x7a, 0x7d, 0x7e, 0x7f, 0x82, 0x83,
-  0x85, 0x88, 0x8a, 0x8a, 0x8a, 0x8b, 0x8c, 0x8e, 0x90, 0x90, 0x91, 0x94,
-  0x96, 0x96, 0x96, 0x94, 0x94, 0x92, 0x91, 0x90, 0x8d, 0x8d, 0x8e, 0x8e,
-  0x8e, 0x8d, 0x8e, 0x90, 0x91, 0x93, 0x95, 0x99, 0x9a, 0x9a, 0x99, 0x98,
-  0x96, 0x93, 0x90, 0x8d, 0x8b, 0x8a, 0x88, 0x87, 0x87, 0x8f, 0x9c, 0xa5,
-  0xa8, 0xaa, 0xa5, 0x88, 0x5b, 0x48, 0x43, 0x3b, 0x36, 0x5e, 0x6a, 0x65,
-  0x8d, 0xb0, 0xa0, 0x8b, 0x77, 0x95, 0xb5, 0xcf, 0xd5, 0xc8, 0xb9, 0xb7,
-  0x97, 0x4f, 0x4c, 0x8c, 0xa6, 0xc0, 0xc6, 0xc0, 0xb4, 0xae, 0xb1, 0xb5,
-  0xb4, 0xad, 0xa4, 0xa5, 0xab, 0xad, 0xac, 0xad, 0xaa, 0x97, 0x8b, 0x80,
-  0x7c, 0x7c, 0x83, 0x85, 0x86, 0x83, 0x7e, 0x7f, 0x81, 0x86, 0x85, 0x81,
-  0x7f, 0x7f, 0x82, 0x88, 0x89, 0x83, 0x7e, 0x77, 0x70, 0x73, 0x78, 0x7a,
-  0x7c, 0x7d, 0x7f, 0x81, 0x85, 0x8c, 0x8e, 0x8d, 0x8a, 0x88, 0x87, 0x89,
-  0x8b, 0x8c, 0x8e, 0x93, 0x9e, 0xab, 0xab, 0xaa, 0xae, 0xb8, 0xc0, 0xbc,
-  0xb9, 0xb5, 0xaf, 0xa6, 0xa0, 0xa4, 0xa7, 0xa6, 0x8f, 0x78, 0x81, 0x6e,
-  0x37, 0x3b, 0x70, 0x82, 0x84, 0x72, 0x2c, 0x15, 0x1d, 0x24, 0x2b, 0x28,
-  0x22, 0x22, 0x23, 0x20, 0x14, 0x10, 0x10, 0x11, 0x19, 0x40, 0x70, 0x78,
-  0x77, 0x74, 0x74, 0x78, 0x7c, 0x7e, 0x7d, 0x76, 0x6b, 0x63, 0x5f, 0x5d,
-  0x5f, 0x61, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6b, 0x6a, 0x6b, 0x6b, 0x6d,
-  0x6f, 0x6f, 0x6f, 0x6e, 0x6f, 0x70, 0x71, 0x70, 0x6f, 0x6f, 0x6e, 0x6f,
-  0x70, 0x70, 0x70, 0x73, 0x73, 0x74, 0x73, 0x74, 0x73, 0x73, 0x72, 0x70,
-  0x6f, 0x6c, 0x69, 0x67, 0x64, 0x5e, 0x59, 0x55, 0x52, 0x4e, 0x47, 0x41,
-  0x3d, 0x3b, 0x38, 0x2f, 0x28, 0x20, 0x1b, 0x15, 0x12, 0x11, 0x11, 0x11,
-  0x12, 0x11, 0x11, 0x11, 0x12, 0x13, 0x12, 0x13, 0x13, 0x13, 0x12, 0x11,
-  0x58, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x58, 0x59, 0x5b, 0x5d,
-  0x5d, 0x5e, 0x60, 0x61, 0x64, 0x66, 0x66, 0x66, 0x68, 0x6b, 0x6c, 0x6d,
-  0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x70, 0x71, 0x72, 0x72, 0x72, 0x71, 0x71,
-  0x71, 0x72, 0x71, 0x71, 0x71, 0x71, 0x70, 0x6f, 0x6e, 0x6d, 0x6e, 0x71,
-  0x74, 0x76, 0x7a, 0x7d, 0x7e, 0x7f, 0x82, 0x84, 0x85, 0x87, 0x89, 0x8a,
-  0x8a, 0x8c, 0x8c, 0x8d, 0x8f, 0x90, 0x90, 0x94, 0x95, 0x95, 0x96, 0x94,
-  0x93, 0x92, 0x91, 0x90, 0x8e, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8f, 0x91,
-  0x93, 0x94, 0x96, 0x99, 0x9b, 0x9a, 0x99, 0x98, 0x95, 0x92, 0x90, 0x8d,
-  0x8b, 0x8b, 0x8a, 0x89, 0x8a, 0x92, 0x9e, 0xa6, 0xa9, 0xaa, 0x9f, 0x6f,
-  0x41, 0x35, 0x3f, 0x3f, 0x43, 0x6e, 0x6d, 0x46, 0x6e, 0xaf, 0xac, 0x94,
-  0x73, 0x91, 0xb9, 0xcd, 0xcf, 0xc8, 0xc3, 0xb6, 0xa2, 0x5f, 0x58, 0x8c,
-  0xa4, 0xbd, 0xc4, 0xc0, 0xb3, 0xab, 0xaf, 0xb7, 0xb7, 0xb0, 0xa9, 0xa7,
-  0xac, 0xaf, 0xae, 0xb0, 0xad, 0x9b, 0x8e, 0x7f, 0x7b, 0x7b, 0x81, 0x84,
-  0x86, 0x84, 0x7e, 0x7d, 0x80, 0x85, 0x86, 0x82, 0x7e, 0x7e, 0x83, 0x8a,
-  0x8c, 0x87, 0x81, 0x79, 0x72, 0x75, 0x79, 0x7b, 0x7f, 0x82, 0x84, 0x86,
-  0x89, 0x8f, 0x8f, 0x8d, 0x89, 0x88, 0x87, 0x89, 0x8c, 0x8c, 0x8e, 0x95,
-  0xa1, 0xae, 0xac, 0xaa, 0xad, 0xb6, 0xbf, 0xbc, 0xb6, 0xb2, 0xac, 0xa1,
-  0x9c, 0x9f, 0xa3, 0xa5, 0x91, 0x76, 0x7c, 0x6a, 0x36, 0x38, 0x6f, 0x7d,
-  0x7c, 0x6c, 0x28, 0x15, 0x1d, 0x25, 0x2a, 0x2b, 0x25, 0x24, 0x23, 0x1f,
-  0x14, 0x10, 0x11, 0x11, 0x1a, 0x43, 0x70, 0x77, 0x76, 0x74, 0x74, 0x78,
-  0x7d, 0x7f, 0x7f, 0x79, 0x6d, 0x64, 0x60, 0x5e, 0x60, 0x62, 0x63, 0x64,
-  0x66, 0x68, 0x6b, 0x6c, 0x6b, 0x6b, 0x6b, 0x6f, 0x70, 0x71, 0x71, 0x70,
-  0x70, 0x71, 0x72, 0x71, 0x6f, 0x6e, 0x6e, 0x70, 0x70, 0x71, 0x70, 0x72,
-  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x70, 0x6f, 0x6c, 0x69, 0x67,
-  0x64, 0x5e, 0x59, 0x55, 0x52, 0x4e, 0x47, 0x41, 0x3e, 0x3c, 0x37, 0x30,
-  0x28, 0x21, 0x1c, 0x15, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x13, 0x13, 0x13, 0x14, 0x14, 0x13, 0x13, 0x11, 0x59, 0x58, 0x58, 0x58,
-  0x58, 0x57, 0x57, 0x57, 0x58, 0x59, 0x5b, 0x5d, 0x5d, 0x5e, 0x5f, 0x61,
-  0x63, 0x65, 0x66, 0x66, 0x68, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x71,
-  0x71, 0x70, 0x71, 0x72, 0x72, 0x71, 0x71, 0x71, 0x70, 0x71, 0x71, 0x71,
-  0x72, 0x71, 0x70, 0x6f, 0x6f, 0x6d, 0x6e, 0x72, 0x74, 0x77, 0x7a, 0x7d,
-  0x7e, 0x7f, 0x82, 0x84, 0x85, 0x88, 0x89, 0x8a, 0x89, 0x8b, 0x8c, 0x8d,
-  0x8f, 0x90, 0x91, 0x94, 0x95, 0x95, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90,
-  0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8f, 0x91, 0x93, 0x94, 0x96, 0x99,
-  0x9b, 0x9b, 0x99, 0x98, 0x94, 0x93, 0x90, 0x8e, 0x8c, 0x8c, 0x8b, 0x8a,
-  0x8c, 0x94, 0xa0, 0xa7, 0xaa, 0xab, 0x98, 0x5f, 0x3c, 0x35, 0x3f, 0x42,
-  0x56, 0x7d, 0x74, 0x40, 0x56, 0x9a, 0xb1, 0xa5, 0x85, 0x94, 0xbb, 0xc7,
-  0xc6, 0xc1, 0xc6, 0xb7, 0xad, 0x76, 0x6a, 0x89, 0x9f, 0xba, 0xc1, 0xbe,
-  0xb1, 0xaa, 0xb2, 0xba, 0xba, 0xb3, 0xae, 0xaa, 0xae, 0xb0, 0xb1, 0xb0,
-  0xad, 0x9e, 0x90, 0x7d, 0x7a, 0x7d, 0x82, 0x85, 0x85, 0x84, 0x7f, 0x7f,
-  0x80, 0x85, 0x86, 0x82, 0x7f, 0x81, 0x85, 0x8b, 0x8d, 0x89, 0x84, 0x7b,
-  0x75, 0x78, 0x7a, 0x7c, 0x81, 0x84, 0x88, 0x8a, 0x8d, 0x90, 0x8f, 0x8d,
-  0x88, 0x87, 0x88, 0x89, 0x8e, 0x8e, 0x91, 0x97, 0xa3, 0xae, 0xac, 0xac,
-  0xae, 0xb5, 0xbb, 0xbb, 0xb6, 0xb1, 0xa9, 0x9e, 0x99, 0x9c, 0xa0, 0xa3,
-  0x90, 0x77, 0x7f, 0x6d, 0x38, 0x3a, 0x71, 0x7c, 0x79, 0x64, 0x25, 0x14,
-  0x1e, 0x25, 0x29, 0x29, 0x26, 0x25, 0x23, 0x1e, 0x14, 0x11, 0x11, 0x11,
-  0x1b, 0x46, 0x70, 0x78, 0x77, 0x74, 0x75, 0x7a, 0x7f, 0x81, 0x80, 0x7a,
-  0x6e, 0x65, 0x61, 0x5e, 0x60, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6b, 0x6c,
-  0x6b, 0x6b, 0x6c, 0x6f, 0x71, 0x71, 0x71, 0x70, 0x71, 0x72, 0x72, 0x71,
-  0x70, 0x6f, 0x6e, 0x70, 0x70, 0x71, 0x70, 0x72, 0x72, 0x73, 0x73, 0x73,
-  0x73, 0x73, 0x72, 0x70, 0x6f, 0x6c, 0x69, 0x67, 0x64, 0x5e, 0x5a, 0x56,
-  0x53, 0x4f, 0x47, 0x42, 0x3e, 0x3c, 0x38, 0x31, 0x29, 0x22, 0x1d, 0x16,
-  0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x14,
-  0x14, 0x14, 0x13, 0x11, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x57, 0x58, 0x58,
-  0x59, 0x59, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x63, 0x65, 0x66, 0x66,
-  0x68, 0x6a, 0x6c, 0x6c, 0x6d, 0x6f, 0x70, 0x71, 0x71, 0x70, 0x70, 0x71,
-  0x71, 0x70, 0x70, 0x70, 0x71, 0x71, 0x70, 0x70, 0x71, 0x70, 0x70, 0x70,
-  0x6f, 0x6d, 0x6e, 0x71, 0x74, 0x76, 0x7a, 0x7d, 0x7d, 0x7f, 0x82, 0x84,
-  0x86, 0x86, 0x87, 0x89, 0x8a, 0x8a, 0x8c, 0x8c, 0x8d, 0x8f, 0x90, 0x93,
-  0x94, 0x94, 0x94, 0x93, 0x92, 0x90, 0x8f, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d,
-  0x8d, 0x8f, 0x8f, 0x91, 0x92, 0x93, 0x97, 0x9a, 0x9a, 0x9a, 0x9a, 0x97,
-  0x94, 0x92, 0x92, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8f, 0x98, 0xa2, 0xa8,
-  0xac, 0xab, 0x85, 0x47, 0x40, 0x41, 0x3d, 0x43, 0x78, 0x95, 0x83, 0x43,
-  0x34, 0x71, 0xb2, 0xc2, 0xad, 0x98, 0xb9, 0xbf, 0xbb, 0xb9, 0xc6, 0xbe,
-  0xbe, 0x9c, 0x86, 0x7d, 0x94, 0xb0, 0xbb, 0xba, 0xae, 0xab, 0xb9, 0xbe,
-  0xbe, 0xb9, 0xb8, 0xb0, 0xb1, 0xb3, 0xb5, 0xb3, 0xae, 0xa3, 0x95, 0x7e,
-  0x7a, 0x81, 0x85, 0x84, 0x83, 0x85, 0x82, 0x81, 0x82, 0x84, 0x86, 0x82,
-  0x82, 0x84, 0x89, 0x89, 0x8d, 0x8d, 0x89, 0x80, 0x7b, 0x7d, 0x7d, 0x7f,
-  0x82, 0x85, 0x8b, 0x8e, 0x90, 0x90, 0x8d, 0x8a, 0x88, 0x88, 0x89, 0x8b,
-  0x8f, 0x93, 0x97, 0x9e, 0xa6, 0xac, 0xac, 0xaf, 0xb0, 0xb2, 0xb5, 0xb8,
-  0xb5, 0xb0, 0xa6, 0x9a, 0x95, 0x98, 0x9b, 0x9d, 0x8c, 0x7c, 0x86, 0x74,
-  0x3c, 0x3e, 0x75, 0x80, 0x74, 0x51, 0x1f, 0x15, 0x21, 0x27, 0x26, 0x25,
-  0x27, 0x27, 0x24, 0x1c, 0x14, 0x11, 0x10, 0x11, 0x1c, 0x49, 0x72, 0x78,
-  0x77, 0x74, 0x76, 0x7b, 0x81, 0x83, 0x83, 0x7c, 0x71, 0x66, 0x62, 0x60,
-  0x61, 0x64, 0x65, 0x66, 0x68, 0x6a, 0x6b, 0x6c, 0x6c, 0x6d, 0x6f, 0x6f,
-  0x71, 0x72, 0x72, 0x71, 0x73, 0x74, 0x73, 0x72, 0x72, 0x71, 0x70, 0x71,
-  0x71, 0x70, 0x70, 0x71, 0x71, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74, 0x72,
-  0x70, 0x6c, 0x6a, 0x69, 0x64, 0x60, 0x5c, 0x57, 0x54, 0x4f, 0x48, 0x43,
-  0x3e, 0x3b, 0x38, 0x31, 0x29, 0x22, 0x1d, 0x16, 0x11, 0x11, 0x12, 0x12,
-  0x11, 0x11, 0x11, 0x12, 0x12, 0x13, 0x14, 0x15, 0x14, 0x14, 0x12, 0x11,
-  0x59, 0x57, 0x57, 0x57, 0x57, 0x57, 0x59, 0x59, 0x59, 0x59, 0x5b, 0x5c,
-  0x5c, 0x5d, 0x60, 0x61, 0x63, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6a, 0x6a,
-  0x6c, 0x6d, 0x6f, 0x71, 0x71, 0x70, 0x71, 0x70, 0x70, 0x70, 0x71, 0x72,
-  0x71, 0x70, 0x71, 0x72, 0x71, 0x71, 0x70, 0x70, 0x70, 0x6f, 0x70, 0x72,
-  0x74, 0x76, 0x79, 0x7c, 0x7d, 0x7f, 0x82, 0x85, 0x86, 0x87, 0x87, 0x89,
-  0x89, 0x89, 0x8b, 0x8b, 0x8c, 0x8e, 0x91, 0x93, 0x93, 0x93, 0x93, 0x92,
-  0x90, 0x8f, 0x8e, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8f, 0x91,
-  0x92, 0x94, 0x97, 0x9a, 0x9b, 0x9b, 0x9a, 0x97, 0x94, 0x93, 0x92, 0x92,
-  0x90, 0x91, 0x90, 0x90, 0x95, 0x9e, 0xa7, 0xab, 0xaf, 0xa9, 0x6c, 0x37,
-  0x43, 0x45, 0x33, 0x3f, 0x88, 0xa4, 0x8d, 0x44, 0x30, 0x7b, 0xb4, 0xc7,
-  0xbf, 0x94, 0xa9, 0xbc, 0xc1, 0xc1, 0xc1, 0xc8, 0xb9, 0xa0, 0x82, 0x5f,
-  0x8d, 0xa3, 0xb5, 0xb7, 0xad, 0xb3, 0xbc, 0xc2, 0xc3, 0xc1, 0xc3, 0xbc,
-  0xb8, 0xb9, 0xb9, 0xba, 0xb6, 0xae, 0xa2, 0x8c, 0x7e, 0x7d, 0x80, 0x82,
-  0x86, 0x89, 0x86, 0x84, 0x83, 0x82, 0x84, 0x80, 0x81, 0x84, 0x89, 0x8a,
-  0x8b, 0x8c, 0x8a, 0x85, 0x83, 0x83, 0x82, 0x83, 0x84, 0x82, 0x85, 0x87,
-  0x8a, 0x8c, 0x89, 0x86, 0x87, 0x89, 0x8b, 0x8d, 0x90, 0x97, 0x9d, 0xa5,
-  0xa9, 0xad, 0xae, 0xb2, 0xb4, 0xb5, 0xb6, 0xb3, 0xb2, 0xae, 0xa4, 0x97,
-  0x8d, 0x8d, 0x91, 0x98, 0x8e, 0x84, 0x82, 0x6d, 0x3b, 0x3b, 0x75, 0x7b,
-  0x65, 0x36, 0x16, 0x18, 0x28, 0x2c, 0x24, 0x1f, 0x22, 0x23, 0x21, 0x1a,
-  0x14, 0x11, 0x10, 0x13, 0x20, 0x4f, 0x73, 0x78, 0x76, 0x74, 0x77, 0x7e,
-  0x84, 0x87, 0x87, 0x81, 0x74, 0x6b, 0x65, 0x61, 0x62, 0x64, 0x65, 0x66,
-  0x68, 0x6b, 0x6c, 0x6e, 0x70, 0x70, 0x71, 0x70, 0x71, 0x72, 0x73, 0x75,
-  0x75, 0x75, 0x75, 0x75, 0x74, 0x73, 0x71, 0x71, 0x70, 0x6f, 0x71, 0x70,
-  0x71, 0x71, 0x71, 0x73, 0x73, 0x74, 0x74, 0x72, 0x70, 0x6d, 0x6a, 0x68,
-  0x64, 0x60, 0x5c, 0x58, 0x54, 0x4e, 0x48, 0x44, 0x3f, 0x3d, 0x39, 0x32,
-  0x28, 0x22, 0x1d, 0x16, 0x12, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x12,
-  0x13, 0x14, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x59, 0x58, 0x59, 0x59,
-  0x58, 0x58, 0x58, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5f, 0x61,
-  0x63, 0x63, 0x64, 0x65, 0x67, 0x67, 0x69, 0x6a, 0x6c, 0x6d, 0x6e, 0x70,
-  0x70, 0x71, 0x71, 0x72, 0x71, 0x72, 0x73, 0x74, 0x72, 0x72, 0x73, 0x73,
-  0x73, 0x73, 0x73, 0x72, 0x71, 0x6f, 0x70, 0x72, 0x73, 0x75, 0x79, 0x7d,
-  0x7e, 0x80, 0x83, 0x85, 0x86, 0x86, 0x87, 0x88, 0x89, 0x89, 0x89, 0x8a,
-  0x8b, 0x8c, 0x90, 0x93, 0x93, 0x93, 0x93, 0x91, 0x8f, 0x8f, 0x8e, 0x8e,
-  0x8d, 0x8c, 0x8d, 0x8d, 0x8d, 0x8f, 0x8f, 0x91, 0x92, 0x94, 0x98, 0x9b,
-  0x9b, 0x9b, 0x99, 0x97, 0x94, 0x94, 0x94, 0x93, 0x92, 0x92, 0x94, 0x97,
-  0x9e, 0xa8, 0xaf, 0xb3, 0xb6, 0xa9, 0x5b, 0x33, 0x3e, 0x3c, 0x28, 0x3a,
-  0x8c, 0xab, 0x92, 0x49, 0x4c, 0xa3, 0xb8, 0xba, 0xb9, 0xa9, 0x98, 0xa0,
-  0xaa, 0xb3, 0xb2, 0xba, 0xaa, 0x9a, 0x7a, 0x4f, 0x87, 0x9c, 0xb2, 0xb6,
-  0xae, 0xb7, 0xba, 0xc0, 0xc3, 0xc5, 0xcb, 0xc6, 0xc0, 0xbe, 0xbb, 0xb7,
-  0xb5, 0xb0, 0xa7, 0x97, 0x85, 0x7c, 0x7c, 0x7e, 0x84, 0x8c, 0x8b, 0x89,
-  0x87, 0x85, 0x84, 0x81, 0x82, 0x83, 0x86, 0x8b, 0x8a, 0x88, 0x88, 0x88,
-  0x85, 0x84, 0x87, 0x89, 0x8b, 0x87, 0x86, 0x85, 0x85, 0x86, 0x87, 0x85,
-  0x87, 0x89, 0x8b, 0x8f, 0x96, 0x9b, 0x9e, 0xa3, 0xaa, 0xad, 0xaf, 0xb4,
-  0xb5, 0xb4, 0xb2, 0xb0, 0xb0, 0xab, 0x9d, 0x8c, 0x80, 0x7f, 0x84, 0x91,
-  0x95, 0x8c, 0x7b, 0x63, 0x38, 0x34, 0x67, 0x67, 0x52, 0x29, 0x15, 0x1c,
-  0x2d, 0x30, 0x25, 0x19, 0x1a, 0x1b, 0x1c, 0x1a, 0x16, 0x12, 0x12, 0x19,
-  0x31, 0x57, 0x74, 0x77, 0x76, 0x75, 0x79, 0x80, 0x85, 0x88, 0x89, 0x83,
-  0x77, 0x6e, 0x68, 0x62, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6c, 0x6c, 0x6e,
-  0x71, 0x71, 0x72, 0x71, 0x72, 0x74, 0x75, 0x76, 0x77, 0x77, 0x76, 0x76,
-  0x76, 0x76, 0x73, 0x71, 0x71, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x73,
-  0x73, 0x74, 0x74, 0x72, 0x70, 0x6d, 0x6a, 0x69, 0x65, 0x60, 0x5b, 0x57,
-  0x54, 0x4e, 0x4a, 0x45, 0x41, 0x3e, 0x39, 0x32, 0x28, 0x21, 0x1d, 0x17,
-  0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x14,
-  0x14, 0x14, 0x13, 0x14, 0x5a, 0x59, 0x5a, 0x5a, 0x59, 0x59, 0x57, 0x57,
-  0x57, 0x59, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x60, 0x62, 0x62, 0x63, 0x64,
-  0x65, 0x67, 0x6a, 0x6b, 0x6c, 0x6c, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x72,
-  0x72, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73,
-  0x70, 0x6f, 0x71, 0x72, 0x73, 0x75, 0x79, 0x7d, 0x7f, 0x80, 0x82, 0x84,
-  0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x8b, 0x8f, 0x92,
-  0x92, 0x92, 0x92, 0x90, 0x8f, 0x8f, 0x8f, 0x8d, 0x8c, 0x8c, 0x8d, 0x8d,
-  0x8d, 0x8e, 0x91, 0x92, 0x93, 0x95, 0x98, 0x9c, 0x9b, 0x9a, 0x98, 0x96,
-  0x95, 0x94, 0x94, 0x94, 0x93, 0x94, 0x99, 0x9e, 0xa6, 0xb0, 0xb6, 0xb9,
-  0xba, 0xa8, 0x55, 0x33, 0x3e, 0x3c, 0x2a, 0x3a, 0x8f, 0xae, 0x96, 0x57,
-  0x73, 0xb4, 0xbd, 0xb6, 0xa8, 0x98, 0xa7, 0xa3, 0xa7, 0xbb, 0xbe, 0xb3,
-  0xae, 0xa9, 0x88, 0x4e, 0x7a, 0x92, 0xad, 0xb5, 0xb0, 0xb8, 0xb8, 0xbe,
-  0xc2, 0xc8, 0xd1, 0xd0, 0xcb, 0xc6, 0xc1, 0xb9, 0xb2, 0xae, 0xa8, 0x9d,
-  0x8c, 0x7d, 0x7c, 0x7e, 0x83, 0x8a, 0x8c, 0x8c, 0x8b, 0x87, 0x86, 0x85,
-  0x84, 0x83, 0x85, 0x8a, 0x8c, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x89, 0x8a,
-  0x8c, 0x89, 0x88, 0x87, 0x85, 0x84, 0x87, 0x86, 0x88, 0x8b, 0x90, 0x92,
-  0x97, 0x9e, 0xa0, 0xa2, 0xa9, 0xab, 0xae, 0xb0, 0xb1, 0xb1, 0xb0, 0xad,
-  0xad, 0xa8, 0x97, 0x7f, 0x75, 0x72, 0x78, 0x89, 0x95, 0x8a, 0x74, 0x5d,
-  0x39, 0x33, 0x5b, 0x59, 0x48, 0x2a, 0x16, 0x1d, 0x2b, 0x2d, 0x24, 0x17,
-  0x16, 0x17, 0x18, 0x1b, 0x1a, 0x13, 0x15, 0x24, 0x46, 0x5c, 0x72, 0x75,
-  0x75, 0x77, 0x7b, 0x80, 0x85, 0x87, 0x89, 0x85, 0x79, 0x70, 0x6a, 0x64,
-  0x63, 0x65, 0x67, 0x68, 0x6a, 0x6c, 0x6d, 0x6f, 0x71, 0x71, 0x72, 0x73,
-  0x74, 0x76, 0x77, 0x78, 0x77, 0x78, 0x77, 0x76, 0x76, 0x76, 0x73, 0x73,
-  0x72, 0x71, 0x70, 0x6f, 0x70, 0x70, 0x71, 0x72, 0x73, 0x74, 0x74, 0x72,
-  0x70, 0x6c, 0x6a, 0x69, 0x65, 0x5f, 0x5b, 0x57, 0x54, 0x4e, 0x4a, 0x46,
-  0x42, 0x3f, 0x3b, 0x32, 0x29, 0x23, 0x1e, 0x17, 0x11, 0x12, 0x12, 0x12,
-  0x12, 0x10, 0x11, 0x12, 0x12, 0x12, 0x13, 0x14, 0x13, 0x13, 0x13, 0x13,
-  0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x59, 0x57, 0x56, 0x57, 0x59, 0x5a, 0x5a,
-  0x5b, 0x5b, 0x5d, 0x60, 0x62, 0x62, 0x62, 0x63, 0x65, 0x66, 0x6a, 0x6b,
-  0x6b, 0x6c, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74,
-  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x73, 0x70, 0x6f, 0x71, 0x73,
-  0x74, 0x75, 0x79, 0x7c, 0x7f, 0x80, 0x81, 0x83, 0x85, 0x86, 0x86, 0x87,
-  0x89, 0x8a, 0x89, 0x89, 0x88, 0x8b, 0x8e, 0x92, 0x92, 0x92, 0x92, 0x90,
-  0x8f, 0x8f, 0x8e, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x91, 0x92,
-  0x93, 0x95, 0x99, 0x9b, 0x9a, 0x99, 0x98, 0x96, 0x95, 0x94, 0x94, 0x94,
-  0x94, 0x98, 0x9f, 0xa5, 0xad, 0xb5, 0xb9, 0xbc, 0xbc, 0xa7, 0x51, 0x32,
-  0x3b, 0x39, 0x29, 0x3a, 0x93, 0xb1, 0x98, 0x60, 0x8c, 0xbb, 0xbf, 0xb1,
-  0x8e, 0x7a, 0xaa, 0xac, 0xae, 0xbe, 0xc4, 0xb5, 0xb4, 0xb2, 0x90, 0x4e,
-  0x71, 0x8d, 0xa9, 0xb4, 0xb5, 0xba, 0xb6, 0xbc, 0xc1, 0xc7, 0xd0, 0xd4,
-  0xd1, 0xcd, 0xc5, 0xbb, 0xb2, 0xaf, 0xab, 0xa1, 0x91, 0x81, 0x7e, 0x80,
-  0x84, 0x88, 0x8b, 0x8b, 0x8b, 0x88, 0x87, 0x86, 0x85, 0x84, 0x85, 0x88,
-  0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x87, 0x87, 0x89, 0x8c, 0x8a, 0x88, 0x87,
-  0x86, 0x86, 0x8a, 0x89, 0x8b, 0x8d, 0x93, 0x94, 0x99, 0x9e, 0xa1, 0xa5,
-  0xa9, 0xab, 0xae, 0xaf, 0xaf, 0xb0, 0xaf, 0xaa, 0xa9, 0xa3, 0x91, 0x78,
-  0x6d, 0x6a, 0x71, 0x84, 0x94, 0x87, 0x70, 0x59, 0x36, 0x2f, 0x52, 0x57,
-  0x4d, 0x36, 0x1b, 0x1c, 0x25, 0x26, 0x1f, 0x15, 0x15, 0x15, 0x17, 0x1c,
-  0x1a, 0x14, 0x1b, 0x2c, 0x4e, 0x5e, 0x72, 0x75, 0x75, 0x77, 0x7c, 0x80,
-  0x85, 0x88, 0x8a, 0x86, 0x7b, 0x71, 0x6c, 0x65, 0x63, 0x65, 0x68, 0x69,
-  0x6a, 0x6c, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x74, 0x75, 0x77, 0x78, 0x79,
-  0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x74, 0x73, 0x73, 0x72, 0x70, 0x6f,
-  0x6f, 0x70, 0x70, 0x72, 0x73, 0x74, 0x73, 0x72, 0x70, 0x6c, 0x6a, 0x69,
-  0x65, 0x5f, 0x5b, 0x57, 0x54, 0x4e, 0x4a, 0x46, 0x42, 0x3f, 0x3b, 0x32,
-  0x29, 0x23, 0x1e, 0x17, 0x11, 0x12, 0x12, 0x12, 0x12, 0x10, 0x11, 0x12,
-  0x12, 0x12, 0x13, 0x13, 0x13, 0x12, 0x12, 0x12, 0x5b, 0x5a, 0x5a, 0x5a,
-  0x59, 0x59, 0x57, 0x57, 0x57, 0x58, 0x59, 0x5a, 0x5a, 0x5a, 0x5c, 0x5f,
-  0x61, 0x60, 0x61, 0x63, 0x64, 0x66, 0x68, 0x6a, 0x6b, 0x6b, 0x6d, 0x6d,
-  0x6e, 0x70, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74, 0x73, 0x74, 0x74, 0x73,
-  0x73, 0x74, 0x74, 0x73, 0x70, 0x6f, 0x72, 0x73, 0x75, 0x76, 0x78, 0x7a,
-  0x7d, 0x7f, 0x80, 0x82, 0x84, 0x85, 0x85, 0x86, 0x87, 0x88, 0x88, 0x87,
-  0x87, 0x89, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x8e, 0x8d, 0x8e, 0x8e, 0x8c,
-  0x8c, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e, 0x91, 0x92, 0x93, 0x94, 0x98, 0x9a,
-  0x99, 0x98, 0x97, 0x95, 0x95, 0x95, 0x95, 0x95, 0x98, 0xa1, 0xaa, 0xb0,
-  0xb6, 0xbb, 0xbd, 0xbf, 0xbd, 0xa4, 0x4e, 0x30, 0x33, 0x30, 0x24, 0x39,
-  0x93, 0xad, 0x94, 0x62, 0xa3, 0xc0, 0xbc, 0x9e, 0x59, 0x48, 0x90, 0xb4,
-  0xb9, 0xb7, 0xc3, 0xbe, 0xb8, 0xb6, 0x92, 0x4b, 0x6a, 0x8d, 0xa9, 0xb8,
-  0xc1, 0xbd, 0xb3, 0xb9, 0xc0, 0xc7, 0xcc, 0xd5, 0xd8, 0xd6, 0xcd, 0xbf,
-  0xb5, 0xb4, 0xb2, 0xa7, 0x97, 0x8a, 0x85, 0x84, 0x86, 0x88, 0x8a, 0x8a,
-  0x89, 0x88, 0x89, 0x87, 0x87, 0x87, 0x86, 0x86, 0x8b, 0x8e, 0x90, 0x94,
-  0x92, 0x85, 0x84, 0x86, 0x8c, 0x8b, 0x88, 0x88, 0x89, 0x8b, 0x8e, 0x8f,
-  0x8e, 0x8f, 0x94, 0x97, 0x9c, 0xa0, 0xa3, 0xa7, 0xaa, 0xac, 0xaf, 0xb0,
-  0xb0, 0xaf, 0xae, 0xa5, 0xa0, 0x99, 0x86, 0x72, 0x64, 0x63, 0x6a, 0x7f,
-  0x92, 0x84, 0x6c, 0x53, 0x2e, 0x25, 0x4a, 0x5a, 0x5c, 0x52, 0x31, 0x1f,
-  0x1b, 0x19, 0x16, 0x12, 0x12, 0x14, 0x18, 0x1d, 0x17, 0x19, 0x2b, 0x3b,
-  0x4e, 0x5f, 0x71, 0x75, 0x75, 0x77, 0x7c, 0x80, 0x85, 0x87, 0x8a, 0x87,
-  0x7c, 0x73, 0x6e, 0x67, 0x64, 0x66, 0x68, 0x6a, 0x6b, 0x6d, 0x6f, 0x70,
-  0x70, 0x71, 0x72, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x79, 0x78,
-  0x78, 0x76, 0x75, 0x75, 0x74, 0x72, 0x71, 0x6f, 0x6f, 0x70, 0x70, 0x72,
-  0x72, 0x73, 0x73, 0x72, 0x70, 0x6c, 0x6a, 0x69, 0x65, 0x5f, 0x5b, 0x56,
-  0x53, 0x4e, 0x4a, 0x45, 0x42, 0x3f, 0x3b, 0x32, 0x28, 0x22, 0x1e, 0x17,
-  0x12, 0x12, 0x12, 0x12, 0x12, 0x10, 0x11, 0x12, 0x12, 0x12, 0x13, 0x13,
-  0x13, 0x13, 0x12, 0x12, 0x5b, 0x5a, 0x5a, 0x5a, 0x59, 0x57, 0x58, 0x58,
-  0x58, 0x58, 0x59, 0x5a, 0x5a, 0x59, 0x5b, 0x5e, 0x60, 0x61, 0x61, 0x61,
-  0x63, 0x64, 0x66, 0x67, 0x69, 0x6b, 0x6c, 0x6c, 0x6d, 0x6e, 0x6f, 0x72,
-  0x74, 0x74, 0x73, 0x74, 0x73, 0x74, 0x74, 0x73, 0x73, 0x74, 0x73, 0x73,
-  0x72, 0x70, 0x72, 0x75, 0x76, 0x76, 0x77, 0x7a, 0x7b, 0x7c, 0x7f, 0x81,
-  0x83, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x88, 0x8d, 0x90,
-  0x8f, 0x8e, 0x8d, 0x8d, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8c, 0x8c,
-  0x8c, 0x8d, 0x90, 0x92, 0x93, 0x95, 0x98, 0x99, 0x98, 0x97, 0x96, 0x95,
-  0x96, 0x96, 0x97, 0x9a, 0xa1, 0xac, 0xb4, 0xb9, 0xbe, 0xbf, 0xbd, 0xbf,
-  0xbd, 0xa3, 0x4f, 0x30, 0x30, 0x2c, 0x22, 0x37, 0x7c, 0x7e, 0x65, 0x4a,
-  0x92, 0xb7, 0x98, 0x6f, 0x33, 0x27, 0x4f, 0x96, 0xb1, 0xb3, 0xc0, 0xba,
-  0xb1, 0xae, 0x8c, 0x49, 0x6a, 0x97, 0xc0, 0xd1, 0xd3, 0xc2, 0xb7, 0xbe,
-  0xc5, 0xcb, 0xcc, 0xd3, 0xdc, 0xdf, 0xda, 0xca, 0xba, 0xb5, 0xb2, 0xab,
-  0xa0, 0x94, 0x8d, 0x8d, 0x8d, 0x8a, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e, 0x8c,
-  0x88, 0x87, 0x88, 0x8a, 0x8d, 0x90, 0x95, 0x9f, 0x9d, 0x8a, 0x87, 0x89,
-  0x8d, 0x8f, 0x8d, 0x8e, 0x8d, 0x8d, 0x90, 0x93, 0x92, 0x92, 0x95, 0x9a,
-  0xa0, 0xa2, 0xa3, 0xa6, 0xac, 0xb1, 0xb0, 0xb0, 0xb0, 0xaf, 0xad, 0xa4,
-  0x98, 0x8d, 0x7b, 0x68, 0x5e, 0x5e, 0x65, 0x77, 0x8c, 0x7f, 0x65, 0x52,
-  0x38, 0x2b, 0x52, 0x53, 0x59, 0x6d, 0x63, 0x47, 0x32, 0x27, 0x1b, 0x14,
-  0x14, 0x17, 0x1a, 0x1d, 0x1b, 0x2f, 0x4a, 0x51, 0x4e, 0x66, 0x73, 0x74,
-  0x74, 0x77, 0x7d, 0x82, 0x86, 0x88, 0x89, 0x88, 0x80, 0x76, 0x70, 0x6a,
-  0x65, 0x66, 0x68, 0x6a, 0x6d, 0x6f, 0x70, 0x72, 0x72, 0x73, 0x74, 0x75,
-  0x77, 0x79, 0x79, 0x79, 0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x77, 0x75, 0x75,
-  0x75, 0x72, 0x71, 0x71, 0x70, 0x6f, 0x70, 0x71, 0x71, 0x72, 0x72, 0x72,
-  0x71, 0x6d, 0x6b, 0x69, 0x66, 0x60, 0x5b, 0x56, 0x53, 0x4f, 0x49, 0x45,
-  0x41, 0x3e, 0x39, 0x32, 0x27, 0x21, 0x1d, 0x16, 0x12, 0x10, 0x11, 0x11,
-  0x12, 0x10, 0x10, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0x12,
-  0x5c, 0x5a, 0x5a, 0x5a, 0x59, 0x58, 0x58, 0x59, 0x58, 0x57, 0x59, 0x5a,
-  0x5a, 0x59, 0x5b, 0x5d, 0x5f, 0x60, 0x60, 0x5f, 0x60, 0x64, 0x65, 0x66,
-  0x68, 0x6a, 0x6c, 0x6c, 0x6d, 0x6f, 0x6f, 0x72, 0x74, 0x74, 0x73, 0x74,
-  0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x73, 0x73, 0x74, 0x73, 0x73, 0x76,
-  0x77, 0x75, 0x75, 0x78, 0x79, 0x7a, 0x7d, 0x7f, 0x81, 0x82, 0x83, 0x84,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x88, 0x8c, 0x8f, 0x8e, 0x8c, 0x8b, 0x8b,
-  0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8e, 0x91, 0x92,
-  0x92, 0x95, 0x96, 0x97, 0x97, 0x96, 0x95, 0x95, 0x97, 0x99, 0x9b, 0xa1,
-  0xa8, 0xb3, 0xbb, 0xbe, 0xbf, 0xbd, 0xb9, 0xb9, 0xb8, 0xa2, 0x51, 0x30,
-  0x2e, 0x2b, 0x24, 0x33, 0x4b, 0x45, 0x37, 0x29, 0x4d, 0x84, 0x5a, 0x39,
-  0x27, 0x22, 0x29, 0x53, 0x79, 0xa9, 0xbb, 0xb0, 0xb5, 0xb4, 0x8f, 0x43,
-  0x55, 0x8f, 0xc7, 0xdc, 0xda, 0xc7, 0xbb, 0xc7, 0xcd, 0xcd, 0xcb, 0xd3,
-  0xde, 0xe2, 0xe1, 0xd8, 0xc8, 0xba, 0xb3, 0xad, 0xa7, 0x9a, 0x92, 0x91,
-  0x91, 0x90, 0x8d, 0x8d, 0x8e, 0x8f, 0x92, 0x90, 0x8e, 0x8c, 0x8a, 0x8b,
-  0x8c, 0x8e, 0x91, 0x95, 0x97, 0x8f, 0x8c, 0x8d, 0x8e, 0x91, 0x93, 0x92,
-  0x91, 0x90, 0x92, 0x96, 0x95, 0x97, 0x9b, 0x9e, 0x9f, 0x9f, 0xa2, 0xa8,
-  0xb1, 0xb4, 0xb4, 0xb3, 0xb0, 0xab, 0xa7, 0xa0, 0x8f, 0x82, 0x71, 0x62,
-  0x64, 0x62, 0x63, 0x6c, 0x7f, 0x7c, 0x66, 0x57, 0x43, 0x2f, 0x57, 0x5f,
-  0x63, 0x6d, 0x6a, 0x73, 0x6c, 0x5f, 0x48, 0x33, 0x29, 0x25, 0x26, 0x2c,
-  0x42, 0x55, 0x49, 0x46, 0x54, 0x70, 0x73, 0x72, 0x74, 0x7a, 0x80, 0x85,
-  0x88, 0x8a, 0x8a, 0x88, 0x81, 0x78, 0x72, 0x6b, 0x66, 0x66, 0x68, 0x6a,
-  0x6d, 0x6f, 0x70, 0x72, 0x74, 0x75, 0x77, 0x77, 0x78, 0x7a, 0x7a, 0x7a,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x78, 0x76, 0x75, 0x74, 0x73, 0x72,
-  0x70, 0x6f, 0x6f, 0x71, 0x71, 0x72, 0x73, 0x72, 0x71, 0x6d, 0x6a, 0x69,
-  0x66, 0x60, 0x5c, 0x57, 0x54, 0x51, 0x4a, 0x45, 0x40, 0x3d, 0x39, 0x33,
-  0x28, 0x20, 0x1b, 0x15, 0x11, 0x10, 0x11, 0x11, 0x12, 0x10, 0x10, 0x11,
-  0x11, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x12, 0x5d, 0x5b, 0x5a, 0x59,
-  0x5a, 0x5a, 0x5a, 0x59, 0x57, 0x56, 0x57, 0x59, 0x5a, 0x5a, 0x5c, 0x5d,
-  0x5e, 0x5e, 0x5f, 0x60, 0x60, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6b, 0x6d,
-  0x6d, 0x6e, 0x71, 0x72, 0x73, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x75,
-  0x75, 0x74, 0x73, 0x73, 0x74, 0x74, 0x75, 0x77, 0x77, 0x75, 0x75, 0x77,
-  0x79, 0x7a, 0x7b, 0x7e, 0x80, 0x80, 0x81, 0x83, 0x84, 0x85, 0x84, 0x84,
-  0x83, 0x88, 0x8c, 0x8e, 0x8d, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8a, 0x8c, 0x8d, 0x8d, 0x8c, 0x8e, 0x91, 0x92, 0x93, 0x93, 0x95, 0x95,
-  0x96, 0x96, 0x96, 0x96, 0x98, 0x9d, 0xa0, 0xa4, 0xad, 0xb6, 0xbc, 0xbd,
-  0xbd, 0xba, 0xb6, 0xb5, 0xb4, 0xa2, 0x5a, 0x32, 0x2a, 0x27, 0x24, 0x31,
-  0x38, 0x2d, 0x25, 0x1e, 0x27, 0x3f, 0x2f, 0x2a, 0x32, 0x2e, 0x21, 0x2d,
-  0x52, 0x9a, 0xac, 0xa6, 0xbd, 0xbc, 0x95, 0x48, 0x5e, 0x95, 0xca, 0xde,
-  0xdd, 0xc8, 0xbf, 0xce, 0xd4, 0xcf, 0xcb, 0xcf, 0xd9, 0xdf, 0xe2, 0xe0,
-  0xd6, 0xc4, 0xbb, 0xb4, 0xab, 0x9e, 0x96, 0x92, 0x92, 0x91, 0x90, 0x8f,
-  0x8f, 0x90, 0x93, 0x94, 0x92, 0x91, 0x8f, 0x8d, 0x8d, 0x90, 0x91, 0x8f,
-  0x8f, 0x8f, 0x8d, 0x8d, 0x8f, 0x91, 0x95, 0x95, 0x95, 0x94, 0x94, 0x97,
-  0x9a, 0x9b, 0x9b, 0x9a, 0x9d, 0xa3, 0xa7, 0xae, 0xb2, 0xb3, 0xb7, 0xb4,
-  0xb0, 0xa8, 0xa3, 0x99, 0x84, 0x77, 0x6c, 0x64, 0x67, 0x64, 0x64, 0x68,
-  0x79, 0x7a, 0x66, 0x58, 0x45, 0x2f, 0x57, 0x69, 0x6e, 0x70, 0x68, 0x7a,
-  0x6e, 0x6c, 0x76, 0x75, 0x62, 0x55, 0x55, 0x64, 0x7d, 0x5d, 0x41, 0x42,
-  0x5f, 0x77, 0x74, 0x73, 0x76, 0x7c, 0x83, 0x86, 0x8a, 0x8c, 0x8c, 0x89,
-  0x83, 0x79, 0x73, 0x6c, 0x68, 0x68, 0x69, 0x6b, 0x6d, 0x6f, 0x6f, 0x72,
-  0x75, 0x76, 0x77, 0x79, 0x79, 0x7b, 0x7b, 0x7b, 0x7d, 0x7d, 0x7c, 0x7d,
-  0x7b, 0x7b, 0x79, 0x78, 0x77, 0x75, 0x74, 0x73, 0x71, 0x70, 0x70, 0x72,
-  0x71, 0x72, 0x72, 0x72, 0x70, 0x6c, 0x6b, 0x69, 0x66, 0x61, 0x5c, 0x57,
-  0x54, 0x51, 0x4a, 0x45, 0x3f, 0x3b, 0x38, 0x34, 0x2a, 0x22, 0x1c, 0x16,
-  0x12, 0x10, 0x11, 0x11, 0x11, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13,
-  0x14, 0x14, 0x13, 0x12, 0x5d, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x58,
-  0x57, 0x56, 0x57, 0x59, 0x59, 0x5a, 0x5c, 0x5c, 0x5d, 0x5d, 0x5e, 0x60,
-  0x61, 0x62, 0x64, 0x64, 0x66, 0x68, 0x6b, 0x6d, 0x6d, 0x6e, 0x70, 0x71,
-  0x72, 0x72, 0x73, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x74, 0x73, 0x73,
-  0x74, 0x74, 0x75, 0x77, 0x77, 0x76, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7d,
-  0x7f, 0x7f, 0x80, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x88, 0x8c, 0x8d,
-  0x8d, 0x8c, 0x8b, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8c, 0x8d, 0x8d,
-  0x8c, 0x8e, 0x91, 0x93, 0x93, 0x93, 0x95, 0x95, 0x96, 0x96, 0x97, 0x98,
-  0x9a, 0x9f, 0xa2, 0xa6, 0xaf, 0xb8, 0xbb, 0xbc, 0xbb, 0xb7, 0xb3, 0xb1,
-  0xb0, 0xa1, 0x62, 0x34, 0x28, 0x25, 0x24, 0x2f, 0x32, 0x27, 0x21, 0x1e,
-  0x1d, 0x26, 0x29, 0x2f, 0x38, 0x34, 0x20, 0x20, 0x3e, 0x81, 0xa1, 0x9c,
-  0xb9, 0xb9, 0x92, 0x48, 0x62, 0x9c, 0xcc, 0xde, 0xdc, 0xc5, 0xbe, 0xcf,
-  0xd5, 0xd0, 0xcb, 0xcc, 0xd3, 0xd8, 0xde, 0xe1, 0xdc, 0xcc, 0xc3, 0xba,
-  0xae, 0xa3, 0x9a, 0x96, 0x93, 0x92, 0x92, 0x92, 0x90, 0x91, 0x92, 0x94,
-  0x93, 0x93, 0x92, 0x90, 0x8f, 0x91, 0x91, 0x8d, 0x8d, 0x8f, 0x8d, 0x8c,
-  0x90, 0x92, 0x95, 0x97, 0x97, 0x97, 0x96, 0x9a, 0x9d, 0x9e, 0x9d, 0x9a,
-  0x9f, 0xa6, 0xaa, 0xb0, 0xb2, 0xb3, 0xb8, 0xb4, 0xaf, 0xa6, 0x9f, 0x92,
-  0x7d, 0x71, 0x69, 0x63, 0x66, 0x64, 0x64, 0x68, 0x74, 0x77, 0x67, 0x5b,
-  0x48, 0x2d, 0x51, 0x65, 0x6a, 0x6b, 0x68, 0x77, 0x67, 0x65, 0x77, 0x7f,
-  0x78, 0x6e, 0x6d, 0x7b, 0x84, 0x52, 0x3e, 0x47, 0x67, 0x7c, 0x76, 0x75,
-  0x78, 0x7e, 0x84, 0x88, 0x8a, 0x8c, 0x8c, 0x8a, 0x83, 0x7a, 0x74, 0x6d,
-  0x69, 0x68, 0x6a, 0x6b, 0x6e, 0x70, 0x70, 0x72, 0x75, 0x76, 0x78, 0x7a,
-  0x7a, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7a, 0x79,
-  0x78, 0x76, 0x75, 0x74, 0x72, 0x71, 0x70, 0x72, 0x71, 0x71, 0x72, 0x72,
-  0x6f, 0x6c, 0x6a, 0x69, 0x66, 0x61, 0x5b, 0x57, 0x54, 0x51, 0x4a, 0x45,
-  0x3f, 0x3b, 0x38, 0x34, 0x2a, 0x23, 0x1e, 0x17, 0x12, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x14, 0x14, 0x13, 0x12,
-  0x5c, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x58, 0x57, 0x57, 0x57, 0x57,
-  0x58, 0x59, 0x5b, 0x5c, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x62,
-  0x65, 0x66, 0x68, 0x6b, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x74, 0x75,
-  0x74, 0x75, 0x75, 0x74, 0x74, 0x75, 0x74, 0x74, 0x74, 0x73, 0x74, 0x76,
-  0x77, 0x76, 0x75, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7d, 0x7e, 0x7f, 0x80,
-  0x81, 0x80, 0x80, 0x80, 0x82, 0x86, 0x8b, 0x8c, 0x8c, 0x8b, 0x89, 0x88,
-  0x89, 0x89, 0x89, 0x88, 0x89, 0x8c, 0x8d, 0x8d, 0x8c, 0x8e, 0x91, 0x93,
-  0x93, 0x93, 0x94, 0x94, 0x95, 0x96, 0x97, 0x99, 0x9b, 0xa0, 0xa3, 0xa8,
-  0xb1, 0xb7, 0xb8, 0xb7, 0xb6, 0xb3, 0xae, 0xaa, 0xa8, 0x9f, 0x70, 0x37,
-  0x27, 0x24, 0x23, 0x29, 0x2b, 0x25, 0x22, 0x20, 0x1e, 0x25, 0x36, 0x3d,
-  0x3b, 0x34, 0x21, 0x1b, 0x26, 0x4f, 0x91, 0x91, 0xab, 0xac, 0x88, 0x41,
-  0x59, 0xa4, 0xce, 0xdb, 0xd7, 0xbd, 0xb8, 0xc9, 0xd2, 0xd1, 0xc9, 0xc6,
-  0xc9, 0xcd, 0xd7, 0xde, 0xde, 0xd7, 0xd0, 0xc3, 0xb4, 0xac, 0xa4, 0x9f,
-  0x99, 0x95, 0x95, 0x95, 0x95, 0x92, 0x8f, 0x90, 0x92, 0x94, 0x96, 0x95,
-  0x93, 0x93, 0x92, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x91, 0x94, 0x95, 0x97,
-  0x98, 0x99, 0x9a, 0x9e, 0x9f, 0xa0, 0x9f, 0xa1, 0xa4, 0xaa, 0xad, 0xb0,
-  0xb3, 0xb5, 0xb7, 0xb5, 0xb0, 0xa5, 0x99, 0x86, 0x74, 0x6a, 0x63, 0x5f,
-  0x61, 0x62, 0x64, 0x68, 0x6e, 0x71, 0x68, 0x60, 0x4d, 0x2a, 0x40, 0x5a,
-  0x5f, 0x5e, 0x6e, 0x70, 0x60, 0x57, 0x55, 0x5d, 0x6c, 0x72, 0x72, 0x70,
-  0x60, 0x39, 0x42, 0x55, 0x71, 0x80, 0x7b, 0x7a, 0x7d, 0x82, 0x86, 0x88,
-  0x8a, 0x8b, 0x8c, 0x89, 0x83, 0x7b, 0x75, 0x6d, 0x6a, 0x69, 0x6b, 0x6c,
-  0x6e, 0x70, 0x72, 0x74, 0x76, 0x77, 0x78, 0x7b, 0x7b, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7d, 0x7c, 0x7c, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x74,
-  0x73, 0x72, 0x71, 0x71, 0x70, 0x70, 0x71, 0x71, 0x6f, 0x6b, 0x6a, 0x68,
-  0x64, 0x61, 0x5c, 0x57, 0x55, 0x51, 0x4a, 0x45, 0x3f, 0x3d, 0x39, 0x33,
-  0x29, 0x23, 0x1e, 0x17, 0x12, 0x11, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11,
-  0x11, 0x12, 0x13, 0x14, 0x14, 0x14, 0x14, 0x12, 0x5c, 0x5b, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x59, 0x58, 0x57, 0x58, 0x57, 0x58, 0x59, 0x5a, 0x5a,
-  0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x5f, 0x61, 0x61, 0x63, 0x65, 0x67, 0x6a,
-  0x6b, 0x6c, 0x6e, 0x70, 0x71, 0x71, 0x74, 0x75, 0x73, 0x74, 0x74, 0x74,
-  0x74, 0x74, 0x74, 0x74, 0x73, 0x71, 0x71, 0x74, 0x75, 0x76, 0x75, 0x75,
-  0x75, 0x74, 0x75, 0x77, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e,
-  0x80, 0x86, 0x8a, 0x8a, 0x8b, 0x8a, 0x88, 0x87, 0x88, 0x88, 0x88, 0x87,
-  0x88, 0x8b, 0x8c, 0x8c, 0x8c, 0x8d, 0x90, 0x92, 0x92, 0x92, 0x93, 0x93,
-  0x95, 0x96, 0x99, 0x9a, 0x9e, 0xa1, 0xa3, 0xa8, 0xb0, 0xb2, 0xb0, 0xaf,
-  0xad, 0xa9, 0xa5, 0x9f, 0x9d, 0x9b, 0x81, 0x3a, 0x26, 0x24, 0x25, 0x22,
-  0x23, 0x23, 0x21, 0x20, 0x20, 0x22, 0x29, 0x2c, 0x2d, 0x31, 0x25, 0x1c,
-  0x1c, 0x2d, 0x6f, 0x94, 0xb3, 0xb4, 0x8f, 0x45, 0x57, 0xab, 0xd1, 0xd9,
-  0xcc, 0xb2, 0xb9, 0xcb, 0xd1, 0xd1, 0xc6, 0xbd, 0xc0, 0xc5, 0xce, 0xd7,
-  0xdc, 0xdb, 0xd7, 0xce, 0xc0, 0xb6, 0xb0, 0xac, 0xa6, 0x9d, 0x9c, 0x9c,
-  0x9b, 0x96, 0x91, 0x8f, 0x92, 0x94, 0x94, 0x94, 0x95, 0x96, 0x96, 0x92,
-  0x94, 0x93, 0x93, 0x94, 0x96, 0x99, 0x9a, 0x9a, 0x9a, 0x9a, 0x9b, 0x9c,
-  0xa0, 0xa1, 0xa4, 0xa8, 0xac, 0xb3, 0xb5, 0xb6, 0xb6, 0xb4, 0xb1, 0xb1,
-  0xae, 0xa4, 0x91, 0x78, 0x68, 0x61, 0x5d, 0x5c, 0x5e, 0x62, 0x66, 0x6b,
-  0x69, 0x6c, 0x68, 0x5f, 0x49, 0x26, 0x34, 0x5d, 0x6c, 0x6d, 0x77, 0x69,
-  0x60, 0x5a, 0x58, 0x66, 0x53, 0x5c, 0x5c, 0x50, 0x59, 0x45, 0x53, 0x67,
-  0x83, 0x8b, 0x86, 0x84, 0x84, 0x85, 0x88, 0x89, 0x8b, 0x8b, 0x8b, 0x87,
-  0x81, 0x7b, 0x75, 0x6d, 0x6a, 0x69, 0x6a, 0x6c, 0x6f, 0x71, 0x73, 0x75,
-  0x77, 0x78, 0x79, 0x7b, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7b, 0x7a, 0x7a, 0x78, 0x76, 0x75, 0x74, 0x73, 0x71, 0x71,
-  0x70, 0x70, 0x70, 0x71, 0x6f, 0x6b, 0x6a, 0x68, 0x64, 0x61, 0x5a, 0x57,
-  0x54, 0x50, 0x4a, 0x45, 0x40, 0x3d, 0x39, 0x32, 0x2a, 0x22, 0x1d, 0x16,
-  0x12, 0x11, 0x10, 0x10, 0x10, 0x11, 0x10, 0x11, 0x11, 0x12, 0x13, 0x14,
-  0x14, 0x14, 0x14, 0x12, 0x5d, 0x5c, 0x5b, 0x5b, 0x5b, 0x5a, 0x58, 0x58,
-  0x58, 0x58, 0x59, 0x58, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5b, 0x5c, 0x5c,
-  0x5d, 0x5e, 0x60, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6b, 0x6c, 0x6d, 0x6f,
-  0x71, 0x71, 0x72, 0x74, 0x73, 0x73, 0x74, 0x75, 0x74, 0x74, 0x74, 0x74,
-  0x73, 0x71, 0x71, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75,
-  0x77, 0x79, 0x7a, 0x7a, 0x7c, 0x7c, 0x7c, 0x7d, 0x80, 0x87, 0x89, 0x89,
-  0x8a, 0x8a, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x8c, 0x8e, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x92, 0x93, 0x96, 0x98, 0x9a, 0x9c,
-  0x9e, 0xa0, 0xa2, 0xa7, 0xac, 0xaa, 0xa8, 0xa6, 0xa4, 0x9f, 0x97, 0x91,
-  0x90, 0x99, 0x9a, 0x4e, 0x28, 0x23, 0x29, 0x22, 0x21, 0x21, 0x21, 0x20,
-  0x21, 0x20, 0x20, 0x21, 0x24, 0x2b, 0x23, 0x1e, 0x1d, 0x22, 0x4c, 0x86,
-  0xa6, 0xae, 0x92, 0x4e, 0x59, 0xa4, 0xc4, 0xc7, 0xb8, 0xa8, 0xbc, 0xcc,
-  0xd0, 0xcb, 0xbe, 0xb2, 0xbb, 0xc1, 0xc5, 0xcf, 0xd8, 0xdc, 0xdd, 0xdb,
-  0xd3, 0xc6, 0xbd, 0xb8, 0xb1, 0xa8, 0xa7, 0xa6, 0xa4, 0xa1, 0x9f, 0x98,
-  0x94, 0x93, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x95, 0x97, 0x97, 0x98,
-  0x97, 0x99, 0x99, 0x9c, 0x9d, 0x9c, 0x9c, 0x9e, 0xa1, 0xa3, 0xa7, 0xae,
-  0xb2, 0xb4, 0xb5, 0xb6, 0xb8, 0xb6, 0xaf, 0xac, 0xa8, 0x9d, 0x85, 0x6f,
-  0x62, 0x5e, 0x5b, 0x5a, 0x59, 0x60, 0x66, 0x6d, 0x67, 0x66, 0x6a, 0x64,
-  0x4d, 0x2e, 0x2e, 0x52, 0x62, 0x60, 0x5c, 0x61, 0x7f, 0x7c, 0x5d, 0x61,
-  0x5e, 0x61, 0x5b, 0x4c, 0x4e, 0x5b, 0x6c, 0x7c, 0x92, 0x96, 0x91, 0x8e,
-  0x8b, 0x89, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x86, 0x80, 0x7a, 0x74, 0x6c,
-  0x68, 0x6a, 0x6b, 0x6c, 0x6e, 0x71, 0x75, 0x77, 0x79, 0x79, 0x79, 0x7b,
-  0x7e, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7c, 0x7c,
-  0x7b, 0x7a, 0x77, 0x76, 0x74, 0x73, 0x72, 0x71, 0x72, 0x71, 0x71, 0x71,
-  0x70, 0x6b, 0x69, 0x67, 0x64, 0x60, 0x5b, 0x58, 0x55, 0x51, 0x4c, 0x46,
-  0x40, 0x3d, 0x38, 0x31, 0x29, 0x22, 0x1d, 0x16, 0x13, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x14, 0x14, 0x14, 0x13, 0x12,
-  0x5d, 0x5c, 0x5b, 0x5b, 0x5b, 0x5a, 0x58, 0x57, 0x58, 0x58, 0x58, 0x58,
-  0x58, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5e, 0x60, 0x61,
-  0x62, 0x63, 0x65, 0x68, 0x6a, 0x6b, 0x6d, 0x6e, 0x70, 0x71, 0x72, 0x73,
-  0x74, 0x74, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x72, 0x74,
-  0x75, 0x75, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x75, 0x76, 0x77, 0x77,
-  0x79, 0x7a, 0x7b, 0x7c, 0x80, 0x87, 0x88, 0x88, 0x89, 0x89, 0x88, 0x88,
-  0x89, 0x8b, 0x8c, 0x8f, 0x93, 0x96, 0x97, 0x97, 0x97, 0x95, 0x93, 0x92,
-  0x91, 0x91, 0x92, 0x93, 0x96, 0x98, 0x99, 0x9c, 0x9f, 0xa1, 0xa2, 0xa7,
-  0xa8, 0xa5, 0xa2, 0x9f, 0x9b, 0x95, 0x8f, 0x8a, 0x8a, 0x94, 0x9e, 0x6b,
-  0x32, 0x22, 0x29, 0x25, 0x21, 0x20, 0x1f, 0x1f, 0x21, 0x20, 0x1f, 0x20,
-  0x21, 0x26, 0x1f, 0x1d, 0x1b, 0x1f, 0x49, 0x7b, 0x98, 0xa1, 0x86, 0x46,
-  0x54, 0xa1, 0xbd, 0xbe, 0xb2, 0xa7, 0xbe, 0xcb, 0xcc, 0xc7, 0xb9, 0xa8,
-  0xb6, 0xbd, 0xbd, 0xc9, 0xd5, 0xdc, 0xde, 0xdd, 0xdc, 0xd7, 0xce, 0xc6,
-  0xbb, 0xae, 0xaa, 0xa9, 0xa8, 0xa6, 0xa7, 0xa1, 0x9c, 0x98, 0x95, 0x94,
-  0x91, 0x91, 0x93, 0x95, 0x96, 0x99, 0x9a, 0x98, 0x96, 0x98, 0x98, 0x9a,
-  0x9b, 0x9c, 0x9f, 0xa0, 0xa1, 0xa3, 0xa6, 0xab, 0xb1, 0xb3, 0xb4, 0xb7,
-  0xba, 0xb7, 0xad, 0xa5, 0xa0, 0x95, 0x7e, 0x6a, 0x5f, 0x5b, 0x58, 0x57,
-  0x56, 0x5c, 0x61, 0x69, 0x68, 0x62, 0x68, 0x66, 0x53, 0x2f, 0x27, 0x4b,
-  0x5d, 0x65, 0x68, 0x5e, 0x82, 0x86, 0x65, 0x4a, 0x5a, 0x67, 0x67, 0x58,
-  0x44, 0x5e, 0x7a, 0x8a, 0x98, 0x99, 0x97, 0x93, 0x90, 0x8d, 0x8d, 0x8c,
-  0x8a, 0x89, 0x88, 0x84, 0x7e, 0x78, 0x73, 0x6b, 0x66, 0x6a, 0x6c, 0x6d,
-  0x6f, 0x72, 0x76, 0x78, 0x7a, 0x7b, 0x7a, 0x7d, 0x80, 0x82, 0x82, 0x81,
-  0x82, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7d, 0x7d, 0x7b, 0x79, 0x76,
-  0x75, 0x74, 0x73, 0x71, 0x71, 0x72, 0x71, 0x71, 0x6f, 0x6b, 0x69, 0x67,
-  0x63, 0x60, 0x5c, 0x59, 0x56, 0x50, 0x4c, 0x46, 0x40, 0x3d, 0x38, 0x30,
-  0x2a, 0x22, 0x1d, 0x17, 0x13, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x12, 0x13, 0x12, 0x13, 0x14, 0x14, 0x13, 0x12, 0x5d, 0x5c, 0x5b, 0x5b,
-  0x5b, 0x5a, 0x58, 0x58, 0x58, 0x59, 0x58, 0x58, 0x57, 0x57, 0x57, 0x58,
-  0x5a, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f, 0x60, 0x61, 0x62, 0x65, 0x68,
-  0x69, 0x6b, 0x6c, 0x6d, 0x6f, 0x70, 0x71, 0x73, 0x74, 0x74, 0x75, 0x75,
-  0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x71, 0x73, 0x75, 0x75, 0x74, 0x73,
-  0x73, 0x73, 0x72, 0x73, 0x74, 0x75, 0x76, 0x76, 0x78, 0x79, 0x7a, 0x7c,
-  0x80, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x8a, 0x8d, 0x90, 0x92, 0x94,
-  0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9a, 0x97, 0x94, 0x93, 0x91, 0x92, 0x93,
-  0x96, 0x97, 0x99, 0x9c, 0x9f, 0xa2, 0xa3, 0xa6, 0xa5, 0xa1, 0x9d, 0x9a,
-  0x95, 0x90, 0x8c, 0x88, 0x89, 0x90, 0x9b, 0x7e, 0x3d, 0x25, 0x27, 0x25,
-  0x20, 0x20, 0x20, 0x1f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x1d, 0x1b,
-  0x1b, 0x25, 0x55, 0x78, 0x94, 0x9c, 0x80, 0x40, 0x53, 0xa1, 0xba, 0xb9,
-  0xad, 0xa7, 0xc1, 0xcb, 0xcb, 0xc5, 0xb7, 0xa7, 0xb6, 0xbd, 0xbc, 0xc7,
-  0xd2, 0xd9, 0xdc, 0xdb, 0xdd, 0xdd, 0xd7, 0xd0, 0xc2, 0xb3, 0xac, 0xaa,
-  0xa9, 0xa7, 0xa8, 0xa4, 0xa0, 0x9d, 0x98, 0x95, 0x93, 0x92, 0x93, 0x97,
-  0x96, 0x98, 0x99, 0x98, 0x95, 0x97, 0x99, 0x9a, 0x9b, 0x9d, 0xa1, 0xa2,
-  0xa3, 0xa4, 0xa6, 0xab, 0xb1, 0xb3, 0xb4, 0xb8, 0xba, 0xb6, 0xab, 0xa1,
-  0x9a, 0x8e, 0x78, 0x68, 0x5e, 0x59, 0x56, 0x55, 0x54, 0x59, 0x5e, 0x64,
-  0x68, 0x62, 0x67, 0x67, 0x57, 0x2f, 0x23, 0x43, 0x56, 0x67, 0x70, 0x5f,
-  0x7a, 0x83, 0x6e, 0x4d, 0x56, 0x67, 0x6a, 0x5d, 0x48, 0x62, 0x80, 0x8f,
-  0x99, 0x9a, 0x9a, 0x97, 0x93, 0x8f, 0x8d, 0x8b, 0x8a, 0x89, 0x87, 0x83,
-  0x7d, 0x77, 0x72, 0x6a, 0x66, 0x69, 0x6c, 0x6d, 0x6f, 0x73, 0x76, 0x79,
-  0x7b, 0x7b, 0x7b, 0x7d, 0x80, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x7e, 0x7e, 0x7d, 0x7c, 0x79, 0x77, 0x75, 0x75, 0x73, 0x71,
-  0x70, 0x71, 0x71, 0x71, 0x6f, 0x6b, 0x69, 0x67, 0x63, 0x60, 0x5c, 0x59,
-  0x56, 0x50, 0x4c, 0x46, 0x41, 0x3d, 0x37, 0x30, 0x2a, 0x22, 0x1d, 0x18,
-  0x13, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x13, 0x11, 0x12,
-  0x14, 0x14, 0x12, 0x12, 0x5d, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x59, 0x59,
-  0x58, 0x59, 0x59, 0x58, 0x57, 0x57, 0x57, 0x57, 0x58, 0x59, 0x59, 0x5a,
-  0x5c, 0x5d, 0x5e, 0x5f, 0x61, 0x61, 0x63, 0x66, 0x68, 0x69, 0x6b, 0x6d,
-  0x6f, 0x6f, 0x70, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x74, 0x74, 0x75,
-  0x74, 0x71, 0x70, 0x72, 0x73, 0x74, 0x74, 0x72, 0x72, 0x72, 0x72, 0x73,
-  0x73, 0x74, 0x75, 0x76, 0x76, 0x77, 0x79, 0x7a, 0x80, 0x86, 0x87, 0x87,
-  0x88, 0x88, 0x8a, 0x8e, 0x93, 0x98, 0x9b, 0x9f, 0xa1, 0xa3, 0xa4, 0xa3,
-  0xa4, 0xa4, 0xa1, 0x9d, 0x98, 0x94, 0x92, 0x93, 0x96, 0x97, 0x98, 0x9b,
-  0xa0, 0xa3, 0xa4, 0xa4, 0xa0, 0x9b, 0x96, 0x93, 0x8f, 0x8c, 0x8c, 0x8b,
-  0x8c, 0x91, 0x99, 0x8f, 0x5c, 0x3d, 0x29, 0x21, 0x20, 0x24, 0x23, 0x1f,
-  0x1e, 0x1e, 0x1e, 0x1f, 0x1e, 0x1c, 0x1a, 0x1a, 0x23, 0x43, 0x75, 0x7e,
-  0x94, 0x9b, 0x7d, 0x3d, 0x58, 0xa4, 0xb5, 0xb0, 0xa3, 0xaa, 0xc6, 0xce,
-  0xcc, 0xc4, 0xb6, 0xaf, 0xbb, 0xc0, 0xc0, 0xc7, 0xcd, 0xd3, 0xd5, 0xd5,
-  0xda, 0xdd, 0xdc, 0xd8, 0xcd, 0xbf, 0xb4, 0xaf, 0xab, 0xa6, 0xa3, 0xa3,
-  0xa3, 0xa1, 0x9c, 0x99, 0x95, 0x96, 0x97, 0x9a, 0x98, 0x99, 0x99, 0x98,
-  0x97, 0x98, 0x9c, 0x9d, 0x9d, 0x9d, 0xa2, 0xa6, 0xa9, 0xaa, 0xab, 0xae,
-  0xb3, 0xb5, 0xb6, 0xba, 0xba, 0xb5, 0xa9, 0x9b, 0x91, 0x81, 0x6f, 0x63,
-  0x5a, 0x57, 0x54, 0x53, 0x53, 0x58, 0x5b, 0x5e, 0x67, 0x63, 0x66, 0x67,
-  0x5c, 0x35, 0x20, 0x33, 0x46, 0x5e, 0x6d, 0x63, 0x67, 0x70, 0x79, 0x6a,
-  0x54, 0x5e, 0x61, 0x59, 0x55, 0x6f, 0x86, 0x90, 0x98, 0x9b, 0x9d, 0x9a,
-  0x97, 0x90, 0x8c, 0x8a, 0x89, 0x88, 0x86, 0x81, 0x7b, 0x75, 0x71, 0x6a,
-  0x66, 0x6a, 0x6c, 0x6e, 0x70, 0x74, 0x78, 0x7a, 0x7b, 0x7c, 0x7c, 0x7e,
-  0x81, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x82, 0x80, 0x7f,
-  0x7e, 0x7d, 0x7a, 0x78, 0x76, 0x75, 0x72, 0x71, 0x70, 0x70, 0x70, 0x71,
-  0x6f, 0x6b, 0x69, 0x67, 0x63, 0x60, 0x5c, 0x59, 0x56, 0x50, 0x4b, 0x44,
-  0x41, 0x3e, 0x38, 0x30, 0x29, 0x22, 0x1d, 0x18, 0x12, 0x10, 0x11, 0x11,
-  0x11, 0x10, 0x11, 0x12, 0x12, 0x13, 0x12, 0x14, 0x14, 0x14, 0x12, 0x13,
-  0x5d, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x59, 0x57,
-  0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5a, 0x5c, 0x5d, 0x5f, 0x5f,
-  0x60, 0x62, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6c, 0x6d, 0x6e, 0x6f, 0x71,
-  0x71, 0x71, 0x72, 0x73, 0x74, 0x73, 0x74, 0x75, 0x74, 0x72, 0x70, 0x72,
-  0x72, 0x72, 0x72, 0x72, 0x71, 0x71, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74,
-  0x74, 0x77, 0x78, 0x7b, 0x81, 0x85, 0x87, 0x89, 0x8b, 0x8d, 0x90, 0x96,
-  0x9e, 0xa6, 0xa9, 0xad, 0xaf, 0xb0, 0xaf, 0xae, 0xae, 0xb0, 0xaf, 0xac,
-  0xa8, 0x9f, 0x98, 0x97, 0x98, 0x98, 0x98, 0x9b, 0xa2, 0xa5, 0xa6, 0xa3,
-  0x9e, 0x98, 0x93, 0x91, 0x90, 0x90, 0x93, 0x95, 0x97, 0x9b, 0x9e, 0x86,
-  0x91, 0x84, 0x4d, 0x25, 0x21, 0x28, 0x28, 0x1f, 0x1c, 0x1d, 0x1d, 0x1c,
-  0x1c, 0x1d, 0x2c, 0x3f, 0x57, 0x84, 0x99, 0x94, 0x8d, 0x97, 0x7e, 0x3f,
-  0x5e, 0xa5, 0xad, 0xa7, 0xa4, 0xba, 0xcb, 0xcd, 0xca, 0xc1, 0xba, 0xbb,
-  0xc1, 0xc2, 0xc1, 0xc3, 0xc9, 0xcb, 0xcd, 0xd0, 0xd6, 0xd9, 0xd9, 0xd8,
-  0xd6, 0xd1, 0xc7, 0xc2, 0xbd, 0xb3, 0xa9, 0xa4, 0xa4, 0xa4, 0xa3, 0xa1,
-  0x9b, 0x9a, 0x9b, 0x9c, 0x9c, 0x9e, 0x9b, 0x9b, 0x9b, 0x9b, 0xa0, 0xa2,
-  0xa1, 0xa0, 0xa3, 0xa8, 0xad, 0xae, 0xae, 0xb1, 0xb5, 0xb9, 0xba, 0xbb,
-  0xb9, 0xb4, 0xa6, 0x96, 0x89, 0x76, 0x67, 0x5b, 0x58, 0x56, 0x55, 0x51,
-  0x52, 0x57, 0x59, 0x5c, 0x66, 0x64, 0x65, 0x66, 0x60, 0x40, 0x20, 0x28,
-  0x38, 0x52, 0x5b, 0x5c, 0x4b, 0x4f, 0x6b, 0x6d, 0x59, 0x4e, 0x4b, 0x4d,
-  0x56, 0x76, 0x89, 0x92, 0x9c, 0xa0, 0x9f, 0x9a, 0x96, 0x8f, 0x8b, 0x8a,
-  0x89, 0x88, 0x85, 0x7f, 0x77, 0x72, 0x6e, 0x69, 0x65, 0x69, 0x6d, 0x6e,
-  0x71, 0x75, 0x79, 0x7b, 0x7d, 0x7f, 0x80, 0x80, 0x83, 0x84, 0x84, 0x85,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7a,
-  0x77, 0x76, 0x74, 0x72, 0x70, 0x70, 0x70, 0x71, 0x6f, 0x6b, 0x69, 0x67,
-  0x63, 0x60, 0x5b, 0x57, 0x55, 0x50, 0x4b, 0x44, 0x40, 0x3d, 0x38, 0x31,
-  0x29, 0x23, 0x1e, 0x17, 0x12, 0x11, 0x11, 0x11, 0x10, 0x12, 0x12, 0x11,
-  0x11, 0x13, 0x13, 0x14, 0x13, 0x13, 0x13, 0x13, 0x5e, 0x5d, 0x5b, 0x5a,
-  0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x58, 0x57, 0x56, 0x57, 0x58,
-  0x59, 0x58, 0x58, 0x58, 0x5a, 0x5c, 0x5d, 0x5e, 0x5e, 0x60, 0x61, 0x62,
-  0x62, 0x65, 0x68, 0x6b, 0x6c, 0x6d, 0x6f, 0x71, 0x71, 0x71, 0x72, 0x73,
-  0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x70, 0x71, 0x71, 0x71, 0x72, 0x72,
-  0x71, 0x70, 0x71, 0x70, 0x71, 0x72, 0x73, 0x73, 0x74, 0x77, 0x79, 0x7b,
-  0x81, 0x86, 0x89, 0x8d, 0x90, 0x93, 0x98, 0xa1, 0xaa, 0xb1, 0xb5, 0xb8,
-  0xba, 0xb9, 0xb8, 0xb7, 0xb7, 0xb9, 0xb9, 0xb8, 0xb6, 0xaf, 0xa4, 0x9d,
-  0x9d, 0x9d, 0x9d, 0xa0, 0xa5, 0xa7, 0xa7, 0xa3, 0x9e, 0x9b, 0x98, 0x97,
-  0x97, 0x99, 0x9e, 0xa0, 0xa1, 0xa4, 0xa8, 0x92, 0x92, 0x96, 0x90, 0x52,
-  0x2f, 0x25, 0x22, 0x20, 0x1d, 0x1d, 0x1f, 0x23, 0x2d, 0x49, 0x7c, 0x97,
-  0x9a, 0x90, 0x98, 0x98, 0x91, 0x99, 0x7e, 0x3e, 0x5d, 0xa8, 0xb2, 0xb0,
-  0xb4, 0xc6, 0xca, 0xc9, 0xc7, 0xc1, 0xbd, 0xbe, 0xbf, 0xbf, 0xbd, 0xbf,
-  0xc3, 0xc6, 0xc8, 0xcb, 0xcf, 0xd2, 0xd3, 0xd4, 0xd7, 0xd9, 0xd6, 0xd3,
-  0xcf, 0xc6, 0xb8, 0xaa, 0xa6, 0xa7, 0xa8, 0xa7, 0xa5, 0xa1, 0xa0, 0x9e,
-  0x9e, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0xa3, 0xa6, 0xa8, 0xa8, 0xa9, 0xac,
-  0xaf, 0xb1, 0xb3, 0xb7, 0xba, 0xbd, 0xbf, 0xbf, 0xba, 0xaf, 0x9c, 0x8b,
-  0x7e, 0x6d, 0x5d, 0x57, 0x57, 0x57, 0x55, 0x50, 0x53, 0x57, 0x5a, 0x5f,
-  0x67, 0x6c, 0x6d, 0x6c, 0x67, 0x4d, 0x23, 0x1b, 0x28, 0x49, 0x5c, 0x61,
-  0x58, 0x50, 0x4a, 0x5c, 0x5b, 0x47, 0x45, 0x56, 0x69, 0x7e, 0x8e, 0x97,
-  0xa3, 0xa6, 0x9f, 0x98, 0x92, 0x8e, 0x8a, 0x8a, 0x8a, 0x89, 0x85, 0x7d,
-  0x75, 0x6f, 0x6c, 0x68, 0x64, 0x68, 0x6c, 0x6e, 0x71, 0x77, 0x7b, 0x7d,
-  0x7f, 0x80, 0x81, 0x83, 0x84, 0x86, 0x87, 0x87, 0x86, 0x87, 0x86, 0x86,
-  0x86, 0x85, 0x82, 0x82, 0x82, 0x80, 0x80, 0x7d, 0x79, 0x77, 0x75, 0x72,
-  0x70, 0x70, 0x70, 0x70, 0x6f, 0x6b, 0x69, 0x67, 0x64, 0x60, 0x5b, 0x57,
-  0x55, 0x50, 0x4b, 0x44, 0x40, 0x3d, 0x37, 0x31, 0x29, 0x23, 0x1f, 0x18,
-  0x12, 0x10, 0x11, 0x11, 0x10, 0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x14,
-  0x15, 0x14, 0x13, 0x12, 0x5d, 0x5c, 0x5b, 0x5a, 0x5b, 0x5b, 0x5a, 0x5b,
-  0x5b, 0x59, 0x58, 0x57, 0x57, 0x57, 0x57, 0x59, 0x59, 0x58, 0x58, 0x58,
-  0x59, 0x5a, 0x5c, 0x5c, 0x5d, 0x60, 0x61, 0x61, 0x62, 0x64, 0x67, 0x6a,
-  0x6b, 0x6c, 0x6e, 0x70, 0x71, 0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x72,
-  0x71, 0x71, 0x70, 0x70, 0x70, 0x70, 0x71, 0x72, 0x71, 0x71, 0x71, 0x70,
-  0x71, 0x71, 0x72, 0x72, 0x73, 0x75, 0x78, 0x7b, 0x80, 0x85, 0x8a, 0x91,
-  0x95, 0x99, 0x9f, 0xa9, 0xb4, 0xba, 0xbc, 0xbe, 0xbf, 0xbf, 0xbe, 0xbd,
-  0xbc, 0xbc, 0xbd, 0xbd, 0xbc, 0xb9, 0xaf, 0xa3, 0xa0, 0xa0, 0xa3, 0xa7,
-  0xaa, 0xa9, 0xa7, 0xa4, 0xa1, 0x9e, 0x9d, 0x9d, 0x9e, 0xa2, 0xa6, 0xa6,
-  0xa6, 0xa7, 0xae, 0x9f, 0x7c, 0x7c, 0x9c, 0x93, 0x61, 0x39, 0x2a, 0x26,
-  0x23, 0x28, 0x34, 0x46, 0x6b, 0x99, 0xab, 0x9e, 0x95, 0x94, 0xa3, 0xa1,
-  0xa9, 0x99, 0x76, 0x3e, 0x68, 0xae, 0xba, 0xbd, 0xc4, 0xca, 0xca, 0xca,
-  0xc8, 0xc3, 0xbf, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbe, 0xc3, 0xc7, 0xca,
-  0xcb, 0xce, 0xd0, 0xd2, 0xd5, 0xd9, 0xd9, 0xd9, 0xd7, 0xd2, 0xc4, 0xb4,
-  0xad, 0xab, 0xab, 0xa9, 0xa9, 0xa6, 0xa3, 0x9f, 0x9f, 0xa0, 0xa1, 0xa2,
-  0xa4, 0xa4, 0xa4, 0xa8, 0xab, 0xaf, 0xb0, 0xb1, 0xb4, 0xb6, 0xb8, 0xbd,
-  0xbe, 0xbe, 0xc0, 0xc3, 0xbc, 0xae, 0x97, 0x81, 0x74, 0x64, 0x52, 0x54,
-  0x56, 0x55, 0x53, 0x4f, 0x53, 0x57, 0x5b, 0x61, 0x6f, 0x79, 0x75, 0x71,
-  0x6d, 0x59, 0x2e, 0x1a, 0x20, 0x3e, 0x59, 0x5f, 0x62, 0x56, 0x3b, 0x45,
-  0x57, 0x4f, 0x50, 0x61, 0x73, 0x84, 0x94, 0x9d, 0xa5, 0xa6, 0x9e, 0x95,
-  0x90, 0x8c, 0x8a, 0x89, 0x88, 0x88, 0x84, 0x7c, 0x73, 0x6d, 0x6a, 0x66,
-  0x62, 0x67, 0x6c, 0x6f, 0x72, 0x77, 0x7c, 0x7e, 0x81, 0x82, 0x82, 0x84,
-  0x84, 0x86, 0x86, 0x87, 0x87, 0x89, 0x88, 0x88, 0x87, 0x85, 0x83, 0x83,
-  0x82, 0x82, 0x81, 0x7e, 0x7b, 0x79, 0x77, 0x73, 0x71, 0x71, 0x71, 0x70,
-  0x6d, 0x6b, 0x6a, 0x68, 0x65, 0x60, 0x5b, 0x57, 0x55, 0x51, 0x4b, 0x44,
-  0x40, 0x3d, 0x37, 0x30, 0x29, 0x23, 0x1f, 0x18, 0x12, 0x11, 0x11, 0x11,
-  0x10, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x14, 0x15, 0x15, 0x13, 0x12,
-  0x5e, 0x5c, 0x5b, 0x5a, 0x5b, 0x5b, 0x5a, 0x5b, 0x5a, 0x59, 0x58, 0x57,
-  0x57, 0x57, 0x57, 0x59, 0x58, 0x58, 0x58, 0x58, 0x5a, 0x5a, 0x5b, 0x5b,
-  0x5d, 0x5f, 0x60, 0x61, 0x62, 0x64, 0x66, 0x68, 0x6a, 0x6c, 0x6d, 0x70,
-  0x71, 0x72, 0x72, 0x73, 0x71, 0x71, 0x72, 0x72, 0x70, 0x70, 0x70, 0x6f,
-  0x6f, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x71, 0x71, 0x72,
-  0x72, 0x74, 0x78, 0x7a, 0x7f, 0x86, 0x8c, 0x93, 0x98, 0x9c, 0xa3, 0xae,
-  0xb9, 0xbe, 0xc0, 0xc2, 0xc3, 0xc2, 0xc1, 0xc0, 0xbf, 0xbf, 0xbf, 0xbf,
-  0xbf, 0xbd, 0xb5, 0xa9, 0xa4, 0xa3, 0xa6, 0xab, 0xad, 0xaa, 0xa8, 0xa5,
-  0xa3, 0xa2, 0xa2, 0xa1, 0xa2, 0xa6, 0xa9, 0xa9, 0xa8, 0xa8, 0xae, 0xa4,
-  0x7a, 0x74, 0x90, 0x9f, 0x86, 0x64, 0x56, 0x51, 0x4f, 0x54, 0x63, 0x75,
-  0x94, 0xab, 0xa4, 0x97, 0x93, 0x99, 0x9f, 0x9f, 0xaf, 0x95, 0x6e, 0x40,
-  0x73, 0xb2, 0xbe, 0xc1, 0xc8, 0xcb, 0xca, 0xcc, 0xca, 0xc4, 0xc0, 0xbd,
-  0xba, 0xba, 0xbb, 0xba, 0xbc, 0xc2, 0xc5, 0xc8, 0xc9, 0xcb, 0xce, 0xd0,
-  0xd3, 0xd6, 0xd9, 0xd9, 0xd9, 0xd6, 0xca, 0xbb, 0xb3, 0xb0, 0xae, 0xab,
-  0xab, 0xa9, 0xa7, 0xa3, 0xa1, 0xa1, 0xa2, 0xa4, 0xa7, 0xa7, 0xa6, 0xa8,
-  0xac, 0xb1, 0xb5, 0xb5, 0xb7, 0xb8, 0xbb, 0xbf, 0xc1, 0xc2, 0xc3, 0xc7,
-  0xbe, 0xb0, 0x99, 0x7f, 0x70, 0x5e, 0x4f, 0x54, 0x54, 0x53, 0x51, 0x4f,
-  0x54, 0x59, 0x5c, 0x64, 0x75, 0x7d, 0x77, 0x72, 0x6d, 0x5f, 0x3a, 0x1e,
-  0x1d, 0x34, 0x51, 0x59, 0x5e, 0x57, 0x42, 0x49, 0x57, 0x56, 0x59, 0x66,
-  0x75, 0x86, 0x96, 0x9f, 0xa5, 0xa6, 0x9e, 0x94, 0x8f, 0x8c, 0x89, 0x88,
-  0x87, 0x86, 0x83, 0x7c, 0x72, 0x6c, 0x69, 0x66, 0x62, 0x66, 0x6c, 0x6e,
-  0x72, 0x77, 0x7c, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x85, 0x86, 0x87, 0x87,
-  0x87, 0x89, 0x89, 0x89, 0x88, 0x86, 0x84, 0x83, 0x83, 0x83, 0x81, 0x7f,
-  0x7c, 0x7a, 0x77, 0x73, 0x71, 0x71, 0x70, 0x6f, 0x6d, 0x6b, 0x6a, 0x68,
-  0x64, 0x60, 0x5b, 0x58, 0x55, 0x51, 0x4b, 0x44, 0x40, 0x3d, 0x38, 0x32,
-  0x2a, 0x23, 0x1f, 0x18, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x12, 0x12, 0x13, 0x14, 0x15, 0x15, 0x13, 0x12, 0x60, 0x5d, 0x5b, 0x5b,
-  0x5a, 0x5b, 0x5a, 0x5b, 0x5a, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x59,
-  0x58, 0x57, 0x57, 0x57, 0x59, 0x59, 0x59, 0x5a, 0x5c, 0x5f, 0x60, 0x60,
-  0x62, 0x63, 0x65, 0x67, 0x69, 0x6a, 0x6c, 0x6f, 0x70, 0x70, 0x71, 0x71,
-  0x70, 0x71, 0x71, 0x71, 0x6f, 0x6f, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x71,
-  0x71, 0x71, 0x70, 0x70, 0x6f, 0x6f, 0x70, 0x71, 0x71, 0x73, 0x77, 0x7a,
-  0x7f, 0x88, 0x90, 0x98, 0x9d, 0xa1, 0xa9, 0xb4, 0xbc, 0xc2, 0xc5, 0xc7,
-  0xc9, 0xc7, 0xc4, 0xc2, 0xc1, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xbc, 0xb2,
-  0xab, 0xa9, 0xab, 0xb0, 0xb2, 0xae, 0xab, 0xa8, 0xa7, 0xa8, 0xa9, 0xa9,
-  0xa8, 0xa9, 0xab, 0xaa, 0xa9, 0xa7, 0xa8, 0xa5, 0x8f, 0x82, 0x7a, 0x83,
-  0xa4, 0xa9, 0xa8, 0xa9, 0xab, 0xa7, 0xb0, 0xb6, 0xb0, 0x8c, 0x7a, 0x99,
-  0xa8, 0xa3, 0x88, 0x90, 0xa1, 0x80, 0x5f, 0x45, 0x80, 0xb6, 0xbf, 0xc0,
-  0xc6, 0xca, 0xcb, 0xcd, 0xcd, 0xc8, 0xc0, 0xbc, 0xb9, 0xb8, 0xba, 0xba,
-  0xba, 0xc0, 0xc3, 0xc4, 0xc7, 0xc7, 0xc9, 0xcc, 0xce, 0xd1, 0xd5, 0xd7,
-  0xd8, 0xd7, 0xd1, 0xc7, 0xbe, 0xb9, 0xb5, 0xb1, 0xaf, 0xae, 0xad, 0xaa,
-  0xa5, 0xa4, 0xa5, 0xa7, 0xaa, 0xad, 0xac, 0xab, 0xac, 0xb3, 0xb9, 0xb9,
-  0xb9, 0xb9, 0xbe, 0xc2, 0xc6, 0xc9, 0xcb, 0xcd, 0xc2, 0xb6, 0xa1, 0x82,
-  0x6f, 0x5d, 0x53, 0x57, 0x54, 0x52, 0x52, 0x52, 0x58, 0x5e, 0x61, 0x67,
-  0x77, 0x7e, 0x76, 0x6f, 0x67, 0x63, 0x4f, 0x2d, 0x1f, 0x23, 0x42, 0x4e,
-  0x4f, 0x52, 0x5c, 0x67, 0x5f, 0x5d, 0x60, 0x67, 0x73, 0x88, 0x98, 0x9f,
-  0xa5, 0xa6, 0x9f, 0x94, 0x8f, 0x8b, 0x89, 0x87, 0x86, 0x85, 0x83, 0x7c,
-  0x72, 0x6b, 0x68, 0x65, 0x61, 0x65, 0x6a, 0x6e, 0x72, 0x79, 0x7e, 0x80,
-  0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x89, 0x89,
-  0x88, 0x86, 0x84, 0x84, 0x84, 0x84, 0x82, 0x80, 0x7d, 0x7b, 0x78, 0x74,
-  0x72, 0x71, 0x71, 0x6f, 0x6d, 0x6b, 0x69, 0x67, 0x64, 0x5f, 0x5b, 0x57,
-  0x54, 0x50, 0x4a, 0x43, 0x3f, 0x3d, 0x39, 0x33, 0x2c, 0x25, 0x20, 0x18,
-  0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13,
-  0x15, 0x15, 0x13, 0x12, 0x66, 0x60, 0x5d, 0x5c, 0x5b, 0x5b, 0x5b, 0x5b,
-  0x5a, 0x58, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x57, 0x57, 0x57, 0x57,
-  0x58, 0x58, 0x58, 0x59, 0x5b, 0x5e, 0x60, 0x61, 0x62, 0x63, 0x64, 0x67,
-  0x68, 0x69, 0x6b, 0x6e, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x71, 0x70,
-  0x6f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e,
-  0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x73, 0x77, 0x7b, 0x82, 0x8d, 0x96, 0x9f,
-  0xa4, 0xa8, 0xb1, 0xb9, 0xc0, 0xc6, 0xc8, 0xca, 0xcb, 0xca, 0xc8, 0xc7,
-  0xc5, 0xc6, 0xc6, 0xc6, 0xc6, 0xc4, 0xc1, 0xbc, 0xb5, 0xb2, 0xb1, 0xb6,
-  0xb7, 0xb3, 0xb0, 0xac, 0xab, 0xad, 0xae, 0xae, 0xae, 0xac, 0xac, 0xab,
-  0xab, 0xa8, 0xa7, 0xaa, 0xa2, 0x96, 0x88, 0x8c, 0x8c, 0x8a, 0x90, 0xa1,
-  0xa4, 0x95, 0x9f, 0xa2, 0x9a, 0x8e, 0x89, 0xab, 0xba, 0xaf, 0x8b, 0x99,
-  0x96, 0x5d, 0x41, 0x47, 0x86, 0xb7, 0xbe, 0xc0, 0xc4, 0xc9, 0xca, 0xcc,
-  0xcc, 0xc9, 0xbe, 0xb8, 0xb6, 0xb6, 0xb8, 0xb8, 0xb8, 0xbb, 0xbe, 0xbf,
-  0xc2, 0xc2, 0xc4, 0xc5, 0xc8, 0xcd, 0xd1, 0xd2, 0xd3, 0xd5, 0xd8, 0xd3,
-  0xc9, 0xc2, 0xbb, 0xb7, 0xb7, 0xb6, 0xb5, 0xb3, 0xac, 0xa7, 0xa7, 0xa8,
-  0xad, 0xb1, 0xb1, 0xb0, 0xb0, 0xb3, 0xba, 0xbd, 0xbb, 0xbc, 0xc1, 0xc5,
-  0xcb, 0xd0, 0xd2, 0xd1, 0xc4, 0xbb, 0xa6, 0x84, 0x6f, 0x5f, 0x5a, 0x5a,
-  0x54, 0x51, 0x52, 0x55, 0x5a, 0x5f, 0x60, 0x62, 0x71, 0x7c, 0x74, 0x6a,
-  0x60, 0x61, 0x60, 0x48, 0x33, 0x1e, 0x29, 0x3e, 0x41, 0x4b, 0x63, 0x6d,
-  0x5f, 0x56, 0x58, 0x66, 0x74, 0x88, 0x97, 0x9f, 0xa5, 0xa5, 0x9c, 0x91,
-  0x8c, 0x88, 0x86, 0x86, 0x86, 0x85, 0x82, 0x7c, 0x72, 0x6c, 0x69, 0x66,
-  0x60, 0x62, 0x69, 0x6d, 0x72, 0x7a, 0x80, 0x82, 0x83, 0x84, 0x87, 0x88,
-  0x89, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c, 0x8b, 0x8a, 0x8a, 0x88, 0x86, 0x86,
-  0x85, 0x85, 0x83, 0x81, 0x7f, 0x7c, 0x79, 0x76, 0x74, 0x72, 0x71, 0x6f,
-  0x6c, 0x6b, 0x69, 0x67, 0x64, 0x5e, 0x5b, 0x57, 0x54, 0x51, 0x4b, 0x43,
-  0x3f, 0x3d, 0x38, 0x32, 0x2b, 0x25, 0x20, 0x18, 0x13, 0x11, 0x11, 0x11,
-  0x12, 0x11, 0x10, 0x11, 0x12, 0x12, 0x12, 0x13, 0x15, 0x14, 0x13, 0x12,
-  0x6b, 0x64, 0x5f, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x56,
-  0x56, 0x56, 0x57, 0x57, 0x56, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x5a,
-  0x5b, 0x5c, 0x5e, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x69, 0x6b,
-  0x6c, 0x6e, 0x70, 0x72, 0x72, 0x71, 0x71, 0x70, 0x6f, 0x6d, 0x6c, 0x6c,
-  0x6c, 0x6c, 0x6c, 0x6d, 0x6c, 0x6c, 0x6d, 0x6d, 0x6c, 0x6d, 0x6d, 0x6d,
-  0x6d, 0x70, 0x77, 0x7d, 0x86, 0x93, 0x9c, 0xa6, 0xac, 0xb0, 0xb7, 0xbd,
-  0xc3, 0xc8, 0xca, 0xca, 0xca, 0xcb, 0xca, 0xc9, 0xc8, 0xc6, 0xc7, 0xc8,
-  0xc7, 0xc6, 0xc3, 0xbf, 0xbb, 0xb8, 0xb6, 0xb9, 0xba, 0xb8, 0xb6, 0xb1,
-  0xae, 0xb0, 0xb1, 0xb1, 0xb0, 0xad, 0xad, 0xad, 0xac, 0xaa, 0xa8, 0xa7,
-  0x98, 0x91, 0x92, 0x9b, 0x95, 0x8e, 0x92, 0x9e, 0x90, 0x98, 0x92, 0x90,
-  0x95, 0x91, 0xa0, 0xb5, 0xba, 0xb0, 0x9b, 0xad, 0x8f, 0x45, 0x31, 0x51,
-  0x8f, 0xb7, 0xc2, 0xc3, 0xc3, 0xc7, 0xc4, 0xc7, 0xc7, 0xc2, 0xba, 0xb5,
-  0xb5, 0xb7, 0xb9, 0xb5, 0xb8, 0xb9, 0xb9, 0xbd, 0xc0, 0xbe, 0xbe, 0xbf,
-  0xc2, 0xc8, 0xcb, 0xcc, 0xcd, 0xd0, 0xd9, 0xda, 0xd2, 0xcb, 0xc1, 0xb9,
-  0xbd, 0xbe, 0xbe, 0xbb, 0xb5, 0xb0, 0xae, 0xae, 0xb1, 0xb5, 0xb6, 0xb3,
-  0xb3, 0xb6, 0xbd, 0xc2, 0xc1, 0xc2, 0xc5, 0xc4, 0xc7, 0xca, 0xcc, 0xcc,
-  0xc4, 0xbc, 0xa5, 0x85, 0x72, 0x60, 0x5e, 0x5b, 0x55, 0x52, 0x53, 0x57,
-  0x5b, 0x5b, 0x5b, 0x5d, 0x6d, 0x7c, 0x7c, 0x77, 0x6d, 0x64, 0x65, 0x5d,
-  0x4b, 0x2b, 0x1f, 0x2c, 0x3f, 0x4c, 0x5b, 0x5f, 0x58, 0x55, 0x5a, 0x68,
-  0x74, 0x86, 0x93, 0x9a, 0xa2, 0xa1, 0x98, 0x8e, 0x89, 0x85, 0x83, 0x84,
-  0x85, 0x84, 0x81, 0x79, 0x70, 0x6a, 0x67, 0x64, 0x5f, 0x60, 0x67, 0x6b,
-  0x71, 0x7a, 0x80, 0x84, 0x85, 0x86, 0x88, 0x89, 0x8b, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8d, 0x8c, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x87, 0x86, 0x85, 0x82,
-  0x81, 0x7f, 0x7b, 0x78, 0x75, 0x73, 0x72, 0x70, 0x6d, 0x6b, 0x68, 0x66,
-  0x63, 0x5d, 0x5a, 0x55, 0x52, 0x50, 0x4a, 0x44, 0x40, 0x3d, 0x37, 0x30,
-  0x2b, 0x22, 0x1d, 0x18, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x13, 0x13, 0x12, 0x13, 0x15, 0x15, 0x13, 0x12, 0x6f, 0x68, 0x62, 0x5f,
-  0x5c, 0x5b, 0x5b, 0x5b, 0x5b, 0x59, 0x59, 0x57, 0x57, 0x56, 0x56, 0x57,
-  0x58, 0x57, 0x58, 0x59, 0x58, 0x57, 0x58, 0x59, 0x5b, 0x5c, 0x5d, 0x5f,
-  0x60, 0x61, 0x63, 0x64, 0x66, 0x67, 0x6a, 0x6c, 0x6d, 0x6e, 0x70, 0x72,
-  0x72, 0x71, 0x71, 0x71, 0x70, 0x6d, 0x6c, 0x6c, 0x6b, 0x6c, 0x6b, 0x6c,
-  0x6b, 0x6b, 0x6c, 0x6c, 0x6b, 0x6c, 0x6c, 0x6b, 0x6d, 0x71, 0x79, 0x80,
-  0x8c, 0x98, 0xa0, 0xaa, 0xb1, 0xb5, 0xb9, 0xbf, 0xc5, 0xc9, 0xca, 0xcb,
-  0xcc, 0xcd, 0xcc, 0xcb, 0xc9, 0xc7, 0xc5, 0xc6, 0xc6, 0xc6, 0xc2, 0xbf,
-  0xbd, 0xbc, 0xba, 0xbb, 0xbd, 0xbd, 0xba, 0xb5, 0xb1, 0xb0, 0xb2, 0xb2,
-  0xb1, 0xae, 0xad, 0xad, 0xad, 0xab, 0xa9, 0xa8, 0xa2, 0x9f, 0xa1, 0xa5,
-  0x8e, 0x8f, 0x8f, 0x8b, 0x99, 0xa8, 0xa5, 0x9e, 0x97, 0xa8, 0xb4, 0xb3,
-  0xa5, 0x8e, 0xa1, 0xa7, 0x78, 0x36, 0x2a, 0x53, 0x99, 0xbb, 0xc4, 0xc4,
-  0xc4, 0xc5, 0xc2, 0xc3, 0xc2, 0xbb, 0xbb, 0xb8, 0xb7, 0xb8, 0xb9, 0xb7,
-  0xba, 0xb8, 0xb8, 0xbb, 0xbf, 0xbe, 0xbd, 0xbd, 0xbf, 0xc3, 0xc6, 0xc6,
-  0xc7, 0xcc, 0xd9, 0xde, 0xd9, 0xd2, 0xc5, 0xbb, 0xc0, 0xc5, 0xc5, 0xc3,
-  0xbd, 0xb8, 0xb5, 0xb4, 0xb3, 0xb8, 0xba, 0xb7, 0xb8, 0xbc, 0xc2, 0xc6,
-  0xc6, 0xc6, 0xc4, 0xc1, 0xc0, 0xc4, 0xc6, 0xc7, 0xc3, 0xb8, 0xa1, 0x8b,
-  0x79, 0x63, 0x60, 0x5d, 0x57, 0x54, 0x53, 0x59, 0x5d, 0x5a, 0x5a, 0x61,
-  0x73, 0x82, 0x85, 0x82, 0x76, 0x68, 0x66, 0x63, 0x5a, 0x44, 0x32, 0x31,
-  0x43, 0x4c, 0x4f, 0x55, 0x5b, 0x5a, 0x5c, 0x68, 0x74, 0x83, 0x8f, 0x95,
-  0x9b, 0x9a, 0x93, 0x8c, 0x88, 0x84, 0x82, 0x83, 0x84, 0x83, 0x80, 0x78,
-  0x6f, 0x69, 0x67, 0x63, 0x5e, 0x5f, 0x66, 0x6b, 0x71, 0x7b, 0x82, 0x85,
-  0x86, 0x87, 0x88, 0x8b, 0x8c, 0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c,
-  0x8c, 0x8a, 0x89, 0x89, 0x89, 0x88, 0x86, 0x85, 0x83, 0x81, 0x7c, 0x78,
-  0x75, 0x73, 0x72, 0x70, 0x6d, 0x6b, 0x68, 0x66, 0x63, 0x5e, 0x5a, 0x55,
-  0x52, 0x4f, 0x48, 0x44, 0x40, 0x3c, 0x36, 0x30, 0x2a, 0x22, 0x1d, 0x18,
-  0x13, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x13, 0x13, 0x12, 0x13,
-  0x15, 0x16, 0x14, 0x12, 0x73, 0x6b, 0x64, 0x60, 0x5c, 0x5c, 0x5c, 0x5c,
-  0x5b, 0x5a, 0x59, 0x57, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x59,
-  0x58, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5e, 0x5f, 0x60, 0x62, 0x63,
-  0x66, 0x67, 0x6a, 0x6c, 0x6d, 0x6f, 0x70, 0x72, 0x71, 0x71, 0x71, 0x71,
-  0x70, 0x6d, 0x6c, 0x6c, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6c, 0x6c,
-  0x6a, 0x6b, 0x6b, 0x6a, 0x6c, 0x72, 0x7b, 0x83, 0x8f, 0x9b, 0xa3, 0xad,
-  0xb3, 0xb7, 0xba, 0xc0, 0xc6, 0xc9, 0xca, 0xcb, 0xcc, 0xce, 0xce, 0xcd,
-  0xca, 0xc7, 0xc4, 0xc4, 0xc5, 0xc5, 0xc2, 0xbe, 0xbd, 0xbc, 0xba, 0xbb,
-  0xbe, 0xbf, 0xbd, 0xb8, 0xb3, 0xb2, 0xb3, 0xb4, 0xb2, 0xaf, 0xae, 0xae,
-  0xae, 0xad, 0xaa, 0xa9, 0xab, 0xa9, 0xa6, 0xa3, 0x94, 0x98, 0x95, 0x8c,
-  0xa6, 0xac, 0xa1, 0x9b, 0x9f, 0xb3, 0xb8, 0xab, 0x9b, 0x8a, 0xa2, 0xa2,
-  0x6a, 0x2f, 0x29, 0x58, 0xa0, 0xbe, 0xc4, 0xc5, 0xc4, 0xc6, 0xc4, 0xc4,
-  0xc0, 0xb9, 0xbb, 0xba, 0xb7, 0xb7, 0xb9, 0xb8, 0xba, 0xb8, 0xb7, 0xba,
-  0xbe, 0xbe, 0xbe, 0xbe, 0xbd, 0xc0, 0xc1, 0xc2, 0xc4, 0xc9, 0xd7, 0xde,
-  0xda, 0xd4, 0xc6, 0xbc, 0xc0, 0xc7, 0xc8, 0xc8, 0xc3, 0xbe, 0xbb, 0xb8,
-  0xb6, 0xb9, 0xbc, 0xba, 0xbb, 0xbf, 0xc3, 0xc7, 0xc8, 0xc6, 0xc2, 0xbe,
-  0xbe, 0xc0, 0xc3, 0xc6, 0xc3, 0xb3, 0x9e, 0x8f, 0x80, 0x68, 0x62, 0x5f,
-  0x59, 0x55, 0x54, 0x5a, 0x5f, 0x5c, 0x5c, 0x66, 0x75, 0x80, 0x86, 0x85,
-  0x7a, 0x6c, 0x67, 0x65, 0x60, 0x53, 0x41, 0x3b, 0x48, 0x4f, 0x51, 0x57,
-  0x5f, 0x5a, 0x5c, 0x67, 0x73, 0x80, 0x8b, 0x91, 0x96, 0x96, 0x90, 0x8b,
-  0x88, 0x83, 0x82, 0x83, 0x83, 0x82, 0x7f, 0x77, 0x6e, 0x68, 0x66, 0x63,
-  0x5e, 0x5e, 0x65, 0x6a, 0x71, 0x7b, 0x82, 0x85, 0x87, 0x87, 0x89, 0x8b,
-  0x8d, 0x8d, 0x8e, 0x8f, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8b, 0x8a, 0x8a,
-  0x8a, 0x89, 0x87, 0x86, 0x84, 0x82, 0x7d, 0x78, 0x75, 0x74, 0x72, 0x70,
-  0x6d, 0x6a, 0x68, 0x66, 0x64, 0x5f, 0x5a, 0x55, 0x52, 0x4e, 0x48, 0x43,
-  0x40, 0x3c, 0x36, 0x31, 0x2a, 0x23, 0x1e, 0x18, 0x14, 0x12, 0x11, 0x11,
-  0x11, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x15, 0x14, 0x12,
-  0x78, 0x6f, 0x68, 0x64, 0x5f, 0x5c, 0x5d, 0x5d, 0x5c, 0x5b, 0x59, 0x59,
-  0x58, 0x57, 0x57, 0x57, 0x58, 0x59, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59,
-  0x59, 0x5b, 0x5c, 0x5e, 0x5f, 0x61, 0x62, 0x64, 0x66, 0x68, 0x69, 0x6b,
-  0x6d, 0x6f, 0x70, 0x71, 0x71, 0x70, 0x70, 0x71, 0x70, 0x6d, 0x6b, 0x6b,
-  0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x69, 0x6a, 0x6a, 0x6a,
-  0x6b, 0x73, 0x7f, 0x88, 0x94, 0xa1, 0xa9, 0xb0, 0xb5, 0xb7, 0xbb, 0xc0,
-  0xc6, 0xc8, 0xc9, 0xcb, 0xce, 0xd0, 0xd0, 0xd0, 0xcd, 0xc8, 0xc4, 0xc3,
-  0xc2, 0xc2, 0xc1, 0xbe, 0xbc, 0xbb, 0xb9, 0xba, 0xbf, 0xc0, 0xbf, 0xbb,
-  0xb6, 0xb4, 0xb5, 0xb5, 0xb3, 0xaf, 0xaf, 0xaf, 0xaf, 0xae, 0xaa, 0xab,
-  0xb2, 0xb0, 0xa3, 0x9b, 0xad, 0xb1, 0xad, 0xa8, 0xb3, 0xa2, 0x87, 0x8c,
-  0xad, 0xb1, 0xab, 0x99, 0x98, 0xa4, 0xa1, 0xa0, 0x5e, 0x2e, 0x32, 0x6a,
-  0xab, 0xc0, 0xc5, 0xc6, 0xc5, 0xca, 0xca, 0xc7, 0xc1, 0xb9, 0xbc, 0xb9,
-  0xb4, 0xb4, 0xb8, 0xba, 0xb8, 0xb6, 0xb6, 0xb8, 0xbd, 0xbe, 0xbe, 0xbd,
-  0xbb, 0xbc, 0xbc, 0xbc, 0xbe, 0xc5, 0xd3, 0xdb, 0xd8, 0xd1, 0xc6, 0xbe,
-  0xc1, 0xc6, 0xc9, 0xca, 0xc7, 0xc4, 0xc2, 0xc0, 0xbc, 0xbb, 0xbe, 0xbe,
-  0xbf, 0xc2, 0xc3, 0xc5, 0xc7, 0xc5, 0xbd, 0xba, 0xbb, 0xbe, 0xc2, 0xc6,
-  0xc1, 0xac, 0x9b, 0x94, 0x89, 0x72, 0x66, 0x61, 0x5b, 0x57, 0x55, 0x5a,
-  0x5e, 0x61, 0x64, 0x6a, 0x70, 0x76, 0x81, 0x82, 0x7b, 0x73, 0x6a, 0x65,
-  0x62, 0x5c, 0x52, 0x4b, 0x4f, 0x56, 0x60, 0x63, 0x5f, 0x55, 0x57, 0x65,
-  0x73, 0x7c, 0x84, 0x8a, 0x90, 0x91, 0x8e, 0x8a, 0x87, 0x83, 0x81, 0x82,
-  0x82, 0x81, 0x7e, 0x76, 0x6e, 0x67, 0x64, 0x61, 0x5e, 0x5d, 0x64, 0x69,
-  0x71, 0x7b, 0x83, 0x86, 0x87, 0x88, 0x8a, 0x8d, 0x8f, 0x8f, 0x8f, 0x90,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8b, 0x8b, 0x8b, 0x89, 0x88, 0x87,
-  0x85, 0x83, 0x7f, 0x7b, 0x77, 0x75, 0x73, 0x71, 0x6c, 0x6a, 0x68, 0x66,
-  0x63, 0x5e, 0x5a, 0x56, 0x53, 0x4e, 0x49, 0x42, 0x3e, 0x3b, 0x36, 0x31,
-  0x2c, 0x27, 0x22, 0x1a, 0x13, 0x12, 0x11, 0x11, 0x11, 0x12, 0x12, 0x12,
-  0x12, 0x12, 0x14, 0x14, 0x15, 0x16, 0x15, 0x14, 0x80, 0x76, 0x6e, 0x6a,
-  0x64, 0x5f, 0x5c, 0x5d, 0x5d, 0x5c, 0x5a, 0x5a, 0x58, 0x57, 0x57, 0x58,
-  0x5a, 0x59, 0x59, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x59, 0x5b, 0x5d, 0x5e,
-  0x5f, 0x60, 0x61, 0x64, 0x65, 0x67, 0x67, 0x6a, 0x6d, 0x6e, 0x6e, 0x6f,
-  0x71, 0x70, 0x71, 0x71, 0x6f, 0x6d, 0x6b, 0x6b, 0x6a, 0x69, 0x69, 0x69,
-  0x6a, 0x6a, 0x69, 0x69, 0x66, 0x67, 0x68, 0x68, 0x6c, 0x79, 0x87, 0x8f,
-  0x9a, 0xa5, 0xac, 0xb2, 0xb7, 0xba, 0xbd, 0xc2, 0xc6, 0xc7, 0xc8, 0xcb,
-  0xcf, 0xd1, 0xd2, 0xd2, 0xcf, 0xca, 0xc5, 0xc2, 0xc0, 0xbe, 0xbf, 0xbd,
-  0xbb, 0xb9, 0xb7, 0xb9, 0xbe, 0xc1, 0xc0, 0xbd, 0xb9, 0xb6, 0xb6, 0xb6,
-  0xb4, 0xb0, 0xae, 0xaf, 0xb0, 0xaf, 0xac, 0xac, 0xaf, 0xae, 0xa9, 0xaa,
-  0xaf, 0xb8, 0xbc, 0xb9, 0x9d, 0x84, 0x93, 0xa3, 0xae, 0x9d, 0x97, 0x92,
-  0x9c, 0xb2, 0xa2, 0x99, 0x4f, 0x37, 0x4c, 0x89, 0xb3, 0xc1, 0xc7, 0xc9,
-  0xcb, 0xcf, 0xcf, 0xca, 0xc5, 0xbe, 0xbe, 0xbd, 0xbb, 0xb9, 0xb7, 0xbb,
-  0xb8, 0xb6, 0xb6, 0xb7, 0xbb, 0xbc, 0xba, 0xb9, 0xba, 0xbc, 0xb9, 0xb8,
-  0xba, 0xbf, 0xcb, 0xd1, 0xcb, 0xc6, 0xc1, 0xbd, 0xc0, 0xc4, 0xc7, 0xc9,
-  0xc8, 0xc6, 0xc7, 0xc6, 0xc1, 0xbd, 0xbe, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1,
-  0xc1, 0xbf, 0xba, 0xba, 0xbd, 0xc0, 0xc3, 0xc6, 0xba, 0xa3, 0x97, 0x95,
-  0x8e, 0x7b, 0x6b, 0x64, 0x60, 0x5d, 0x5a, 0x5e, 0x63, 0x65, 0x67, 0x6b,
-  0x6e, 0x75, 0x7f, 0x81, 0x7d, 0x78, 0x6c, 0x66, 0x63, 0x5e, 0x5b, 0x55,
-  0x52, 0x54, 0x5d, 0x5c, 0x55, 0x4c, 0x4f, 0x63, 0x73, 0x79, 0x7e, 0x81,
-  0x87, 0x8a, 0x89, 0x86, 0x84, 0x82, 0x81, 0x83, 0x83, 0x82, 0x7d, 0x75,
-  0x6c, 0x65, 0x63, 0x60, 0x5c, 0x5b, 0x61, 0x67, 0x70, 0x7c, 0x84, 0x87,
-  0x89, 0x8a, 0x8c, 0x8e, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90,
-  0x90, 0x8f, 0x8d, 0x8d, 0x8d, 0x8b, 0x8a, 0x88, 0x86, 0x84, 0x82, 0x7d,
-  0x79, 0x77, 0x76, 0x72, 0x6e, 0x6a, 0x67, 0x65, 0x61, 0x5d, 0x5a, 0x55,
-  0x53, 0x4e, 0x47, 0x41, 0x3d, 0x3a, 0x35, 0x31, 0x2b, 0x27, 0x22, 0x1a,
-  0x13, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14,
-  0x16, 0x16, 0x14, 0x15, 0x85, 0x7d, 0x76, 0x71, 0x69, 0x61, 0x5c, 0x5d,
-  0x5d, 0x5b, 0x5a, 0x5a, 0x58, 0x58, 0x58, 0x5b, 0x5c, 0x5b, 0x5b, 0x59,
-  0x58, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x64,
-  0x64, 0x65, 0x67, 0x68, 0x6b, 0x6c, 0x6d, 0x6e, 0x70, 0x70, 0x70, 0x70,
-  0x6f, 0x6d, 0x6c, 0x6b, 0x6a, 0x68, 0x68, 0x69, 0x69, 0x69, 0x67, 0x66,
-  0x64, 0x64, 0x64, 0x66, 0x6e, 0x7e, 0x8e, 0x96, 0xa0, 0xaa, 0xb0, 0xb4,
-  0xb8, 0xbb, 0xbd, 0xc3, 0xc6, 0xc7, 0xc8, 0xcb, 0xd0, 0xd3, 0xd3, 0xd3,
-  0xd1, 0xcd, 0xc8, 0xc4, 0xc1, 0xbd, 0xbb, 0xbb, 0xb9, 0xb8, 0xb7, 0xb9,
-  0xbe, 0xc1, 0xc2, 0xc1, 0xbd, 0xb8, 0xb7, 0xb7, 0xb5, 0xb1, 0xae, 0xaf,
-  0xaf, 0xae, 0xae, 0xae, 0xae, 0xb1, 0xb4, 0xb3, 0xb2, 0xb8, 0xb1, 0x99,
-  0x91, 0xa3, 0xb5, 0xbb, 0xb1, 0x8d, 0xad, 0xb4, 0xb3, 0xb3, 0xa8, 0x89,
-  0x46, 0x51, 0x6f, 0x9e, 0xb8, 0xc3, 0xc8, 0xca, 0xcd, 0xcf, 0xce, 0xc9,
-  0xc6, 0xc1, 0xbc, 0xbd, 0xbd, 0xbb, 0xb7, 0xb6, 0xb5, 0xb5, 0xb5, 0xb5,
-  0xba, 0xbc, 0xbb, 0xbb, 0xbe, 0xbe, 0xbb, 0xb9, 0xba, 0xbf, 0xc5, 0xc4,
-  0xc0, 0xbe, 0xbe, 0xbe, 0xc0, 0xc4, 0xc6, 0xc7, 0xc7, 0xc7, 0xc6, 0xc5,
-  0xc3, 0xc0, 0xbf, 0xc0, 0xc0, 0xbf, 0xbc, 0xbc, 0xbb, 0xba, 0xb9, 0xbc,
-  0xc0, 0xc4, 0xc5, 0xc2, 0xaf, 0x9c, 0x95, 0x94, 0x8f, 0x81, 0x71, 0x6c,
-  0x68, 0x63, 0x5b, 0x5f, 0x65, 0x67, 0x67, 0x68, 0x6f, 0x74, 0x7c, 0x80,
-  0x80, 0x7d, 0x75, 0x6e, 0x68, 0x60, 0x5c, 0x58, 0x50, 0x50, 0x58, 0x58,
-  0x4e, 0x47, 0x4c, 0x5f, 0x73, 0x77, 0x78, 0x7a, 0x7f, 0x82, 0x81, 0x80,
-  0x7f, 0x7d, 0x7c, 0x7e, 0x7f, 0x7e, 0x7a, 0x73, 0x6a, 0x65, 0x62, 0x5f,
-  0x5b, 0x59, 0x5e, 0x64, 0x6e, 0x7c, 0x85, 0x89, 0x8b, 0x8c, 0x8d, 0x90,
-  0x92, 0x92, 0x92, 0x92, 0x92, 0x94, 0x93, 0x92, 0x91, 0x91, 0x8f, 0x90,
-  0x8f, 0x8e, 0x8c, 0x8b, 0x88, 0x87, 0x84, 0x81, 0x7c, 0x79, 0x77, 0x74,
-  0x70, 0x6c, 0x67, 0x64, 0x60, 0x5c, 0x59, 0x55, 0x52, 0x4c, 0x47, 0x40,
-  0x3b, 0x38, 0x33, 0x2f, 0x29, 0x24, 0x20, 0x19, 0x13, 0x12, 0x11, 0x11,
-  0x12, 0x12, 0x11, 0x13, 0x13, 0x13, 0x14, 0x13, 0x14, 0x14, 0x13, 0x14,
-  0x8a, 0x82, 0x7b, 0x75, 0x6d, 0x64, 0x5e, 0x5b, 0x5a, 0x5a, 0x5a, 0x59,
-  0x58, 0x58, 0x58, 0x5b, 0x5c, 0x5b, 0x5b, 0x59, 0x59, 0x58, 0x59, 0x59,
-  0x59, 0x5a, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x64, 0x65, 0x65, 0x66, 0x67,
-  0x6a, 0x6d, 0x6e, 0x6e, 0x70, 0x6f, 0x6e, 0x6e, 0x6d, 0x6c, 0x6b, 0x6b,
-  0x6a, 0x69, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x63, 0x63, 0x63, 0x65,
-  0x70, 0x84, 0x94, 0x9d, 0xa5, 0xac, 0xb2, 0xb5, 0xb8, 0xbb, 0xbf, 0xc3,
-  0xc6, 0xc7, 0xc8, 0xcc, 0xd0, 0xd3, 0xd3, 0xd3, 0xd3, 0xd0, 0xca, 0xc7,
-  0xc3, 0xbe, 0xba, 0xb9, 0xb8, 0xb8, 0xb6, 0xb9, 0xbe, 0xc1, 0xc2, 0xc3,
-  0xbf, 0xba, 0xb7, 0xb7, 0xb6, 0xb2, 0xaf, 0xae, 0xae, 0xae, 0xaf, 0xaf,
-  0xaf, 0xb1, 0xb4, 0xaf, 0xb6, 0xb3, 0x9c, 0x76, 0xa1, 0xc0, 0xc2, 0xc0,
-  0xaf, 0x7f, 0xac, 0xbd, 0xba, 0xaf, 0xa7, 0x79, 0x47, 0x6b, 0x8c, 0xaa,
-  0xbc, 0xc4, 0xca, 0xcc, 0xcc, 0xcc, 0xcb, 0xc9, 0xc6, 0xc1, 0xbb, 0xbc,
-  0xbc, 0xbb, 0xba, 0xb6, 0xb3, 0xb3, 0xb3, 0xb5, 0xb9, 0xbd, 0xbe, 0xbe,
-  0xc1, 0xbf, 0xbb, 0xbc, 0xbf, 0xc7, 0xcb, 0xc6, 0xc1, 0xbf, 0xbf, 0xc0,
-  0xc3, 0xc5, 0xc6, 0xc5, 0xc6, 0xc6, 0xc5, 0xc4, 0xc3, 0xc1, 0xc0, 0xc0,
-  0xbf, 0xbd, 0xbb, 0xbb, 0xba, 0xb8, 0xb8, 0xbc, 0xc2, 0xc5, 0xc4, 0xbd,
-  0xa8, 0x98, 0x92, 0x91, 0x8d, 0x80, 0x71, 0x6e, 0x6c, 0x66, 0x5b, 0x60,
-  0x66, 0x67, 0x67, 0x66, 0x6f, 0x75, 0x7a, 0x7e, 0x81, 0x80, 0x7e, 0x76,
-  0x6f, 0x66, 0x5d, 0x59, 0x51, 0x51, 0x56, 0x58, 0x4e, 0x48, 0x4c, 0x5e,
-  0x74, 0x76, 0x75, 0x76, 0x7a, 0x7d, 0x7b, 0x7a, 0x78, 0x76, 0x75, 0x77,
-  0x7a, 0x7b, 0x78, 0x71, 0x6a, 0x65, 0x63, 0x60, 0x5a, 0x58, 0x5c, 0x62,
-  0x6d, 0x7b, 0x84, 0x89, 0x8b, 0x8c, 0x8e, 0x90, 0x92, 0x94, 0x94, 0x94,
-  0x95, 0x95, 0x95, 0x94, 0x93, 0x91, 0x91, 0x92, 0x91, 0x90, 0x8e, 0x8c,
-  0x8b, 0x8a, 0x87, 0x84, 0x7f, 0x7b, 0x78, 0x75, 0x71, 0x6c, 0x68, 0x65,
-  0x61, 0x5c, 0x59, 0x56, 0x52, 0x4d, 0x48, 0x40, 0x3c, 0x39, 0x32, 0x2e,
-  0x28, 0x23, 0x20, 0x1a, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12,
-  0x13, 0x13, 0x15, 0x13, 0x13, 0x14, 0x13, 0x15, 0x8c, 0x85, 0x7e, 0x79,
-  0x70, 0x67, 0x5f, 0x5c, 0x5a, 0x5a, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x5b,
-  0x5c, 0x5b, 0x5b, 0x59, 0x59, 0x58, 0x59, 0x59, 0x58, 0x59, 0x5c, 0x5d,
-  0x5f, 0x60, 0x61, 0x63, 0x64, 0x64, 0x64, 0x66, 0x69, 0x6c, 0x6e, 0x6e,
-  0x70, 0x6f, 0x6e, 0x6d, 0x6d, 0x6c, 0x6b, 0x6b, 0x6a, 0x69, 0x66, 0x66,
-  0x66, 0x66, 0x65, 0x64, 0x63, 0x62, 0x62, 0x65, 0x73, 0x88, 0x98, 0x9f,
-  0xa7, 0xad, 0xb2, 0xb6, 0xb9, 0xbc, 0xc0, 0xc4, 0xc6, 0xc7, 0xc8, 0xcd,
-  0xd0, 0xd3, 0xd4, 0xd4, 0xd4, 0xd2, 0xcc, 0xc8, 0xc5, 0xbf, 0xba, 0xb8,
-  0xb8, 0xb8, 0xb6, 0xb9, 0xbd, 0xc1, 0xc3, 0xc4, 0xc0, 0xbb, 0xb8, 0xb8,
-  0xb7, 0xb2, 0xb0, 0xad, 0xad, 0xae, 0xb0, 0xb0, 0xb0, 0xb1, 0xb3, 0xb1,
-  0xb8, 0xae, 0x96, 0x77, 0xb0, 0xc5, 0xb5, 0xac, 0xa1, 0x7e, 0xa0, 0xb6,
-  0xb7, 0xad, 0xa1, 0x6a, 0x51, 0x7b, 0x98, 0xb0, 0xbe, 0xc4, 0xc8, 0xc9,
-  0xc7, 0xc8, 0xc8, 0xc7, 0xc4, 0xbe, 0xba, 0xbb, 0xbb, 0xbb, 0xbb, 0xb6,
-  0xb2, 0xb3, 0xb4, 0xb5, 0xb8, 0xbc, 0xbd, 0xbf, 0xc1, 0xbf, 0xbd, 0xbf,
-  0xc2, 0xcb, 0xd1, 0xcb, 0xc7, 0xc5, 0xc3, 0xc2, 0xc3, 0xc5, 0xc5, 0xc5,
-  0xc7, 0xc6, 0xc5, 0xc4, 0xc3, 0xc2, 0xc1, 0xc0, 0xbf, 0xbc, 0xbb, 0xba,
-  0xb9, 0xb9, 0xb8, 0xbb, 0xc1, 0xc3, 0xc1, 0xb8, 0xa3, 0x95, 0x90, 0x8f,
-  0x8b, 0x7e, 0x6e, 0x6b, 0x6c, 0x67, 0x5b, 0x60, 0x66, 0x66, 0x65, 0x66,
-  0x6d, 0x75, 0x7b, 0x7f, 0x82, 0x81, 0x80, 0x79, 0x73, 0x6a, 0x60, 0x5b,
-  0x54, 0x52, 0x56, 0x57, 0x4e, 0x47, 0x4b, 0x5d, 0x74, 0x75, 0x72, 0x73,
-  0x77, 0x7a, 0x78, 0x76, 0x75, 0x73, 0x71, 0x73, 0x76, 0x77, 0x76, 0x70,
-  0x68, 0x64, 0x62, 0x5f, 0x5a, 0x58, 0x5b, 0x60, 0x6b, 0x7a, 0x83, 0x89,
-  0x8b, 0x8c, 0x8e, 0x91, 0x93, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x95,
-  0x94, 0x92, 0x93, 0x93, 0x92, 0x91, 0x8f, 0x8d, 0x8c, 0x8b, 0x8a, 0x86,
-  0x81, 0x7d, 0x7a, 0x76, 0x72, 0x6c, 0x69, 0x66, 0x62, 0x5d, 0x59, 0x55,
-  0x52, 0x4e, 0x49, 0x41, 0x3d, 0x3a, 0x33, 0x30, 0x29, 0x24, 0x20, 0x1b,
-  0x15, 0x12, 0x11, 0x11, 0x10, 0x10, 0x10, 0x12, 0x13, 0x13, 0x14, 0x13,
-  0x13, 0x14, 0x13, 0x15, 0x90, 0x89, 0x83, 0x7d, 0x75, 0x6b, 0x62, 0x5e,
-  0x5c, 0x5a, 0x59, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x5c, 0x5b, 0x5a, 0x58,
-  0x58, 0x58, 0x59, 0x59, 0x58, 0x58, 0x5b, 0x5c, 0x5d, 0x5f, 0x60, 0x62,
-  0x63, 0x64, 0x65, 0x65, 0x69, 0x6b, 0x6d, 0x6d, 0x6e, 0x6e, 0x6d, 0x6d,
-  0x6d, 0x6c, 0x6b, 0x6b, 0x6a, 0x68, 0x65, 0x65, 0x64, 0x64, 0x64, 0x63,
-  0x61, 0x61, 0x62, 0x67, 0x77, 0x8d, 0x9b, 0xa2, 0xa8, 0xae, 0xb2, 0xb6,
-  0xba, 0xbc, 0xc0, 0xc4, 0xc6, 0xc6, 0xc8, 0xcc, 0xd0, 0xd4, 0xd5, 0xd5,
-  0xd5, 0xd3, 0xce, 0xca, 0xc7, 0xc2, 0xbc, 0xb8, 0xb9, 0xb8, 0xb6, 0xb8,
-  0xbc, 0xc0, 0xc3, 0xc6, 0xc3, 0xbe, 0xbb, 0xb9, 0xb8, 0xb3, 0xaf, 0xac,
-  0xac, 0xae, 0xb1, 0xb1, 0xaf, 0xaf, 0xb3, 0xbd, 0xb9, 0xa9, 0x9e, 0x9c,
-  0xbd, 0xb4, 0x8e, 0x82, 0x8b, 0x91, 0x91, 0xa2, 0xab, 0xaa, 0x8e, 0x54,
-  0x69, 0x8e, 0xa2, 0xb4, 0xbf, 0xc0, 0xc1, 0xc0, 0xc0, 0xc4, 0xc5, 0xc3,
-  0xc1, 0xba, 0xb9, 0xb8, 0xba, 0xba, 0xb9, 0xb5, 0xb4, 0xb6, 0xb6, 0xb6,
-  0xb7, 0xba, 0xbd, 0xbe, 0xbf, 0xc0, 0xc0, 0xc2, 0xc7, 0xcf, 0xd6, 0xd5,
-  0xd3, 0xd1, 0xcd, 0xc5, 0xc3, 0xc4, 0xc5, 0xc5, 0xc7, 0xc7, 0xc5, 0xc4,
-  0xc3, 0xc1, 0xc0, 0xbf, 0xbe, 0xbe, 0xbb, 0xba, 0xb9, 0xb7, 0xb6, 0xb8,
-  0xbc, 0xbe, 0xbb, 0xaf, 0x9c, 0x91, 0x8e, 0x8c, 0x87, 0x79, 0x67, 0x63,
-  0x6a, 0x69, 0x5f, 0x60, 0x64, 0x64, 0x63, 0x66, 0x6d, 0x74, 0x7d, 0x81,
-  0x82, 0x82, 0x81, 0x7c, 0x78, 0x6f, 0x65, 0x5e, 0x57, 0x54, 0x54, 0x55,
-  0x4c, 0x46, 0x4a, 0x5b, 0x72, 0x73, 0x70, 0x70, 0x73, 0x76, 0x74, 0x72,
-  0x71, 0x70, 0x6e, 0x6e, 0x70, 0x71, 0x71, 0x6d, 0x66, 0x62, 0x60, 0x5d,
-  0x58, 0x56, 0x5a, 0x5f, 0x69, 0x77, 0x82, 0x88, 0x8a, 0x8b, 0x8d, 0x91,
-  0x93, 0x96, 0x96, 0x96, 0x97, 0x97, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95,
-  0x94, 0x93, 0x92, 0x8f, 0x8e, 0x8d, 0x8b, 0x88, 0x84, 0x7f, 0x7c, 0x78,
-  0x74, 0x6e, 0x6a, 0x68, 0x63, 0x5e, 0x59, 0x55, 0x52, 0x4f, 0x49, 0x43,
-  0x3f, 0x3c, 0x37, 0x33, 0x2c, 0x27, 0x24, 0x1f, 0x17, 0x14, 0x13, 0x12,
-  0x11, 0x10, 0x10, 0x11, 0x12, 0x13, 0x13, 0x13, 0x14, 0x14, 0x13, 0x13,
-  0x93, 0x8d, 0x88, 0x84, 0x7b, 0x6f, 0x66, 0x61, 0x5e, 0x5b, 0x5a, 0x59,
-  0x59, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x59, 0x58, 0x58, 0x58, 0x59,
-  0x59, 0x59, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x64, 0x65,
-  0x67, 0x6a, 0x6c, 0x6c, 0x6e, 0x6e, 0x6d, 0x6e, 0x6e, 0x6e, 0x6c, 0x6a,
-  0x69, 0x68, 0x65, 0x64, 0x63, 0x63, 0x64, 0x62, 0x61, 0x61, 0x62, 0x69,
-  0x7d, 0x93, 0xa0, 0xa6, 0xab, 0xb0, 0xb3, 0xb7, 0xbb, 0xbe, 0xc1, 0xc4,
-  0xc5, 0xc6, 0xc8, 0xc9, 0xce, 0xd3, 0xd5, 0xd6, 0xd6, 0xd4, 0xd1, 0xcd,
-  0xca, 0xc5, 0xbe, 0xb9, 0xb8, 0xb8, 0xb7, 0xb6, 0xbb, 0xc0, 0xc4, 0xc8,
-  0xc7, 0xc1, 0xbc, 0xba, 0xb9, 0xb5, 0xaf, 0xac, 0xab, 0xad, 0xb1, 0xb2,
-  0xb0, 0xae, 0xb1, 0xbb, 0xb7, 0xa3, 0xa3, 0xb4, 0xb1, 0x91, 0x91, 0x9b,
-  0xa9, 0xae, 0xa2, 0x93, 0x93, 0x96, 0x67, 0x58, 0x82, 0xa2, 0xb0, 0xb9,
-  0xc0, 0xc3, 0xc3, 0xc4, 0xc7, 0xc7, 0xc3, 0xc1, 0xbe, 0xb9, 0xb8, 0xb8,
-  0xb9, 0xb9, 0xb9, 0xb7, 0xb8, 0xb9, 0xb9, 0xb7, 0xb6, 0xb9, 0xbc, 0xbd,
-  0xbd, 0xc0, 0xc5, 0xc8, 0xcb, 0xcf, 0xd6, 0xd8, 0xd9, 0xda, 0xd7, 0xcd,
-  0xc4, 0xc2, 0xc3, 0xc5, 0xc6, 0xc9, 0xc7, 0xc6, 0xc3, 0xc2, 0xc0, 0xbe,
-  0xbf, 0xbf, 0xbc, 0xbb, 0xb8, 0xb7, 0xb5, 0xb3, 0xb8, 0xba, 0xb5, 0xa6,
-  0x94, 0x8e, 0x89, 0x84, 0x7f, 0x74, 0x63, 0x62, 0x6c, 0x6f, 0x67, 0x60,
-  0x63, 0x64, 0x65, 0x69, 0x6d, 0x72, 0x7c, 0x81, 0x83, 0x84, 0x81, 0x80,
-  0x7d, 0x75, 0x6a, 0x62, 0x5b, 0x57, 0x53, 0x52, 0x49, 0x44, 0x48, 0x59,
-  0x71, 0x73, 0x6f, 0x6e, 0x6f, 0x72, 0x72, 0x71, 0x72, 0x72, 0x71, 0x70,
-  0x70, 0x6f, 0x6e, 0x6a, 0x63, 0x60, 0x5d, 0x5b, 0x57, 0x56, 0x59, 0x5e,
-  0x67, 0x76, 0x81, 0x87, 0x89, 0x8a, 0x8c, 0x91, 0x95, 0x97, 0x97, 0x96,
-  0x98, 0x98, 0x97, 0x96, 0x96, 0x96, 0x97, 0x96, 0x96, 0x95, 0x94, 0x92,
-  0x90, 0x8f, 0x8d, 0x8a, 0x86, 0x83, 0x80, 0x7b, 0x76, 0x70, 0x6c, 0x69,
-  0x65, 0x60, 0x5d, 0x59, 0x57, 0x53, 0x4d, 0x46, 0x43, 0x42, 0x3f, 0x3b,
-  0x35, 0x30, 0x2c, 0x27, 0x20, 0x1b, 0x19, 0x18, 0x15, 0x12, 0x11, 0x12,
-  0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x13, 0x98, 0x92, 0x8c, 0x87,
-  0x7f, 0x75, 0x69, 0x63, 0x60, 0x5d, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x5a,
-  0x5a, 0x5b, 0x5b, 0x5a, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5b, 0x5c,
-  0x5c, 0x5c, 0x5f, 0x5f, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6a, 0x6a, 0x6b,
-  0x6d, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e, 0x6c, 0x69, 0x68, 0x68, 0x66, 0x64,
-  0x63, 0x62, 0x63, 0x61, 0x5f, 0x60, 0x61, 0x6b, 0x82, 0x98, 0xa3, 0xa9,
-  0xae, 0xb1, 0xb3, 0xb7, 0xbc, 0xbf, 0xc2, 0xc4, 0xc5, 0xc6, 0xc7, 0xc9,
-  0xce, 0xd2, 0xd4, 0xd5, 0xd5, 0xd4, 0xd2, 0xcf, 0xcb, 0xc5, 0xbe, 0xb9,
-  0xb8, 0xb8, 0xb7, 0xb6, 0xbb, 0xc2, 0xc7, 0xcc, 0xcb, 0xc5, 0xbf, 0xbd,
-  0xbb, 0xb6, 0xb0, 0xae, 0xad, 0xae, 0xb0, 0xb2, 0xb1, 0xaf, 0xaf, 0xb6,
-  0xba, 0xa5, 0x9b, 0x9b, 0x97, 0x93, 0xaa, 0xb5, 0xb1, 0xa6, 0xa4, 0x9a,
-  0x8d, 0x73, 0x56, 0x75, 0x8d, 0xac, 0xb9, 0xbe, 0xc2, 0xc7, 0xca, 0xcb,
-  0xc9, 0xc8, 0xc4, 0xc1, 0xbe, 0xba, 0xb8, 0xb9, 0xba, 0xba, 0xba, 0xb8,
-  0xba, 0xba, 0xb9, 0xb7, 0xb7, 0xba, 0xbf, 0xc0, 0xbe, 0xbf, 0xc5, 0xc7,
-  0xc8, 0xca, 0xce, 0xd3, 0xda, 0xdd, 0xdd, 0xd3, 0xc4, 0xbf, 0xbf, 0xc4,
-  0xc6, 0xca, 0xc9, 0xc7, 0xc5, 0xc3, 0xc1, 0xc0, 0xc0, 0xc0, 0xbc, 0xb9,
-  0xb8, 0xb8, 0xb5, 0xb2, 0xb3, 0xb2, 0xad, 0x9f, 0x92, 0x8e, 0x87, 0x81,
-  0x7c, 0x74, 0x63, 0x61, 0x6c, 0x6f, 0x69, 0x61, 0x62, 0x67, 0x6a, 0x6e,
-  0x6f, 0x72, 0x79, 0x7e, 0x83, 0x84, 0x83, 0x86, 0x86, 0x81, 0x71, 0x66,
-  0x60, 0x5b, 0x54, 0x51, 0x48, 0x45, 0x48, 0x57, 0x6f, 0x72, 0x6c, 0x6b,
-  0x6e, 0x74, 0x76, 0x78, 0x79, 0x7a, 0x78, 0x74, 0x71, 0x70, 0x6e, 0x69,
-  0x62, 0x5e, 0x5c, 0x5a, 0x57, 0x55, 0x59, 0x5e, 0x66, 0x74, 0x7e, 0x83,
-  0x87, 0x89, 0x8b, 0x91, 0x95, 0x97, 0x97, 0x98, 0x9a, 0x9a, 0x99, 0x99,
-  0x98, 0x97, 0x98, 0x97, 0x96, 0x96, 0x94, 0x93, 0x92, 0x91, 0x90, 0x8d,
-  0x88, 0x86, 0x84, 0x7f, 0x78, 0x73, 0x6e, 0x6b, 0x67, 0x64, 0x61, 0x5e,
-  0x5b, 0x56, 0x52, 0x4c, 0x4a, 0x48, 0x46, 0x43, 0x3e, 0x39, 0x36, 0x31,
-  0x2a, 0x25, 0x24, 0x23, 0x1f, 0x18, 0x15, 0x15, 0x14, 0x13, 0x14, 0x14,
-  0x13, 0x13, 0x14, 0x14, 0x9c, 0x95, 0x8e, 0x8a, 0x83, 0x78, 0x6c, 0x65,
-  0x62, 0x5e, 0x5b, 0x5a, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x59, 0x59, 0x5a,
-  0x59, 0x58, 0x58, 0x58, 0x59, 0x59, 0x5b, 0x5a, 0x5a, 0x5c, 0x5e, 0x60,
-  0x62, 0x63, 0x64, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6c, 0x6d, 0x6f, 0x6f,
-  0x6f, 0x6c, 0x6b, 0x69, 0x68, 0x68, 0x66, 0x64, 0x62, 0x61, 0x61, 0x60,
-  0x5e, 0x5f, 0x62, 0x6f, 0x87, 0x9c, 0xa8, 0xad, 0xb1, 0xb2, 0xb4, 0xb9,
-  0xbe, 0xc1, 0xc4, 0xc5, 0xc5, 0xc6, 0xc7, 0xc9, 0xcd, 0xd1, 0xd3, 0xd4,
-  0xd3, 0xd4, 0xd2, 0xce, 0xcb, 0xc6, 0xbf, 0xbb, 0xb7, 0xb6, 0xb7, 0xb6,
-  0xba, 0xc2, 0xc8, 0xce, 0xcf, 0xca, 0xc3, 0xbf, 0xbc, 0xb7, 0xb2, 0xaf,
-  0xaf, 0xaf, 0xb1, 0xb2, 0xb1, 0xaf, 0xaf, 0xb4, 0xba, 0xb7, 0xa8, 0x8d,
-  0x91, 0x96, 0x92, 0x94, 0x9e, 0xa0, 0x8d, 0x7b, 0x6c, 0x5a, 0x6e, 0x82,
-  0x97, 0xb1, 0xbc, 0xc1, 0xc3, 0xc6, 0xca, 0xca, 0xc9, 0xc8, 0xc0, 0xbd,
-  0xbc, 0xbb, 0xba, 0xb9, 0xba, 0xba, 0xb9, 0xb7, 0xb9, 0xb9, 0xb9, 0xb9,
-  0xb9, 0xbd, 0xc2, 0xc2, 0xbf, 0xbf, 0xc1, 0xc3, 0xc4, 0xc2, 0xc3, 0xce,
-  0xd9, 0xdd, 0xdc, 0xd8, 0xc9, 0xc1, 0xc0, 0xc3, 0xc5, 0xc7, 0xc8, 0xc7,
-  0xc6, 0xc4, 0xc2, 0xc1, 0xc1, 0xc0, 0xbb, 0xba, 0xba, 0xb9, 0xb6, 0xb0,
-  0xac, 0xa9, 0xa4, 0x9a, 0x92, 0x8f, 0x88, 0x84, 0x81, 0x79, 0x6a, 0x64,
-  0x6a, 0x6d, 0x6a, 0x66, 0x65, 0x6a, 0x6e, 0x70, 0x72, 0x76, 0x7b, 0x7f,
-  0x85, 0x86, 0x88, 0x90, 0x92, 0x8b, 0x7a, 0x6c, 0x67, 0x63, 0x59, 0x52,
-  0x47, 0x45, 0x48, 0x55, 0x6d, 0x6f, 0x69, 0x69, 0x70, 0x78, 0x7d, 0x80,
-  0x81, 0x83, 0x80, 0x7b, 0x76, 0x74, 0x71, 0x6a, 0x61, 0x5c, 0x59, 0x57,
-  0x56, 0x54, 0x57, 0x5d, 0x66, 0x72, 0x7b, 0x80, 0x84, 0x87, 0x8b, 0x8f,
-  0x95, 0x99, 0x9b, 0x9b, 0x9d, 0x9d, 0x9c, 0x9c, 0x9b, 0x9a, 0x99, 0x99,
-  0x98, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x8f, 0x8b, 0x89, 0x87, 0x83,
-  0x7d, 0x78, 0x73, 0x6f, 0x6b, 0x67, 0x65, 0x62, 0x60, 0x5c, 0x59, 0x54,
-  0x51, 0x4f, 0x4d, 0x49, 0x44, 0x42, 0x3f, 0x3a, 0x33, 0x2f, 0x2e, 0x2d,
-  0x2a, 0x24, 0x1e, 0x1b, 0x19, 0x16, 0x14, 0x14, 0x13, 0x13, 0x12, 0x12,
-  0x9d, 0x95, 0x8f, 0x8a, 0x84, 0x79, 0x6d, 0x67, 0x64, 0x5f, 0x5c, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5a, 0x5a, 0x59, 0x5a, 0x59, 0x59, 0x5a,
-  0x5a, 0x5a, 0x5b, 0x5a, 0x59, 0x5a, 0x5e, 0x61, 0x63, 0x64, 0x65, 0x67,
-  0x67, 0x69, 0x69, 0x6a, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6b, 0x69,
-  0x68, 0x68, 0x66, 0x64, 0x62, 0x61, 0x61, 0x60, 0x5e, 0x60, 0x64, 0x71,
-  0x8b, 0x9f, 0xaa, 0xae, 0xb2, 0xb2, 0xb5, 0xb9, 0xbe, 0xc0, 0xc3, 0xc4,
-  0xc5, 0xc5, 0xc6, 0xc9, 0xcd, 0xd0, 0xd2, 0xd3, 0xd2, 0xd3, 0xd1, 0xcf,
-  0xcd, 0xc7, 0xc1, 0xbd, 0xb9, 0xb7, 0xb6, 0xb5, 0xb9, 0xc1, 0xc7, 0xcd,
-  0xd0, 0xcd, 0xc7, 0xc2, 0xbd, 0xba, 0xb6, 0xb2, 0xaf, 0xaf, 0xb2, 0xb4,
-  0xb2, 0xb0, 0xb0, 0xb4, 0xb7, 0xc0, 0xb9, 0x99, 0x79, 0x79, 0x7a, 0x7a,
-  0x7c, 0x80, 0x5b, 0x4c, 0x52, 0x69, 0x79, 0x84, 0xa7, 0xb7, 0xbc, 0xc1,
-  0xc5, 0xc6, 0xc5, 0xc7, 0xc9, 0xc7, 0xbf, 0xbd, 0xbc, 0xba, 0xba, 0xb9,
-  0xb8, 0xb9, 0xb9, 0xb8, 0xb7, 0xba, 0xba, 0xba, 0xba, 0xbe, 0xc2, 0xc3,
-  0xc0, 0xbe, 0xbf, 0xc1, 0xc0, 0xbd, 0xbc, 0xcb, 0xd8, 0xdb, 0xdb, 0xd9,
-  0xcf, 0xc7, 0xc4, 0xc4, 0xc5, 0xc7, 0xc9, 0xc9, 0xc8, 0xc4, 0xc2, 0xc1,
-  0xc0, 0xbf, 0xbd, 0xba, 0xbb, 0xbb, 0xb7, 0xaf, 0xa8, 0xa3, 0x9f, 0x97,
-  0x93, 0x8f, 0x8b, 0x89, 0x86, 0x7d, 0x6e, 0x69, 0x6b, 0x6c, 0x6b, 0x68,
-  0x68, 0x6b, 0x6e, 0x71, 0x74, 0x7a, 0x7e, 0x82, 0x89, 0x8c, 0x8c, 0x8f,
-  0x90, 0x8e, 0x83, 0x73, 0x6e, 0x68, 0x5d, 0x51, 0x46, 0x44, 0x47, 0x54,
-  0x6b, 0x6d, 0x65, 0x65, 0x6d, 0x77, 0x7f, 0x84, 0x86, 0x89, 0x87, 0x83,
-  0x7d, 0x79, 0x74, 0x6b, 0x61, 0x5a, 0x58, 0x56, 0x55, 0x53, 0x57, 0x5c,
-  0x66, 0x70, 0x79, 0x7e, 0x81, 0x84, 0x89, 0x8f, 0x95, 0x9a, 0x9c, 0x9d,
-  0x9f, 0x9f, 0x9d, 0x9d, 0x9d, 0x9b, 0x99, 0x99, 0x99, 0x98, 0x96, 0x96,
-  0x95, 0x94, 0x91, 0x8f, 0x8e, 0x8c, 0x8b, 0x87, 0x80, 0x7b, 0x77, 0x73,
-  0x6f, 0x6a, 0x67, 0x64, 0x62, 0x60, 0x5c, 0x59, 0x56, 0x54, 0x51, 0x4c,
-  0x49, 0x46, 0x44, 0x3f, 0x38, 0x35, 0x34, 0x33, 0x31, 0x2c, 0x27, 0x23,
-  0x20, 0x1d, 0x19, 0x17, 0x15, 0x14, 0x12, 0x12, 0x9d, 0x95, 0x8f, 0x8b,
-  0x83, 0x79, 0x6d, 0x68, 0x64, 0x60, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-  0x5b, 0x5b, 0x5a, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x5d, 0x61, 0x63, 0x64, 0x65, 0x67, 0x67, 0x69, 0x6a, 0x6a,
-  0x6d, 0x6e, 0x6e, 0x6d, 0x6d, 0x6b, 0x6b, 0x69, 0x68, 0x67, 0x65, 0x64,
-  0x62, 0x62, 0x61, 0x60, 0x5f, 0x60, 0x65, 0x73, 0x8d, 0xa0, 0xaa, 0xae,
-  0xb1, 0xb3, 0xb6, 0xba, 0xbe, 0xc1, 0xc3, 0xc4, 0xc4, 0xc5, 0xc6, 0xc9,
-  0xcd, 0xd0, 0xd2, 0xd2, 0xd1, 0xd3, 0xd2, 0xd0, 0xce, 0xc8, 0xc2, 0xbe,
-  0xb9, 0xb7, 0xb5, 0xb4, 0xb8, 0xc0, 0xc6, 0xce, 0xd1, 0xce, 0xc8, 0xc4,
-  0xbe, 0xbb, 0xb7, 0xb3, 0xb1, 0xb0, 0xb2, 0xb4, 0xb2, 0xb1, 0xb1, 0xb4,
-  0xb5, 0xbf, 0xbe, 0xa8, 0x7b, 0x6e, 0x6e, 0x6c, 0x69, 0x6f, 0x52, 0x48,
-  0x55, 0x79, 0x86, 0x8f, 0xb0, 0xba, 0xbc, 0xc0, 0xc7, 0xc6, 0xc4, 0xc5,
-  0xc8, 0xc6, 0xbf, 0xbd, 0xbc, 0xba, 0xba, 0xb9, 0xb8, 0xb8, 0xb9, 0xb9,
-  0xb7, 0xb9, 0xba, 0xba, 0xba, 0xbe, 0xc2, 0xc3, 0xc1, 0xbd, 0xbf, 0xbf,
-  0xbe, 0xba, 0xbb, 0xcb, 0xd6, 0xd9, 0xd9, 0xd9, 0xd2, 0xcb, 0xc8, 0xc5,
-  0xc6, 0xc7, 0xc9, 0xca, 0xc8, 0xc5, 0xc2, 0xc1, 0xc0, 0xc0, 0xbd, 0xbb,
-  0xbb, 0xbb, 0xb7, 0xaf, 0xa6, 0xa2, 0x9d, 0x97, 0x92, 0x8f, 0x8d, 0x8c,
-  0x88, 0x7f, 0x71, 0x6a, 0x6b, 0x6c, 0x6b, 0x6a, 0x69, 0x6b, 0x6e, 0x73,
-  0x76, 0x7d, 0x82, 0x86, 0x8b, 0x8e, 0x8c, 0x8d, 0x8d, 0x8d, 0x85, 0x79,
-  0x72, 0x6d, 0x61, 0x53, 0x48, 0x43, 0x45, 0x52, 0x69, 0x6b, 0x63, 0x63,
-  0x6a, 0x75, 0x7e, 0x84, 0x87, 0x89, 0x89, 0x86, 0x81, 0x7c, 0x76, 0x6c,
-  0x60, 0x5a, 0x57, 0x55, 0x54, 0x52, 0x56, 0x5b, 0x65, 0x6f, 0x78, 0x7d,
-  0x7f, 0x82, 0x88, 0x8f, 0x95, 0x9a, 0x9c, 0x9d, 0xa0, 0xa0, 0x9e, 0x9e,
-  0x9d, 0x9c, 0x9a, 0x9a, 0x9a, 0x9a, 0x97, 0x97, 0x96, 0x94, 0x92, 0x90,
-  0x8f, 0x8d, 0x8c, 0x88, 0x82, 0x7d, 0x79, 0x75, 0x70, 0x6c, 0x69, 0x66,
-  0x65, 0x62, 0x5f, 0x5c, 0x58, 0x56, 0x54, 0x4f, 0x4c, 0x49, 0x47, 0x42,
-  0x3c, 0x38, 0x37, 0x37, 0x36, 0x32, 0x2d, 0x29, 0x27, 0x24, 0x1e, 0x1a,
-  0x17, 0x15, 0x13, 0x12, 0x9c, 0x93, 0x8e, 0x8a, 0x83, 0x79, 0x6d, 0x68,
-  0x64, 0x60, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x59,
-  0x59, 0x5a, 0x5a, 0x5a, 0x59, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5d, 0x60,
-  0x62, 0x63, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6a, 0x6c, 0x6e, 0x6e, 0x6d,
-  0x6d, 0x6c, 0x6b, 0x69, 0x68, 0x67, 0x64, 0x64, 0x63, 0x62, 0x61, 0x5f,
-  0x5f, 0x61, 0x66, 0x75, 0x8e, 0xa2, 0xab, 0xb0, 0xb2, 0xb4, 0xb7, 0xbb,
-  0xbf, 0xc1, 0xc3, 0xc4, 0xc4, 0xc5, 0xc6, 0xc9, 0xce, 0xd0, 0xd1, 0xd1,
-  0xd1, 0xd2, 0xd3, 0xd1, 0xcf, 0xca, 0xc4, 0xc0, 0xbb, 0xb9, 0xb6, 0xb4,
-  0xb7, 0xbe, 0xc5, 0xce, 0xd2, 0xcf, 0xc9, 0xc5, 0xc0, 0xbc, 0xb8, 0xb6,
-  0xb4, 0xb1, 0xb1, 0xb4, 0xb2, 0xb1, 0xb1, 0xb5, 0xb4, 0xb6, 0xba, 0xbb,
-  0xa1, 0x7c, 0x6b, 0x65, 0x63, 0x6d, 0x73, 0x73, 0x7a, 0x91, 0xa3, 0xaa,
-  0xb6, 0xba, 0xbc, 0xbe, 0xc6, 0xc5, 0xc4, 0xc4, 0xc6, 0xc5, 0xbf, 0xbd,
-  0xbb, 0xba, 0xba, 0xb8, 0xb8, 0xb9, 0xba, 0xb9, 0xb7, 0xb7, 0xb8, 0xb8,
-  0xb9, 0xbc, 0xc1, 0xc2, 0xc1, 0xbe, 0xbe, 0xbe, 0xbc, 0xbb, 0xbe, 0xca,
-  0xd2, 0xd5, 0xd6, 0xd9, 0xd5, 0xcf, 0xcc, 0xc8, 0xc7, 0xc8, 0xc9, 0xc9,
-  0xc8, 0xc4, 0xc2, 0xc1, 0xc1, 0xc0, 0xc0, 0xbc, 0xbc, 0xbb, 0xb5, 0xad,
-  0xa4, 0xa1, 0x9d, 0x97, 0x93, 0x92, 0x91, 0x8e, 0x8a, 0x80, 0x73, 0x6c,
-  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6f, 0x75, 0x79, 0x81, 0x87, 0x8a,
-  0x8d, 0x8c, 0x88, 0x89, 0x8a, 0x89, 0x84, 0x7d, 0x79, 0x74, 0x67, 0x56,
-  0x4d, 0x45, 0x44, 0x50, 0x65, 0x67, 0x5f, 0x5f, 0x67, 0x73, 0x7c, 0x80,
-  0x83, 0x88, 0x89, 0x87, 0x82, 0x7e, 0x79, 0x6d, 0x60, 0x58, 0x55, 0x54,
-  0x53, 0x50, 0x54, 0x5a, 0x64, 0x6e, 0x76, 0x7b, 0x7e, 0x80, 0x87, 0x8e,
-  0x96, 0x9a, 0x9c, 0x9d, 0xa0, 0xa1, 0xa0, 0x9f, 0x9f, 0x9d, 0x9b, 0x9b,
-  0x9b, 0x9a, 0x98, 0x97, 0x96, 0x96, 0x94, 0x92, 0x90, 0x8e, 0x8d, 0x8a,
-  0x86, 0x80, 0x7b, 0x78, 0x73, 0x6f, 0x6d, 0x6b, 0x69, 0x66, 0x63, 0x5f,
-  0x5d, 0x5c, 0x58, 0x54, 0x51, 0x4f, 0x4c, 0x47, 0x41, 0x3f, 0x3d, 0x3c,
-  0x3c, 0x39, 0x36, 0x33, 0x32, 0x2f, 0x29, 0x22, 0x1d, 0x1a, 0x16, 0x13,
-  0x9b, 0x93, 0x8c, 0x88, 0x83, 0x79, 0x6e, 0x68, 0x65, 0x61, 0x5d, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
-  0x5a, 0x5b, 0x5b, 0x5a, 0x5a, 0x5b, 0x5d, 0x60, 0x60, 0x61, 0x62, 0x64,
-  0x65, 0x66, 0x68, 0x6a, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6c, 0x6b, 0x6a,
-  0x69, 0x66, 0x64, 0x64, 0x63, 0x62, 0x60, 0x5f, 0x5f, 0x61, 0x67, 0x77,
-  0x90, 0xa4, 0xad, 0xb1, 0xb4, 0xb5, 0xb8, 0xbc, 0xbf, 0xc1, 0xc2, 0xc4,
-  0xc4, 0xc5, 0xc7, 0xc9, 0xcd, 0xd0, 0xcf, 0xce, 0xcf, 0xd2, 0xd3, 0xd2,
-  0xd0, 0xcd, 0xc6, 0xc1, 0xbd, 0xba, 0xb7, 0xb3, 0xb5, 0xbb, 0xc2, 0xcd,
-  0xd2, 0xd0, 0xcb, 0xc7, 0xc2, 0xbe, 0xba, 0xb7, 0xb5, 0xb1, 0xb2, 0xb3,
-  0xb2, 0xb1, 0xb0, 0xb3, 0xb4, 0xb0, 0xb2, 0xba, 0xbd, 0xb0, 0x9c, 0x91,
-  0x88, 0x8b, 0x98, 0xa3, 0xab, 0xb3, 0xb7, 0xb4, 0xb3, 0xb7, 0xb9, 0xbc,
-  0xc1, 0xc0, 0xc2, 0xc3, 0xc3, 0xc3, 0xc0, 0xbd, 0xbc, 0xba, 0xba, 0xb8,
-  0xb8, 0xb9, 0xbb, 0xba, 0xb8, 0xb7, 0xb7, 0xb6, 0xb7, 0xbb, 0xc0, 0xc2,
-  0xc3, 0xc0, 0xbd, 0xbc, 0xbd, 0xbe, 0xc4, 0xc9, 0xce, 0xd0, 0xd3, 0xd9,
-  0xda, 0xd5, 0xd1, 0xcc, 0xc9, 0xc8, 0xc9, 0xc9, 0xc8, 0xc4, 0xc1, 0xc1,
-  0xc2, 0xc2, 0xc2, 0xbe, 0xbd, 0xba, 0xb4, 0xab, 0xa1, 0x9e, 0x9c, 0x97,
-  0x93, 0x96, 0x97, 0x93, 0x8d, 0x82, 0x75, 0x6e, 0x6d, 0x6e, 0x6e, 0x6e,
-  0x6e, 0x6f, 0x71, 0x74, 0x78, 0x81, 0x85, 0x86, 0x87, 0x84, 0x81, 0x85,
-  0x86, 0x83, 0x81, 0x7f, 0x80, 0x7c, 0x6f, 0x56, 0x4e, 0x48, 0x46, 0x4d,
-  0x62, 0x64, 0x5c, 0x5a, 0x63, 0x6e, 0x77, 0x7c, 0x7f, 0x83, 0x86, 0x86,
-  0x82, 0x80, 0x7a, 0x6e, 0x60, 0x57, 0x54, 0x53, 0x52, 0x50, 0x54, 0x59,
-  0x62, 0x6c, 0x73, 0x78, 0x7b, 0x7e, 0x86, 0x8f, 0x97, 0x9c, 0x9d, 0x9f,
-  0xa2, 0xa3, 0xa3, 0xa2, 0xa1, 0x9f, 0x9e, 0x9d, 0x9c, 0x9c, 0x9b, 0x98,
-  0x97, 0x97, 0x96, 0x94, 0x91, 0x8f, 0x8f, 0x8d, 0x89, 0x83, 0x7f, 0x7c,
-  0x77, 0x73, 0x71, 0x6e, 0x6d, 0x6a, 0x68, 0x64, 0x62, 0x60, 0x5e, 0x5a,
-  0x58, 0x55, 0x53, 0x4e, 0x48, 0x46, 0x45, 0x44, 0x42, 0x3f, 0x3e, 0x3b,
-  0x39, 0x36, 0x32, 0x2d, 0x27, 0x24, 0x1e, 0x18, 0x99, 0x91, 0x8c, 0x87,
-  0x81, 0x77, 0x6e, 0x68, 0x65, 0x61, 0x5c, 0x5a, 0x59, 0x59, 0x5a, 0x5b,
-  0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5c, 0x5b,
-  0x5b, 0x5d, 0x5d, 0x5e, 0x60, 0x61, 0x62, 0x64, 0x65, 0x65, 0x66, 0x69,
-  0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6b, 0x69, 0x68, 0x66, 0x64, 0x64,
-  0x63, 0x62, 0x60, 0x5f, 0x5f, 0x61, 0x67, 0x78, 0x92, 0xa6, 0xaf, 0xb3,
-  0xb5, 0xb6, 0xb9, 0xbb, 0xbe, 0xbf, 0xc1, 0xc3, 0xc5, 0xc7, 0xc8, 0xca,
-  0xcd, 0xcf, 0xcf, 0xcf, 0xcf, 0xd3, 0xd3, 0xd2, 0xd2, 0xd0, 0xca, 0xc5,
-  0xc1, 0xbe, 0xba, 0xb5, 0xb4, 0xba, 0xc0, 0xca, 0xd1, 0xd1, 0xcf, 0xcb,
-  0xc4, 0xbf, 0xbb, 0xb8, 0xb7, 0xb3, 0xb2, 0xb3, 0xb4, 0xb2, 0xb2, 0xb4,
-  0xb5, 0xb2, 0xb1, 0xb2, 0xba, 0xbe, 0xbd, 0xbc, 0xba, 0xba, 0xba, 0xb7,
-  0xb5, 0xb3, 0xb6, 0xb5, 0xb2, 0xb4, 0xb6, 0xb8, 0xbc, 0xbd, 0xbe, 0xc0,
-  0xc2, 0xc2, 0xc1, 0xbf, 0xbd, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xba, 0xbc,
-  0xbb, 0xb9, 0xb8, 0xb7, 0xb7, 0xbb, 0xbf, 0xc2, 0xc3, 0xc0, 0xbe, 0xbe,
-  0xc0, 0xc4, 0xcb, 0xce, 0xce, 0xcf, 0xd3, 0xd8, 0xda, 0xd8, 0xd5, 0xd1,
-  0xcc, 0xc9, 0xc9, 0xc8, 0xc7, 0xc3, 0xc1, 0xc1, 0xc1, 0xc3, 0xc4, 0xc2,
-  0xbe, 0xbb, 0xb3, 0xa7, 0x9e, 0x9b, 0x9a, 0x98, 0x95, 0x98, 0x99, 0x96,
-  0x91, 0x84, 0x75, 0x6d, 0x6e, 0x6f, 0x6e, 0x6d, 0x6f, 0x71, 0x72, 0x73,
-  0x77, 0x80, 0x84, 0x82, 0x7c, 0x79, 0x79, 0x81, 0x83, 0x7f, 0x7e, 0x81,
-  0x81, 0x80, 0x77, 0x5b, 0x4f, 0x4c, 0x4b, 0x4c, 0x5d, 0x64, 0x5b, 0x5a,
-  0x61, 0x6b, 0x73, 0x76, 0x79, 0x7d, 0x82, 0x84, 0x82, 0x7f, 0x79, 0x6e,
-  0x61, 0x58, 0x55, 0x53, 0x50, 0x4e, 0x52, 0x58, 0x61, 0x6b, 0x71, 0x75,
-  0x78, 0x7d, 0x85, 0x8f, 0x97, 0x9d, 0xa0, 0xa2, 0xa4, 0xa3, 0xa4, 0xa3,
-  0xa1, 0xa1, 0x9f, 0x9f, 0x9e, 0x9e, 0x9c, 0x9b, 0x9a, 0x99, 0x97, 0x95,
-  0x93, 0x91, 0x90, 0x8f, 0x8b, 0x84, 0x81, 0x7f, 0x7b, 0x76, 0x73, 0x70,
-  0x6f, 0x6d, 0x6b, 0x69, 0x65, 0x64, 0x62, 0x5f, 0x5d, 0x5b, 0x59, 0x55,
-  0x50, 0x4c, 0x4b, 0x4a, 0x48, 0x46, 0x45, 0x43, 0x41, 0x3d, 0x38, 0x35,
-  0x32, 0x2f, 0x29, 0x21, 0x97, 0x90, 0x8a, 0x86, 0x7e, 0x76, 0x6e, 0x68,
-  0x65, 0x60, 0x5b, 0x5b, 0x59, 0x59, 0x5a, 0x5b, 0x5a, 0x5a, 0x5a, 0x5b,
-  0x5b, 0x5b, 0x5a, 0x59, 0x59, 0x5b, 0x5b, 0x5a, 0x5b, 0x5d, 0x5e, 0x5e,
-  0x5e, 0x5f, 0x61, 0x63, 0x64, 0x64, 0x65, 0x68, 0x6b, 0x6b, 0x6b, 0x6c,
-  0x6b, 0x6b, 0x69, 0x68, 0x66, 0x66, 0x64, 0x64, 0x63, 0x61, 0x5f, 0x5f,
-  0x61, 0x62, 0x68, 0x7a, 0x93, 0xa7, 0xb0, 0xb4, 0xb5, 0xb6, 0xb9, 0xbb,
-  0xbe, 0xbf, 0xc1, 0xc3, 0xc6, 0xc8, 0xca, 0xcb, 0xce, 0xcf, 0xd0, 0xd0,
-  0xd1, 0xd2, 0xd4, 0xd4, 0xd3, 0xd1, 0xcd, 0xc8, 0xc4, 0xc1, 0xbd, 0xb7,
-  0xb5, 0xba, 0xbf, 0xc9, 0xd1, 0xd2, 0xd0, 0xcc, 0xc5, 0xbf, 0xbc, 0xba,
-  0xb8, 0xb4, 0xb2, 0xb4, 0xb5, 0xb4, 0xb2, 0xb4, 0xb7, 0xb6, 0xb3, 0xb0,
-  0xb4, 0xba, 0xbf, 0xc1, 0xc2, 0xc0, 0xbd, 0xb7, 0xaf, 0xa6, 0xb1, 0xb4,
-  0xb3, 0xb6, 0xb7, 0xb8, 0xba, 0xbc, 0xbf, 0xc1, 0xc2, 0xc1, 0xbf, 0xbd,
-  0xbb, 0xb9, 0xb6, 0xb8, 0xb7, 0xb8, 0xb9, 0xbc, 0xbd, 0xbb, 0xba, 0xb8,
-  0xb8, 0xbb, 0xbf, 0xc2, 0xc3, 0xc1, 0xc0, 0xc1, 0xc4, 0xca, 0xd0, 0xd1,
-  0xd0, 0xd0, 0xd2, 0xd7, 0xd9, 0xd8, 0xd7, 0xd3, 0xcd, 0xc9, 0xc9, 0xc8,
-  0xc6, 0xc3, 0xc1, 0xc1, 0xc2, 0xc3, 0xc6, 0xc3, 0xbe, 0xb9, 0xb1, 0xa5,
-  0x9c, 0x98, 0x97, 0x96, 0x94, 0x98, 0x9b, 0x98, 0x92, 0x85, 0x75, 0x6f,
-  0x6f, 0x6f, 0x6d, 0x6b, 0x6d, 0x72, 0x73, 0x74, 0x79, 0x81, 0x85, 0x82,
-  0x78, 0x73, 0x76, 0x7e, 0x81, 0x80, 0x7f, 0x81, 0x7f, 0x7e, 0x79, 0x60,
-  0x4f, 0x4f, 0x4e, 0x4d, 0x5b, 0x64, 0x5d, 0x5b, 0x61, 0x69, 0x70, 0x72,
-  0x74, 0x78, 0x80, 0x83, 0x84, 0x81, 0x78, 0x6d, 0x61, 0x59, 0x55, 0x52,
-  0x4f, 0x4e, 0x50, 0x55, 0x5f, 0x69, 0x6e, 0x72, 0x77, 0x7c, 0x85, 0x90,
-  0x9a, 0x9f, 0xa2, 0xa4, 0xa6, 0xa6, 0xa6, 0xa5, 0xa4, 0xa3, 0xa1, 0xa0,
-  0xa0, 0xa0, 0x9e, 0x9d, 0x9c, 0x9b, 0x99, 0x98, 0x95, 0x92, 0x91, 0x8f,
-  0x8c, 0x86, 0x83, 0x82, 0x7f, 0x79, 0x75, 0x73, 0x72, 0x70, 0x6f, 0x6c,
-  0x68, 0x67, 0x65, 0x65, 0x61, 0x5f, 0x5d, 0x5a, 0x55, 0x51, 0x4f, 0x4e,
-  0x4d, 0x4c, 0x4a, 0x4a, 0x48, 0x44, 0x3f, 0x3c, 0x3a, 0x37, 0x31, 0x27,
-  0x96, 0x8e, 0x89, 0x84, 0x7d, 0x75, 0x6d, 0x67, 0x63, 0x5f, 0x5b, 0x5b,
-  0x5a, 0x5a, 0x5b, 0x5b, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5b, 0x5a, 0x5a,
-  0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5d, 0x5e, 0x5d, 0x5e, 0x5f, 0x60, 0x63,
-  0x64, 0x65, 0x65, 0x67, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x69, 0x67,
-  0x66, 0x65, 0x64, 0x64, 0x63, 0x61, 0x5f, 0x5e, 0x62, 0x63, 0x69, 0x7b,
-  0x94, 0xa8, 0xb1, 0xb5, 0xb6, 0xb6, 0xb9, 0xbb, 0xbe, 0xbf, 0xc1, 0xc3,
-  0xc6, 0xc9, 0xca, 0xcb, 0xce, 0xcf, 0xd1, 0xd1, 0xd1, 0xd3, 0xd5, 0xd4,
-  0xd3, 0xd0, 0xcd, 0xc9, 0xc6, 0xc3, 0xbe, 0xb9, 0xb6, 0xba, 0xbf, 0xc8,
-  0xd1, 0xd2, 0xd0, 0xcc, 0xc5, 0xbf, 0xbc, 0xba, 0xb8, 0xb4, 0xb3, 0xb4,
-  0xb4, 0xb4, 0xb2, 0xb3, 0xb8, 0xb7, 0xb5, 0xb0, 0xb1, 0xb6, 0xbc, 0xbf,
-  0xc1, 0xbe, 0xbc, 0xb7, 0xb0, 0xa7, 0xb0, 0xb3, 0xb3, 0xb6, 0xb7, 0xb8,
-  0xb9, 0xbb, 0xbf, 0xc0, 0xc1, 0xc0, 0xbe, 0xbc, 0xba, 0xb8, 0xb6, 0xb8,
-  0xb6, 0xb6, 0xb8, 0xbb, 0xbd, 0xbc, 0xbb, 0xb9, 0xb8, 0xbb, 0xc0, 0xc2,
-  0xc3, 0xc1, 0xc1, 0xc3, 0xc5, 0xcc, 0xd2, 0xd2, 0xd1, 0xd0, 0xd2, 0xd6,
-  0xd8, 0xd7, 0xd6, 0xd3, 0xcc, 0xc9, 0xc9, 0xc8, 0xc6, 0xc2, 0xc2, 0xc2,
-  0xc2, 0xc4, 0xc6, 0xc4, 0xbe, 0xb9, 0xb1, 0xa4, 0x9b, 0x98, 0x96, 0x95,
-  0x92, 0x96, 0x9b, 0x98, 0x92, 0x86, 0x75, 0x70, 0x70, 0x70, 0x6d, 0x6a,
-  0x6d, 0x72, 0x74, 0x75, 0x7b, 0x82, 0x85, 0x83, 0x79, 0x73, 0x74, 0x7d,
-  0x81, 0x82, 0x7f, 0x80, 0x7f, 0x7f, 0x7a, 0x62, 0x51, 0x4f, 0x4e, 0x4d,
-  0x5a, 0x65, 0x5f, 0x5e, 0x63, 0x6a, 0x6f, 0x71, 0x72, 0x76, 0x7e, 0x83,
-  0x83, 0x80, 0x77, 0x6c, 0x61, 0x59, 0x56, 0x52, 0x4e, 0x4e, 0x50, 0x54,
-  0x5e, 0x67, 0x6d, 0x71, 0x75, 0x7b, 0x85, 0x91, 0x9b, 0xa0, 0xa3, 0xa6,
-  0xa7, 0xa7, 0xa8, 0xa7, 0xa6, 0xa4, 0xa2, 0xa1, 0xa2, 0xa1, 0x9f, 0x9e,
-  0x9d, 0x9c, 0x9a, 0x99, 0x97, 0x94, 0x91, 0x8f, 0x8d, 0x88, 0x84, 0x82,
-  0x80, 0x7b, 0x77, 0x75, 0x74, 0x72, 0x70, 0x6e, 0x6b, 0x6a, 0x68, 0x67,
-  0x64, 0x62, 0x60, 0x5d, 0x58, 0x55, 0x52, 0x51, 0x50, 0x50, 0x4d, 0x4d,
-  0x4b, 0x48, 0x44, 0x40, 0x3d, 0x3b, 0x35, 0x2b, 0x94, 0x8d, 0x86, 0x81,
-  0x7b, 0x73, 0x6b, 0x65, 0x62, 0x5f, 0x5c, 0x5b, 0x5c, 0x5c, 0x5c, 0x5b,
-  0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5c, 0x5c, 0x5c, 0x5a, 0x5a, 0x5c, 0x5d,
-  0x5d, 0x5d, 0x5e, 0x5d, 0x5e, 0x5e, 0x60, 0x63, 0x64, 0x65, 0x65, 0x66,
-  0x69, 0x6a, 0x6b, 0x6b, 0x6c, 0x6b, 0x68, 0x66, 0x65, 0x65, 0x64, 0x63,
-  0x62, 0x60, 0x5e, 0x5e, 0x62, 0x65, 0x6b, 0x7b, 0x94, 0xa8, 0xb1, 0xb5,
-  0xb6, 0xb6, 0xb8, 0xbb, 0xbe, 0xbf, 0xc1, 0xc4, 0xc7, 0xc9, 0xca, 0xcd,
-  0xcd, 0xcf, 0xd2, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xcf, 0xcc, 0xca,
-  0xc7, 0xc5, 0xc1, 0xba, 0xb6, 0xba, 0xbf, 0xc8, 0xd0, 0xd1, 0xce, 0xcb,
-  0xc4, 0xbf, 0xbc, 0xb8, 0xb6, 0xb5, 0xb3, 0xb4, 0xb3, 0xb2, 0xb1, 0xb2,
-  0xb8, 0xb9, 0xb7, 0xb3, 0xb0, 0xb2, 0xb4, 0xb6, 0xbb, 0xbb, 0xbb, 0xba,
-  0xb8, 0xb5, 0xb3, 0xb3, 0xb2, 0xb5, 0xb7, 0xb8, 0xbb, 0xbc, 0xbe, 0xbf,
-  0xbf, 0xbe, 0xbe, 0xbd, 0xbb, 0xb8, 0xb7, 0xb7, 0xb6, 0xb6, 0xb7, 0xba,
-  0xbc, 0xbb, 0xba, 0xba, 0xbb, 0xbd, 0xc0, 0xc2, 0xc3, 0xc2, 0xc2, 0xc4,
-  0xc7, 0xcd, 0xd2, 0xd2, 0xd2, 0xd1, 0xd2, 0xd5, 0xd6, 0xd6, 0xd5, 0xd2,
-  0xcc, 0xca, 0xc9, 0xc8, 0xc5, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xc3,
-  0xbe, 0xb9, 0xb1, 0xa4, 0x9b, 0x97, 0x95, 0x93, 0x90, 0x94, 0x9a, 0x98,
-  0x93, 0x88, 0x79, 0x72, 0x72, 0x71, 0x6e, 0x6b, 0x6d, 0x71, 0x73, 0x76,
-  0x7c, 0x82, 0x85, 0x83, 0x7b, 0x73, 0x73, 0x7a, 0x80, 0x83, 0x7d, 0x7c,
-  0x80, 0x80, 0x79, 0x63, 0x53, 0x4f, 0x4d, 0x4d, 0x5a, 0x65, 0x63, 0x63,
-  0x68, 0x6e, 0x71, 0x71, 0x72, 0x75, 0x7d, 0x81, 0x81, 0x7f, 0x78, 0x6c,
-  0x60, 0x5b, 0x57, 0x53, 0x4e, 0x4d, 0x4e, 0x52, 0x5c, 0x65, 0x6a, 0x6f,
-  0x75, 0x7b, 0x86, 0x93, 0x9d, 0xa2, 0xa4, 0xa7, 0xa9, 0xaa, 0xa9, 0xa9,
-  0xa7, 0xa5, 0xa4, 0xa3, 0xa3, 0xa2, 0xa0, 0xa0, 0x9e, 0x9d, 0x9b, 0x9a,
-  0x97, 0x95, 0x93, 0x90, 0x8f, 0x8a, 0x86, 0x84, 0x81, 0x7d, 0x7a, 0x78,
-  0x77, 0x74, 0x73, 0x70, 0x6e, 0x6d, 0x6b, 0x6a, 0x68, 0x66, 0x64, 0x61,
-  0x5d, 0x5b, 0x59, 0x58, 0x57, 0x54, 0x52, 0x50, 0x4f, 0x4c, 0x49, 0x44,
-  0x41, 0x3f, 0x3b, 0x32, 0x91, 0x89, 0x82, 0x7d, 0x76, 0x6e, 0x67, 0x63,
-  0x61, 0x5f, 0x5c, 0x5a, 0x5c, 0x5c, 0x5c, 0x5b, 0x5c, 0x5d, 0x5d, 0x5c,
-  0x5c, 0x5d, 0x5d, 0x5c, 0x5a, 0x5b, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5c,
-  0x5e, 0x5f, 0x61, 0x63, 0x63, 0x64, 0x65, 0x66, 0x69, 0x69, 0x6a, 0x6b,
-  0x6b, 0x6a, 0x67, 0x66, 0x66, 0x65, 0x64, 0x61, 0x60, 0x5f, 0x5f, 0x5f,
-  0x63, 0x67, 0x6c, 0x7a, 0x92, 0xa6, 0xb1, 0xb4, 0xb6, 0xb6, 0xb9, 0xbb,
-  0xbe, 0xbf, 0xc1, 0xc5, 0xc7, 0xc9, 0xcb, 0xcc, 0xce, 0xd0, 0xd2, 0xd4,
-  0xd5, 0xd5, 0xd5, 0xd4, 0xd3, 0xd0, 0xcd, 0xca, 0xc7, 0xc5, 0xc3, 0xbd,
-  0xb8, 0xb9, 0xbd, 0xc5, 0xcf, 0xcf, 0xcc, 0xc9, 0xc3, 0xbf, 0xbb, 0xb8,
-  0xb6, 0xb5, 0xb5, 0xb4, 0xb2, 0xb2, 0xb1, 0xb3, 0xb7, 0xb8, 0xb8, 0xb7,
-  0xb5, 0xaf, 0xac, 0xae, 0xb5, 0xb8, 0xb9, 0xb9, 0xb8, 0xb7, 0xb3, 0xb2,
-  0xb4, 0xb8, 0xba, 0xbb, 0xbd, 0xc0, 0xc0, 0xc1, 0xc1, 0xc1, 0xc3, 0xc3,
-  0xc1, 0xbc, 0xba, 0xb9, 0xb9, 0xb8, 0xba, 0xbb, 0xbd, 0xbb, 0xba, 0xb9,
-  0xbb, 0xbe, 0xc1, 0xc2, 0xc2, 0xc2, 0xc4, 0xc6, 0xc8, 0xcc, 0xd1, 0xd2,
-  0xd2, 0xd2, 0xd2, 0xd5, 0xd5, 0xd5, 0xd5, 0xd2, 0xcf, 0xcc, 0xca, 0xc9,
-  0xc7, 0xc5, 0xc4, 0xc4, 0xc3, 0xc3, 0xc3, 0xbf, 0xbb, 0xb6, 0xaf, 0xa4,
-  0x9b, 0x97, 0x95, 0x91, 0x8e, 0x93, 0x99, 0x98, 0x94, 0x8c, 0x7e, 0x77,
-  0x75, 0x74, 0x70, 0x6b, 0x6b, 0x6f, 0x72, 0x76, 0x7c, 0x7f, 0x81, 0x80,
-  0x7a, 0x74, 0x73, 0x76, 0x7b, 0x82, 0x7b, 0x75, 0x7d, 0x7f, 0x78, 0x63,
-  0x54, 0x4f, 0x4e, 0x50, 0x5b, 0x66, 0x66, 0x69, 0x70, 0x75, 0x76, 0x77,
-  0x77, 0x78, 0x7f, 0x83, 0x81, 0x7e, 0x78, 0x6d, 0x63, 0x5d, 0x5a, 0x55,
-  0x4f, 0x4d, 0x4d, 0x50, 0x5a, 0x63, 0x68, 0x6d, 0x74, 0x7b, 0x88, 0x95,
-  0x9f, 0xa4, 0xa7, 0xaa, 0xac, 0xad, 0xac, 0xab, 0xa9, 0xa8, 0xa6, 0xa5,
-  0xa4, 0xa4, 0xa3, 0xa2, 0xa0, 0x9f, 0x9d, 0x9b, 0x98, 0x97, 0x96, 0x93,
-  0x91, 0x8d, 0x89, 0x86, 0x84, 0x80, 0x7e, 0x7c, 0x7b, 0x78, 0x76, 0x74,
-  0x73, 0x72, 0x70, 0x6f, 0x6c, 0x6a, 0x68, 0x66, 0x63, 0x61, 0x60, 0x5f,
-  0x5e, 0x5b, 0x58, 0x56, 0x55, 0x53, 0x50, 0x4d, 0x4a, 0x47, 0x43, 0x3a,
-  0x8c, 0x84, 0x7d, 0x78, 0x71, 0x69, 0x63, 0x61, 0x5f, 0x5e, 0x5c, 0x5b,
-  0x5b, 0x5c, 0x5c, 0x5b, 0x5c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c,
-  0x5a, 0x5b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5f, 0x5f, 0x61, 0x63,
-  0x63, 0x64, 0x65, 0x66, 0x68, 0x69, 0x69, 0x6a, 0x6b, 0x69, 0x67, 0x66,
-  0x65, 0x65, 0x63, 0x60, 0x5f, 0x5f, 0x5e, 0x60, 0x65, 0x67, 0x6c, 0x7a,
-  0x91, 0xa4, 0xaf, 0xb3, 0xb4, 0xb6, 0xb7, 0xbb, 0xbd, 0xbe, 0xc1, 0xc5,
-  0xc7, 0xc9, 0xca, 0xcd, 0xce, 0xd1, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd3,
-  0xd2, 0xd1, 0xce, 0xca, 0xc7, 0xc6, 0xc5, 0xc0, 0xbb, 0xbb, 0xbd, 0xc3,
-  0xcc, 0xcc, 0xca, 0xc8, 0xc4, 0xc0, 0xbb, 0xb8, 0xb7, 0xb5, 0xb4, 0xb3,
-  0xb3, 0xb3, 0xb2, 0xb3, 0xb6, 0xb7, 0xb7, 0xb6, 0xb7, 0xb3, 0xb2, 0xb3,
-  0xb4, 0xb5, 0xb6, 0xb6, 0xb6, 0xb3, 0xb1, 0xb4, 0xb7, 0xbb, 0xbd, 0xc0,
-  0xc3, 0xc4, 0xc5, 0xc6, 0xc6, 0xc3, 0xc2, 0xc2, 0xc1, 0xbd, 0xbb, 0xbc,
-  0xbc, 0xbc, 0xbb, 0xbd, 0xbe, 0xbb, 0xb9, 0xb9, 0xbc, 0xbf, 0xc1, 0xc2,
-  0xc2, 0xc3, 0xc6, 0xc8, 0xc9, 0xcd, 0xd0, 0xd1, 0xd1, 0xd1, 0xd2, 0xd5,
-  0xd6, 0xd5, 0xd4, 0xd1, 0xce, 0xcd, 0xcc, 0xcb, 0xc8, 0xc6, 0xc4, 0xc4,
-  0xc3, 0xc1, 0xbf, 0xbc, 0xb8, 0xb4, 0xae, 0xa4, 0x9c, 0x97, 0x94, 0x90,
-  0x8c, 0x91, 0x97, 0x98, 0x95, 0x8d, 0x80, 0x79, 0x76, 0x75, 0x71, 0x6c,
-  0x6b, 0x6f, 0x71, 0x74, 0x7a, 0x7b, 0x7e, 0x7d, 0x77, 0x73, 0x74, 0x76,
-  0x79, 0x7e, 0x7b, 0x72, 0x75, 0x76, 0x72, 0x61, 0x55, 0x51, 0x51, 0x54,
-  0x60, 0x67, 0x67, 0x69, 0x73, 0x7b, 0x80, 0x81, 0x81, 0x82, 0x87, 0x89,
-  0x86, 0x82, 0x7d, 0x72, 0x68, 0x60, 0x5c, 0x58, 0x50, 0x4c, 0x4c, 0x50,
-  0x58, 0x60, 0x65, 0x6b, 0x74, 0x7c, 0x89, 0x97, 0xa1, 0xa7, 0xa9, 0xac,
-  0xae, 0xaf, 0xae, 0xad, 0xab, 0xab, 0xaa, 0xa8, 0xa7, 0xa7, 0xa5, 0xa3,
-  0xa2, 0xa1, 0x9f, 0x9c, 0x99, 0x99, 0x98, 0x96, 0x93, 0x8f, 0x8b, 0x88,
-  0x87, 0x83, 0x81, 0x80, 0x7e, 0x7c, 0x7a, 0x78, 0x77, 0x77, 0x75, 0x74,
-  0x72, 0x6f, 0x6d, 0x6c, 0x68, 0x66, 0x66, 0x66, 0x63, 0x61, 0x5e, 0x5d,
-  0x5c, 0x5a, 0x57, 0x54, 0x50, 0x4e, 0x4a, 0x43, 0x87, 0x7f, 0x79, 0x74,
-  0x6d, 0x65, 0x61, 0x5f, 0x5e, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5b, 0x5c,
-  0x5d, 0x5d, 0x5d, 0x5b, 0x5b, 0x5c, 0x5d, 0x5c, 0x5b, 0x5c, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5e, 0x5e, 0x5f, 0x60, 0x61, 0x63, 0x63, 0x65, 0x65, 0x66,
-  0x68, 0x6a, 0x6a, 0x6b, 0x6b, 0x69, 0x68, 0x66, 0x65, 0x64, 0x63, 0x60,
-  0x5f, 0x5f, 0x60, 0x60, 0x65, 0x68, 0x6c, 0x79, 0x90, 0xa3, 0xad, 0xb1,
-  0xb3, 0xb5, 0xb6, 0xba, 0xbd, 0xbe, 0xc1, 0xc4, 0xc7, 0xc8, 0xca, 0xcc,
-  0xce, 0xd0, 0xd3, 0xd4, 0xd5, 0xd5, 0xd4, 0xd2, 0xd2, 0xd1, 0xcf, 0xcc,
-  0xc9, 0xc8, 0xc6, 0xc1, 0xbc, 0xbb, 0xbc, 0xc1, 0xc8, 0xca, 0xc8, 0xc6,
-  0xc4, 0xc0, 0xbc, 0xba, 0xb8, 0xb5, 0xb4, 0xb4, 0xb5, 0xb5, 0xb4, 0xb2,
-  0xb4, 0xb6, 0xb7, 0xb7, 0xb7, 0xb8, 0xb8, 0xb8, 0xb6, 0xb6, 0xb6, 0xb5,
-  0xb3, 0xb2, 0xb3, 0xb7, 0xba, 0xbd, 0xbf, 0xc1, 0xc3, 0xc5, 0xc9, 0xcc,
-  0xcc, 0xc5, 0xc1, 0xc2, 0xc0, 0xbe, 0xbd, 0xbd, 0xbe, 0xbd, 0xbc, 0xbd,
-  0xbe, 0xbb, 0xba, 0xba, 0xbc, 0xbf, 0xc0, 0xc1, 0xc3, 0xc6, 0xc9, 0xcb,
-  0xcc, 0xce, 0xd0, 0xd1, 0xd1, 0xd0, 0xd1, 0xd5, 0xd6, 0xd5, 0xd3, 0xd0,
-  0xce, 0xce, 0xcd, 0xcc, 0xca, 0xc7, 0xc4, 0xc3, 0xc2, 0xc0, 0xbf, 0xb9,
-  0xb5, 0xb2, 0xac, 0xa4, 0x9d, 0x97, 0x93, 0x8f, 0x8a, 0x90, 0x98, 0x99,
-  0x95, 0x8c, 0x7f, 0x78, 0x76, 0x75, 0x72, 0x6d, 0x6c, 0x6e, 0x70, 0x72,
-  0x77, 0x79, 0x7c, 0x7b, 0x75, 0x73, 0x76, 0x78, 0x7a, 0x7d, 0x7b, 0x6f,
-  0x6e, 0x6f, 0x6f, 0x5f, 0x54, 0x52, 0x53, 0x57, 0x67, 0x68, 0x65, 0x67,
-  0x71, 0x7c, 0x83, 0x85, 0x87, 0x8a, 0x8e, 0x8e, 0x8c, 0x88, 0x82, 0x78,
-  0x6d, 0x64, 0x5f, 0x59, 0x53, 0x4d, 0x4d, 0x4e, 0x56, 0x5e, 0x63, 0x6b,
-  0x75, 0x7d, 0x89, 0x97, 0xa2, 0xa9, 0xab, 0xae, 0xaf, 0xaf, 0xaf, 0xaf,
-  0xaf, 0xae, 0xab, 0xab, 0xaa, 0xa9, 0xa7, 0xa5, 0xa4, 0xa2, 0xa0, 0x9d,
-  0x9c, 0x9b, 0x99, 0x97, 0x95, 0x91, 0x8d, 0x8b, 0x88, 0x85, 0x83, 0x82,
-  0x81, 0x7f, 0x7d, 0x7b, 0x7a, 0x79, 0x79, 0x77, 0x75, 0x72, 0x71, 0x70,
-  0x6d, 0x6a, 0x6a, 0x6a, 0x67, 0x67, 0x64, 0x62, 0x61, 0x5f, 0x5d, 0x59,
-  0x55, 0x53, 0x4f, 0x49, 0x83, 0x7b, 0x75, 0x71, 0x6a, 0x62, 0x5e, 0x5d,
-  0x5d, 0x5b, 0x5a, 0x5b, 0x5a, 0x5a, 0x5a, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c,
-  0x5c, 0x5c, 0x5d, 0x5c, 0x5c, 0x5d, 0x5c, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
-  0x5f, 0x61, 0x62, 0x63, 0x63, 0x65, 0x65, 0x66, 0x68, 0x6a, 0x6a, 0x6a,
-  0x6b, 0x69, 0x68, 0x67, 0x66, 0x64, 0x63, 0x60, 0x5f, 0x5f, 0x60, 0x61,
-  0x66, 0x68, 0x6c, 0x77, 0x8e, 0xa1, 0xab, 0xaf, 0xb2, 0xb4, 0xb6, 0xb9,
-  0xbd, 0xbf, 0xc1, 0xc5, 0xc7, 0xc8, 0xc9, 0xcb, 0xce, 0xd0, 0xd3, 0xd3,
-  0xd5, 0xd4, 0xd4, 0xd3, 0xd2, 0xd1, 0xd0, 0xcc, 0xca, 0xc9, 0xc6, 0xc2,
-  0xbc, 0xbb, 0xbb, 0xbf, 0xc6, 0xc8, 0xc7, 0xc6, 0xc4, 0xc0, 0xbc, 0xba,
-  0xb9, 0xb6, 0xb4, 0xb6, 0xb7, 0xb7, 0xb5, 0xb1, 0xb4, 0xb6, 0xb7, 0xb8,
-  0xb7, 0xb9, 0xba, 0xb9, 0xb7, 0xb7, 0xb6, 0xb3, 0xb2, 0xb2, 0xb5, 0xb9,
-  0xbb, 0xbe, 0xc0, 0xc3, 0xc3, 0xc5, 0xc9, 0xcc, 0xcc, 0xc6, 0xc2, 0xc1,
-  0xc1, 0xbf, 0xbf, 0xbf, 0xbf, 0xbe, 0xbd, 0xbd, 0xbe, 0xbc, 0xbb, 0xba,
-  0xbd, 0xbe, 0xbf, 0xc1, 0xc4, 0xc7, 0xcb, 0xcd, 0xcd, 0xce, 0xd0, 0xd1,
-  0xd0, 0xd0, 0xd1, 0xd5, 0xd6, 0xd5, 0xd3, 0xd0, 0xce, 0xcf, 0xcf, 0xce,
-  0xce, 0xc9, 0xc5, 0xc3, 0xc1, 0xbf, 0xbe, 0xb8, 0xb3, 0xb1, 0xac, 0xa3,
-  0x9d, 0x97, 0x94, 0x8e, 0x89, 0x91, 0x99, 0x99, 0x95, 0x8b, 0x7e, 0x78,
-  0x76, 0x75, 0x73, 0x6e, 0x6c, 0x6e, 0x70, 0x73, 0x76, 0x78, 0x7b, 0x7a,
-  0x74, 0x73, 0x77, 0x78, 0x79, 0x7c, 0x7a, 0x6b, 0x69, 0x6c, 0x6c, 0x5c,
-  0x52, 0x51, 0x52, 0x59, 0x6c, 0x69, 0x64, 0x65, 0x70, 0x7b, 0x82, 0x86,
-  0x88, 0x8c, 0x8f, 0x90, 0x8e, 0x8b, 0x85, 0x7b, 0x70, 0x67, 0x62, 0x5b,
-  0x54, 0x4e, 0x4c, 0x4e, 0x54, 0x5c, 0x62, 0x6b, 0x76, 0x7e, 0x89, 0x98,
-  0xa3, 0xaa, 0xac, 0xaf, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xaf, 0xad, 0xac,
-  0xac, 0xaa, 0xa9, 0xa7, 0xa5, 0xa4, 0xa1, 0x9e, 0x9d, 0x9c, 0x9b, 0x97,
-  0x96, 0x92, 0x8f, 0x8d, 0x8a, 0x87, 0x85, 0x84, 0x82, 0x80, 0x7f, 0x7e,
-  0x7c, 0x7b, 0x7b, 0x7a, 0x77, 0x75, 0x74, 0x73, 0x70, 0x6d, 0x6d, 0x6c,
-  0x6a, 0x6a, 0x67, 0x65, 0x64, 0x63, 0x62, 0x5d, 0x59, 0x56, 0x52, 0x4d,
-  0x7b, 0x73, 0x6e, 0x6b, 0x65, 0x5e, 0x5c, 0x5c, 0x5b, 0x59, 0x5a, 0x5c,
-  0x5c, 0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c,
-  0x5d, 0x5d, 0x5c, 0x5d, 0x5e, 0x5d, 0x5e, 0x5f, 0x60, 0x60, 0x62, 0x63,
-  0x63, 0x65, 0x66, 0x67, 0x68, 0x6a, 0x69, 0x69, 0x69, 0x69, 0x69, 0x67,
-  0x65, 0x63, 0x61, 0x5f, 0x5e, 0x5e, 0x5f, 0x62, 0x66, 0x68, 0x6b, 0x75,
-  0x8b, 0x9e, 0xa8, 0xae, 0xb1, 0xb3, 0xb6, 0xba, 0xbd, 0xbe, 0xc1, 0xc5,
-  0xc6, 0xc7, 0xc8, 0xcc, 0xcf, 0xd1, 0xd3, 0xd4, 0xd5, 0xd5, 0xd5, 0xd4,
-  0xd2, 0xd2, 0xd0, 0xcb, 0xc9, 0xc8, 0xc6, 0xc2, 0xbc, 0xba, 0xba, 0xbe,
-  0xc4, 0xc6, 0xc6, 0xc5, 0xc3, 0xbe, 0xbb, 0xbb, 0xb9, 0xb7, 0xb5, 0xb8,
-  0xb9, 0xb9, 0xb6, 0xb1, 0xb2, 0xb6, 0xb7, 0xb7, 0xb7, 0xba, 0xbb, 0xba,
-  0xb8, 0xb7, 0xb7, 0xb3, 0xb2, 0xb4, 0xb8, 0xbb, 0xbd, 0xc1, 0xc3, 0xc5,
-  0xc5, 0xc5, 0xc7, 0xc8, 0xc8, 0xc7, 0xc5, 0xc2, 0xc0, 0xbf, 0xc1, 0xc1,
-  0xc1, 0xc0, 0xbf, 0xbe, 0xbf, 0xbd, 0xbc, 0xbc, 0xbe, 0xbe, 0xbe, 0xc0,
-  0xc5, 0xca, 0xcd, 0xcf, 0xcf, 0xcf, 0xd1, 0xd0, 0xcf, 0xce, 0xd0, 0xd4,
-  0xd6, 0xd4, 0xd2, 0xd0, 0xd1, 0xd0, 0xd1, 0xd2, 0xd3, 0xce, 0xc7, 0xc2,
-  0xc0, 0xbf, 0xbc, 0xb7, 0xb2, 0xb0, 0xab, 0xa3, 0x9e, 0x99, 0x95, 0x8e,
-  0x8a, 0x91, 0x9a, 0x9a, 0x94, 0x87, 0x7a, 0x74, 0x74, 0x75, 0x72, 0x6e,
-  0x6a, 0x6c, 0x6f, 0x73, 0x76, 0x77, 0x78, 0x77, 0x73, 0x72, 0x76, 0x78,
-  0x79, 0x7a, 0x75, 0x67, 0x66, 0x68, 0x65, 0x58, 0x50, 0x4f, 0x51, 0x5d,
-  0x73, 0x6b, 0x63, 0x64, 0x6d, 0x76, 0x7d, 0x83, 0x86, 0x8b, 0x8d, 0x8f,
-  0x8d, 0x8b, 0x85, 0x7f, 0x74, 0x6b, 0x65, 0x5e, 0x56, 0x4f, 0x4d, 0x4f,
-  0x53, 0x5a, 0x5f, 0x69, 0x76, 0x7f, 0x8c, 0x9a, 0xa5, 0xab, 0xae, 0xb1,
-  0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb1, 0xae, 0xae, 0xae, 0xac, 0xab, 0xa9,
-  0xa7, 0xa5, 0xa3, 0xa0, 0x9e, 0x9e, 0x9d, 0x9a, 0x96, 0x93, 0x90, 0x8f,
-  0x8b, 0x89, 0x87, 0x87, 0x86, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7d,
-  0x7b, 0x7a, 0x7a, 0x78, 0x74, 0x71, 0x70, 0x70, 0x6e, 0x6d, 0x6b, 0x6a,
-  0x69, 0x68, 0x67, 0x63, 0x5e, 0x5b, 0x57, 0x50, 0x70, 0x68, 0x64, 0x61,
-  0x5d, 0x59, 0x59, 0x5a, 0x5a, 0x59, 0x5b, 0x5d, 0x5c, 0x5c, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5e,
-  0x5e, 0x5d, 0x5e, 0x5e, 0x5f, 0x61, 0x62, 0x63, 0x63, 0x65, 0x66, 0x67,
-  0x68, 0x68, 0x69, 0x69, 0x69, 0x68, 0x68, 0x66, 0x65, 0x64, 0x60, 0x5e,
-  0x5d, 0x5d, 0x5f, 0x63, 0x67, 0x69, 0x6c, 0x74, 0x88, 0x9a, 0xa5, 0xaa,
-  0xaf, 0xb3, 0xb7, 0xbb, 0xbd, 0xbe, 0xc1, 0xc5, 0xc7, 0xc8, 0xc9, 0xca,
-  0xce, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd5, 0xd5, 0xd3, 0xd1, 0xcd,
-  0xca, 0xc9, 0xc6, 0xc2, 0xbd, 0xbc, 0xbd, 0xc0, 0xc5, 0xc7, 0xc6, 0xc4,
-  0xc2, 0xbf, 0xbc, 0xbb, 0xbb, 0xb9, 0xb6, 0xb8, 0xb9, 0xb8, 0xb6, 0xb2,
-  0xb3, 0xb5, 0xb6, 0xb5, 0xb6, 0xb8, 0xb9, 0xb8, 0xb8, 0xb8, 0xb9, 0xb7,
-  0xb6, 0xb8, 0xb9, 0xbd, 0xc0, 0xc4, 0xc7, 0xc8, 0xc9, 0xc7, 0xc7, 0xc7,
-  0xc6, 0xc6, 0xc6, 0xc3, 0xc1, 0xbf, 0xc2, 0xc3, 0xc3, 0xc2, 0xc1, 0xc1,
-  0xc1, 0xbf, 0xbe, 0xbd, 0xbd, 0xbe, 0xbe, 0xc0, 0xc5, 0xcc, 0xcf, 0xd0,
-  0xd0, 0xcf, 0xd1, 0xd1, 0xcf, 0xce, 0xcf, 0xd3, 0xd6, 0xd7, 0xd6, 0xd2,
-  0xd1, 0xd1, 0xd4, 0xd5, 0xd7, 0xd2, 0xc7, 0xc0, 0xbe, 0xbd, 0xba, 0xb4,
-  0xb1, 0xae, 0xaa, 0xa3, 0x9e, 0x99, 0x96, 0x8f, 0x8a, 0x91, 0x9a, 0x99,
-  0x94, 0x85, 0x77, 0x71, 0x73, 0x74, 0x72, 0x6c, 0x66, 0x6a, 0x6d, 0x70,
-  0x73, 0x73, 0x73, 0x72, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x6c, 0x66,
-  0x64, 0x62, 0x5d, 0x5b, 0x58, 0x54, 0x58, 0x69, 0x7b, 0x6d, 0x64, 0x64,
-  0x6b, 0x72, 0x79, 0x7e, 0x81, 0x85, 0x88, 0x89, 0x86, 0x84, 0x80, 0x7b,
-  0x74, 0x6c, 0x67, 0x5f, 0x58, 0x51, 0x4e, 0x4e, 0x50, 0x57, 0x5d, 0x68,
-  0x76, 0x80, 0x8d, 0x9c, 0xa7, 0xad, 0xb0, 0xb3, 0xb5, 0xb5, 0xb5, 0xb5,
-  0xb5, 0xb2, 0xb0, 0xb0, 0xaf, 0xad, 0xab, 0xa9, 0xa9, 0xa8, 0xa6, 0xa2,
-  0x9f, 0x9f, 0x9e, 0x9b, 0x98, 0x94, 0x92, 0x90, 0x8d, 0x8b, 0x8a, 0x89,
-  0x89, 0x87, 0x85, 0x84, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7b, 0x78, 0x77, 0x76, 0x73, 0x71, 0x71, 0x70, 0x6f, 0x6d, 0x6b, 0x67,
-  0x63, 0x60, 0x5b, 0x55, 0x64, 0x5d, 0x58, 0x56, 0x54, 0x54, 0x56, 0x58,
-  0x58, 0x59, 0x5c, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5c, 0x5e,
-  0x5d, 0x5d, 0x5c, 0x5c, 0x5d, 0x5e, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5e,
-  0x5f, 0x61, 0x62, 0x63, 0x63, 0x64, 0x65, 0x66, 0x68, 0x68, 0x68, 0x68,
-  0x68, 0x67, 0x66, 0x65, 0x64, 0x63, 0x61, 0x5d, 0x5d, 0x5d, 0x5f, 0x63,
-  0x67, 0x69, 0x6b, 0x72, 0x84, 0x96, 0xa1, 0xa7, 0xae, 0xb2, 0xb7, 0xbb,
-  0xbe, 0xbf, 0xc1, 0xc5, 0xc7, 0xc8, 0xc9, 0xca, 0xce, 0xd0, 0xd1, 0xd2,
-  0xd3, 0xd4, 0xd5, 0xd6, 0xd5, 0xd4, 0xd4, 0xd2, 0xcf, 0xcd, 0xc9, 0xc5,
-  0xc3, 0xc4, 0xc5, 0xc6, 0xc9, 0xca, 0xc8, 0xc6, 0xc5, 0xc0, 0xbd, 0xbd,
-  0xbc, 0xbb, 0xb7, 0xb0, 0xad, 0xaf, 0xb2, 0xb2, 0xb2, 0xb4, 0xb4, 0xb3,
-  0xb5, 0xb7, 0xb8, 0xb8, 0xb9, 0xb8, 0xbb, 0xbb, 0xba, 0xbb, 0xbb, 0xbe,
-  0xc2, 0xc6, 0xc8, 0xc9, 0xc8, 0xc8, 0xc7, 0xc6, 0xc7, 0xc6, 0xc7, 0xc6,
-  0xc4, 0xc2, 0xc3, 0xc5, 0xc6, 0xc5, 0xc5, 0xc5, 0xc5, 0xc3, 0xc1, 0xbf,
-  0xbe, 0xbd, 0xbf, 0xc2, 0xc8, 0xce, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xd1,
-  0xd0, 0xcf, 0xcf, 0xd3, 0xd8, 0xd7, 0xd6, 0xd2, 0xd1, 0xd1, 0xd4, 0xd7,
-  0xd8, 0xd2, 0xc6, 0xbf, 0xbd, 0xbc, 0xb8, 0xb2, 0xae, 0xac, 0xa8, 0xa3,
-  0x9e, 0x9b, 0x98, 0x92, 0x8b, 0x8f, 0x97, 0x96, 0x92, 0x85, 0x78, 0x74,
-  0x74, 0x73, 0x6f, 0x68, 0x65, 0x68, 0x6b, 0x6e, 0x6f, 0x6c, 0x6b, 0x6b,
-  0x6c, 0x69, 0x66, 0x64, 0x64, 0x63, 0x63, 0x61, 0x5a, 0x57, 0x58, 0x61,
-  0x60, 0x5b, 0x61, 0x74, 0x7d, 0x6d, 0x66, 0x67, 0x6b, 0x70, 0x77, 0x7b,
-  0x7e, 0x80, 0x81, 0x81, 0x7e, 0x7c, 0x7a, 0x74, 0x6e, 0x6a, 0x66, 0x60,
-  0x58, 0x51, 0x4f, 0x4e, 0x50, 0x55, 0x5a, 0x67, 0x76, 0x80, 0x8f, 0x9e,
-  0xa9, 0xaf, 0xb2, 0xb5, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb3, 0xb3,
-  0xb2, 0xb0, 0xae, 0xac, 0xab, 0xaa, 0xa7, 0xa3, 0xa1, 0xa0, 0x9f, 0x9c,
-  0x98, 0x95, 0x93, 0x92, 0x8f, 0x8e, 0x8d, 0x8c, 0x8a, 0x88, 0x88, 0x87,
-  0x85, 0x84, 0x83, 0x84, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7d, 0x7c, 0x7b,
-  0x79, 0x76, 0x74, 0x74, 0x73, 0x72, 0x6d, 0x69, 0x67, 0x65, 0x61, 0x5a,
-  0x5a, 0x55, 0x52, 0x51, 0x50, 0x52, 0x55, 0x58, 0x59, 0x59, 0x5c, 0x5d,
-  0x5d, 0x5c, 0x5d, 0x5c, 0x5d, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c,
-  0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5f, 0x5f, 0x61, 0x63,
-  0x63, 0x65, 0x66, 0x66, 0x68, 0x68, 0x67, 0x67, 0x67, 0x67, 0x66, 0x64,
-  0x63, 0x61, 0x60, 0x5e, 0x5c, 0x5c, 0x5f, 0x63, 0x67, 0x68, 0x69, 0x70,
-  0x81, 0x93, 0x9f, 0xa5, 0xad, 0xb1, 0xb7, 0xbb, 0xbe, 0xbf, 0xc2, 0xc5,
-  0xc7, 0xc8, 0xc9, 0xca, 0xce, 0xd0, 0xd2, 0xd3, 0xd4, 0xd4, 0xd4, 0xd5,
-  0xd5, 0xd5, 0xd6, 0xd4, 0xd1, 0xcf, 0xcd, 0xca, 0xca, 0xcc, 0xcd, 0xcd,
-  0xcc, 0xcb, 0xca, 0xca, 0xc7, 0xc4, 0xc0, 0xbf, 0xbe, 0xbb, 0xb4, 0xa5,
-  0xa1, 0xa3, 0xad, 0xb1, 0xb3, 0xb5, 0xb6, 0xb4, 0xb5, 0xb7, 0xb9, 0xba,
-  0xb8, 0xb7, 0xbb, 0xbd, 0xbd, 0xbc, 0xbb, 0xbe, 0xc3, 0xc6, 0xc7, 0xc6,
-  0xc8, 0xc9, 0xc7, 0xc6, 0xc7, 0xc8, 0xc7, 0xc7, 0xc6, 0xc4, 0xc5, 0xc7,
-  0xc9, 0xc9, 0xc8, 0xc8, 0xc8, 0xc5, 0xc3, 0xbf, 0xbe, 0xbe, 0xc2, 0xc5,
-  0xcb, 0xd0, 0xd2, 0xd1, 0xd1, 0xcf, 0xcf, 0xd1, 0xd0, 0xd0, 0xd1, 0xd5,
-  0xd8, 0xd7, 0xd6, 0xd2, 0xd1, 0xd1, 0xd4, 0xd6, 0xd8, 0xd2, 0xc6, 0xc0,
-  0xbd, 0xba, 0xb6, 0xb1, 0xad, 0xaa, 0xa6, 0xa1, 0x9f, 0x9b, 0x98, 0x93,
-  0x8c, 0x8e, 0x93, 0x93, 0x90, 0x86, 0x7b, 0x77, 0x75, 0x73, 0x6e, 0x67,
-  0x63, 0x65, 0x69, 0x6d, 0x6c, 0x69, 0x68, 0x68, 0x68, 0x67, 0x62, 0x60,
-  0x5f, 0x5c, 0x5d, 0x5c, 0x58, 0x55, 0x56, 0x5d, 0x5f, 0x5e, 0x66, 0x79,
-  0x7a, 0x6a, 0x67, 0x68, 0x6c, 0x71, 0x77, 0x7c, 0x7e, 0x7f, 0x7f, 0x7d,
-  0x7c, 0x7a, 0x76, 0x6e, 0x66, 0x63, 0x61, 0x5e, 0x58, 0x52, 0x4f, 0x4e,
-  0x50, 0x53, 0x58, 0x67, 0x78, 0x83, 0x91, 0xa0, 0xac, 0xb1, 0xb3, 0xb6,
-  0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb7, 0xb5, 0xb4, 0xb4, 0xb2, 0xb0, 0xac,
-  0xab, 0xaa, 0xa9, 0xa4, 0xa2, 0xa1, 0xa0, 0x9e, 0x99, 0x96, 0x96, 0x95,
-  0x92, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x88, 0x87, 0x86, 0x86,
-  0x85, 0x85, 0x85, 0x84, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7b, 0x78, 0x77,
-  0x77, 0x75, 0x70, 0x6c, 0x6b, 0x6a, 0x65, 0x60, 0x55, 0x51, 0x4f, 0x4e,
-  0x4e, 0x51, 0x55, 0x58, 0x5a, 0x5a, 0x5c, 0x5d, 0x5c, 0x5c, 0x5c, 0x5d,
-  0x5d, 0x5c, 0x5c, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5e,
-  0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x63, 0x63, 0x64, 0x66, 0x66,
-  0x68, 0x68, 0x67, 0x66, 0x66, 0x67, 0x66, 0x64, 0x63, 0x61, 0x5f, 0x5d,
-  0x5c, 0x5c, 0x5f, 0x64, 0x67, 0x68, 0x69, 0x70, 0x7f, 0x91, 0x9d, 0xa4,
-  0xac, 0xb0, 0xb7, 0xbb, 0xbe, 0xbe, 0xc1, 0xc4, 0xc6, 0xc8, 0xc9, 0xcb,
-  0xce, 0xd1, 0xd2, 0xd3, 0xd4, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5,
-  0xd2, 0xd0, 0xce, 0xcd, 0xcd, 0xcf, 0xd0, 0xd0, 0xcf, 0xcd, 0xcd, 0xcd,
-  0xca, 0xc5, 0xc1, 0xc0, 0xbf, 0xbb, 0xb1, 0x9f, 0x9a, 0x9d, 0xa8, 0xb0,
-  0xb4, 0xb6, 0xb6, 0xb5, 0xb5, 0xb6, 0xba, 0xba, 0xb8, 0xb7, 0xbb, 0xbe,
-  0xbe, 0xbd, 0xbb, 0xbe, 0xc4, 0xc7, 0xc7, 0xc6, 0xc7, 0xc9, 0xc7, 0xc7,
-  0xc8, 0xc8, 0xc7, 0xc7, 0xc7, 0xc5, 0xc6, 0xc7, 0xca, 0xca, 0xc9, 0xc9,
-  0xc9, 0xc6, 0xc3, 0xbf, 0xbe, 0xbf, 0xc4, 0xc8, 0xcd, 0xd0, 0xd2, 0xd1,
-  0xd1, 0xd0, 0xcf, 0xd1, 0xd0, 0xcf, 0xd1, 0xd6, 0xd9, 0xd7, 0xd6, 0xd2,
-  0xd1, 0xd1, 0xd4, 0xd6, 0xd8, 0xd2, 0xc6, 0xbf, 0xbc, 0xb8, 0xb3, 0xae,
-  0xab, 0xa8, 0xa4, 0xa0, 0x9d, 0x9a, 0x97, 0x93, 0x8d, 0x8e, 0x91, 0x91,
-  0x8e, 0x86, 0x7c, 0x78, 0x75, 0x72, 0x6c, 0x65, 0x62, 0x64, 0x68, 0x6c,
-  0x6a, 0x68, 0x67, 0x66, 0x64, 0x63, 0x5f, 0x5d, 0x5c, 0x59, 0x5a, 0x5a,
-  0x58, 0x55, 0x53, 0x58, 0x5d, 0x62, 0x6b, 0x7b, 0x78, 0x67, 0x66, 0x68,
-  0x6d, 0x73, 0x7a, 0x7e, 0x7f, 0x80, 0x7e, 0x7c, 0x7c, 0x7b, 0x75, 0x6c,
-  0x63, 0x5f, 0x5d, 0x5c, 0x57, 0x52, 0x4f, 0x4f, 0x4f, 0x52, 0x57, 0x67,
-  0x78, 0x83, 0x92, 0xa2, 0xac, 0xb1, 0xb3, 0xb6, 0xb7, 0xb7, 0xb7, 0xb7,
-  0xb8, 0xb8, 0xb6, 0xb5, 0xb4, 0xb3, 0xb1, 0xad, 0xac, 0xab, 0xa9, 0xa5,
-  0xa2, 0xa2, 0xa1, 0x9e, 0x9a, 0x97, 0x97, 0x96, 0x94, 0x91, 0x90, 0x8f,
-  0x8e, 0x8c, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86,
-  0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d, 0x7a, 0x79, 0x79, 0x78, 0x73, 0x6f,
-  0x6d, 0x6c, 0x68, 0x63, 0x4e, 0x4d, 0x4d, 0x4d, 0x4f, 0x53, 0x55, 0x58,
-  0x5a, 0x5b, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c, 0x5d, 0x5e,
-  0x5e, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5e, 0x5e, 0x5e, 0x5f, 0x60, 0x60,
-  0x5f, 0x5f, 0x61, 0x61, 0x63, 0x63, 0x64, 0x66, 0x68, 0x66, 0x67, 0x67,
-  0x67, 0x66, 0x66, 0x65, 0x63, 0x60, 0x5e, 0x5d, 0x5d, 0x5d, 0x5f, 0x64,
-  0x67, 0x67, 0x68, 0x6e, 0x7e, 0x8e, 0x99, 0xa1, 0xaa, 0xb0, 0xb6, 0xbb,
-  0xbd, 0xbe, 0xbf, 0xc3, 0xc6, 0xc7, 0xc8, 0xca, 0xcd, 0xd1, 0xd2, 0xd2,
-  0xd2, 0xd2, 0xd2, 0xd3, 0xd4, 0xd4, 0xd6, 0xd5, 0xd2, 0xd0, 0xcf, 0xcf,
-  0xd1, 0xd2, 0xd2, 0xd2, 0xd3, 0xd3, 0xd2, 0xd0, 0xcd, 0xc8, 0xc3, 0xc0,
-  0xbf, 0xba, 0xab, 0x98, 0x95, 0x99, 0xa2, 0xad, 0xb5, 0xb6, 0xb6, 0xb5,
-  0xb6, 0xb7, 0xb9, 0xb9, 0xb8, 0xb7, 0xbb, 0xbe, 0xbe, 0xbd, 0xbd, 0xbf,
-  0xc6, 0xc9, 0xc8, 0xc6, 0xc6, 0xc7, 0xc8, 0xc9, 0xc9, 0xc7, 0xc7, 0xc7,
-  0xc7, 0xc5, 0xc6, 0xc8, 0xc9, 0xca, 0xc9, 0xca, 0xc9, 0xc5, 0xc2, 0xbe,
-  0xbe, 0xc1, 0xc7, 0xcb, 0xce, 0xd1, 0xd2, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0,
-  0xce, 0xce, 0xd1, 0xd6, 0xd9, 0xd8, 0xd6, 0xd2, 0xd1, 0xd1, 0xd3, 0xd5,
-  0xd6, 0xd1, 0xc5, 0xbe, 0xba, 0xb3, 0xab, 0xa6, 0xa5, 0xa3, 0x9f, 0x9c,
-  0x99, 0x95, 0x93, 0x8f, 0x8c, 0x8e, 0x90, 0x8e, 0x8b, 0x84, 0x7c, 0x77,
-  0x73, 0x6f, 0x6a, 0x63, 0x61, 0x63, 0x66, 0x69, 0x68, 0x66, 0x63, 0x62,
-  0x5e, 0x5c, 0x5b, 0x59, 0x58, 0x56, 0x58, 0x5c, 0x58, 0x53, 0x4c, 0x54,
-  0x5f, 0x6a, 0x73, 0x7d, 0x71, 0x61, 0x63, 0x66, 0x6d, 0x74, 0x7d, 0x81,
-  0x81, 0x81, 0x7f, 0x7f, 0x80, 0x7e, 0x77, 0x6b, 0x5f, 0x59, 0x58, 0x57,
-  0x56, 0x51, 0x4f, 0x4f, 0x4f, 0x51, 0x55, 0x65, 0x78, 0x84, 0x93, 0xa2,
-  0xab, 0xaf, 0xb1, 0xb4, 0xb5, 0xb4, 0xb4, 0xb5, 0xb7, 0xb8, 0xb6, 0xb5,
-  0xb4, 0xb4, 0xb3, 0xb0, 0xac, 0xab, 0xab, 0xa8, 0xa4, 0xa3, 0xa2, 0x9f,
-  0x9b, 0x99, 0x97, 0x96, 0x95, 0x94, 0x91, 0x90, 0x8f, 0x8e, 0x8c, 0x8c,
-  0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x86, 0x85, 0x83, 0x82,
-  0x82, 0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x78, 0x74, 0x71, 0x6f, 0x6b, 0x68,
-  0x49, 0x4b, 0x4c, 0x4d, 0x4f, 0x52, 0x55, 0x59, 0x5a, 0x5b, 0x5d, 0x5d,
-  0x5c, 0x5c, 0x5c, 0x5e, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5e, 0x5e, 0x5e, 0x5f, 0x61, 0x61, 0x5f, 0x5f, 0x61, 0x61,
-  0x63, 0x63, 0x63, 0x65, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x64, 0x64,
-  0x62, 0x60, 0x5e, 0x5c, 0x5c, 0x5e, 0x61, 0x65, 0x67, 0x67, 0x68, 0x6c,
-  0x7a, 0x8a, 0x96, 0x9d, 0xa7, 0xb0, 0xb6, 0xbb, 0xbc, 0xbd, 0xbe, 0xc2,
-  0xc5, 0xc6, 0xc7, 0xc9, 0xcc, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf,
-  0xcf, 0xd1, 0xd3, 0xd5, 0xd2, 0xd0, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd4,
-  0xd7, 0xd7, 0xd7, 0xd5, 0xd2, 0xce, 0xc8, 0xc4, 0xc1, 0xbb, 0xa7, 0x96,
-  0x98, 0x9c, 0xa0, 0xa9, 0xb4, 0xb6, 0xb6, 0xb5, 0xb6, 0xb9, 0xbb, 0xbb,
-  0xbb, 0xb9, 0xba, 0xbc, 0xbd, 0xbd, 0xbf, 0xc1, 0xc5, 0xc8, 0xc9, 0xc7,
-  0xc6, 0xc6, 0xca, 0xcb, 0xc9, 0xc7, 0xc6, 0xc5, 0xc5, 0xc4, 0xc6, 0xc8,
-  0xca, 0xcb, 0xcc, 0xca, 0xc7, 0xc4, 0xc1, 0xc0, 0xc1, 0xc4, 0xc9, 0xcd,
-  0xcf, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd2, 0xd0, 0xce, 0xce, 0xd1, 0xd6,
-  0xd9, 0xd8, 0xd6, 0xd3, 0xd0, 0xd0, 0xd2, 0xd4, 0xd5, 0xce, 0xc3, 0xba,
-  0xb3, 0xaa, 0x9f, 0x98, 0x97, 0x97, 0x95, 0x93, 0x91, 0x8e, 0x8c, 0x88,
-  0x88, 0x8e, 0x90, 0x8c, 0x88, 0x80, 0x78, 0x73, 0x70, 0x6e, 0x6a, 0x64,
-  0x61, 0x63, 0x65, 0x65, 0x65, 0x62, 0x5e, 0x5d, 0x5b, 0x59, 0x58, 0x55,
-  0x54, 0x53, 0x59, 0x5d, 0x56, 0x50, 0x4d, 0x5c, 0x6a, 0x75, 0x7c, 0x7d,
-  0x67, 0x5b, 0x60, 0x65, 0x6c, 0x76, 0x7f, 0x83, 0x84, 0x84, 0x85, 0x86,
-  0x87, 0x86, 0x7c, 0x6b, 0x5d, 0x56, 0x55, 0x54, 0x55, 0x52, 0x50, 0x50,
-  0x4f, 0x50, 0x53, 0x66, 0x7b, 0x87, 0x96, 0xa1, 0xa8, 0xac, 0xae, 0xb1,
-  0xb2, 0xb0, 0xb1, 0xb2, 0xb4, 0xb7, 0xb8, 0xb7, 0xb6, 0xb4, 0xb3, 0xb0,
-  0xad, 0xac, 0xab, 0xa8, 0xa4, 0xa3, 0xa2, 0x9f, 0x9c, 0x9a, 0x98, 0x97,
-  0x97, 0x95, 0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8e, 0x8d, 0x8c, 0x8d, 0x8d,
-  0x8d, 0x8c, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x84, 0x82, 0x80,
-  0x7f, 0x7e, 0x7d, 0x79, 0x76, 0x73, 0x6f, 0x6c, 0x48, 0x4a, 0x4c, 0x4d,
-  0x50, 0x51, 0x55, 0x58, 0x5a, 0x5b, 0x5c, 0x5d, 0x5c, 0x5c, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5c, 0x5d, 0x5c, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5f, 0x5f,
-  0x5f, 0x5f, 0x60, 0x61, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x63, 0x65,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x65, 0x63, 0x62, 0x60, 0x5e, 0x5d, 0x5c,
-  0x5e, 0x5f, 0x63, 0x66, 0x67, 0x67, 0x67, 0x6a, 0x77, 0x86, 0x92, 0x9b,
-  0xa5, 0xae, 0xb5, 0xba, 0xbb, 0xbc, 0xbd, 0xc0, 0xc4, 0xc6, 0xc7, 0xc7,
-  0xc9, 0xcd, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xcc, 0xcc, 0xcd, 0xd0, 0xcf,
-  0xcd, 0xcb, 0xca, 0xcc, 0xcd, 0xce, 0xcf, 0xd2, 0xd6, 0xd8, 0xd8, 0xd8,
-  0xd7, 0xd5, 0xd1, 0xcc, 0xc9, 0xc3, 0xb1, 0x9e, 0xa2, 0xa7, 0xaa, 0xac,
-  0xb3, 0xb6, 0xb6, 0xb7, 0xb7, 0xba, 0xbc, 0xbb, 0xbb, 0xbb, 0xba, 0xba,
-  0xbb, 0xbc, 0xbf, 0xc1, 0xc4, 0xc7, 0xc8, 0xc8, 0xc6, 0xc5, 0xca, 0xcb,
-  0xc7, 0xc7, 0xc6, 0xc5, 0xc5, 0xc6, 0xc6, 0xca, 0xce, 0xcf, 0xcd, 0xc9,
-  0xc7, 0xc4, 0xc3, 0xc3, 0xc3, 0xc6, 0xcc, 0xce, 0xd0, 0xd1, 0xd2, 0xd2,
-  0xd2, 0xd2, 0xd2, 0xd1, 0xd0, 0xd1, 0xd5, 0xd8, 0xd9, 0xd8, 0xd6, 0xd3,
-  0xcf, 0xce, 0xd0, 0xd2, 0xd2, 0xc8, 0xbd, 0xb2, 0xac, 0xa3, 0x96, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x89, 0x85, 0x85, 0x85, 0x84, 0x86, 0x8d, 0x8e, 0x88,
-  0x84, 0x7d, 0x75, 0x6f, 0x6e, 0x6d, 0x68, 0x63, 0x62, 0x63, 0x63, 0x61,
-  0x60, 0x5e, 0x5c, 0x5c, 0x5c, 0x58, 0x54, 0x52, 0x52, 0x56, 0x5b, 0x58,
-  0x51, 0x50, 0x5a, 0x6c, 0x77, 0x7f, 0x80, 0x7a, 0x5f, 0x59, 0x60, 0x65,
-  0x6b, 0x74, 0x7c, 0x7f, 0x81, 0x83, 0x85, 0x88, 0x8b, 0x8a, 0x82, 0x70,
-  0x5e, 0x57, 0x55, 0x54, 0x54, 0x52, 0x51, 0x51, 0x50, 0x4e, 0x52, 0x67,
-  0x7d, 0x89, 0x94, 0x9d, 0xa5, 0xa9, 0xac, 0xad, 0xac, 0xad, 0xaf, 0xaf,
-  0xb1, 0xb4, 0xb7, 0xb8, 0xb7, 0xb4, 0xb2, 0xb0, 0xad, 0xac, 0xab, 0xa8,
-  0xa5, 0xa3, 0xa1, 0x9f, 0x9e, 0x9b, 0x9a, 0x99, 0x97, 0x95, 0x94, 0x92,
-  0x91, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8e,
-  0x8e, 0x8c, 0x8c, 0x8c, 0x8a, 0x89, 0x87, 0x84, 0x83, 0x82, 0x81, 0x7e,
-  0x7a, 0x78, 0x75, 0x71, 0x47, 0x49, 0x4b, 0x4d, 0x50, 0x51, 0x54, 0x58,
-  0x5a, 0x5b, 0x5b, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c,
-  0x5d, 0x5e, 0x5d, 0x5d, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61,
-  0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x64, 0x65, 0x66, 0x66, 0x66, 0x66,
-  0x64, 0x64, 0x63, 0x61, 0x5f, 0x5e, 0x5b, 0x5b, 0x5e, 0x5f, 0x63, 0x66,
-  0x68, 0x67, 0x67, 0x6a, 0x75, 0x83, 0x8f, 0x98, 0xa3, 0xab, 0xb3, 0xb9,
-  0xbc, 0xbc, 0xbc, 0xbf, 0xc3, 0xc6, 0xc6, 0xc6, 0xc6, 0xca, 0xcc, 0xcc,
-  0xcb, 0xcc, 0xcc, 0xcb, 0xcb, 0xcb, 0xcd, 0xcc, 0xc9, 0xc8, 0xc8, 0xca,
-  0xca, 0xcc, 0xcd, 0xcf, 0xd3, 0xd6, 0xd9, 0xda, 0xda, 0xd9, 0xd6, 0xd2,
-  0xcf, 0xca, 0xbe, 0xad, 0xaa, 0xac, 0xb1, 0xb3, 0xb6, 0xb7, 0xb8, 0xb7,
-  0xb7, 0xba, 0xbc, 0xbc, 0xbb, 0xbd, 0xba, 0xb9, 0xba, 0xbb, 0xbd, 0xbf,
-  0xc1, 0xc6, 0xc8, 0xc8, 0xc8, 0xc6, 0xc9, 0xca, 0xc7, 0xc6, 0xc7, 0xc8,
-  0xc8, 0xc6, 0xc7, 0xca, 0xce, 0xcf, 0xcd, 0xca, 0xc8, 0xc6, 0xc5, 0xc4,
-  0xc4, 0xc6, 0xcc, 0xce, 0xd0, 0xd0, 0xd1, 0xd2, 0xd2, 0xd2, 0xd1, 0xd1,
-  0xd2, 0xd4, 0xd8, 0xda, 0xda, 0xd8, 0xd6, 0xd3, 0xcf, 0xcc, 0xce, 0xce,
-  0xcd, 0xc4, 0xb7, 0xac, 0xa6, 0x9f, 0x95, 0x8a, 0x89, 0x8a, 0x89, 0x83,
-  0x7c, 0x7f, 0x82, 0x85, 0x87, 0x8c, 0x8d, 0x87, 0x82, 0x7d, 0x75, 0x6f,
-  0x6e, 0x6c, 0x66, 0x60, 0x60, 0x61, 0x61, 0x60, 0x5d, 0x5c, 0x5b, 0x5b,
-  0x5c, 0x54, 0x4f, 0x4e, 0x52, 0x5a, 0x5b, 0x5a, 0x56, 0x5a, 0x68, 0x79,
-  0x82, 0x86, 0x84, 0x77, 0x5a, 0x5a, 0x61, 0x66, 0x6c, 0x74, 0x7a, 0x7d,
-  0x7e, 0x7f, 0x82, 0x86, 0x89, 0x88, 0x82, 0x72, 0x61, 0x58, 0x56, 0x57,
-  0x55, 0x53, 0x51, 0x50, 0x50, 0x4e, 0x53, 0x69, 0x7e, 0x88, 0x91, 0x9a,
-  0xa1, 0xa5, 0xa7, 0xa8, 0xa7, 0xa9, 0xab, 0xac, 0xae, 0xb3, 0xb6, 0xb7,
-  0xb6, 0xb4, 0xb3, 0xb0, 0xad, 0xac, 0xaa, 0xa7, 0xa4, 0xa2, 0xa2, 0x9f,
-  0x9e, 0x9b, 0x9a, 0x99, 0x98, 0x95, 0x94, 0x93, 0x92, 0x92, 0x92, 0x91,
-  0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x90, 0x8f, 0x8f, 0x8d, 0x8e, 0x8d,
-  0x8c, 0x8b, 0x88, 0x87, 0x86, 0x84, 0x83, 0x7f, 0x7d, 0x7b, 0x78, 0x74,
-  0x46, 0x48, 0x4a, 0x4d, 0x50, 0x51, 0x54, 0x58, 0x59, 0x5b, 0x5b, 0x5d,
-  0x5c, 0x5c, 0x5b, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5d, 0x5e, 0x5d, 0x5d,
-  0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x60, 0x60, 0x61, 0x61,
-  0x63, 0x63, 0x63, 0x65, 0x66, 0x66, 0x66, 0x65, 0x64, 0x64, 0x62, 0x60,
-  0x5f, 0x5d, 0x5b, 0x5b, 0x5e, 0x5f, 0x63, 0x66, 0x67, 0x67, 0x66, 0x69,
-  0x73, 0x81, 0x8d, 0x96, 0xa1, 0xaa, 0xb3, 0xb9, 0xbc, 0xbc, 0xbc, 0xbf,
-  0xc2, 0xc5, 0xc6, 0xc5, 0xc5, 0xc8, 0xca, 0xca, 0xca, 0xca, 0xca, 0xc9,
-  0xca, 0xca, 0xcb, 0xc9, 0xc6, 0xc5, 0xc6, 0xc8, 0xc9, 0xca, 0xcb, 0xcc,
-  0xd0, 0xd4, 0xd8, 0xd9, 0xda, 0xda, 0xd9, 0xd6, 0xd3, 0xcf, 0xc6, 0xb8,
-  0xb0, 0xaf, 0xb2, 0xb5, 0xb6, 0xb8, 0xb8, 0xb6, 0xb7, 0xba, 0xbb, 0xbb,
-  0xbb, 0xbd, 0xbb, 0xba, 0xba, 0xbb, 0xbc, 0xbd, 0xc1, 0xc4, 0xc6, 0xc8,
-  0xc8, 0xc6, 0xc8, 0xc8, 0xc6, 0xc4, 0xc7, 0xc9, 0xc9, 0xc7, 0xc7, 0xc9,
-  0xcc, 0xce, 0xcd, 0xcb, 0xc9, 0xc7, 0xc6, 0xc4, 0xc4, 0xc5, 0xca, 0xcc,
-  0xce, 0xcf, 0xcf, 0xd0, 0xd1, 0xd1, 0xd0, 0xd0, 0xd1, 0xd4, 0xd8, 0xdb,
-  0xd9, 0xd8, 0xd6, 0xd3, 0xcf, 0xcc, 0xcb, 0xcb, 0xc9, 0xc0, 0xb3, 0xa7,
-  0xa1, 0x9e, 0x95, 0x8a, 0x89, 0x8a, 0x8a, 0x81, 0x78, 0x7e, 0x82, 0x87,
-  0x88, 0x8c, 0x8c, 0x85, 0x81, 0x7d, 0x76, 0x70, 0x6e, 0x6b, 0x63, 0x5e,
-  0x5e, 0x60, 0x60, 0x5f, 0x5b, 0x5b, 0x5c, 0x5c, 0x5b, 0x53, 0x4f, 0x4f,
-  0x53, 0x5c, 0x5b, 0x5c, 0x5e, 0x64, 0x73, 0x81, 0x88, 0x88, 0x83, 0x72,
-  0x58, 0x5a, 0x62, 0x67, 0x6d, 0x74, 0x79, 0x7b, 0x7c, 0x7d, 0x7f, 0x83,
-  0x85, 0x85, 0x80, 0x71, 0x61, 0x5a, 0x58, 0x58, 0x56, 0x54, 0x52, 0x50,
-  0x4f, 0x4d, 0x54, 0x6a, 0x7c, 0x86, 0x8f, 0x97, 0x9e, 0xa2, 0xa4, 0xa5,
-  0xa4, 0xa6, 0xa8, 0xaa, 0xac, 0xb2, 0xb5, 0xb7, 0xb6, 0xb4, 0xb3, 0xb0,
-  0xac, 0xab, 0xa9, 0xa6, 0xa3, 0xa2, 0xa1, 0x9f, 0x9d, 0x9a, 0x99, 0x99,
-  0x97, 0x95, 0x94, 0x93, 0x92, 0x92, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93,
-  0x92, 0x92, 0x91, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x89, 0x88,
-  0x87, 0x85, 0x84, 0x81, 0x7e, 0x7d, 0x7a, 0x76, 0x45, 0x47, 0x49, 0x4c,
-  0x4f, 0x51, 0x54, 0x58, 0x59, 0x5a, 0x5c, 0x5c, 0x5b, 0x5a, 0x5a, 0x5a,
-  0x5b, 0x5b, 0x5b, 0x5b, 0x5c, 0x5e, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x60,
-  0x60, 0x5f, 0x60, 0x61, 0x60, 0x60, 0x61, 0x61, 0x63, 0x63, 0x63, 0x64,
-  0x66, 0x66, 0x66, 0x66, 0x64, 0x63, 0x61, 0x5f, 0x5e, 0x5d, 0x5a, 0x5c,
-  0x5e, 0x60, 0x63, 0x65, 0x67, 0x66, 0x66, 0x67, 0x71, 0x80, 0x8a, 0x92,
-  0x9e, 0xaa, 0xb2, 0xb8, 0xbc, 0xbc, 0xbc, 0xbf, 0xc2, 0xc4, 0xc6, 0xc4,
-  0xc3, 0xc5, 0xc6, 0xc7, 0xc8, 0xc8, 0xc7, 0xc7, 0xc8, 0xc9, 0xcb, 0xc8,
-  0xc3, 0xc1, 0xc2, 0xc4, 0xc6, 0xc7, 0xc7, 0xc8, 0xcc, 0xcf, 0xd3, 0xd5,
-  0xd7, 0xd9, 0xdc, 0xdd, 0xdc, 0xd7, 0xcf, 0xc4, 0xba, 0xb4, 0xaf, 0xb4,
-  0xb7, 0xb7, 0xb7, 0xb6, 0xb8, 0xba, 0xbb, 0xbc, 0xbb, 0xbb, 0xbc, 0xbb,
-  0xbc, 0xbd, 0xbb, 0xbc, 0xc0, 0xc3, 0xc4, 0xc8, 0xc9, 0xc6, 0xc6, 0xc6,
-  0xc5, 0xc3, 0xc6, 0xc9, 0xca, 0xc8, 0xc7, 0xc5, 0xc8, 0xca, 0xca, 0xc9,
-  0xc9, 0xc7, 0xc6, 0xc4, 0xc3, 0xc3, 0xc5, 0xc7, 0xc9, 0xcb, 0xcc, 0xcd,
-  0xcd, 0xce, 0xcd, 0xcc, 0xcd, 0xcf, 0xd3, 0xd7, 0xd6, 0xd5, 0xd4, 0xd2,
-  0xce, 0xca, 0xc8, 0xc7, 0xc4, 0xba, 0xac, 0xa0, 0x9c, 0x9b, 0x95, 0x8b,
-  0x8a, 0x8c, 0x8c, 0x80, 0x78, 0x7f, 0x85, 0x89, 0x89, 0x8b, 0x8b, 0x84,
-  0x80, 0x7c, 0x77, 0x71, 0x6c, 0x68, 0x60, 0x5c, 0x5d, 0x5e, 0x5e, 0x5c,
-  0x5a, 0x5c, 0x5d, 0x5d, 0x59, 0x52, 0x54, 0x54, 0x57, 0x5e, 0x5d, 0x60,
-  0x6b, 0x76, 0x84, 0x8a, 0x8b, 0x85, 0x7b, 0x66, 0x55, 0x5c, 0x64, 0x68,
-  0x6d, 0x75, 0x78, 0x7a, 0x7a, 0x79, 0x7b, 0x7e, 0x80, 0x7f, 0x79, 0x6d,
-  0x61, 0x5b, 0x59, 0x5a, 0x58, 0x56, 0x52, 0x50, 0x4e, 0x4e, 0x53, 0x67,
-  0x78, 0x81, 0x8c, 0x94, 0x9a, 0x9e, 0x9f, 0xa0, 0x9f, 0xa0, 0xa3, 0xa5,
-  0xa9, 0xae, 0xb2, 0xb5, 0xb5, 0xb3, 0xb2, 0xaf, 0xac, 0xab, 0xa8, 0xa5,
-  0xa2, 0xa1, 0xa0, 0x9e, 0x9d, 0x9a, 0x98, 0x97, 0x97, 0x95, 0x94, 0x92,
-  0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x94, 0x93, 0x92, 0x92, 0x90,
-  0x90, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x87, 0x86, 0x83,
-  0x81, 0x80, 0x7d, 0x78, 0x44, 0x47, 0x4a, 0x4c, 0x4f, 0x50, 0x53, 0x57,
-  0x58, 0x59, 0x5a, 0x5a, 0x59, 0x5a, 0x5b, 0x5a, 0x5a, 0x5b, 0x5b, 0x5a,
-  0x5b, 0x5d, 0x5d, 0x5c, 0x5d, 0x60, 0x60, 0x5f, 0x5e, 0x5f, 0x61, 0x61,
-  0x61, 0x61, 0x62, 0x61, 0x63, 0x64, 0x64, 0x63, 0x64, 0x66, 0x66, 0x65,
-  0x63, 0x61, 0x5f, 0x5e, 0x5e, 0x5c, 0x5a, 0x5b, 0x5e, 0x60, 0x63, 0x64,
-  0x65, 0x67, 0x67, 0x68, 0x6f, 0x7d, 0x88, 0x90, 0x9c, 0xa7, 0xb0, 0xb7,
-  0xbb, 0xbc, 0xbc, 0xbd, 0xc1, 0xc4, 0xc5, 0xc5, 0xc3, 0xc2, 0xc4, 0xc6,
-  0xc7, 0xc6, 0xc6, 0xc6, 0xc7, 0xca, 0xcd, 0xc9, 0xc4, 0xc1, 0xc0, 0xc0,
-  0xc1, 0xc1, 0xc3, 0xc6, 0xc9, 0xcb, 0xce, 0xd0, 0xd3, 0xd6, 0xdb, 0xe1,
-  0xe3, 0xe0, 0xd9, 0xd0, 0xc8, 0xbf, 0xb2, 0xb1, 0xb5, 0xb7, 0xb8, 0xb7,
-  0xb7, 0xb9, 0xba, 0xbb, 0xbc, 0xba, 0xba, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-  0xbf, 0xc2, 0xc3, 0xc5, 0xc8, 0xc7, 0xc4, 0xc3, 0xc3, 0xc2, 0xc4, 0xc7,
-  0xc8, 0xc7, 0xc5, 0xc4, 0xc7, 0xc8, 0xc8, 0xc7, 0xc6, 0xc5, 0xc4, 0xc5,
-  0xc4, 0xc2, 0xc2, 0xc3, 0xc4, 0xc5, 0xc7, 0xc8, 0xc8, 0xc8, 0xc7, 0xc5,
-  0xc3, 0xc4, 0xc8, 0xce, 0xd1, 0xd0, 0xd0, 0xce, 0xcb, 0xc7, 0xc5, 0xc3,
-  0xbe, 0xb6, 0xa8, 0x9b, 0x97, 0x97, 0x8f, 0x87, 0x87, 0x89, 0x8c, 0x85,
-  0x7e, 0x85, 0x89, 0x8a, 0x89, 0x8b, 0x89, 0x82, 0x7e, 0x79, 0x76, 0x70,
-  0x6b, 0x66, 0x5f, 0x5c, 0x5d, 0x5d, 0x5c, 0x5a, 0x5b, 0x5d, 0x5d, 0x5a,
-  0x54, 0x53, 0x5a, 0x5b, 0x5e, 0x63, 0x69, 0x74, 0x83, 0x8c, 0x92, 0x8f,
-  0x87, 0x76, 0x68, 0x55, 0x53, 0x5d, 0x64, 0x68, 0x6f, 0x75, 0x77, 0x77,
-  0x77, 0x76, 0x77, 0x79, 0x79, 0x77, 0x70, 0x67, 0x5f, 0x5c, 0x5b, 0x5a,
-  0x5a, 0x57, 0x54, 0x52, 0x50, 0x4f, 0x54, 0x62, 0x71, 0x7a, 0x84, 0x8f,
-  0x95, 0x98, 0x9a, 0x9a, 0x99, 0x99, 0x9c, 0xa0, 0xa5, 0xa9, 0xaf, 0xb3,
-  0xb4, 0xb3, 0xb1, 0xaf, 0xac, 0xab, 0xa8, 0xa4, 0xa2, 0xa0, 0x9f, 0x9e,
-  0x9d, 0x99, 0x97, 0x96, 0x95, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
-  0x92, 0x92, 0x92, 0x94, 0x94, 0x93, 0x93, 0x92, 0x92, 0x90, 0x90, 0x90,
-  0x8f, 0x90, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x86, 0x84, 0x82, 0x80, 0x7c,
-  0x43, 0x46, 0x4a, 0x4d, 0x4f, 0x50, 0x52, 0x55, 0x57, 0x58, 0x5a, 0x5a,
-  0x59, 0x5a, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5a, 0x5b, 0x5d, 0x5d, 0x5c,
-  0x5e, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x61, 0x61, 0x60, 0x61, 0x62, 0x61,
-  0x63, 0x64, 0x63, 0x63, 0x64, 0x65, 0x66, 0x65, 0x63, 0x61, 0x5e, 0x5d,
-  0x5d, 0x5c, 0x5a, 0x5b, 0x5d, 0x5f, 0x63, 0x63, 0x64, 0x65, 0x66, 0x66,
-  0x6d, 0x7a, 0x85, 0x8d, 0x98, 0xa5, 0xad, 0xb5, 0xba, 0xbb, 0xbb, 0xbc,
-  0xbf, 0xc3, 0xc5, 0xc6, 0xc4, 0xc2, 0xc4, 0xc6, 0xc7, 0xc6, 0xc8, 0xc7,
-  0xc9, 0xcc, 0xd0, 0xcf, 0xcb, 0xc8, 0xc5, 0xc1, 0xbd, 0xbd, 0xbf, 0xc4,
-  0xc8, 0xca, 0xcd, 0xce, 0xd0, 0xd2, 0xd5, 0xdc, 0xe0, 0xe3, 0xe2, 0xdc,
-  0xd5, 0xcc, 0xbd, 0xad, 0xaf, 0xb6, 0xb8, 0xb7, 0xb6, 0xb7, 0xba, 0xbc,
-  0xbd, 0xba, 0xb8, 0xb8, 0xb9, 0xba, 0xbb, 0xba, 0xbc, 0xbf, 0xc1, 0xc2,
-  0xc7, 0xc9, 0xc4, 0xc2, 0xc1, 0xc1, 0xc0, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1,
-  0xc3, 0xc4, 0xc4, 0xc2, 0xc2, 0xc1, 0xc1, 0xc3, 0xc3, 0xbf, 0xc0, 0xc1,
-  0xc1, 0xc1, 0xc2, 0xc3, 0xc3, 0xc2, 0xc2, 0xbf, 0xbd, 0xbc, 0xbe, 0xc3,
-  0xc8, 0xc9, 0xca, 0xc9, 0xc7, 0xc5, 0xc2, 0xbf, 0xba, 0xb4, 0xa8, 0x9a,
-  0x94, 0x91, 0x8a, 0x84, 0x87, 0x8a, 0x8c, 0x87, 0x83, 0x89, 0x8b, 0x89,
-  0x87, 0x8a, 0x88, 0x81, 0x7d, 0x78, 0x73, 0x6c, 0x66, 0x62, 0x5d, 0x5c,
-  0x5e, 0x5c, 0x5b, 0x5a, 0x5f, 0x5f, 0x58, 0x54, 0x50, 0x57, 0x5f, 0x68,
-  0x6e, 0x77, 0x81, 0x8a, 0x8e, 0x90, 0x8f, 0x8a, 0x72, 0x57, 0x4d, 0x4b,
-  0x56, 0x60, 0x67, 0x6a, 0x70, 0x75, 0x75, 0x73, 0x71, 0x6f, 0x71, 0x73,
-  0x70, 0x6e, 0x69, 0x61, 0x5b, 0x5a, 0x5a, 0x5a, 0x5b, 0x59, 0x55, 0x53,
-  0x51, 0x50, 0x51, 0x5c, 0x69, 0x72, 0x7c, 0x87, 0x8e, 0x93, 0x93, 0x94,
-  0x92, 0x93, 0x96, 0x9a, 0x9f, 0xa5, 0xaa, 0xae, 0xb0, 0xb1, 0xb0, 0xae,
-  0xab, 0xa9, 0xa8, 0xa5, 0xa1, 0xa0, 0x9e, 0x9d, 0x9b, 0x97, 0x95, 0x93,
-  0x93, 0x91, 0x91, 0x91, 0x91, 0x91, 0x92, 0x91, 0x92, 0x92, 0x91, 0x92,
-  0x92, 0x92, 0x92, 0x93, 0x92, 0x90, 0x90, 0x90, 0x91, 0x92, 0x91, 0x8e,
-  0x8d, 0x8b, 0x8a, 0x88, 0x86, 0x84, 0x83, 0x7f, 0x42, 0x46, 0x4a, 0x4c,
-  0x4f, 0x51, 0x52, 0x55, 0x57, 0x58, 0x5a, 0x5b, 0x5b, 0x5b, 0x5b, 0x5c,
-  0x5b, 0x5c, 0x5c, 0x5b, 0x5b, 0x5d, 0x5d, 0x5c, 0x5d, 0x5f, 0x60, 0x5f,
-  0x5f, 0x60, 0x62, 0x62, 0x61, 0x61, 0x62, 0x61, 0x63, 0x63, 0x63, 0x62,
-  0x63, 0x65, 0x66, 0x65, 0x64, 0x61, 0x5e, 0x5c, 0x5c, 0x5c, 0x5b, 0x5c,
-  0x5e, 0x60, 0x62, 0x64, 0x63, 0x64, 0x65, 0x65, 0x6b, 0x79, 0x84, 0x8b,
-  0x95, 0xa3, 0xab, 0xb4, 0xb9, 0xbb, 0xbc, 0xbd, 0xbf, 0xc1, 0xc3, 0xc6,
-  0xc5, 0xc3, 0xc4, 0xc5, 0xc6, 0xc6, 0xc8, 0xc9, 0xca, 0xce, 0xd2, 0xd2,
-  0xd1, 0xcf, 0xcb, 0xc6, 0xbf, 0xbc, 0xbd, 0xc2, 0xc7, 0xca, 0xcc, 0xcd,
-  0xce, 0xcf, 0xd1, 0xd3, 0xd7, 0xde, 0xe4, 0xe3, 0xde, 0xd8, 0xc9, 0xb0,
-  0xa4, 0xad, 0xb4, 0xb7, 0xb6, 0xb7, 0xb9, 0xba, 0xbb, 0xb9, 0xb9, 0xbb,
-  0xbb, 0xba, 0xba, 0xb9, 0xba, 0xbb, 0xbb, 0xbd, 0xc4, 0xc8, 0xc5, 0xc2,
-  0xc1, 0xc0, 0xbe, 0xbd, 0xbe, 0xbd, 0xbf, 0xbe, 0xbe, 0xbf, 0xbf, 0xbe,
-  0xbf, 0xbe, 0xbf, 0xc1, 0xc2, 0xbe, 0xbe, 0xbf, 0xbf, 0xbe, 0xc0, 0xbf,
-  0xbf, 0xbd, 0xbd, 0xbc, 0xbd, 0xbd, 0xbc, 0xbf, 0xc3, 0xc5, 0xc5, 0xc4,
-  0xc5, 0xc2, 0xbf, 0xbb, 0xb7, 0xb1, 0xa7, 0x9a, 0x95, 0x8f, 0x88, 0x86,
-  0x8b, 0x8e, 0x8f, 0x88, 0x84, 0x89, 0x8b, 0x89, 0x88, 0x8a, 0x88, 0x80,
-  0x7c, 0x77, 0x71, 0x69, 0x62, 0x5e, 0x5c, 0x5e, 0x5f, 0x5e, 0x5c, 0x5d,
-  0x61, 0x5d, 0x54, 0x50, 0x51, 0x5d, 0x6a, 0x77, 0x7f, 0x87, 0x8e, 0x8f,
-  0x8f, 0x90, 0x8d, 0x7a, 0x54, 0x41, 0x3f, 0x4b, 0x5b, 0x63, 0x68, 0x6d,
-  0x72, 0x74, 0x72, 0x6e, 0x6c, 0x6c, 0x6e, 0x6e, 0x6c, 0x6a, 0x65, 0x5e,
-  0x59, 0x57, 0x57, 0x57, 0x59, 0x57, 0x55, 0x53, 0x51, 0x50, 0x50, 0x56,
-  0x61, 0x69, 0x75, 0x81, 0x8a, 0x8e, 0x90, 0x90, 0x8e, 0x8f, 0x92, 0x95,
-  0x9a, 0xa1, 0xa7, 0xaa, 0xac, 0xaf, 0xaf, 0xad, 0xaa, 0xa9, 0xa8, 0xa6,
-  0xa1, 0x9f, 0x9d, 0x9c, 0x98, 0x94, 0x93, 0x92, 0x91, 0x8f, 0x90, 0x90,
-  0x90, 0x90, 0x91, 0x90, 0x91, 0x91, 0x90, 0x91, 0x91, 0x91, 0x91, 0x92,
-  0x92, 0x91, 0x91, 0x92, 0x92, 0x92, 0x91, 0x8f, 0x8e, 0x8d, 0x8c, 0x8a,
-  0x88, 0x87, 0x85, 0x82, 0x42, 0x45, 0x4a, 0x4c, 0x4e, 0x51, 0x52, 0x55,
-  0x57, 0x58, 0x5b, 0x5c, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x5b,
-  0x5c, 0x5d, 0x5d, 0x5d, 0x5e, 0x5f, 0x5f, 0x5e, 0x5f, 0x61, 0x62, 0x62,
-  0x61, 0x61, 0x62, 0x61, 0x63, 0x63, 0x63, 0x62, 0x63, 0x65, 0x66, 0x65,
-  0x64, 0x61, 0x5e, 0x5c, 0x5c, 0x5c, 0x5b, 0x5c, 0x5f, 0x60, 0x62, 0x64,
-  0x63, 0x64, 0x64, 0x64, 0x69, 0x77, 0x82, 0x89, 0x94, 0xa1, 0xaa, 0xb3,
-  0xb8, 0xba, 0xbc, 0xbd, 0xbe, 0xc1, 0xc2, 0xc5, 0xc5, 0xc4, 0xc5, 0xc5,
-  0xc6, 0xc7, 0xc8, 0xca, 0xcb, 0xce, 0xd2, 0xd3, 0xd3, 0xd2, 0xcf, 0xca,
-  0xc4, 0xbf, 0xbe, 0xc1, 0xc5, 0xc9, 0xcc, 0xcd, 0xcd, 0xcf, 0xcf, 0xcf,
-  0xd2, 0xda, 0xe2, 0xe4, 0xe1, 0xdd, 0xd1, 0xb8, 0xa1, 0xa4, 0xab, 0xb4,
-  0xb7, 0xb7, 0xb8, 0xb9, 0xb9, 0xb8, 0xb9, 0xbb, 0xbb, 0xb9, 0xb8, 0xb7,
-  0xb7, 0xb7, 0xb8, 0xb9, 0xc0, 0xc7, 0xc4, 0xc2, 0xc0, 0xbf, 0xbc, 0xbc,
-  0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xbc, 0xbd, 0xc0,
-  0xc0, 0xbc, 0xbc, 0xbd, 0xbd, 0xbd, 0xbe, 0xbd, 0xbd, 0xbb, 0xbb, 0xbb,
-  0xbc, 0xbc, 0xbc, 0xbe, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xbd, 0xba,
-  0xb5, 0xaf, 0xa5, 0x9a, 0x95, 0x8f, 0x89, 0x8a, 0x8e, 0x91, 0x92, 0x89,
-  0x84, 0x88, 0x89, 0x88, 0x87, 0x89, 0x87, 0x81, 0x7d, 0x77, 0x71, 0x67,
-  0x60, 0x5d, 0x5c, 0x5f, 0x60, 0x5e, 0x5d, 0x5e, 0x5f, 0x5b, 0x52, 0x51,
-  0x57, 0x65, 0x74, 0x80, 0x87, 0x8e, 0x92, 0x90, 0x90, 0x8e, 0x84, 0x67,
-  0x42, 0x39, 0x3d, 0x4e, 0x5e, 0x66, 0x6a, 0x6c, 0x70, 0x71, 0x6e, 0x6c,
-  0x6b, 0x6b, 0x6c, 0x6c, 0x69, 0x67, 0x63, 0x5c, 0x57, 0x55, 0x55, 0x55,
-  0x58, 0x57, 0x55, 0x53, 0x51, 0x4f, 0x4d, 0x52, 0x5c, 0x63, 0x6f, 0x7d,
-  0x87, 0x8c, 0x8e, 0x8e, 0x8d, 0x8e, 0x91, 0x93, 0x98, 0x9f, 0xa4, 0xa8,
-  0xaa, 0xad, 0xae, 0xad, 0xaa, 0xa9, 0xa9, 0xa6, 0xa1, 0x9f, 0x9d, 0x9a,
-  0x97, 0x93, 0x92, 0x91, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8e, 0x8f, 0x91, 0x91, 0x91, 0x92, 0x92, 0x91, 0x91, 0x92,
-  0x91, 0x91, 0x91, 0x8f, 0x8f, 0x8e, 0x8d, 0x8b, 0x8a, 0x88, 0x87, 0x84,
-  0x43, 0x46, 0x49, 0x4b, 0x4e, 0x52, 0x53, 0x55, 0x57, 0x58, 0x5b, 0x5c,
-  0x5c, 0x5b, 0x5a, 0x5b, 0x5a, 0x5c, 0x5c, 0x5c, 0x5d, 0x5e, 0x5d, 0x5d,
-  0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x61, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62,
-  0x61, 0x62, 0x63, 0x63, 0x63, 0x65, 0x65, 0x65, 0x62, 0x60, 0x5d, 0x5c,
-  0x5c, 0x5b, 0x5c, 0x5f, 0x60, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x62,
-  0x66, 0x75, 0x81, 0x88, 0x92, 0x9f, 0xa8, 0xb0, 0xb6, 0xb8, 0xbb, 0xbc,
-  0xbd, 0xc0, 0xc2, 0xc5, 0xc6, 0xc5, 0xc6, 0xc6, 0xc6, 0xc8, 0xc9, 0xc9,
-  0xcb, 0xce, 0xd0, 0xd3, 0xd4, 0xd4, 0xd2, 0xd0, 0xcb, 0xc7, 0xc4, 0xc1,
-  0xc3, 0xc7, 0xca, 0xcb, 0xce, 0xcf, 0xd0, 0xcf, 0xd0, 0xd4, 0xda, 0xe0,
-  0xe3, 0xe1, 0xdb, 0xc8, 0xa9, 0x9a, 0x9a, 0xa8, 0xb5, 0xb7, 0xb7, 0xb8,
-  0xb8, 0xb8, 0xb7, 0xb9, 0xb8, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb5,
-  0xbb, 0xc2, 0xc1, 0xbf, 0xbe, 0xbc, 0xbb, 0xba, 0xba, 0xba, 0xb9, 0xb7,
-  0xb5, 0xb5, 0xb6, 0xb6, 0xb9, 0xba, 0xba, 0xbc, 0xbd, 0xba, 0xb9, 0xba,
-  0xba, 0xba, 0xba, 0xba, 0xba, 0xb9, 0xb9, 0xba, 0xbb, 0xbb, 0xbb, 0xbc,
-  0xbf, 0xc1, 0xc1, 0xc1, 0xc2, 0xc0, 0xbd, 0xb9, 0xb3, 0xab, 0xa1, 0x98,
-  0x94, 0x90, 0x8b, 0x90, 0x93, 0x96, 0x96, 0x8d, 0x84, 0x85, 0x87, 0x88,
-  0x86, 0x84, 0x84, 0x81, 0x7e, 0x78, 0x70, 0x66, 0x5f, 0x5d, 0x5d, 0x60,
-  0x5f, 0x5e, 0x5c, 0x5b, 0x5b, 0x58, 0x54, 0x58, 0x68, 0x77, 0x82, 0x89,
-  0x8e, 0x94, 0x94, 0x91, 0x8b, 0x81, 0x68, 0x44, 0x36, 0x3a, 0x43, 0x54,
-  0x63, 0x69, 0x69, 0x6a, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6a,
-  0x66, 0x63, 0x60, 0x5a, 0x57, 0x54, 0x53, 0x54, 0x57, 0x56, 0x54, 0x52,
-  0x50, 0x4b, 0x49, 0x4c, 0x53, 0x5b, 0x67, 0x76, 0x82, 0x89, 0x8d, 0x8f,
-  0x90, 0x8f, 0x90, 0x91, 0x95, 0x9b, 0xa0, 0xa3, 0xa6, 0xa9, 0xab, 0xab,
-  0xaa, 0xa9, 0xa8, 0xa5, 0xa1, 0x9f, 0x9c, 0x98, 0x94, 0x92, 0x90, 0x8f,
-  0x8e, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x90, 0x90, 0x90,
-  0x90, 0x8f, 0x8d, 0x8b, 0x8a, 0x89, 0x87, 0x85, 0x43, 0x45, 0x48, 0x4a,
-  0x4c, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5a, 0x5b, 0x5c, 0x5b, 0x5a, 0x5b,
-  0x5b, 0x5a, 0x5a, 0x5b, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5e,
-  0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x61, 0x62, 0x63,
-  0x63, 0x64, 0x64, 0x63, 0x62, 0x60, 0x5d, 0x5c, 0x5b, 0x5b, 0x5c, 0x5f,
-  0x61, 0x61, 0x60, 0x61, 0x61, 0x61, 0x61, 0x60, 0x64, 0x71, 0x7f, 0x86,
-  0x8f, 0x9c, 0xa5, 0xad, 0xb3, 0xb6, 0xb9, 0xbb, 0xbc, 0xbf, 0xc1, 0xc3,
-  0xc5, 0xc5, 0xc6, 0xc6, 0xc6, 0xc8, 0xc9, 0xcb, 0xcd, 0xce, 0xcf, 0xd2,
-  0xd5, 0xd6, 0xd6, 0xd6, 0xd4, 0xd1, 0xce, 0xc8, 0xc4, 0xc3, 0xc6, 0xc9,
-  0xcb, 0xcc, 0xce, 0xcf, 0xcf, 0xd0, 0xd2, 0xd7, 0xdb, 0xde, 0xe1, 0xdb,
-  0xc6, 0xa9, 0x99, 0x8f, 0xa0, 0xb0, 0xb4, 0xb5, 0xb5, 0xb5, 0xb3, 0xb3,
-  0xb3, 0xb3, 0xb3, 0xb3, 0xb1, 0xb0, 0xb1, 0xb1, 0xb1, 0xb7, 0xb9, 0xb9,
-  0xba, 0xb9, 0xb9, 0xba, 0xb9, 0xb8, 0xb6, 0xb4, 0xb2, 0xb2, 0xb2, 0xb2,
-  0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb5, 0xb5, 0xb6, 0xb5, 0xb5,
-  0xb6, 0xb6, 0xb6, 0xb8, 0xb9, 0xba, 0xba, 0xbb, 0xbe, 0xc0, 0xc0, 0xbe,
-  0xbe, 0xbd, 0xba, 0xb6, 0xaf, 0xa5, 0x9c, 0x98, 0x96, 0x93, 0x90, 0x95,
-  0x98, 0x98, 0x97, 0x90, 0x86, 0x84, 0x84, 0x85, 0x83, 0x80, 0x81, 0x80,
-  0x7e, 0x77, 0x6e, 0x66, 0x60, 0x5e, 0x60, 0x5f, 0x5d, 0x59, 0x57, 0x56,
-  0x5b, 0x64, 0x6b, 0x72, 0x7f, 0x89, 0x8e, 0x93, 0x95, 0x95, 0x8c, 0x77,
-  0x5f, 0x50, 0x40, 0x35, 0x37, 0x41, 0x4a, 0x5a, 0x67, 0x6a, 0x67, 0x66,
-  0x66, 0x6a, 0x6c, 0x6e, 0x6e, 0x6d, 0x6b, 0x67, 0x63, 0x61, 0x5e, 0x5a,
-  0x55, 0x52, 0x51, 0x53, 0x57, 0x56, 0x52, 0x4f, 0x4b, 0x46, 0x44, 0x44,
-  0x48, 0x4e, 0x5a, 0x6d, 0x7d, 0x87, 0x8c, 0x92, 0x95, 0x92, 0x90, 0x8f,
-  0x91, 0x95, 0x99, 0x9d, 0xa0, 0xa3, 0xa5, 0xa6, 0xa5, 0xa5, 0xa4, 0xa2,
-  0x9f, 0x9c, 0x9a, 0x96, 0x92, 0x90, 0x8f, 0x8e, 0x8c, 0x8a, 0x8b, 0x8b,
-  0x8b, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d,
-  0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8c,
-  0x8a, 0x89, 0x89, 0x86, 0x42, 0x45, 0x48, 0x4a, 0x4b, 0x4f, 0x53, 0x55,
-  0x56, 0x58, 0x5a, 0x5b, 0x5b, 0x5a, 0x59, 0x5a, 0x59, 0x5a, 0x5a, 0x5b,
-  0x5c, 0x5c, 0x5e, 0x5f, 0x5f, 0x5e, 0x60, 0x61, 0x61, 0x60, 0x61, 0x62,
-  0x61, 0x61, 0x61, 0x62, 0x63, 0x63, 0x62, 0x62, 0x63, 0x64, 0x63, 0x62,
-  0x60, 0x5f, 0x5d, 0x5b, 0x5a, 0x5b, 0x5d, 0x60, 0x61, 0x61, 0x60, 0x61,
-  0x61, 0x60, 0x5f, 0x5f, 0x62, 0x6f, 0x7d, 0x85, 0x8e, 0x99, 0xa2, 0xab,
-  0xb1, 0xb4, 0xb8, 0xba, 0xbb, 0xbd, 0xbe, 0xc1, 0xc3, 0xc4, 0xc7, 0xc8,
-  0xc7, 0xc6, 0xc9, 0xcc, 0xce, 0xcf, 0xcf, 0xd0, 0xd3, 0xd5, 0xd7, 0xd7,
-  0xd7, 0xd7, 0xd5, 0xd0, 0xca, 0xc2, 0xc2, 0xc4, 0xc7, 0xcb, 0xcd, 0xd0,
-  0xd1, 0xd2, 0xd1, 0xd1, 0xd2, 0xd5, 0xdc, 0xde, 0xd8, 0xca, 0xb8, 0x97,
-  0x85, 0x9b, 0xab, 0xaf, 0xac, 0xab, 0xaa, 0xac, 0xad, 0xad, 0xaf, 0xad,
-  0xac, 0xad, 0xac, 0xab, 0xa7, 0xa9, 0xae, 0xb1, 0xb3, 0xb1, 0xb5, 0xb9,
-  0xb9, 0xb5, 0xb2, 0xb3, 0xb3, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0xb0, 0xaf,
-  0xaf, 0xb0, 0xaf, 0xb0, 0xb0, 0xb0, 0xb2, 0xb3, 0xb3, 0xb3, 0xb4, 0xb5,
-  0xb7, 0xb8, 0xb9, 0xbb, 0xbd, 0xbe, 0xbd, 0xba, 0xb9, 0xb9, 0xb6, 0xb1,
-  0xa9, 0x9f, 0x9b, 0x98, 0x95, 0x90, 0x90, 0x96, 0x99, 0x99, 0x98, 0x92,
-  0x89, 0x84, 0x82, 0x81, 0x80, 0x7e, 0x7f, 0x7e, 0x7c, 0x76, 0x6d, 0x67,
-  0x62, 0x60, 0x61, 0x5f, 0x5c, 0x5b, 0x5b, 0x61, 0x6f, 0x7c, 0x84, 0x88,
-  0x8e, 0x93, 0x95, 0x92, 0x8c, 0x79, 0x5b, 0x44, 0x3a, 0x39, 0x39, 0x3a,
-  0x3f, 0x47, 0x50, 0x5d, 0x67, 0x66, 0x63, 0x64, 0x68, 0x6d, 0x70, 0x71,
-  0x71, 0x6f, 0x6b, 0x67, 0x63, 0x61, 0x5f, 0x5b, 0x55, 0x52, 0x51, 0x53,
-  0x58, 0x55, 0x50, 0x4b, 0x46, 0x40, 0x3d, 0x3d, 0x3f, 0x43, 0x50, 0x67,
-  0x7c, 0x89, 0x8f, 0x95, 0x98, 0x96, 0x93, 0x90, 0x8e, 0x8f, 0x93, 0x98,
-  0x9b, 0x9d, 0x9f, 0x9f, 0x9f, 0x9f, 0x9d, 0x9c, 0x9a, 0x98, 0x96, 0x93,
-  0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x88,
-  0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8d, 0x8d,
-  0x8f, 0x90, 0x90, 0x8f, 0x8f, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x88,
-  0x41, 0x46, 0x49, 0x4a, 0x4c, 0x4e, 0x53, 0x55, 0x56, 0x57, 0x5a, 0x5b,
-  0x5b, 0x5a, 0x59, 0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x5c, 0x5c, 0x5e, 0x5f,
-  0x5e, 0x5f, 0x61, 0x62, 0x61, 0x60, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61,
-  0x63, 0x64, 0x64, 0x64, 0x63, 0x63, 0x62, 0x61, 0x60, 0x5d, 0x5b, 0x5b,
-  0x5a, 0x5b, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x5f, 0x5f,
-  0x61, 0x6d, 0x7b, 0x84, 0x8d, 0x98, 0xa0, 0xa9, 0xaf, 0xb3, 0xb7, 0xb9,
-  0xbb, 0xbc, 0xbe, 0xc0, 0xc2, 0xc5, 0xc8, 0xc9, 0xc7, 0xc6, 0xc9, 0xce,
-  0xd0, 0xd1, 0xd0, 0xcf, 0xd2, 0xd4, 0xd6, 0xd7, 0xd7, 0xd8, 0xd8, 0xd5,
-  0xd0, 0xc6, 0xc0, 0xc0, 0xc4, 0xc8, 0xcd, 0xd1, 0xd5, 0xd6, 0xd4, 0xd0,
-  0xce, 0xd0, 0xd6, 0xdc, 0xdd, 0xdb, 0xd2, 0xb8, 0x95, 0x9d, 0xaf, 0xb3,
-  0xab, 0xa5, 0xa2, 0xa4, 0xa4, 0xa2, 0xa4, 0xa6, 0xa4, 0xa6, 0xa7, 0xa6,
-  0xa1, 0xa0, 0xa4, 0xa6, 0xa6, 0xa1, 0xae, 0xb7, 0xb8, 0xb3, 0xb2, 0xb2,
-  0xb2, 0xb0, 0xaf, 0xaf, 0xaf, 0xae, 0xad, 0xab, 0xab, 0xac, 0xac, 0xac,
-  0xab, 0xab, 0xad, 0xaf, 0xb0, 0xb1, 0xb1, 0xb3, 0xb5, 0xb7, 0xb8, 0xba,
-  0xbc, 0xbc, 0xba, 0xb7, 0xb4, 0xb5, 0xb1, 0xac, 0xa3, 0x9b, 0x9b, 0x98,
-  0x94, 0x8f, 0x90, 0x98, 0x9a, 0x9a, 0x98, 0x92, 0x8c, 0x87, 0x84, 0x80,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x75, 0x6d, 0x68, 0x64, 0x62, 0x60, 0x61,
-  0x65, 0x69, 0x6d, 0x75, 0x82, 0x8a, 0x8e, 0x91, 0x94, 0x99, 0x8f, 0x73,
-  0x5f, 0x48, 0x39, 0x35, 0x37, 0x39, 0x3c, 0x3e, 0x43, 0x4c, 0x53, 0x5e,
-  0x62, 0x61, 0x61, 0x63, 0x6b, 0x70, 0x73, 0x73, 0x72, 0x70, 0x6c, 0x66,
-  0x63, 0x61, 0x5e, 0x5b, 0x55, 0x52, 0x53, 0x55, 0x57, 0x53, 0x4e, 0x4a,
-  0x43, 0x3c, 0x3a, 0x38, 0x37, 0x3c, 0x4b, 0x64, 0x7c, 0x8a, 0x91, 0x96,
-  0x99, 0x97, 0x94, 0x91, 0x8d, 0x8c, 0x8e, 0x92, 0x95, 0x98, 0x9a, 0x9a,
-  0x9a, 0x99, 0x97, 0x96, 0x94, 0x92, 0x91, 0x8f, 0x8d, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x87, 0x87, 0x88, 0x89, 0x88, 0x88,
-  0x88, 0x89, 0x89, 0x89, 0x8b, 0x8c, 0x8c, 0x8b, 0x8c, 0x8e, 0x8e, 0x8f,
-  0x8f, 0x8f, 0x8e, 0x8f, 0x8f, 0x8e, 0x8d, 0x8a, 0x41, 0x46, 0x4a, 0x4b,
-  0x4c, 0x4e, 0x53, 0x55, 0x56, 0x57, 0x5a, 0x5b, 0x5b, 0x5b, 0x59, 0x5a,
-  0x59, 0x59, 0x5a, 0x5a, 0x5c, 0x5d, 0x5e, 0x5f, 0x5e, 0x5f, 0x61, 0x62,
-  0x62, 0x60, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61, 0x63, 0x64, 0x64, 0x64,
-  0x62, 0x62, 0x62, 0x62, 0x60, 0x5d, 0x5b, 0x5a, 0x5a, 0x5b, 0x5f, 0x61,
-  0x61, 0x61, 0x61, 0x60, 0x5f, 0x60, 0x5f, 0x5f, 0x60, 0x6b, 0x79, 0x82,
-  0x8c, 0x96, 0x9f, 0xa7, 0xad, 0xb1, 0xb6, 0xb8, 0xba, 0xbc, 0xbd, 0xc0,
-  0xc2, 0xc5, 0xc7, 0xc8, 0xc7, 0xc6, 0xca, 0xcf, 0xd1, 0xd1, 0xd0, 0xcf,
-  0xd2, 0xd4, 0xd5, 0xd6, 0xd6, 0xd8, 0xd8, 0xd6, 0xd2, 0xc9, 0xc1, 0xbf,
-  0xc1, 0xc7, 0xcc, 0xd2, 0xd5, 0xd8, 0xd7, 0xd1, 0xcf, 0xcf, 0xd3, 0xd9,
-  0xde, 0xe1, 0xdd, 0xca, 0xa7, 0xa3, 0xb2, 0xb7, 0xb5, 0xaf, 0xa7, 0xa5,
-  0xa2, 0x9c, 0x9a, 0x9e, 0x9c, 0x9f, 0xa0, 0xa1, 0x9d, 0x9b, 0x9c, 0x9d,
-  0x9d, 0x97, 0xa5, 0xb0, 0xb3, 0xb0, 0xaf, 0xb1, 0xb0, 0xae, 0xac, 0xac,
-  0xad, 0xac, 0xab, 0xa9, 0xa9, 0xaa, 0xaa, 0xaa, 0xa9, 0xa9, 0xaa, 0xac,
-  0xad, 0xae, 0xae, 0xb1, 0xb4, 0xb5, 0xb7, 0xb9, 0xbb, 0xba, 0xb8, 0xb5,
-  0xb2, 0xb1, 0xad, 0xa8, 0x9f, 0x98, 0x9a, 0x98, 0x94, 0x8e, 0x91, 0x99,
-  0x9c, 0x9b, 0x99, 0x94, 0x8e, 0x89, 0x86, 0x80, 0x7d, 0x7e, 0x7e, 0x7c,
-  0x79, 0x73, 0x6d, 0x69, 0x64, 0x62, 0x63, 0x69, 0x70, 0x75, 0x79, 0x81,
-  0x8b, 0x8f, 0x92, 0x94, 0x95, 0x90, 0x79, 0x58, 0x44, 0x34, 0x30, 0x35,
-  0x3a, 0x3b, 0x3e, 0x3f, 0x45, 0x4e, 0x56, 0x5f, 0x60, 0x5e, 0x61, 0x65,
-  0x6d, 0x73, 0x74, 0x72, 0x70, 0x6c, 0x69, 0x64, 0x62, 0x61, 0x5e, 0x5a,
-  0x55, 0x53, 0x54, 0x56, 0x57, 0x53, 0x4e, 0x4a, 0x43, 0x3c, 0x38, 0x35,
-  0x34, 0x3a, 0x4a, 0x64, 0x7c, 0x8b, 0x92, 0x97, 0x99, 0x97, 0x94, 0x92,
-  0x8d, 0x8a, 0x8a, 0x8e, 0x90, 0x93, 0x94, 0x95, 0x94, 0x94, 0x92, 0x90,
-  0x8e, 0x8c, 0x8b, 0x8b, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x88,
-  0x87, 0x85, 0x85, 0x85, 0x87, 0x87, 0x87, 0x86, 0x87, 0x87, 0x87, 0x88,
-  0x8a, 0x8b, 0x8b, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8e, 0x8f,
-  0x8f, 0x8e, 0x8d, 0x8a, 0x41, 0x47, 0x4a, 0x4b, 0x4c, 0x4f, 0x52, 0x54,
-  0x55, 0x58, 0x5a, 0x5b, 0x5b, 0x5b, 0x5a, 0x59, 0x59, 0x59, 0x5a, 0x5a,
-  0x5c, 0x5d, 0x5e, 0x5e, 0x5f, 0x5f, 0x61, 0x61, 0x61, 0x60, 0x61, 0x62,
-  0x61, 0x62, 0x62, 0x62, 0x63, 0x64, 0x64, 0x64, 0x62, 0x61, 0x62, 0x61,
-  0x5f, 0x5d, 0x5b, 0x5a, 0x5b, 0x5d, 0x5f, 0x61, 0x61, 0x61, 0x60, 0x5e,
-  0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x67, 0x76, 0x80, 0x8a, 0x95, 0x9d, 0xa4,
-  0xab, 0xaf, 0xb4, 0xb6, 0xb9, 0xbc, 0xbd, 0xbe, 0xc1, 0xc3, 0xc7, 0xc8,
-  0xc7, 0xc6, 0xcb, 0xd1, 0xd2, 0xd1, 0xcf, 0xd0, 0xd2, 0xd3, 0xd5, 0xd5,
-  0xd5, 0xd5, 0xd6, 0xd5, 0xd3, 0xcd, 0xc5, 0xc0, 0xbe, 0xc4, 0xcc, 0xd2,
-  0xd5, 0xd7, 0xda, 0xd7, 0xd4, 0xd2, 0xd1, 0xd7, 0xde, 0xe3, 0xe3, 0xd8,
-  0xbf, 0xb0, 0xb3, 0xb9, 0xc5, 0xc9, 0xbd, 0xb3, 0xad, 0xa1, 0x95, 0x97,
-  0x95, 0x94, 0x94, 0x98, 0x9a, 0x96, 0x94, 0x95, 0x95, 0x8f, 0x98, 0xa1,
-  0xa4, 0xa3, 0xa5, 0xa8, 0xa9, 0xa8, 0xa7, 0xa6, 0xa8, 0xa7, 0xa6, 0xa5,
-  0xa5, 0xa6, 0xa7, 0xa7, 0xa7, 0xa5, 0xa6, 0xa8, 0xa9, 0xa9, 0xaa, 0xae,
-  0xb2, 0xb4, 0xb6, 0xb8, 0xb9, 0xb7, 0xb6, 0xb4, 0xb1, 0xae, 0xa9, 0xa4,
-  0x9c, 0x95, 0x97, 0x96, 0x93, 0x90, 0x94, 0x9a, 0x9d, 0x9d, 0x9c, 0x98,
-  0x93, 0x8d, 0x88, 0x7f, 0x7b, 0x7d, 0x7c, 0x7a, 0x77, 0x72, 0x6b, 0x65,
-  0x63, 0x65, 0x6e, 0x7b, 0x82, 0x86, 0x88, 0x8c, 0x91, 0x94, 0x93, 0x91,
-  0x87, 0x6b, 0x47, 0x36, 0x32, 0x31, 0x32, 0x37, 0x3c, 0x3e, 0x3f, 0x41,
-  0x48, 0x52, 0x59, 0x5f, 0x5d, 0x5d, 0x63, 0x69, 0x70, 0x74, 0x71, 0x6b,
-  0x67, 0x63, 0x62, 0x61, 0x60, 0x5e, 0x5d, 0x59, 0x56, 0x55, 0x56, 0x58,
-  0x57, 0x53, 0x4f, 0x4c, 0x45, 0x3e, 0x3a, 0x37, 0x37, 0x3d, 0x4c, 0x66,
-  0x7e, 0x8c, 0x92, 0x97, 0x9a, 0x98, 0x95, 0x92, 0x8c, 0x87, 0x85, 0x87,
-  0x8a, 0x8c, 0x8a, 0x89, 0x89, 0x89, 0x87, 0x84, 0x82, 0x81, 0x80, 0x81,
-  0x81, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x84, 0x83, 0x82, 0x84,
-  0x86, 0x86, 0x85, 0x84, 0x86, 0x85, 0x85, 0x86, 0x88, 0x89, 0x89, 0x89,
-  0x8a, 0x8b, 0x8b, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8c, 0x8c, 0x8c, 0x8a,
-  0x40, 0x46, 0x49, 0x4b, 0x4c, 0x4e, 0x52, 0x54, 0x56, 0x58, 0x5b, 0x5b,
-  0x5a, 0x59, 0x59, 0x58, 0x58, 0x59, 0x5a, 0x59, 0x5b, 0x5d, 0x5d, 0x5e,
-  0x5f, 0x5e, 0x60, 0x5f, 0x5f, 0x5f, 0x60, 0x60, 0x62, 0x62, 0x62, 0x61,
-  0x63, 0x64, 0x64, 0x64, 0x62, 0x61, 0x61, 0x60, 0x5d, 0x5c, 0x5c, 0x5c,
-  0x5d, 0x5d, 0x5f, 0x5f, 0x60, 0x60, 0x5f, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e,
-  0x5e, 0x64, 0x72, 0x7d, 0x8a, 0x95, 0x9c, 0xa1, 0xa7, 0xab, 0xb0, 0xb4,
-  0xb7, 0xbb, 0xbc, 0xbd, 0xbf, 0xc3, 0xc5, 0xc6, 0xc6, 0xc6, 0xcc, 0xd1,
-  0xd2, 0xcf, 0xce, 0xd1, 0xd4, 0xd5, 0xd5, 0xd5, 0xd4, 0xd1, 0xd1, 0xd3,
-  0xd3, 0xd0, 0xc9, 0xc5, 0xbf, 0xc1, 0xc8, 0xce, 0xd2, 0xd6, 0xda, 0xdb,
-  0xd8, 0xd6, 0xd3, 0xd5, 0xdb, 0xde, 0xdf, 0xde, 0xd9, 0xc7, 0xb8, 0xb3,
-  0xb5, 0xc6, 0xd1, 0xd0, 0xce, 0xc8, 0xbf, 0xb8, 0xad, 0xa4, 0x9f, 0x9d,
-  0x9f, 0xa0, 0x9e, 0x9d, 0x9c, 0x99, 0x95, 0x96, 0x95, 0x91, 0x8f, 0x91,
-  0x95, 0x98, 0x9a, 0x99, 0x99, 0x97, 0x97, 0x96, 0x97, 0x98, 0x9c, 0x9e,
-  0x9e, 0x9e, 0xa1, 0xa3, 0xa3, 0xa4, 0xa6, 0xaa, 0xaf, 0xb2, 0xb6, 0xb7,
-  0xb8, 0xb6, 0xb5, 0xb3, 0xaf, 0xa9, 0xa4, 0xa0, 0x9a, 0x94, 0x96, 0x98,
-  0x98, 0x97, 0x99, 0x9e, 0xa1, 0xa2, 0xa0, 0x9c, 0x98, 0x91, 0x8b, 0x82,
-  0x7a, 0x79, 0x78, 0x77, 0x75, 0x6e, 0x67, 0x61, 0x68, 0x71, 0x7f, 0x8e,
-  0x93, 0x94, 0x95, 0x95, 0x95, 0x8d, 0x7b, 0x68, 0x4b, 0x34, 0x2f, 0x31,
-  0x33, 0x34, 0x35, 0x39, 0x3c, 0x3f, 0x40, 0x42, 0x4b, 0x57, 0x5c, 0x5e,
-  0x5c, 0x60, 0x6b, 0x70, 0x75, 0x73, 0x6b, 0x65, 0x61, 0x5d, 0x5d, 0x5e,
-  0x5f, 0x5e, 0x5d, 0x5a, 0x58, 0x58, 0x59, 0x59, 0x58, 0x54, 0x50, 0x4d,
-  0x4a, 0x47, 0x44, 0x42, 0x43, 0x47, 0x54, 0x6a, 0x80, 0x8e, 0x93, 0x98,
-  0x9a, 0x9a, 0x97, 0x94, 0x8f, 0x88, 0x81, 0x80, 0x80, 0x80, 0x7b, 0x75,
-  0x74, 0x74, 0x73, 0x70, 0x6f, 0x6e, 0x6f, 0x72, 0x75, 0x77, 0x79, 0x7a,
-  0x7a, 0x7b, 0x7c, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x84, 0x85, 0x84, 0x85, 0x86, 0x87, 0x87, 0x89, 0x89,
-  0x89, 0x8a, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x41, 0x44, 0x48, 0x4a,
-  0x4c, 0x4f, 0x53, 0x54, 0x55, 0x57, 0x59, 0x59, 0x58, 0x57, 0x57, 0x58,
-  0x58, 0x59, 0x59, 0x59, 0x5b, 0x5d, 0x5d, 0x5e, 0x5f, 0x5e, 0x5f, 0x60,
-  0x5f, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63,
-  0x62, 0x61, 0x61, 0x60, 0x5d, 0x5b, 0x5c, 0x5c, 0x5d, 0x5d, 0x5f, 0x5f,
-  0x5f, 0x5f, 0x60, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e, 0x5d, 0x60, 0x6d, 0x79,
-  0x89, 0x95, 0x9c, 0xa0, 0xa5, 0xa9, 0xad, 0xb2, 0xb7, 0xba, 0xbb, 0xbc,
-  0xbe, 0xc2, 0xc4, 0xc4, 0xc4, 0xc4, 0xcb, 0xcf, 0xd0, 0xd0, 0xd0, 0xd2,
-  0xd5, 0xd6, 0xd6, 0xd7, 0xd3, 0xcf, 0xcd, 0xce, 0xd0, 0xd2, 0xce, 0xca,
-  0xc5, 0xc4, 0xc3, 0xc8, 0xcd, 0xd4, 0xda, 0xdd, 0xdc, 0xdb, 0xd7, 0xd4,
-  0xd3, 0xd5, 0xd7, 0xda, 0xdd, 0xd6, 0xc8, 0xbd, 0xaf, 0xab, 0xc6, 0xd4,
-  0xd6, 0xd4, 0xd2, 0xce, 0xca, 0xc6, 0xc4, 0xc1, 0xbf, 0xbf, 0xbf, 0xbe,
-  0xbb, 0xb5, 0xab, 0xac, 0xaa, 0xa2, 0x95, 0x90, 0x94, 0x98, 0x9d, 0x9a,
-  0x92, 0x8c, 0x88, 0x84, 0x82, 0x82, 0x85, 0x87, 0x8c, 0x92, 0x97, 0x9b,
-  0x9c, 0x9e, 0xa2, 0xa6, 0xaa, 0xad, 0xb3, 0xb5, 0xb6, 0xb5, 0xb4, 0xb2,
-  0xab, 0xa4, 0xa0, 0x9e, 0x9b, 0x98, 0x99, 0x9c, 0x9d, 0x9e, 0x9e, 0xa1,
-  0xa4, 0xa4, 0xa2, 0x9d, 0x98, 0x91, 0x8c, 0x83, 0x7b, 0x75, 0x72, 0x71,
-  0x6e, 0x69, 0x67, 0x6a, 0x79, 0x84, 0x90, 0x99, 0x9a, 0x9a, 0x98, 0x92,
-  0x7f, 0x5a, 0x3a, 0x2d, 0x27, 0x28, 0x2f, 0x34, 0x35, 0x36, 0x37, 0x3a,
-  0x3e, 0x40, 0x42, 0x47, 0x51, 0x5c, 0x5f, 0x5e, 0x5d, 0x69, 0x76, 0x79,
-  0x76, 0x70, 0x67, 0x60, 0x5c, 0x59, 0x5a, 0x5c, 0x5d, 0x5c, 0x5a, 0x59,
-  0x58, 0x59, 0x5a, 0x5b, 0x59, 0x54, 0x51, 0x50, 0x50, 0x52, 0x51, 0x51,
-  0x52, 0x56, 0x5f, 0x70, 0x83, 0x8f, 0x94, 0x98, 0x9a, 0x9c, 0x9a, 0x98,
-  0x93, 0x8d, 0x83, 0x7d, 0x7a, 0x75, 0x6b, 0x62, 0x5f, 0x5f, 0x60, 0x5e,
-  0x5e, 0x5e, 0x5f, 0x63, 0x66, 0x68, 0x6b, 0x6b, 0x6c, 0x6e, 0x70, 0x74,
-  0x76, 0x78, 0x7b, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x81, 0x83, 0x84, 0x85, 0x84, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8a,
-  0x8a, 0x8a, 0x88, 0x87, 0x40, 0x43, 0x47, 0x49, 0x4b, 0x50, 0x53, 0x54,
-  0x54, 0x56, 0x58, 0x58, 0x57, 0x57, 0x56, 0x58, 0x59, 0x58, 0x59, 0x58,
-  0x5a, 0x5c, 0x5d, 0x5d, 0x5e, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x61,
-  0x61, 0x61, 0x62, 0x62, 0x63, 0x64, 0x64, 0x62, 0x63, 0x62, 0x61, 0x60,
-  0x5d, 0x5c, 0x5c, 0x5c, 0x5d, 0x5d, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x5e,
-  0x5f, 0x5e, 0x5e, 0x5e, 0x5c, 0x5f, 0x6b, 0x76, 0x88, 0x95, 0x9b, 0x9f,
-  0xa3, 0xa6, 0xac, 0xb2, 0xb7, 0xb9, 0xba, 0xbb, 0xbe, 0xc0, 0xc1, 0xc1,
-  0xc1, 0xc3, 0xcb, 0xce, 0xcf, 0xcf, 0xd1, 0xd4, 0xd6, 0xd6, 0xd7, 0xd8,
-  0xd4, 0xcf, 0xcc, 0xcb, 0xce, 0xd0, 0xd0, 0xcf, 0xcc, 0xc7, 0xc2, 0xc2,
-  0xc6, 0xd0, 0xda, 0xde, 0xde, 0xdd, 0xd9, 0xd4, 0xce, 0xd1, 0xd4, 0xd7,
-  0xdb, 0xdd, 0xd3, 0xc8, 0xb6, 0xa5, 0xb3, 0xcc, 0xd5, 0xd2, 0xd0, 0xd0,
-  0xd0, 0xd0, 0xcf, 0xcf, 0xcd, 0xcc, 0xcc, 0xcc, 0xcb, 0xc5, 0xb9, 0xc2,
-  0xc5, 0xc1, 0xb6, 0xb0, 0xb1, 0xb4, 0xb5, 0xb0, 0xa5, 0x9d, 0x97, 0x8d,
-  0x85, 0x7f, 0x7f, 0x80, 0x83, 0x8b, 0x90, 0x92, 0x93, 0x94, 0x99, 0x9e,
-  0xa3, 0xa7, 0xac, 0xaf, 0xb0, 0xb2, 0xb2, 0xb0, 0xa8, 0xa0, 0x9d, 0x9c,
-  0x9c, 0x9b, 0x9c, 0x9f, 0x9f, 0xa0, 0xa0, 0xa1, 0xa2, 0xa2, 0xa0, 0x9c,
-  0x96, 0x8f, 0x89, 0x83, 0x7b, 0x74, 0x6e, 0x6b, 0x6a, 0x69, 0x71, 0x7e,
-  0x8c, 0x93, 0x99, 0x9d, 0x9a, 0x93, 0x8a, 0x76, 0x51, 0x30, 0x22, 0x20,
-  0x24, 0x2a, 0x31, 0x35, 0x36, 0x37, 0x39, 0x3b, 0x3e, 0x3f, 0x42, 0x49,
-  0x56, 0x5e, 0x5f, 0x5c, 0x5f, 0x74, 0x7f, 0x7e, 0x75, 0x6b, 0x64, 0x5d,
-  0x59, 0x58, 0x5a, 0x5c, 0x5d, 0x5c, 0x5a, 0x58, 0x59, 0x5a, 0x5c, 0x5c,
-  0x5a, 0x55, 0x53, 0x53, 0x56, 0x5b, 0x5c, 0x5c, 0x5d, 0x5f, 0x67, 0x74,
-  0x86, 0x91, 0x96, 0x99, 0x9b, 0x9c, 0x9b, 0x9a, 0x96, 0x90, 0x87, 0x80,
-  0x7b, 0x73, 0x66, 0x59, 0x55, 0x54, 0x55, 0x55, 0x55, 0x56, 0x57, 0x59,
-  0x5b, 0x5e, 0x60, 0x60, 0x61, 0x63, 0x67, 0x6c, 0x6f, 0x73, 0x78, 0x7b,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x85,
-  0x40, 0x43, 0x47, 0x49, 0x4b, 0x4f, 0x53, 0x54, 0x55, 0x56, 0x58, 0x58,
-  0x58, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x58, 0x5a, 0x5b, 0x5c, 0x5d,
-  0x5d, 0x5e, 0x5e, 0x5f, 0x60, 0x5f, 0x61, 0x62, 0x61, 0x61, 0x62, 0x61,
-  0x62, 0x64, 0x64, 0x62, 0x63, 0x62, 0x61, 0x60, 0x5e, 0x5c, 0x5b, 0x5c,
-  0x5d, 0x5e, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5e, 0x5f, 0x5e, 0x5e, 0x5e,
-  0x5c, 0x5f, 0x6a, 0x75, 0x87, 0x94, 0x9b, 0x9f, 0xa2, 0xa5, 0xab, 0xb1,
-  0xb6, 0xb9, 0xba, 0xbb, 0xbd, 0xbf, 0xc0, 0xbf, 0xbf, 0xc3, 0xca, 0xcd,
-  0xce, 0xce, 0xd1, 0xd3, 0xd5, 0xd7, 0xd7, 0xd7, 0xd3, 0xcf, 0xcc, 0xcb,
-  0xcc, 0xcf, 0xd0, 0xd0, 0xcf, 0xc9, 0xc5, 0xc1, 0xc3, 0xcb, 0xd8, 0xdf,
-  0xe0, 0xde, 0xda, 0xd6, 0xce, 0xd1, 0xd4, 0xd6, 0xda, 0xdf, 0xd8, 0xce,
-  0xbe, 0xaa, 0xaa, 0xc3, 0xcf, 0xd0, 0xcf, 0xcf, 0xd0, 0xd0, 0xd0, 0xd0,
-  0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xcc, 0xc2, 0xcc, 0xd0, 0xce, 0xc8, 0xc2,
-  0xc3, 0xc4, 0xc4, 0xbf, 0xb6, 0xad, 0xa8, 0x9d, 0x93, 0x8c, 0x8a, 0x89,
-  0x89, 0x8e, 0x90, 0x90, 0x8f, 0x8f, 0x94, 0x9a, 0x9f, 0xa2, 0xa6, 0xa9,
-  0xab, 0xad, 0xae, 0xac, 0xa4, 0x9d, 0x9c, 0x9b, 0x9b, 0x9c, 0x9e, 0x9e,
-  0x9f, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0x9e, 0x9a, 0x94, 0x8c, 0x87, 0x81,
-  0x78, 0x71, 0x6d, 0x6c, 0x6d, 0x6f, 0x7b, 0x8a, 0x96, 0x9a, 0x9c, 0x97,
-  0x8b, 0x7f, 0x74, 0x5e, 0x3b, 0x22, 0x1e, 0x21, 0x27, 0x2b, 0x31, 0x35,
-  0x37, 0x39, 0x3b, 0x3d, 0x3f, 0x40, 0x43, 0x4b, 0x57, 0x5e, 0x5e, 0x5b,
-  0x63, 0x7d, 0x85, 0x81, 0x74, 0x69, 0x62, 0x5b, 0x58, 0x59, 0x5c, 0x5d,
-  0x5e, 0x5d, 0x5b, 0x59, 0x59, 0x5b, 0x5c, 0x5d, 0x5a, 0x58, 0x57, 0x57,
-  0x5c, 0x62, 0x63, 0x62, 0x63, 0x65, 0x6b, 0x78, 0x88, 0x92, 0x96, 0x99,
-  0x9a, 0x9b, 0x9b, 0x9a, 0x97, 0x91, 0x89, 0x81, 0x7c, 0x74, 0x66, 0x57,
-  0x52, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x55, 0x56, 0x59, 0x5b, 0x5b,
-  0x5b, 0x5d, 0x61, 0x67, 0x6a, 0x70, 0x77, 0x7a, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x82, 0x83,
-  0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x85, 0x84, 0x41, 0x43, 0x47, 0x48,
-  0x4b, 0x50, 0x53, 0x54, 0x55, 0x56, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59,
-  0x59, 0x58, 0x58, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x5d, 0x5e, 0x5e, 0x5f,
-  0x60, 0x5f, 0x61, 0x62, 0x61, 0x61, 0x61, 0x61, 0x62, 0x63, 0x64, 0x63,
-  0x63, 0x61, 0x61, 0x60, 0x5f, 0x5e, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x60,
-  0x60, 0x60, 0x60, 0x5f, 0x5d, 0x5d, 0x5e, 0x5e, 0x5c, 0x5f, 0x68, 0x72,
-  0x85, 0x93, 0x9c, 0x9f, 0xa1, 0xa3, 0xa8, 0xb0, 0xb6, 0xb9, 0xbb, 0xbb,
-  0xbc, 0xbd, 0xbe, 0xbe, 0xbe, 0xc1, 0xc8, 0xc9, 0xcb, 0xcd, 0xd0, 0xd2,
-  0xd4, 0xd5, 0xd6, 0xd5, 0xd2, 0xcf, 0xcd, 0xcc, 0xcc, 0xcc, 0xcf, 0xd0,
-  0xce, 0xcd, 0xcb, 0xc5, 0xc2, 0xc4, 0xd1, 0xde, 0xdf, 0xde, 0xdc, 0xdb,
-  0xd5, 0xd3, 0xd3, 0xd4, 0xd6, 0xdc, 0xd9, 0xd4, 0xc9, 0xb7, 0xa8, 0xb2,
-  0xbd, 0xca, 0xd0, 0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xcf, 0xd0, 0xd1, 0xd1,
-  0xd1, 0xd0, 0xcf, 0xd1, 0xd2, 0xd2, 0xd1, 0xcf, 0xce, 0xce, 0xce, 0xcb,
-  0xc7, 0xc3, 0xbf, 0xb8, 0xb2, 0xac, 0xaa, 0xa7, 0xa3, 0x9f, 0x9a, 0x96,
-  0x93, 0x90, 0x94, 0x99, 0x9b, 0x9c, 0x9f, 0xa1, 0xa2, 0xa5, 0xa6, 0xa5,
-  0x9f, 0x9a, 0x99, 0x99, 0x99, 0x9b, 0x9b, 0x9c, 0x9c, 0x9e, 0x9e, 0x9c,
-  0x9b, 0x99, 0x98, 0x95, 0x8e, 0x88, 0x83, 0x7d, 0x73, 0x6f, 0x71, 0x76,
-  0x7a, 0x80, 0x8c, 0x96, 0x9b, 0x9a, 0x92, 0x7d, 0x64, 0x55, 0x4d, 0x43,
-  0x30, 0x23, 0x22, 0x25, 0x29, 0x2e, 0x33, 0x37, 0x39, 0x3b, 0x3d, 0x40,
-  0x41, 0x42, 0x45, 0x4f, 0x5a, 0x5d, 0x5c, 0x5b, 0x6d, 0x88, 0x8b, 0x83,
-  0x72, 0x66, 0x60, 0x5b, 0x5a, 0x5d, 0x60, 0x61, 0x5f, 0x5e, 0x5c, 0x5a,
-  0x5a, 0x5c, 0x5d, 0x5e, 0x5d, 0x5c, 0x5d, 0x5f, 0x65, 0x6b, 0x6d, 0x6c,
-  0x6c, 0x6d, 0x73, 0x7e, 0x8a, 0x92, 0x95, 0x98, 0x99, 0x9a, 0x9a, 0x99,
-  0x96, 0x91, 0x89, 0x83, 0x7e, 0x76, 0x6a, 0x5a, 0x55, 0x53, 0x54, 0x54,
-  0x54, 0x55, 0x55, 0x54, 0x55, 0x57, 0x57, 0x57, 0x57, 0x57, 0x59, 0x5e,
-  0x64, 0x6d, 0x76, 0x7a, 0x7b, 0x7c, 0x7b, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x81, 0x82, 0x83,
-  0x84, 0x84, 0x83, 0x83, 0x42, 0x44, 0x47, 0x49, 0x4b, 0x50, 0x53, 0x54,
-  0x54, 0x55, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x58, 0x58, 0x5a,
-  0x59, 0x59, 0x5a, 0x5b, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x5f, 0x61, 0x62,
-  0x61, 0x61, 0x62, 0x61, 0x62, 0x64, 0x64, 0x62, 0x63, 0x61, 0x60, 0x60,
-  0x5f, 0x5e, 0x5d, 0x5e, 0x5e, 0x5e, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x60,
-  0x5d, 0x5e, 0x5f, 0x5f, 0x5f, 0x61, 0x65, 0x6e, 0x82, 0x93, 0x9c, 0x9f,
-  0x9f, 0xa1, 0xa7, 0xaf, 0xb6, 0xba, 0xbb, 0xbb, 0xba, 0xbb, 0xbb, 0xbb,
-  0xbc, 0xbf, 0xc4, 0xc6, 0xc7, 0xca, 0xce, 0xcf, 0xd1, 0xd3, 0xd4, 0xd4,
-  0xd0, 0xcf, 0xce, 0xcc, 0xcb, 0xca, 0xcd, 0xcd, 0xca, 0xcb, 0xcc, 0xca,
-  0xc8, 0xc4, 0xc8, 0xd5, 0xde, 0xe1, 0xe0, 0xdf, 0xdb, 0xd6, 0xd2, 0xcd,
-  0xcd, 0xd6, 0xd9, 0xd5, 0xc9, 0xb4, 0x9c, 0x8f, 0x91, 0xa3, 0xb5, 0xbe,
-  0xc2, 0xc6, 0xc8, 0xc9, 0xcb, 0xcc, 0xcd, 0xcf, 0xd0, 0xd2, 0xd2, 0xd2,
-  0xd2, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xd2, 0xd2, 0xd0, 0xce, 0xce, 0xcc,
-  0xca, 0xc8, 0xc6, 0xc3, 0xbd, 0xb6, 0xb0, 0xac, 0xa8, 0xa4, 0xa4, 0xa6,
-  0xa5, 0xa3, 0xa0, 0x9f, 0x9d, 0x9c, 0x9c, 0x9b, 0x97, 0x95, 0x95, 0x95,
-  0x95, 0x96, 0x96, 0x95, 0x95, 0x96, 0x95, 0x91, 0x8e, 0x8e, 0x8f, 0x8d,
-  0x89, 0x84, 0x80, 0x7b, 0x77, 0x7a, 0x83, 0x8a, 0x8f, 0x95, 0x9b, 0x97,
-  0x8a, 0x7e, 0x69, 0x53, 0x49, 0x46, 0x44, 0x3d, 0x2c, 0x24, 0x26, 0x29,
-  0x2e, 0x31, 0x35, 0x3a, 0x3c, 0x3f, 0x41, 0x43, 0x44, 0x45, 0x48, 0x54,
-  0x5e, 0x5e, 0x5c, 0x5f, 0x7d, 0x90, 0x8b, 0x80, 0x6e, 0x65, 0x60, 0x5d,
-  0x5e, 0x62, 0x66, 0x65, 0x63, 0x60, 0x5e, 0x5c, 0x5c, 0x5d, 0x5e, 0x5f,
-  0x60, 0x62, 0x64, 0x67, 0x6e, 0x75, 0x77, 0x75, 0x75, 0x75, 0x79, 0x81,
-  0x8d, 0x93, 0x95, 0x97, 0x97, 0x98, 0x98, 0x98, 0x95, 0x90, 0x88, 0x81,
-  0x7d, 0x77, 0x70, 0x64, 0x5e, 0x5b, 0x59, 0x58, 0x57, 0x57, 0x57, 0x57,
-  0x58, 0x58, 0x57, 0x57, 0x57, 0x55, 0x55, 0x5c, 0x63, 0x6e, 0x79, 0x7e,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x85,
-  0x44, 0x45, 0x47, 0x49, 0x4c, 0x51, 0x51, 0x53, 0x53, 0x55, 0x58, 0x58,
-  0x58, 0x58, 0x59, 0x59, 0x59, 0x58, 0x58, 0x59, 0x59, 0x59, 0x5b, 0x5c,
-  0x5d, 0x5c, 0x5f, 0x61, 0x60, 0x5f, 0x5f, 0x61, 0x61, 0x62, 0x62, 0x62,
-  0x62, 0x63, 0x64, 0x62, 0x63, 0x61, 0x60, 0x60, 0x5e, 0x5d, 0x5e, 0x5e,
-  0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x5f, 0x60, 0x61, 0x60, 0x61, 0x61, 0x5f,
-  0x60, 0x62, 0x65, 0x6d, 0x80, 0x91, 0x9a, 0x9f, 0x9f, 0xa0, 0xa5, 0xad,
-  0xb4, 0xb9, 0xbb, 0xba, 0xb8, 0xb8, 0xba, 0xb9, 0xb8, 0xbc, 0xc2, 0xc3,
-  0xc4, 0xc5, 0xc9, 0xcb, 0xcd, 0xcf, 0xd0, 0xd1, 0xce, 0xcd, 0xcd, 0xcc,
-  0xca, 0xc8, 0xcb, 0xcb, 0xc8, 0xc7, 0xc9, 0xcb, 0xcb, 0xc9, 0xcb, 0xcf,
-  0xd5, 0xda, 0xde, 0xda, 0xd2, 0xcb, 0xc9, 0xcb, 0xce, 0xca, 0xce, 0xc9,
-  0xb2, 0x8e, 0x74, 0x67, 0x60, 0x5b, 0x65, 0x73, 0x7d, 0x89, 0x90, 0x96,
-  0x99, 0x9e, 0xa5, 0xab, 0xb1, 0xb8, 0xba, 0xbb, 0xbc, 0xbe, 0xc1, 0xc4,
-  0xc5, 0xc7, 0xcb, 0xcf, 0xd0, 0xd1, 0xd1, 0xd2, 0xd2, 0xd0, 0xd0, 0xcf,
-  0xcb, 0xc8, 0xc7, 0xc5, 0xc3, 0xc0, 0xbf, 0xbd, 0xbc, 0xb9, 0xb3, 0xae,
-  0xa7, 0xa0, 0x9c, 0x98, 0x94, 0x93, 0x92, 0x91, 0x91, 0x90, 0x8d, 0x8c,
-  0x8c, 0x8d, 0x8d, 0x8b, 0x8b, 0x8c, 0x8f, 0x8f, 0x8d, 0x8b, 0x8a, 0x8a,
-  0x89, 0x90, 0x98, 0x9c, 0x9d, 0x9d, 0x90, 0x70, 0x52, 0x46, 0x44, 0x4d,
-  0x50, 0x4c, 0x47, 0x3c, 0x2a, 0x25, 0x2b, 0x2e, 0x31, 0x34, 0x38, 0x3c,
-  0x3e, 0x41, 0x45, 0x45, 0x45, 0x47, 0x4c, 0x58, 0x5d, 0x5b, 0x5c, 0x66,
-  0x86, 0x90, 0x82, 0x77, 0x6b, 0x66, 0x62, 0x61, 0x63, 0x67, 0x6a, 0x68,
-  0x65, 0x63, 0x60, 0x5d, 0x5c, 0x5f, 0x60, 0x62, 0x64, 0x67, 0x6b, 0x70,
-  0x77, 0x7c, 0x7e, 0x7d, 0x7a, 0x79, 0x7a, 0x81, 0x8b, 0x92, 0x94, 0x94,
-  0x94, 0x94, 0x95, 0x95, 0x93, 0x8d, 0x86, 0x80, 0x7c, 0x78, 0x76, 0x6f,
-  0x69, 0x67, 0x64, 0x5f, 0x5c, 0x5a, 0x5a, 0x5b, 0x5a, 0x5a, 0x59, 0x58,
-  0x57, 0x56, 0x59, 0x61, 0x68, 0x73, 0x7f, 0x86, 0x87, 0x87, 0x87, 0x88,
-  0x87, 0x87, 0x88, 0x89, 0x89, 0x88, 0x87, 0x87, 0x87, 0x88, 0x87, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x87, 0x88, 0x8b, 0x8d, 0x46, 0x46, 0x47, 0x49,
-  0x4c, 0x50, 0x51, 0x52, 0x53, 0x56, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59,
-  0x59, 0x58, 0x58, 0x59, 0x59, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5f, 0x61,
-  0x61, 0x5f, 0x60, 0x62, 0x63, 0x63, 0x62, 0x62, 0x62, 0x64, 0x64, 0x63,
-  0x63, 0x61, 0x61, 0x61, 0x5f, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x60, 0x5f,
-  0x5f, 0x5f, 0x5f, 0x60, 0x61, 0x63, 0x62, 0x61, 0x62, 0x64, 0x67, 0x6e,
-  0x7e, 0x90, 0x98, 0x9e, 0x9e, 0x9f, 0xa3, 0xab, 0xb4, 0xb9, 0xba, 0xb9,
-  0xb8, 0xb8, 0xb9, 0xb9, 0xb7, 0xb9, 0xbe, 0xc0, 0xc0, 0xbe, 0xc2, 0xc7,
-  0xc9, 0xcb, 0xcd, 0xce, 0xcc, 0xcc, 0xcb, 0xc9, 0xc8, 0xc6, 0xc8, 0xca,
-  0xcd, 0xd2, 0xd2, 0xcb, 0xc6, 0xc4, 0xcc, 0xd0, 0xd1, 0xd0, 0xce, 0xc8,
-  0xc5, 0xc6, 0xcb, 0xd5, 0xd3, 0xb8, 0xb3, 0xb0, 0x9c, 0x74, 0x5b, 0x4f,
-  0x4a, 0x4d, 0x5e, 0x59, 0x46, 0x42, 0x42, 0x42, 0x41, 0x47, 0x51, 0x58,
-  0x63, 0x71, 0x79, 0x7e, 0x82, 0x88, 0x95, 0xa1, 0xaa, 0xaf, 0xb7, 0xc2,
-  0xcb, 0xd0, 0xd1, 0xd3, 0xd2, 0xd0, 0xd1, 0xd2, 0xd1, 0xd0, 0xd1, 0xd0,
-  0xcf, 0xcd, 0xcd, 0xcc, 0xca, 0xc8, 0xc4, 0xbf, 0xb7, 0xae, 0xa9, 0xa1,
-  0x9c, 0x98, 0x93, 0x90, 0x8f, 0x8c, 0x8b, 0x8b, 0x8c, 0x90, 0x93, 0x95,
-  0x96, 0x97, 0x99, 0x99, 0x97, 0x96, 0x96, 0x97, 0x98, 0x9c, 0x9f, 0x9d,
-  0x98, 0x8c, 0x6e, 0x46, 0x2f, 0x2b, 0x38, 0x50, 0x58, 0x50, 0x48, 0x39,
-  0x28, 0x28, 0x2e, 0x32, 0x34, 0x36, 0x3a, 0x3e, 0x40, 0x44, 0x47, 0x46,
-  0x46, 0x48, 0x4f, 0x59, 0x5b, 0x58, 0x5b, 0x6a, 0x87, 0x8c, 0x7a, 0x70,
-  0x6a, 0x68, 0x65, 0x66, 0x68, 0x6b, 0x6c, 0x68, 0x65, 0x63, 0x60, 0x5e,
-  0x5d, 0x60, 0x61, 0x63, 0x67, 0x6b, 0x71, 0x75, 0x7a, 0x7f, 0x82, 0x81,
-  0x7d, 0x7b, 0x7a, 0x7d, 0x86, 0x8e, 0x92, 0x92, 0x92, 0x91, 0x92, 0x92,
-  0x90, 0x8a, 0x85, 0x80, 0x7d, 0x7b, 0x7a, 0x77, 0x74, 0x72, 0x70, 0x6a,
-  0x63, 0x5f, 0x5d, 0x5c, 0x5c, 0x5c, 0x5a, 0x59, 0x57, 0x58, 0x5e, 0x68,
-  0x6e, 0x7a, 0x86, 0x8d, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x90, 0x8f,
-  0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d,
-  0x8e, 0x8f, 0x90, 0x92, 0x48, 0x46, 0x48, 0x49, 0x4c, 0x4f, 0x51, 0x52,
-  0x54, 0x57, 0x59, 0x58, 0x58, 0x58, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59,
-  0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5f, 0x60, 0x60, 0x60, 0x61, 0x63,
-  0x63, 0x63, 0x62, 0x61, 0x62, 0x64, 0x64, 0x63, 0x63, 0x62, 0x61, 0x61,
-  0x60, 0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x60, 0x61,
-  0x62, 0x63, 0x63, 0x63, 0x64, 0x67, 0x6a, 0x6f, 0x7d, 0x8f, 0x98, 0x9d,
-  0x9e, 0x9f, 0xa2, 0xaa, 0xb2, 0xb8, 0xb9, 0xb8, 0xb7, 0xb8, 0xba, 0xba,
-  0xb6, 0xb7, 0xbb, 0xbe, 0xbd, 0xba, 0xbe, 0xc5, 0xc7, 0xc9, 0xcc, 0xce,
-  0xcc, 0xcc, 0xcc, 0xca, 0xc7, 0xc5, 0xc8, 0xcb, 0xd1, 0xd8, 0xcf, 0xbf,
-  0xb9, 0xbd, 0xca, 0xd0, 0xcf, 0xcd, 0xc8, 0xc1, 0xc1, 0xc6, 0xcd, 0xd9,
-  0xd3, 0xab, 0xa7, 0xa6, 0x9a, 0x81, 0x70, 0x64, 0x61, 0x67, 0x73, 0x65,
-  0x4a, 0x3c, 0x35, 0x2a, 0x20, 0x24, 0x2d, 0x33, 0x3b, 0x48, 0x50, 0x55,
-  0x59, 0x5f, 0x6c, 0x78, 0x82, 0x88, 0x91, 0xa2, 0xb4, 0xbf, 0xc4, 0xc9,
-  0xcd, 0xcc, 0xcf, 0xd1, 0xd2, 0xd2, 0xd3, 0xd2, 0xd2, 0xd1, 0xd1, 0xd0,
-  0xd0, 0xcf, 0xcc, 0xc8, 0xc0, 0xb8, 0xb3, 0xab, 0xa6, 0xa1, 0x9a, 0x96,
-  0x93, 0x8f, 0x8f, 0x91, 0x93, 0x97, 0x9b, 0x9d, 0x9e, 0x9f, 0xa0, 0x9e,
-  0x9c, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x97, 0x8f, 0x87, 0x77, 0x59, 0x37,
-  0x27, 0x27, 0x36, 0x51, 0x59, 0x50, 0x46, 0x36, 0x27, 0x2b, 0x30, 0x33,
-  0x36, 0x38, 0x3c, 0x40, 0x42, 0x45, 0x48, 0x47, 0x48, 0x4a, 0x52, 0x5a,
-  0x59, 0x56, 0x5a, 0x6c, 0x86, 0x86, 0x74, 0x6c, 0x6a, 0x69, 0x67, 0x69,
-  0x6b, 0x6d, 0x6c, 0x67, 0x64, 0x61, 0x60, 0x5d, 0x5d, 0x60, 0x61, 0x64,
-  0x69, 0x6e, 0x74, 0x78, 0x7c, 0x81, 0x82, 0x82, 0x7d, 0x7b, 0x79, 0x7b,
-  0x81, 0x8a, 0x8e, 0x91, 0x91, 0x8f, 0x90, 0x8f, 0x8e, 0x89, 0x84, 0x80,
-  0x7e, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x73, 0x6a, 0x65, 0x62, 0x5f,
-  0x5f, 0x5e, 0x5d, 0x5b, 0x5a, 0x5b, 0x62, 0x6c, 0x73, 0x7d, 0x8a, 0x92,
-  0x93, 0x94, 0x93, 0x93, 0x94, 0x95, 0x95, 0x95, 0x94, 0x95, 0x95, 0x95,
-  0x95, 0x96, 0x95, 0x94, 0x94, 0x93, 0x93, 0x92, 0x93, 0x94, 0x95, 0x96,
-  0x49, 0x47, 0x47, 0x48, 0x4a, 0x4f, 0x51, 0x54, 0x56, 0x58, 0x5a, 0x5a,
-  0x59, 0x58, 0x59, 0x58, 0x59, 0x59, 0x59, 0x59, 0x57, 0x58, 0x59, 0x5a,
-  0x5b, 0x5d, 0x5f, 0x60, 0x60, 0x61, 0x62, 0x63, 0x63, 0x62, 0x61, 0x61,
-  0x62, 0x64, 0x64, 0x64, 0x64, 0x62, 0x62, 0x61, 0x60, 0x5e, 0x5e, 0x60,
-  0x60, 0x5f, 0x60, 0x61, 0x62, 0x62, 0x61, 0x62, 0x64, 0x65, 0x65, 0x66,
-  0x69, 0x6c, 0x6f, 0x72, 0x7c, 0x8d, 0x97, 0x9d, 0x9e, 0x9f, 0xa1, 0xa8,
-  0xb1, 0xb7, 0xb8, 0xb6, 0xb5, 0xb6, 0xb9, 0xb8, 0xb4, 0xb4, 0xb8, 0xba,
-  0xb8, 0xb4, 0xbb, 0xc4, 0xc7, 0xc9, 0xcd, 0xd0, 0xd1, 0xd1, 0xd0, 0xcd,
-  0xc9, 0xc6, 0xc9, 0xce, 0xd6, 0xd7, 0xbe, 0xa7, 0xa5, 0xb5, 0xc7, 0xca,
-  0xcd, 0xcd, 0xc8, 0xc2, 0xc6, 0xca, 0xcf, 0xd5, 0xc7, 0x9b, 0xa0, 0xa5,
-  0xa4, 0xaf, 0xb1, 0xa9, 0xa5, 0xa5, 0x9b, 0x8b, 0x7c, 0x6f, 0x62, 0x4a,
-  0x33, 0x29, 0x28, 0x28, 0x29, 0x2d, 0x2f, 0x31, 0x32, 0x31, 0x34, 0x38,
-  0x3e, 0x42, 0x48, 0x5c, 0x77, 0x8c, 0x98, 0xa5, 0xb2, 0xb9, 0xc1, 0xc6,
-  0xcb, 0xce, 0xcf, 0xcf, 0xcf, 0xd0, 0xd1, 0xd1, 0xd0, 0xcf, 0xce, 0xcd,
-  0xc7, 0xc3, 0xbf, 0xba, 0xb6, 0xb1, 0xaa, 0xa5, 0xa0, 0x9d, 0x9e, 0xa0,
-  0xa3, 0xa5, 0xa7, 0xa6, 0xa6, 0xa6, 0xa5, 0xa1, 0x9e, 0x9c, 0x9b, 0x9a,
-  0x95, 0x8a, 0x77, 0x69, 0x61, 0x57, 0x48, 0x3b, 0x32, 0x30, 0x36, 0x4d,
-  0x57, 0x4e, 0x43, 0x32, 0x28, 0x2e, 0x34, 0x35, 0x37, 0x3b, 0x3e, 0x42,
-  0x44, 0x47, 0x49, 0x49, 0x4b, 0x4f, 0x56, 0x5b, 0x57, 0x53, 0x58, 0x6c,
-  0x7f, 0x7b, 0x6d, 0x69, 0x6c, 0x6b, 0x6a, 0x6c, 0x6e, 0x6e, 0x6a, 0x64,
-  0x61, 0x60, 0x5e, 0x5c, 0x5d, 0x5f, 0x61, 0x65, 0x6b, 0x72, 0x79, 0x7c,
-  0x7f, 0x82, 0x82, 0x81, 0x7d, 0x7a, 0x76, 0x75, 0x7a, 0x83, 0x88, 0x8d,
-  0x8e, 0x8d, 0x8c, 0x8d, 0x8c, 0x88, 0x82, 0x80, 0x7f, 0x7f, 0x81, 0x82,
-  0x83, 0x84, 0x84, 0x7f, 0x77, 0x71, 0x6d, 0x68, 0x65, 0x63, 0x62, 0x62,
-  0x60, 0x62, 0x69, 0x72, 0x78, 0x82, 0x8d, 0x96, 0x99, 0x9a, 0x9a, 0x9a,
-  0x9c, 0x9d, 0x9c, 0x9c, 0x9b, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
-  0x9c, 0x9c, 0x9c, 0x9b, 0x9a, 0x9b, 0x9c, 0x9d, 0x4d, 0x48, 0x48, 0x48,
-  0x4b, 0x4f, 0x52, 0x55, 0x57, 0x58, 0x5a, 0x5a, 0x59, 0x58, 0x58, 0x58,
-  0x59, 0x59, 0x58, 0x57, 0x57, 0x58, 0x58, 0x59, 0x5a, 0x5c, 0x5d, 0x5f,
-  0x5f, 0x61, 0x62, 0x63, 0x62, 0x62, 0x61, 0x63, 0x63, 0x63, 0x63, 0x62,
-  0x63, 0x63, 0x62, 0x61, 0x5f, 0x5f, 0x61, 0x62, 0x62, 0x61, 0x62, 0x64,
-  0x64, 0x64, 0x64, 0x65, 0x68, 0x69, 0x6a, 0x6b, 0x6e, 0x71, 0x73, 0x76,
-  0x7d, 0x8b, 0x97, 0x9d, 0x9e, 0x9f, 0xa1, 0xa6, 0xae, 0xb4, 0xb6, 0xb5,
-  0xb5, 0xb6, 0xb8, 0xb7, 0xb3, 0xb3, 0xb6, 0xb5, 0xb4, 0xb3, 0xbf, 0xc7,
-  0xcb, 0xcd, 0xd1, 0xd4, 0xd5, 0xd6, 0xd7, 0xd5, 0xd0, 0xca, 0xce, 0xd3,
-  0xd6, 0xc9, 0xb0, 0xb2, 0xbb, 0xc8, 0xcb, 0xc8, 0xc9, 0xc8, 0xc5, 0xc4,
-  0xc7, 0xc5, 0xc5, 0xc5, 0xaf, 0x8b, 0x9b, 0xa3, 0xa1, 0xa7, 0xb6, 0xb8,
-  0xb7, 0xb6, 0xae, 0x9e, 0x98, 0x91, 0x8a, 0x81, 0x72, 0x50, 0x35, 0x2d,
-  0x2e, 0x31, 0x30, 0x2f, 0x2c, 0x26, 0x26, 0x2c, 0x2d, 0x2d, 0x2c, 0x31,
-  0x3c, 0x44, 0x4b, 0x57, 0x6b, 0x7e, 0x8d, 0x97, 0xa2, 0xaf, 0xb5, 0xb7,
-  0xb9, 0xbc, 0xc2, 0xc4, 0xc5, 0xc6, 0xc6, 0xc8, 0xc6, 0xc5, 0xc5, 0xc3,
-  0xc0, 0xbc, 0xb7, 0xb3, 0xae, 0xab, 0xa7, 0xa8, 0xa8, 0xa7, 0xa7, 0xa5,
-  0xa3, 0xa2, 0xa1, 0x9c, 0x99, 0x96, 0x93, 0x88, 0x72, 0x5d, 0x4d, 0x48,
-  0x4a, 0x4f, 0x4d, 0x45, 0x40, 0x3c, 0x38, 0x44, 0x4f, 0x46, 0x3b, 0x2c,
-  0x2a, 0x32, 0x36, 0x37, 0x38, 0x3d, 0x42, 0x45, 0x47, 0x49, 0x49, 0x4c,
-  0x51, 0x54, 0x59, 0x5b, 0x54, 0x52, 0x58, 0x69, 0x76, 0x6e, 0x69, 0x69,
-  0x6d, 0x6e, 0x6e, 0x6f, 0x6f, 0x6d, 0x67, 0x61, 0x5e, 0x5e, 0x5d, 0x5d,
-  0x5e, 0x5f, 0x61, 0x66, 0x6d, 0x75, 0x7d, 0x80, 0x82, 0x84, 0x83, 0x80,
-  0x7c, 0x79, 0x73, 0x6e, 0x70, 0x77, 0x7c, 0x81, 0x86, 0x89, 0x8c, 0x8d,
-  0x8b, 0x87, 0x82, 0x81, 0x82, 0x82, 0x86, 0x8b, 0x8e, 0x8f, 0x8f, 0x8c,
-  0x85, 0x80, 0x7d, 0x78, 0x73, 0x70, 0x6f, 0x6e, 0x6d, 0x6e, 0x74, 0x7b,
-  0x81, 0x89, 0x92, 0x9a, 0x9e, 0x9f, 0xa0, 0xa3, 0xa4, 0xa3, 0xa4, 0xa5,
-  0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5, 0xa5, 0xa5, 0xa5, 0xa3,
-  0xa3, 0xa3, 0xa3, 0xa3, 0x4f, 0x49, 0x48, 0x49, 0x4b, 0x4f, 0x52, 0x55,
-  0x57, 0x58, 0x5a, 0x5a, 0x59, 0x58, 0x58, 0x58, 0x59, 0x59, 0x57, 0x57,
-  0x57, 0x58, 0x58, 0x59, 0x5b, 0x5b, 0x5c, 0x5d, 0x5d, 0x5f, 0x61, 0x62,
-  0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x62, 0x61,
-  0x5f, 0x5f, 0x61, 0x63, 0x62, 0x63, 0x65, 0x66, 0x66, 0x67, 0x68, 0x69,
-  0x6c, 0x6e, 0x6f, 0x70, 0x73, 0x76, 0x79, 0x7b, 0x7f, 0x8a, 0x95, 0x9c,
-  0x9e, 0x9f, 0xa0, 0xa4, 0xaa, 0xb0, 0xb3, 0xb5, 0xb6, 0xb7, 0xb7, 0xb6,
-  0xb5, 0xb2, 0xb4, 0xb4, 0xb5, 0xbb, 0xc8, 0xcc, 0xce, 0xd0, 0xd5, 0xd7,
-  0xd6, 0xd8, 0xd8, 0xd8, 0xd6, 0xce, 0xd1, 0xd3, 0xd2, 0xca, 0xc4, 0xc8,
-  0xcb, 0xcd, 0xcb, 0xc6, 0xc4, 0xc2, 0xc2, 0xc0, 0xb6, 0xa4, 0x9e, 0x9a,
-  0x83, 0x83, 0xa3, 0xac, 0xa2, 0x9f, 0xa8, 0xaf, 0xae, 0xaa, 0xac, 0xab,
-  0xaa, 0x9d, 0x98, 0x99, 0x94, 0x7d, 0x64, 0x5b, 0x5b, 0x60, 0x59, 0x4c,
-  0x40, 0x2f, 0x2a, 0x34, 0x35, 0x34, 0x30, 0x32, 0x37, 0x3b, 0x3d, 0x42,
-  0x47, 0x4c, 0x50, 0x53, 0x5a, 0x68, 0x73, 0x79, 0x7d, 0x83, 0x8d, 0x94,
-  0x9a, 0x9e, 0xa3, 0xa9, 0xaf, 0xb5, 0xb8, 0xba, 0xba, 0xb7, 0xb3, 0xaf,
-  0xaa, 0xa6, 0xa1, 0xa2, 0xa1, 0xa0, 0x9e, 0x9d, 0x9c, 0x9a, 0x97, 0x91,
-  0x86, 0x7a, 0x6e, 0x58, 0x3f, 0x3e, 0x42, 0x45, 0x49, 0x50, 0x52, 0x4d,
-  0x4a, 0x46, 0x3e, 0x3c, 0x43, 0x3c, 0x32, 0x28, 0x2c, 0x34, 0x37, 0x38,
-  0x39, 0x3f, 0x44, 0x48, 0x4a, 0x4b, 0x4b, 0x50, 0x57, 0x5a, 0x5d, 0x59,
-  0x51, 0x52, 0x58, 0x66, 0x6e, 0x68, 0x68, 0x6a, 0x6d, 0x6f, 0x70, 0x70,
-  0x6e, 0x6a, 0x64, 0x5f, 0x5c, 0x5b, 0x5d, 0x5f, 0x5f, 0x5e, 0x61, 0x67,
-  0x6e, 0x79, 0x7f, 0x81, 0x82, 0x84, 0x83, 0x80, 0x7c, 0x77, 0x70, 0x68,
-  0x66, 0x69, 0x6e, 0x74, 0x79, 0x80, 0x86, 0x89, 0x8b, 0x8a, 0x86, 0x84,
-  0x84, 0x85, 0x8b, 0x91, 0x96, 0x97, 0x98, 0x95, 0x90, 0x8c, 0x89, 0x86,
-  0x82, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x80, 0x86, 0x8a, 0x91, 0x99, 0xa0,
-  0xa3, 0xa4, 0xa6, 0xa8, 0xa9, 0xaa, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xab,
-  0xab, 0xaa, 0xaa, 0xab, 0xac, 0xab, 0xa9, 0xaa, 0xa9, 0xa9, 0xa8, 0xa9,
-  0x52, 0x4a, 0x48, 0x4a, 0x4d, 0x50, 0x52, 0x56, 0x58, 0x58, 0x59, 0x5a,
-  0x5a, 0x59, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x57, 0x57, 0x57, 0x58,
-  0x5b, 0x5c, 0x5c, 0x5c, 0x5d, 0x5e, 0x60, 0x61, 0x61, 0x61, 0x61, 0x63,
-  0x62, 0x62, 0x61, 0x60, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x62, 0x63,
-  0x64, 0x65, 0x66, 0x67, 0x69, 0x6a, 0x6b, 0x6c, 0x6f, 0x70, 0x71, 0x74,
-  0x77, 0x7a, 0x7d, 0x7e, 0x80, 0x89, 0x93, 0x9c, 0x9f, 0xa1, 0xa2, 0xa3,
-  0xa8, 0xae, 0xb2, 0xb5, 0xb6, 0xb6, 0xb6, 0xb6, 0xb5, 0xb3, 0xb3, 0xb5,
-  0xb8, 0xc1, 0xcd, 0xcd, 0xce, 0xd0, 0xd5, 0xd7, 0xd7, 0xd8, 0xd8, 0xd8,
-  0xd7, 0xd0, 0xce, 0xcc, 0xc7, 0xc5, 0xc7, 0xca, 0xcb, 0xcc, 0xcd, 0xc4,
-  0xbb, 0xb8, 0xb3, 0x9f, 0x88, 0x79, 0x74, 0x72, 0x67, 0x7b, 0x9a, 0xa1,
-  0x97, 0x99, 0x9c, 0xa8, 0xad, 0xae, 0xb3, 0xb5, 0xb7, 0xb5, 0xb4, 0xb5,
-  0xaf, 0x9e, 0x8a, 0x7e, 0x73, 0x77, 0x83, 0x7d, 0x6f, 0x4f, 0x35, 0x39,
-  0x3b, 0x39, 0x36, 0x37, 0x3c, 0x40, 0x42, 0x45, 0x48, 0x48, 0x48, 0x46,
-  0x46, 0x49, 0x4f, 0x51, 0x53, 0x56, 0x5b, 0x60, 0x63, 0x66, 0x6c, 0x77,
-  0x88, 0x95, 0x9d, 0xa4, 0xa9, 0xa9, 0xa6, 0xa4, 0xa1, 0x9d, 0x9b, 0x9c,
-  0x9d, 0x9e, 0x9c, 0x9a, 0x98, 0x95, 0x8b, 0x79, 0x60, 0x4c, 0x40, 0x31,
-  0x29, 0x36, 0x42, 0x46, 0x48, 0x4c, 0x4e, 0x4e, 0x4f, 0x4d, 0x45, 0x3d,
-  0x3b, 0x33, 0x2c, 0x26, 0x2d, 0x34, 0x36, 0x37, 0x3a, 0x41, 0x47, 0x4a,
-  0x4c, 0x4c, 0x4d, 0x53, 0x5b, 0x5d, 0x5d, 0x57, 0x50, 0x52, 0x59, 0x66,
-  0x6a, 0x68, 0x69, 0x6a, 0x6c, 0x6f, 0x70, 0x6f, 0x6d, 0x68, 0x61, 0x5d,
-  0x5c, 0x5c, 0x5d, 0x60, 0x5f, 0x5f, 0x61, 0x67, 0x6f, 0x7b, 0x80, 0x82,
-  0x83, 0x83, 0x82, 0x80, 0x7c, 0x78, 0x6f, 0x64, 0x5e, 0x60, 0x64, 0x6a,
-  0x71, 0x79, 0x80, 0x84, 0x8a, 0x8c, 0x8a, 0x88, 0x87, 0x88, 0x8e, 0x95,
-  0x99, 0x9b, 0x9d, 0x9b, 0x96, 0x93, 0x92, 0x8f, 0x8c, 0x8b, 0x8a, 0x89,
-  0x88, 0x86, 0x89, 0x8d, 0x90, 0x95, 0x9d, 0xa3, 0xa5, 0xa7, 0xa8, 0xa9,
-  0xab, 0xac, 0xac, 0xad, 0xae, 0xac, 0xac, 0xad, 0xae, 0xae, 0xae, 0xae,
-  0xae, 0xae, 0xae, 0xad, 0xab, 0xaa, 0xaa, 0xac, 0x54, 0x4b, 0x49, 0x4a,
-  0x4d, 0x4f, 0x52, 0x56, 0x57, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x58,
-  0x58, 0x57, 0x58, 0x58, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x5c, 0x5b, 0x5c,
-  0x5d, 0x5e, 0x5f, 0x61, 0x61, 0x61, 0x61, 0x63, 0x62, 0x61, 0x61, 0x60,
-  0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63, 0x64, 0x66, 0x66, 0x68,
-  0x6b, 0x6d, 0x6d, 0x6e, 0x70, 0x72, 0x74, 0x77, 0x7a, 0x7d, 0x7f, 0x80,
-  0x81, 0x88, 0x92, 0x9c, 0xa0, 0xa1, 0xa2, 0xa3, 0xa7, 0xac, 0xb0, 0xb4,
-  0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb7, 0xbb, 0xc5, 0xd0, 0xce,
-  0xce, 0xd0, 0xd6, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xcf, 0xca, 0xc7,
-  0xc3, 0xc5, 0xc9, 0xca, 0xc9, 0xc5, 0xc1, 0xb4, 0xa8, 0xa4, 0xa0, 0x89,
-  0x72, 0x68, 0x65, 0x65, 0x63, 0x7b, 0x92, 0x96, 0x8f, 0x94, 0x95, 0xa0,
-  0xa7, 0xb0, 0xb9, 0xbc, 0xbf, 0xc1, 0xc2, 0xc0, 0xb8, 0xa8, 0x97, 0x8a,
-  0x7a, 0x7a, 0x8d, 0x8e, 0x7f, 0x5c, 0x3b, 0x3b, 0x3e, 0x3c, 0x39, 0x3a,
-  0x3e, 0x42, 0x45, 0x48, 0x4b, 0x4c, 0x4a, 0x48, 0x45, 0x44, 0x46, 0x48,
-  0x48, 0x4a, 0x4b, 0x4d, 0x4e, 0x50, 0x54, 0x5f, 0x6f, 0x7b, 0x81, 0x8a,
-  0x92, 0x98, 0x98, 0x98, 0x98, 0x96, 0x96, 0x97, 0x98, 0x99, 0x95, 0x8f,
-  0x8b, 0x85, 0x77, 0x5e, 0x45, 0x35, 0x2d, 0x25, 0x26, 0x35, 0x42, 0x45,
-  0x46, 0x48, 0x4b, 0x4d, 0x51, 0x50, 0x4a, 0x40, 0x39, 0x2e, 0x28, 0x26,
-  0x30, 0x35, 0x37, 0x38, 0x3b, 0x42, 0x48, 0x4b, 0x4c, 0x4b, 0x4e, 0x55,
-  0x5c, 0x5e, 0x5c, 0x56, 0x50, 0x52, 0x59, 0x65, 0x69, 0x69, 0x6a, 0x6b,
-  0x6c, 0x6e, 0x6f, 0x6e, 0x6c, 0x67, 0x60, 0x5c, 0x5c, 0x5d, 0x5e, 0x60,
-  0x5f, 0x5f, 0x61, 0x67, 0x70, 0x7c, 0x81, 0x83, 0x83, 0x83, 0x83, 0x80,
-  0x7d, 0x78, 0x70, 0x63, 0x5a, 0x5b, 0x5d, 0x63, 0x6b, 0x73, 0x7a, 0x7f,
-  0x85, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8e, 0x96, 0x9a, 0x9d, 0x9f, 0x9e,
-  0x9a, 0x98, 0x96, 0x93, 0x91, 0x90, 0x90, 0x8f, 0x8e, 0x8c, 0x8d, 0x90,
-  0x93, 0x97, 0x9e, 0xa4, 0xa7, 0xa9, 0xa9, 0xaa, 0xac, 0xad, 0xad, 0xaf,
-  0xb0, 0xaf, 0xae, 0xae, 0xaf, 0xaf, 0xb0, 0xaf, 0xaf, 0xaf, 0xb0, 0xae,
-  0xad, 0xac, 0xac, 0xad, 0x54, 0x4c, 0x48, 0x49, 0x4c, 0x4f, 0x53, 0x56,
-  0x57, 0x58, 0x5a, 0x59, 0x5a, 0x5a, 0x59, 0x58, 0x58, 0x57, 0x57, 0x58,
-  0x57, 0x57, 0x57, 0x57, 0x59, 0x5b, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f, 0x60,
-  0x61, 0x61, 0x61, 0x62, 0x61, 0x62, 0x61, 0x61, 0x62, 0x61, 0x60, 0x60,
-  0x60, 0x62, 0x64, 0x65, 0x66, 0x68, 0x68, 0x6a, 0x6d, 0x6f, 0x70, 0x71,
-  0x75, 0x77, 0x79, 0x7c, 0x7f, 0x81, 0x83, 0x83, 0x84, 0x87, 0x90, 0x9a,
-  0x9f, 0xa0, 0xa2, 0xa2, 0xa5, 0xab, 0xaf, 0xb3, 0xb4, 0xb3, 0xb2, 0xb3,
-  0xb5, 0xb4, 0xb5, 0xba, 0xc0, 0xcb, 0xd4, 0xd1, 0xd0, 0xd2, 0xd7, 0xd9,
-  0xd9, 0xd7, 0xd5, 0xd5, 0xd4, 0xcb, 0xc6, 0xc4, 0xc3, 0xc5, 0xc7, 0xc4,
-  0xbd, 0xad, 0x9c, 0x8d, 0x83, 0x80, 0x81, 0x79, 0x6d, 0x68, 0x67, 0x69,
-  0x72, 0x82, 0x89, 0x8a, 0x88, 0x8e, 0x8c, 0x8f, 0x96, 0xa7, 0xbb, 0xc3,
-  0xc5, 0xc4, 0xc2, 0xbe, 0xb2, 0x9e, 0x90, 0x87, 0x79, 0x72, 0x7d, 0x80,
-  0x75, 0x56, 0x3e, 0x3e, 0x40, 0x3f, 0x3c, 0x3c, 0x41, 0x46, 0x48, 0x4b,
-  0x4e, 0x50, 0x4f, 0x4d, 0x49, 0x47, 0x49, 0x4b, 0x4c, 0x4e, 0x4e, 0x4f,
-  0x4f, 0x4f, 0x50, 0x53, 0x56, 0x58, 0x5a, 0x5f, 0x69, 0x74, 0x7b, 0x7f,
-  0x82, 0x83, 0x83, 0x85, 0x86, 0x85, 0x7d, 0x73, 0x6b, 0x63, 0x50, 0x36,
-  0x2b, 0x29, 0x29, 0x27, 0x29, 0x33, 0x41, 0x45, 0x46, 0x46, 0x46, 0x4a,
-  0x50, 0x52, 0x51, 0x47, 0x38, 0x2a, 0x25, 0x27, 0x33, 0x37, 0x38, 0x39,
-  0x3d, 0x44, 0x4a, 0x4d, 0x4d, 0x4d, 0x50, 0x56, 0x5b, 0x5c, 0x59, 0x53,
-  0x50, 0x54, 0x5a, 0x63, 0x69, 0x6b, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x6c,
-  0x6a, 0x65, 0x5e, 0x5c, 0x5e, 0x5f, 0x61, 0x61, 0x5f, 0x5f, 0x61, 0x67,
-  0x73, 0x7e, 0x82, 0x83, 0x84, 0x84, 0x84, 0x81, 0x7d, 0x79, 0x71, 0x64,
-  0x59, 0x56, 0x55, 0x58, 0x60, 0x6a, 0x71, 0x75, 0x7d, 0x83, 0x86, 0x88,
-  0x88, 0x8b, 0x8f, 0x96, 0x9a, 0x9d, 0xa0, 0xa1, 0x9e, 0x9d, 0x9c, 0x98,
-  0x97, 0x96, 0x96, 0x96, 0x96, 0x93, 0x92, 0x94, 0x96, 0x9a, 0xa0, 0xa5,
-  0xa8, 0xaa, 0xab, 0xac, 0xae, 0xaf, 0xaf, 0xb0, 0xb1, 0xb0, 0xb0, 0xb0,
-  0xb0, 0xb2, 0xb2, 0xb2, 0xb1, 0xb1, 0xb2, 0xb1, 0xae, 0xad, 0xae, 0xaf,
-  0x57, 0x4e, 0x4a, 0x4b, 0x4e, 0x52, 0x54, 0x56, 0x57, 0x58, 0x5a, 0x59,
-  0x5a, 0x5a, 0x59, 0x59, 0x57, 0x58, 0x58, 0x56, 0x56, 0x57, 0x57, 0x56,
-  0x57, 0x5a, 0x59, 0x5a, 0x5b, 0x5d, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61,
-  0x61, 0x61, 0x61, 0x61, 0x63, 0x62, 0x63, 0x62, 0x61, 0x62, 0x65, 0x68,
-  0x69, 0x6b, 0x6c, 0x6e, 0x70, 0x71, 0x72, 0x75, 0x78, 0x7c, 0x7f, 0x82,
-  0x84, 0x86, 0x86, 0x86, 0x86, 0x87, 0x8e, 0x98, 0x9e, 0xa0, 0xa1, 0xa2,
-  0xa5, 0xaa, 0xae, 0xb2, 0xb3, 0xb0, 0xaf, 0xb0, 0xb5, 0xb7, 0xb7, 0xbd,
-  0xc5, 0xd0, 0xd8, 0xd6, 0xd5, 0xd4, 0xd3, 0xcf, 0xcb, 0xca, 0xcb, 0xcb,
-  0xca, 0xc5, 0xc1, 0xc0, 0xbd, 0xb1, 0xa7, 0x9a, 0x91, 0x86, 0x7c, 0x7b,
-  0x78, 0x78, 0x7b, 0x80, 0x77, 0x72, 0x73, 0x78, 0x83, 0x8a, 0x88, 0x86,
-  0x84, 0x80, 0x7e, 0x7a, 0x7d, 0x8d, 0xa7, 0xb5, 0xb6, 0xb0, 0xad, 0xa6,
-  0x93, 0x77, 0x6c, 0x68, 0x62, 0x5b, 0x55, 0x55, 0x52, 0x48, 0x41, 0x41,
-  0x42, 0x41, 0x3e, 0x3e, 0x42, 0x48, 0x4a, 0x4e, 0x51, 0x53, 0x53, 0x51,
-  0x4d, 0x48, 0x48, 0x4a, 0x4b, 0x4f, 0x51, 0x52, 0x52, 0x52, 0x53, 0x55,
-  0x54, 0x52, 0x51, 0x4e, 0x4a, 0x48, 0x49, 0x4a, 0x4a, 0x4a, 0x4d, 0x53,
-  0x58, 0x5e, 0x5c, 0x57, 0x55, 0x52, 0x47, 0x2e, 0x27, 0x28, 0x29, 0x2a,
-  0x2a, 0x2f, 0x3f, 0x48, 0x4a, 0x47, 0x44, 0x47, 0x4d, 0x50, 0x54, 0x4f,
-  0x3b, 0x29, 0x25, 0x2a, 0x35, 0x38, 0x39, 0x3b, 0x40, 0x47, 0x4b, 0x4d,
-  0x4e, 0x4f, 0x55, 0x59, 0x5b, 0x5a, 0x57, 0x4f, 0x4f, 0x55, 0x5a, 0x61,
-  0x68, 0x6c, 0x6e, 0x6f, 0x6e, 0x6c, 0x6c, 0x6a, 0x67, 0x61, 0x5c, 0x5c,
-  0x60, 0x62, 0x64, 0x62, 0x5e, 0x5d, 0x60, 0x67, 0x75, 0x7f, 0x82, 0x83,
-  0x84, 0x85, 0x87, 0x83, 0x80, 0x7c, 0x73, 0x66, 0x5c, 0x55, 0x52, 0x51,
-  0x54, 0x5c, 0x62, 0x67, 0x6f, 0x78, 0x7e, 0x82, 0x84, 0x87, 0x8c, 0x95,
-  0x99, 0x9c, 0xa0, 0xa2, 0xa3, 0xa2, 0xa1, 0xa0, 0x9e, 0x9f, 0x9f, 0x9f,
-  0x9e, 0x9b, 0x99, 0x99, 0x9a, 0x9d, 0xa3, 0xa6, 0xa9, 0xaa, 0xab, 0xad,
-  0xb0, 0xb1, 0xb1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb3, 0xb2, 0xb2, 0xb3, 0xb4,
-  0xb4, 0xb5, 0xb5, 0xb4, 0xb1, 0xb0, 0xb0, 0xb0, 0x5a, 0x51, 0x4d, 0x4d,
-  0x4f, 0x52, 0x55, 0x57, 0x58, 0x59, 0x5b, 0x5b, 0x5b, 0x5a, 0x59, 0x59,
-  0x58, 0x59, 0x59, 0x57, 0x57, 0x57, 0x56, 0x56, 0x57, 0x59, 0x59, 0x5a,
-  0x5a, 0x5e, 0x60, 0x61, 0x60, 0x5f, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x61,
-  0x63, 0x63, 0x64, 0x65, 0x63, 0x64, 0x66, 0x69, 0x6b, 0x6d, 0x6e, 0x71,
-  0x72, 0x72, 0x75, 0x79, 0x7d, 0x81, 0x83, 0x85, 0x87, 0x89, 0x89, 0x89,
-  0x89, 0x89, 0x8d, 0x94, 0x9c, 0x9f, 0xa1, 0xa2, 0xa5, 0xa9, 0xac, 0xb0,
-  0xb2, 0xad, 0xac, 0xae, 0xb4, 0xb9, 0xba, 0xbf, 0xc5, 0xce, 0xd6, 0xd4,
-  0xcb, 0xc2, 0xb4, 0xa6, 0xa2, 0xa9, 0xaf, 0xb5, 0xb4, 0xad, 0xa8, 0xa5,
-  0xa3, 0x96, 0x8d, 0x86, 0x84, 0x85, 0x82, 0x82, 0x85, 0x86, 0x87, 0x87,
-  0x80, 0x7c, 0x7b, 0x7f, 0x86, 0x8c, 0x89, 0x88, 0x87, 0x81, 0x78, 0x6f,
-  0x6f, 0x79, 0x86, 0x8d, 0x8a, 0x80, 0x7c, 0x7a, 0x71, 0x69, 0x69, 0x67,
-  0x61, 0x58, 0x4c, 0x4c, 0x4a, 0x45, 0x43, 0x40, 0x42, 0x42, 0x40, 0x3e,
-  0x42, 0x46, 0x49, 0x4d, 0x52, 0x53, 0x53, 0x53, 0x50, 0x4a, 0x48, 0x48,
-  0x49, 0x4c, 0x51, 0x54, 0x55, 0x56, 0x56, 0x59, 0x5a, 0x59, 0x58, 0x54,
-  0x4a, 0x3f, 0x39, 0x35, 0x32, 0x31, 0x36, 0x42, 0x4c, 0x56, 0x55, 0x4f,
-  0x51, 0x53, 0x4e, 0x36, 0x2a, 0x29, 0x2a, 0x2a, 0x2a, 0x2d, 0x3b, 0x4b,
-  0x4f, 0x4b, 0x45, 0x43, 0x47, 0x4b, 0x51, 0x51, 0x3e, 0x2c, 0x28, 0x2f,
-  0x38, 0x3a, 0x3a, 0x3c, 0x42, 0x49, 0x4c, 0x50, 0x51, 0x51, 0x57, 0x5a,
-  0x59, 0x57, 0x53, 0x4b, 0x4e, 0x56, 0x5b, 0x60, 0x68, 0x6b, 0x6d, 0x6c,
-  0x6c, 0x6c, 0x69, 0x66, 0x63, 0x5f, 0x5c, 0x5f, 0x64, 0x67, 0x69, 0x65,
-  0x5d, 0x5a, 0x5d, 0x69, 0x79, 0x7f, 0x81, 0x82, 0x83, 0x87, 0x89, 0x86,
-  0x83, 0x7f, 0x75, 0x67, 0x5d, 0x58, 0x56, 0x52, 0x51, 0x51, 0x54, 0x59,
-  0x60, 0x69, 0x72, 0x78, 0x7a, 0x7d, 0x84, 0x8d, 0x92, 0x95, 0x99, 0x9d,
-  0xa3, 0xa4, 0xa5, 0xa4, 0xa4, 0xa5, 0xa5, 0xa4, 0xa3, 0x9f, 0x9d, 0x9d,
-  0x9e, 0x9f, 0xa3, 0xa6, 0xa8, 0xa9, 0xaa, 0xae, 0xb0, 0xb1, 0xb1, 0xb1,
-  0xb1, 0xb1, 0xb2, 0xb1, 0xb1, 0xb1, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb5,
-  0xb2, 0xb2, 0xb1, 0xb2, 0x5d, 0x54, 0x4f, 0x4e, 0x4f, 0x52, 0x54, 0x57,
-  0x58, 0x59, 0x5a, 0x5a, 0x5b, 0x5a, 0x59, 0x59, 0x58, 0x59, 0x59, 0x57,
-  0x57, 0x57, 0x56, 0x56, 0x56, 0x59, 0x59, 0x5a, 0x5b, 0x5e, 0x60, 0x61,
-  0x5f, 0x5f, 0x60, 0x5f, 0x61, 0x60, 0x60, 0x60, 0x62, 0x63, 0x64, 0x64,
-  0x64, 0x66, 0x67, 0x6b, 0x6c, 0x6e, 0x6f, 0x72, 0x73, 0x75, 0x78, 0x7e,
-  0x81, 0x85, 0x86, 0x88, 0x88, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8d, 0x93,
-  0x9a, 0x9e, 0xa0, 0xa2, 0xa4, 0xa9, 0xab, 0xb0, 0xb1, 0xac, 0xab, 0xae,
-  0xb4, 0xb9, 0xbb, 0xc0, 0xc4, 0xc9, 0xca, 0xc3, 0xb1, 0xa4, 0x95, 0x8b,
-  0x8b, 0x92, 0x97, 0x9d, 0x9f, 0x9b, 0x9b, 0x9a, 0x97, 0x90, 0x8d, 0x8b,
-  0x8b, 0x8a, 0x88, 0x87, 0x87, 0x88, 0x8a, 0x85, 0x80, 0x80, 0x81, 0x84,
-  0x85, 0x8c, 0x8c, 0x8b, 0x89, 0x8a, 0x80, 0x73, 0x70, 0x72, 0x75, 0x73,
-  0x71, 0x69, 0x69, 0x6e, 0x6a, 0x6b, 0x6c, 0x6a, 0x63, 0x5b, 0x51, 0x4f,
-  0x4d, 0x4a, 0x47, 0x40, 0x42, 0x43, 0x41, 0x3f, 0x40, 0x43, 0x46, 0x4b,
-  0x50, 0x52, 0x54, 0x55, 0x54, 0x4e, 0x49, 0x47, 0x47, 0x4a, 0x50, 0x54,
-  0x56, 0x57, 0x58, 0x5b, 0x5f, 0x5f, 0x5e, 0x5a, 0x51, 0x43, 0x3b, 0x36,
-  0x32, 0x30, 0x38, 0x47, 0x51, 0x5b, 0x57, 0x4e, 0x50, 0x54, 0x52, 0x3d,
-  0x2d, 0x2c, 0x2c, 0x2a, 0x28, 0x2b, 0x37, 0x49, 0x51, 0x50, 0x46, 0x42,
-  0x43, 0x46, 0x4d, 0x4f, 0x3e, 0x2d, 0x2b, 0x32, 0x3a, 0x3b, 0x3b, 0x3d,
-  0x42, 0x47, 0x4c, 0x51, 0x53, 0x55, 0x5b, 0x5b, 0x58, 0x55, 0x4f, 0x48,
-  0x4e, 0x58, 0x5d, 0x62, 0x68, 0x6c, 0x6b, 0x6b, 0x6b, 0x6b, 0x67, 0x63,
-  0x60, 0x5d, 0x5c, 0x61, 0x69, 0x6c, 0x6d, 0x67, 0x5d, 0x59, 0x5e, 0x6c,
-  0x7b, 0x7f, 0x7f, 0x80, 0x82, 0x87, 0x89, 0x89, 0x85, 0x81, 0x77, 0x68,
-  0x5e, 0x5c, 0x59, 0x55, 0x52, 0x4f, 0x4f, 0x50, 0x53, 0x5b, 0x65, 0x6c,
-  0x70, 0x75, 0x7c, 0x84, 0x88, 0x8b, 0x90, 0x96, 0x9e, 0xa3, 0xa4, 0xa6,
-  0xa7, 0xa8, 0xa8, 0xa8, 0xa6, 0xa3, 0x9f, 0xa0, 0xa0, 0xa2, 0xa5, 0xa6,
-  0xa8, 0xa9, 0xab, 0xac, 0xaf, 0xb0, 0xb0, 0xb1, 0xb0, 0xb1, 0xb0, 0xb0,
-  0xaf, 0xaf, 0xb2, 0xb3, 0xb4, 0xb6, 0xb7, 0xb6, 0xb4, 0xb3, 0xb2, 0xb2,
-  0x5f, 0x55, 0x50, 0x4e, 0x4f, 0x53, 0x55, 0x57, 0x58, 0x59, 0x5b, 0x5b,
-  0x5b, 0x5a, 0x59, 0x59, 0x58, 0x59, 0x58, 0x57, 0x56, 0x56, 0x56, 0x56,
-  0x56, 0x59, 0x59, 0x5a, 0x5a, 0x5d, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x5f,
-  0x60, 0x60, 0x60, 0x5f, 0x62, 0x63, 0x64, 0x64, 0x64, 0x67, 0x68, 0x6b,
-  0x6c, 0x6e, 0x70, 0x73, 0x75, 0x77, 0x7a, 0x80, 0x84, 0x86, 0x88, 0x8a,
-  0x8a, 0x8c, 0x8b, 0x8c, 0x8c, 0x8c, 0x8d, 0x91, 0x98, 0x9c, 0xa0, 0xa1,
-  0xa3, 0xa8, 0xab, 0xaf, 0xb0, 0xab, 0xaa, 0xad, 0xb4, 0xba, 0xbc, 0xc1,
-  0xc4, 0xc4, 0xb9, 0xa9, 0x9c, 0x95, 0x8f, 0x89, 0x89, 0x8c, 0x8e, 0x92,
-  0x95, 0x95, 0x98, 0x99, 0x94, 0x90, 0x8f, 0x8f, 0x8f, 0x8d, 0x8a, 0x88,
-  0x88, 0x89, 0x8a, 0x85, 0x81, 0x83, 0x84, 0x85, 0x84, 0x8b, 0x8e, 0x8d,
-  0x89, 0x8c, 0x86, 0x7a, 0x75, 0x73, 0x71, 0x69, 0x68, 0x65, 0x67, 0x6e,
-  0x6b, 0x6e, 0x6e, 0x6b, 0x64, 0x5c, 0x53, 0x51, 0x50, 0x4e, 0x4a, 0x40,
-  0x41, 0x43, 0x43, 0x40, 0x3f, 0x41, 0x44, 0x48, 0x4e, 0x51, 0x54, 0x55,
-  0x55, 0x50, 0x4a, 0x48, 0x48, 0x49, 0x4e, 0x53, 0x56, 0x58, 0x59, 0x5c,
-  0x61, 0x62, 0x61, 0x5d, 0x55, 0x48, 0x3e, 0x39, 0x33, 0x32, 0x3b, 0x4b,
-  0x55, 0x5f, 0x58, 0x4d, 0x50, 0x54, 0x55, 0x40, 0x2f, 0x2c, 0x2c, 0x2b,
-  0x29, 0x2a, 0x34, 0x47, 0x4f, 0x52, 0x49, 0x42, 0x42, 0x45, 0x4b, 0x4c,
-  0x3c, 0x2e, 0x2c, 0x35, 0x3c, 0x3d, 0x3d, 0x3f, 0x43, 0x46, 0x4c, 0x52,
-  0x54, 0x57, 0x5b, 0x5b, 0x57, 0x53, 0x4c, 0x47, 0x4e, 0x59, 0x5e, 0x63,
-  0x68, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x67, 0x62, 0x5f, 0x5c, 0x5e, 0x64,
-  0x6b, 0x6f, 0x71, 0x68, 0x5c, 0x5a, 0x60, 0x6f, 0x7c, 0x80, 0x80, 0x80,
-  0x81, 0x86, 0x8a, 0x8a, 0x86, 0x82, 0x78, 0x69, 0x5f, 0x5c, 0x5a, 0x57,
-  0x53, 0x4f, 0x4e, 0x4e, 0x4e, 0x54, 0x5c, 0x63, 0x68, 0x6e, 0x76, 0x7c,
-  0x80, 0x82, 0x86, 0x90, 0x9b, 0xa1, 0xa3, 0xa5, 0xa8, 0xa9, 0xa9, 0xa9,
-  0xa7, 0xa3, 0xa0, 0xa1, 0xa2, 0xa3, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xac,
-  0xaf, 0xb0, 0xb0, 0xb1, 0xb0, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb2,
-  0xb3, 0xb5, 0xb6, 0xb6, 0xb4, 0xb3, 0xb3, 0xb2, 0x62, 0x58, 0x52, 0x50,
-  0x4f, 0x53, 0x56, 0x57, 0x58, 0x5a, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x58,
-  0x58, 0x57, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x5a, 0x59,
-  0x5a, 0x5c, 0x5f, 0x5f, 0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x5f, 0x5f, 0x5f,
-  0x62, 0x64, 0x65, 0x65, 0x65, 0x67, 0x69, 0x6b, 0x6c, 0x6e, 0x72, 0x75,
-  0x78, 0x7a, 0x7e, 0x83, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8d,
-  0x8e, 0x8e, 0x8d, 0x8f, 0x95, 0x99, 0x9d, 0xa1, 0xa4, 0xa7, 0xaa, 0xae,
-  0xaf, 0xa9, 0xa9, 0xac, 0xb4, 0xba, 0xbd, 0xc3, 0xc4, 0xbe, 0x9c, 0x7f,
-  0x88, 0x93, 0x9b, 0x97, 0x95, 0x93, 0x90, 0x8e, 0x93, 0x92, 0x98, 0x99,
-  0x94, 0x90, 0x90, 0x90, 0x91, 0x90, 0x8d, 0x8c, 0x8d, 0x8d, 0x8c, 0x88,
-  0x87, 0x88, 0x88, 0x86, 0x85, 0x8a, 0x90, 0x90, 0x89, 0x89, 0x89, 0x83,
-  0x7e, 0x78, 0x74, 0x6b, 0x69, 0x6b, 0x6e, 0x71, 0x71, 0x71, 0x6f, 0x6d,
-  0x65, 0x5b, 0x53, 0x52, 0x53, 0x54, 0x4c, 0x3e, 0x3e, 0x42, 0x45, 0x41,
-  0x3d, 0x3e, 0x3f, 0x43, 0x4a, 0x4f, 0x53, 0x54, 0x55, 0x52, 0x4e, 0x4b,
-  0x4a, 0x49, 0x4a, 0x50, 0x57, 0x5a, 0x5b, 0x5e, 0x63, 0x66, 0x67, 0x64,
-  0x5b, 0x4e, 0x41, 0x3b, 0x34, 0x33, 0x3e, 0x50, 0x5b, 0x62, 0x59, 0x4c,
-  0x4e, 0x54, 0x57, 0x46, 0x30, 0x2c, 0x2c, 0x2d, 0x2b, 0x2a, 0x32, 0x41,
-  0x4b, 0x54, 0x4e, 0x45, 0x45, 0x47, 0x4a, 0x49, 0x39, 0x30, 0x30, 0x39,
-  0x3f, 0x40, 0x40, 0x40, 0x43, 0x45, 0x4d, 0x53, 0x55, 0x58, 0x5c, 0x5b,
-  0x55, 0x50, 0x49, 0x46, 0x51, 0x5c, 0x61, 0x65, 0x67, 0x6a, 0x6a, 0x69,
-  0x69, 0x6a, 0x66, 0x61, 0x5f, 0x5e, 0x62, 0x69, 0x71, 0x75, 0x74, 0x69,
-  0x5d, 0x5d, 0x64, 0x72, 0x7e, 0x81, 0x80, 0x80, 0x80, 0x86, 0x8c, 0x8c,
-  0x88, 0x83, 0x79, 0x6b, 0x61, 0x5c, 0x5a, 0x59, 0x55, 0x51, 0x50, 0x4f,
-  0x4d, 0x4d, 0x51, 0x57, 0x5b, 0x61, 0x6a, 0x6f, 0x72, 0x74, 0x78, 0x87,
-  0x97, 0x9f, 0xa2, 0xa4, 0xa8, 0xaa, 0xaa, 0xa9, 0xa7, 0xa2, 0xa0, 0xa0,
-  0xa1, 0xa3, 0xa7, 0xa8, 0xa8, 0xa9, 0xaa, 0xab, 0xad, 0xae, 0xae, 0xaf,
-  0xaf, 0xb0, 0xb0, 0xb0, 0xaf, 0xaf, 0xb0, 0xb1, 0xb1, 0xb3, 0xb5, 0xb6,
-  0xb5, 0xb4, 0xb4, 0xb1, 0x65, 0x5c, 0x56, 0x54, 0x52, 0x54, 0x56, 0x57,
-  0x58, 0x5a, 0x5c, 0x5c, 0x5a, 0x5a, 0x5a, 0x59, 0x58, 0x56, 0x55, 0x56,
-  0x56, 0x55, 0x55, 0x56, 0x57, 0x58, 0x58, 0x59, 0x5a, 0x5c, 0x5f, 0x5f,
-  0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x61, 0x64, 0x64, 0x65,
-  0x66, 0x69, 0x6c, 0x6e, 0x6f, 0x71, 0x74, 0x7a, 0x7d, 0x7f, 0x82, 0x86,
-  0x8a, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f,
-  0x93, 0x96, 0x9c, 0xa0, 0xa3, 0xa6, 0xa9, 0xac, 0xad, 0xaa, 0xab, 0xae,
-  0xb5, 0xba, 0xbd, 0xc2, 0xc5, 0xbd, 0x98, 0x89, 0x9e, 0xa9, 0xaa, 0xa7,
-  0xa5, 0xa2, 0x9f, 0x9a, 0x96, 0x95, 0x99, 0x9a, 0x97, 0x92, 0x93, 0x93,
-  0x93, 0x95, 0x94, 0x95, 0x96, 0x96, 0x94, 0x93, 0x8e, 0x8a, 0x89, 0x8a,
-  0x8b, 0x89, 0x8e, 0x90, 0x8f, 0x88, 0x8a, 0x89, 0x85, 0x7f, 0x7c, 0x79,
-  0x78, 0x79, 0x79, 0x77, 0x73, 0x70, 0x6f, 0x6e, 0x69, 0x5b, 0x56, 0x59,
-  0x5d, 0x5e, 0x4f, 0x3d, 0x3d, 0x41, 0x47, 0x44, 0x3c, 0x3a, 0x3b, 0x3f,
-  0x46, 0x4d, 0x53, 0x55, 0x57, 0x57, 0x54, 0x52, 0x50, 0x4b, 0x49, 0x4e,
-  0x55, 0x59, 0x5d, 0x60, 0x65, 0x6b, 0x6d, 0x6d, 0x65, 0x58, 0x48, 0x3f,
-  0x38, 0x35, 0x43, 0x56, 0x61, 0x68, 0x5d, 0x4d, 0x4e, 0x54, 0x59, 0x4d,
-  0x33, 0x2c, 0x2c, 0x2e, 0x2c, 0x2b, 0x30, 0x3a, 0x44, 0x52, 0x53, 0x4d,
-  0x4c, 0x4c, 0x4c, 0x48, 0x37, 0x31, 0x35, 0x3f, 0x43, 0x43, 0x42, 0x42,
-  0x44, 0x47, 0x4f, 0x56, 0x58, 0x5b, 0x5d, 0x58, 0x4f, 0x49, 0x44, 0x47,
-  0x53, 0x5e, 0x63, 0x66, 0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x62, 0x5f,
-  0x5f, 0x62, 0x6a, 0x73, 0x7a, 0x7c, 0x78, 0x6b, 0x60, 0x63, 0x6a, 0x77,
-  0x81, 0x81, 0x7f, 0x7e, 0x80, 0x86, 0x8c, 0x8f, 0x8c, 0x87, 0x7d, 0x70,
-  0x64, 0x5d, 0x5b, 0x5a, 0x56, 0x54, 0x52, 0x51, 0x4e, 0x4c, 0x4b, 0x4c,
-  0x4e, 0x52, 0x5a, 0x60, 0x60, 0x61, 0x67, 0x7a, 0x90, 0x9b, 0xa0, 0xa4,
-  0xa7, 0xa8, 0xa9, 0xa8, 0xa5, 0xa2, 0x9f, 0x9f, 0x9f, 0xa2, 0xa6, 0xa8,
-  0xa8, 0xa9, 0xab, 0xac, 0xac, 0xac, 0xac, 0xad, 0xad, 0xaf, 0xaf, 0xaf,
-  0xae, 0xae, 0xae, 0xae, 0xaf, 0xb1, 0xb3, 0xb5, 0xb5, 0xb5, 0xb4, 0xb1,
-  0x69, 0x60, 0x5b, 0x58, 0x57, 0x55, 0x56, 0x58, 0x5a, 0x5b, 0x5d, 0x5d,
-  0x5c, 0x5b, 0x5a, 0x5a, 0x59, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x57,
-  0x58, 0x57, 0x58, 0x5a, 0x5a, 0x5c, 0x5e, 0x5e, 0x5d, 0x5e, 0x5f, 0x60,
-  0x5f, 0x5f, 0x5f, 0x5f, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6c, 0x6e, 0x70,
-  0x71, 0x74, 0x78, 0x7e, 0x81, 0x83, 0x86, 0x8a, 0x8d, 0x8e, 0x8f, 0x90,
-  0x91, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x8f, 0x90, 0x93, 0x98, 0xa0,
-  0xa3, 0xa6, 0xa8, 0xa9, 0xab, 0xaa, 0xad, 0xb0, 0xb5, 0xb9, 0xbb, 0xc2,
-  0xc6, 0xc7, 0xc2, 0xc6, 0xc5, 0xbd, 0xad, 0xa9, 0xa9, 0xa5, 0xa2, 0x9f,
-  0x9a, 0x9a, 0x9c, 0x9c, 0x9b, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9b, 0x99,
-  0x9a, 0x98, 0x94, 0x91, 0x8f, 0x90, 0x91, 0x91, 0x88, 0x7b, 0x84, 0x8d,
-  0x93, 0x8d, 0x88, 0x8a, 0x89, 0x85, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7b,
-  0x77, 0x73, 0x70, 0x70, 0x6d, 0x64, 0x63, 0x69, 0x6b, 0x66, 0x4a, 0x39,
-  0x3b, 0x40, 0x46, 0x48, 0x41, 0x3c, 0x3b, 0x3e, 0x44, 0x4c, 0x53, 0x57,
-  0x5a, 0x5c, 0x5b, 0x5a, 0x58, 0x53, 0x4c, 0x4d, 0x51, 0x55, 0x5c, 0x63,
-  0x67, 0x6b, 0x6e, 0x72, 0x70, 0x63, 0x52, 0x47, 0x3c, 0x39, 0x48, 0x5c,
-  0x67, 0x6d, 0x60, 0x4d, 0x4e, 0x53, 0x5a, 0x52, 0x36, 0x2c, 0x2b, 0x2e,
-  0x2d, 0x2b, 0x2d, 0x33, 0x3c, 0x4b, 0x53, 0x4f, 0x4e, 0x4e, 0x4e, 0x47,
-  0x36, 0x34, 0x39, 0x44, 0x46, 0x45, 0x44, 0x46, 0x47, 0x4a, 0x52, 0x57,
-  0x59, 0x5d, 0x5f, 0x58, 0x4d, 0x47, 0x44, 0x4b, 0x57, 0x61, 0x65, 0x67,
-  0x6a, 0x6b, 0x6b, 0x6a, 0x6a, 0x66, 0x61, 0x61, 0x63, 0x68, 0x72, 0x79,
-  0x7d, 0x7d, 0x76, 0x6a, 0x65, 0x6c, 0x72, 0x7b, 0x82, 0x82, 0x7f, 0x7e,
-  0x80, 0x86, 0x8d, 0x91, 0x90, 0x8c, 0x82, 0x74, 0x67, 0x5f, 0x5c, 0x5b,
-  0x59, 0x57, 0x55, 0x53, 0x50, 0x4d, 0x4b, 0x4a, 0x4b, 0x4c, 0x4e, 0x52,
-  0x52, 0x53, 0x5c, 0x74, 0x8d, 0x98, 0x9e, 0xa3, 0xa6, 0xa7, 0xa7, 0xa6,
-  0xa4, 0xa0, 0x9e, 0x9e, 0x9e, 0xa1, 0xa5, 0xa8, 0xa8, 0xa9, 0xab, 0xac,
-  0xac, 0xab, 0xab, 0xab, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xad, 0xae,
-  0xae, 0xb0, 0xb3, 0xb5, 0xb5, 0xb5, 0xb4, 0xb1, 0x6d, 0x64, 0x60, 0x5e,
-  0x5b, 0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5b,
-  0x5a, 0x58, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59,
-  0x5a, 0x5b, 0x5c, 0x5d, 0x5d, 0x5e, 0x60, 0x60, 0x5f, 0x5e, 0x5f, 0x60,
-  0x62, 0x65, 0x67, 0x68, 0x6b, 0x6d, 0x6f, 0x71, 0x72, 0x75, 0x7b, 0x80,
-  0x83, 0x86, 0x88, 0x8c, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x90, 0x91, 0x90,
-  0x90, 0x8f, 0x90, 0x90, 0x90, 0x92, 0x96, 0x9e, 0xa2, 0xa5, 0xa6, 0xa7,
-  0xaa, 0xab, 0xaf, 0xb2, 0xb5, 0xb7, 0xbd, 0xc7, 0xce, 0xd4, 0xd9, 0xdc,
-  0xd4, 0xc5, 0xab, 0xa6, 0xa9, 0xa9, 0xa7, 0xa4, 0xa1, 0xa2, 0xa2, 0xa2,
-  0xa2, 0xa0, 0x9e, 0x9f, 0x9f, 0x9e, 0x9b, 0x97, 0x96, 0x94, 0x91, 0x92,
-  0x95, 0x97, 0x98, 0x92, 0x76, 0x69, 0x7c, 0x8a, 0x93, 0x90, 0x8a, 0x8b,
-  0x8c, 0x8b, 0x88, 0x84, 0x81, 0x7e, 0x7d, 0x7b, 0x78, 0x77, 0x74, 0x72,
-  0x71, 0x6e, 0x6f, 0x70, 0x70, 0x66, 0x41, 0x36, 0x3a, 0x3e, 0x44, 0x4b,
-  0x47, 0x3e, 0x3c, 0x3e, 0x44, 0x4d, 0x55, 0x59, 0x5c, 0x5f, 0x60, 0x5f,
-  0x5d, 0x58, 0x50, 0x4d, 0x4f, 0x52, 0x5a, 0x64, 0x68, 0x6b, 0x6e, 0x75,
-  0x79, 0x6d, 0x5d, 0x51, 0x42, 0x3c, 0x4b, 0x60, 0x6b, 0x70, 0x63, 0x4e,
-  0x4e, 0x53, 0x5b, 0x55, 0x39, 0x2b, 0x2a, 0x2e, 0x2e, 0x2d, 0x2a, 0x2e,
-  0x35, 0x45, 0x51, 0x52, 0x4f, 0x4f, 0x4f, 0x47, 0x37, 0x37, 0x3c, 0x47,
-  0x49, 0x48, 0x47, 0x47, 0x4a, 0x4d, 0x54, 0x58, 0x5b, 0x60, 0x61, 0x57,
-  0x4b, 0x45, 0x43, 0x4c, 0x5a, 0x63, 0x67, 0x6a, 0x6c, 0x6d, 0x6d, 0x6c,
-  0x6a, 0x64, 0x61, 0x64, 0x67, 0x6e, 0x78, 0x7d, 0x7e, 0x7a, 0x72, 0x69,
-  0x68, 0x70, 0x77, 0x7e, 0x82, 0x82, 0x80, 0x7f, 0x7f, 0x85, 0x8c, 0x92,
-  0x91, 0x8e, 0x85, 0x78, 0x6a, 0x60, 0x5c, 0x5b, 0x59, 0x58, 0x57, 0x56,
-  0x53, 0x51, 0x4e, 0x4c, 0x4c, 0x4c, 0x4d, 0x4e, 0x4e, 0x51, 0x5c, 0x75,
-  0x8c, 0x98, 0x9e, 0xa2, 0xa5, 0xa6, 0xa6, 0xa5, 0xa1, 0x9f, 0x9e, 0x9d,
-  0x9f, 0xa2, 0xa6, 0xa8, 0xa8, 0xa9, 0xaa, 0xab, 0xab, 0xac, 0xab, 0xac,
-  0xac, 0xab, 0xab, 0xab, 0xab, 0xac, 0xab, 0xac, 0xad, 0xaf, 0xb2, 0xb4,
-  0xb4, 0xb4, 0xb3, 0xb1, 0x6f, 0x67, 0x62, 0x60, 0x5d, 0x59, 0x59, 0x5a,
-  0x5a, 0x5b, 0x5d, 0x5e, 0x5e, 0x5d, 0x5c, 0x5a, 0x5a, 0x59, 0x58, 0x57,
-  0x57, 0x57, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x5b, 0x5c,
-  0x5d, 0x5e, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x60, 0x62, 0x65, 0x67, 0x69,
-  0x6b, 0x6d, 0x71, 0x72, 0x74, 0x78, 0x7d, 0x82, 0x85, 0x87, 0x8a, 0x8d,
-  0x8f, 0x90, 0x91, 0x92, 0x92, 0x91, 0x91, 0x91, 0x91, 0x90, 0x90, 0x90,
-  0x90, 0x91, 0x95, 0x9c, 0xa1, 0xa4, 0xa5, 0xa7, 0xa9, 0xab, 0xaf, 0xb3,
-  0xb6, 0xba, 0xc3, 0xce, 0xd4, 0xda, 0xdf, 0xe0, 0xd9, 0xc9, 0xac, 0xa4,
-  0xa8, 0xa8, 0xa8, 0xa7, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa2, 0x9e, 0x9d,
-  0x9d, 0x9d, 0x9a, 0x97, 0x96, 0x95, 0x93, 0x95, 0x98, 0x99, 0x97, 0x8b,
-  0x65, 0x5b, 0x75, 0x86, 0x91, 0x90, 0x8b, 0x8c, 0x8d, 0x8d, 0x8a, 0x86,
-  0x82, 0x80, 0x7e, 0x7e, 0x7b, 0x7a, 0x77, 0x75, 0x72, 0x71, 0x72, 0x72,
-  0x6f, 0x61, 0x3a, 0x33, 0x39, 0x3d, 0x43, 0x4c, 0x4b, 0x43, 0x3f, 0x40,
-  0x45, 0x4e, 0x56, 0x5b, 0x5e, 0x62, 0x63, 0x62, 0x60, 0x5b, 0x53, 0x4e,
-  0x4d, 0x50, 0x58, 0x63, 0x68, 0x6b, 0x6e, 0x76, 0x7e, 0x73, 0x65, 0x58,
-  0x45, 0x3e, 0x4d, 0x62, 0x6d, 0x71, 0x65, 0x4f, 0x4e, 0x53, 0x5b, 0x57,
-  0x3b, 0x2a, 0x28, 0x2d, 0x30, 0x2e, 0x2a, 0x2c, 0x32, 0x41, 0x51, 0x52,
-  0x50, 0x4f, 0x50, 0x47, 0x38, 0x39, 0x3f, 0x49, 0x4a, 0x49, 0x48, 0x49,
-  0x4b, 0x4f, 0x55, 0x5a, 0x5d, 0x62, 0x62, 0x55, 0x49, 0x44, 0x43, 0x4e,
-  0x5d, 0x65, 0x68, 0x6b, 0x6c, 0x6e, 0x6d, 0x6c, 0x69, 0x63, 0x61, 0x66,
-  0x6a, 0x71, 0x7b, 0x7e, 0x7b, 0x77, 0x6f, 0x68, 0x6a, 0x73, 0x79, 0x7f,
-  0x83, 0x82, 0x80, 0x7f, 0x7f, 0x85, 0x8c, 0x92, 0x92, 0x90, 0x87, 0x7a,
-  0x6d, 0x62, 0x5d, 0x5b, 0x58, 0x57, 0x57, 0x57, 0x55, 0x53, 0x50, 0x4f,
-  0x4f, 0x4e, 0x4e, 0x4e, 0x4f, 0x53, 0x60, 0x78, 0x8d, 0x99, 0x9d, 0xa1,
-  0xa3, 0xa5, 0xa5, 0xa4, 0xa1, 0x9f, 0x9d, 0x9d, 0x9e, 0xa1, 0xa5, 0xa7,
-  0xa8, 0xa9, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0xab, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xae, 0xb1, 0xb4, 0xb5, 0xb4, 0xb3, 0xb1,
-  0x71, 0x6a, 0x65, 0x63, 0x60, 0x5c, 0x5a, 0x5b, 0x5b, 0x5c, 0x5e, 0x5f,
-  0x5e, 0x5d, 0x5b, 0x5a, 0x5a, 0x59, 0x58, 0x58, 0x56, 0x56, 0x58, 0x58,
-  0x58, 0x59, 0x58, 0x59, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5e, 0x5e,
-  0x5d, 0x5e, 0x5e, 0x60, 0x62, 0x64, 0x66, 0x68, 0x6b, 0x6e, 0x71, 0x75,
-  0x78, 0x7b, 0x80, 0x85, 0x88, 0x89, 0x8b, 0x8e, 0x90, 0x91, 0x91, 0x93,
-  0x93, 0x91, 0x90, 0x91, 0x92, 0x92, 0x91, 0x91, 0x8f, 0x8f, 0x93, 0x99,
-  0x9f, 0xa2, 0xa3, 0xa5, 0xa7, 0xab, 0xb1, 0xb6, 0xbe, 0xc8, 0xd2, 0xd9,
-  0xdc, 0xdc, 0xdf, 0xe1, 0xde, 0xd1, 0xb5, 0xa7, 0xa5, 0xa5, 0xa6, 0xa9,
-  0xab, 0xaa, 0xa8, 0xa8, 0xa6, 0xa3, 0x9b, 0x99, 0x99, 0x9a, 0x9c, 0x9c,
-  0x9c, 0x9c, 0x9b, 0x9a, 0x99, 0x93, 0x8c, 0x79, 0x56, 0x53, 0x6e, 0x7e,
-  0x8b, 0x8f, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0x88, 0x85, 0x82, 0x82, 0x81,
-  0x80, 0x7e, 0x7a, 0x77, 0x74, 0x71, 0x71, 0x71, 0x6b, 0x55, 0x36, 0x32,
-  0x37, 0x3a, 0x40, 0x4b, 0x51, 0x4b, 0x46, 0x42, 0x46, 0x50, 0x58, 0x5d,
-  0x62, 0x66, 0x67, 0x66, 0x65, 0x60, 0x58, 0x51, 0x4e, 0x4e, 0x55, 0x62,
-  0x69, 0x6c, 0x6e, 0x76, 0x82, 0x7b, 0x70, 0x63, 0x4c, 0x3f, 0x50, 0x65,
-  0x70, 0x74, 0x69, 0x51, 0x4d, 0x52, 0x5c, 0x5b, 0x40, 0x2b, 0x26, 0x2d,
-  0x32, 0x30, 0x2c, 0x2b, 0x2e, 0x3c, 0x50, 0x55, 0x52, 0x51, 0x51, 0x48,
-  0x3a, 0x3d, 0x44, 0x4b, 0x4b, 0x4b, 0x4a, 0x4b, 0x4d, 0x51, 0x58, 0x5d,
-  0x61, 0x66, 0x63, 0x54, 0x46, 0x42, 0x43, 0x51, 0x61, 0x69, 0x6b, 0x6c,
-  0x6c, 0x6d, 0x6d, 0x6c, 0x68, 0x62, 0x63, 0x6a, 0x6f, 0x75, 0x7e, 0x7c,
-  0x75, 0x70, 0x6a, 0x68, 0x6d, 0x77, 0x7d, 0x82, 0x84, 0x82, 0x80, 0x7e,
-  0x7e, 0x84, 0x8c, 0x92, 0x94, 0x92, 0x8c, 0x7f, 0x70, 0x65, 0x60, 0x5c,
-  0x56, 0x56, 0x57, 0x56, 0x55, 0x54, 0x53, 0x52, 0x52, 0x52, 0x52, 0x51,
-  0x53, 0x59, 0x67, 0x7c, 0x8e, 0x97, 0x9c, 0x9f, 0xa1, 0xa3, 0xa2, 0xa1,
-  0xa0, 0x9f, 0x9c, 0x9c, 0x9d, 0xa0, 0xa4, 0xa6, 0xa9, 0xa9, 0xa9, 0xaa,
-  0xaa, 0xa8, 0xa8, 0xa8, 0xa9, 0xa9, 0xa8, 0xa8, 0xa9, 0xa8, 0xa7, 0xa6,
-  0xa7, 0xab, 0xaf, 0xb2, 0xb3, 0xb3, 0xb2, 0xb0, 0x75, 0x6e, 0x6b, 0x68,
-  0x65, 0x5f, 0x5c, 0x5c, 0x5d, 0x5e, 0x5f, 0x5e, 0x5e, 0x5d, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x59, 0x58, 0x57, 0x57, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59,
-  0x59, 0x5a, 0x5c, 0x5c, 0x5d, 0x5e, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x60,
-  0x64, 0x65, 0x67, 0x69, 0x6a, 0x6d, 0x73, 0x79, 0x7c, 0x7f, 0x83, 0x86,
-  0x89, 0x8b, 0x8e, 0x90, 0x91, 0x92, 0x92, 0x93, 0x93, 0x91, 0x91, 0x91,
-  0x92, 0x93, 0x91, 0x92, 0x90, 0x90, 0x91, 0x95, 0x9b, 0x9f, 0xa2, 0xa4,
-  0xa9, 0xb6, 0xc2, 0xca, 0xd2, 0xd9, 0xdc, 0xde, 0xde, 0xdd, 0xdd, 0xe0,
-  0xe1, 0xd9, 0xc5, 0xb3, 0xac, 0xa7, 0xa6, 0xa9, 0xa9, 0xa9, 0xa8, 0xa6,
-  0xa5, 0xa5, 0xa0, 0x9d, 0x9d, 0x9e, 0xa2, 0xa4, 0xa3, 0xa3, 0xa0, 0x9a,
-  0x90, 0x7e, 0x75, 0x71, 0x75, 0x7e, 0x84, 0x86, 0x88, 0x8a, 0x87, 0x87,
-  0x88, 0x87, 0x85, 0x82, 0x80, 0x80, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a,
-  0x78, 0x77, 0x71, 0x66, 0x5b, 0x4c, 0x40, 0x37, 0x36, 0x37, 0x3d, 0x47,
-  0x55, 0x58, 0x54, 0x49, 0x49, 0x54, 0x5d, 0x62, 0x66, 0x6b, 0x6b, 0x6c,
-  0x6b, 0x68, 0x61, 0x57, 0x51, 0x50, 0x53, 0x5d, 0x68, 0x6c, 0x6e, 0x74,
-  0x83, 0x88, 0x7d, 0x70, 0x59, 0x46, 0x52, 0x67, 0x72, 0x78, 0x6c, 0x52,
-  0x4e, 0x52, 0x5c, 0x5f, 0x48, 0x2e, 0x27, 0x2c, 0x33, 0x34, 0x30, 0x2e,
-  0x2f, 0x39, 0x4f, 0x5a, 0x58, 0x56, 0x55, 0x4a, 0x3b, 0x41, 0x48, 0x4e,
-  0x4d, 0x4c, 0x4c, 0x4d, 0x51, 0x56, 0x5d, 0x61, 0x64, 0x68, 0x64, 0x52,
-  0x45, 0x42, 0x47, 0x58, 0x68, 0x6d, 0x6f, 0x6e, 0x6d, 0x6d, 0x6c, 0x6b,
-  0x67, 0x62, 0x66, 0x6e, 0x73, 0x78, 0x7b, 0x75, 0x6d, 0x68, 0x64, 0x69,
-  0x73, 0x7b, 0x7f, 0x83, 0x84, 0x82, 0x7f, 0x7e, 0x7d, 0x83, 0x8b, 0x92,
-  0x94, 0x94, 0x90, 0x84, 0x74, 0x6a, 0x65, 0x5e, 0x57, 0x55, 0x55, 0x56,
-  0x55, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x5a, 0x60, 0x6d, 0x7f,
-  0x8e, 0x97, 0x9a, 0x9d, 0x9f, 0xa0, 0x9f, 0x9f, 0x9e, 0x9d, 0x9c, 0x9c,
-  0x9d, 0x9f, 0xa2, 0xa5, 0xa7, 0xa8, 0xa8, 0xa8, 0xa8, 0xa7, 0xa6, 0xa7,
-  0xa5, 0xa6, 0xa5, 0xa6, 0xa7, 0xa5, 0xa3, 0xa3, 0xa4, 0xa7, 0xab, 0xaf,
-  0xb1, 0xb1, 0xb0, 0xae, 0x77, 0x72, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x5e,
-  0x5e, 0x60, 0x60, 0x60, 0x5f, 0x5e, 0x5c, 0x5c, 0x5c, 0x5b, 0x5a, 0x58,
-  0x57, 0x57, 0x57, 0x58, 0x59, 0x59, 0x5a, 0x59, 0x5a, 0x5b, 0x5c, 0x5c,
-  0x5d, 0x5e, 0x5e, 0x5e, 0x61, 0x61, 0x61, 0x61, 0x64, 0x66, 0x68, 0x6a,
-  0x6c, 0x70, 0x78, 0x7c, 0x7f, 0x82, 0x85, 0x87, 0x8a, 0x8c, 0x8e, 0x91,
-  0x91, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x91,
-  0x90, 0x8f, 0x8e, 0x91, 0x99, 0xa1, 0xa7, 0xb1, 0xc1, 0xd0, 0xd7, 0xda,
-  0xdb, 0xdd, 0xdc, 0xdd, 0xde, 0xdd, 0xde, 0xe1, 0xe2, 0xe0, 0xd4, 0xbd,
-  0xb3, 0xaf, 0xae, 0xad, 0xac, 0xac, 0xab, 0xab, 0xa9, 0xaa, 0xa8, 0xa5,
-  0xa5, 0xa5, 0xa6, 0xa7, 0xa5, 0xa2, 0x9e, 0x97, 0x92, 0x8d, 0x8e, 0x96,
-  0xa8, 0xb2, 0xb3, 0xb1, 0xa7, 0x97, 0x87, 0x81, 0x7f, 0x7f, 0x81, 0x81,
-  0x80, 0x81, 0x81, 0x7f, 0x7c, 0x7e, 0x80, 0x80, 0x7d, 0x72, 0x61, 0x55,
-  0x52, 0x52, 0x51, 0x48, 0x3d, 0x39, 0x3a, 0x43, 0x56, 0x65, 0x66, 0x5a,
-  0x4e, 0x57, 0x62, 0x67, 0x6c, 0x6f, 0x6f, 0x70, 0x70, 0x6e, 0x67, 0x5f,
-  0x58, 0x54, 0x52, 0x59, 0x66, 0x6c, 0x6f, 0x72, 0x7f, 0x91, 0x8a, 0x80,
-  0x6a, 0x4f, 0x53, 0x67, 0x74, 0x7e, 0x6f, 0x53, 0x4d, 0x51, 0x5c, 0x62,
-  0x50, 0x36, 0x2b, 0x2a, 0x32, 0x36, 0x35, 0x32, 0x32, 0x37, 0x48, 0x5b,
-  0x5e, 0x5d, 0x59, 0x4d, 0x3e, 0x45, 0x4d, 0x52, 0x51, 0x50, 0x51, 0x53,
-  0x58, 0x5d, 0x61, 0x65, 0x67, 0x67, 0x61, 0x4f, 0x45, 0x44, 0x4d, 0x61,
-  0x6f, 0x72, 0x72, 0x6f, 0x6d, 0x6d, 0x6b, 0x69, 0x65, 0x63, 0x6a, 0x73,
-  0x76, 0x77, 0x73, 0x69, 0x60, 0x5d, 0x61, 0x6d, 0x77, 0x7e, 0x80, 0x83,
-  0x83, 0x81, 0x7f, 0x7d, 0x7c, 0x82, 0x89, 0x90, 0x94, 0x94, 0x93, 0x8c,
-  0x7c, 0x71, 0x6b, 0x62, 0x5a, 0x56, 0x55, 0x55, 0x54, 0x54, 0x55, 0x55,
-  0x55, 0x56, 0x56, 0x59, 0x5d, 0x63, 0x6f, 0x80, 0x8e, 0x95, 0x98, 0x9a,
-  0x9c, 0x9d, 0x9c, 0x9b, 0x9c, 0x9b, 0x9a, 0x9b, 0x9b, 0x9d, 0xa1, 0xa4,
-  0xa6, 0xa7, 0xa6, 0xa6, 0xa6, 0xa5, 0xa4, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3,
-  0xa4, 0xa2, 0x9f, 0x9f, 0x9f, 0xa1, 0xa6, 0xab, 0xad, 0xad, 0xac, 0xaa,
-  0x7a, 0x77, 0x74, 0x71, 0x6e, 0x68, 0x62, 0x60, 0x60, 0x61, 0x62, 0x61,
-  0x60, 0x5f, 0x5e, 0x5d, 0x5d, 0x5d, 0x5b, 0x59, 0x58, 0x59, 0x59, 0x59,
-  0x58, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x5e, 0x5e, 0x5e, 0x5f, 0x5e,
-  0x60, 0x60, 0x60, 0x61, 0x63, 0x67, 0x69, 0x6b, 0x6e, 0x74, 0x7b, 0x7f,
-  0x82, 0x84, 0x87, 0x89, 0x8c, 0x8d, 0x8f, 0x91, 0x91, 0x92, 0x92, 0x92,
-  0x93, 0x92, 0x92, 0x93, 0x92, 0x91, 0x8f, 0x8f, 0x8f, 0x90, 0x91, 0x9c,
-  0xae, 0xbe, 0xc6, 0xcf, 0xd8, 0xdc, 0xdd, 0xdc, 0xdc, 0xdd, 0xde, 0xdf,
-  0xe0, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xdd, 0xc9, 0xb8, 0xb3, 0xb1, 0xae,
-  0xac, 0xac, 0xac, 0xac, 0xab, 0xab, 0xa9, 0xa7, 0xa6, 0xa7, 0xa6, 0xa5,
-  0xa1, 0xa1, 0xa4, 0xad, 0xb6, 0xbb, 0xbd, 0xbe, 0xbf, 0xc0, 0xc2, 0xc2,
-  0xc0, 0xb9, 0xa5, 0x8a, 0x7b, 0x72, 0x77, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
-  0x7e, 0x79, 0x78, 0x74, 0x69, 0x5b, 0x55, 0x56, 0x59, 0x5e, 0x64, 0x5f,
-  0x54, 0x4a, 0x3e, 0x3f, 0x54, 0x6e, 0x7a, 0x78, 0x5c, 0x59, 0x64, 0x6b,
-  0x73, 0x77, 0x78, 0x78, 0x76, 0x73, 0x6e, 0x66, 0x60, 0x5b, 0x57, 0x56,
-  0x60, 0x6a, 0x6f, 0x72, 0x7c, 0x8e, 0x98, 0x93, 0x7b, 0x5e, 0x55, 0x63,
-  0x72, 0x80, 0x73, 0x55, 0x4e, 0x52, 0x5c, 0x63, 0x56, 0x40, 0x34, 0x2c,
-  0x30, 0x37, 0x39, 0x38, 0x37, 0x36, 0x3e, 0x53, 0x5f, 0x61, 0x5d, 0x4f,
-  0x42, 0x49, 0x4f, 0x54, 0x54, 0x54, 0x56, 0x5a, 0x60, 0x65, 0x66, 0x68,
-  0x68, 0x66, 0x5c, 0x4d, 0x45, 0x47, 0x54, 0x67, 0x71, 0x73, 0x73, 0x71,
-  0x6f, 0x6c, 0x69, 0x66, 0x62, 0x65, 0x6e, 0x74, 0x75, 0x70, 0x64, 0x59,
-  0x53, 0x55, 0x5f, 0x70, 0x7c, 0x82, 0x83, 0x83, 0x83, 0x81, 0x7e, 0x7c,
-  0x7c, 0x80, 0x89, 0x8f, 0x93, 0x94, 0x95, 0x91, 0x86, 0x7a, 0x72, 0x66,
-  0x5d, 0x57, 0x55, 0x55, 0x54, 0x54, 0x55, 0x54, 0x55, 0x55, 0x56, 0x5a,
-  0x5f, 0x64, 0x6e, 0x7f, 0x8c, 0x91, 0x94, 0x96, 0x98, 0x98, 0x98, 0x98,
-  0x99, 0x98, 0x99, 0x99, 0x99, 0x9c, 0x9f, 0xa3, 0xa4, 0xa5, 0xa5, 0xa5,
-  0xa4, 0xa3, 0xa3, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e, 0x9b, 0x9a,
-  0x9a, 0x9c, 0xa1, 0xa6, 0xa9, 0xa9, 0xa7, 0xa4, 0x7d, 0x7a, 0x77, 0x75,
-  0x71, 0x6c, 0x65, 0x62, 0x61, 0x61, 0x62, 0x62, 0x61, 0x60, 0x5e, 0x5d,
-  0x5c, 0x5c, 0x5b, 0x5a, 0x59, 0x5a, 0x59, 0x59, 0x58, 0x59, 0x5a, 0x5a,
-  0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x5f, 0x5f, 0x5d, 0x5e, 0x5f, 0x5f, 0x60,
-  0x63, 0x66, 0x69, 0x6c, 0x71, 0x77, 0x7e, 0x82, 0x83, 0x86, 0x89, 0x8b,
-  0x8d, 0x8e, 0x8f, 0x91, 0x92, 0x93, 0x93, 0x93, 0x92, 0x90, 0x90, 0x91,
-  0x91, 0x8f, 0x8d, 0x91, 0x99, 0xa0, 0xac, 0xbd, 0xcd, 0xd5, 0xd8, 0xda,
-  0xdc, 0xdc, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe2, 0xe3, 0xe1,
-  0xe2, 0xe2, 0xe0, 0xd2, 0xbb, 0xb2, 0xaf, 0xab, 0xa9, 0xa9, 0xaa, 0xaa,
-  0xa9, 0xa9, 0xa8, 0xa6, 0xa4, 0xa1, 0x9e, 0xa2, 0xa9, 0xaf, 0xb8, 0xc3,
-  0xc8, 0xca, 0xc9, 0xc7, 0xc7, 0xc7, 0xc9, 0xca, 0xc9, 0xc9, 0xc1, 0xb2,
-  0xa2, 0x87, 0x75, 0x73, 0x6d, 0x73, 0x79, 0x7a, 0x6c, 0x5e, 0x5a, 0x59,
-  0x56, 0x54, 0x59, 0x5e, 0x64, 0x6f, 0x7a, 0x78, 0x6c, 0x60, 0x4b, 0x3e,
-  0x52, 0x6c, 0x80, 0x8f, 0x70, 0x5b, 0x64, 0x6e, 0x79, 0x7e, 0x80, 0x80,
-  0x7d, 0x79, 0x73, 0x6d, 0x66, 0x61, 0x5a, 0x56, 0x5c, 0x68, 0x6e, 0x73,
-  0x78, 0x89, 0x9c, 0x9d, 0x88, 0x6c, 0x59, 0x60, 0x6c, 0x7d, 0x76, 0x58,
-  0x4f, 0x51, 0x5b, 0x64, 0x5a, 0x48, 0x3c, 0x31, 0x2f, 0x37, 0x3b, 0x3c,
-  0x3b, 0x38, 0x38, 0x4a, 0x5a, 0x5f, 0x5c, 0x51, 0x45, 0x4d, 0x53, 0x57,
-  0x57, 0x58, 0x5b, 0x5f, 0x65, 0x68, 0x68, 0x69, 0x68, 0x64, 0x58, 0x4a,
-  0x46, 0x4a, 0x58, 0x6a, 0x73, 0x74, 0x73, 0x71, 0x6f, 0x6b, 0x66, 0x63,
-  0x60, 0x66, 0x6f, 0x71, 0x6f, 0x66, 0x56, 0x4f, 0x4f, 0x54, 0x60, 0x72,
-  0x7d, 0x82, 0x83, 0x82, 0x82, 0x7f, 0x7d, 0x7c, 0x7c, 0x7f, 0x88, 0x8e,
-  0x92, 0x94, 0x95, 0x93, 0x8b, 0x82, 0x79, 0x6a, 0x5e, 0x58, 0x55, 0x54,
-  0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x5e, 0x62, 0x6b, 0x7c,
-  0x8a, 0x8e, 0x91, 0x93, 0x95, 0x96, 0x96, 0x97, 0x98, 0x98, 0x97, 0x97,
-  0x98, 0x9b, 0x9e, 0xa2, 0xa4, 0xa4, 0xa5, 0xa4, 0xa3, 0xa3, 0xa2, 0xa0,
-  0x9e, 0x9d, 0x9d, 0x9e, 0x9e, 0x9b, 0x99, 0x97, 0x96, 0x98, 0x9b, 0xa1,
-  0xa5, 0xa5, 0xa2, 0x9f, 0x80, 0x7c, 0x7a, 0x77, 0x74, 0x6e, 0x68, 0x63,
-  0x62, 0x61, 0x62, 0x62, 0x61, 0x60, 0x5e, 0x5d, 0x5c, 0x5c, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5b, 0x5d, 0x5d, 0x5e,
-  0x5f, 0x5f, 0x5f, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x63, 0x66, 0x69, 0x6b,
-  0x72, 0x79, 0x7f, 0x83, 0x85, 0x87, 0x8a, 0x8c, 0x8e, 0x8f, 0x8f, 0x91,
-  0x91, 0x93, 0x93, 0x93, 0x92, 0x8f, 0x8f, 0x8e, 0x8f, 0x91, 0x94, 0x9e,
-  0xaa, 0xb3, 0xc0, 0xcf, 0xd9, 0xdc, 0xdd, 0xdc, 0xdd, 0xdc, 0xdd, 0xde,
-  0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe0, 0xd5,
-  0xbd, 0xb1, 0xad, 0xa9, 0xa6, 0xa6, 0xa7, 0xa7, 0xa6, 0xa5, 0xa3, 0xa2,
-  0xa1, 0xa0, 0xa1, 0xa9, 0xb2, 0xba, 0xc4, 0xcb, 0xcd, 0xcc, 0xcb, 0xca,
-  0xca, 0xcc, 0xcd, 0xce, 0xce, 0xce, 0xcb, 0xc6, 0xbb, 0x9f, 0x85, 0x79,
-  0x69, 0x6e, 0x76, 0x7d, 0x67, 0x51, 0x4e, 0x4f, 0x53, 0x59, 0x62, 0x6b,
-  0x72, 0x7e, 0x89, 0x86, 0x7d, 0x71, 0x5a, 0x45, 0x50, 0x68, 0x7e, 0x98,
-  0x82, 0x61, 0x64, 0x6d, 0x7c, 0x84, 0x85, 0x85, 0x83, 0x7e, 0x78, 0x71,
-  0x6a, 0x64, 0x5d, 0x57, 0x5a, 0x65, 0x6d, 0x75, 0x77, 0x84, 0x9a, 0x9f,
-  0x90, 0x75, 0x5e, 0x60, 0x69, 0x79, 0x76, 0x5a, 0x4f, 0x51, 0x5c, 0x65,
-  0x5d, 0x4d, 0x41, 0x34, 0x30, 0x37, 0x3d, 0x3e, 0x3d, 0x3a, 0x38, 0x44,
-  0x53, 0x59, 0x58, 0x4f, 0x47, 0x50, 0x55, 0x59, 0x5a, 0x5d, 0x60, 0x63,
-  0x68, 0x6a, 0x69, 0x69, 0x67, 0x62, 0x55, 0x49, 0x48, 0x4c, 0x5b, 0x6c,
-  0x74, 0x75, 0x73, 0x70, 0x6f, 0x6a, 0x64, 0x61, 0x60, 0x67, 0x6d, 0x6d,
-  0x69, 0x5e, 0x4f, 0x4b, 0x4f, 0x55, 0x61, 0x72, 0x7e, 0x82, 0x83, 0x83,
-  0x81, 0x7e, 0x7c, 0x7c, 0x7a, 0x7e, 0x86, 0x8d, 0x91, 0x93, 0x95, 0x94,
-  0x8f, 0x86, 0x7e, 0x6f, 0x61, 0x59, 0x55, 0x53, 0x53, 0x53, 0x53, 0x55,
-  0x55, 0x54, 0x54, 0x57, 0x5c, 0x60, 0x68, 0x79, 0x87, 0x8d, 0x8f, 0x91,
-  0x93, 0x95, 0x95, 0x96, 0x97, 0x97, 0x96, 0x96, 0x97, 0x9a, 0x9d, 0xa1,
-  0xa3, 0xa4, 0xa5, 0xa4, 0xa2, 0xa2, 0xa1, 0x9f, 0x9c, 0x9b, 0x9c, 0x9c,
-  0x9c, 0x99, 0x96, 0x94, 0x93, 0x95, 0x98, 0x9e, 0xa2, 0xa2, 0x9e, 0x9a,
-  0x84, 0x80, 0x7d, 0x7b, 0x76, 0x70, 0x6b, 0x66, 0x64, 0x62, 0x63, 0x62,
-  0x62, 0x61, 0x60, 0x5e, 0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e,
-  0x5e, 0x5e, 0x5f, 0x61, 0x63, 0x65, 0x69, 0x6d, 0x74, 0x7b, 0x81, 0x85,
-  0x86, 0x88, 0x8a, 0x8d, 0x8f, 0x8f, 0x8f, 0x90, 0x90, 0x92, 0x92, 0x91,
-  0x8f, 0x8e, 0x8e, 0x90, 0x95, 0xa0, 0xb0, 0xc0, 0xca, 0xcf, 0xd5, 0xda,
-  0xdc, 0xdc, 0xdc, 0xdd, 0xdf, 0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1,
-  0xe1, 0xe2, 0xe1, 0xdf, 0xe0, 0xdf, 0xdd, 0xd3, 0xc0, 0xb2, 0xac, 0xa8,
-  0xa5, 0xa4, 0xa2, 0xa1, 0xa0, 0x9d, 0x9c, 0x9f, 0xa1, 0xa7, 0xb0, 0xbc,
-  0xc3, 0xc7, 0xcc, 0xce, 0xcd, 0xcc, 0xcc, 0xce, 0xd1, 0xd3, 0xd2, 0xd2,
-  0xd2, 0xd1, 0xcf, 0xce, 0xcb, 0xc0, 0xaa, 0x95, 0x7a, 0x72, 0x7c, 0x8e,
-  0x77, 0x55, 0x4f, 0x53, 0x5f, 0x6b, 0x7a, 0x87, 0x8e, 0x94, 0x99, 0x97,
-  0x91, 0x89, 0x75, 0x57, 0x51, 0x62, 0x76, 0x97, 0x9b, 0x73, 0x67, 0x6c,
-  0x7d, 0x89, 0x8c, 0x8b, 0x8a, 0x85, 0x80, 0x76, 0x6f, 0x69, 0x62, 0x59,
-  0x58, 0x5f, 0x68, 0x75, 0x77, 0x7e, 0x92, 0x9c, 0x9c, 0x81, 0x68, 0x61,
-  0x64, 0x72, 0x75, 0x5d, 0x51, 0x51, 0x5b, 0x66, 0x60, 0x51, 0x46, 0x3a,
-  0x34, 0x39, 0x3f, 0x40, 0x40, 0x3e, 0x3a, 0x3d, 0x47, 0x4c, 0x4f, 0x4b,
-  0x4a, 0x54, 0x5a, 0x5c, 0x5f, 0x65, 0x68, 0x6a, 0x6c, 0x6c, 0x69, 0x67,
-  0x65, 0x5e, 0x51, 0x48, 0x4b, 0x52, 0x61, 0x6f, 0x75, 0x73, 0x71, 0x6f,
-  0x6d, 0x67, 0x61, 0x5f, 0x60, 0x67, 0x69, 0x64, 0x5e, 0x54, 0x49, 0x4a,
-  0x50, 0x57, 0x64, 0x74, 0x7f, 0x82, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7b,
-  0x79, 0x7b, 0x83, 0x8c, 0x90, 0x92, 0x94, 0x95, 0x92, 0x8d, 0x87, 0x79,
-  0x69, 0x5d, 0x57, 0x54, 0x52, 0x51, 0x52, 0x53, 0x54, 0x53, 0x53, 0x55,
-  0x59, 0x5c, 0x64, 0x73, 0x83, 0x89, 0x8c, 0x8f, 0x90, 0x93, 0x93, 0x94,
-  0x94, 0x94, 0x95, 0x94, 0x95, 0x98, 0x9b, 0x9f, 0xa0, 0xa1, 0xa3, 0xa3,
-  0xa1, 0xa0, 0x9f, 0x9d, 0x9a, 0x99, 0x9a, 0x9b, 0x9a, 0x96, 0x93, 0x91,
-  0x90, 0x91, 0x94, 0x99, 0x9b, 0x9b, 0x98, 0x94, 0x87, 0x84, 0x80, 0x7e,
-  0x7b, 0x75, 0x6f, 0x68, 0x65, 0x63, 0x64, 0x62, 0x62, 0x62, 0x61, 0x5f,
-  0x5d, 0x5c, 0x5c, 0x5b, 0x5c, 0x5a, 0x59, 0x59, 0x5a, 0x5c, 0x5c, 0x5b,
-  0x5b, 0x5c, 0x5d, 0x5d, 0x5d, 0x5c, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61,
-  0x64, 0x67, 0x6b, 0x6f, 0x77, 0x7d, 0x82, 0x85, 0x87, 0x8a, 0x8c, 0x8e,
-  0x8e, 0x8e, 0x8f, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8f, 0x96, 0xa0, 0xa9,
-  0xb8, 0xc7, 0xd2, 0xd8, 0xda, 0xdb, 0xdc, 0xdd, 0xdd, 0xdd, 0xde, 0xdf,
-  0xdf, 0xe0, 0xdf, 0xdf, 0xe0, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf,
-  0xe0, 0xde, 0xdb, 0xd2, 0xc8, 0xc1, 0xbc, 0xb6, 0xb3, 0xaf, 0xac, 0xaa,
-  0xa7, 0xaa, 0xaf, 0xb4, 0xb8, 0xbc, 0xc1, 0xc8, 0xcc, 0xcd, 0xce, 0xcf,
-  0xcf, 0xcf, 0xd0, 0xd2, 0xd6, 0xd8, 0xd7, 0xd6, 0xd6, 0xd6, 0xd4, 0xd3,
-  0xd2, 0xd0, 0xc8, 0xb8, 0x9c, 0x86, 0x8a, 0xa5, 0xa5, 0x76, 0x5c, 0x5c,
-  0x73, 0x8a, 0x99, 0xa2, 0xa6, 0xa8, 0xa9, 0xa6, 0xa1, 0x9b, 0x8f, 0x75,
-  0x5d, 0x60, 0x6c, 0x88, 0xa9, 0x97, 0x76, 0x6d, 0x79, 0x8c, 0x93, 0x93,
-  0x91, 0x8d, 0x88, 0x7f, 0x77, 0x71, 0x69, 0x5f, 0x58, 0x59, 0x61, 0x73,
-  0x7b, 0x7a, 0x85, 0x92, 0xa1, 0x93, 0x78, 0x69, 0x66, 0x6d, 0x73, 0x60,
-  0x52, 0x51, 0x5a, 0x66, 0x65, 0x57, 0x4d, 0x42, 0x3d, 0x40, 0x44, 0x45,
-  0x44, 0x41, 0x3e, 0x3b, 0x3d, 0x40, 0x44, 0x46, 0x4e, 0x5b, 0x61, 0x62,
-  0x65, 0x6d, 0x6f, 0x6f, 0x6f, 0x6d, 0x6a, 0x66, 0x62, 0x5a, 0x4e, 0x48,
-  0x4f, 0x59, 0x68, 0x73, 0x75, 0x70, 0x6d, 0x6c, 0x6c, 0x65, 0x5f, 0x5e,
-  0x61, 0x66, 0x61, 0x56, 0x4f, 0x4a, 0x49, 0x4e, 0x53, 0x5a, 0x68, 0x77,
-  0x80, 0x82, 0x82, 0x82, 0x80, 0x7d, 0x7b, 0x7a, 0x78, 0x7a, 0x81, 0x8a,
-  0x8e, 0x91, 0x93, 0x96, 0x94, 0x91, 0x8e, 0x85, 0x74, 0x67, 0x5f, 0x5b,
-  0x57, 0x54, 0x53, 0x53, 0x53, 0x54, 0x54, 0x57, 0x5a, 0x5d, 0x63, 0x70,
-  0x7e, 0x86, 0x88, 0x8b, 0x8f, 0x90, 0x90, 0x90, 0x91, 0x92, 0x94, 0x94,
-  0x94, 0x95, 0x98, 0x9d, 0x9f, 0xa0, 0xa0, 0xa1, 0xa0, 0x9f, 0x9d, 0x9b,
-  0x98, 0x97, 0x99, 0x99, 0x97, 0x94, 0x91, 0x8e, 0x8d, 0x8d, 0x90, 0x93,
-  0x94, 0x94, 0x91, 0x8d, 0x8a, 0x86, 0x83, 0x81, 0x7e, 0x78, 0x71, 0x6b,
-  0x68, 0x65, 0x65, 0x63, 0x61, 0x61, 0x60, 0x60, 0x5d, 0x5d, 0x5d, 0x5d,
-  0x5c, 0x5a, 0x5a, 0x5a, 0x5c, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5e,
-  0x5d, 0x5c, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x62, 0x65, 0x68, 0x6d, 0x71,
-  0x78, 0x7e, 0x83, 0x86, 0x88, 0x8b, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e,
-  0x8d, 0x8e, 0x91, 0x99, 0xaa, 0xbe, 0xcb, 0xd1, 0xd6, 0xda, 0xdb, 0xdc,
-  0xdc, 0xdc, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde,
-  0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe1, 0xe2, 0xe2, 0xe3, 0xe1, 0xdd,
-  0xd8, 0xd6, 0xd4, 0xd1, 0xcf, 0xcd, 0xcb, 0xca, 0xc8, 0xc4, 0xc4, 0xc2,
-  0xc2, 0xc2, 0xc5, 0xc8, 0xca, 0xcb, 0xcc, 0xce, 0xcf, 0xd2, 0xd4, 0xd5,
-  0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd9, 0xd8, 0xd7, 0xd6, 0xd4, 0xd1, 0xcc,
-  0xbd, 0xa7, 0x9c, 0x9d, 0xb6, 0xa3, 0x76, 0x6b, 0x80, 0xa0, 0xaf, 0xb3,
-  0xb4, 0xb3, 0xb2, 0xae, 0xa9, 0xa5, 0x9d, 0x8d, 0x75, 0x67, 0x68, 0x7b,
-  0xa2, 0xb3, 0x99, 0x84, 0x74, 0x86, 0x95, 0x99, 0x98, 0x95, 0x90, 0x8b,
-  0x82, 0x7c, 0x72, 0x66, 0x5c, 0x57, 0x5b, 0x6a, 0x7d, 0x7c, 0x7e, 0x87,
-  0x9b, 0xa1, 0x8a, 0x7a, 0x74, 0x72, 0x71, 0x60, 0x52, 0x51, 0x5a, 0x66,
-  0x68, 0x5d, 0x55, 0x49, 0x46, 0x4b, 0x4e, 0x4d, 0x4a, 0x45, 0x3f, 0x3b,
-  0x3a, 0x3b, 0x3f, 0x4a, 0x59, 0x64, 0x68, 0x68, 0x6a, 0x6f, 0x70, 0x70,
-  0x70, 0x6c, 0x68, 0x61, 0x5d, 0x55, 0x49, 0x49, 0x56, 0x60, 0x6d, 0x74,
-  0x72, 0x6c, 0x6a, 0x6b, 0x69, 0x62, 0x5e, 0x5e, 0x62, 0x63, 0x57, 0x4c,
-  0x49, 0x4a, 0x4d, 0x52, 0x58, 0x5f, 0x6b, 0x77, 0x7e, 0x80, 0x81, 0x80,
-  0x7f, 0x7e, 0x7c, 0x7a, 0x78, 0x79, 0x7f, 0x87, 0x8c, 0x8f, 0x92, 0x95,
-  0x96, 0x94, 0x92, 0x8c, 0x7f, 0x70, 0x68, 0x64, 0x5e, 0x5b, 0x59, 0x58,
-  0x59, 0x59, 0x5b, 0x5c, 0x5d, 0x5f, 0x65, 0x70, 0x7d, 0x85, 0x88, 0x8b,
-  0x8d, 0x8f, 0x90, 0x8f, 0x90, 0x91, 0x93, 0x94, 0x94, 0x94, 0x96, 0x9a,
-  0x9c, 0x9d, 0x9e, 0x9e, 0x9f, 0x9e, 0x9d, 0x9b, 0x98, 0x97, 0x97, 0x97,
-  0x96, 0x94, 0x90, 0x8d, 0x8c, 0x8b, 0x8e, 0x8f, 0x8e, 0x8d, 0x8c, 0x88,
-  0x8c, 0x89, 0x86, 0x84, 0x82, 0x7b, 0x75, 0x6e, 0x6b, 0x67, 0x65, 0x65,
-  0x62, 0x61, 0x60, 0x60, 0x5f, 0x5e, 0x5e, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c,
-  0x5d, 0x5d, 0x5c, 0x5d, 0x5d, 0x5c, 0x5e, 0x5e, 0x5e, 0x5d, 0x5c, 0x5d,
-  0x5d, 0x5e, 0x5f, 0x62, 0x65, 0x69, 0x6f, 0x74, 0x7a, 0x7f, 0x84, 0x87,
-  0x89, 0x8b, 0x8c, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8f, 0x9c, 0xa8, 0xb9,
-  0xcb, 0xd5, 0xda, 0xdb, 0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd,
-  0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe2,
-  0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe0, 0xdd, 0xdc, 0xdc, 0xda,
-  0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd3, 0xd2, 0xd2, 0xd0, 0xcd, 0xcc, 0xc9,
-  0xc7, 0xc8, 0xc9, 0xcd, 0xd0, 0xd5, 0xd7, 0xd8, 0xd9, 0xd9, 0xda, 0xda,
-  0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd6, 0xd4, 0xd3, 0xcd, 0xc1, 0xb3, 0xa0,
-  0xab, 0xb6, 0x93, 0x80, 0x82, 0xa5, 0xb8, 0xba, 0xba, 0xb8, 0xb5, 0xb1,
-  0xad, 0xa9, 0xa4, 0x99, 0x85, 0x70, 0x6b, 0x77, 0x98, 0xb7, 0xb4, 0xa0,
-  0x7c, 0x7f, 0x93, 0x9b, 0x9c, 0x9b, 0x97, 0x91, 0x89, 0x83, 0x79, 0x6d,
-  0x61, 0x59, 0x58, 0x63, 0x7c, 0x7f, 0x7e, 0x82, 0x92, 0xa4, 0x98, 0x88,
-  0x80, 0x7b, 0x74, 0x60, 0x53, 0x51, 0x5a, 0x65, 0x6a, 0x62, 0x5a, 0x4e,
-  0x4a, 0x51, 0x56, 0x52, 0x4d, 0x46, 0x3d, 0x3a, 0x3a, 0x3c, 0x45, 0x57,
-  0x66, 0x6d, 0x6e, 0x6b, 0x6d, 0x6f, 0x70, 0x70, 0x71, 0x6d, 0x65, 0x5e,
-  0x59, 0x51, 0x47, 0x4c, 0x5a, 0x64, 0x6e, 0x74, 0x6f, 0x69, 0x67, 0x69,
-  0x66, 0x5f, 0x5d, 0x5f, 0x63, 0x5f, 0x51, 0x4a, 0x49, 0x4c, 0x4f, 0x55,
-  0x5b, 0x61, 0x6c, 0x77, 0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x7a,
-  0x77, 0x78, 0x7e, 0x86, 0x8a, 0x8d, 0x91, 0x94, 0x97, 0x97, 0x95, 0x90,
-  0x86, 0x77, 0x6e, 0x69, 0x63, 0x5f, 0x5e, 0x5e, 0x5e, 0x5e, 0x5f, 0x5e,
-  0x5f, 0x62, 0x67, 0x71, 0x7d, 0x84, 0x88, 0x8a, 0x8c, 0x8e, 0x8f, 0x8f,
-  0x90, 0x91, 0x92, 0x92, 0x92, 0x93, 0x95, 0x97, 0x9a, 0x9b, 0x9d, 0x9d,
-  0x9e, 0x9d, 0x9d, 0x9a, 0x97, 0x96, 0x97, 0x97, 0x95, 0x94, 0x91, 0x8e,
-  0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x88, 0x84, 0x8d, 0x8a, 0x89, 0x87,
-  0x83, 0x7d, 0x77, 0x70, 0x6c, 0x68, 0x65, 0x65, 0x63, 0x62, 0x61, 0x61,
-  0x60, 0x5f, 0x5f, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d,
-  0x5d, 0x5d, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x61,
-  0x65, 0x6a, 0x70, 0x75, 0x7a, 0x7f, 0x84, 0x88, 0x88, 0x8a, 0x8b, 0x8d,
-  0x8d, 0x8c, 0x8b, 0x8d, 0x9a, 0xae, 0xbb, 0xcc, 0xd7, 0xdb, 0xdb, 0xdc,
-  0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xdf, 0xdf,
-  0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3,
-  0xe3, 0xe2, 0xe1, 0xe0, 0xde, 0xdd, 0xdc, 0xdc, 0xda, 0xda, 0xdb, 0xdb,
-  0xda, 0xd8, 0xd9, 0xd8, 0xd7, 0xd4, 0xd2, 0xce, 0xcb, 0xcb, 0xcb, 0xce,
-  0xd1, 0xd5, 0xd7, 0xd8, 0xda, 0xd9, 0xdb, 0xdb, 0xda, 0xdb, 0xda, 0xda,
-  0xda, 0xd8, 0xd5, 0xd4, 0xd2, 0xcb, 0xbf, 0xa8, 0xa5, 0xb8, 0xa3, 0x8f,
-  0x83, 0xa3, 0xba, 0xbd, 0xbd, 0xbb, 0xb7, 0xb3, 0xaf, 0xab, 0xa7, 0x9e,
-  0x8d, 0x79, 0x70, 0x74, 0x91, 0xb4, 0xbf, 0xb1, 0x8a, 0x7c, 0x8e, 0x99,
-  0x9c, 0x9d, 0x9a, 0x94, 0x8d, 0x87, 0x7c, 0x71, 0x65, 0x5c, 0x59, 0x5f,
-  0x78, 0x80, 0x7e, 0x80, 0x8d, 0xa3, 0x9f, 0x91, 0x89, 0x82, 0x77, 0x60,
-  0x53, 0x52, 0x59, 0x64, 0x6a, 0x65, 0x5d, 0x51, 0x4c, 0x53, 0x59, 0x57,
-  0x52, 0x47, 0x39, 0x36, 0x3c, 0x43, 0x4f, 0x63, 0x6e, 0x70, 0x6f, 0x6d,
-  0x6f, 0x6f, 0x6f, 0x70, 0x71, 0x6c, 0x63, 0x5b, 0x56, 0x4e, 0x47, 0x4f,
-  0x5e, 0x67, 0x6f, 0x73, 0x6e, 0x68, 0x66, 0x67, 0x64, 0x5e, 0x5e, 0x60,
-  0x64, 0x5d, 0x4e, 0x4a, 0x4a, 0x4e, 0x51, 0x57, 0x5e, 0x64, 0x6e, 0x77,
-  0x7d, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7b, 0x79, 0x77, 0x77, 0x7d, 0x84,
-  0x89, 0x8b, 0x90, 0x94, 0x97, 0x97, 0x96, 0x93, 0x8a, 0x7c, 0x73, 0x6d,
-  0x66, 0x62, 0x61, 0x61, 0x61, 0x60, 0x61, 0x61, 0x62, 0x64, 0x68, 0x72,
-  0x7d, 0x84, 0x88, 0x8b, 0x8c, 0x8e, 0x8f, 0x90, 0x91, 0x91, 0x91, 0x91,
-  0x91, 0x92, 0x95, 0x96, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9b, 0x9b, 0x99,
-  0x97, 0x96, 0x97, 0x97, 0x95, 0x94, 0x91, 0x8e, 0x8d, 0x8c, 0x8c, 0x8b,
-  0x8a, 0x89, 0x87, 0x82, 0x90, 0x8d, 0x8a, 0x88, 0x85, 0x80, 0x77, 0x72,
-  0x6f, 0x69, 0x66, 0x65, 0x64, 0x63, 0x62, 0x61, 0x5f, 0x5e, 0x5d, 0x5d,
-  0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c,
-  0x5e, 0x5e, 0x5c, 0x5d, 0x5d, 0x5d, 0x5e, 0x61, 0x66, 0x6c, 0x72, 0x76,
-  0x7b, 0x80, 0x85, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x89, 0x89, 0x8d, 0x9d,
-  0xba, 0xcd, 0xd4, 0xd9, 0xdb, 0xdc, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xdd,
-  0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xe1,
-  0xe1, 0xe2, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xdf,
-  0xdd, 0xdd, 0xdc, 0xdc, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda,
-  0xda, 0xda, 0xd8, 0xd7, 0xd7, 0xd6, 0xd4, 0xd2, 0xd2, 0xd4, 0xd5, 0xd7,
-  0xd9, 0xd9, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xda, 0xd7, 0xd5,
-  0xd3, 0xd1, 0xcb, 0xba, 0xa6, 0xae, 0xb1, 0xa3, 0x88, 0x9c, 0xb8, 0xc0,
-  0xc0, 0xbe, 0xb9, 0xb5, 0xb1, 0xaf, 0xac, 0xa3, 0x95, 0x86, 0x7b, 0x73,
-  0x87, 0xa9, 0xc0, 0xbf, 0xa3, 0x7e, 0x84, 0x8e, 0x95, 0x9b, 0x9c, 0x98,
-  0x92, 0x8c, 0x83, 0x77, 0x6c, 0x62, 0x5c, 0x5c, 0x6d, 0x7e, 0x80, 0x80,
-  0x88, 0x9e, 0xa5, 0x9f, 0x99, 0x8f, 0x7d, 0x60, 0x53, 0x52, 0x57, 0x61,
-  0x68, 0x66, 0x61, 0x56, 0x50, 0x55, 0x5b, 0x5c, 0x59, 0x4b, 0x34, 0x32,
-  0x47, 0x55, 0x65, 0x74, 0x76, 0x72, 0x6f, 0x6f, 0x73, 0x71, 0x70, 0x70,
-  0x71, 0x6a, 0x60, 0x58, 0x53, 0x4c, 0x49, 0x55, 0x64, 0x6b, 0x71, 0x72,
-  0x6c, 0x65, 0x63, 0x64, 0x61, 0x5d, 0x60, 0x63, 0x63, 0x5a, 0x4d, 0x4b,
-  0x4d, 0x4f, 0x53, 0x5b, 0x64, 0x6a, 0x71, 0x78, 0x7d, 0x7f, 0x7f, 0x7f,
-  0x7d, 0x7c, 0x7a, 0x78, 0x76, 0x75, 0x7b, 0x83, 0x87, 0x8a, 0x8e, 0x93,
-  0x97, 0x98, 0x98, 0x96, 0x8e, 0x84, 0x7a, 0x74, 0x6c, 0x66, 0x65, 0x64,
-  0x63, 0x63, 0x64, 0x64, 0x66, 0x68, 0x6d, 0x75, 0x7f, 0x85, 0x88, 0x8b,
-  0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x90, 0x93, 0x95,
-  0x97, 0x98, 0x99, 0x9b, 0x9b, 0x99, 0x98, 0x98, 0x97, 0x95, 0x96, 0x95,
-  0x95, 0x94, 0x92, 0x8f, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x87, 0x82,
-  0x91, 0x8e, 0x8d, 0x8b, 0x88, 0x83, 0x7c, 0x76, 0x72, 0x6b, 0x67, 0x66,
-  0x65, 0x64, 0x63, 0x62, 0x5f, 0x5e, 0x5d, 0x5e, 0x5d, 0x5d, 0x5c, 0x5c,
-  0x5c, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5d, 0x5c, 0x5e,
-  0x5f, 0x5e, 0x5f, 0x63, 0x68, 0x6e, 0x72, 0x76, 0x7b, 0x80, 0x84, 0x85,
-  0x86, 0x87, 0x87, 0x86, 0x89, 0x91, 0xa6, 0xc5, 0xd7, 0xdb, 0xdc, 0xdb,
-  0xdb, 0xdd, 0xdc, 0xdd, 0xdc, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xe1, 0xe1, 0xe1, 0xe0, 0xe1, 0xe0, 0xdf, 0xdf, 0xde, 0xdd, 0xdc, 0xdb,
-  0xda, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9,
-  0xdb, 0xdc, 0xdc, 0xda, 0xd7, 0xd6, 0xd6, 0xd6, 0xd8, 0xd9, 0xda, 0xda,
-  0xdb, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xd9, 0xd6, 0xd5, 0xd3, 0xd1, 0xcc,
-  0xb9, 0xa9, 0xb1, 0xac, 0x94, 0x8e, 0xad, 0xbc, 0xc0, 0xc0, 0xbc, 0xb8,
-  0xb5, 0xb3, 0xaf, 0xa9, 0x9f, 0x94, 0x8a, 0x7b, 0x7b, 0x98, 0xb4, 0xbe,
-  0xba, 0x92, 0x79, 0x78, 0x81, 0x94, 0x9e, 0x9d, 0x99, 0x94, 0x8d, 0x80,
-  0x73, 0x6a, 0x64, 0x5c, 0x62, 0x77, 0x82, 0x84, 0x85, 0x97, 0xa6, 0xa7,
-  0xa5, 0x9e, 0x88, 0x61, 0x54, 0x54, 0x58, 0x5d, 0x64, 0x66, 0x64, 0x5d,
-  0x56, 0x58, 0x5d, 0x60, 0x5e, 0x50, 0x37, 0x3d, 0x5f, 0x71, 0x7c, 0x81,
-  0x7a, 0x72, 0x71, 0x73, 0x76, 0x72, 0x70, 0x6f, 0x6e, 0x65, 0x5c, 0x55,
-  0x50, 0x4a, 0x4c, 0x5d, 0x6a, 0x70, 0x73, 0x71, 0x69, 0x64, 0x63, 0x62,
-  0x5c, 0x5e, 0x63, 0x65, 0x62, 0x55, 0x4e, 0x4f, 0x50, 0x52, 0x57, 0x60,
-  0x6b, 0x70, 0x75, 0x79, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7b, 0x79, 0x77,
-  0x74, 0x74, 0x78, 0x81, 0x86, 0x89, 0x8c, 0x93, 0x96, 0x99, 0x9a, 0x98,
-  0x92, 0x8a, 0x82, 0x7d, 0x74, 0x6d, 0x69, 0x68, 0x68, 0x69, 0x6a, 0x6c,
-  0x70, 0x72, 0x76, 0x7b, 0x82, 0x86, 0x88, 0x89, 0x8d, 0x90, 0x90, 0x90,
-  0x91, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x91, 0x92, 0x95, 0x96, 0x97, 0x98,
-  0x99, 0x97, 0x96, 0x96, 0x95, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x8f,
-  0x8f, 0x90, 0x8f, 0x8d, 0x8d, 0x8b, 0x88, 0x84, 0x93, 0x90, 0x8e, 0x8c,
-  0x89, 0x84, 0x7e, 0x79, 0x74, 0x6e, 0x69, 0x67, 0x66, 0x64, 0x63, 0x62,
-  0x60, 0x5e, 0x5d, 0x5e, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5f, 0x60, 0x60, 0x60, 0x63,
-  0x69, 0x6f, 0x74, 0x77, 0x7b, 0x80, 0x84, 0x86, 0x86, 0x85, 0x85, 0x93,
-  0xab, 0xbb, 0xce, 0xda, 0xdc, 0xdb, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd,
-  0xdc, 0xdc, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1,
-  0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdd, 0xdd, 0xdd, 0xdb, 0xda, 0xd9, 0xd9,
-  0xd9, 0xd8, 0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd7, 0xd9, 0xd9, 0xd9, 0xda,
-  0xdb, 0xda, 0xda, 0xda, 0xd8, 0xd8, 0xd9, 0xda, 0xdb, 0xdb, 0xdb, 0xda,
-  0xda, 0xd9, 0xd9, 0xd7, 0xd7, 0xd5, 0xd4, 0xd2, 0xca, 0xb9, 0xad, 0xa9,
-  0x9f, 0x86, 0x9c, 0xb3, 0xbc, 0xbf, 0xbe, 0xba, 0xb8, 0xb6, 0xb3, 0xad,
-  0xa5, 0x9d, 0x96, 0x88, 0x77, 0x82, 0x9e, 0xb1, 0xc0, 0xae, 0x84, 0x75,
-  0x78, 0x88, 0x9b, 0xa1, 0x9e, 0x9b, 0x95, 0x88, 0x7b, 0x72, 0x6c, 0x62,
-  0x5e, 0x6d, 0x7c, 0x81, 0x84, 0x91, 0xa2, 0xa8, 0xa9, 0xa5, 0x90, 0x64,
-  0x56, 0x55, 0x57, 0x5b, 0x61, 0x65, 0x66, 0x62, 0x5c, 0x5c, 0x60, 0x62,
-  0x5f, 0x52, 0x41, 0x59, 0x77, 0x84, 0x86, 0x82, 0x7a, 0x74, 0x74, 0x78,
-  0x79, 0x73, 0x70, 0x6f, 0x6a, 0x61, 0x59, 0x52, 0x4d, 0x48, 0x52, 0x64,
-  0x6f, 0x73, 0x74, 0x70, 0x68, 0x64, 0x62, 0x5f, 0x5b, 0x60, 0x65, 0x65,
-  0x5e, 0x52, 0x51, 0x52, 0x53, 0x56, 0x5c, 0x67, 0x71, 0x75, 0x78, 0x7a,
-  0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7b, 0x78, 0x75, 0x73, 0x72, 0x76, 0x7e,
-  0x84, 0x88, 0x8d, 0x93, 0x97, 0x9b, 0x9c, 0x9c, 0x97, 0x90, 0x8a, 0x86,
-  0x7e, 0x76, 0x70, 0x6e, 0x6e, 0x70, 0x73, 0x77, 0x7c, 0x7f, 0x80, 0x83,
-  0x85, 0x87, 0x89, 0x89, 0x8d, 0x8f, 0x90, 0x90, 0x91, 0x90, 0x90, 0x90,
-  0x8f, 0x8e, 0x8f, 0x91, 0x92, 0x93, 0x95, 0x96, 0x96, 0x94, 0x93, 0x92,
-  0x92, 0x90, 0x8f, 0x90, 0x91, 0x93, 0x93, 0x91, 0x90, 0x91, 0x90, 0x8f,
-  0x8d, 0x8c, 0x8a, 0x87, 0x95, 0x91, 0x90, 0x8e, 0x8b, 0x87, 0x80, 0x7a,
-  0x76, 0x6f, 0x69, 0x68, 0x66, 0x64, 0x63, 0x63, 0x62, 0x5f, 0x5f, 0x5f,
-  0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5c, 0x5d, 0x5d,
-  0x5c, 0x5c, 0x5d, 0x5e, 0x60, 0x5f, 0x60, 0x62, 0x68, 0x70, 0x74, 0x77,
-  0x7b, 0x80, 0x83, 0x84, 0x83, 0x80, 0x8d, 0xb4, 0xcd, 0xd8, 0xdd, 0xdd,
-  0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xde, 0xde,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xde, 0xde, 0xde,
-  0xde, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe1, 0xe1, 0xe1, 0xe0, 0xdf, 0xde, 0xdd, 0xdd, 0xdc, 0xda, 0xda, 0xd8,
-  0xd8, 0xd7, 0xd6, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xda, 0xdb, 0xdc,
-  0xdb, 0xd9, 0xd8, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd8, 0xd6,
-  0xd7, 0xd6, 0xd4, 0xd3, 0xcf, 0xc4, 0xb7, 0xaf, 0xa3, 0x8a, 0x8e, 0xaa,
-  0xb8, 0xbf, 0xbe, 0xbb, 0xb8, 0xb7, 0xb4, 0xaf, 0xa8, 0xa2, 0x9c, 0x92,
-  0x7f, 0x76, 0x8b, 0x9f, 0xba, 0xbe, 0x9f, 0x8b, 0x81, 0x7e, 0x94, 0xa2,
-  0xa1, 0x9e, 0x98, 0x8e, 0x82, 0x77, 0x72, 0x69, 0x5f, 0x66, 0x74, 0x7c,
-  0x83, 0x8e, 0xa0, 0xa9, 0xab, 0xa8, 0x93, 0x68, 0x58, 0x55, 0x58, 0x5a,
-  0x60, 0x64, 0x65, 0x64, 0x60, 0x5f, 0x62, 0x63, 0x5f, 0x53, 0x4a, 0x6c,
-  0x84, 0x8a, 0x86, 0x81, 0x7a, 0x78, 0x78, 0x7b, 0x7a, 0x74, 0x71, 0x6d,
-  0x67, 0x5e, 0x58, 0x4f, 0x4a, 0x4a, 0x5a, 0x6a, 0x72, 0x74, 0x74, 0x6e,
-  0x67, 0x63, 0x60, 0x5c, 0x5b, 0x62, 0x66, 0x65, 0x5c, 0x53, 0x52, 0x55,
-  0x56, 0x5a, 0x61, 0x6c, 0x74, 0x77, 0x78, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e,
-  0x7d, 0x7a, 0x76, 0x74, 0x72, 0x71, 0x75, 0x7d, 0x84, 0x88, 0x8d, 0x94,
-  0x99, 0x9c, 0x9d, 0x9d, 0x9a, 0x94, 0x8e, 0x8a, 0x83, 0x7c, 0x77, 0x75,
-  0x75, 0x76, 0x7a, 0x7e, 0x82, 0x85, 0x86, 0x88, 0x87, 0x88, 0x88, 0x8a,
-  0x8b, 0x8e, 0x8e, 0x8f, 0x90, 0x8f, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x90,
-  0x91, 0x92, 0x93, 0x95, 0x94, 0x92, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f,
-  0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x8f, 0x8d, 0x8c, 0x8a, 0x88,
-  0x95, 0x92, 0x91, 0x8f, 0x8c, 0x88, 0x81, 0x7b, 0x76, 0x6f, 0x6a, 0x68,
-  0x65, 0x64, 0x63, 0x63, 0x62, 0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5d, 0x5d,
-  0x5d, 0x5e, 0x5d, 0x5d, 0x5c, 0x5d, 0x5c, 0x5d, 0x5c, 0x5c, 0x5d, 0x5d,
-  0x5f, 0x60, 0x61, 0x62, 0x68, 0x70, 0x75, 0x78, 0x7b, 0x7f, 0x81, 0x81,
-  0x81, 0x84, 0x9e, 0xc8, 0xda, 0xdf, 0xdf, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd,
-  0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe2,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe3, 0xe2, 0xe2,
-  0xe1, 0xe1, 0xe0, 0xe0, 0xdf, 0xdd, 0xdc, 0xda, 0xd9, 0xd8, 0xd7, 0xd8,
-  0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd8, 0xda, 0xdc, 0xdc, 0xd9, 0xd9, 0xd9,
-  0xda, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd8, 0xd6, 0xd7, 0xd6, 0xd5, 0xd3,
-  0xd1, 0xca, 0xbe, 0xb6, 0xa8, 0x8e, 0x87, 0xa2, 0xb3, 0xbd, 0xbe, 0xbc,
-  0xb9, 0xb8, 0xb5, 0xb1, 0xab, 0xa5, 0xa0, 0x97, 0x85, 0x75, 0x7f, 0x91,
-  0xb0, 0xc1, 0xb0, 0x9d, 0x8d, 0x7c, 0x8f, 0xa0, 0xa2, 0xa0, 0x9b, 0x91,
-  0x86, 0x7c, 0x76, 0x6e, 0x62, 0x63, 0x6f, 0x78, 0x82, 0x8c, 0x9f, 0xa9,
-  0xac, 0xa8, 0x94, 0x6b, 0x5a, 0x56, 0x58, 0x5a, 0x5f, 0x63, 0x65, 0x65,
-  0x62, 0x60, 0x63, 0x63, 0x5e, 0x53, 0x51, 0x76, 0x88, 0x8b, 0x86, 0x81,
-  0x7b, 0x7b, 0x7c, 0x7d, 0x7a, 0x74, 0x70, 0x6c, 0x64, 0x5b, 0x57, 0x4e,
-  0x4a, 0x4c, 0x5e, 0x6e, 0x74, 0x75, 0x73, 0x6d, 0x66, 0x62, 0x5f, 0x5b,
-  0x5b, 0x63, 0x66, 0x63, 0x5a, 0x54, 0x54, 0x56, 0x58, 0x5c, 0x64, 0x6f,
-  0x76, 0x78, 0x78, 0x7a, 0x7a, 0x7b, 0x7c, 0x7e, 0x7d, 0x7a, 0x76, 0x74,
-  0x72, 0x71, 0x75, 0x7d, 0x85, 0x89, 0x8e, 0x94, 0x9a, 0x9d, 0x9e, 0x9d,
-  0x9a, 0x95, 0x90, 0x8c, 0x86, 0x80, 0x7b, 0x7a, 0x7a, 0x7b, 0x7f, 0x82,
-  0x85, 0x87, 0x89, 0x8a, 0x89, 0x88, 0x88, 0x8a, 0x8a, 0x8d, 0x8e, 0x8f,
-  0x90, 0x90, 0x90, 0x8e, 0x8d, 0x8d, 0x8d, 0x8f, 0x91, 0x91, 0x92, 0x93,
-  0x92, 0x90, 0x8f, 0x8f, 0x90, 0x8f, 0x8f, 0x8e, 0x90, 0x92, 0x91, 0x92,
-  0x92, 0x92, 0x90, 0x8f, 0x8d, 0x8c, 0x8a, 0x89, 0x98, 0x95, 0x93, 0x91,
-  0x8e, 0x89, 0x83, 0x7d, 0x79, 0x71, 0x6b, 0x68, 0x66, 0x65, 0x65, 0x64,
-  0x63, 0x61, 0x60, 0x60, 0x5f, 0x5e, 0x5e, 0x5e, 0x5c, 0x5d, 0x5d, 0x5c,
-  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5c, 0x5e, 0x60, 0x61, 0x62,
-  0x69, 0x70, 0x75, 0x77, 0x7a, 0x7e, 0x7e, 0x7d, 0x82, 0x98, 0xc1, 0xd9,
-  0xde, 0xdf, 0xdd, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdc, 0xdd,
-  0xdc, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe3, 0xe3, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2,
-  0xe2, 0xe1, 0xdf, 0xde, 0xdd, 0xdb, 0xda, 0xd8, 0xd9, 0xd9, 0xd8, 0xd5,
-  0xd5, 0xd6, 0xd6, 0xd9, 0xda, 0xda, 0xdb, 0xdb, 0xda, 0xd9, 0xd9, 0xd9,
-  0xd9, 0xda, 0xd8, 0xd6, 0xd7, 0xd6, 0xd6, 0xd4, 0xd2, 0xce, 0xc8, 0xc1,
-  0xb3, 0x97, 0x82, 0x97, 0xa8, 0xb9, 0xbe, 0xbc, 0xbb, 0xb9, 0xb6, 0xb2,
-  0xae, 0xaa, 0xa5, 0x9c, 0x8f, 0x7d, 0x74, 0x7c, 0x9a, 0xbb, 0xc0, 0xb3,
-  0xa1, 0x83, 0x85, 0x9b, 0xa2, 0xa2, 0x9d, 0x95, 0x8d, 0x84, 0x7d, 0x74,
-  0x68, 0x64, 0x6a, 0x72, 0x7f, 0x8a, 0x9e, 0xa8, 0xac, 0xa9, 0x96, 0x6f,
-  0x5c, 0x57, 0x59, 0x5b, 0x5e, 0x63, 0x65, 0x67, 0x65, 0x63, 0x65, 0x64,
-  0x5e, 0x55, 0x60, 0x80, 0x8a, 0x8a, 0x86, 0x82, 0x7e, 0x7f, 0x80, 0x7f,
-  0x7b, 0x74, 0x6e, 0x69, 0x5f, 0x5a, 0x56, 0x4d, 0x4a, 0x51, 0x64, 0x70,
-  0x76, 0x77, 0x73, 0x6a, 0x64, 0x61, 0x5f, 0x5c, 0x5e, 0x64, 0x64, 0x60,
-  0x57, 0x55, 0x55, 0x59, 0x5b, 0x61, 0x68, 0x73, 0x78, 0x7a, 0x7a, 0x7a,
-  0x79, 0x7b, 0x7b, 0x7c, 0x7b, 0x79, 0x75, 0x72, 0x70, 0x70, 0x74, 0x7d,
-  0x85, 0x89, 0x8f, 0x95, 0x9a, 0x9e, 0x9f, 0x9f, 0x9c, 0x96, 0x91, 0x8e,
-  0x8a, 0x85, 0x82, 0x81, 0x81, 0x82, 0x86, 0x89, 0x8b, 0x8c, 0x8d, 0x8d,
-  0x8a, 0x88, 0x88, 0x89, 0x89, 0x8b, 0x8c, 0x8e, 0x8f, 0x90, 0x8f, 0x8d,
-  0x8d, 0x8d, 0x8c, 0x8d, 0x8f, 0x8f, 0x8f, 0x90, 0x8f, 0x8d, 0x8c, 0x8d,
-  0x8e, 0x8d, 0x8e, 0x8e, 0x8f, 0x90, 0x90, 0x91, 0x91, 0x91, 0x8f, 0x8e,
-  0x8d, 0x8c, 0x8b, 0x8a, 0x9a, 0x96, 0x93, 0x91, 0x8f, 0x8a, 0x84, 0x7d,
-  0x79, 0x72, 0x6c, 0x69, 0x68, 0x67, 0x65, 0x65, 0x62, 0x62, 0x62, 0x61,
-  0x60, 0x60, 0x60, 0x5f, 0x5d, 0x5c, 0x5d, 0x5d, 0x5d, 0x5d, 0x5b, 0x5a,
-  0x5b, 0x5c, 0x5c, 0x5c, 0x5d, 0x5e, 0x60, 0x63, 0x6a, 0x70, 0x75, 0x77,
-  0x78, 0x7a, 0x7c, 0x89, 0x9d, 0xc3, 0xdb, 0xe0, 0xdf, 0xde, 0xde, 0xdd,
-  0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xde, 0xde, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1,
-  0xe1, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe2, 0xe1, 0xe0, 0xe1,
-  0xe1, 0xe0, 0xdf, 0xdc, 0xdb, 0xdb, 0xd9, 0xd8, 0xd8, 0xd6, 0xd5, 0xd5,
-  0xd5, 0xd8, 0xd9, 0xd9, 0xda, 0xda, 0xd9, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8,
-  0xd8, 0xd7, 0xd6, 0xd5, 0xd2, 0xd0, 0xcd, 0xca, 0xc1, 0xaa, 0x8a, 0x86,
-  0x92, 0xae, 0xbc, 0xbb, 0xbb, 0xba, 0xb7, 0xb3, 0xb1, 0xae, 0xab, 0xa4,
-  0x99, 0x8b, 0x7b, 0x75, 0x7e, 0xa5, 0xbe, 0xc1, 0xb8, 0x9c, 0x7d, 0x8f,
-  0x9f, 0xa2, 0xa0, 0x9b, 0x94, 0x8b, 0x84, 0x79, 0x70, 0x68, 0x67, 0x6c,
-  0x79, 0x87, 0x9c, 0xa7, 0xab, 0xa8, 0x97, 0x75, 0x5e, 0x57, 0x59, 0x5c,
-  0x5f, 0x62, 0x64, 0x67, 0x67, 0x67, 0x67, 0x63, 0x5e, 0x5a, 0x73, 0x89,
-  0x8a, 0x88, 0x85, 0x83, 0x81, 0x82, 0x83, 0x81, 0x7b, 0x72, 0x69, 0x63,
-  0x5c, 0x58, 0x54, 0x4d, 0x4e, 0x5a, 0x6c, 0x75, 0x79, 0x78, 0x73, 0x68,
-  0x63, 0x60, 0x5e, 0x5c, 0x62, 0x65, 0x60, 0x5b, 0x55, 0x57, 0x5a, 0x5d,
-  0x60, 0x67, 0x6f, 0x76, 0x79, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a,
-  0x78, 0x76, 0x73, 0x72, 0x70, 0x6f, 0x74, 0x7e, 0x85, 0x8a, 0x90, 0x97,
-  0x9c, 0x9f, 0xa1, 0xa0, 0x9d, 0x98, 0x94, 0x91, 0x8d, 0x8a, 0x88, 0x87,
-  0x88, 0x89, 0x8b, 0x8e, 0x90, 0x91, 0x90, 0x8f, 0x8c, 0x89, 0x88, 0x87,
-  0x87, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b, 0x8b, 0x8a, 0x8b, 0x8b, 0x8c, 0x8c,
-  0x8d, 0x8f, 0x90, 0x90, 0x8f, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8c,
-  0x9b, 0x98, 0x94, 0x92, 0x90, 0x8c, 0x84, 0x7e, 0x79, 0x73, 0x6e, 0x6b,
-  0x69, 0x68, 0x67, 0x65, 0x63, 0x64, 0x63, 0x62, 0x60, 0x60, 0x60, 0x5f,
-  0x5d, 0x5e, 0x5e, 0x5e, 0x5e, 0x5d, 0x5a, 0x59, 0x59, 0x5a, 0x5b, 0x5d,
-  0x5d, 0x5f, 0x61, 0x65, 0x6a, 0x6e, 0x73, 0x75, 0x76, 0x77, 0x8c, 0xb3,
-  0xca, 0xda, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xdc, 0xdd, 0xde, 0xdf,
-  0xdf, 0xde, 0xde, 0xdf, 0xe0, 0xe0, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdf,
-  0xe0, 0xdf, 0xdf, 0xdf, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf,
-  0xde, 0xdd, 0xdd, 0xdb, 0xda, 0xd9, 0xd7, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4,
-  0xd6, 0xd8, 0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd7, 0xd7, 0xd6, 0xd5,
-  0xd3, 0xd1, 0xce, 0xcd, 0xc9, 0xbe, 0xa0, 0x83, 0x84, 0xa0, 0xb6, 0xbc,
-  0xbb, 0xba, 0xb9, 0xb6, 0xb4, 0xb2, 0xaf, 0xa9, 0xa1, 0x95, 0x8b, 0x82,
-  0x76, 0x86, 0xa7, 0xb7, 0xb9, 0xac, 0x84, 0x83, 0x94, 0x9d, 0xa2, 0xa0,
-  0x9a, 0x93, 0x8c, 0x81, 0x76, 0x6e, 0x67, 0x66, 0x70, 0x83, 0x98, 0xa7,
-  0xac, 0xa9, 0x98, 0x7a, 0x61, 0x59, 0x5a, 0x5d, 0x5f, 0x61, 0x63, 0x67,
-  0x69, 0x6a, 0x69, 0x61, 0x5e, 0x66, 0x83, 0x8d, 0x8a, 0x88, 0x85, 0x85,
-  0x84, 0x86, 0x85, 0x81, 0x78, 0x6c, 0x62, 0x5d, 0x59, 0x58, 0x52, 0x4e,
-  0x54, 0x64, 0x75, 0x78, 0x79, 0x78, 0x71, 0x65, 0x60, 0x5d, 0x5c, 0x5e,
-  0x65, 0x64, 0x5b, 0x56, 0x56, 0x5b, 0x5f, 0x62, 0x65, 0x6b, 0x72, 0x76,
-  0x78, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7b, 0x79, 0x76, 0x74, 0x72, 0x71,
-  0x70, 0x6f, 0x75, 0x7f, 0x86, 0x8b, 0x92, 0x9a, 0xa0, 0xa2, 0xa2, 0xa2,
-  0x9f, 0x9a, 0x96, 0x94, 0x90, 0x8e, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x92,
-  0x92, 0x92, 0x91, 0x8f, 0x8c, 0x88, 0x86, 0x84, 0x84, 0x87, 0x89, 0x8a,
-  0x8b, 0x8b, 0x8c, 0x8d, 0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x89,
-  0x89, 0x88, 0x87, 0x87, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8c, 0x8e, 0x8e,
-  0x8e, 0x8c, 0x8d, 0x8d, 0x8b, 0x8b, 0x8a, 0x8c, 0x9c, 0x98, 0x96, 0x94,
-  0x92, 0x8d, 0x86, 0x80, 0x7b, 0x75, 0x6f, 0x6b, 0x69, 0x68, 0x67, 0x66,
-  0x64, 0x64, 0x64, 0x63, 0x61, 0x61, 0x61, 0x5f, 0x5e, 0x5e, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5a, 0x5a, 0x59, 0x5a, 0x5b, 0x5c, 0x5e, 0x60, 0x62, 0x66,
-  0x6a, 0x6d, 0x71, 0x73, 0x73, 0x79, 0xaa, 0xcf, 0xdc, 0xdf, 0xdf, 0xde,
-  0xde, 0xde, 0xde, 0xdd, 0xdd, 0xde, 0xdf, 0xe0, 0xe0, 0xde, 0xde, 0xde,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xe1, 0xe1, 0xe1, 0xdf,
-  0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe1, 0xe1,
-  0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde,
-  0xdd, 0xdb, 0xda, 0xd7, 0xd6, 0xd4, 0xd2, 0xd2, 0xd3, 0xd4, 0xd8, 0xd9,
-  0xda, 0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd6, 0xd5, 0xd5, 0xd3, 0xd0, 0xce,
-  0xcb, 0xc5, 0xb1, 0x94, 0x8a, 0x94, 0xb0, 0xbc, 0xbb, 0xba, 0xb8, 0xb6,
-  0xb5, 0xb3, 0xb1, 0xac, 0xa5, 0x9b, 0x94, 0x8c, 0x7c, 0x76, 0x8c, 0x9e,
-  0xa8, 0xae, 0x93, 0x7a, 0x89, 0x96, 0xa0, 0xa2, 0x9d, 0x98, 0x93, 0x88,
-  0x7a, 0x71, 0x68, 0x65, 0x6a, 0x7e, 0x93, 0xa5, 0xac, 0xab, 0x9a, 0x7e,
-  0x64, 0x5b, 0x5a, 0x5c, 0x5f, 0x61, 0x63, 0x66, 0x6a, 0x6c, 0x68, 0x5f,
-  0x5f, 0x71, 0x8c, 0x90, 0x8c, 0x89, 0x87, 0x87, 0x87, 0x89, 0x88, 0x82,
-  0x76, 0x68, 0x5e, 0x5a, 0x5a, 0x58, 0x52, 0x52, 0x5a, 0x6d, 0x7e, 0x7d,
-  0x7a, 0x77, 0x6f, 0x64, 0x5d, 0x5b, 0x5c, 0x60, 0x67, 0x64, 0x5a, 0x56,
-  0x58, 0x5d, 0x62, 0x66, 0x69, 0x6d, 0x73, 0x76, 0x76, 0x77, 0x78, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x78, 0x75, 0x72, 0x70, 0x70, 0x6f, 0x70, 0x76, 0x7f,
-  0x87, 0x8c, 0x94, 0x9c, 0xa2, 0xa3, 0xa4, 0xa3, 0xa0, 0x9b, 0x97, 0x95,
-  0x92, 0x90, 0x90, 0x90, 0x91, 0x92, 0x93, 0x94, 0x93, 0x93, 0x90, 0x8e,
-  0x8b, 0x87, 0x85, 0x83, 0x83, 0x85, 0x87, 0x88, 0x8a, 0x8b, 0x8c, 0x8c,
-  0x8c, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x83,
-  0x84, 0x84, 0x86, 0x87, 0x89, 0x89, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b,
-  0x8a, 0x8a, 0x8a, 0x8c, 0x9d, 0x99, 0x97, 0x95, 0x92, 0x8c, 0x86, 0x7f,
-  0x7c, 0x76, 0x70, 0x6c, 0x6a, 0x69, 0x67, 0x66, 0x65, 0x64, 0x64, 0x63,
-  0x61, 0x61, 0x61, 0x5f, 0x5e, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x5b, 0x5c, 0x5e, 0x61, 0x63, 0x66, 0x6a, 0x6d, 0x71, 0x72,
-  0x72, 0x84, 0xbc, 0xd9, 0xe0, 0xdf, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdd,
-  0xdd, 0xdf, 0xdf, 0xe0, 0xe0, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xe0, 0xe0,
-  0xe0, 0xe0, 0xde, 0xdf, 0xe1, 0xe1, 0xe1, 0xdf, 0xe0, 0xdf, 0xe1, 0xe2,
-  0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe1, 0xdf, 0xdf,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdc, 0xdb, 0xd9,
-  0xd8, 0xd4, 0xd3, 0xd2, 0xd2, 0xd3, 0xd5, 0xd8, 0xd9, 0xd9, 0xd8, 0xd6,
-  0xd7, 0xd6, 0xd6, 0xd5, 0xd4, 0xd3, 0xd0, 0xce, 0xcc, 0xc8, 0xb9, 0xa2,
-  0x95, 0x91, 0xaa, 0xba, 0xbc, 0xbb, 0xb7, 0xb5, 0xb5, 0xb3, 0xb1, 0xad,
-  0xa7, 0x9d, 0x97, 0x90, 0x82, 0x73, 0x7c, 0x8a, 0x97, 0xa9, 0x9b, 0x78,
-  0x82, 0x8f, 0x9d, 0xa3, 0x9f, 0x9b, 0x96, 0x8c, 0x7d, 0x74, 0x6a, 0x65,
-  0x66, 0x7b, 0x90, 0xa4, 0xac, 0xab, 0x9c, 0x81, 0x67, 0x5c, 0x5a, 0x5c,
-  0x5f, 0x61, 0x63, 0x66, 0x6a, 0x6c, 0x68, 0x5f, 0x63, 0x79, 0x90, 0x90,
-  0x8d, 0x8a, 0x88, 0x88, 0x89, 0x8a, 0x89, 0x82, 0x75, 0x65, 0x5c, 0x5a,
-  0x5a, 0x56, 0x52, 0x56, 0x5e, 0x72, 0x83, 0x80, 0x7c, 0x77, 0x6d, 0x62,
-  0x5d, 0x5b, 0x5d, 0x62, 0x68, 0x64, 0x5a, 0x57, 0x5b, 0x60, 0x64, 0x68,
-  0x6a, 0x6e, 0x72, 0x75, 0x75, 0x76, 0x78, 0x79, 0x79, 0x79, 0x79, 0x78,
-  0x74, 0x71, 0x70, 0x6f, 0x6f, 0x6f, 0x76, 0x7f, 0x87, 0x8d, 0x94, 0x9d,
-  0xa2, 0xa4, 0xa5, 0xa3, 0xa0, 0x9b, 0x98, 0x96, 0x93, 0x92, 0x91, 0x92,
-  0x92, 0x93, 0x94, 0x94, 0x93, 0x92, 0x8f, 0x8d, 0x8a, 0x87, 0x85, 0x83,
-  0x82, 0x84, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8b, 0x89, 0x89, 0x8a,
-  0x89, 0x89, 0x88, 0x86, 0x86, 0x84, 0x83, 0x82, 0x83, 0x84, 0x84, 0x86,
-  0x88, 0x88, 0x8b, 0x8c, 0x8c, 0x8a, 0x89, 0x8a, 0x89, 0x89, 0x8a, 0x8c,
-  0x9e, 0x9b, 0x98, 0x96, 0x92, 0x8b, 0x85, 0x7f, 0x7c, 0x76, 0x70, 0x6c,
-  0x6a, 0x68, 0x67, 0x66, 0x65, 0x64, 0x64, 0x63, 0x61, 0x61, 0x61, 0x60,
-  0x5e, 0x5f, 0x5e, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x5a, 0x5b, 0x5c,
-  0x60, 0x61, 0x63, 0x66, 0x6a, 0x6e, 0x6f, 0x70, 0x76, 0x9f, 0xcf, 0xdd,
-  0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf,
-  0xe1, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xe2, 0xe1, 0xe0, 0xe0, 0xe1, 0xdf, 0xde, 0xde, 0xdf, 0xdf, 0xe0, 0xdf,
-  0xdf, 0xde, 0xde, 0xde, 0xdf, 0xdd, 0xdc, 0xdb, 0xd8, 0xd6, 0xd5, 0xd4,
-  0xd3, 0xd1, 0xd2, 0xd5, 0xd6, 0xd8, 0xd8, 0xd6, 0xd6, 0xd5, 0xd4, 0xd4,
-  0xd3, 0xd2, 0xcf, 0xce, 0xcb, 0xc9, 0xc1, 0xb5, 0xa8, 0x97, 0xa2, 0xb3,
-  0xbb, 0xbb, 0xb6, 0xb4, 0xb4, 0xb4, 0xb2, 0xae, 0xa8, 0xa1, 0x9b, 0x95,
-  0x8a, 0x79, 0x6e, 0x72, 0x7f, 0x99, 0xa0, 0x7d, 0x79, 0x83, 0x97, 0xa3,
-  0xa2, 0x9e, 0x99, 0x90, 0x85, 0x78, 0x6f, 0x68, 0x62, 0x74, 0x8b, 0xa1,
-  0xaa, 0xab, 0x9d, 0x83, 0x6b, 0x60, 0x5a, 0x5c, 0x5e, 0x61, 0x63, 0x65,
-  0x6a, 0x6b, 0x68, 0x66, 0x6d, 0x84, 0x93, 0x91, 0x8e, 0x8c, 0x8b, 0x8c,
-  0x8c, 0x8c, 0x8a, 0x81, 0x72, 0x61, 0x5b, 0x59, 0x5b, 0x55, 0x53, 0x5c,
-  0x66, 0x76, 0x86, 0x84, 0x7e, 0x77, 0x6a, 0x60, 0x5d, 0x5d, 0x5f, 0x64,
-  0x68, 0x62, 0x5b, 0x5a, 0x5e, 0x61, 0x66, 0x6a, 0x6d, 0x6e, 0x70, 0x75,
-  0x75, 0x75, 0x77, 0x78, 0x77, 0x77, 0x77, 0x77, 0x73, 0x70, 0x70, 0x6f,
-  0x6f, 0x70, 0x74, 0x7f, 0x89, 0x8f, 0x96, 0x9e, 0xa3, 0xa5, 0xa5, 0xa3,
-  0xa0, 0x9b, 0x98, 0x96, 0x95, 0x93, 0x93, 0x94, 0x94, 0x95, 0x94, 0x94,
-  0x92, 0x91, 0x8e, 0x8c, 0x89, 0x86, 0x85, 0x82, 0x81, 0x82, 0x84, 0x86,
-  0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x87, 0x87, 0x87, 0x86, 0x85, 0x85,
-  0x83, 0x81, 0x80, 0x80, 0x82, 0x83, 0x83, 0x84, 0x86, 0x86, 0x89, 0x8a,
-  0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x89, 0x8b, 0xa0, 0x9c, 0x98, 0x95,
-  0x91, 0x8a, 0x85, 0x7f, 0x7c, 0x77, 0x71, 0x6d, 0x6a, 0x68, 0x67, 0x66,
-  0x65, 0x64, 0x63, 0x62, 0x61, 0x61, 0x61, 0x60, 0x5e, 0x5f, 0x5e, 0x5b,
-  0x5b, 0x5c, 0x5c, 0x5c, 0x5b, 0x5a, 0x5a, 0x5c, 0x60, 0x61, 0x62, 0x65,
-  0x6a, 0x6c, 0x6b, 0x72, 0x8d, 0xc4, 0xdd, 0xdf, 0xdf, 0xe0, 0xdf, 0xde,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe2,
-  0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe1,
-  0xe2, 0xe2, 0xe3, 0xe3, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1,
-  0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd, 0xdc,
-  0xdd, 0xdd, 0xdd, 0xdc, 0xda, 0xd8, 0xd8, 0xd7, 0xd5, 0xd2, 0xd0, 0xd1,
-  0xd2, 0xd3, 0xd6, 0xd6, 0xd6, 0xd5, 0xd4, 0xd5, 0xd3, 0xd2, 0xd0, 0xce,
-  0xcd, 0xca, 0xc4, 0xbf, 0xb7, 0xa7, 0x9e, 0xab, 0xb6, 0xb9, 0xb6, 0xb2,
-  0xb3, 0xb4, 0xb2, 0xaf, 0xaa, 0xa5, 0x9f, 0x9a, 0x92, 0x84, 0x72, 0x6b,
-  0x70, 0x82, 0x9e, 0x8b, 0x73, 0x74, 0x8c, 0x9f, 0xa4, 0xa2, 0x9f, 0x98,
-  0x8d, 0x7f, 0x76, 0x6d, 0x62, 0x69, 0x83, 0x9b, 0xa6, 0xab, 0xa2, 0x87,
-  0x70, 0x63, 0x5a, 0x5c, 0x5e, 0x61, 0x63, 0x66, 0x6b, 0x6c, 0x6c, 0x76,
-  0x81, 0x90, 0x95, 0x92, 0x8d, 0x8c, 0x8d, 0x90, 0x90, 0x8e, 0x89, 0x7e,
-  0x6c, 0x5c, 0x59, 0x59, 0x5a, 0x52, 0x55, 0x63, 0x6d, 0x79, 0x87, 0x85,
-  0x7e, 0x76, 0x66, 0x5e, 0x5d, 0x60, 0x62, 0x66, 0x67, 0x5f, 0x5d, 0x5e,
-  0x61, 0x64, 0x68, 0x6c, 0x6d, 0x6f, 0x70, 0x73, 0x74, 0x75, 0x76, 0x76,
-  0x74, 0x74, 0x75, 0x77, 0x73, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x74, 0x81,
-  0x8c, 0x92, 0x99, 0xa0, 0xa6, 0xa7, 0xa7, 0xa5, 0xa1, 0x9b, 0x98, 0x96,
-  0x96, 0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x93, 0x90, 0x8e, 0x8d, 0x8b,
-  0x88, 0x86, 0x84, 0x81, 0x7f, 0x7e, 0x80, 0x81, 0x84, 0x87, 0x88, 0x88,
-  0x88, 0x87, 0x85, 0x85, 0x84, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x80, 0x81, 0x81, 0x81, 0x83, 0x85, 0x87, 0x87, 0x87, 0x86, 0x87, 0x87,
-  0x86, 0x86, 0x87, 0x89, 0x9e, 0x9b, 0x98, 0x96, 0x90, 0x8a, 0x84, 0x7f,
-  0x7b, 0x76, 0x72, 0x6d, 0x6b, 0x6a, 0x68, 0x65, 0x64, 0x65, 0x64, 0x63,
-  0x62, 0x60, 0x60, 0x60, 0x5e, 0x5d, 0x5c, 0x5b, 0x5b, 0x5c, 0x5d, 0x5c,
-  0x5b, 0x5b, 0x5b, 0x5c, 0x60, 0x61, 0x62, 0x65, 0x68, 0x69, 0x70, 0x85,
-  0xb8, 0xda, 0xde, 0xde, 0xdf, 0xe0, 0xde, 0xde, 0xdf, 0xe0, 0xe0, 0xe0,
-  0xe0, 0xdf, 0xdf, 0xde, 0xe1, 0xe1, 0xe1, 0xe1, 0xdf, 0xdf, 0xe1, 0xe0,
-  0xe2, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xe2, 0xe3, 0xe3, 0xe2, 0xe3, 0xe3,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe0, 0xe1,
-  0xe1, 0xe1, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xdf, 0xdf, 0xe0, 0xe0,
-  0xdf, 0xdf, 0xdf, 0xde, 0xdc, 0xdb, 0xdb, 0xdc, 0xdb, 0xdc, 0xdc, 0xdc,
-  0xdb, 0xda, 0xda, 0xd9, 0xd8, 0xd5, 0xd3, 0xd3, 0xd1, 0xd1, 0xd1, 0xd3,
-  0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd1, 0xd0, 0xcf, 0xcf, 0xcc, 0xc8, 0xc4,
-  0xc0, 0xb5, 0xa4, 0xa3, 0xad, 0xb2, 0xb5, 0xb2, 0xb1, 0xb2, 0xb2, 0xb0,
-  0xac, 0xa8, 0xa3, 0x9e, 0x96, 0x8c, 0x81, 0x79, 0x74, 0x73, 0x8e, 0x94,
-  0x77, 0x6f, 0x7f, 0x98, 0xa3, 0xa5, 0xa5, 0xa0, 0x95, 0x89, 0x7e, 0x74,
-  0x65, 0x62, 0x79, 0x90, 0x9d, 0xa9, 0xa5, 0x8b, 0x75, 0x68, 0x5b, 0x5b,
-  0x5d, 0x5f, 0x60, 0x64, 0x69, 0x6b, 0x73, 0x86, 0x90, 0x97, 0x97, 0x92,
-  0x8c, 0x8c, 0x90, 0x94, 0x94, 0x91, 0x8b, 0x7d, 0x67, 0x5a, 0x59, 0x5a,
-  0x59, 0x53, 0x59, 0x67, 0x71, 0x7c, 0x87, 0x85, 0x7c, 0x72, 0x63, 0x5b,
-  0x5c, 0x60, 0x63, 0x67, 0x65, 0x5d, 0x5e, 0x61, 0x64, 0x67, 0x6a, 0x6c,
-  0x6d, 0x6f, 0x71, 0x71, 0x73, 0x74, 0x74, 0x75, 0x72, 0x72, 0x73, 0x75,
-  0x73, 0x6f, 0x6e, 0x6e, 0x6e, 0x70, 0x74, 0x82, 0x8e, 0x94, 0x9b, 0xa5,
-  0xa8, 0xa9, 0xa8, 0xa5, 0xa0, 0x9a, 0x99, 0x97, 0x97, 0x96, 0x97, 0x96,
-  0x96, 0x95, 0x94, 0x91, 0x8e, 0x8c, 0x8b, 0x8a, 0x88, 0x86, 0x84, 0x81,
-  0x7e, 0x7b, 0x7d, 0x7e, 0x80, 0x83, 0x85, 0x86, 0x86, 0x85, 0x83, 0x82,
-  0x81, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x7d, 0x7f, 0x80, 0x81,
-  0x82, 0x85, 0x86, 0x85, 0x85, 0x84, 0x84, 0x83, 0x84, 0x85, 0x87, 0x88,
-  0x9e, 0x9a, 0x96, 0x93, 0x8f, 0x89, 0x83, 0x7d, 0x7a, 0x76, 0x72, 0x6e,
-  0x6b, 0x6a, 0x68, 0x66, 0x64, 0x65, 0x65, 0x64, 0x62, 0x61, 0x61, 0x61,
-  0x60, 0x5e, 0x5d, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x5b,
-  0x60, 0x62, 0x63, 0x64, 0x66, 0x6b, 0x85, 0xa2, 0xce, 0xde, 0xde, 0xde,
-  0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xde, 0xde,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe1, 0xe1, 0xe1, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1,
-  0xe1, 0xe0, 0xe1, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0,
-  0xe0, 0xe0, 0xe1, 0xe0, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xde, 0xde, 0xde,
-  0xdc, 0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd9,
-  0xd9, 0xd7, 0xd4, 0xd4, 0xd3, 0xd1, 0xd1, 0xd1, 0xd4, 0xd4, 0xd4, 0xd3,
-  0xd3, 0xd1, 0xcf, 0xcf, 0xce, 0xcc, 0xc8, 0xc6, 0xc3, 0xbc, 0xac, 0xa0,
-  0xa5, 0xab, 0xb3, 0xb2, 0xaf, 0xb0, 0xb0, 0xb1, 0xae, 0xa9, 0xa6, 0xa2,
-  0x99, 0x91, 0x8c, 0x85, 0x7d, 0x71, 0x7e, 0x94, 0x7f, 0x73, 0x76, 0x91,
-  0xa2, 0xa7, 0xa7, 0xa3, 0x9c, 0x91, 0x84, 0x79, 0x68, 0x5e, 0x72, 0x87,
-  0x95, 0xa8, 0xa7, 0x91, 0x7a, 0x6a, 0x5b, 0x59, 0x5b, 0x5d, 0x5f, 0x63,
-  0x67, 0x69, 0x7b, 0x8d, 0x95, 0x9a, 0x99, 0x94, 0x8e, 0x8e, 0x93, 0x96,
-  0x95, 0x91, 0x8b, 0x7a, 0x63, 0x59, 0x59, 0x59, 0x56, 0x53, 0x5f, 0x6b,
-  0x73, 0x7d, 0x89, 0x86, 0x7a, 0x6f, 0x5f, 0x5a, 0x5e, 0x62, 0x65, 0x67,
-  0x63, 0x5d, 0x5f, 0x62, 0x65, 0x68, 0x6c, 0x6e, 0x6e, 0x6f, 0x70, 0x72,
-  0x74, 0x74, 0x74, 0x74, 0x73, 0x73, 0x73, 0x75, 0x73, 0x6f, 0x6e, 0x6e,
-  0x6d, 0x6f, 0x74, 0x84, 0x90, 0x96, 0x9e, 0xa6, 0xa9, 0xa9, 0xa8, 0xa5,
-  0xa0, 0x9a, 0x98, 0x97, 0x97, 0x96, 0x97, 0x96, 0x96, 0x95, 0x94, 0x90,
-  0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x87, 0x85, 0x81, 0x7c, 0x7a, 0x7b, 0x7c,
-  0x7e, 0x82, 0x84, 0x85, 0x85, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x84, 0x85, 0x84,
-  0x83, 0x82, 0x80, 0x80, 0x81, 0x82, 0x86, 0x87, 0x9d, 0x99, 0x95, 0x92,
-  0x8e, 0x89, 0x82, 0x7c, 0x79, 0x76, 0x73, 0x6f, 0x6b, 0x6a, 0x68, 0x66,
-  0x64, 0x65, 0x65, 0x64, 0x62, 0x62, 0x61, 0x61, 0x61, 0x5f, 0x5d, 0x5c,
-  0x5b, 0x5b, 0x5b, 0x5c, 0x5d, 0x5d, 0x5b, 0x5b, 0x60, 0x62, 0x63, 0x64,
-  0x66, 0x70, 0x98, 0xb7, 0xd6, 0xde, 0xde, 0xdd, 0xde, 0xdf, 0xdf, 0xe0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe1, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe1, 0xe0,
-  0xe0, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf,
-  0xde, 0xde, 0xde, 0xdf, 0xde, 0xdd, 0xdd, 0xde, 0xdc, 0xdc, 0xdc, 0xdc,
-  0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xda, 0xd9, 0xd9, 0xd7, 0xd5, 0xd5,
-  0xd4, 0xd2, 0xd1, 0xd0, 0xd2, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xcf, 0xce,
-  0xce, 0xcd, 0xc9, 0xc7, 0xc4, 0xbf, 0xb1, 0xa1, 0xa0, 0xa5, 0xb0, 0xb1,
-  0xaf, 0xaf, 0xaf, 0xb1, 0xae, 0xaa, 0xa7, 0xa3, 0x9c, 0x93, 0x90, 0x8b,
-  0x83, 0x75, 0x77, 0x8f, 0x85, 0x78, 0x73, 0x8d, 0xa0, 0xa7, 0xa7, 0xa5,
-  0x9f, 0x95, 0x88, 0x7d, 0x6c, 0x5e, 0x6d, 0x80, 0x90, 0xa5, 0xa9, 0x95,
-  0x7d, 0x6d, 0x5c, 0x59, 0x5a, 0x5c, 0x5e, 0x63, 0x66, 0x6a, 0x81, 0x92,
-  0x98, 0x9b, 0x9a, 0x94, 0x90, 0x90, 0x96, 0x97, 0x95, 0x90, 0x88, 0x77,
-  0x61, 0x59, 0x5a, 0x58, 0x53, 0x54, 0x63, 0x6e, 0x75, 0x7e, 0x8a, 0x86,
-  0x77, 0x6b, 0x5d, 0x59, 0x5e, 0x63, 0x66, 0x67, 0x62, 0x5e, 0x61, 0x64,
-  0x66, 0x69, 0x6c, 0x6f, 0x6f, 0x6f, 0x70, 0x73, 0x74, 0x74, 0x74, 0x74,
-  0x74, 0x73, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x6e, 0x6d, 0x6e, 0x74, 0x85,
-  0x92, 0x98, 0xa0, 0xa7, 0xaa, 0xa9, 0xa8, 0xa5, 0x9f, 0x9b, 0x98, 0x97,
-  0x96, 0x95, 0x96, 0x96, 0x95, 0x94, 0x93, 0x8e, 0x8b, 0x8a, 0x8a, 0x8a,
-  0x89, 0x87, 0x85, 0x81, 0x7b, 0x79, 0x7a, 0x7b, 0x7d, 0x81, 0x84, 0x85,
-  0x84, 0x83, 0x80, 0x7f, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x78, 0x7a,
-  0x7b, 0x7c, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x83, 0x83, 0x81, 0x7f, 0x7f,
-  0x81, 0x82, 0x85, 0x87, 0x9c, 0x98, 0x94, 0x91, 0x8c, 0x87, 0x81, 0x7c,
-  0x79, 0x76, 0x73, 0x6f, 0x6c, 0x6a, 0x68, 0x67, 0x65, 0x65, 0x65, 0x64,
-  0x62, 0x61, 0x61, 0x61, 0x61, 0x60, 0x5f, 0x5d, 0x5c, 0x5a, 0x5b, 0x5d,
-  0x5e, 0x5e, 0x5d, 0x5d, 0x60, 0x62, 0x63, 0x64, 0x67, 0x81, 0xb6, 0xd0,
-  0xdc, 0xde, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xdf, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe1, 0xe0, 0xdf, 0xdf, 0xde, 0xdd, 0xdd,
-  0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde,
-  0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdb, 0xda, 0xdb, 0xd9, 0xd9, 0xd9, 0xd8,
-  0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd7, 0xd6, 0xd6, 0xd5, 0xd4, 0xd2, 0xcf,
-  0xd1, 0xd1, 0xd1, 0xd1, 0xd3, 0xd2, 0xd0, 0xd0, 0xcf, 0xcd, 0xca, 0xc8,
-  0xc6, 0xc1, 0xb6, 0xa6, 0x9c, 0x9c, 0xa7, 0xaf, 0xaf, 0xad, 0xad, 0xae,
-  0xad, 0xaa, 0xa7, 0xa4, 0x9e, 0x97, 0x92, 0x8f, 0x8a, 0x7e, 0x74, 0x86,
-  0x8b, 0x81, 0x6f, 0x83, 0x9c, 0xa6, 0xa7, 0xa7, 0xa3, 0x9b, 0x90, 0x85,
-  0x73, 0x60, 0x66, 0x76, 0x86, 0xa0, 0xab, 0x9c, 0x84, 0x72, 0x5e, 0x57,
-  0x59, 0x5b, 0x5d, 0x60, 0x62, 0x6e, 0x8c, 0x98, 0x9b, 0x9c, 0x9b, 0x96,
-  0x93, 0x95, 0x98, 0x98, 0x92, 0x8b, 0x83, 0x73, 0x5e, 0x59, 0x59, 0x56,
-  0x50, 0x57, 0x69, 0x72, 0x78, 0x82, 0x8b, 0x84, 0x73, 0x67, 0x5a, 0x59,
-  0x5f, 0x64, 0x66, 0x66, 0x60, 0x60, 0x63, 0x66, 0x68, 0x6b, 0x6e, 0x6f,
-  0x6f, 0x6f, 0x70, 0x73, 0x74, 0x74, 0x74, 0x74, 0x73, 0x72, 0x72, 0x73,
-  0x71, 0x6e, 0x6e, 0x6e, 0x6d, 0x6f, 0x75, 0x87, 0x95, 0x9c, 0xa3, 0xa9,
-  0xaa, 0xa9, 0xa7, 0xa3, 0x9d, 0x99, 0x96, 0x95, 0x95, 0x94, 0x94, 0x93,
-  0x91, 0x90, 0x8f, 0x8c, 0x8a, 0x89, 0x89, 0x8a, 0x89, 0x88, 0x86, 0x82,
-  0x7c, 0x78, 0x78, 0x79, 0x7b, 0x80, 0x82, 0x84, 0x84, 0x82, 0x80, 0x7e,
-  0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7f, 0x80,
-  0x80, 0x82, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80, 0x81, 0x82, 0x84, 0x85,
-  0x99, 0x95, 0x92, 0x90, 0x8b, 0x86, 0x7f, 0x7c, 0x7a, 0x76, 0x73, 0x6f,
-  0x6c, 0x6b, 0x69, 0x67, 0x66, 0x66, 0x66, 0x65, 0x63, 0x61, 0x61, 0x61,
-  0x60, 0x60, 0x60, 0x5f, 0x5e, 0x5d, 0x5d, 0x5e, 0x60, 0x60, 0x5f, 0x5f,
-  0x61, 0x63, 0x63, 0x63, 0x6d, 0xa7, 0xd0, 0xdc, 0xdd, 0xdd, 0xdd, 0xde,
-  0xde, 0xdd, 0xde, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xe0, 0xe1, 0xe1,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2,
-  0xe2, 0xe2, 0xe2, 0xe0, 0xe0, 0xdf, 0xde, 0xde, 0xdd, 0xdd, 0xde, 0xdd,
-  0xda, 0xd9, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xdc, 0xdc,
-  0xdc, 0xdb, 0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd9, 0xd8, 0xd7, 0xd7, 0xd7,
-  0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd2, 0xd2, 0xd1, 0xd0, 0xd1,
-  0xd1, 0xd2, 0xd1, 0xd1, 0xcf, 0xcc, 0xcb, 0xc9, 0xc7, 0xc2, 0xbb, 0xaf,
-  0xa1, 0x9c, 0x9e, 0xaa, 0xae, 0xad, 0xad, 0xac, 0xab, 0xa9, 0xa8, 0xa5,
-  0xa0, 0x9b, 0x97, 0x95, 0x91, 0x87, 0x78, 0x7d, 0x8a, 0x85, 0x6f, 0x76,
-  0x94, 0xa3, 0xa7, 0xa8, 0xa7, 0xa2, 0x99, 0x8e, 0x7a, 0x65, 0x62, 0x6e,
-  0x7d, 0x96, 0xaa, 0xa3, 0x8c, 0x79, 0x60, 0x53, 0x54, 0x56, 0x57, 0x57,
-  0x5f, 0x7b, 0x9a, 0x9f, 0x9e, 0x9d, 0x9a, 0x98, 0x98, 0x98, 0x97, 0x95,
-  0x8b, 0x82, 0x7b, 0x6d, 0x5d, 0x59, 0x55, 0x51, 0x50, 0x5d, 0x6f, 0x78,
-  0x7e, 0x87, 0x8d, 0x82, 0x6e, 0x62, 0x58, 0x59, 0x61, 0x66, 0x67, 0x64,
-  0x5f, 0x62, 0x65, 0x67, 0x6a, 0x6c, 0x6e, 0x70, 0x70, 0x70, 0x73, 0x74,
-  0x73, 0x73, 0x73, 0x74, 0x73, 0x72, 0x72, 0x72, 0x70, 0x6f, 0x6e, 0x6d,
-  0x6d, 0x70, 0x7a, 0x8d, 0x99, 0xa0, 0xa7, 0xac, 0xab, 0xa9, 0xa6, 0xa0,
-  0x98, 0x94, 0x91, 0x90, 0x8e, 0x8d, 0x8e, 0x8d, 0x8c, 0x89, 0x88, 0x86,
-  0x85, 0x84, 0x86, 0x87, 0x87, 0x86, 0x85, 0x82, 0x7c, 0x79, 0x77, 0x78,
-  0x7a, 0x7e, 0x82, 0x83, 0x83, 0x82, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78,
-  0x78, 0x78, 0x79, 0x7a, 0x79, 0x7b, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x80, 0x81, 0x80, 0x82, 0x82, 0x84, 0x86, 0x97, 0x93, 0x90, 0x8d,
-  0x89, 0x83, 0x7f, 0x7c, 0x79, 0x76, 0x73, 0x6f, 0x6d, 0x6c, 0x6b, 0x68,
-  0x66, 0x66, 0x66, 0x65, 0x63, 0x62, 0x62, 0x62, 0x61, 0x60, 0x60, 0x60,
-  0x60, 0x5e, 0x5e, 0x5e, 0x5f, 0x60, 0x60, 0x60, 0x62, 0x64, 0x63, 0x64,
-  0x82, 0xc5, 0xdb, 0xde, 0xdd, 0xdf, 0xde, 0xdd, 0xdd, 0xde, 0xde, 0xdf,
-  0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe1,
-  0xe1, 0xe1, 0xe0, 0xe1, 0xe0, 0xdf, 0xdf, 0xde, 0xdb, 0xda, 0xd9, 0xd9,
-  0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xdb, 0xdb, 0xdb, 0xda, 0xd8, 0xd8,
-  0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd6, 0xd6, 0xd5, 0xd5, 0xd4, 0xd5, 0xd5,
-  0xd5, 0xd5, 0xd4, 0xd2, 0xd3, 0xd2, 0xd1, 0xd0, 0xcf, 0xd0, 0xd1, 0xd0,
-  0xcf, 0xcc, 0xcb, 0xc8, 0xc7, 0xc3, 0xbf, 0xb6, 0xad, 0xa5, 0x9b, 0xa0,
-  0xa9, 0xab, 0xab, 0xaa, 0xaa, 0xa9, 0xa8, 0xa6, 0xa3, 0x9f, 0x9d, 0x9b,
-  0x97, 0x8e, 0x82, 0x7b, 0x84, 0x82, 0x71, 0x6d, 0x8b, 0x9e, 0xa5, 0xa8,
-  0xaa, 0xa6, 0xa1, 0x96, 0x80, 0x6b, 0x61, 0x69, 0x74, 0x88, 0xa6, 0xa9,
-  0x97, 0x84, 0x65, 0x4f, 0x4d, 0x4c, 0x4d, 0x52, 0x6b, 0x8c, 0xa3, 0xa5,
-  0xa2, 0x9d, 0x98, 0x98, 0x9c, 0x9b, 0x95, 0x8f, 0x84, 0x7c, 0x74, 0x67,
-  0x5b, 0x57, 0x4f, 0x4d, 0x54, 0x66, 0x73, 0x7e, 0x85, 0x8d, 0x8f, 0x7e,
-  0x68, 0x5d, 0x57, 0x5c, 0x63, 0x66, 0x65, 0x60, 0x60, 0x65, 0x67, 0x68,
-  0x6a, 0x6b, 0x6e, 0x71, 0x71, 0x71, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
-  0x72, 0x71, 0x71, 0x72, 0x72, 0x70, 0x6f, 0x6e, 0x6d, 0x71, 0x7f, 0x93,
-  0x9f, 0xa5, 0xaa, 0xad, 0xab, 0xa7, 0xa4, 0x9c, 0x94, 0x8f, 0x8a, 0x87,
-  0x84, 0x83, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x80,
-  0x81, 0x82, 0x83, 0x82, 0x7f, 0x7b, 0x79, 0x79, 0x7a, 0x7d, 0x80, 0x81,
-  0x81, 0x80, 0x7d, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x77, 0x78, 0x79,
-  0x79, 0x7b, 0x7e, 0x80, 0x81, 0x83, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81,
-  0x82, 0x83, 0x85, 0x87, 0x94, 0x91, 0x8e, 0x8c, 0x88, 0x82, 0x7f, 0x7c,
-  0x7a, 0x77, 0x73, 0x70, 0x6e, 0x6d, 0x6c, 0x69, 0x67, 0x65, 0x65, 0x65,
-  0x62, 0x63, 0x62, 0x62, 0x61, 0x60, 0x60, 0x5f, 0x60, 0x5f, 0x5e, 0x5e,
-  0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x61, 0x67, 0x9d, 0xd3, 0xdd, 0xde,
-  0xde, 0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xe0,
-  0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe2, 0xe1, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1,
-  0xe1, 0xe1, 0xe1, 0xe0, 0xde, 0xdd, 0xdb, 0xda, 0xd8, 0xd7, 0xd6, 0xd6,
-  0xd7, 0xd8, 0xd9, 0xda, 0xda, 0xd9, 0xd8, 0xd7, 0xd5, 0xd6, 0xd6, 0xd6,
-  0xd6, 0xd6, 0xd6, 0xd5, 0xd3, 0xd3, 0xd3, 0xd4, 0xd4, 0xd4, 0xd3, 0xd3,
-  0xd3, 0xd2, 0xd1, 0xd1, 0xd0, 0xd0, 0xd0, 0xd0, 0xcf, 0xcd, 0xcb, 0xc8,
-  0xc6, 0xc4, 0xc0, 0xb9, 0xb4, 0xac, 0x9f, 0x9a, 0xa5, 0xa9, 0xa9, 0xa9,
-  0xa9, 0xa8, 0xa7, 0xa6, 0xa4, 0xa0, 0x9f, 0x9e, 0x9b, 0x93, 0x88, 0x7d,
-  0x7f, 0x7e, 0x73, 0x68, 0x83, 0x9a, 0xa3, 0xa8, 0xab, 0xaa, 0xa7, 0x9d,
-  0x87, 0x6f, 0x62, 0x66, 0x6d, 0x7e, 0xa0, 0xab, 0x9f, 0x8d, 0x6a, 0x4c,
-  0x45, 0x46, 0x4a, 0x59, 0x79, 0x94, 0xa4, 0xa7, 0xa4, 0x9c, 0x96, 0x9a,
-  0x9f, 0x9e, 0x96, 0x8a, 0x80, 0x79, 0x72, 0x65, 0x5b, 0x56, 0x4d, 0x4d,
-  0x58, 0x6b, 0x77, 0x81, 0x89, 0x91, 0x8f, 0x7b, 0x64, 0x5a, 0x57, 0x5c,
-  0x63, 0x66, 0x64, 0x5f, 0x60, 0x65, 0x68, 0x69, 0x6a, 0x6b, 0x6f, 0x71,
-  0x72, 0x72, 0x73, 0x74, 0x73, 0x73, 0x73, 0x73, 0x70, 0x71, 0x72, 0x72,
-  0x72, 0x71, 0x70, 0x6e, 0x6d, 0x73, 0x84, 0x98, 0xa3, 0xa8, 0xab, 0xac,
-  0xaa, 0xa5, 0xa0, 0x98, 0x8f, 0x88, 0x81, 0x7d, 0x7a, 0x79, 0x79, 0x78,
-  0x77, 0x75, 0x75, 0x73, 0x73, 0x74, 0x75, 0x79, 0x7c, 0x7f, 0x80, 0x80,
-  0x7f, 0x7d, 0x7b, 0x7a, 0x7a, 0x7c, 0x7f, 0x80, 0x81, 0x80, 0x7d, 0x7b,
-  0x7b, 0x7a, 0x78, 0x77, 0x77, 0x78, 0x78, 0x78, 0x79, 0x7d, 0x7e, 0x7f,
-  0x82, 0x84, 0x84, 0x84, 0x84, 0x82, 0x83, 0x83, 0x83, 0x84, 0x86, 0x88,
-  0x93, 0x8f, 0x8d, 0x8a, 0x87, 0x82, 0x7f, 0x7c, 0x7a, 0x77, 0x72, 0x70,
-  0x6e, 0x6d, 0x6c, 0x6a, 0x67, 0x65, 0x64, 0x64, 0x62, 0x62, 0x62, 0x62,
-  0x61, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5e, 0x5d, 0x5e, 0x5f, 0x60, 0x61,
-  0x62, 0x62, 0x61, 0x6b, 0xaf, 0xd8, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2,
-  0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2,
-  0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe0, 0xe1, 0xe0, 0xe1, 0xe0, 0xe1,
-  0xdf, 0xdf, 0xdd, 0xdc, 0xda, 0xd8, 0xd6, 0xd6, 0xd6, 0xd7, 0xd8, 0xd9,
-  0xda, 0xd9, 0xd7, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd5,
-  0xd3, 0xd3, 0xd2, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd1, 0xd1,
-  0xd0, 0xd0, 0xcf, 0xcf, 0xcf, 0xcd, 0xcb, 0xc8, 0xc6, 0xc4, 0xc1, 0xba,
-  0xb6, 0xb0, 0xa3, 0x98, 0xa2, 0xa6, 0xa8, 0xa8, 0xa8, 0xa7, 0xa7, 0xa6,
-  0xa4, 0xa0, 0x9f, 0x9e, 0x9c, 0x96, 0x8b, 0x7f, 0x7e, 0x7c, 0x74, 0x67,
-  0x7d, 0x95, 0xa0, 0xa7, 0xac, 0xac, 0xaa, 0xa0, 0x8a, 0x71, 0x63, 0x63,
-  0x69, 0x7a, 0x9a, 0xab, 0xa4, 0x93, 0x6f, 0x4a, 0x44, 0x4c, 0x54, 0x63,
-  0x7e, 0x95, 0xa3, 0xa6, 0xa3, 0x99, 0x97, 0x9f, 0xa3, 0xa1, 0x97, 0x87,
-  0x7c, 0x77, 0x70, 0x65, 0x5a, 0x53, 0x4c, 0x4e, 0x5b, 0x6d, 0x78, 0x84,
-  0x8c, 0x93, 0x8f, 0x79, 0x61, 0x58, 0x57, 0x5c, 0x63, 0x64, 0x62, 0x5e,
-  0x60, 0x66, 0x68, 0x6a, 0x6b, 0x6c, 0x6e, 0x71, 0x71, 0x71, 0x74, 0x74,
-  0x73, 0x73, 0x74, 0x72, 0x70, 0x71, 0x72, 0x73, 0x73, 0x72, 0x70, 0x6f,
-  0x6e, 0x75, 0x88, 0x9a, 0xa4, 0xa9, 0xac, 0xac, 0xa8, 0xa2, 0x9c, 0x93,
-  0x89, 0x81, 0x7b, 0x77, 0x75, 0x73, 0x74, 0x73, 0x73, 0x71, 0x70, 0x6f,
-  0x6f, 0x70, 0x71, 0x75, 0x78, 0x7c, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7b, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x7d, 0x7b, 0x7b, 0x79, 0x77, 0x77,
-  0x76, 0x77, 0x78, 0x77, 0x79, 0x7d, 0x7e, 0x80, 0x82, 0x85, 0x85, 0x85,
-  0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x87, 0x88, 0x90, 0x8d, 0x8a, 0x88,
-  0x85, 0x80, 0x7e, 0x7b, 0x79, 0x77, 0x72, 0x6f, 0x6e, 0x6d, 0x6c, 0x69,
-  0x67, 0x65, 0x64, 0x64, 0x62, 0x62, 0x62, 0x62, 0x61, 0x60, 0x60, 0x60,
-  0x60, 0x60, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x61, 0x63, 0x60, 0x62, 0x78,
-  0xc1, 0xdb, 0xdc, 0xdc, 0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe1, 0xe0, 0xe1,
-  0xe1, 0xe0, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xde,
-  0xdd, 0xdb, 0xd8, 0xd7, 0xd5, 0xd4, 0xd3, 0xd6, 0xd8, 0xd8, 0xd8, 0xd7,
-  0xd4, 0xd3, 0xd3, 0xd3, 0xd3, 0xd5, 0xd6, 0xd5, 0xd4, 0xd3, 0xd2, 0xd2,
-  0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd2, 0xd1, 0xd0, 0xd0, 0xcf, 0xce,
-  0xce, 0xcd, 0xcb, 0xc8, 0xc7, 0xc5, 0xc1, 0xbc, 0xb8, 0xb3, 0xa8, 0x99,
-  0x9b, 0xa0, 0xa4, 0xa6, 0xa8, 0xa8, 0xa8, 0xa6, 0xa3, 0xa1, 0x9f, 0x9e,
-  0x9c, 0x99, 0x90, 0x83, 0x7d, 0x7b, 0x76, 0x66, 0x73, 0x8c, 0x9a, 0xa4,
-  0xac, 0xae, 0xab, 0xa4, 0x90, 0x74, 0x64, 0x61, 0x65, 0x73, 0x8e, 0xa8,
-  0xaa, 0x9c, 0x78, 0x4a, 0x4b, 0x64, 0x70, 0x76, 0x7e, 0x91, 0xa0, 0xa3,
-  0x9f, 0x94, 0x9c, 0xac, 0xae, 0xa9, 0x98, 0x82, 0x78, 0x71, 0x6b, 0x62,
-  0x59, 0x4f, 0x4b, 0x4f, 0x61, 0x6f, 0x79, 0x87, 0x8f, 0x95, 0x8e, 0x75,
-  0x5f, 0x57, 0x58, 0x5e, 0x62, 0x60, 0x5f, 0x5e, 0x61, 0x67, 0x69, 0x6a,
-  0x6b, 0x6c, 0x6f, 0x70, 0x71, 0x72, 0x74, 0x74, 0x73, 0x73, 0x73, 0x71,
-  0x6f, 0x72, 0x73, 0x75, 0x76, 0x74, 0x71, 0x6f, 0x71, 0x7a, 0x8c, 0x9c,
-  0xa6, 0xaa, 0xac, 0xab, 0xa3, 0x9a, 0x94, 0x88, 0x7d, 0x76, 0x72, 0x70,
-  0x70, 0x6f, 0x70, 0x6f, 0x6e, 0x6c, 0x6b, 0x6b, 0x6c, 0x6c, 0x6f, 0x72,
-  0x74, 0x77, 0x79, 0x7b, 0x7b, 0x7d, 0x7e, 0x7d, 0x7d, 0x7b, 0x7c, 0x7e,
-  0x7e, 0x7d, 0x7b, 0x79, 0x79, 0x78, 0x76, 0x76, 0x75, 0x76, 0x77, 0x76,
-  0x79, 0x7e, 0x7f, 0x80, 0x82, 0x85, 0x86, 0x87, 0x86, 0x85, 0x86, 0x86,
-  0x84, 0x85, 0x87, 0x88, 0x8c, 0x8a, 0x88, 0x87, 0x84, 0x80, 0x7d, 0x79,
-  0x78, 0x76, 0x72, 0x6f, 0x6e, 0x6e, 0x6c, 0x69, 0x67, 0x66, 0x65, 0x64,
-  0x62, 0x62, 0x62, 0x61, 0x61, 0x60, 0x5f, 0x60, 0x60, 0x5f, 0x60, 0x5f,
-  0x5e, 0x5e, 0x5f, 0x62, 0x61, 0x5c, 0x6a, 0x9b, 0xd2, 0xdc, 0xdb, 0xdc,
-  0xdd, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xe0,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2,
-  0xe1, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
-  0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf,
-  0xdf, 0xde, 0xdd, 0xdd, 0xdc, 0xdd, 0xde, 0xde, 0xde, 0xdc, 0xdb, 0xda,
-  0xd8, 0xd6, 0xd3, 0xd3, 0xd3, 0xd4, 0xd5, 0xd7, 0xd6, 0xd5, 0xd4, 0xd2,
-  0xd0, 0xd1, 0xd2, 0xd3, 0xd3, 0xd3, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
-  0xd2, 0xd1, 0xd1, 0xd1, 0xcf, 0xcf, 0xce, 0xce, 0xcd, 0xcb, 0xcb, 0xc9,
-  0xc7, 0xc5, 0xc1, 0xbe, 0xbb, 0xb7, 0xaf, 0xa2, 0x96, 0x98, 0x9c, 0xa1,
-  0xa5, 0xa7, 0xa7, 0xa6, 0xa4, 0xa1, 0x9e, 0x9e, 0x9d, 0x9c, 0x94, 0x89,
-  0x7f, 0x7c, 0x78, 0x69, 0x6a, 0x81, 0x90, 0xa0, 0xab, 0xaf, 0xae, 0xa9,
-  0x97, 0x77, 0x66, 0x61, 0x63, 0x6e, 0x83, 0xa2, 0xae, 0xa7, 0x87, 0x54,
-  0x5c, 0x7f, 0x8c, 0x88, 0x79, 0x87, 0x9c, 0xa3, 0x9e, 0x91, 0xa2, 0xbc,
-  0xbf, 0xb6, 0x9f, 0x87, 0x77, 0x6c, 0x65, 0x5c, 0x54, 0x4b, 0x4d, 0x56,
-  0x67, 0x70, 0x7d, 0x8d, 0x95, 0x99, 0x8e, 0x71, 0x5c, 0x56, 0x59, 0x5f,
-  0x60, 0x5c, 0x5b, 0x5f, 0x64, 0x68, 0x6a, 0x6b, 0x6c, 0x6d, 0x70, 0x71,
-  0x71, 0x72, 0x74, 0x75, 0x74, 0x73, 0x73, 0x71, 0x71, 0x73, 0x75, 0x78,
-  0x7a, 0x78, 0x74, 0x72, 0x74, 0x80, 0x92, 0xa0, 0xa7, 0xaa, 0xaa, 0xa4,
-  0x99, 0x8c, 0x84, 0x7a, 0x72, 0x6d, 0x6b, 0x69, 0x69, 0x6a, 0x6a, 0x69,
-  0x68, 0x67, 0x66, 0x66, 0x66, 0x67, 0x6b, 0x6e, 0x72, 0x75, 0x77, 0x7a,
-  0x7b, 0x7d, 0x7e, 0x7d, 0x7d, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x77,
-  0x76, 0x76, 0x75, 0x75, 0x77, 0x78, 0x78, 0x78, 0x7b, 0x7f, 0x80, 0x82,
-  0x84, 0x86, 0x87, 0x88, 0x87, 0x86, 0x87, 0x87, 0x86, 0x86, 0x87, 0x87,
-  0x89, 0x86, 0x85, 0x84, 0x81, 0x7d, 0x7a, 0x78, 0x76, 0x74, 0x72, 0x70,
-  0x6f, 0x6e, 0x6c, 0x6a, 0x67, 0x66, 0x66, 0x65, 0x62, 0x62, 0x62, 0x62,
-  0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x60, 0x5f, 0x61,
-  0x5e, 0x5f, 0x79, 0xb9, 0xd9, 0xdb, 0xdb, 0xdb, 0xdd, 0xde, 0xde, 0xde,
-  0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xde, 0xde, 0xde, 0xe0, 0xe1, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0, 0xe2, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1,
-  0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe2,
-  0xe2, 0xe2, 0xe2, 0xe0, 0xe1, 0xe1, 0xe1, 0xe0, 0xe0, 0xdf, 0xde, 0xde,
-  0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xda, 0xdb, 0xdb, 0xda, 0xd6, 0xd3,
-  0xd2, 0xd2, 0xd2, 0xd4, 0xd5, 0xd5, 0xd4, 0xd3, 0xcf, 0xcd, 0xcd, 0xce,
-  0xd0, 0xd2, 0xd2, 0xd1, 0xd0, 0xce, 0xce, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf,
-  0xce, 0xce, 0xcd, 0xcd, 0xcc, 0xca, 0xca, 0xc9, 0xc8, 0xc6, 0xc2, 0xbf,
-  0xbc, 0xb9, 0xb3, 0xa8, 0x99, 0x92, 0x92, 0x99, 0xa0, 0xa3, 0xa5, 0xa5,
-  0xa3, 0xa2, 0xa0, 0x9f, 0x9f, 0x9d, 0x98, 0x8e, 0x84, 0x7f, 0x7a, 0x6d,
-  0x65, 0x74, 0x83, 0x98, 0xa8, 0xae, 0xb0, 0xac, 0x9c, 0x78, 0x67, 0x63,
-  0x64, 0x6b, 0x7a, 0x98, 0xac, 0xae, 0x95, 0x63, 0x68, 0x87, 0x93, 0x8d,
-  0x77, 0x79, 0x94, 0xa2, 0xa0, 0x95, 0x9a, 0xb1, 0xbb, 0xb7, 0xa4, 0x8e,
-  0x78, 0x68, 0x60, 0x59, 0x4e, 0x49, 0x53, 0x5d, 0x6a, 0x6f, 0x82, 0x94,
-  0x9b, 0x9b, 0x8c, 0x6d, 0x5b, 0x56, 0x5a, 0x5f, 0x5e, 0x5c, 0x5d, 0x61,
-  0x66, 0x69, 0x6a, 0x6b, 0x6c, 0x6f, 0x72, 0x73, 0x73, 0x75, 0x75, 0x74,
-  0x74, 0x74, 0x72, 0x71, 0x73, 0x74, 0x76, 0x7b, 0x7e, 0x7c, 0x79, 0x77,
-  0x79, 0x86, 0x96, 0xa2, 0xa8, 0xa8, 0xa4, 0x98, 0x87, 0x7b, 0x75, 0x70,
-  0x6c, 0x68, 0x65, 0x65, 0x64, 0x66, 0x67, 0x66, 0x65, 0x63, 0x63, 0x64,
-  0x64, 0x65, 0x69, 0x6d, 0x71, 0x73, 0x74, 0x78, 0x7b, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x77, 0x75, 0x75, 0x75, 0x77,
-  0x79, 0x7b, 0x7c, 0x7c, 0x80, 0x82, 0x84, 0x85, 0x87, 0x88, 0x87, 0x89,
-  0x89, 0x88, 0x88, 0x87, 0x86, 0x86, 0x87, 0x85, 0x86, 0x84, 0x82, 0x81,
-  0x7e, 0x7a, 0x78, 0x75, 0x74, 0x73, 0x71, 0x70, 0x6e, 0x6d, 0x6b, 0x6a,
-  0x67, 0x66, 0x66, 0x65, 0x62, 0x61, 0x62, 0x62, 0x60, 0x60, 0x60, 0x5f,
-  0x5f, 0x5f, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x6e, 0x8d, 0xc7,
-  0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xdd,
-  0xdd, 0xdd, 0xdf, 0xdf, 0xdf, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1, 0xe3, 0xe3, 0xe3, 0xe2,
-  0xe3, 0xe3, 0xe2, 0xe2, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0xde, 0xde, 0xdc, 0xdc,
-  0xda, 0xda, 0xd9, 0xda, 0xda, 0xdb, 0xd9, 0xd7, 0xd6, 0xd4, 0xd2, 0xd2,
-  0xd2, 0xd3, 0xd3, 0xd3, 0xd1, 0xcd, 0xcb, 0xcb, 0xcc, 0xce, 0xd1, 0xd1,
-  0xd0, 0xce, 0xcc, 0xcd, 0xce, 0xcf, 0xcf, 0xce, 0xcd, 0xcd, 0xcd, 0xcd,
-  0xcb, 0xc9, 0xca, 0xc9, 0xc8, 0xc7, 0xc4, 0xbf, 0xbb, 0xb9, 0xb5, 0xac,
-  0x9e, 0x92, 0x8e, 0x93, 0x9b, 0xa1, 0xa4, 0xa4, 0xa2, 0xa3, 0xa2, 0xa1,
-  0xa0, 0x9e, 0x9b, 0x92, 0x88, 0x82, 0x7d, 0x71, 0x66, 0x6d, 0x79, 0x91,
-  0xa4, 0xae, 0xb1, 0xaf, 0xa0, 0x7a, 0x69, 0x65, 0x65, 0x6a, 0x76, 0x8e,
-  0xa8, 0xaf, 0x9f, 0x71, 0x70, 0x89, 0x93, 0x8d, 0x78, 0x6d, 0x8a, 0x9f,
-  0xa3, 0x9b, 0x8d, 0x96, 0xa8, 0xac, 0xa4, 0x91, 0x77, 0x66, 0x5e, 0x55,
-  0x4a, 0x48, 0x57, 0x62, 0x6a, 0x70, 0x88, 0x99, 0x9f, 0x9a, 0x88, 0x69,
-  0x59, 0x57, 0x5c, 0x5f, 0x5d, 0x5d, 0x5f, 0x62, 0x67, 0x6a, 0x6c, 0x6c,
-  0x6d, 0x70, 0x72, 0x73, 0x74, 0x76, 0x76, 0x74, 0x74, 0x74, 0x73, 0x72,
-  0x73, 0x74, 0x77, 0x7d, 0x81, 0x7f, 0x7d, 0x7c, 0x7e, 0x89, 0x98, 0xa2,
-  0xa6, 0xa5, 0x9c, 0x8b, 0x79, 0x70, 0x6d, 0x69, 0x67, 0x64, 0x64, 0x64,
-  0x63, 0x64, 0x65, 0x65, 0x63, 0x62, 0x62, 0x63, 0x65, 0x66, 0x6a, 0x6e,
-  0x71, 0x72, 0x74, 0x77, 0x7b, 0x7e, 0x7e, 0x7e, 0x7d, 0x7a, 0x78, 0x77,
-  0x76, 0x77, 0x76, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7c, 0x7f, 0x7f, 0x80,
-  0x84, 0x86, 0x86, 0x87, 0x89, 0x8a, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x87,
-  0x86, 0x86, 0x86, 0x85, 0x84, 0x82, 0x80, 0x7f, 0x7c, 0x78, 0x77, 0x74,
-  0x73, 0x73, 0x70, 0x6f, 0x6e, 0x6c, 0x6a, 0x69, 0x67, 0x66, 0x65, 0x65,
-  0x63, 0x62, 0x62, 0x61, 0x60, 0x60, 0x60, 0x5f, 0x5f, 0x60, 0x60, 0x5f,
-  0x60, 0x60, 0x5f, 0x5f, 0x61, 0x7e, 0x9e, 0xce, 0xdb, 0xdb, 0xdc, 0xdd,
-  0xdd, 0xde, 0xdf, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xdd, 0xde, 0xdf, 0xdf,
-  0xdf, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe1,
-  0xe1, 0xe1, 0xe0, 0xe1, 0xe3, 0xe3, 0xe3, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1,
-  0xe1, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdd, 0xdb, 0xdb, 0xd9, 0xda,
-  0xda, 0xdb, 0xda, 0xd9, 0xd8, 0xd6, 0xd4, 0xd2, 0xd1, 0xd1, 0xd2, 0xd3,
-  0xd2, 0xce, 0xcb, 0xca, 0xc9, 0xcb, 0xcf, 0xd0, 0xd0, 0xce, 0xcd, 0xcc,
-  0xcd, 0xce, 0xce, 0xce, 0xcd, 0xcd, 0xcc, 0xcc, 0xcb, 0xca, 0xc9, 0xc9,
-  0xc8, 0xc7, 0xc4, 0xc0, 0xbc, 0xb9, 0xb6, 0xae, 0xa1, 0x95, 0x8f, 0x8f,
-  0x98, 0xa0, 0xa3, 0xa3, 0xa2, 0xa3, 0xa3, 0xa2, 0xa1, 0x9f, 0x9c, 0x93,
-  0x8a, 0x85, 0x7f, 0x73, 0x66, 0x68, 0x74, 0x8d, 0xa2, 0xae, 0xb2, 0xb0,
-  0xa3, 0x7c, 0x69, 0x66, 0x66, 0x6a, 0x74, 0x89, 0xa4, 0xae, 0xa3, 0x7a,
-  0x75, 0x8b, 0x94, 0x8d, 0x78, 0x67, 0x82, 0x9b, 0xa2, 0x9d, 0x8a, 0x84,
-  0x96, 0x9f, 0x9e, 0x90, 0x76, 0x64, 0x5b, 0x52, 0x47, 0x4a, 0x5b, 0x64,
-  0x6c, 0x72, 0x8c, 0x9c, 0x9f, 0x9a, 0x86, 0x65, 0x58, 0x57, 0x5c, 0x5e,
-  0x5c, 0x5e, 0x60, 0x63, 0x68, 0x6b, 0x6c, 0x6c, 0x6d, 0x71, 0x73, 0x74,
-  0x74, 0x76, 0x76, 0x74, 0x75, 0x75, 0x74, 0x73, 0x74, 0x76, 0x79, 0x7f,
-  0x83, 0x82, 0x7f, 0x7e, 0x80, 0x8b, 0x99, 0xa2, 0xa3, 0xa0, 0x95, 0x82,
-  0x72, 0x6c, 0x68, 0x65, 0x63, 0x62, 0x63, 0x64, 0x63, 0x65, 0x65, 0x64,
-  0x63, 0x62, 0x61, 0x63, 0x65, 0x67, 0x6a, 0x6f, 0x72, 0x73, 0x73, 0x76,
-  0x7a, 0x7d, 0x7e, 0x7e, 0x7d, 0x7a, 0x78, 0x76, 0x75, 0x75, 0x76, 0x77,
-  0x77, 0x78, 0x7a, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x86, 0x87, 0x88, 0x89,
-  0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84,
-  0x81, 0x81, 0x7f, 0x7d, 0x7b, 0x77, 0x75, 0x74, 0x74, 0x72, 0x70, 0x70,
-  0x6d, 0x6c, 0x6a, 0x69, 0x67, 0x66, 0x65, 0x64, 0x63, 0x62, 0x61, 0x61,
-  0x61, 0x60, 0x5f, 0x5f, 0x5f, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e,
-  0x65, 0x97, 0xb9, 0xd4, 0xda, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xde, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xe0, 0xe1, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe2,
-  0xe3, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1,
-  0xe2, 0xe2, 0xe2, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe0, 0xe1, 0xe1,
-  0xe1, 0xe1, 0xdf, 0xdf, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb, 0xda, 0xd9, 0xd8,
-  0xd9, 0xda, 0xd8, 0xd5, 0xd2, 0xd1, 0xd1, 0xd2, 0xd3, 0xd1, 0xce, 0xcc,
-  0xc9, 0xc7, 0xcb, 0xcd, 0xcf, 0xcf, 0xcd, 0xcb, 0xcb, 0xcc, 0xcc, 0xcd,
-  0xcc, 0xcb, 0xcc, 0xcc, 0xcc, 0xcb, 0xc8, 0xc8, 0xc8, 0xc7, 0xc5, 0xc0,
-  0xbd, 0xbb, 0xb7, 0xb1, 0xa7, 0x9c, 0x94, 0x8d, 0x94, 0x9d, 0xa0, 0xa1,
-  0xa1, 0xa2, 0xa3, 0xa3, 0xa1, 0x9f, 0x9c, 0x96, 0x8f, 0x8a, 0x81, 0x74,
-  0x68, 0x64, 0x6c, 0x86, 0x9f, 0xac, 0xb2, 0xb1, 0xa5, 0x7f, 0x6a, 0x67,
-  0x67, 0x68, 0x71, 0x84, 0x9e, 0xa9, 0xa7, 0x89, 0x81, 0x94, 0x99, 0x8f,
-  0x78, 0x63, 0x78, 0x93, 0x9e, 0x9d, 0x8c, 0x74, 0x7a, 0x83, 0x8c, 0x8a,
-  0x73, 0x5e, 0x54, 0x4a, 0x46, 0x50, 0x60, 0x6a, 0x70, 0x79, 0x93, 0x9e,
-  0x9f, 0x97, 0x81, 0x61, 0x57, 0x58, 0x5c, 0x5e, 0x5c, 0x5e, 0x60, 0x65,
-  0x68, 0x6b, 0x6b, 0x6b, 0x6e, 0x72, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75,
-  0x76, 0x76, 0x76, 0x74, 0x76, 0x79, 0x7d, 0x83, 0x86, 0x84, 0x81, 0x81,
-  0x83, 0x8c, 0x97, 0x9e, 0x9d, 0x96, 0x88, 0x77, 0x6c, 0x67, 0x64, 0x62,
-  0x61, 0x61, 0x63, 0x64, 0x65, 0x66, 0x65, 0x63, 0x63, 0x62, 0x61, 0x63,
-  0x65, 0x67, 0x6b, 0x70, 0x72, 0x74, 0x74, 0x74, 0x77, 0x7c, 0x7e, 0x7f,
-  0x7d, 0x7a, 0x76, 0x74, 0x74, 0x75, 0x76, 0x79, 0x7a, 0x7a, 0x7c, 0x7f,
-  0x81, 0x82, 0x83, 0x86, 0x88, 0x89, 0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8b,
-  0x8a, 0x89, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84, 0x7f, 0x7e, 0x7c, 0x7a,
-  0x77, 0x75, 0x75, 0x74, 0x73, 0x72, 0x70, 0x6f, 0x6e, 0x6c, 0x69, 0x68,
-  0x66, 0x65, 0x64, 0x62, 0x63, 0x62, 0x61, 0x61, 0x61, 0x60, 0x5f, 0x5f,
-  0x5f, 0x5f, 0x5f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5e, 0x71, 0xb0, 0xcf, 0xd8,
-  0xda, 0xdb, 0xdc, 0xdc, 0xdc, 0xdb, 0xdc, 0xdd, 0xdd, 0xde, 0xde, 0xdf,
-  0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe2, 0xe2, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe1, 0xe0,
-  0xe1, 0xe1, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xdf, 0xe0,
-  0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0,
-  0xde, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xda, 0xd8, 0xd9, 0xd9, 0xd8, 0xd7,
-  0xd6, 0xd4, 0xd4, 0xd2, 0xd3, 0xd3, 0xd2, 0xd0, 0xcb, 0xc6, 0xc6, 0xc8,
-  0xca, 0xcd, 0xce, 0xcc, 0xc9, 0xc8, 0xc9, 0xc9, 0xcb, 0xc9, 0xca, 0xca,
-  0xcb, 0xcb, 0xc9, 0xc7, 0xc7, 0xc6, 0xc5, 0xc2, 0xbf, 0xbc, 0xb8, 0xb2,
-  0xac, 0xa4, 0x9c, 0x90, 0x8d, 0x96, 0x9a, 0x9c, 0x9f, 0xa0, 0xa1, 0xa1,
-  0xa0, 0x9e, 0x9e, 0x99, 0x93, 0x8e, 0x86, 0x78, 0x6a, 0x62, 0x66, 0x7b,
-  0x97, 0xa9, 0xb1, 0xb2, 0xa8, 0x85, 0x6b, 0x68, 0x68, 0x6a, 0x70, 0x7e,
-  0x94, 0xa1, 0xab, 0x9a, 0x91, 0xa8, 0xab, 0x93, 0x7a, 0x63, 0x6f, 0x89,
-  0x95, 0x9b, 0x91, 0x6d, 0x5d, 0x5d, 0x69, 0x77, 0x6b, 0x59, 0x4f, 0x48,
-  0x4d, 0x59, 0x65, 0x6c, 0x74, 0x82, 0x9a, 0xa0, 0x9d, 0x93, 0x79, 0x5d,
-  0x57, 0x59, 0x5e, 0x5d, 0x5d, 0x5f, 0x61, 0x65, 0x69, 0x6b, 0x6b, 0x6c,
-  0x6f, 0x72, 0x76, 0x78, 0x78, 0x77, 0x76, 0x75, 0x76, 0x77, 0x77, 0x77,
-  0x7a, 0x7f, 0x83, 0x88, 0x88, 0x86, 0x83, 0x83, 0x85, 0x8d, 0x95, 0x96,
-  0x8f, 0x86, 0x77, 0x6b, 0x65, 0x62, 0x61, 0x60, 0x61, 0x62, 0x64, 0x65,
-  0x66, 0x66, 0x66, 0x64, 0x63, 0x62, 0x62, 0x64, 0x67, 0x69, 0x6d, 0x70,
-  0x73, 0x74, 0x74, 0x74, 0x75, 0x79, 0x7d, 0x7e, 0x7d, 0x7a, 0x76, 0x73,
-  0x73, 0x76, 0x79, 0x7e, 0x80, 0x80, 0x81, 0x83, 0x86, 0x86, 0x87, 0x89,
-  0x8c, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x87, 0x86,
-  0x85, 0x85, 0x85, 0x84, 0x7d, 0x7b, 0x79, 0x78, 0x76, 0x75, 0x73, 0x72,
-  0x71, 0x71, 0x70, 0x6e, 0x6d, 0x6b, 0x68, 0x67, 0x64, 0x64, 0x63, 0x62,
-  0x63, 0x61, 0x60, 0x61, 0x61, 0x60, 0x5f, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e,
-  0x5e, 0x5f, 0x5f, 0x62, 0x88, 0xc1, 0xd7, 0xd8, 0xd9, 0xdb, 0xdc, 0xdc,
-  0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde,
-  0xde, 0xe0, 0xe1, 0xe0, 0xe1, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe2, 0xe2,
-  0xe1, 0xe1, 0xe2, 0xe2, 0xe0, 0xe1, 0xe0, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf,
-  0xe0, 0xe0, 0xdf, 0xe0, 0xe0, 0xe0, 0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xdf,
-  0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xdf, 0xe0, 0xe0, 0xe0,
-  0xe0, 0xdf, 0xdd, 0xdc, 0xda, 0xda, 0xd9, 0xd7, 0xd6, 0xd6, 0xd5, 0xd5,
-  0xd4, 0xd2, 0xd2, 0xd1, 0xcf, 0xcb, 0xc5, 0xc4, 0xc4, 0xc7, 0xcb, 0xcd,
-  0xcb, 0xc8, 0xc6, 0xc5, 0xc8, 0xc9, 0xc9, 0xc9, 0xc8, 0xca, 0xc9, 0xc7,
-  0xc6, 0xc5, 0xc5, 0xc2, 0xc0, 0xbe, 0xba, 0xb3, 0xad, 0xa7, 0xa1, 0x96,
-  0x8a, 0x8d, 0x93, 0x97, 0x9b, 0x9d, 0xa1, 0xa2, 0xa1, 0x9f, 0x9e, 0x9b,
-  0x95, 0x92, 0x8b, 0x7f, 0x70, 0x64, 0x64, 0x71, 0x8e, 0xa5, 0xaf, 0xb1,
-  0xa9, 0x8a, 0x6d, 0x68, 0x69, 0x6c, 0x6f, 0x7a, 0x8a, 0x97, 0xa9, 0xa2,
-  0x93, 0xb0, 0xb5, 0x9b, 0x7e, 0x65, 0x6b, 0x83, 0x8f, 0x95, 0x95, 0x75,
-  0x59, 0x4e, 0x4d, 0x58, 0x5a, 0x56, 0x55, 0x57, 0x5c, 0x60, 0x65, 0x69,
-  0x72, 0x86, 0x9d, 0x9e, 0x99, 0x8b, 0x70, 0x5a, 0x59, 0x5b, 0x5d, 0x5b,
-  0x5f, 0x61, 0x63, 0x65, 0x69, 0x6b, 0x6b, 0x6c, 0x6f, 0x72, 0x76, 0x78,
-  0x78, 0x78, 0x77, 0x75, 0x76, 0x78, 0x79, 0x7b, 0x7f, 0x83, 0x86, 0x89,
-  0x88, 0x85, 0x82, 0x82, 0x84, 0x8a, 0x8f, 0x89, 0x7d, 0x75, 0x6c, 0x64,
-  0x61, 0x60, 0x5f, 0x5f, 0x60, 0x63, 0x65, 0x66, 0x68, 0x68, 0x67, 0x66,
-  0x65, 0x64, 0x63, 0x66, 0x69, 0x6b, 0x6e, 0x72, 0x74, 0x74, 0x74, 0x73,
-  0x74, 0x77, 0x7c, 0x7d, 0x7c, 0x7a, 0x75, 0x73, 0x74, 0x78, 0x7e, 0x82,
-  0x85, 0x86, 0x87, 0x89, 0x8b, 0x8c, 0x8c, 0x8c, 0x8e, 0x90, 0x91, 0x91,
-  0x90, 0x90, 0x8e, 0x8c, 0x8b, 0x8a, 0x87, 0x86, 0x85, 0x84, 0x84, 0x82,
-  0x7e, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x73, 0x71, 0x71, 0x70, 0x6e, 0x6c,
-  0x6b, 0x6a, 0x68, 0x66, 0x65, 0x63, 0x63, 0x62, 0x62, 0x60, 0x60, 0x61,
-  0x61, 0x5f, 0x5e, 0x5e, 0x5f, 0x60, 0x60, 0x5f, 0x60, 0x60, 0x5f, 0x65,
-  0x9c, 0xca, 0xd9, 0xd8, 0xd8, 0xda, 0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdc,
-  0xdc, 0xdc, 0xdc, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1,
-  0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xde,
-  0xde, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-  0xde, 0xde, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xde, 0xde,
-  0xdc, 0xdb, 0xd9, 0xd8, 0xd6, 0xd5, 0xd5, 0xd6, 0xd4, 0xd3, 0xd3, 0xd3,
-  0xd1, 0xce, 0xc8, 0xc3, 0xc2, 0xc3, 0xc8, 0xcd, 0xcd, 0xc9, 0xc6, 0xc5,
-  0xc5, 0xc8, 0xc9, 0xc9, 0xc8, 0xc9, 0xc7, 0xc7, 0xc6, 0xc5, 0xc4, 0xc1,
-  0xc0, 0xbf, 0xbb, 0xb4, 0xaf, 0xaa, 0xa5, 0x9b, 0x8b, 0x88, 0x8e, 0x93,
-  0x98, 0x9c, 0xa0, 0xa1, 0xa1, 0xa0, 0x9f, 0x9c, 0x96, 0x92, 0x8e, 0x85,
-  0x75, 0x68, 0x64, 0x6b, 0x89, 0xa2, 0xad, 0xb0, 0xaa, 0x8f, 0x6d, 0x67,
-  0x69, 0x6d, 0x70, 0x7a, 0x85, 0x91, 0xa6, 0xa6, 0x93, 0xa9, 0xb1, 0xa0,
-  0x83, 0x66, 0x68, 0x7e, 0x89, 0x8e, 0x93, 0x7d, 0x62, 0x52, 0x44, 0x42,
-  0x4d, 0x5d, 0x65, 0x6b, 0x6a, 0x64, 0x64, 0x66, 0x6e, 0x86, 0x9c, 0x9b,
-  0x94, 0x83, 0x6a, 0x59, 0x59, 0x5b, 0x5c, 0x5b, 0x60, 0x62, 0x64, 0x66,
-  0x69, 0x6b, 0x6c, 0x6d, 0x6f, 0x71, 0x75, 0x77, 0x77, 0x76, 0x77, 0x77,
-  0x77, 0x78, 0x7b, 0x7d, 0x82, 0x85, 0x87, 0x87, 0x86, 0x84, 0x82, 0x82,
-  0x83, 0x85, 0x85, 0x7c, 0x72, 0x6c, 0x67, 0x61, 0x5e, 0x5e, 0x5e, 0x5f,
-  0x61, 0x65, 0x66, 0x68, 0x69, 0x69, 0x68, 0x66, 0x65, 0x65, 0x65, 0x67,
-  0x6a, 0x6b, 0x6e, 0x72, 0x75, 0x75, 0x74, 0x72, 0x73, 0x76, 0x7a, 0x7c,
-  0x7c, 0x7a, 0x75, 0x74, 0x76, 0x7b, 0x81, 0x85, 0x88, 0x88, 0x8a, 0x8c,
-  0x8d, 0x8f, 0x8f, 0x8f, 0x90, 0x92, 0x93, 0x93, 0x92, 0x91, 0x8e, 0x8c,
-  0x8b, 0x89, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7d, 0x7a, 0x79, 0x78,
-  0x76, 0x74, 0x72, 0x71, 0x70, 0x6f, 0x6d, 0x6b, 0x6a, 0x69, 0x68, 0x66,
-  0x65, 0x63, 0x63, 0x62, 0x61, 0x5f, 0x60, 0x61, 0x61, 0x5f, 0x5d, 0x5d,
-  0x5e, 0x60, 0x61, 0x60, 0x60, 0x60, 0x5f, 0x66, 0xa7, 0xd0, 0xda, 0xd8,
-  0xd8, 0xd9, 0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdc,
-  0xdd, 0xdd, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xdf, 0xde, 0xdf,
-  0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xdf, 0xdf, 0xdf, 0xde,
-  0xdf, 0xdf, 0xde, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdc,
-  0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xdd, 0xde, 0xde,
-  0xdd, 0xde, 0xdf, 0xe0, 0xe0, 0xe0, 0xde, 0xdd, 0xdd, 0xdc, 0xda, 0xd9,
-  0xd7, 0xd5, 0xd5, 0xd5, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd0, 0xcb, 0xc5,
-  0xc2, 0xc1, 0xc5, 0xcb, 0xcd, 0xca, 0xc8, 0xc5, 0xc4, 0xc7, 0xc8, 0xc8,
-  0xc7, 0xc8, 0xc7, 0xc7, 0xc6, 0xc5, 0xc2, 0xc0, 0xc0, 0xbf, 0xbb, 0xb4,
-  0xaf, 0xab, 0xa7, 0x9e, 0x8d, 0x85, 0x8a, 0x8f, 0x96, 0x9b, 0x9f, 0xa0,
-  0xa0, 0xa0, 0xa0, 0x9d, 0x97, 0x93, 0x90, 0x87, 0x79, 0x6b, 0x66, 0x68,
-  0x83, 0x9f, 0xab, 0xae, 0xaa, 0x91, 0x6d, 0x67, 0x69, 0x6d, 0x70, 0x7a,
-  0x84, 0x90, 0xa3, 0xa8, 0x93, 0xa1, 0xa9, 0xa1, 0x87, 0x69, 0x67, 0x7a,
-  0x84, 0x8a, 0x91, 0x7f, 0x66, 0x56, 0x44, 0x3b, 0x4b, 0x64, 0x70, 0x76,
-  0x70, 0x66, 0x63, 0x64, 0x6b, 0x88, 0x9a, 0x97, 0x8f, 0x7e, 0x66, 0x59,
-  0x5a, 0x5b, 0x5b, 0x5c, 0x60, 0x63, 0x65, 0x67, 0x68, 0x6b, 0x6d, 0x6d,
-  0x6e, 0x70, 0x74, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x78, 0x7a, 0x7d,
-  0x81, 0x84, 0x84, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7d, 0x74,
-  0x6d, 0x69, 0x64, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x62, 0x66, 0x68, 0x69,
-  0x6a, 0x69, 0x68, 0x66, 0x66, 0x65, 0x66, 0x68, 0x6a, 0x6c, 0x6e, 0x72,
-  0x75, 0x75, 0x74, 0x72, 0x73, 0x75, 0x78, 0x79, 0x7a, 0x79, 0x76, 0x77,
-  0x78, 0x7d, 0x83, 0x88, 0x89, 0x8a, 0x8c, 0x8d, 0x8f, 0x90, 0x91, 0x91,
-  0x91, 0x93, 0x93, 0x93, 0x92, 0x90, 0x8e, 0x8c, 0x8b, 0x89, 0x86, 0x84,
-  0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x72, 0x71,
-  0x70, 0x6f, 0x6b, 0x68, 0x68, 0x68, 0x67, 0x64, 0x63, 0x62, 0x61, 0x61,
-  0x60, 0x60, 0x61, 0x61, 0x61, 0x5f, 0x5d, 0x5e, 0x5e, 0x60, 0x61, 0x61,
-  0x61, 0x61, 0x5e, 0x6b, 0xb6, 0xd4, 0xd9, 0xd8, 0xd8, 0xd9, 0xda, 0xda,
-  0xda, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xdd, 0xdd, 0xdd, 0xde, 0xdf,
-  0xde, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xe1, 0xe2, 0xe2, 0xe2,
-  0xe2, 0xe2, 0xe2, 0xe1, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdd,
-  0xdd, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdd, 0xdd, 0xdd, 0xde, 0xde,
-  0xde, 0xde, 0xde, 0xdf, 0xdf, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xde, 0xde,
-  0xde, 0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xd9, 0xd8, 0xd7, 0xd5,
-  0xd3, 0xd2, 0xd3, 0xd3, 0xd2, 0xd1, 0xce, 0xca, 0xc6, 0xc0, 0xc0, 0xc5,
-  0xca, 0xcc, 0xcb, 0xc6, 0xc2, 0xc4, 0xc5, 0xc6, 0xc5, 0xc5, 0xc5, 0xc6,
-  0xc6, 0xc5, 0xc1, 0xc0, 0xbf, 0xbe, 0xbc, 0xb6, 0xb0, 0xad, 0xaa, 0xa2,
-  0x92, 0x84, 0x83, 0x87, 0x91, 0x99, 0x9d, 0x9e, 0x9e, 0x9f, 0x9f, 0x9e,
-  0x99, 0x96, 0x92, 0x8b, 0x7f, 0x72, 0x6b, 0x67, 0x7b, 0x99, 0xa7, 0xac,
-  0xa9, 0x92, 0x6e, 0x64, 0x66, 0x6d, 0x6f, 0x79, 0x86, 0x90, 0xa0, 0xaa,
-  0x98, 0x95, 0x9c, 0xa3, 0x8d, 0x6d, 0x66, 0x73, 0x7a, 0x82, 0x8c, 0x7f,
-  0x69, 0x5b, 0x4b, 0x41, 0x53, 0x6e, 0x7b, 0x7f, 0x74, 0x66, 0x62, 0x63,
-  0x6c, 0x8b, 0x99, 0x91, 0x88, 0x77, 0x61, 0x58, 0x5b, 0x5c, 0x5b, 0x5d,
-  0x60, 0x63, 0x64, 0x67, 0x68, 0x6a, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x73,
-  0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x78, 0x7a, 0x7d, 0x7e, 0x7d, 0x7a,
-  0x79, 0x7a, 0x79, 0x78, 0x78, 0x76, 0x72, 0x6b, 0x66, 0x63, 0x5f, 0x5d,
-  0x5d, 0x5e, 0x5e, 0x60, 0x62, 0x66, 0x68, 0x6a, 0x6a, 0x6a, 0x69, 0x67,
-  0x67, 0x66, 0x67, 0x69, 0x6c, 0x6d, 0x6f, 0x72, 0x75, 0x74, 0x73, 0x71,
-  0x71, 0x72, 0x74, 0x75, 0x76, 0x76, 0x76, 0x79, 0x7c, 0x81, 0x86, 0x8b,
-  0x8d, 0x8d, 0x8e, 0x90, 0x92, 0x92, 0x92, 0x92, 0x91, 0x93, 0x93, 0x93,
-  0x92, 0x90, 0x8d, 0x8b, 0x8a, 0x87, 0x84, 0x80, 0x80, 0x7f, 0x7d, 0x7e,
-  0x7b, 0x79, 0x78, 0x78, 0x76, 0x74, 0x71, 0x6f, 0x6e, 0x6d, 0x69, 0x67,
-  0x66, 0x66, 0x65, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x62,
-  0x61, 0x5f, 0x5e, 0x60, 0x60, 0x60, 0x61, 0x62, 0x63, 0x62, 0x60, 0x75,
-  0xc1, 0xd6, 0xd8, 0xd7, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xdb, 0xdb, 0xdb,
-  0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xde, 0xdf, 0xde, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xde, 0xdf, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
-  0xdf, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0,
-  0xe0, 0xe0, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdd, 0xde,
-  0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb,
-  0xdc, 0xdc, 0xdd, 0xdd, 0xda, 0xda, 0xd9, 0xd7, 0xd6, 0xd3, 0xd3, 0xd2,
-  0xd2, 0xd2, 0xd1, 0xce, 0xcb, 0xc5, 0xc0, 0xbf, 0xc5, 0xc9, 0xcb, 0xc9,
-  0xc4, 0xc0, 0xc1, 0xc3, 0xc4, 0xc4, 0xc4, 0xc5, 0xc4, 0xc4, 0xc2, 0xbe,
-  0xbe, 0xbe, 0xbc, 0xb8, 0xb2, 0xaf, 0xad, 0xa6, 0x9a, 0x89, 0x7f, 0x80,
-  0x8a, 0x96, 0x99, 0x9b, 0x9c, 0x9d, 0x9e, 0x9e, 0x9b, 0x98, 0x95, 0x90,
-  0x86, 0x7a, 0x71, 0x67, 0x70, 0x90, 0xa4, 0xab, 0xa9, 0x94, 0x6e, 0x62,
-  0x63, 0x6d, 0x70, 0x77, 0x87, 0x91, 0x9d, 0xaa, 0x9d, 0x8f, 0x92, 0xa3,
-  0x92, 0x72, 0x69, 0x6b, 0x6f, 0x77, 0x81, 0x78, 0x6a, 0x63, 0x5b, 0x56,
-  0x62, 0x75, 0x7e, 0x80, 0x70, 0x62, 0x62, 0x65, 0x6f, 0x89, 0x94, 0x8b,
-  0x81, 0x70, 0x5a, 0x57, 0x5c, 0x5d, 0x5b, 0x5e, 0x61, 0x64, 0x65, 0x67,
-  0x69, 0x6a, 0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x72, 0x71,
-  0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x72, 0x71, 0x72, 0x73, 0x73, 0x73,
-  0x71, 0x6d, 0x69, 0x63, 0x60, 0x5e, 0x5c, 0x5d, 0x5d, 0x5e, 0x5f, 0x5f,
-  0x62, 0x66, 0x69, 0x6a, 0x6c, 0x6c, 0x6a, 0x69, 0x68, 0x67, 0x68, 0x6a,
-  0x6d, 0x6e, 0x71, 0x74, 0x76, 0x74, 0x73, 0x71, 0x70, 0x70, 0x70, 0x70,
-  0x71, 0x73, 0x76, 0x7a, 0x7d, 0x83, 0x8a, 0x8f, 0x90, 0x91, 0x91, 0x93,
-  0x95, 0x94, 0x94, 0x93, 0x91, 0x93, 0x92, 0x92, 0x91, 0x8f, 0x8b, 0x89,
-  0x88, 0x85, 0x81, 0x7e, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x77,
-  0x75, 0x73, 0x72, 0x6f, 0x6d, 0x6c, 0x68, 0x66, 0x65, 0x64, 0x63, 0x60,
-  0x5f, 0x5f, 0x60, 0x61, 0x61, 0x60, 0x61, 0x62, 0x63, 0x61, 0x5f, 0x60,
-  0x60, 0x60, 0x62, 0x64, 0x63, 0x62, 0x65, 0x88, 0xc8, 0xd7, 0xd6, 0xd6,
-  0xd7, 0xd8, 0xd8, 0xd8, 0xd9, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-  0xdb, 0xdb, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xdf,
-  0xde, 0xde, 0xe0, 0xe0, 0xdf, 0xdf, 0xde, 0xdf, 0xe0, 0xdf, 0xde, 0xdf,
-  0xde, 0xde, 0xdf, 0xdf, 0xde, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc,
-  0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xdb,
-  0xdb, 0xdb, 0xdb, 0xd9, 0xd8, 0xd6, 0xd3, 0xd2, 0xd1, 0xd1, 0xd1, 0xd1,
-  0xcf, 0xcc, 0xc5, 0xbd, 0xbe, 0xc3, 0xc6, 0xc8, 0xc7, 0xc2, 0xbe, 0xbf,
-  0xc2, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 0xbe, 0xbd, 0xbc, 0xba, 0xb7,
-  0xb3, 0xb0, 0xae, 0xa9, 0x9f, 0x8f, 0x82, 0x7f, 0x82, 0x8e, 0x95, 0x97,
-  0x99, 0x9b, 0x9d, 0x9d, 0x9b, 0x98, 0x96, 0x93, 0x8a, 0x7c, 0x72, 0x67,
-  0x6a, 0x88, 0x9f, 0xa8, 0xa8, 0x96, 0x70, 0x61, 0x61, 0x6b, 0x72, 0x76,
-  0x85, 0x8f, 0x9a, 0xa8, 0xa3, 0x8e, 0x8f, 0xa2, 0x97, 0x77, 0x6b, 0x67,
-  0x68, 0x6e, 0x77, 0x6f, 0x67, 0x64, 0x62, 0x62, 0x6d, 0x79, 0x7f, 0x81,
-  0x6e, 0x5f, 0x62, 0x68, 0x71, 0x7e, 0x86, 0x83, 0x7c, 0x69, 0x58, 0x58,
-  0x5d, 0x5e, 0x5c, 0x5f, 0x63, 0x64, 0x66, 0x68, 0x6a, 0x6b, 0x6c, 0x6c,
-  0x6e, 0x6e, 0x6e, 0x6f, 0x70, 0x6f, 0x70, 0x70, 0x6f, 0x70, 0x70, 0x6f,
-  0x6d, 0x6c, 0x6d, 0x6e, 0x70, 0x6f, 0x70, 0x6f, 0x6d, 0x67, 0x62, 0x5e,
-  0x5d, 0x5c, 0x5c, 0x5c, 0x5d, 0x5f, 0x60, 0x60, 0x63, 0x67, 0x6a, 0x6b,
-  0x6c, 0x6d, 0x6b, 0x6a, 0x69, 0x68, 0x69, 0x6b, 0x6d, 0x6e, 0x72, 0x76,
-  0x75, 0x72, 0x71, 0x70, 0x6f, 0x6f, 0x6e, 0x6e, 0x6f, 0x71, 0x75, 0x79,
-  0x7d, 0x83, 0x8a, 0x8f, 0x91, 0x92, 0x92, 0x95, 0x96, 0x96, 0x95, 0x95,
-  0x93, 0x91, 0x91, 0x8f, 0x8e, 0x8c, 0x88, 0x85, 0x83, 0x81, 0x7f, 0x7e,
-  0x7b, 0x79, 0x78, 0x77, 0x79, 0x79, 0x78, 0x77, 0x75, 0x73, 0x71, 0x6e,
-  0x6c, 0x69, 0x66, 0x65, 0x63, 0x62, 0x60, 0x5e, 0x5f, 0x5f, 0x60, 0x61,
-  0x61, 0x60, 0x61, 0x62, 0x63, 0x61, 0x60, 0x60, 0x60, 0x61, 0x63, 0x65,
-  0x64, 0x62, 0x67, 0x9a, 0xce, 0xd6, 0xd5, 0xd5, 0xd6, 0xd7, 0xd8, 0xd8,
-  0xd9, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdc, 0xdb, 0xdb, 0xdd, 0xde,
-  0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xe0, 0xe0, 0xe0, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xde, 0xdd, 0xde, 0xdf, 0xdf, 0xde, 0xdd, 0xde, 0xdd, 0xdd, 0xde, 0xdd,
-  0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdb, 0xdc,
-  0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xd9, 0xdb, 0xdc, 0xdc, 0xdb,
-  0xd9, 0xd7, 0xd6, 0xd5, 0xd3, 0xd1, 0xd0, 0xd0, 0xd0, 0xcf, 0xcb, 0xc1,
-  0xbb, 0xbd, 0xc0, 0xc4, 0xc8, 0xc5, 0xc0, 0xbe, 0xc0, 0xc2, 0xc2, 0xc2,
-  0xc2, 0xc2, 0xc2, 0xc0, 0xbd, 0xbb, 0xb8, 0xb7, 0xb5, 0xb1, 0xaf, 0xab,
-  0xa3, 0x95, 0x8a, 0x82, 0x7d, 0x87, 0x8f, 0x93, 0x95, 0x99, 0x9c, 0x9e,
-  0x9c, 0x9a, 0x96, 0x94, 0x8d, 0x7e, 0x74, 0x67, 0x68, 0x82, 0x9b, 0xa5,
-  0xa7, 0x97, 0x71, 0x60, 0x5f, 0x68, 0x72, 0x75, 0x81, 0x8b, 0x9a, 0xa6,
-  0xa6, 0x90, 0x8e, 0x9e, 0x99, 0x79, 0x6a, 0x66, 0x66, 0x6a, 0x76, 0x6f,
-  0x63, 0x5f, 0x60, 0x66, 0x72, 0x78, 0x7c, 0x81, 0x70, 0x5e, 0x62, 0x69,
-  0x71, 0x72, 0x77, 0x7b, 0x77, 0x66, 0x57, 0x59, 0x5c, 0x5c, 0x5c, 0x60,
-  0x64, 0x66, 0x67, 0x68, 0x6a, 0x6b, 0x6b, 0x6c, 0x6d, 0x6e, 0x6d, 0x6e,
-  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6b, 0x6a, 0x6b, 0x6c,
-  0x6e, 0x6f, 0x6e, 0x6c, 0x69, 0x63, 0x5f, 0x5d, 0x5c, 0x5b, 0x5c, 0x5b,
-  0x5c, 0x5e, 0x5f, 0x61, 0x65, 0x69, 0x6b, 0x6c, 0x6e, 0x6e, 0x6b, 0x6b,
-  0x6a, 0x69, 0x69, 0x6c, 0x6d, 0x6f, 0x72, 0x76, 0x74, 0x71, 0x6f, 0x6f,
-  0x6e, 0x6d, 0x6c, 0x6d, 0x6e, 0x6f, 0x72, 0x76, 0x7a, 0x80, 0x87, 0x8b,
-  0x8f, 0x91, 0x92, 0x94, 0x96, 0x95, 0x95, 0x94, 0x92, 0x91, 0x8f, 0x8e,
-  0x8c, 0x8a, 0x85, 0x82, 0x80, 0x7d, 0x7d, 0x7c, 0x79, 0x77, 0x76, 0x75,
-  0x7a, 0x79, 0x77, 0x76, 0x74, 0x73, 0x71, 0x6d, 0x6c, 0x68, 0x65, 0x63,
-  0x62, 0x60, 0x5f, 0x5e, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x63,
-  0x63, 0x62, 0x61, 0x61, 0x61, 0x61, 0x64, 0x65, 0x64, 0x61, 0x69, 0xa5,
-  0xd0, 0xd5, 0xd4, 0xd4, 0xd5, 0xd7, 0xd8, 0xd8, 0xd9, 0xda, 0xd9, 0xda,
-  0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xdf,
-  0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xdc, 0xdd, 0xdf,
-  0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd,
-  0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-  0xdb, 0xdb, 0xda, 0xd9, 0xdb, 0xdc, 0xdc, 0xda, 0xd9, 0xd8, 0xd8, 0xd7,
-  0xd5, 0xd1, 0xcf, 0xcf, 0xcf, 0xd0, 0xce, 0xc5, 0xbc, 0xba, 0xbb, 0xc1,
-  0xc7, 0xc6, 0xc1, 0xbf, 0xbe, 0xc1, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc0,
-  0xbe, 0xbb, 0xb8, 0xb6, 0xb5, 0xb2, 0xb0, 0xad, 0xa4, 0x98, 0x8f, 0x86,
-  0x7c, 0x83, 0x8c, 0x90, 0x93, 0x97, 0x9b, 0x9d, 0x9c, 0x9a, 0x97, 0x95,
-  0x8d, 0x7f, 0x74, 0x68, 0x67, 0x7c, 0x96, 0xa2, 0xa6, 0x98, 0x72, 0x60,
-  0x5f, 0x66, 0x71, 0x76, 0x7e, 0x88, 0x99, 0xa7, 0xa7, 0x92, 0x8f, 0x9c,
-  0x9a, 0x7b, 0x68, 0x64, 0x63, 0x67, 0x78, 0x72, 0x62, 0x5c, 0x5e, 0x68,
-  0x74, 0x76, 0x7a, 0x80, 0x71, 0x5e, 0x61, 0x68, 0x71, 0x6b, 0x6b, 0x71,
-  0x6f, 0x62, 0x57, 0x5a, 0x5b, 0x5c, 0x5d, 0x61, 0x65, 0x66, 0x67, 0x68,
-  0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6c,
-  0x6d, 0x6d, 0x6c, 0x6c, 0x6a, 0x6a, 0x6a, 0x6c, 0x6e, 0x6d, 0x6b, 0x6a,
-  0x67, 0x61, 0x5e, 0x5d, 0x5b, 0x5b, 0x5b, 0x5b, 0x5c, 0x5e, 0x5f, 0x62,
-  0x66, 0x6a, 0x6c, 0x6d, 0x6e, 0x6e, 0x6c, 0x6c, 0x6b, 0x69, 0x6a, 0x6c,
-  0x6d, 0x6f, 0x72, 0x76, 0x74, 0x70, 0x6f, 0x6e, 0x6c, 0x6c, 0x6c, 0x6c,
-  0x6d, 0x6e, 0x70, 0x73, 0x76, 0x7c, 0x84, 0x89, 0x8d, 0x8f, 0x91, 0x93,
-  0x94, 0x93, 0x93, 0x93, 0x90, 0x8f, 0x8d, 0x8b, 0x89, 0x88, 0x82, 0x7f,
-  0x7d, 0x7a, 0x7b, 0x7a, 0x77, 0x76, 0x75, 0x73, 0x7a, 0x79, 0x76, 0x74,
-  0x73, 0x72, 0x6f, 0x6b, 0x69, 0x68, 0x63, 0x61, 0x5e, 0x5d, 0x5d, 0x5e,
-  0x5f, 0x60, 0x60, 0x5f, 0x5f, 0x61, 0x63, 0x63, 0x64, 0x63, 0x62, 0x62,
-  0x62, 0x62, 0x64, 0x64, 0x63, 0x62, 0x6d, 0xb3, 0xd3, 0xd4, 0xd3, 0xd4,
-  0xd6, 0xd8, 0xd8, 0xd8, 0xd9, 0xdb, 0xda, 0xd9, 0xd8, 0xd8, 0xd8, 0xda,
-  0xda, 0xda, 0xdc, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xdd, 0xde, 0xde, 0xde,
-  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde,
-  0xdd, 0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdc, 0xdc, 0xdb,
-  0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-  0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda,
-  0xda, 0xda, 0xda, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd4, 0xd1, 0xce,
-  0xcd, 0xce, 0xce, 0xca, 0xc0, 0xba, 0xb8, 0xbb, 0xc3, 0xc7, 0xc6, 0xc3,
-  0xbe, 0xbd, 0xc0, 0xc0, 0xc0, 0xbf, 0xc0, 0xc0, 0xbf, 0xbd, 0xb9, 0xb6,
-  0xb6, 0xb3, 0xb1, 0xae, 0xa6, 0x9c, 0x94, 0x8b, 0x7f, 0x7d, 0x87, 0x8d,
-  0x90, 0x95, 0x9a, 0x9c, 0x9b, 0x99, 0x98, 0x97, 0x8f, 0x80, 0x76, 0x6a,
-  0x66, 0x74, 0x8f, 0x9e, 0xa5, 0x99, 0x73, 0x60, 0x5d, 0x64, 0x71, 0x77,
-  0x7a, 0x82, 0x96, 0xa7, 0xaa, 0x98, 0x91, 0x98, 0x9c, 0x7c, 0x61, 0x5c,
-  0x5c, 0x60, 0x79, 0x77, 0x61, 0x59, 0x5e, 0x6f, 0x77, 0x73, 0x73, 0x7b,
-  0x75, 0x61, 0x5d, 0x63, 0x6c, 0x65, 0x5a, 0x5d, 0x5e, 0x59, 0x55, 0x59,
-  0x5a, 0x5b, 0x5e, 0x62, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6b,
-  0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x6c, 0x6b, 0x6c, 0x6c, 0x6b, 0x69,
-  0x69, 0x69, 0x6a, 0x6c, 0x6d, 0x6c, 0x68, 0x65, 0x62, 0x5f, 0x5d, 0x5c,
-  0x5b, 0x5a, 0x5a, 0x5b, 0x5d, 0x5e, 0x60, 0x62, 0x67, 0x6b, 0x6e, 0x6f,
-  0x6f, 0x6f, 0x6e, 0x6b, 0x6a, 0x69, 0x69, 0x6b, 0x6d, 0x70, 0x73, 0x76,
-  0x74, 0x71, 0x6f, 0x6c, 0x6c, 0x6c, 0x6b, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
-  0x70, 0x74, 0x7c, 0x82, 0x86, 0x89, 0x8c, 0x8f, 0x90, 0x8f, 0x8f, 0x8e,
-  0x8c, 0x8a, 0x87, 0x85, 0x83, 0x81, 0x7c, 0x7a, 0x78, 0x77, 0x76, 0x75,
-  0x74, 0x73, 0x73, 0x71, 0x7a, 0x77, 0x75, 0x74, 0x71, 0x70, 0x6c, 0x68,
-  0x66, 0x64, 0x60, 0x5e, 0x5c, 0x5c, 0x5b, 0x5c, 0x5e, 0x5f, 0x5e, 0x5e,
-  0x5f, 0x61, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x65, 0x65, 0x64, 0x64,
-  0x62, 0x62, 0x74, 0xbe, 0xd3, 0xd1, 0xd1, 0xd4, 0xd6, 0xd7, 0xd7, 0xd7,
-  0xd8, 0xd9, 0xda, 0xd9, 0xd8, 0xd8, 0xd8, 0xda, 0xda, 0xda, 0xdc, 0xdd,
-  0xdc, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdd,
-  0xdd, 0xdd, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdc, 0xdb,
-  0xdb, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xda, 0xd9, 0xd9,
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9,
-  0xd9, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xd7, 0xd7, 0xd8,
-  0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd6, 0xd4, 0xd1, 0xcf, 0xcd, 0xcd, 0xcd,
-  0xc8, 0xc2, 0xbd, 0xb8, 0xba, 0xc3, 0xc7, 0xc7, 0xc1, 0xba, 0xba, 0xbd,
-  0xbe, 0xbd, 0xbd, 0xbd, 0xbe, 0xbe, 0xbb, 0xb6, 0xb5, 0xb3, 0xb1, 0xaf,
-  0xa9, 0xa0, 0x99, 0x92, 0x85, 0x79, 0x7f, 0x85, 0x8a, 0x90, 0x96, 0x99,
-  0x9a, 0x99, 0x98, 0x97, 0x8f, 0x85, 0x7b, 0x6e, 0x68, 0x6d, 0x86, 0x97,
-  0xa3, 0x9a, 0x76, 0x62, 0x5c, 0x60, 0x6f, 0x7c, 0x7a, 0x7e, 0x92, 0xa7,
-  0xad, 0xa0, 0x97, 0x95, 0x9f, 0x83, 0x5d, 0x53, 0x52, 0x56, 0x70, 0x74,
-  0x5e, 0x57, 0x60, 0x77, 0x82, 0x78, 0x75, 0x79, 0x79, 0x66, 0x58, 0x5a,
-  0x65, 0x5f, 0x4c, 0x45, 0x47, 0x4d, 0x54, 0x59, 0x59, 0x5b, 0x5f, 0x63,
-  0x65, 0x67, 0x67, 0x67, 0x68, 0x69, 0x69, 0x6a, 0x6a, 0x69, 0x69, 0x6a,
-  0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
-  0x6c, 0x68, 0x64, 0x61, 0x5e, 0x5c, 0x5b, 0x5b, 0x5a, 0x5a, 0x5a, 0x5b,
-  0x5e, 0x60, 0x62, 0x64, 0x68, 0x6c, 0x6f, 0x70, 0x70, 0x6f, 0x6e, 0x6b,
-  0x6a, 0x69, 0x69, 0x6c, 0x6e, 0x70, 0x73, 0x75, 0x73, 0x70, 0x6e, 0x6c,
-  0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x6a, 0x6a, 0x6a, 0x6b, 0x72, 0x77,
-  0x7c, 0x7f, 0x83, 0x85, 0x86, 0x86, 0x86, 0x85, 0x83, 0x7f, 0x7e, 0x7d,
-  0x7a, 0x79, 0x76, 0x74, 0x74, 0x73, 0x73, 0x71, 0x71, 0x71, 0x70, 0x6e,
-  0x78, 0x76, 0x74, 0x72, 0x6f, 0x6d, 0x69, 0x65, 0x63, 0x61, 0x5d, 0x5b,
-  0x59, 0x59, 0x59, 0x5a, 0x5c, 0x5c, 0x5d, 0x5d, 0x60, 0x60, 0x60, 0x61,
-  0x61, 0x62, 0x63, 0x65, 0x66, 0x66, 0x65, 0x64, 0x62, 0x67, 0x82, 0xc5,
-  0xd3, 0xd0, 0xd1, 0xd4, 0xd5, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xd9, 0xd9,
-  0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xda, 0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xdd,
-  0xde, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde,
-  0xdd, 0xdd, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdb,
-  0xdb, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd7, 0xd6, 0xd6, 0xd6, 0xd6,
-  0xd5, 0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8,
-  0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd6, 0xd5, 0xd6, 0xd7, 0xd8, 0xd8, 0xd8,
-  0xd7, 0xd6, 0xd6, 0xd5, 0xd4, 0xd1, 0xce, 0xcb, 0xcb, 0xca, 0xc7, 0xc0,
-  0xb7, 0xb9, 0xc0, 0xc4, 0xc4, 0xbd, 0xb8, 0xb9, 0xba, 0xbb, 0xbb, 0xbb,
-  0xbd, 0xbe, 0xbc, 0xb7, 0xb4, 0xb2, 0xb1, 0xaf, 0xaa, 0xa3, 0x9e, 0x98,
-  0x8e, 0x7d, 0x77, 0x79, 0x7e, 0x88, 0x92, 0x97, 0x99, 0x99, 0x99, 0x97,
-  0x90, 0x89, 0x80, 0x72, 0x6a, 0x69, 0x7e, 0x8f, 0xa0, 0x9b, 0x78, 0x63,
-  0x5c, 0x5d, 0x6a, 0x7d, 0x7d, 0x7e, 0x8a, 0xa4, 0xb1, 0xa9, 0x9e, 0x92,
-  0x9e, 0x87, 0x62, 0x53, 0x4d, 0x4c, 0x5f, 0x6d, 0x5f, 0x5a, 0x63, 0x7e,
-  0x9b, 0x92, 0x8c, 0x8c, 0x82, 0x6e, 0x59, 0x54, 0x5d, 0x5c, 0x4a, 0x3f,
-  0x3f, 0x49, 0x54, 0x58, 0x5a, 0x5c, 0x60, 0x64, 0x65, 0x66, 0x66, 0x66,
-  0x67, 0x68, 0x68, 0x68, 0x69, 0x67, 0x68, 0x69, 0x69, 0x69, 0x6a, 0x69,
-  0x6a, 0x6a, 0x69, 0x67, 0x68, 0x6b, 0x6c, 0x6d, 0x6a, 0x64, 0x61, 0x5f,
-  0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x5f, 0x61, 0x63, 0x66,
-  0x69, 0x6d, 0x6f, 0x70, 0x72, 0x72, 0x6f, 0x6c, 0x6a, 0x69, 0x69, 0x6c,
-  0x70, 0x72, 0x74, 0x75, 0x74, 0x71, 0x6f, 0x6c, 0x6a, 0x6b, 0x6b, 0x6b,
-  0x6b, 0x69, 0x66, 0x65, 0x64, 0x65, 0x69, 0x6c, 0x6f, 0x71, 0x74, 0x76,
-  0x78, 0x79, 0x79, 0x79, 0x77, 0x76, 0x76, 0x75, 0x74, 0x72, 0x71, 0x70,
-  0x6f, 0x6f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6c, 0x6a, 0x77, 0x75, 0x71, 0x70,
-  0x6e, 0x6b, 0x68, 0x64, 0x62, 0x60, 0x5b, 0x58, 0x57, 0x57, 0x58, 0x59,
-  0x5a, 0x5c, 0x5d, 0x5e, 0x61, 0x62, 0x61, 0x61, 0x61, 0x62, 0x66, 0x68,
-  0x68, 0x66, 0x65, 0x64, 0x62, 0x6b, 0x8c, 0xc8, 0xd3, 0xd1, 0xd1, 0xd3,
-  0xd4, 0xd7, 0xd8, 0xd8, 0xd7, 0xd8, 0xd8, 0xd9, 0xd9, 0xda, 0xd9, 0xd9,
-  0xda, 0xda, 0xdb, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd,
-  0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdd, 0xdd, 0xdd, 0xde,
-  0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdd, 0xde, 0xde, 0xdd, 0xdb, 0xdb, 0xda,
-  0xda, 0xda, 0xd9, 0xd8, 0xd8, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6,
-  0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6,
-  0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd4,
-  0xd4, 0xd4, 0xd1, 0xcd, 0xcb, 0xcb, 0xca, 0xc6, 0xbb, 0xb5, 0xb8, 0xbd,
-  0xc3, 0xc3, 0xba, 0xb6, 0xb6, 0xb9, 0xb9, 0xb9, 0xbc, 0xbd, 0xbc, 0xb8,
-  0xb4, 0xb2, 0xb0, 0xaf, 0xab, 0xa5, 0xa0, 0x9c, 0x93, 0x82, 0x74, 0x71,
-  0x75, 0x81, 0x8d, 0x94, 0x98, 0x99, 0x98, 0x96, 0x91, 0x8b, 0x83, 0x75,
-  0x6b, 0x68, 0x78, 0x88, 0x9c, 0x9a, 0x79, 0x65, 0x5d, 0x5b, 0x66, 0x7a,
-  0x81, 0x82, 0x87, 0xa1, 0xb4, 0xaf, 0xa2, 0x91, 0x9c, 0x89, 0x68, 0x58,
-  0x51, 0x4c, 0x5a, 0x6c, 0x65, 0x61, 0x67, 0x81, 0xa5, 0x9b, 0x95, 0x97,
-  0x8c, 0x75, 0x5d, 0x55, 0x58, 0x59, 0x4f, 0x46, 0x46, 0x4e, 0x56, 0x58,
-  0x5b, 0x5d, 0x61, 0x63, 0x64, 0x65, 0x65, 0x66, 0x67, 0x67, 0x67, 0x66,
-  0x66, 0x68, 0x68, 0x69, 0x69, 0x69, 0x6a, 0x69, 0x6a, 0x6a, 0x69, 0x68,
-  0x68, 0x6a, 0x6b, 0x6c, 0x68, 0x62, 0x5f, 0x5d, 0x5b, 0x5a, 0x5a, 0x5a,
-  0x5a, 0x5b, 0x5c, 0x5e, 0x60, 0x62, 0x64, 0x67, 0x6b, 0x6f, 0x72, 0x73,
-  0x74, 0x74, 0x6f, 0x6c, 0x6a, 0x69, 0x6a, 0x6e, 0x71, 0x73, 0x74, 0x74,
-  0x74, 0x72, 0x6f, 0x6d, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x68, 0x64, 0x61,
-  0x60, 0x60, 0x62, 0x65, 0x68, 0x6a, 0x6c, 0x6e, 0x70, 0x71, 0x71, 0x71,
-  0x70, 0x70, 0x70, 0x70, 0x6f, 0x6f, 0x6d, 0x6d, 0x6c, 0x6b, 0x6b, 0x6b,
-  0x6a, 0x6a, 0x69, 0x67, 0x76, 0x74, 0x71, 0x6f, 0x6d, 0x6a, 0x66, 0x62,
-  0x60, 0x5e, 0x5a, 0x56, 0x56, 0x56, 0x57, 0x58, 0x59, 0x5b, 0x5c, 0x5d,
-  0x61, 0x62, 0x61, 0x61, 0x62, 0x63, 0x67, 0x69, 0x69, 0x67, 0x67, 0x64,
-  0x62, 0x6d, 0x94, 0xca, 0xd4, 0xd2, 0xd1, 0xd2, 0xd4, 0xd6, 0xd8, 0xd8,
-  0xd8, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 0xdc,
-  0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xdf, 0xdf,
-  0xde, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xde, 0xdf, 0xdf, 0xe1, 0xe1,
-  0xe1, 0xdf, 0xdf, 0xe0, 0xdf, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xda, 0xd9,
-  0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5,
-  0xd5, 0xd6, 0xd5, 0xd4, 0xd4, 0xd4, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-  0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd4, 0xd5, 0xd4, 0xd5, 0xd5, 0xd3, 0xd0,
-  0xcc, 0xcb, 0xca, 0xc8, 0xc0, 0xb7, 0xb5, 0xb9, 0xc0, 0xc4, 0xbd, 0xb6,
-  0xb5, 0xb8, 0xb9, 0xb8, 0xbb, 0xbc, 0xbb, 0xb8, 0xb4, 0xb2, 0xb0, 0xaf,
-  0xac, 0xa7, 0xa2, 0x9e, 0x96, 0x87, 0x76, 0x71, 0x73, 0x7d, 0x8a, 0x92,
-  0x96, 0x98, 0x97, 0x96, 0x91, 0x8b, 0x85, 0x79, 0x6c, 0x68, 0x74, 0x83,
-  0x9a, 0x9a, 0x7b, 0x65, 0x5d, 0x5b, 0x63, 0x76, 0x82, 0x85, 0x88, 0x9f,
-  0xb3, 0xb1, 0xa3, 0x8f, 0x99, 0x8a, 0x6d, 0x5d, 0x55, 0x4f, 0x5b, 0x6e,
-  0x6b, 0x67, 0x6a, 0x80, 0xa3, 0x97, 0x8f, 0x92, 0x8f, 0x79, 0x60, 0x57,
-  0x55, 0x57, 0x51, 0x4b, 0x4c, 0x51, 0x58, 0x58, 0x5c, 0x5e, 0x60, 0x62,
-  0x63, 0x63, 0x64, 0x65, 0x66, 0x67, 0x66, 0x65, 0x65, 0x68, 0x68, 0x69,
-  0x69, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x69, 0x68, 0x68, 0x69, 0x6a, 0x6b,
-  0x66, 0x60, 0x5d, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5d, 0x60,
-  0x61, 0x63, 0x64, 0x68, 0x6d, 0x72, 0x74, 0x75, 0x76, 0x73, 0x6e, 0x6b,
-  0x6a, 0x69, 0x6a, 0x6e, 0x72, 0x73, 0x74, 0x74, 0x74, 0x72, 0x6f, 0x6d,
-  0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x67, 0x62, 0x5f, 0x5f, 0x5d, 0x5e, 0x61,
-  0x64, 0x66, 0x68, 0x69, 0x6b, 0x6c, 0x6d, 0x6d, 0x6d, 0x6c, 0x6d, 0x6d,
-  0x6d, 0x6c, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x69, 0x68, 0x68, 0x67, 0x65,
-  0x75, 0x73, 0x71, 0x6f, 0x6c, 0x68, 0x64, 0x60, 0x5e, 0x5b, 0x57, 0x53,
-  0x53, 0x53, 0x54, 0x58, 0x58, 0x5a, 0x5b, 0x5d, 0x60, 0x62, 0x62, 0x62,
-  0x63, 0x65, 0x68, 0x6a, 0x6b, 0x69, 0x68, 0x63, 0x60, 0x6f, 0x9f, 0xcc,
-  0xd2, 0xd1, 0xd1, 0xd1, 0xd3, 0xd4, 0xd7, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7,
-  0xd8, 0xd8, 0xd9, 0xd9, 0xda, 0xdb, 0xdb, 0xdc, 0xdc, 0xdd, 0xde, 0xdd,
-  0xdc, 0xdc, 0xdc, 0xdc, 0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde,
-  0xdd, 0xdd, 0xdd, 0xdd, 0xe0, 0xe1, 0xe2, 0xe2, 0xe2, 0xe0, 0xe0, 0xe1,
-  0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0xdf, 0xde, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb,
-  0xd9, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd8, 0xd6, 0xd5,
-  0xd5, 0xd5, 0xd5, 0xd6, 0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4,
-  0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd3, 0xce, 0xcc, 0xcb, 0xc9,
-  0xc6, 0xbd, 0xb7, 0xb6, 0xba, 0xc2, 0xc1, 0xba, 0xb7, 0xb6, 0xb8, 0xba,
-  0xbb, 0xbc, 0xbc, 0xb9, 0xb6, 0xb3, 0xb1, 0xb0, 0xac, 0xa8, 0xa4, 0xa1,
-  0x9a, 0x8d, 0x7d, 0x76, 0x74, 0x78, 0x86, 0x8f, 0x95, 0x96, 0x97, 0x95,
-  0x91, 0x8c, 0x87, 0x7e, 0x71, 0x69, 0x6e, 0x7b, 0x95, 0x9a, 0x7b, 0x66,
-  0x5d, 0x5a, 0x5f, 0x70, 0x82, 0x89, 0x8d, 0x9d, 0xaf, 0xad, 0xa0, 0x8a,
-  0x96, 0x8b, 0x75, 0x66, 0x5d, 0x56, 0x5d, 0x71, 0x73, 0x70, 0x6e, 0x7d,
-  0x96, 0x86, 0x7c, 0x7f, 0x8b, 0x79, 0x65, 0x5b, 0x53, 0x53, 0x51, 0x4f,
-  0x51, 0x56, 0x59, 0x58, 0x5c, 0x5e, 0x5f, 0x61, 0x62, 0x61, 0x62, 0x64,
-  0x64, 0x65, 0x65, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a,
-  0x6a, 0x6a, 0x69, 0x67, 0x67, 0x68, 0x68, 0x68, 0x63, 0x5e, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5b, 0x5e, 0x60, 0x61, 0x63, 0x65, 0x69,
-  0x70, 0x76, 0x79, 0x79, 0x78, 0x73, 0x6d, 0x6a, 0x68, 0x68, 0x6a, 0x6e,
-  0x71, 0x73, 0x73, 0x74, 0x74, 0x71, 0x6f, 0x6d, 0x6b, 0x69, 0x68, 0x68,
-  0x67, 0x64, 0x5f, 0x5c, 0x5b, 0x5a, 0x59, 0x5b, 0x5e, 0x60, 0x61, 0x62,
-  0x63, 0x65, 0x66, 0x67, 0x67, 0x67, 0x68, 0x68, 0x68, 0x67, 0x66, 0x66,
-  0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x61, 0x75, 0x73, 0x70, 0x6e,
-  0x6a, 0x66, 0x62, 0x5d, 0x5a, 0x57, 0x54, 0x50, 0x50, 0x50, 0x52, 0x56,
-  0x58, 0x5a, 0x5c, 0x5e, 0x61, 0x63, 0x63, 0x63, 0x64, 0x66, 0x6a, 0x6c,
-  0x6d, 0x6d, 0x6b, 0x65, 0x60, 0x73, 0xab, 0xce, 0xd1, 0xcf, 0xd0, 0xd1,
-  0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 0xd8,
-  0xd9, 0xda, 0xdb, 0xdc, 0xdc, 0xdd, 0xde, 0xdd, 0xdc, 0xdd, 0xdc, 0xdc,
-  0xdd, 0xdd, 0xde, 0xde, 0xdd, 0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xde, 0xde,
-  0xe0, 0xe0, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xe3, 0xe2, 0xe2, 0xe2,
-  0xe1, 0xe1, 0xe0, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xdd, 0xdd, 0xdc,
-  0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xda, 0xd9, 0xd8, 0xd9, 0xd9,
-  0xd7, 0xd8, 0xd7, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd7, 0xd6, 0xd6, 0xd5,
-  0xd5, 0xd6, 0xd4, 0xd4, 0xd2, 0xd0, 0xce, 0xcb, 0xc9, 0xc5, 0xbf, 0xbc,
-  0xb8, 0xbb, 0xc1, 0xc1, 0xbd, 0xb7, 0xb5, 0xb9, 0xba, 0xba, 0xba, 0xba,
-  0xb7, 0xb5, 0xb3, 0xb0, 0xac, 0xa9, 0xa6, 0xa4, 0x9e, 0x94, 0x87, 0x7e,
-  0x78, 0x73, 0x7e, 0x8b, 0x91, 0x94, 0x95, 0x94, 0x91, 0x8c, 0x89, 0x83,
-  0x76, 0x6a, 0x69, 0x73, 0x8e, 0x99, 0x7c, 0x67, 0x5e, 0x5a, 0x5b, 0x6a,
-  0x7d, 0x87, 0x92, 0x9d, 0xa9, 0xa7, 0x9a, 0x82, 0x8f, 0x8d, 0x7c, 0x6e,
-  0x66, 0x5c, 0x5d, 0x70, 0x79, 0x79, 0x73, 0x7c, 0x87, 0x75, 0x6d, 0x73,
-  0x7e, 0x73, 0x67, 0x5d, 0x4f, 0x4f, 0x4e, 0x51, 0x55, 0x59, 0x59, 0x58,
-  0x5c, 0x5e, 0x5f, 0x60, 0x60, 0x61, 0x61, 0x62, 0x63, 0x64, 0x64, 0x64,
-  0x64, 0x66, 0x67, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x68, 0x67,
-  0x66, 0x66, 0x66, 0x64, 0x5f, 0x5b, 0x5a, 0x59, 0x59, 0x5a, 0x59, 0x5a,
-  0x5b, 0x5c, 0x5d, 0x60, 0x64, 0x65, 0x67, 0x6d, 0x73, 0x78, 0x7b, 0x7b,
-  0x78, 0x70, 0x6b, 0x68, 0x68, 0x67, 0x69, 0x6e, 0x72, 0x73, 0x73, 0x72,
-  0x72, 0x70, 0x6e, 0x6c, 0x6a, 0x68, 0x67, 0x67, 0x65, 0x61, 0x5c, 0x58,
-  0x56, 0x55, 0x55, 0x57, 0x58, 0x59, 0x59, 0x5a, 0x5b, 0x5d, 0x5e, 0x5e,
-  0x60, 0x61, 0x60, 0x61, 0x61, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x5e, 0x5e,
-  0x5f, 0x5f, 0x5e, 0x5c, 0x72, 0x71, 0x6e, 0x6c, 0x67, 0x63, 0x5f, 0x5b,
-  0x58, 0x54, 0x4f, 0x4c, 0x4d, 0x4e, 0x52, 0x56, 0x58, 0x5b, 0x5c, 0x5f,
-  0x61, 0x62, 0x63, 0x63, 0x65, 0x67, 0x6b, 0x6e, 0x6f, 0x6f, 0x6c, 0x66,
-  0x62, 0x79, 0xb6, 0xd0, 0xd0, 0xcf, 0xd0, 0xd1, 0xd2, 0xd4, 0xd4, 0xd5,
-  0xd7, 0xd8, 0xd8, 0xd7, 0xd6, 0xd6, 0xd7, 0xd8, 0xd8, 0xd8, 0xd9, 0xdb,
-  0xdb, 0xdc, 0xdd, 0xdc, 0xdb, 0xdc, 0xdb, 0xdc, 0xdd, 0xdc, 0xdd, 0xdd,
-  0xdc, 0xdb, 0xdb, 0xdb, 0xde, 0xde, 0xde, 0xdd, 0xdd, 0xde, 0xdf, 0xe0,
-  0xe1, 0xe2, 0xe2, 0xe2, 0xe2, 0xe1, 0xe1, 0xe2, 0xe1, 0xe1, 0xe0, 0xe1,
-  0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xdd, 0xdd,
-  0xdd, 0xdc, 0xdd, 0xdc, 0xdc, 0xdb, 0xdb, 0xda, 0xd9, 0xd9, 0xd9, 0xd9,
-  0xda, 0xd8, 0xd7, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd6, 0xd5,
-  0xd4, 0xd2, 0xd1, 0xd0, 0xcc, 0xc8, 0xc6, 0xc4, 0xbd, 0xb6, 0xb9, 0xc0,
-  0xc1, 0xbc, 0xb4, 0xb4, 0xb7, 0xb8, 0xb9, 0xb9, 0xb8, 0xb5, 0xb3, 0xb1,
-  0xad, 0xa9, 0xa7, 0xa5, 0xa1, 0x98, 0x8f, 0x87, 0x80, 0x75, 0x74, 0x84,
-  0x8d, 0x90, 0x93, 0x93, 0x91, 0x8f, 0x8c, 0x85, 0x79, 0x6c, 0x67, 0x70,
-  0x88, 0x96, 0x7c, 0x67, 0x5e, 0x5a, 0x59, 0x64, 0x73, 0x7f, 0x8f, 0x9d,
-  0xa2, 0x9e, 0x8f, 0x77, 0x88, 0x8e, 0x82, 0x75, 0x6d, 0x63, 0x5c, 0x68,
-  0x72, 0x74, 0x73, 0x7b, 0x7f, 0x6e, 0x67, 0x6a, 0x72, 0x6f, 0x69, 0x5f,
-  0x4d, 0x49, 0x4b, 0x4f, 0x53, 0x59, 0x5a, 0x58, 0x5a, 0x5c, 0x5e, 0x5f,
-  0x5f, 0x60, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x65, 0x67, 0x68, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x65, 0x66, 0x65, 0x65, 0x64, 0x61,
-  0x5d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x5e, 0x5f, 0x62,
-  0x66, 0x69, 0x6b, 0x70, 0x77, 0x7a, 0x7b, 0x7a, 0x75, 0x6d, 0x68, 0x67,
-  0x66, 0x67, 0x69, 0x6d, 0x72, 0x73, 0x71, 0x6f, 0x6f, 0x6c, 0x6b, 0x6a,
-  0x67, 0x65, 0x65, 0x64, 0x62, 0x5e, 0x58, 0x54, 0x53, 0x52, 0x53, 0x54,
-  0x55, 0x55, 0x54, 0x54, 0x56, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x5a, 0x5a,
-  0x5a, 0x5a, 0x5b, 0x5b, 0x5a, 0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x58, 0x56,
-  0x70, 0x6f, 0x6c, 0x6a, 0x66, 0x61, 0x5d, 0x59, 0x57, 0x53, 0x4d, 0x4b,
-  0x4c, 0x4e, 0x51, 0x56, 0x59, 0x5b, 0x5d, 0x5f, 0x61, 0x62, 0x63, 0x64,
-  0x66, 0x69, 0x6c, 0x70, 0x71, 0x70, 0x6c, 0x67, 0x65, 0x7e, 0xbc, 0xd1,
-  0xcf, 0xcf, 0xcf, 0xd0, 0xd3, 0xd3, 0xd4, 0xd5, 0xd7, 0xd7, 0xd7, 0xd6,
-  0xd6, 0xd5, 0xd5, 0xd8, 0xd8, 0xd8, 0xd8, 0xd9, 0xd9, 0xdb, 0xdc, 0xdb,
-  0xda, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb,
-  0xde, 0xde, 0xde, 0xdc, 0xdc, 0xdd, 0xde, 0xdf, 0xdf, 0xe0, 0xe0, 0xe1,
-  0xe0, 0xe0, 0xe0, 0xe1, 0xe1, 0xe0, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xe0,
-  0xe0, 0xde, 0xdf, 0xde, 0xdd, 0xdc, 0xdc, 0xdd, 0xdd, 0xdb, 0xdb, 0xdb,
-  0xdb, 0xda, 0xda, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xda, 0xd9, 0xd8, 0xd8,
-  0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd4, 0xd3, 0xd3,
-  0xd2, 0xcd, 0xca, 0xc9, 0xc4, 0xba, 0xb4, 0xb8, 0xbc, 0xbf, 0xb7, 0xb1,
-  0xb4, 0xb6, 0xb8, 0xb9, 0xb8, 0xb6, 0xb4, 0xb1, 0xae, 0xaa, 0xa8, 0xa6,
-  0xa3, 0x9c, 0x94, 0x8e, 0x87, 0x79, 0x70, 0x7e, 0x89, 0x8d, 0x90, 0x92,
-  0x91, 0x8f, 0x8c, 0x86, 0x7a, 0x6e, 0x69, 0x6f, 0x85, 0x93, 0x7b, 0x66,
-  0x5e, 0x59, 0x59, 0x61, 0x6d, 0x78, 0x89, 0x9a, 0x9d, 0x95, 0x86, 0x6f,
-  0x83, 0x8f, 0x85, 0x78, 0x70, 0x65, 0x5b, 0x5e, 0x66, 0x6a, 0x6f, 0x78,
-  0x7a, 0x6d, 0x67, 0x66, 0x6c, 0x70, 0x6b, 0x61, 0x4d, 0x4a, 0x4b, 0x4e,
-  0x52, 0x59, 0x5b, 0x59, 0x5a, 0x5b, 0x5d, 0x5e, 0x5e, 0x5f, 0x60, 0x61,
-  0x62, 0x63, 0x64, 0x64, 0x65, 0x67, 0x67, 0x66, 0x65, 0x65, 0x66, 0x65,
-  0x66, 0x66, 0x64, 0x65, 0x63, 0x62, 0x61, 0x5e, 0x5b, 0x59, 0x5a, 0x5a,
-  0x5a, 0x5a, 0x59, 0x5b, 0x5e, 0x5f, 0x60, 0x64, 0x68, 0x6b, 0x6f, 0x74,
-  0x7a, 0x7b, 0x7c, 0x79, 0x73, 0x6c, 0x68, 0x67, 0x66, 0x67, 0x69, 0x6c,
-  0x71, 0x72, 0x70, 0x6d, 0x6d, 0x6b, 0x6a, 0x68, 0x65, 0x63, 0x63, 0x61,
-  0x5f, 0x5b, 0x55, 0x52, 0x51, 0x51, 0x51, 0x52, 0x51, 0x51, 0x51, 0x52,
-  0x53, 0x54, 0x55, 0x54, 0x55, 0x56, 0x56, 0x56, 0x57, 0x56, 0x57, 0x57,
-  0x56, 0x57, 0x55, 0x56, 0x56, 0x56, 0x54, 0x53, 0x6f, 0x6d, 0x6a, 0x68,
-  0x64, 0x5f, 0x5b, 0x58, 0x56, 0x51, 0x4c, 0x49, 0x4a, 0x4d, 0x51, 0x55,
-  0x59, 0x5b, 0x5c, 0x5f, 0x61, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6d, 0x71,
-  0x72, 0x71, 0x6d, 0x68, 0x69, 0x82, 0xbe, 0xd1, 0xcf, 0xce, 0xcf, 0xd0,
-  0xd2, 0xd2, 0xd4, 0xd5, 0xd6, 0xd7, 0xd7, 0xd6, 0xd6, 0xd5, 0xd6, 0xd7,
-  0xd7, 0xd8, 0xd8, 0xd8, 0xd9, 0xda, 0xda, 0xdb, 0xda, 0xdb, 0xdb, 0xdb,
-  0xdc, 0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdc,
-  0xdc, 0xdd, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0xe0, 0xe0, 0xdf, 0xdf, 0xe0,
-  0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdc, 0xdd, 0xdd,
-  0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xd9, 0xda, 0xd9, 0xd9, 0xd8, 0xd8,
-  0xd9, 0xd9, 0xd9, 0xda, 0xda, 0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9,
-  0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd5, 0xd4, 0xd5, 0xd4, 0xd0, 0xcd, 0xcb,
-  0xc8, 0xbf, 0xb6, 0xb4, 0xb8, 0xbe, 0xbb, 0xb1, 0xb1, 0xb3, 0xb7, 0xb9,
-  0xb8, 0xb6, 0xb4, 0xb2, 0xae, 0xab, 0xa9, 0xa8, 0xa4, 0x9e, 0x96, 0x90,
-  0x8a, 0x7d, 0x6f, 0x7b, 0x86, 0x8b, 0x8f, 0x92, 0x91, 0x8f, 0x8c, 0x86,
-  0x7b, 0x6e, 0x69, 0x6f, 0x82, 0x91, 0x7a, 0x67, 0x5e, 0x5a, 0x59, 0x5f,
-  0x6a, 0x73, 0x84, 0x94, 0x98, 0x90, 0x81, 0x6d, 0x81, 0x8f, 0x85, 0x78,
-  0x70, 0x66, 0x5a, 0x58, 0x5d, 0x62, 0x6a, 0x75, 0x76, 0x6c, 0x66, 0x64,
-  0x6a, 0x70, 0x6c, 0x61, 0x4d, 0x4a, 0x4d, 0x4d, 0x51, 0x57, 0x5b, 0x5a,
-  0x5a, 0x5a, 0x5c, 0x5e, 0x5e, 0x5f, 0x5f, 0x61, 0x62, 0x63, 0x64, 0x64,
-  0x65, 0x67, 0x67, 0x65, 0x65, 0x65, 0x66, 0x65, 0x65, 0x65, 0x64, 0x63,
-  0x62, 0x61, 0x5f, 0x5d, 0x5a, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5c,
-  0x5f, 0x60, 0x62, 0x66, 0x6a, 0x6e, 0x71, 0x76, 0x7b, 0x7b, 0x7b, 0x78,
-  0x71, 0x6a, 0x67, 0x66, 0x66, 0x67, 0x69, 0x6c, 0x70, 0x71, 0x6e, 0x6c,
-  0x6c, 0x6a, 0x69, 0x67, 0x64, 0x61, 0x61, 0x5f, 0x5d, 0x59, 0x54, 0x51,
-  0x50, 0x50, 0x50, 0x51, 0x50, 0x50, 0x50, 0x50, 0x51, 0x53, 0x53, 0x53,
-  0x53, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x53, 0x54,
-  0x54, 0x54, 0x52, 0x51, 0x6f, 0x6b, 0x68, 0x65, 0x61, 0x5d, 0x59, 0x56,
-  0x54, 0x4f, 0x4a, 0x47, 0x49, 0x4b, 0x50, 0x54, 0x58, 0x5a, 0x5b, 0x5d,
-  0x62, 0x64, 0x65, 0x65, 0x66, 0x68, 0x6d, 0x71, 0x73, 0x73, 0x6f, 0x6b,
-  0x6f, 0x88, 0xc1, 0xd0, 0xce, 0xce, 0xce, 0xd0, 0xd2, 0xd2, 0xd4, 0xd5,
-  0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6, 0xd7, 0xd7, 0xd8, 0xd9,
-  0xd8, 0xd9, 0xd9, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb,
-  0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdb, 0xdc, 0xdd, 0xdd, 0xdd,
-  0xdc, 0xdd, 0xdd, 0xdf, 0xdf, 0xde, 0xde, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-  0xdd, 0xdc, 0xdb, 0xdc, 0xda, 0xda, 0xda, 0xda, 0xd8, 0xd9, 0xd9, 0xda,
-  0xda, 0xda, 0xd8, 0xd8, 0xd7, 0xd7, 0xd6, 0xd7, 0xd7, 0xd7, 0xd7, 0xd9,
-  0xd9, 0xd7, 0xd7, 0xd7, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd5, 0xd6,
-  0xd6, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd1, 0xd0, 0xcd, 0xc7, 0xbe, 0xb7,
-  0xb5, 0xb9, 0xbc, 0xb4, 0xae, 0xae, 0xb2, 0xb7, 0xb8, 0xb6, 0xb4, 0xb3,
-  0xaf, 0xac, 0xab, 0xaa, 0xa6, 0xa0, 0x98, 0x93, 0x8e, 0x82, 0x71, 0x75,
-  0x80, 0x86, 0x8c, 0x90, 0x90, 0x8e, 0x8b, 0x86, 0x7d, 0x70, 0x6a, 0x6e,
-  0x7e, 0x8d, 0x78, 0x66, 0x5f, 0x5a, 0x59, 0x5c, 0x65, 0x6e, 0x7a, 0x8a,
-  0x8f, 0x89, 0x7c, 0x6b, 0x7c, 0x8b, 0x84, 0x78, 0x70, 0x66, 0x59, 0x52,
-  0x52, 0x56, 0x62, 0x72, 0x71, 0x67, 0x62, 0x60, 0x67, 0x6d, 0x6a, 0x5f,
-  0x4d, 0x4c, 0x4f, 0x4e, 0x4f, 0x56, 0x5a, 0x5b, 0x5a, 0x5a, 0x5c, 0x5e,
-  0x5f, 0x5e, 0x5f, 0x60, 0x61, 0x63, 0x63, 0x64, 0x65, 0x66, 0x66, 0x65,
-  0x64, 0x65, 0x65, 0x64, 0x64, 0x64, 0x63, 0x62, 0x61, 0x5f, 0x5e, 0x5c,
-  0x5a, 0x59, 0x58, 0x59, 0x59, 0x59, 0x5a, 0x5d, 0x60, 0x61, 0x64, 0x68,
-  0x6d, 0x71, 0x75, 0x78, 0x7b, 0x79, 0x76, 0x74, 0x6f, 0x69, 0x66, 0x66,
-  0x66, 0x67, 0x68, 0x6b, 0x6e, 0x6e, 0x6c, 0x6a, 0x69, 0x68, 0x67, 0x63,
-  0x60, 0x5e, 0x5d, 0x5c, 0x5a, 0x56, 0x51, 0x4e, 0x4e, 0x4e, 0x4f, 0x4e,
-  0x4e, 0x4e, 0x4e, 0x4f, 0x50, 0x51, 0x51, 0x50, 0x51, 0x52, 0x52, 0x53,
-  0x53, 0x53, 0x53, 0x53, 0x52, 0x52, 0x51, 0x52, 0x51, 0x51, 0x50, 0x4f,
-  0x6b, 0x66, 0x63, 0x61, 0x5e, 0x5a, 0x56, 0x52, 0x4f, 0x4c, 0x47, 0x45,
-  0x47, 0x4a, 0x4e, 0x52, 0x57, 0x5a, 0x5c, 0x5e, 0x62, 0x64, 0x66, 0x66,
-  0x67, 0x69, 0x6e, 0x73, 0x76, 0x76, 0x72, 0x6e, 0x76, 0x90, 0xc3, 0xd0,
-  0xcf, 0xce, 0xce, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd4, 0xd3, 0xd4, 0xd4,
-  0xd4, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd7, 0xd8, 0xd7, 0xd8, 0xd9,
-  0xd9, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xda, 0xdc, 0xdc, 0xdb, 0xdb,
-  0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xda, 0xdb, 0xdc,
-  0xdc, 0xdb, 0xdc, 0xda, 0xda, 0xda, 0xdb, 0xda, 0xda, 0xdc, 0xdc, 0xdb,
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9,
-  0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8, 0xd8,
-  0xd7, 0xd6, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5,
-  0xd5, 0xd5, 0xd5, 0xd4, 0xd3, 0xd1, 0xcc, 0xc4, 0xbe, 0xb7, 0xb9, 0xb9,
-  0xb3, 0xaf, 0xad, 0xb3, 0xb6, 0xb6, 0xb5, 0xb3, 0xb0, 0xad, 0xac, 0xab,
-  0xa7, 0xa1, 0x9b, 0x96, 0x93, 0x89, 0x76, 0x6d, 0x78, 0x81, 0x87, 0x8d,
-  0x8f, 0x8e, 0x8c, 0x87, 0x7e, 0x73, 0x6c, 0x6e, 0x7b, 0x88, 0x75, 0x66,
-  0x5f, 0x5b, 0x59, 0x5a, 0x61, 0x68, 0x71, 0x7d, 0x86, 0x84, 0x7a, 0x67,
-  0x6f, 0x87, 0x84, 0x79, 0x72, 0x69, 0x58, 0x4f, 0x4b, 0x4e, 0x5b, 0x6c,
-  0x6a, 0x62, 0x5d, 0x59, 0x5e, 0x68, 0x69, 0x61, 0x4f, 0x4c, 0x4e, 0x4d,
-  0x4f, 0x55, 0x5b, 0x5c, 0x59, 0x59, 0x5b, 0x5d, 0x5f, 0x5f, 0x5f, 0x5f,
-  0x61, 0x62, 0x62, 0x63, 0x63, 0x65, 0x65, 0x64, 0x63, 0x64, 0x64, 0x62,
-  0x63, 0x62, 0x61, 0x60, 0x5f, 0x5d, 0x5c, 0x5b, 0x58, 0x57, 0x58, 0x58,
-  0x59, 0x5a, 0x5b, 0x5f, 0x62, 0x64, 0x65, 0x6a, 0x70, 0x76, 0x79, 0x7a,
-  0x7a, 0x76, 0x71, 0x6e, 0x6a, 0x67, 0x64, 0x65, 0x65, 0x66, 0x68, 0x6a,
-  0x6a, 0x6a, 0x68, 0x66, 0x64, 0x63, 0x61, 0x5e, 0x5b, 0x5a, 0x58, 0x57,
-  0x56, 0x53, 0x4f, 0x4d, 0x4d, 0x4e, 0x4e, 0x4d, 0x4e, 0x4e, 0x4e, 0x4f,
-  0x4f, 0x50, 0x50, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x51, 0x50, 0x50, 0x4f,
-  0x4f, 0x4f, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0x4c, 0x67, 0x63, 0x61, 0x5f,
-  0x5b, 0x57, 0x53, 0x4f, 0x4d, 0x49, 0x47, 0x46, 0x47, 0x49, 0x4c, 0x52,
-  0x58, 0x5a, 0x5c, 0x5e, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6b, 0x70, 0x76,
-  0x78, 0x78, 0x74, 0x71, 0x80, 0x98, 0xc4, 0xcf, 0xce, 0xce, 0xce, 0xcf,
-  0xd0, 0xd1, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd4,
-  0xd4, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd8, 0xd9, 0xda, 0xda, 0xda, 0xd9,
-  0xd9, 0xd9, 0xdb, 0xdc, 0xdb, 0xda, 0xdb, 0xda, 0xdb, 0xda, 0xda, 0xdb,
-  0xda, 0xda, 0xda, 0xdb, 0xdb, 0xda, 0xdb, 0xda, 0xda, 0xd9, 0xdb, 0xdb,
-  0xda, 0xda, 0xda, 0xd9, 0xd9, 0xda, 0xdb, 0xdc, 0xda, 0xda, 0xdb, 0xdb,
-  0xda, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb,
-  0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xda, 0xd9, 0xd8,
-  0xd7, 0xd8, 0xd6, 0xd5, 0xd4, 0xd5, 0xd4, 0xd4, 0xd5, 0xd4, 0xd4, 0xd4,
-  0xd4, 0xd4, 0xd3, 0xd0, 0xcb, 0xc3, 0xbd, 0xbc, 0xba, 0xb5, 0xad, 0xac,
-  0xb3, 0xb6, 0xb6, 0xb4, 0xb1, 0xaf, 0xae, 0xac, 0xa7, 0xa2, 0x9c, 0x99,
-  0x96, 0x8e, 0x7f, 0x6c, 0x71, 0x78, 0x84, 0x8a, 0x8c, 0x8d, 0x8b, 0x86,
-  0x80, 0x75, 0x6d, 0x6e, 0x77, 0x83, 0x73, 0x65, 0x5f, 0x5c, 0x59, 0x59,
-  0x5d, 0x63, 0x6c, 0x76, 0x7f, 0x83, 0x7b, 0x64, 0x5a, 0x7d, 0x83, 0x7a,
-  0x74, 0x6b, 0x5b, 0x50, 0x4c, 0x4e, 0x59, 0x68, 0x66, 0x61, 0x5d, 0x57,
-  0x59, 0x64, 0x6a, 0x66, 0x56, 0x4d, 0x4f, 0x4e, 0x4e, 0x53, 0x59, 0x5c,
-  0x59, 0x58, 0x5a, 0x5c, 0x5e, 0x5e, 0x5e, 0x5e, 0x60, 0x60, 0x62, 0x62,
-  0x63, 0x64, 0x64, 0x64, 0x64, 0x63, 0x62, 0x62, 0x61, 0x61, 0x60, 0x5e,
-  0x5d, 0x5b, 0x5a, 0x58, 0x57, 0x57, 0x58, 0x58, 0x59, 0x5a, 0x5c, 0x60,
-  0x63, 0x65, 0x67, 0x6d, 0x74, 0x78, 0x7a, 0x7b, 0x78, 0x73, 0x6d, 0x6a,
-  0x68, 0x65, 0x63, 0x64, 0x64, 0x65, 0x66, 0x67, 0x67, 0x65, 0x64, 0x62,
-  0x5f, 0x5d, 0x5c, 0x5a, 0x56, 0x55, 0x54, 0x54, 0x53, 0x51, 0x4e, 0x4d,
-  0x4c, 0x4d, 0x4d, 0x4c, 0x4c, 0x4d, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x50,
-  0x50, 0x4f, 0x4f, 0x4f, 0x4f, 0x4e, 0x4e, 0x4c, 0x4c, 0x4c, 0x4b, 0x4b,
-  0x4a, 0x49, 0x48, 0x4a, 0x64, 0x61, 0x5f, 0x5c, 0x58, 0x55, 0x52, 0x4e,
-  0x4c, 0x49, 0x47, 0x45, 0x45, 0x47, 0x4c, 0x51, 0x59, 0x5b, 0x5d, 0x5f,
-  0x62, 0x65, 0x68, 0x69, 0x6a, 0x6e, 0x73, 0x79, 0x7b, 0x7a, 0x74, 0x73,
-  0x88, 0xa1, 0xc6, 0xcf, 0xcd, 0xcd, 0xcd, 0xce, 0xcf, 0xd2, 0xd3, 0xd3,
-  0xd3, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd3, 0xd5, 0xd5, 0xd5, 0xd5, 0xd6,
-  0xd6, 0xd7, 0xd7, 0xd7, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd8, 0xdb, 0xdc,
-  0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xda, 0xdb, 0xdb,
-  0xdb, 0xdb, 0xda, 0xdb, 0xdb, 0xda, 0xda, 0xdb, 0xdb, 0xda, 0xda, 0xda,
-  0xda, 0xdc, 0xdd, 0xdd, 0xdc, 0xdc, 0xdd, 0xdd, 0xdc, 0xdc, 0xdd, 0xdd,
-  0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc,
-  0xdc, 0xdd, 0xdc, 0xdb, 0xdb, 0xdc, 0xdb, 0xda, 0xd9, 0xd9, 0xd9, 0xd6,
-  0xd6, 0xd5, 0xd5, 0xd4, 0xd5, 0xd5, 0xd4, 0xd4, 0xd4, 0xd5, 0xd4, 0xd3,
-  0xd2, 0xce, 0xc7, 0xc2, 0xc0, 0xbc, 0xb2, 0xab, 0xb0, 0xb5, 0xb6, 0xb4,
-  0xb2, 0xb0, 0xae, 0xac, 0xa8, 0xa3, 0x9e, 0x9b, 0x98, 0x91, 0x83, 0x70,
-  0x6a, 0x70, 0x7f, 0x88, 0x8b, 0x8b, 0x8a, 0x87, 0x81, 0x76, 0x6e, 0x6e,
-  0x75, 0x7f, 0x71, 0x65, 0x5f, 0x5c, 0x59, 0x58, 0x5b, 0x60, 0x69, 0x73,
-  0x7d, 0x83, 0x7d, 0x64, 0x4b, 0x72, 0x80, 0x79, 0x74, 0x6e, 0x5f, 0x54,
-  0x4f, 0x50, 0x59, 0x66, 0x65, 0x62, 0x5e, 0x55, 0x54, 0x5f, 0x6b, 0x6a,
-  0x5c, 0x51, 0x51, 0x50, 0x4e, 0x4f, 0x57, 0x5b, 0x58, 0x57, 0x5a, 0x5b,
-  0x5c, 0x5c, 0x5c, 0x5c, 0x5e, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x62, 0x63,
-  0x64, 0x63, 0x61, 0x60, 0x60, 0x60, 0x5f, 0x5d, 0x5c, 0x5b, 0x5a, 0x58,
-  0x57, 0x57, 0x58, 0x58, 0x59, 0x5b, 0x5f, 0x62, 0x65, 0x67, 0x69, 0x6f,
-  0x76, 0x78, 0x78, 0x77, 0x75, 0x70, 0x6b, 0x69, 0x65, 0x63, 0x62, 0x63,
-  0x63, 0x63, 0x63, 0x63, 0x63, 0x61, 0x60, 0x5e, 0x5b, 0x59, 0x58, 0x55,
-  0x53, 0x51, 0x51, 0x51, 0x51, 0x4f, 0x4d, 0x4c, 0x4c, 0x4c, 0x4b, 0x4b,
-  0x4c, 0x4d, 0x4f, 0x4f, 0x50, 0x51, 0x51, 0x50, 0x51, 0x4f, 0x4f, 0x4e,
-  0x4d, 0x4c, 0x4c, 0x4b, 0x4a, 0x4a, 0x4a, 0x49, 0x47, 0x47, 0x47, 0x48,
-  0x62, 0x5f, 0x5d, 0x5b, 0x57, 0x54, 0x50, 0x4d, 0x4b, 0x48, 0x46, 0x44,
-  0x44, 0x46, 0x4b, 0x52, 0x59, 0x5c, 0x5d, 0x5f, 0x63, 0x65, 0x68, 0x6a,
-  0x6b, 0x6e, 0x74, 0x7a, 0x7c, 0x7b, 0x74, 0x73, 0x8d, 0xa6, 0xc7, 0xcf,
-  0xcd, 0xcc, 0xcd, 0xcd, 0xcf, 0xd1, 0xd2, 0xd2, 0xd2, 0xd4, 0xd4, 0xd3,
-  0xd3, 0xd4, 0xd3, 0xd4, 0xd4, 0xd3, 0xd4, 0xd5, 0xd5, 0xd6, 0xd6, 0xd6,
-  0xd8, 0xd8, 0xd8, 0xd9, 0xd8, 0xd8, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-  0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc,
-  0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdd, 0xde, 0xde,
-  0xde, 0xde, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xde, 0xde, 0xde, 0xdd, 0xdd,
-  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdc,
-  0xdb, 0xdc, 0xdb, 0xdb, 0xda, 0xda, 0xda, 0xd7, 0xd7, 0xd6, 0xd5, 0xd4,
-  0xd5, 0xd5, 0xd5, 0xd5, 0xd4, 0xd5, 0xd4, 0xd3, 0xd3, 0xd2, 0xcd, 0xc7,
-  0xc4, 0xc1, 0xb8, 0xac, 0xae, 0xb2, 0xb4, 0xb4, 0xb2, 0xb0, 0xae, 0xac,
-  0xa9, 0xa5, 0x9f, 0x9c, 0x99, 0x93, 0x85, 0x74, 0x68, 0x6a, 0x7b, 0x86,
-  0x8a, 0x8a, 0x89, 0x86, 0x81, 0x77, 0x6f, 0x6e, 0x74, 0x7c, 0x70, 0x64,
-  0x5f, 0x5d, 0x59, 0x58, 0x5b, 0x5e, 0x67, 0x72, 0x7b, 0x84, 0x7f, 0x65,
-  0x45, 0x65, 0x7b, 0x78, 0x74, 0x6f, 0x61, 0x56, 0x51, 0x51, 0x58, 0x65,
-  0x64, 0x61, 0x5d, 0x55, 0x51, 0x5b, 0x69, 0x6a, 0x5f, 0x54, 0x52, 0x50,
-  0x4e, 0x4e, 0x56, 0x5b, 0x57, 0x56, 0x59, 0x5a, 0x5c, 0x5b, 0x5b, 0x5c,
-  0x5d, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x61, 0x62, 0x63, 0x62, 0x61, 0x60,
-  0x60, 0x5f, 0x5e, 0x5c, 0x5b, 0x5b, 0x5a, 0x58, 0x57, 0x57, 0x57, 0x58,
-  0x59, 0x5c, 0x60, 0x63, 0x66, 0x68, 0x6a, 0x70, 0x76, 0x77, 0x77, 0x75,
-  0x71, 0x6d, 0x6a, 0x67, 0x64, 0x61, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61,
-  0x60, 0x5f, 0x5c, 0x5b, 0x58, 0x57, 0x56, 0x53, 0x51, 0x50, 0x50, 0x50,
-  0x50, 0x4e, 0x4c, 0x4b, 0x4b, 0x4c, 0x4b, 0x4b, 0x4d, 0x4d, 0x4f, 0x4f,
-  0x50, 0x51, 0x51, 0x50, 0x51, 0x4f, 0x4e, 0x4d, 0x4b, 0x4a, 0x4b, 0x49,
-  0x49, 0x48, 0x49, 0x48, 0x46, 0x45, 0x45, 0x46, 0x60, 0x5d, 0x5b, 0x59,
-  0x56, 0x52, 0x4e, 0x4c, 0x49, 0x47, 0x45, 0x42, 0x42, 0x45, 0x4a, 0x51,
-  0x59, 0x5d, 0x5e, 0x60, 0x63, 0x66, 0x69, 0x6b, 0x6c, 0x6f, 0x75, 0x7b,
-  0x7d, 0x7c, 0x75, 0x73, 0x93, 0xac, 0xc8, 0xcf, 0xcd, 0xcd, 0xcd, 0xce,
-  0xcf, 0xd1, 0xd1, 0xd1, 0xd1, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd2, 0xd3,
-  0xd3, 0xd2, 0xd3, 0xd4, 0xd5, 0xd5, 0xd6, 0xd6, 0xd7, 0xd7, 0xd7, 0xd7,
-  0xd8, 0xd9, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xda, 0xdb, 0xdb, 0xdb, 0xdb,
-  0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc,
-  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xdf, 0xde, 0xe0, 0xdf, 0xde, 0xde,
-  0xdd, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-  0xdd, 0xdd, 0xdd, 0xde, 0xdd, 0xde, 0xdd, 0xdc, 0xdb, 0xdc, 0xdd, 0xdc,
-  0xdc, 0xdc, 0xdb, 0xd9, 0xd8, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd5, 0xd5,
-  0xd5, 0xd5, 0xd4, 0xd4, 0xd3, 0xd3, 0xd1, 0xcd, 0xca, 0xc8, 0xc2, 0xb5,
-  0xab, 0xad, 0xb0, 0xb2, 0xb1, 0xb0, 0xae, 0xad, 0xa9, 0xa5, 0xa1, 0x9e,
-  0x9b, 0x95, 0x8a, 0x79, 0x6a, 0x68, 0x75, 0x81, 0x86, 0x87, 0x87, 0x85,
-  0x80, 0x77, 0x70, 0x6f, 0x72, 0x79, 0x6f, 0x64, 0x60, 0x5c, 0x59, 0x58,
-  0x59, 0x5d, 0x64, 0x6e, 0x79, 0x83, 0x81, 0x6a, 0x42, 0x50, 0x6f, 0x75,
-  0x74, 0x6f, 0x63, 0x59, 0x54, 0x53, 0x57, 0x63, 0x62, 0x5f, 0x5b, 0x54,
-  0x4f, 0x55, 0x61, 0x65, 0x62, 0x58, 0x52, 0x4f, 0x4d, 0x4c, 0x55, 0x5b,
-  0x57, 0x56, 0x58, 0x59, 0x5a, 0x5b, 0x5b, 0x5c, 0x5d, 0x5f, 0x60, 0x60,
-  0x5e, 0x5e, 0x5f, 0x61, 0x62, 0x61, 0x5f, 0x5f, 0x5f, 0x5e, 0x5d, 0x5c,
-  0x5a, 0x5a, 0x59, 0x58, 0x57, 0x57, 0x58, 0x59, 0x59, 0x5d, 0x61, 0x64,
-  0x67, 0x69, 0x6c, 0x72, 0x74, 0x74, 0x73, 0x71, 0x6e, 0x69, 0x66, 0x65,
-  0x62, 0x60, 0x5f, 0x60, 0x60, 0x60, 0x5e, 0x5d, 0x5c, 0x5a, 0x59, 0x57,
-  0x55, 0x52, 0x51, 0x50, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4d, 0x4b, 0x4a,
-  0x4a, 0x4b, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x4f, 0x51, 0x51, 0x50, 0x50,
-  0x50, 0x4d, 0x4c, 0x4b, 0x4a, 0x49, 0x48, 0x48, 0x47, 0x46, 0x46, 0x46,
-  0x45, 0x44, 0x44, 0x45, 0x5f, 0x5c, 0x58, 0x56, 0x52, 0x50, 0x4d, 0x4a,
-  0x47, 0x45, 0x42, 0x42, 0x41, 0x43, 0x49, 0x51, 0x58, 0x5d, 0x5f, 0x61,
-  0x64, 0x69, 0x6b, 0x6c, 0x6e, 0x71, 0x77, 0x7c, 0x7e, 0x7d, 0x75, 0x75,
-  0x9d, 0xb7, 0xca, 0xce, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xd1, 0xd1, 0xd1,
-  0xd1, 0xd3, 0xd3, 0xd3, 0xd3, 0xd1, 0xd1, 0xd3, 0xd3, 0xd2, 0xd3, 0xd2,
-  0xd3, 0xd5, 0xd5, 0xd4, 0xd6, 0xd7, 0xd7, 0xd7, 0xd8, 0xd8, 0xd9, 0xd8,
-  0xd8, 0xd9, 0xda, 0xdb, 0xda, 0xda, 0xda, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
-  0xdb, 0xdb, 0xdb, 0xdc, 0xdd, 0xdd, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xde,
-  0xde, 0xdf, 0xdf, 0xdf, 0xe0, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xe0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xde, 0xde, 0xdf, 0xde, 0xde, 0xde, 0xde, 0xdf,
-  0xdf, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdd, 0xdb,
-  0xd9, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd6, 0xd5, 0xd6, 0xd6, 0xd5, 0xd5,
-  0xd5, 0xd3, 0xd2, 0xd1, 0xce, 0xcd, 0xca, 0xc1, 0xb2, 0xaa, 0xaa, 0xae,
-  0xb0, 0xaf, 0xae, 0xac, 0xa9, 0xa5, 0xa1, 0x9f, 0x9c, 0x97, 0x8f, 0x81,
-  0x71, 0x6a, 0x6d, 0x7a, 0x82, 0x85, 0x84, 0x83, 0x7c, 0x75, 0x71, 0x6f,
-  0x71, 0x75, 0x6d, 0x63, 0x5e, 0x5d, 0x5a, 0x59, 0x59, 0x5b, 0x62, 0x6c,
-  0x77, 0x81, 0x80, 0x6c, 0x42, 0x3b, 0x59, 0x6d, 0x72, 0x6f, 0x66, 0x5e,
-  0x58, 0x56, 0x57, 0x62, 0x61, 0x5c, 0x58, 0x52, 0x4c, 0x4e, 0x56, 0x5c,
-  0x62, 0x5b, 0x53, 0x4e, 0x4c, 0x4c, 0x54, 0x5a, 0x57, 0x56, 0x58, 0x57,
-  0x57, 0x59, 0x59, 0x5c, 0x5e, 0x5f, 0x5f, 0x5f, 0x5e, 0x5e, 0x5f, 0x60,
-  0x60, 0x5f, 0x5e, 0x5e, 0x5d, 0x5d, 0x5c, 0x5a, 0x59, 0x58, 0x58, 0x58,
-  0x58, 0x58, 0x59, 0x5a, 0x5b, 0x5f, 0x62, 0x66, 0x68, 0x69, 0x6d, 0x72,
-  0x71, 0x70, 0x6e, 0x6c, 0x68, 0x64, 0x61, 0x60, 0x5f, 0x5f, 0x5d, 0x5c,
-  0x5c, 0x5c, 0x5a, 0x57, 0x56, 0x55, 0x54, 0x52, 0x4f, 0x4e, 0x4e, 0x4d,
-  0x4d, 0x4f, 0x50, 0x50, 0x4e, 0x4c, 0x4a, 0x49, 0x49, 0x4a, 0x4b, 0x4c,
-  0x4e, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x51, 0x50, 0x4e, 0x4c, 0x4a, 0x4a,
-  0x49, 0x47, 0x46, 0x46, 0x46, 0x46, 0x44, 0x43, 0x43, 0x42, 0x42, 0x42,
-  0x5d, 0x59, 0x56, 0x54, 0x50, 0x4e, 0x4b, 0x47, 0x45, 0x43, 0x41, 0x41,
-  0x41, 0x42, 0x49, 0x51, 0x59, 0x5e, 0x60, 0x63, 0x66, 0x6a, 0x6d, 0x6e,
-  0x71, 0x75, 0x7b, 0x7e, 0x7f, 0x7e, 0x76, 0x78, 0xa7, 0xc0, 0xcc, 0xce,
-  0xcf, 0xce, 0xce, 0xcd, 0xce, 0xcf, 0xcf, 0xcf, 0xcf, 0xd1, 0xd1, 0xd2,
-  0xd2, 0xd1, 0xd0, 0xd1, 0xd2, 0xd2, 0xd3, 0xd3, 0xd3, 0xd4, 0xd5, 0xd4,
-  0xd5, 0xd7, 0xd8, 0xd8, 0xd8, 0xd8, 0xda, 0xd9, 0xd8, 0xd9, 0xdb, 0xdb,
-  0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdb, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdc,
-  0xdc, 0xdc, 0xdc, 0xde, 0xde, 0xde, 0xde, 0xdf, 0xde, 0xdf, 0xe0, 0xe0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xdd, 0xde, 0xdc, 0xdd, 0xdd,
-  0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdd, 0xdd, 0xdc, 0xd9, 0xd8, 0xd8, 0xd8,
-  0xd9, 0xd9, 0xd7, 0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd5, 0xd4, 0xd3,
-  0xd1, 0xd0, 0xce, 0xca, 0xc0, 0xb6, 0xb1, 0xaf, 0xae, 0xad, 0xad, 0xac,
-  0xa9, 0xa6, 0xa1, 0x9f, 0x9d, 0x9a, 0x92, 0x86, 0x7a, 0x70, 0x67, 0x72,
-  0x7d, 0x81, 0x82, 0x80, 0x7a, 0x74, 0x70, 0x6e, 0x70, 0x73, 0x6b, 0x61,
-  0x5d, 0x5c, 0x5a, 0x59, 0x59, 0x5b, 0x62, 0x6c, 0x78, 0x80, 0x7e, 0x6e,
-  0x44, 0x2f, 0x42, 0x5b, 0x65, 0x68, 0x64, 0x60, 0x5a, 0x55, 0x52, 0x5e,
-  0x5f, 0x5a, 0x56, 0x4f, 0x46, 0x44, 0x4a, 0x53, 0x60, 0x5d, 0x54, 0x4e,
-  0x4b, 0x4a, 0x51, 0x58, 0x56, 0x55, 0x57, 0x56, 0x56, 0x57, 0x58, 0x5a,
-  0x5d, 0x5e, 0x5e, 0x5e, 0x5d, 0x5d, 0x5e, 0x5f, 0x5f, 0x5d, 0x5e, 0x5d,
-  0x5c, 0x5b, 0x5b, 0x59, 0x58, 0x58, 0x58, 0x58, 0x57, 0x58, 0x5a, 0x5b,
-  0x5d, 0x60, 0x63, 0x67, 0x69, 0x6a, 0x6c, 0x6f, 0x6d, 0x6a, 0x68, 0x67,
-  0x64, 0x60, 0x5e, 0x5d, 0x5c, 0x5b, 0x5a, 0x59, 0x58, 0x56, 0x55, 0x53,
-  0x52, 0x50, 0x4f, 0x4d, 0x4c, 0x4b, 0x4b, 0x4b, 0x4d, 0x4f, 0x50, 0x50,
-  0x4f, 0x4d, 0x4b, 0x4a, 0x49, 0x4a, 0x4b, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
-  0x51, 0x50, 0x50, 0x50, 0x4e, 0x4b, 0x49, 0x48, 0x48, 0x46, 0x44, 0x43,
-  0x44, 0x44, 0x43, 0x42, 0x41, 0x42, 0x43, 0x43, 0x5c, 0x58, 0x55, 0x52,
-  0x4f, 0x4c, 0x48, 0x45, 0x43, 0x42, 0x40, 0x40, 0x3f, 0x41, 0x48, 0x52,
-  0x59, 0x5e, 0x60, 0x63, 0x67, 0x6b, 0x6d, 0x6e, 0x71, 0x77, 0x7c, 0x80,
-  0x81, 0x7f, 0x77, 0x7c, 0xaf, 0xc7, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcc,
-  0xcd, 0xce, 0xce, 0xce, 0xcf, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf,
-  0xd0, 0xd1, 0xd3, 0xd3, 0xd2, 0xd4, 0xd4, 0xd4, 0xd4, 0xd7, 0xd8, 0xd8,
-  0xd8, 0xd8, 0xd9, 0xd8, 0xda, 0xda, 0xda, 0xda, 0xdb, 0xdc, 0xdc, 0xdb,
-  0xdb, 0xdc, 0xdc, 0xdc, 0xdc, 0xdb, 0xda, 0xdc, 0xdc, 0xdc, 0xdd, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdd, 0xdc, 0xdd, 0xde,
-  0xdd, 0xde, 0xde, 0xdc, 0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc,
-  0xdc, 0xdc, 0xdc, 0xda, 0xda, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xd8, 0xd8,
-  0xd8, 0xd7, 0xd7, 0xd7, 0xd6, 0xd6, 0xd6, 0xd4, 0xd3, 0xd3, 0xd1, 0xce,
-  0xca, 0xc3, 0xbd, 0xb7, 0xb0, 0xac, 0xac, 0xac, 0xaa, 0xa6, 0xa1, 0x9f,
-  0x9e, 0x9b, 0x94, 0x8a, 0x80, 0x76, 0x67, 0x6c, 0x78, 0x7f, 0x80, 0x7e,
-  0x78, 0x73, 0x70, 0x6f, 0x6f, 0x72, 0x6a, 0x60, 0x5d, 0x5c, 0x5a, 0x59,
-  0x5a, 0x5d, 0x63, 0x6d, 0x79, 0x80, 0x7e, 0x6e, 0x47, 0x2b, 0x32, 0x46,
-  0x51, 0x5b, 0x5f, 0x5f, 0x5a, 0x54, 0x4f, 0x59, 0x5d, 0x59, 0x55, 0x4e,
-  0x44, 0x41, 0x44, 0x4d, 0x5c, 0x5d, 0x56, 0x4f, 0x4b, 0x4a, 0x50, 0x57,
-  0x56, 0x55, 0x56, 0x56, 0x56, 0x57, 0x57, 0x59, 0x5d, 0x5e, 0x5e, 0x5d,
-  0x5d, 0x5d, 0x5e, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5b, 0x5a, 0x5a, 0x59,
-  0x58, 0x57, 0x57, 0x58, 0x58, 0x58, 0x5a, 0x5b, 0x5d, 0x61, 0x64, 0x68,
-  0x6a, 0x6b, 0x6b, 0x6c, 0x6a, 0x67, 0x65, 0x64, 0x61, 0x5e, 0x5d, 0x5b,
-  0x59, 0x58, 0x57, 0x56, 0x55, 0x54, 0x52, 0x50, 0x4e, 0x4d, 0x4b, 0x4a,
-  0x4a, 0x4a, 0x4a, 0x4b, 0x4e, 0x50, 0x50, 0x50, 0x4f, 0x4d, 0x4a, 0x49,
-  0x49, 0x4a, 0x4c, 0x4e, 0x4f, 0x50, 0x50, 0x50, 0x51, 0x50, 0x50, 0x4f,
-  0x4d, 0x4a, 0x49, 0x48, 0x47, 0x45, 0x43, 0x43, 0x43, 0x43, 0x42, 0x41,
-  0x41, 0x41, 0x42, 0x42, 0x5b, 0x57, 0x53, 0x51, 0x4e, 0x4b, 0x47, 0x44,
-  0x43, 0x42, 0x40, 0x3f, 0x40, 0x41, 0x48, 0x52, 0x5a, 0x5e, 0x60, 0x63,
-  0x68, 0x6c, 0x6e, 0x6f, 0x72, 0x78, 0x7d, 0x80, 0x81, 0x7f, 0x77, 0x80,
-  0xb3, 0xca, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0xcf, 0xce,
-  0xce, 0xd0, 0xd1, 0xd1, 0xd1, 0xd0, 0xcf, 0xcf, 0xcf, 0xd0, 0xd2, 0xd3,
-  0xd2, 0xd3, 0xd4, 0xd3, 0xd4, 0xd6, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd8,
-  0xd9, 0xda, 0xda, 0xda, 0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc,
-  0xdc, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdd, 0xdc, 0xdc, 0xdd, 0xdc, 0xde, 0xdd, 0xdb,
-  0xdb, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xdc, 0xd9,
-  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8, 0xd7, 0xd7, 0xd7, 0xd8, 0xd7,
-  0xd6, 0xd6, 0xd6, 0xd5, 0xd4, 0xd3, 0xd2, 0xd0, 0xcd, 0xc9, 0xc5, 0xbe,
-  0xb5, 0xae, 0xac, 0xab, 0xaa, 0xa6, 0xa1, 0x9f, 0x9e, 0x9b, 0x95, 0x8c,
-  0x84, 0x7a, 0x69, 0x68, 0x74, 0x7c, 0x7e, 0x7c, 0x77, 0x72, 0x70, 0x6f,
-  0x6f, 0x72, 0x69, 0x60, 0x5c, 0x5b, 0x59, 0x59, 0x5a, 0x5d, 0x64, 0x6d,
-  0x78, 0x7f, 0x7e, 0x6f, 0x49, 0x2a, 0x2c, 0x39, 0x42, 0x4e, 0x58, 0x5c,
-  0x57, 0x52, 0x4c, 0x54, 0x5a, 0x58, 0x54, 0x4d, 0x43, 0x41, 0x43, 0x4a,
-  0x58, 0x5c, 0x56, 0x50, 0x4c, 0x4a, 0x50, 0x56, 0x55, 0x54, 0x56, 0x56,
-  0x57, 0x57, 0x57, 0x59, 0x5c, 0x5e, 0x5d, 0x5d, 0x5d, 0x5e, 0x5d, 0x5d,
-  0x5d, 0x5d, 0x5d, 0x5b, 0x59, 0x59, 0x59, 0x57, 0x57, 0x57, 0x57, 0x58,
-  0x57, 0x58, 0x59, 0x5b, 0x5e, 0x62, 0x64, 0x68, 0x6a, 0x6a, 0x6a, 0x69,
-  0x67, 0x65, 0x63, 0x62, 0x5f, 0x5d, 0x5b, 0x5a, 0x58, 0x56, 0x55, 0x54,
-  0x53, 0x52, 0x51, 0x4f, 0x4c, 0x4b, 0x49, 0x48, 0x48, 0x49, 0x4a, 0x4b,
-  0x4e, 0x50, 0x50, 0x50, 0x4f, 0x4d, 0x4a, 0x49, 0x49, 0x4a, 0x4c, 0x4e,
-  0x4f, 0x50, 0x50, 0x4f, 0x50, 0x4f, 0x4f, 0x4e, 0x4c, 0x49, 0x48, 0x47,
-  0x46, 0x44, 0x43, 0x42, 0x43, 0x42, 0x41, 0x42, 0x41, 0x41, 0x42, 0x42,
-  0x59, 0x55, 0x51, 0x4f, 0x4c, 0x49, 0x45, 0x43, 0x42, 0x41, 0x3f, 0x40,
-  0x40, 0x42, 0x48, 0x54, 0x5c, 0x5f, 0x61, 0x63, 0x69, 0x6d, 0x6f, 0x70,
-  0x73, 0x7a, 0x7f, 0x81, 0x81, 0x7f, 0x78, 0x86, 0xb8, 0xcd, 0xcc, 0xcc,
-  0xcd, 0xcc, 0xcc, 0xcb, 0xcc, 0xce, 0xcf, 0xcf, 0xce, 0xcf, 0xd0, 0xd0,
-  0xd0, 0xcf, 0xd0, 0xcf, 0xcf, 0xcf, 0xd2, 0xd3, 0xd2, 0xd3, 0xd3, 0xd3,
-  0xd5, 0xd5, 0xd6, 0xd7, 0xd9, 0xd9, 0xd8, 0xd8, 0xd9, 0xd9, 0xd9, 0xd9,
-  0xdb, 0xdc, 0xdc, 0xdb, 0xdb, 0xdc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdc,
-  0xdc, 0xde, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xde, 0xde,
-  0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
-  0xdc, 0xdb, 0xdc, 0xdc, 0xdc, 0xdd, 0xdc, 0xdb, 0xdb, 0xdc, 0xdc, 0xdc,
-  0xdb, 0xdc, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xd9, 0xd8, 0xd9, 0xda, 0xd9,
-  0xd8, 0xd8, 0xd8, 0xd8, 0xd7, 0xd7, 0xd7, 0xd7, 0xd6, 0xd5, 0xd6, 0xd5,
-  0xd5, 0xd4, 0xd3, 0xd2, 0xd0, 0xcd, 0xcc, 0xc8, 0xc0, 0xb6, 0xaf, 0xac,
-  0xa9, 0xa5, 0xa2, 0xa1, 0xa0, 0x9d, 0x96, 0x8d, 0x86, 0x7e, 0x6f, 0x66,
-  0x6d, 0x77, 0x79, 0x78, 0x75, 0x71, 0x6f, 0x6e, 0x6f, 0x71, 0x68, 0x5f,
-  0x5b, 0x5a, 0x5a, 0x59, 0x5a, 0x5c, 0x63, 0x6b, 0x75, 0x7b, 0x7b, 0x6e,
-  0x4c, 0x2b, 0x28, 0x2c, 0x30, 0x39, 0x48, 0x52, 0x51, 0x4c, 0x46, 0x4a,
-  0x54, 0x53, 0x4f, 0x49, 0x41, 0x40, 0x40, 0x45, 0x51, 0x5a, 0x58, 0x52,
-  0x4f, 0x4d, 0x50, 0x54, 0x53, 0x53, 0x56, 0x57, 0x58, 0x57, 0x58, 0x59,
-  0x5c, 0x5c, 0x5b, 0x5b, 0x5b, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a,
-  0x58, 0x58, 0x58, 0x56, 0x56, 0x57, 0x57, 0x57, 0x57, 0x58, 0x5a, 0x5c,
-  0x60, 0x63, 0x65, 0x67, 0x68, 0x68, 0x68, 0x66, 0x64, 0x62, 0x60, 0x5d,
-  0x5b, 0x5a, 0x58, 0x57, 0x55, 0x53, 0x52, 0x50, 0x50, 0x4f, 0x4e, 0x4c,
-  0x49, 0x48, 0x48, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4f, 0x50, 0x50, 0x4f,
-  0x4e, 0x4b, 0x49, 0x49, 0x49, 0x49, 0x4c, 0x4d, 0x4e, 0x4f, 0x4f, 0x4e,
-  0x4e, 0x4e, 0x4d, 0x4c, 0x4a, 0x48, 0x46, 0x46, 0x45, 0x44, 0x43, 0x42,
-  0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x41, 0x57, 0x52, 0x4e, 0x4c,
-  0x4a, 0x47, 0x44, 0x42, 0x42, 0x40, 0x3f, 0x41, 0x41, 0x42, 0x48, 0x53,
-  0x5d, 0x61, 0x63, 0x65, 0x6a, 0x6e, 0x6f, 0x72, 0x76, 0x7d, 0x81, 0x82,
-  0x81, 0x7f, 0x7b, 0x90, 0xbe, 0xcf, 0xcd, 0xcc, 0xcd, 0xcd, 0xcc, 0xcb,
-  0xcc, 0xce, 0xcf, 0xcf, 0xcf, 0xcf, 0xce, 0xce, 0xcf, 0xd0, 0xd0, 0xd0,
-  0xcf, 0xcf, 0xd1, 0xd2, 0xd2, 0xd3, 0xd3, 0xd3, 0xd5, 0xd5, 0xd6, 0xd7,
-  0xd9, 0xd9, 0xd9, 0xd8, 0xd9, 0xda, 0xda, 0xd9, 0xdb, 0xdc, 0xdc, 0xdb,
-  0xdb, 0xdc, 0xdd, 0xdd, 0xdc, 0xde, 0xde, 0xdc, 0xdc, 0xde, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xde, 0xdc, 0xdc, 0xdd, 0xdd,
-  0xde, 0xde, 0xdd, 0xdc, 0xdd, 0xdd, 0xdd, 0xdc, 0xdc, 0xdc, 0xdb, 0xdb,
-  0xdb, 0xdc, 0xdc, 0xda, 0xd9, 0xd9, 0xda, 0xd9, 0xd9, 0xd9, 0xd9, 0xd8,
-  0xd7, 0xd8, 0xd7, 0xd7, 0xd6, 0xd5, 0xd6, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4,
-  0xd2, 0xd0, 0xd0, 0xcf, 0xcb, 0xc2, 0xb9, 0xb3, 0xac, 0xa4, 0xa3, 0xa2,
-  0xa1, 0x9d, 0x97, 0x8e, 0x89, 0x84, 0x77, 0x66, 0x67, 0x6f, 0x72, 0x72,
-  0x72, 0x70, 0x6e, 0x6d, 0x6e, 0x70, 0x66, 0x5d, 0x5a, 0x59, 0x59, 0x59,
-  0x59, 0x5b, 0x62, 0x6b, 0x72, 0x76, 0x74, 0x6c, 0x50, 0x2f, 0x28, 0x26,
-  0x25, 0x28, 0x38, 0x44, 0x44, 0x40, 0x3a, 0x3b, 0x4a, 0x4c, 0x49, 0x44,
-  0x3d, 0x3d, 0x3c, 0x3f, 0x49, 0x54, 0x57, 0x55, 0x53, 0x51, 0x51, 0x53,
-  0x52, 0x52, 0x57, 0x58, 0x58, 0x58, 0x59, 0x58, 0x59, 0x5b, 0x5a, 0x5a,
-  0x5a, 0x5b, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x57, 0x57, 0x57, 0x55,
-  0x56, 0x56, 0x57, 0x57, 0x57, 0x58, 0x5b, 0x5d, 0x61, 0x64, 0x66, 0x67,
-  0x66, 0x65, 0x64, 0x63, 0x60, 0x5e, 0x5b, 0x58, 0x56, 0x55, 0x54, 0x53,
-  0x51, 0x50, 0x4e, 0x4d, 0x4c, 0x4c, 0x4a, 0x47, 0x47, 0x47, 0x46, 0x47,
-  0x4a, 0x4b, 0x4c, 0x4d, 0x4f, 0x50, 0x50, 0x4f, 0x4d, 0x4a, 0x49, 0x49,
-  0x49, 0x49, 0x4c, 0x4d, 0x4e, 0x4e, 0x4e, 0x4d, 0x4d, 0x4c, 0x4b, 0x4a,
-  0x48, 0x47, 0x45, 0x44, 0x44, 0x42, 0x42, 0x41, 0x40, 0x41, 0x42, 0x41,
-  0x42, 0x42, 0x41, 0x42, 0x80, 0x72, 0x80, 0x72, 0x7f, 0x72, 0x7f, 0x72,
-  0x7f, 0x71, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7e, 0x71, 0x7d, 0x70, 0x7d, 0x70, 0x7e, 0x70, 0x7f, 0x71, 0x79, 0x6d,
-  0x6e, 0x68, 0x5b, 0x64, 0x3f, 0x63, 0x39, 0x62, 0x39, 0x60, 0x3c, 0x5d,
-  0x3c, 0x5d, 0x3d, 0x5d, 0x3c, 0x5c, 0x3b, 0x5e, 0x3b, 0x60, 0x3c, 0x5e,
-  0x3e, 0x5d, 0x40, 0x5d, 0x41, 0x5a, 0x43, 0x5a, 0x45, 0x5b, 0x46, 0x5c,
-  0x47, 0x5c, 0x47, 0x56, 0x46, 0x57, 0x45, 0x57, 0x43, 0x58, 0x41, 0x5a,
-  0x40, 0x5b, 0x3e, 0x5a, 0x3e, 0x5b, 0x3f, 0x5c, 0x40, 0x5d, 0x3f, 0x5f,
-  0x40, 0x5f, 0x41, 0x5f, 0x42, 0x60, 0x43, 0x5f, 0x43, 0x5f, 0x41, 0x5d,
-  0x41, 0x5d, 0x3f, 0x60, 0x3e, 0x61, 0x3e, 0x61, 0x3e, 0x62, 0x3e, 0x61,
-  0x3d, 0x60, 0x3e, 0x61, 0x3e, 0x63, 0x3f, 0x64, 0x3e, 0x64, 0x3e, 0x64,
-  0x3e, 0x65, 0x40, 0x65, 0x42, 0x66, 0x47, 0x68, 0x4f, 0x6b, 0x55, 0x6b,
-  0x57, 0x6c, 0x5a, 0x6d, 0x5a, 0x6e, 0x5a, 0x6e, 0x59, 0x6e, 0x5a, 0x70,
-  0x5d, 0x71, 0x60, 0x74, 0x60, 0x75, 0x61, 0x74, 0x60, 0x74, 0x5f, 0x75,
-  0x60, 0x76, 0x60, 0x76, 0x5f, 0x75, 0x60, 0x76, 0x62, 0x77, 0x62, 0x77,
-  0x63, 0x77, 0x63, 0x78, 0x64, 0x78, 0x64, 0x79, 0x66, 0x7a, 0x67, 0x7a,
-  0x68, 0x7a, 0x69, 0x7a, 0x68, 0x7b, 0x68, 0x7b, 0x68, 0x7b, 0x68, 0x7b,
-  0x68, 0x7a, 0x64, 0x79, 0x62, 0x79, 0x61, 0x78, 0x5e, 0x77, 0x5f, 0x77,
-  0x5f, 0x77, 0x60, 0x77, 0x60, 0x77, 0x5f, 0x77, 0x60, 0x78, 0x5f, 0x78,
-  0x5e, 0x77, 0x5e, 0x77, 0x5e, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77,
-  0x5c, 0x77, 0x5a, 0x77, 0x5a, 0x76, 0x5a, 0x76, 0x57, 0x74, 0x55, 0x72,
-  0x50, 0x73, 0x50, 0x73, 0x51, 0x74, 0x55, 0x75, 0x58, 0x75, 0x62, 0x75,
-  0x6e, 0x72, 0x76, 0x72, 0x7a, 0x71, 0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x71,
-  0x7a, 0x73, 0x7b, 0x72, 0x7b, 0x72, 0x7d, 0x72, 0x7c, 0x71, 0x7c, 0x71,
-  0x7d, 0x74, 0x7d, 0x74, 0x7c, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7c, 0x79,
-  0x7d, 0x7d, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x72, 0x80, 0x72, 0x7f, 0x72, 0x7f, 0x72, 0x7f, 0x71, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x70, 0x7d, 0x70,
-  0x7e, 0x70, 0x7e, 0x70, 0x7c, 0x70, 0x73, 0x6a, 0x62, 0x66, 0x4b, 0x64,
-  0x39, 0x63, 0x37, 0x62, 0x38, 0x60, 0x3a, 0x5e, 0x3b, 0x5e, 0x3b, 0x5e,
-  0x3b, 0x5d, 0x3b, 0x5f, 0x3b, 0x5f, 0x3c, 0x5e, 0x3e, 0x5c, 0x40, 0x5c,
-  0x42, 0x5a, 0x44, 0x5a, 0x45, 0x5a, 0x46, 0x5a, 0x46, 0x5a, 0x46, 0x57,
-  0x45, 0x58, 0x43, 0x58, 0x42, 0x59, 0x40, 0x5c, 0x3f, 0x5d, 0x3e, 0x5c,
-  0x3e, 0x5d, 0x3f, 0x5d, 0x40, 0x5e, 0x40, 0x5f, 0x41, 0x5f, 0x42, 0x5f,
-  0x42, 0x5f, 0x43, 0x5f, 0x42, 0x5f, 0x41, 0x5e, 0x41, 0x5d, 0x3f, 0x60,
-  0x3e, 0x60, 0x3e, 0x61, 0x3e, 0x62, 0x3e, 0x61, 0x3d, 0x60, 0x3e, 0x61,
-  0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x64, 0x3e, 0x65, 0x40, 0x65,
-  0x42, 0x66, 0x47, 0x68, 0x4e, 0x6b, 0x54, 0x6b, 0x55, 0x6c, 0x57, 0x6d,
-  0x58, 0x6e, 0x59, 0x6e, 0x5a, 0x6e, 0x5b, 0x70, 0x5e, 0x72, 0x5f, 0x73,
-  0x60, 0x75, 0x61, 0x75, 0x60, 0x74, 0x60, 0x75, 0x61, 0x76, 0x60, 0x76,
-  0x5f, 0x75, 0x5f, 0x76, 0x60, 0x77, 0x60, 0x77, 0x62, 0x77, 0x62, 0x78,
-  0x63, 0x78, 0x63, 0x78, 0x64, 0x7a, 0x64, 0x7a, 0x66, 0x7a, 0x68, 0x7a,
-  0x68, 0x7b, 0x68, 0x7b, 0x68, 0x7b, 0x68, 0x7b, 0x67, 0x7a, 0x65, 0x7a,
-  0x62, 0x7a, 0x61, 0x78, 0x5e, 0x78, 0x5f, 0x77, 0x5f, 0x77, 0x60, 0x77,
-  0x60, 0x77, 0x5f, 0x77, 0x60, 0x78, 0x5f, 0x78, 0x5e, 0x77, 0x5d, 0x77,
-  0x5c, 0x78, 0x5c, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5c, 0x77, 0x59, 0x77,
-  0x59, 0x75, 0x58, 0x76, 0x56, 0x74, 0x55, 0x73, 0x52, 0x73, 0x52, 0x72,
-  0x53, 0x74, 0x56, 0x75, 0x5a, 0x75, 0x64, 0x75, 0x70, 0x72, 0x78, 0x72,
-  0x7b, 0x71, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x72, 0x7a, 0x73, 0x7b, 0x72,
-  0x7b, 0x72, 0x7c, 0x72, 0x7c, 0x72, 0x7d, 0x70, 0x7d, 0x73, 0x7d, 0x75,
-  0x7c, 0x74, 0x7d, 0x75, 0x7d, 0x75, 0x7c, 0x79, 0x7d, 0x7d, 0x80, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x72, 0x80, 0x72,
-  0x7f, 0x72, 0x7f, 0x72, 0x7f, 0x71, 0x7f, 0x71, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x71, 0x7d, 0x70, 0x7e, 0x71, 0x7d, 0x70,
-  0x79, 0x70, 0x6b, 0x68, 0x54, 0x62, 0x40, 0x63, 0x37, 0x63, 0x37, 0x62,
-  0x37, 0x60, 0x39, 0x5f, 0x39, 0x5f, 0x39, 0x5e, 0x39, 0x5f, 0x3a, 0x5f,
-  0x3b, 0x5f, 0x3c, 0x5e, 0x3e, 0x5c, 0x40, 0x5c, 0x43, 0x5a, 0x45, 0x5a,
-  0x45, 0x59, 0x45, 0x58, 0x45, 0x58, 0x45, 0x58, 0x43, 0x5a, 0x42, 0x5a,
-  0x41, 0x5a, 0x3f, 0x5d, 0x3e, 0x5e, 0x3e, 0x5d, 0x3e, 0x5e, 0x3f, 0x5e,
-  0x41, 0x5f, 0x42, 0x5f, 0x43, 0x5f, 0x44, 0x60, 0x44, 0x5f, 0x43, 0x5f,
-  0x43, 0x5f, 0x41, 0x5d, 0x40, 0x5d, 0x3f, 0x5f, 0x3e, 0x60, 0x3e, 0x61,
-  0x3e, 0x62, 0x3e, 0x61, 0x3e, 0x60, 0x3e, 0x62, 0x3e, 0x63, 0x3e, 0x63,
-  0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x65, 0x40, 0x65, 0x43, 0x66, 0x47, 0x68,
-  0x4c, 0x6b, 0x52, 0x6b, 0x54, 0x6c, 0x57, 0x6d, 0x57, 0x6e, 0x57, 0x6e,
-  0x5a, 0x6e, 0x5c, 0x71, 0x5f, 0x72, 0x5f, 0x72, 0x60, 0x74, 0x60, 0x75,
-  0x60, 0x74, 0x61, 0x74, 0x61, 0x76, 0x60, 0x76, 0x5f, 0x75, 0x5f, 0x75,
-  0x5f, 0x77, 0x5f, 0x77, 0x60, 0x77, 0x60, 0x77, 0x61, 0x78, 0x63, 0x78,
-  0x63, 0x7a, 0x63, 0x7a, 0x64, 0x7a, 0x66, 0x7a, 0x68, 0x7a, 0x68, 0x7b,
-  0x68, 0x7b, 0x68, 0x7b, 0x68, 0x7a, 0x65, 0x7a, 0x63, 0x79, 0x61, 0x78,
-  0x5f, 0x77, 0x5f, 0x77, 0x60, 0x77, 0x60, 0x77, 0x60, 0x77, 0x5f, 0x77,
-  0x60, 0x78, 0x5f, 0x78, 0x5e, 0x77, 0x5c, 0x77, 0x5b, 0x78, 0x5c, 0x78,
-  0x5d, 0x77, 0x5d, 0x77, 0x5c, 0x77, 0x59, 0x77, 0x57, 0x76, 0x57, 0x76,
-  0x56, 0x74, 0x55, 0x73, 0x54, 0x73, 0x53, 0x73, 0x54, 0x74, 0x57, 0x75,
-  0x5b, 0x75, 0x64, 0x74, 0x72, 0x72, 0x7a, 0x71, 0x7b, 0x71, 0x7b, 0x70,
-  0x7a, 0x70, 0x7b, 0x72, 0x7b, 0x73, 0x7b, 0x72, 0x7b, 0x72, 0x7c, 0x72,
-  0x7c, 0x72, 0x7c, 0x70, 0x7d, 0x73, 0x7c, 0x75, 0x7c, 0x74, 0x7e, 0x75,
-  0x7e, 0x75, 0x7c, 0x79, 0x7e, 0x7c, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x70, 0x80, 0x71, 0x80, 0x71, 0x80, 0x71,
-  0x7f, 0x72, 0x7f, 0x72, 0x7f, 0x71, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7e, 0x71, 0x7e, 0x70, 0x7d, 0x70, 0x7b, 0x6f, 0x74, 0x6e, 0x5d, 0x65,
-  0x44, 0x60, 0x39, 0x62, 0x36, 0x62, 0x36, 0x61, 0x37, 0x60, 0x38, 0x5e,
-  0x38, 0x5d, 0x38, 0x5e, 0x38, 0x5f, 0x3a, 0x5f, 0x3b, 0x5d, 0x3d, 0x5d,
-  0x3f, 0x5b, 0x41, 0x5a, 0x44, 0x5a, 0x45, 0x5a, 0x45, 0x5a, 0x45, 0x5a,
-  0x45, 0x59, 0x44, 0x59, 0x43, 0x5a, 0x42, 0x5a, 0x40, 0x5b, 0x3f, 0x5e,
-  0x3f, 0x5e, 0x3f, 0x5d, 0x3f, 0x5e, 0x41, 0x60, 0x42, 0x60, 0x43, 0x61,
-  0x45, 0x61, 0x46, 0x62, 0x44, 0x61, 0x42, 0x60, 0x43, 0x60, 0x41, 0x5e,
-  0x40, 0x5f, 0x3e, 0x61, 0x3e, 0x61, 0x3e, 0x62, 0x3e, 0x63, 0x3f, 0x63,
-  0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x63, 0x3f, 0x63, 0x3e, 0x64,
-  0x3f, 0x65, 0x40, 0x65, 0x44, 0x66, 0x49, 0x68, 0x4d, 0x6a, 0x53, 0x6b,
-  0x55, 0x6c, 0x56, 0x6c, 0x55, 0x6d, 0x57, 0x6e, 0x5a, 0x6e, 0x5b, 0x70,
-  0x5f, 0x72, 0x5f, 0x73, 0x5f, 0x75, 0x5f, 0x75, 0x5f, 0x75, 0x60, 0x75,
-  0x5f, 0x75, 0x5e, 0x75, 0x5d, 0x75, 0x5e, 0x75, 0x60, 0x75, 0x5f, 0x75,
-  0x5f, 0x77, 0x5f, 0x77, 0x60, 0x77, 0x62, 0x77, 0x62, 0x79, 0x64, 0x78,
-  0x65, 0x79, 0x65, 0x7a, 0x66, 0x7a, 0x68, 0x7a, 0x68, 0x7a, 0x67, 0x7b,
-  0x67, 0x7b, 0x66, 0x7a, 0x65, 0x78, 0x64, 0x78, 0x61, 0x78, 0x60, 0x78,
-  0x60, 0x79, 0x60, 0x77, 0x60, 0x77, 0x60, 0x77, 0x60, 0x77, 0x5f, 0x78,
-  0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5a, 0x77, 0x5a, 0x77, 0x58, 0x77, 0x57, 0x77, 0x56, 0x75, 0x56, 0x75,
-  0x56, 0x75, 0x55, 0x74, 0x56, 0x73, 0x59, 0x73, 0x5c, 0x75, 0x67, 0x74,
-  0x74, 0x71, 0x79, 0x70, 0x7b, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x70,
-  0x7a, 0x71, 0x7b, 0x73, 0x7a, 0x73, 0x7b, 0x72, 0x7c, 0x72, 0x7d, 0x71,
-  0x7c, 0x72, 0x7c, 0x73, 0x7d, 0x73, 0x7d, 0x74, 0x7e, 0x73, 0x7e, 0x75,
-  0x7f, 0x7b, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x70, 0x80, 0x70, 0x80, 0x70, 0x80, 0x70, 0x7f, 0x72, 0x7f, 0x72,
-  0x7f, 0x71, 0x7f, 0x71, 0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x70, 0x7d, 0x70,
-  0x7d, 0x70, 0x79, 0x6e, 0x6f, 0x6b, 0x55, 0x63, 0x3e, 0x60, 0x37, 0x62,
-  0x36, 0x62, 0x36, 0x61, 0x36, 0x60, 0x37, 0x5e, 0x37, 0x5e, 0x37, 0x5f,
-  0x38, 0x5f, 0x3b, 0x5e, 0x3c, 0x5d, 0x3e, 0x5d, 0x40, 0x5b, 0x42, 0x5a,
-  0x44, 0x5a, 0x45, 0x5a, 0x44, 0x5a, 0x44, 0x5a, 0x44, 0x5b, 0x43, 0x5b,
-  0x42, 0x5a, 0x41, 0x5a, 0x40, 0x5b, 0x3f, 0x5e, 0x3f, 0x5f, 0x40, 0x5d,
-  0x40, 0x5f, 0x43, 0x61, 0x44, 0x62, 0x45, 0x62, 0x46, 0x62, 0x46, 0x62,
-  0x43, 0x62, 0x42, 0x60, 0x43, 0x60, 0x41, 0x5e, 0x40, 0x60, 0x3e, 0x62,
-  0x3f, 0x61, 0x3e, 0x62, 0x3f, 0x64, 0x3f, 0x63, 0x3e, 0x63, 0x3d, 0x63,
-  0x3d, 0x63, 0x3e, 0x63, 0x3f, 0x63, 0x3f, 0x64, 0x3f, 0x65, 0x41, 0x65,
-  0x44, 0x66, 0x49, 0x68, 0x4d, 0x6a, 0x54, 0x6c, 0x56, 0x6d, 0x56, 0x6c,
-  0x55, 0x6d, 0x57, 0x6e, 0x5a, 0x6f, 0x5b, 0x70, 0x5e, 0x72, 0x5f, 0x73,
-  0x5f, 0x75, 0x5f, 0x75, 0x5f, 0x75, 0x5f, 0x75, 0x5f, 0x75, 0x5e, 0x75,
-  0x5d, 0x75, 0x5e, 0x75, 0x5e, 0x74, 0x5e, 0x74, 0x5e, 0x76, 0x5e, 0x77,
-  0x5f, 0x77, 0x60, 0x77, 0x61, 0x78, 0x63, 0x78, 0x64, 0x79, 0x64, 0x7a,
-  0x64, 0x7a, 0x67, 0x79, 0x67, 0x7a, 0x67, 0x7b, 0x66, 0x7a, 0x66, 0x79,
-  0x66, 0x78, 0x65, 0x78, 0x61, 0x78, 0x60, 0x78, 0x60, 0x78, 0x60, 0x77,
-  0x60, 0x77, 0x60, 0x77, 0x60, 0x77, 0x5f, 0x77, 0x5d, 0x77, 0x5c, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77,
-  0x59, 0x77, 0x57, 0x77, 0x56, 0x75, 0x56, 0x75, 0x56, 0x75, 0x56, 0x75,
-  0x58, 0x73, 0x5a, 0x74, 0x5d, 0x76, 0x68, 0x73, 0x74, 0x70, 0x79, 0x70,
-  0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x72, 0x7b, 0x73,
-  0x7b, 0x73, 0x7a, 0x72, 0x7b, 0x72, 0x7d, 0x72, 0x7c, 0x72, 0x7d, 0x73,
-  0x7d, 0x73, 0x7e, 0x74, 0x7e, 0x72, 0x7d, 0x75, 0x7e, 0x7b, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x70, 0x80, 0x70,
-  0x80, 0x70, 0x80, 0x70, 0x7f, 0x71, 0x7f, 0x72, 0x7f, 0x71, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x70, 0x7d, 0x71, 0x7c, 0x70, 0x73, 0x6c,
-  0x65, 0x67, 0x48, 0x60, 0x3a, 0x60, 0x38, 0x62, 0x36, 0x62, 0x36, 0x61,
-  0x36, 0x60, 0x35, 0x60, 0x36, 0x60, 0x37, 0x5f, 0x39, 0x5f, 0x3b, 0x5e,
-  0x3d, 0x5e, 0x3f, 0x5d, 0x42, 0x5b, 0x44, 0x5a, 0x44, 0x5a, 0x44, 0x5a,
-  0x44, 0x5a, 0x43, 0x5b, 0x42, 0x5c, 0x42, 0x5d, 0x42, 0x5b, 0x41, 0x5a,
-  0x40, 0x5c, 0x3f, 0x5e, 0x40, 0x60, 0x42, 0x61, 0x42, 0x62, 0x45, 0x63,
-  0x46, 0x63, 0x47, 0x64, 0x47, 0x63, 0x46, 0x62, 0x44, 0x62, 0x43, 0x60,
-  0x43, 0x60, 0x41, 0x60, 0x3f, 0x62, 0x3f, 0x62, 0x3f, 0x62, 0x3e, 0x62,
-  0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x62, 0x3e, 0x63, 0x3e, 0x63,
-  0x3f, 0x64, 0x3e, 0x64, 0x3f, 0x65, 0x41, 0x65, 0x44, 0x66, 0x49, 0x68,
-  0x4e, 0x6a, 0x54, 0x6c, 0x56, 0x6d, 0x56, 0x6c, 0x55, 0x6e, 0x57, 0x6e,
-  0x5a, 0x6e, 0x5b, 0x70, 0x5e, 0x72, 0x5f, 0x72, 0x5f, 0x74, 0x5f, 0x75,
-  0x5f, 0x75, 0x5f, 0x75, 0x5f, 0x75, 0x5e, 0x75, 0x5d, 0x75, 0x5d, 0x74,
-  0x5d, 0x75, 0x5c, 0x75, 0x5d, 0x74, 0x5c, 0x75, 0x5c, 0x77, 0x5e, 0x77,
-  0x5f, 0x78, 0x61, 0x78, 0x62, 0x7a, 0x62, 0x7a, 0x63, 0x79, 0x65, 0x79,
-  0x66, 0x7a, 0x67, 0x7b, 0x67, 0x7a, 0x66, 0x7a, 0x65, 0x79, 0x63, 0x78,
-  0x61, 0x78, 0x60, 0x78, 0x60, 0x78, 0x60, 0x77, 0x60, 0x77, 0x60, 0x77,
-  0x60, 0x77, 0x5f, 0x77, 0x5d, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x59, 0x77, 0x57, 0x77,
-  0x56, 0x76, 0x56, 0x75, 0x58, 0x76, 0x58, 0x76, 0x5a, 0x76, 0x5c, 0x76,
-  0x5f, 0x76, 0x6b, 0x73, 0x75, 0x70, 0x79, 0x70, 0x7b, 0x70, 0x7a, 0x70,
-  0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x71, 0x7b, 0x73, 0x7b, 0x72, 0x7a, 0x72,
-  0x7b, 0x72, 0x7c, 0x72, 0x7c, 0x72, 0x7c, 0x73, 0x7c, 0x73, 0x7e, 0x74,
-  0x7d, 0x72, 0x7b, 0x75, 0x7c, 0x7a, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x70, 0x80, 0x70, 0x80, 0x70, 0x7f, 0x70,
-  0x7f, 0x71, 0x7f, 0x71, 0x7f, 0x71, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x70, 0x7e, 0x70, 0x7c, 0x70, 0x6e, 0x6a, 0x5d, 0x64, 0x3e, 0x61,
-  0x37, 0x61, 0x37, 0x62, 0x36, 0x62, 0x35, 0x61, 0x35, 0x61, 0x35, 0x61,
-  0x36, 0x61, 0x38, 0x60, 0x3a, 0x5f, 0x3c, 0x5e, 0x3e, 0x5e, 0x40, 0x5c,
-  0x43, 0x5b, 0x44, 0x5a, 0x43, 0x5b, 0x43, 0x5b, 0x43, 0x5c, 0x43, 0x5d,
-  0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5c, 0x41, 0x5d, 0x40, 0x5f, 0x40, 0x5f,
-  0x41, 0x5f, 0x43, 0x61, 0x43, 0x63, 0x45, 0x64, 0x47, 0x64, 0x48, 0x66,
-  0x48, 0x65, 0x46, 0x63, 0x44, 0x61, 0x43, 0x61, 0x43, 0x62, 0x40, 0x62,
-  0x40, 0x62, 0x3f, 0x63, 0x40, 0x63, 0x3f, 0x63, 0x3e, 0x63, 0x3e, 0x64,
-  0x3e, 0x65, 0x3e, 0x64, 0x3e, 0x64, 0x3e, 0x65, 0x3e, 0x65, 0x3e, 0x65,
-  0x40, 0x65, 0x41, 0x65, 0x45, 0x68, 0x4a, 0x6a, 0x4e, 0x6b, 0x53, 0x6d,
-  0x55, 0x6e, 0x56, 0x6d, 0x56, 0x6f, 0x57, 0x6f, 0x5a, 0x6f, 0x5b, 0x71,
-  0x5e, 0x73, 0x5e, 0x72, 0x5f, 0x74, 0x5f, 0x75, 0x5f, 0x75, 0x5e, 0x75,
-  0x5d, 0x75, 0x5d, 0x75, 0x5d, 0x75, 0x5c, 0x74, 0x5c, 0x73, 0x5c, 0x73,
-  0x5b, 0x75, 0x5b, 0x75, 0x5c, 0x77, 0x5e, 0x77, 0x5e, 0x79, 0x60, 0x79,
-  0x61, 0x78, 0x61, 0x78, 0x62, 0x78, 0x63, 0x78, 0x64, 0x79, 0x66, 0x7a,
-  0x67, 0x7b, 0x65, 0x7b, 0x65, 0x7a, 0x63, 0x79, 0x62, 0x79, 0x60, 0x77,
-  0x60, 0x78, 0x61, 0x77, 0x61, 0x77, 0x5f, 0x77, 0x60, 0x77, 0x5f, 0x77,
-  0x5c, 0x77, 0x5b, 0x77, 0x5d, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x59, 0x77, 0x57, 0x77, 0x56, 0x76, 0x56, 0x75,
-  0x57, 0x75, 0x58, 0x75, 0x5b, 0x76, 0x5d, 0x76, 0x63, 0x75, 0x6d, 0x72,
-  0x77, 0x6f, 0x7a, 0x70, 0x7b, 0x6f, 0x7a, 0x6f, 0x7b, 0x70, 0x7b, 0x70,
-  0x7a, 0x71, 0x7a, 0x73, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72,
-  0x7b, 0x72, 0x7b, 0x73, 0x7b, 0x72, 0x7d, 0x72, 0x7d, 0x72, 0x7b, 0x76,
-  0x7c, 0x7b, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x70, 0x80, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x6f,
-  0x7a, 0x6e, 0x6a, 0x68, 0x57, 0x63, 0x3b, 0x62, 0x36, 0x62, 0x37, 0x62,
-  0x37, 0x62, 0x36, 0x63, 0x35, 0x62, 0x35, 0x61, 0x37, 0x60, 0x39, 0x61,
-  0x3b, 0x5f, 0x3e, 0x5d, 0x40, 0x5c, 0x41, 0x5a, 0x43, 0x5a, 0x43, 0x5a,
-  0x42, 0x5b, 0x42, 0x5b, 0x42, 0x5d, 0x41, 0x5d, 0x41, 0x5d, 0x41, 0x5d,
-  0x41, 0x5c, 0x40, 0x5e, 0x40, 0x61, 0x40, 0x61, 0x41, 0x60, 0x43, 0x63,
-  0x44, 0x65, 0x47, 0x66, 0x49, 0x66, 0x49, 0x66, 0x48, 0x66, 0x46, 0x64,
-  0x44, 0x61, 0x44, 0x62, 0x43, 0x62, 0x40, 0x63, 0x40, 0x63, 0x40, 0x63,
-  0x40, 0x63, 0x40, 0x63, 0x3f, 0x63, 0x3f, 0x64, 0x3e, 0x65, 0x3e, 0x65,
-  0x3e, 0x65, 0x3d, 0x65, 0x3d, 0x66, 0x3d, 0x66, 0x40, 0x65, 0x42, 0x66,
-  0x48, 0x69, 0x4d, 0x6b, 0x50, 0x6b, 0x53, 0x6e, 0x55, 0x6e, 0x56, 0x6e,
-  0x55, 0x6f, 0x58, 0x6f, 0x5a, 0x6f, 0x5b, 0x71, 0x5e, 0x73, 0x5e, 0x73,
-  0x5f, 0x74, 0x5f, 0x75, 0x5f, 0x75, 0x5e, 0x75, 0x5d, 0x75, 0x5d, 0x75,
-  0x5c, 0x75, 0x5b, 0x74, 0x5b, 0x73, 0x5b, 0x72, 0x59, 0x74, 0x5a, 0x74,
-  0x5c, 0x75, 0x5c, 0x75, 0x5d, 0x78, 0x5f, 0x78, 0x60, 0x77, 0x60, 0x77,
-  0x61, 0x77, 0x61, 0x77, 0x62, 0x78, 0x64, 0x79, 0x66, 0x7a, 0x66, 0x7b,
-  0x65, 0x7a, 0x65, 0x7a, 0x63, 0x79, 0x61, 0x78, 0x61, 0x78, 0x61, 0x78,
-  0x60, 0x78, 0x5f, 0x76, 0x5f, 0x77, 0x5f, 0x77, 0x5b, 0x77, 0x5c, 0x77,
-  0x5d, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x59, 0x77, 0x57, 0x77, 0x55, 0x75, 0x55, 0x76, 0x55, 0x75, 0x57, 0x76,
-  0x5b, 0x76, 0x5e, 0x75, 0x65, 0x74, 0x6f, 0x72, 0x78, 0x6f, 0x7a, 0x6f,
-  0x7b, 0x6e, 0x7a, 0x6e, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x71, 0x7a, 0x72,
-  0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72, 0x7a, 0x72,
-  0x7a, 0x72, 0x7c, 0x72, 0x7d, 0x72, 0x7b, 0x75, 0x7d, 0x7a, 0x7f, 0x7e,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x71, 0x80, 0x71,
-  0x7f, 0x71, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x6f, 0x7e, 0x6f, 0x7a, 0x6e, 0x65, 0x66,
-  0x50, 0x61, 0x39, 0x61, 0x36, 0x61, 0x37, 0x62, 0x37, 0x63, 0x36, 0x62,
-  0x35, 0x62, 0x35, 0x60, 0x37, 0x60, 0x3a, 0x61, 0x3d, 0x5f, 0x40, 0x5c,
-  0x42, 0x5a, 0x42, 0x58, 0x41, 0x5a, 0x41, 0x5a, 0x41, 0x5b, 0x41, 0x5b,
-  0x41, 0x5d, 0x41, 0x5d, 0x41, 0x5d, 0x41, 0x5d, 0x41, 0x5c, 0x41, 0x5d,
-  0x40, 0x62, 0x40, 0x63, 0x42, 0x63, 0x43, 0x67, 0x46, 0x68, 0x48, 0x68,
-  0x4a, 0x68, 0x49, 0x66, 0x48, 0x66, 0x46, 0x64, 0x44, 0x62, 0x44, 0x63,
-  0x43, 0x62, 0x41, 0x63, 0x40, 0x63, 0x40, 0x62, 0x40, 0x63, 0x40, 0x63,
-  0x3f, 0x63, 0x3f, 0x64, 0x3f, 0x65, 0x3e, 0x65, 0x3d, 0x65, 0x3d, 0x65,
-  0x3d, 0x65, 0x3d, 0x65, 0x40, 0x65, 0x42, 0x66, 0x4a, 0x69, 0x4e, 0x6a,
-  0x52, 0x6b, 0x55, 0x6e, 0x56, 0x6e, 0x56, 0x6e, 0x55, 0x6f, 0x58, 0x6f,
-  0x5a, 0x6f, 0x5b, 0x71, 0x5d, 0x74, 0x5e, 0x73, 0x5f, 0x74, 0x60, 0x75,
-  0x5f, 0x75, 0x5f, 0x75, 0x5e, 0x74, 0x5e, 0x75, 0x5d, 0x75, 0x5b, 0x75,
-  0x59, 0x73, 0x59, 0x73, 0x57, 0x72, 0x58, 0x71, 0x5a, 0x72, 0x5b, 0x73,
-  0x5b, 0x76, 0x5d, 0x76, 0x5e, 0x77, 0x5d, 0x77, 0x5f, 0x77, 0x5f, 0x77,
-  0x5f, 0x78, 0x62, 0x77, 0x65, 0x78, 0x66, 0x78, 0x65, 0x79, 0x65, 0x7a,
-  0x64, 0x79, 0x63, 0x78, 0x63, 0x78, 0x60, 0x78, 0x60, 0x78, 0x60, 0x77,
-  0x60, 0x77, 0x5f, 0x77, 0x5c, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x5b, 0x78,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x58, 0x77, 0x56, 0x77,
-  0x55, 0x75, 0x55, 0x76, 0x56, 0x75, 0x59, 0x75, 0x5b, 0x75, 0x5e, 0x75,
-  0x67, 0x74, 0x70, 0x72, 0x78, 0x6f, 0x7a, 0x6f, 0x7b, 0x6f, 0x7b, 0x6f,
-  0x7b, 0x70, 0x7b, 0x70, 0x7a, 0x72, 0x7a, 0x73, 0x7a, 0x72, 0x7a, 0x72,
-  0x7b, 0x72, 0x7b, 0x73, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72, 0x7d, 0x72,
-  0x7d, 0x72, 0x7b, 0x74, 0x7c, 0x76, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x80, 0x70, 0x80, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x70, 0x7e, 0x6f, 0x78, 0x6d, 0x62, 0x64, 0x4b, 0x61, 0x38, 0x62,
-  0x36, 0x62, 0x37, 0x61, 0x37, 0x62, 0x36, 0x62, 0x36, 0x62, 0x36, 0x61,
-  0x38, 0x60, 0x3b, 0x60, 0x3e, 0x5e, 0x40, 0x5c, 0x42, 0x59, 0x42, 0x59,
-  0x41, 0x5b, 0x41, 0x5a, 0x41, 0x5a, 0x41, 0x5a, 0x41, 0x5c, 0x41, 0x5c,
-  0x41, 0x5c, 0x40, 0x5d, 0x40, 0x5d, 0x40, 0x5e, 0x40, 0x63, 0x41, 0x65,
-  0x42, 0x66, 0x44, 0x68, 0x47, 0x69, 0x49, 0x6a, 0x4a, 0x69, 0x48, 0x66,
-  0x47, 0x65, 0x45, 0x64, 0x44, 0x62, 0x44, 0x62, 0x43, 0x62, 0x41, 0x63,
-  0x41, 0x62, 0x40, 0x63, 0x41, 0x64, 0x40, 0x63, 0x40, 0x63, 0x3f, 0x63,
-  0x3e, 0x64, 0x3d, 0x65, 0x3d, 0x65, 0x3d, 0x65, 0x3d, 0x65, 0x3f, 0x66,
-  0x40, 0x66, 0x43, 0x66, 0x4b, 0x69, 0x4f, 0x6b, 0x52, 0x6b, 0x56, 0x6e,
-  0x57, 0x6f, 0x57, 0x6e, 0x56, 0x6f, 0x57, 0x6f, 0x5a, 0x70, 0x5b, 0x71,
-  0x5d, 0x73, 0x5d, 0x73, 0x5e, 0x73, 0x5e, 0x74, 0x5f, 0x74, 0x5e, 0x74,
-  0x5d, 0x74, 0x5e, 0x74, 0x5c, 0x74, 0x5a, 0x73, 0x58, 0x73, 0x57, 0x72,
-  0x57, 0x71, 0x57, 0x72, 0x58, 0x72, 0x59, 0x72, 0x59, 0x74, 0x5c, 0x74,
-  0x5d, 0x76, 0x5d, 0x76, 0x5e, 0x77, 0x60, 0x77, 0x5f, 0x76, 0x61, 0x76,
-  0x64, 0x77, 0x65, 0x78, 0x66, 0x78, 0x65, 0x7a, 0x65, 0x79, 0x64, 0x79,
-  0x63, 0x78, 0x60, 0x78, 0x61, 0x78, 0x5f, 0x77, 0x60, 0x77, 0x5f, 0x77,
-  0x5c, 0x77, 0x5c, 0x77, 0x5c, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x59, 0x77, 0x58, 0x77, 0x56, 0x75, 0x56, 0x75,
-  0x56, 0x75, 0x58, 0x75, 0x59, 0x76, 0x5f, 0x75, 0x68, 0x73, 0x71, 0x71,
-  0x79, 0x6f, 0x7a, 0x6f, 0x7b, 0x6f, 0x7b, 0x6f, 0x7a, 0x70, 0x7b, 0x70,
-  0x7b, 0x71, 0x7b, 0x72, 0x7b, 0x71, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x72,
-  0x7a, 0x71, 0x7b, 0x72, 0x7b, 0x72, 0x7d, 0x72, 0x7c, 0x71, 0x7b, 0x72,
-  0x7d, 0x76, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f,
-  0x7d, 0x6f, 0x7d, 0x6f, 0x7f, 0x70, 0x7f, 0x70, 0x80, 0x70, 0x80, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x70, 0x7e, 0x6e,
-  0x76, 0x6b, 0x5f, 0x63, 0x48, 0x63, 0x36, 0x64, 0x36, 0x62, 0x36, 0x60,
-  0x36, 0x60, 0x37, 0x61, 0x37, 0x62, 0x37, 0x60, 0x39, 0x61, 0x3c, 0x5e,
-  0x3e, 0x5d, 0x40, 0x5c, 0x41, 0x5b, 0x41, 0x5c, 0x40, 0x5d, 0x40, 0x5c,
-  0x41, 0x5b, 0x41, 0x5b, 0x41, 0x5c, 0x41, 0x5c, 0x40, 0x5c, 0x40, 0x5f,
-  0x40, 0x60, 0x40, 0x61, 0x40, 0x64, 0x42, 0x67, 0x44, 0x69, 0x46, 0x68,
-  0x47, 0x69, 0x48, 0x6a, 0x48, 0x6a, 0x47, 0x68, 0x47, 0x65, 0x45, 0x65,
-  0x44, 0x64, 0x44, 0x62, 0x43, 0x62, 0x42, 0x63, 0x42, 0x63, 0x41, 0x65,
-  0x41, 0x66, 0x41, 0x64, 0x41, 0x63, 0x40, 0x63, 0x3e, 0x63, 0x3c, 0x65,
-  0x3d, 0x66, 0x3d, 0x66, 0x3e, 0x66, 0x41, 0x66, 0x42, 0x67, 0x44, 0x68,
-  0x4b, 0x69, 0x50, 0x6b, 0x53, 0x6c, 0x57, 0x6f, 0x58, 0x6f, 0x59, 0x6f,
-  0x57, 0x6f, 0x58, 0x6f, 0x5a, 0x71, 0x5b, 0x72, 0x5c, 0x71, 0x5c, 0x71,
-  0x5d, 0x72, 0x5d, 0x73, 0x5e, 0x73, 0x5d, 0x72, 0x5d, 0x73, 0x5d, 0x72,
-  0x5b, 0x72, 0x5a, 0x72, 0x57, 0x72, 0x56, 0x72, 0x57, 0x72, 0x57, 0x73,
-  0x57, 0x73, 0x56, 0x73, 0x57, 0x73, 0x5a, 0x73, 0x5c, 0x74, 0x5c, 0x74,
-  0x5c, 0x75, 0x60, 0x76, 0x5f, 0x75, 0x61, 0x77, 0x62, 0x79, 0x64, 0x78,
-  0x66, 0x79, 0x66, 0x7a, 0x66, 0x7a, 0x65, 0x7a, 0x63, 0x79, 0x60, 0x78,
-  0x60, 0x78, 0x5f, 0x77, 0x60, 0x77, 0x5e, 0x77, 0x5d, 0x77, 0x5d, 0x77,
-  0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5a, 0x77, 0x5a, 0x77, 0x58, 0x75, 0x58, 0x75, 0x57, 0x74, 0x57, 0x74,
-  0x59, 0x76, 0x61, 0x73, 0x69, 0x73, 0x73, 0x70, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7b, 0x70,
-  0x7b, 0x70, 0x7b, 0x72, 0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x73,
-  0x7a, 0x72, 0x7d, 0x71, 0x7d, 0x70, 0x7c, 0x70, 0x7e, 0x76, 0x7f, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x6f, 0x7e, 0x6f,
-  0x7f, 0x70, 0x7f, 0x70, 0x80, 0x70, 0x80, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x71, 0x7f, 0x70, 0x7d, 0x6e, 0x76, 0x6b, 0x5e, 0x63,
-  0x46, 0x63, 0x36, 0x64, 0x36, 0x61, 0x36, 0x60, 0x36, 0x61, 0x37, 0x63,
-  0x37, 0x62, 0x37, 0x61, 0x3a, 0x60, 0x3d, 0x5e, 0x3e, 0x5d, 0x3f, 0x5d,
-  0x3f, 0x5d, 0x40, 0x5d, 0x40, 0x5e, 0x41, 0x5e, 0x41, 0x5e, 0x41, 0x5d,
-  0x41, 0x5e, 0x41, 0x5d, 0x41, 0x5e, 0x40, 0x61, 0x40, 0x64, 0x40, 0x65,
-  0x41, 0x66, 0x43, 0x68, 0x47, 0x6b, 0x48, 0x6b, 0x48, 0x6a, 0x48, 0x6a,
-  0x48, 0x6a, 0x46, 0x67, 0x46, 0x65, 0x44, 0x65, 0x44, 0x64, 0x43, 0x64,
-  0x43, 0x63, 0x42, 0x66, 0x41, 0x65, 0x41, 0x64, 0x40, 0x65, 0x40, 0x63,
-  0x41, 0x63, 0x40, 0x62, 0x3e, 0x63, 0x3d, 0x65, 0x3d, 0x66, 0x3d, 0x66,
-  0x3e, 0x65, 0x41, 0x65, 0x44, 0x67, 0x46, 0x68, 0x4d, 0x69, 0x52, 0x6b,
-  0x55, 0x6c, 0x58, 0x6f, 0x5a, 0x6f, 0x5b, 0x6f, 0x59, 0x6e, 0x59, 0x6f,
-  0x5b, 0x72, 0x5c, 0x73, 0x5d, 0x72, 0x5d, 0x72, 0x5d, 0x72, 0x5e, 0x73,
-  0x5e, 0x73, 0x5e, 0x73, 0x5d, 0x73, 0x5d, 0x72, 0x5b, 0x72, 0x5a, 0x72,
-  0x57, 0x72, 0x55, 0x72, 0x56, 0x72, 0x55, 0x72, 0x55, 0x73, 0x55, 0x73,
-  0x56, 0x73, 0x59, 0x73, 0x5b, 0x75, 0x5a, 0x75, 0x5b, 0x75, 0x5e, 0x76,
-  0x5f, 0x75, 0x60, 0x77, 0x62, 0x79, 0x64, 0x78, 0x66, 0x79, 0x66, 0x7a,
-  0x66, 0x7a, 0x65, 0x7a, 0x62, 0x79, 0x60, 0x78, 0x61, 0x78, 0x5f, 0x77,
-  0x5f, 0x78, 0x5e, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77,
-  0x5d, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x59, 0x77,
-  0x57, 0x75, 0x57, 0x75, 0x57, 0x75, 0x58, 0x74, 0x5a, 0x76, 0x62, 0x73,
-  0x6a, 0x73, 0x74, 0x71, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x71, 0x7b, 0x71, 0x7b, 0x73,
-  0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x71, 0x7a, 0x73, 0x7a, 0x72, 0x7c, 0x6f,
-  0x7c, 0x70, 0x7c, 0x71, 0x7d, 0x75, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x7d, 0x6f, 0x7d, 0x6f, 0x7f, 0x70, 0x7f, 0x70,
-  0x80, 0x70, 0x80, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x6f,
-  0x7e, 0x70, 0x7e, 0x6f, 0x73, 0x6b, 0x5b, 0x64, 0x45, 0x63, 0x35, 0x63,
-  0x36, 0x61, 0x36, 0x60, 0x37, 0x60, 0x37, 0x61, 0x37, 0x61, 0x38, 0x60,
-  0x3a, 0x60, 0x3c, 0x5e, 0x3e, 0x5d, 0x3e, 0x5e, 0x3e, 0x5e, 0x3f, 0x5e,
-  0x40, 0x5f, 0x40, 0x5e, 0x41, 0x5f, 0x41, 0x5e, 0x41, 0x60, 0x41, 0x5f,
-  0x40, 0x60, 0x40, 0x62, 0x40, 0x65, 0x40, 0x67, 0x43, 0x67, 0x46, 0x69,
-  0x4a, 0x6b, 0x4c, 0x6c, 0x4a, 0x6a, 0x47, 0x6a, 0x46, 0x69, 0x45, 0x67,
-  0x45, 0x65, 0x44, 0x64, 0x43, 0x65, 0x43, 0x65, 0x43, 0x65, 0x42, 0x67,
-  0x42, 0x66, 0x41, 0x64, 0x41, 0x65, 0x40, 0x63, 0x40, 0x63, 0x3f, 0x62,
-  0x3d, 0x64, 0x3c, 0x65, 0x3c, 0x66, 0x3d, 0x66, 0x3e, 0x66, 0x42, 0x66,
-  0x45, 0x67, 0x47, 0x67, 0x4e, 0x6a, 0x53, 0x6b, 0x56, 0x6e, 0x5a, 0x6f,
-  0x5c, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x71, 0x5b, 0x72,
-  0x5c, 0x72, 0x5d, 0x73, 0x5d, 0x73, 0x5e, 0x73, 0x5e, 0x73, 0x5d, 0x73,
-  0x5c, 0x73, 0x5c, 0x73, 0x5a, 0x72, 0x59, 0x72, 0x57, 0x72, 0x55, 0x72,
-  0x54, 0x72, 0x54, 0x72, 0x53, 0x72, 0x54, 0x73, 0x56, 0x73, 0x58, 0x73,
-  0x59, 0x74, 0x59, 0x74, 0x5a, 0x74, 0x5c, 0x74, 0x5e, 0x75, 0x60, 0x77,
-  0x61, 0x78, 0x63, 0x78, 0x66, 0x79, 0x65, 0x7b, 0x65, 0x7a, 0x65, 0x7a,
-  0x63, 0x7a, 0x61, 0x78, 0x61, 0x78, 0x5f, 0x78, 0x60, 0x78, 0x5f, 0x77,
-  0x5d, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x5c, 0x77, 0x5c, 0x77, 0x5c, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x59, 0x76, 0x58, 0x75, 0x58, 0x75,
-  0x57, 0x75, 0x57, 0x75, 0x5b, 0x75, 0x64, 0x74, 0x6c, 0x72, 0x75, 0x70,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x71, 0x7a, 0x71, 0x7b, 0x71, 0x7a, 0x71, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x72, 0x7a, 0x72, 0x7d, 0x6f, 0x7d, 0x71, 0x7c, 0x72,
-  0x7d, 0x75, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x7b, 0x70, 0x7c, 0x70, 0x7d, 0x70, 0x7e, 0x6f, 0x7e, 0x70, 0x7e, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x6f, 0x7e, 0x6f, 0x7c, 0x6e,
-  0x6f, 0x6b, 0x58, 0x65, 0x43, 0x63, 0x35, 0x62, 0x35, 0x60, 0x36, 0x60,
-  0x37, 0x60, 0x38, 0x60, 0x39, 0x60, 0x39, 0x60, 0x3a, 0x5f, 0x3b, 0x5f,
-  0x3c, 0x5f, 0x3d, 0x5f, 0x3d, 0x5f, 0x3e, 0x5f, 0x3f, 0x5f, 0x40, 0x5f,
-  0x41, 0x5f, 0x41, 0x5f, 0x40, 0x61, 0x40, 0x62, 0x3f, 0x63, 0x3e, 0x65,
-  0x41, 0x65, 0x43, 0x67, 0x47, 0x69, 0x4b, 0x6a, 0x4e, 0x6c, 0x4e, 0x6b,
-  0x4c, 0x6a, 0x46, 0x6a, 0x43, 0x6a, 0x44, 0x67, 0x44, 0x65, 0x44, 0x65,
-  0x42, 0x65, 0x42, 0x65, 0x42, 0x66, 0x41, 0x66, 0x41, 0x66, 0x41, 0x65,
-  0x41, 0x65, 0x42, 0x64, 0x3f, 0x63, 0x3f, 0x62, 0x3d, 0x65, 0x3b, 0x66,
-  0x3b, 0x65, 0x3d, 0x66, 0x3f, 0x68, 0x41, 0x67, 0x46, 0x66, 0x48, 0x67,
-  0x4f, 0x6b, 0x53, 0x6e, 0x58, 0x70, 0x5c, 0x70, 0x5e, 0x70, 0x5b, 0x70,
-  0x5b, 0x71, 0x5b, 0x71, 0x5b, 0x71, 0x5b, 0x70, 0x5c, 0x72, 0x5d, 0x73,
-  0x5d, 0x73, 0x5d, 0x73, 0x5d, 0x73, 0x5c, 0x73, 0x5b, 0x72, 0x5b, 0x72,
-  0x59, 0x72, 0x58, 0x72, 0x56, 0x72, 0x53, 0x72, 0x53, 0x72, 0x53, 0x72,
-  0x53, 0x72, 0x53, 0x72, 0x55, 0x73, 0x56, 0x73, 0x55, 0x73, 0x57, 0x73,
-  0x59, 0x72, 0x5b, 0x72, 0x5c, 0x72, 0x5e, 0x76, 0x5f, 0x77, 0x62, 0x78,
-  0x64, 0x7b, 0x65, 0x7b, 0x64, 0x7b, 0x64, 0x7a, 0x65, 0x7a, 0x63, 0x77,
-  0x60, 0x78, 0x5f, 0x79, 0x60, 0x79, 0x5f, 0x78, 0x5c, 0x77, 0x5d, 0x77,
-  0x5d, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5c, 0x78, 0x5c, 0x77,
-  0x5a, 0x77, 0x5a, 0x76, 0x58, 0x76, 0x58, 0x76, 0x57, 0x75, 0x57, 0x75,
-  0x5c, 0x75, 0x66, 0x74, 0x6e, 0x70, 0x75, 0x70, 0x7a, 0x6f, 0x7a, 0x70,
-  0x7a, 0x6e, 0x7a, 0x6e, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x71,
-  0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x71,
-  0x7a, 0x70, 0x7d, 0x6f, 0x7d, 0x71, 0x7d, 0x71, 0x7c, 0x74, 0x7e, 0x7d,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7b, 0x6f, 0x7c, 0x6f, 0x7e, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7e, 0x70, 0x7d, 0x6f, 0x7d, 0x6f, 0x7b, 0x6c, 0x6e, 0x69, 0x57, 0x65,
-  0x41, 0x63, 0x35, 0x62, 0x35, 0x60, 0x36, 0x60, 0x37, 0x61, 0x38, 0x60,
-  0x39, 0x60, 0x39, 0x61, 0x3a, 0x60, 0x3a, 0x61, 0x3b, 0x61, 0x3c, 0x60,
-  0x3d, 0x60, 0x3e, 0x60, 0x3f, 0x60, 0x3f, 0x60, 0x41, 0x60, 0x40, 0x60,
-  0x40, 0x62, 0x3f, 0x63, 0x3e, 0x64, 0x3f, 0x66, 0x45, 0x67, 0x47, 0x69,
-  0x4b, 0x69, 0x4d, 0x6c, 0x50, 0x6d, 0x4f, 0x6d, 0x4d, 0x6b, 0x47, 0x6a,
-  0x44, 0x6a, 0x44, 0x67, 0x44, 0x65, 0x44, 0x65, 0x43, 0x65, 0x43, 0x65,
-  0x42, 0x65, 0x41, 0x66, 0x41, 0x66, 0x41, 0x65, 0x41, 0x65, 0x42, 0x64,
-  0x3f, 0x63, 0x3f, 0x62, 0x3d, 0x64, 0x3b, 0x66, 0x3d, 0x65, 0x3f, 0x67,
-  0x40, 0x68, 0x43, 0x68, 0x47, 0x68, 0x49, 0x68, 0x50, 0x6b, 0x55, 0x6e,
-  0x58, 0x70, 0x5c, 0x70, 0x5e, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5c, 0x70,
-  0x5b, 0x70, 0x5b, 0x70, 0x5c, 0x72, 0x5d, 0x73, 0x5d, 0x73, 0x5d, 0x73,
-  0x5d, 0x73, 0x5c, 0x73, 0x5b, 0x72, 0x5b, 0x72, 0x59, 0x72, 0x58, 0x72,
-  0x56, 0x72, 0x53, 0x72, 0x53, 0x72, 0x53, 0x72, 0x53, 0x72, 0x53, 0x72,
-  0x54, 0x73, 0x55, 0x73, 0x54, 0x73, 0x56, 0x73, 0x58, 0x73, 0x5b, 0x72,
-  0x5c, 0x72, 0x5e, 0x76, 0x5f, 0x76, 0x62, 0x78, 0x64, 0x7b, 0x65, 0x7b,
-  0x64, 0x7b, 0x65, 0x7a, 0x65, 0x7a, 0x63, 0x77, 0x60, 0x77, 0x5f, 0x78,
-  0x60, 0x78, 0x60, 0x77, 0x5c, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x5c, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77,
-  0x59, 0x75, 0x58, 0x75, 0x59, 0x75, 0x58, 0x75, 0x5e, 0x74, 0x67, 0x74,
-  0x6f, 0x71, 0x77, 0x70, 0x7a, 0x70, 0x7a, 0x6f, 0x7a, 0x6e, 0x7a, 0x6e,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7b, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7c, 0x6f,
-  0x7d, 0x71, 0x7d, 0x71, 0x7c, 0x74, 0x7e, 0x7d, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x80, 0x80, 0x7f, 0x80, 0x79, 0x6f, 0x79, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7d, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7d, 0x70, 0x7c, 0x6f,
-  0x7b, 0x6e, 0x79, 0x6b, 0x6c, 0x68, 0x54, 0x65, 0x40, 0x63, 0x35, 0x62,
-  0x35, 0x60, 0x36, 0x60, 0x38, 0x60, 0x39, 0x5f, 0x38, 0x60, 0x39, 0x62,
-  0x39, 0x62, 0x3a, 0x61, 0x3a, 0x62, 0x3c, 0x62, 0x3d, 0x62, 0x3e, 0x63,
-  0x3f, 0x62, 0x3f, 0x62, 0x40, 0x62, 0x40, 0x62, 0x3f, 0x64, 0x3e, 0x65,
-  0x40, 0x66, 0x46, 0x68, 0x4b, 0x69, 0x4d, 0x6b, 0x4f, 0x6c, 0x51, 0x6d,
-  0x52, 0x6e, 0x51, 0x6e, 0x4e, 0x6c, 0x49, 0x6a, 0x44, 0x6a, 0x43, 0x67,
-  0x43, 0x65, 0x43, 0x65, 0x43, 0x65, 0x43, 0x66, 0x42, 0x65, 0x42, 0x65,
-  0x41, 0x65, 0x42, 0x64, 0x41, 0x64, 0x41, 0x63, 0x3f, 0x63, 0x3f, 0x62,
-  0x3d, 0x64, 0x3b, 0x66, 0x3e, 0x65, 0x41, 0x66, 0x43, 0x67, 0x46, 0x69,
-  0x49, 0x6a, 0x4b, 0x6a, 0x52, 0x6b, 0x57, 0x6e, 0x59, 0x71, 0x5c, 0x71,
-  0x5d, 0x70, 0x5b, 0x70, 0x5b, 0x71, 0x5b, 0x71, 0x5b, 0x71, 0x5c, 0x71,
-  0x5c, 0x72, 0x5c, 0x73, 0x5d, 0x73, 0x5d, 0x73, 0x5d, 0x73, 0x5c, 0x73,
-  0x5b, 0x73, 0x5b, 0x73, 0x59, 0x72, 0x58, 0x72, 0x57, 0x72, 0x54, 0x72,
-  0x53, 0x72, 0x53, 0x72, 0x53, 0x72, 0x52, 0x72, 0x53, 0x72, 0x53, 0x72,
-  0x53, 0x73, 0x54, 0x73, 0x57, 0x73, 0x5b, 0x72, 0x5b, 0x73, 0x5e, 0x75,
-  0x5f, 0x76, 0x61, 0x77, 0x64, 0x7a, 0x64, 0x7b, 0x65, 0x7b, 0x64, 0x7a,
-  0x64, 0x7a, 0x63, 0x78, 0x61, 0x78, 0x5f, 0x77, 0x60, 0x78, 0x60, 0x78,
-  0x5d, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x5c, 0x78, 0x5b, 0x77, 0x5a, 0x77,
-  0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x58, 0x76, 0x58, 0x76,
-  0x59, 0x75, 0x5b, 0x75, 0x60, 0x74, 0x6a, 0x73, 0x72, 0x70, 0x78, 0x70,
-  0x79, 0x6f, 0x79, 0x6f, 0x7a, 0x6e, 0x7a, 0x6e, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x71,
-  0x7b, 0x71, 0x7b, 0x71, 0x7b, 0x71, 0x7c, 0x6f, 0x7c, 0x71, 0x7c, 0x70,
-  0x7c, 0x74, 0x7e, 0x7d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x78, 0x6f, 0x79, 0x6f, 0x79, 0x6f, 0x7c, 0x6f, 0x7e, 0x6f, 0x7e, 0x6f,
-  0x7f, 0x6f, 0x7e, 0x6f, 0x7c, 0x70, 0x7b, 0x6f, 0x78, 0x6d, 0x76, 0x6b,
-  0x69, 0x66, 0x52, 0x63, 0x3f, 0x63, 0x35, 0x62, 0x35, 0x60, 0x36, 0x60,
-  0x38, 0x60, 0x38, 0x5f, 0x39, 0x60, 0x39, 0x63, 0x39, 0x62, 0x39, 0x63,
-  0x3a, 0x64, 0x3a, 0x65, 0x3b, 0x65, 0x3d, 0x65, 0x3e, 0x64, 0x3e, 0x64,
-  0x3f, 0x64, 0x3f, 0x64, 0x3d, 0x65, 0x3f, 0x68, 0x44, 0x68, 0x4c, 0x6a,
-  0x50, 0x6c, 0x50, 0x6c, 0x51, 0x6d, 0x52, 0x6d, 0x53, 0x6e, 0x51, 0x6e,
-  0x4f, 0x6d, 0x4a, 0x6b, 0x45, 0x69, 0x42, 0x68, 0x42, 0x67, 0x42, 0x66,
-  0x42, 0x67, 0x41, 0x67, 0x41, 0x68, 0x42, 0x66, 0x42, 0x64, 0x42, 0x64,
-  0x41, 0x62, 0x40, 0x62, 0x3f, 0x62, 0x3e, 0x62, 0x3c, 0x65, 0x3b, 0x66,
-  0x3e, 0x66, 0x43, 0x65, 0x46, 0x67, 0x47, 0x69, 0x49, 0x6b, 0x4d, 0x6b,
-  0x51, 0x6b, 0x56, 0x6e, 0x5a, 0x72, 0x5c, 0x72, 0x5c, 0x72, 0x5b, 0x72,
-  0x5a, 0x70, 0x59, 0x70, 0x5b, 0x71, 0x5c, 0x72, 0x5b, 0x72, 0x5b, 0x72,
-  0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x71, 0x5b, 0x73, 0x5b, 0x73, 0x5c, 0x72,
-  0x59, 0x71, 0x58, 0x72, 0x57, 0x72, 0x54, 0x72, 0x53, 0x72, 0x53, 0x72,
-  0x53, 0x72, 0x51, 0x72, 0x52, 0x72, 0x53, 0x72, 0x52, 0x72, 0x54, 0x72,
-  0x57, 0x73, 0x59, 0x72, 0x5c, 0x74, 0x5e, 0x75, 0x5f, 0x77, 0x60, 0x78,
-  0x63, 0x78, 0x64, 0x7a, 0x64, 0x7a, 0x63, 0x7a, 0x63, 0x7a, 0x62, 0x7a,
-  0x62, 0x7a, 0x60, 0x77, 0x60, 0x78, 0x60, 0x78, 0x60, 0x78, 0x5e, 0x78,
-  0x5d, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77,
-  0x5a, 0x77, 0x59, 0x77, 0x58, 0x77, 0x58, 0x77, 0x5a, 0x76, 0x5e, 0x75,
-  0x64, 0x75, 0x6d, 0x71, 0x75, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x70, 0x7a, 0x72, 0x7a, 0x72, 0x7b, 0x72, 0x7b, 0x73, 0x7b, 0x73,
-  0x7b, 0x72, 0x7b, 0x71, 0x7b, 0x70, 0x7c, 0x70, 0x7c, 0x74, 0x7e, 0x7c,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x77, 0x6f, 0x77, 0x6f,
-  0x78, 0x6f, 0x7b, 0x6f, 0x7c, 0x6f, 0x7c, 0x6f, 0x7d, 0x6e, 0x7b, 0x6e,
-  0x79, 0x6e, 0x78, 0x6d, 0x76, 0x6b, 0x74, 0x6a, 0x67, 0x65, 0x50, 0x63,
-  0x3e, 0x63, 0x36, 0x63, 0x36, 0x60, 0x37, 0x60, 0x38, 0x60, 0x38, 0x60,
-  0x39, 0x62, 0x39, 0x64, 0x38, 0x64, 0x38, 0x65, 0x38, 0x66, 0x39, 0x66,
-  0x39, 0x67, 0x3b, 0x67, 0x3d, 0x65, 0x3d, 0x65, 0x3d, 0x65, 0x3d, 0x65,
-  0x3e, 0x67, 0x44, 0x69, 0x4b, 0x6a, 0x50, 0x6c, 0x53, 0x6d, 0x53, 0x6d,
-  0x53, 0x6e, 0x53, 0x6f, 0x53, 0x6e, 0x51, 0x6e, 0x4f, 0x6d, 0x4a, 0x6b,
-  0x46, 0x69, 0x42, 0x68, 0x41, 0x68, 0x42, 0x68, 0x41, 0x68, 0x41, 0x67,
-  0x41, 0x68, 0x42, 0x67, 0x42, 0x65, 0x42, 0x64, 0x41, 0x62, 0x40, 0x61,
-  0x3f, 0x62, 0x3e, 0x62, 0x3c, 0x64, 0x3c, 0x66, 0x3f, 0x66, 0x44, 0x66,
-  0x45, 0x67, 0x47, 0x69, 0x4a, 0x6a, 0x4e, 0x6c, 0x52, 0x6c, 0x57, 0x6f,
-  0x5a, 0x72, 0x5c, 0x72, 0x5b, 0x72, 0x5b, 0x72, 0x5a, 0x70, 0x5a, 0x70,
-  0x5b, 0x72, 0x5c, 0x73, 0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x72,
-  0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x73, 0x5c, 0x72, 0x5a, 0x72, 0x57, 0x72,
-  0x56, 0x72, 0x54, 0x72, 0x53, 0x72, 0x53, 0x72, 0x53, 0x72, 0x51, 0x72,
-  0x51, 0x72, 0x50, 0x72, 0x50, 0x72, 0x52, 0x72, 0x55, 0x72, 0x58, 0x72,
-  0x5a, 0x74, 0x5d, 0x75, 0x5f, 0x77, 0x60, 0x78, 0x63, 0x79, 0x64, 0x7a,
-  0x63, 0x7a, 0x63, 0x7a, 0x63, 0x7a, 0x62, 0x79, 0x62, 0x7a, 0x60, 0x77,
-  0x60, 0x78, 0x60, 0x78, 0x60, 0x78, 0x5e, 0x77, 0x5c, 0x77, 0x5b, 0x77,
-  0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5b, 0x77, 0x5a, 0x77,
-  0x59, 0x77, 0x59, 0x77, 0x5d, 0x75, 0x62, 0x75, 0x67, 0x75, 0x70, 0x72,
-  0x75, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x79, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x72,
-  0x7a, 0x72, 0x7a, 0x72, 0x7b, 0x73, 0x7b, 0x73, 0x7b, 0x72, 0x7a, 0x71,
-  0x7b, 0x70, 0x7c, 0x70, 0x7c, 0x74, 0x7e, 0x7d, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x75, 0x6f, 0x75, 0x6f, 0x76, 0x6f, 0x79, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6d, 0x78, 0x6c, 0x75, 0x6c, 0x74, 0x6b,
-  0x71, 0x69, 0x6f, 0x67, 0x63, 0x64, 0x4e, 0x63, 0x3d, 0x63, 0x36, 0x62,
-  0x36, 0x60, 0x37, 0x60, 0x38, 0x60, 0x38, 0x61, 0x39, 0x64, 0x38, 0x66,
-  0x39, 0x66, 0x37, 0x66, 0x37, 0x67, 0x38, 0x68, 0x38, 0x69, 0x3a, 0x69,
-  0x3b, 0x66, 0x3c, 0x67, 0x3c, 0x67, 0x3c, 0x67, 0x40, 0x69, 0x4a, 0x6b,
-  0x52, 0x6c, 0x54, 0x6e, 0x57, 0x6f, 0x57, 0x6f, 0x55, 0x70, 0x55, 0x70,
-  0x54, 0x6f, 0x52, 0x6e, 0x4f, 0x6d, 0x4a, 0x6b, 0x46, 0x69, 0x43, 0x68,
-  0x41, 0x69, 0x40, 0x6a, 0x41, 0x6a, 0x41, 0x67, 0x40, 0x68, 0x42, 0x68,
-  0x42, 0x65, 0x41, 0x64, 0x41, 0x63, 0x3f, 0x62, 0x3e, 0x62, 0x3d, 0x62,
-  0x3c, 0x64, 0x3c, 0x66, 0x42, 0x66, 0x45, 0x66, 0x45, 0x68, 0x47, 0x69,
-  0x4c, 0x6a, 0x50, 0x6c, 0x55, 0x6e, 0x59, 0x71, 0x5a, 0x72, 0x5c, 0x72,
-  0x5b, 0x72, 0x5b, 0x72, 0x5a, 0x70, 0x5a, 0x70, 0x5b, 0x72, 0x5b, 0x72,
-  0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x72, 0x5b, 0x72, 0x5c, 0x72,
-  0x5c, 0x73, 0x5c, 0x72, 0x5a, 0x72, 0x57, 0x72, 0x56, 0x72, 0x54, 0x71,
-  0x53, 0x72, 0x53, 0x72, 0x54, 0x72, 0x51, 0x72, 0x4f, 0x72, 0x4f, 0x72,
-  0x4f, 0x72, 0x51, 0x72, 0x53, 0x72, 0x56, 0x72, 0x58, 0x74, 0x5b, 0x75,
-  0x5f, 0x76, 0x61, 0x78, 0x63, 0x79, 0x64, 0x7a, 0x63, 0x7a, 0x63, 0x7a,
-  0x63, 0x7a, 0x62, 0x79, 0x62, 0x7a, 0x60, 0x78, 0x60, 0x78, 0x60, 0x78,
-  0x5f, 0x78, 0x5e, 0x78, 0x5c, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77,
-  0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5b, 0x77, 0x5c, 0x77,
-  0x61, 0x76, 0x66, 0x76, 0x6b, 0x75, 0x73, 0x72, 0x76, 0x6f, 0x78, 0x6f,
-  0x79, 0x6e, 0x78, 0x6f, 0x79, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x72, 0x7a, 0x72, 0x7a, 0x72,
-  0x7b, 0x72, 0x7a, 0x72, 0x7a, 0x73, 0x7b, 0x71, 0x7b, 0x70, 0x7c, 0x70,
-  0x7c, 0x73, 0x7e, 0x7d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x74, 0x6e, 0x73, 0x6e, 0x75, 0x6f, 0x77, 0x6f, 0x79, 0x6f, 0x78, 0x6f,
-  0x77, 0x6d, 0x75, 0x6b, 0x73, 0x6a, 0x71, 0x6a, 0x6e, 0x67, 0x6c, 0x66,
-  0x61, 0x63, 0x4a, 0x62, 0x3c, 0x61, 0x36, 0x62, 0x35, 0x63, 0x36, 0x61,
-  0x37, 0x61, 0x38, 0x63, 0x39, 0x65, 0x38, 0x64, 0x37, 0x66, 0x37, 0x68,
-  0x36, 0x69, 0x37, 0x69, 0x38, 0x69, 0x39, 0x69, 0x3a, 0x68, 0x3a, 0x69,
-  0x3c, 0x69, 0x3f, 0x68, 0x45, 0x6a, 0x4d, 0x6d, 0x53, 0x6e, 0x55, 0x6f,
-  0x57, 0x70, 0x58, 0x70, 0x56, 0x70, 0x56, 0x70, 0x54, 0x70, 0x51, 0x6d,
-  0x50, 0x6d, 0x4b, 0x6a, 0x46, 0x68, 0x44, 0x69, 0x41, 0x69, 0x40, 0x69,
-  0x41, 0x69, 0x41, 0x68, 0x41, 0x68, 0x42, 0x67, 0x41, 0x65, 0x41, 0x63,
-  0x40, 0x63, 0x3f, 0x62, 0x3d, 0x63, 0x3d, 0x63, 0x3b, 0x65, 0x3d, 0x67,
-  0x42, 0x67, 0x46, 0x67, 0x46, 0x68, 0x49, 0x69, 0x4c, 0x6c, 0x51, 0x6d,
-  0x56, 0x6f, 0x59, 0x72, 0x5b, 0x72, 0x5c, 0x72, 0x5b, 0x72, 0x5a, 0x72,
-  0x59, 0x70, 0x59, 0x70, 0x5a, 0x71, 0x5b, 0x70, 0x5b, 0x71, 0x5c, 0x70,
-  0x5b, 0x71, 0x5a, 0x72, 0x5a, 0x72, 0x5b, 0x72, 0x5c, 0x72, 0x5b, 0x72,
-  0x5a, 0x72, 0x59, 0x72, 0x57, 0x72, 0x56, 0x72, 0x54, 0x72, 0x54, 0x72,
-  0x54, 0x72, 0x50, 0x72, 0x4f, 0x70, 0x50, 0x71, 0x4f, 0x72, 0x52, 0x72,
-  0x54, 0x73, 0x57, 0x72, 0x59, 0x73, 0x5b, 0x75, 0x5e, 0x76, 0x60, 0x77,
-  0x62, 0x78, 0x61, 0x79, 0x62, 0x79, 0x63, 0x7a, 0x62, 0x7a, 0x62, 0x79,
-  0x62, 0x7a, 0x60, 0x78, 0x5f, 0x78, 0x5f, 0x78, 0x60, 0x78, 0x5e, 0x78,
-  0x5c, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x59, 0x77, 0x59, 0x77,
-  0x59, 0x78, 0x5b, 0x77, 0x5d, 0x76, 0x5e, 0x76, 0x63, 0x76, 0x68, 0x74,
-  0x6d, 0x73, 0x75, 0x71, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6e, 0x78, 0x6e,
-  0x79, 0x6f, 0x79, 0x70, 0x78, 0x70, 0x79, 0x6f, 0x79, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x71, 0x7a, 0x71, 0x7b, 0x71, 0x7b, 0x71, 0x7b, 0x72,
-  0x7b, 0x72, 0x7b, 0x70, 0x7b, 0x70, 0x7c, 0x70, 0x7c, 0x74, 0x7e, 0x7c,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x72, 0x6d, 0x72, 0x6e,
-  0x74, 0x6e, 0x75, 0x6e, 0x76, 0x6d, 0x73, 0x6d, 0x72, 0x6b, 0x70, 0x68,
-  0x6d, 0x67, 0x6b, 0x65, 0x68, 0x63, 0x68, 0x63, 0x5d, 0x61, 0x46, 0x5f,
-  0x3c, 0x5f, 0x37, 0x62, 0x35, 0x64, 0x36, 0x63, 0x37, 0x63, 0x38, 0x65,
-  0x39, 0x66, 0x38, 0x64, 0x37, 0x67, 0x36, 0x6a, 0x37, 0x6b, 0x39, 0x6a,
-  0x3b, 0x6b, 0x3a, 0x6b, 0x38, 0x6a, 0x39, 0x6a, 0x3c, 0x6a, 0x43, 0x6a,
-  0x4a, 0x6c, 0x50, 0x6f, 0x54, 0x70, 0x56, 0x70, 0x57, 0x70, 0x57, 0x70,
-  0x56, 0x70, 0x56, 0x70, 0x54, 0x70, 0x51, 0x6d, 0x50, 0x6c, 0x4a, 0x69,
-  0x45, 0x68, 0x44, 0x6a, 0x42, 0x69, 0x42, 0x68, 0x41, 0x68, 0x41, 0x68,
-  0x41, 0x68, 0x41, 0x65, 0x41, 0x63, 0x41, 0x62, 0x40, 0x62, 0x3e, 0x63,
-  0x3c, 0x63, 0x3c, 0x63, 0x3b, 0x66, 0x3e, 0x68, 0x42, 0x68, 0x47, 0x68,
-  0x49, 0x68, 0x4b, 0x68, 0x4e, 0x6c, 0x52, 0x6d, 0x57, 0x6f, 0x59, 0x72,
-  0x5b, 0x73, 0x5c, 0x72, 0x5a, 0x72, 0x5a, 0x72, 0x59, 0x70, 0x58, 0x70,
-  0x59, 0x71, 0x59, 0x71, 0x59, 0x70, 0x5a, 0x70, 0x5a, 0x71, 0x5b, 0x73,
-  0x5a, 0x72, 0x5b, 0x72, 0x5b, 0x72, 0x5a, 0x72, 0x5b, 0x72, 0x5a, 0x72,
-  0x58, 0x72, 0x57, 0x73, 0x55, 0x72, 0x55, 0x72, 0x53, 0x72, 0x50, 0x72,
-  0x50, 0x70, 0x50, 0x70, 0x4e, 0x72, 0x50, 0x73, 0x54, 0x72, 0x57, 0x72,
-  0x59, 0x73, 0x5c, 0x75, 0x5c, 0x77, 0x5f, 0x77, 0x60, 0x77, 0x60, 0x77,
-  0x61, 0x78, 0x62, 0x7a, 0x62, 0x7a, 0x62, 0x7a, 0x62, 0x79, 0x60, 0x78,
-  0x5e, 0x78, 0x5e, 0x78, 0x5e, 0x78, 0x5e, 0x78, 0x5d, 0x78, 0x5b, 0x78,
-  0x5b, 0x77, 0x59, 0x77, 0x58, 0x77, 0x58, 0x77, 0x5a, 0x77, 0x5d, 0x77,
-  0x5f, 0x75, 0x61, 0x75, 0x67, 0x74, 0x6c, 0x72, 0x71, 0x71, 0x76, 0x6f,
-  0x78, 0x6f, 0x77, 0x6f, 0x77, 0x6e, 0x77, 0x6e, 0x78, 0x6f, 0x78, 0x6f,
-  0x78, 0x6f, 0x78, 0x6f, 0x79, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7b, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x71, 0x7b, 0x72, 0x7b, 0x73, 0x7b, 0x70,
-  0x7b, 0x70, 0x7c, 0x71, 0x7d, 0x75, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x70, 0x6e, 0x70, 0x6d, 0x73, 0x6c, 0x73, 0x6c,
-  0x73, 0x6b, 0x71, 0x6b, 0x6e, 0x69, 0x6b, 0x67, 0x68, 0x64, 0x66, 0x62,
-  0x63, 0x60, 0x61, 0x5f, 0x55, 0x5d, 0x43, 0x5d, 0x3d, 0x5d, 0x39, 0x62,
-  0x37, 0x64, 0x36, 0x64, 0x37, 0x64, 0x38, 0x65, 0x39, 0x65, 0x38, 0x65,
-  0x37, 0x68, 0x36, 0x6b, 0x38, 0x6c, 0x3e, 0x6c, 0x3e, 0x6c, 0x3d, 0x6c,
-  0x3b, 0x6c, 0x3b, 0x6c, 0x42, 0x6c, 0x49, 0x6c, 0x4d, 0x6d, 0x53, 0x71,
-  0x56, 0x72, 0x58, 0x71, 0x58, 0x70, 0x57, 0x70, 0x56, 0x70, 0x56, 0x70,
-  0x54, 0x70, 0x52, 0x6d, 0x50, 0x6c, 0x49, 0x69, 0x43, 0x69, 0x43, 0x6a,
-  0x42, 0x6a, 0x44, 0x68, 0x43, 0x68, 0x41, 0x68, 0x41, 0x68, 0x41, 0x64,
-  0x41, 0x61, 0x40, 0x60, 0x40, 0x60, 0x3f, 0x62, 0x3c, 0x63, 0x3b, 0x62,
-  0x3c, 0x66, 0x40, 0x68, 0x42, 0x68, 0x48, 0x67, 0x4b, 0x68, 0x4d, 0x68,
-  0x50, 0x6b, 0x54, 0x6d, 0x57, 0x6e, 0x59, 0x72, 0x5b, 0x73, 0x5b, 0x72,
-  0x5b, 0x72, 0x5a, 0x72, 0x59, 0x71, 0x58, 0x71, 0x57, 0x71, 0x57, 0x71,
-  0x58, 0x70, 0x58, 0x71, 0x59, 0x71, 0x5b, 0x73, 0x5b, 0x73, 0x5b, 0x73,
-  0x5c, 0x73, 0x5a, 0x72, 0x5a, 0x72, 0x59, 0x72, 0x57, 0x72, 0x57, 0x73,
-  0x55, 0x72, 0x55, 0x72, 0x53, 0x72, 0x50, 0x72, 0x50, 0x70, 0x50, 0x70,
-  0x4d, 0x72, 0x4f, 0x72, 0x53, 0x72, 0x57, 0x72, 0x59, 0x73, 0x5c, 0x75,
-  0x5c, 0x77, 0x5f, 0x77, 0x61, 0x77, 0x60, 0x78, 0x61, 0x78, 0x62, 0x7a,
-  0x62, 0x7a, 0x62, 0x7a, 0x62, 0x79, 0x60, 0x78, 0x5e, 0x78, 0x5d, 0x78,
-  0x5c, 0x78, 0x5d, 0x78, 0x5d, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x59, 0x76,
-  0x58, 0x77, 0x59, 0x77, 0x5c, 0x78, 0x5e, 0x77, 0x61, 0x75, 0x63, 0x76,
-  0x6a, 0x73, 0x6f, 0x70, 0x75, 0x70, 0x76, 0x6d, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6e, 0x77, 0x6e, 0x78, 0x6e, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f,
-  0x79, 0x6f, 0x7a, 0x6e, 0x7a, 0x6f, 0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x70,
-  0x7b, 0x70, 0x7b, 0x72, 0x7b, 0x72, 0x7b, 0x71, 0x7a, 0x70, 0x7c, 0x71,
-  0x7c, 0x75, 0x7e, 0x7c, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x6f, 0x6d, 0x6f, 0x6d, 0x71, 0x6d, 0x70, 0x6b, 0x70, 0x6a, 0x6e, 0x68,
-  0x6a, 0x67, 0x67, 0x65, 0x63, 0x62, 0x61, 0x5f, 0x5a, 0x5e, 0x56, 0x5d,
-  0x4d, 0x5c, 0x43, 0x5c, 0x3f, 0x5c, 0x3a, 0x62, 0x37, 0x65, 0x36, 0x65,
-  0x37, 0x65, 0x37, 0x65, 0x38, 0x66, 0x37, 0x68, 0x37, 0x6a, 0x37, 0x6c,
-  0x3a, 0x6d, 0x40, 0x6d, 0x41, 0x6d, 0x42, 0x6c, 0x41, 0x6c, 0x42, 0x6d,
-  0x48, 0x6e, 0x4e, 0x6e, 0x51, 0x70, 0x55, 0x71, 0x58, 0x72, 0x58, 0x71,
-  0x58, 0x71, 0x57, 0x71, 0x56, 0x70, 0x56, 0x70, 0x54, 0x6f, 0x51, 0x6d,
-  0x4d, 0x6b, 0x46, 0x6a, 0x45, 0x6a, 0x44, 0x6a, 0x44, 0x6a, 0x45, 0x69,
-  0x42, 0x6a, 0x40, 0x69, 0x41, 0x68, 0x41, 0x64, 0x41, 0x62, 0x40, 0x61,
-  0x3f, 0x61, 0x3d, 0x62, 0x3c, 0x64, 0x3b, 0x65, 0x3d, 0x67, 0x41, 0x68,
-  0x44, 0x68, 0x49, 0x69, 0x4b, 0x69, 0x4d, 0x6a, 0x50, 0x6c, 0x54, 0x6e,
-  0x57, 0x6f, 0x59, 0x71, 0x5b, 0x72, 0x5b, 0x72, 0x5a, 0x72, 0x59, 0x72,
-  0x57, 0x71, 0x57, 0x71, 0x57, 0x70, 0x56, 0x70, 0x56, 0x70, 0x56, 0x70,
-  0x57, 0x70, 0x58, 0x71, 0x59, 0x72, 0x5a, 0x71, 0x5b, 0x71, 0x5a, 0x71,
-  0x5b, 0x72, 0x59, 0x72, 0x57, 0x72, 0x58, 0x72, 0x57, 0x72, 0x56, 0x72,
-  0x54, 0x72, 0x51, 0x72, 0x50, 0x70, 0x50, 0x70, 0x4d, 0x72, 0x4e, 0x72,
-  0x51, 0x72, 0x55, 0x72, 0x57, 0x73, 0x5a, 0x75, 0x5c, 0x77, 0x5e, 0x77,
-  0x60, 0x78, 0x60, 0x78, 0x62, 0x79, 0x62, 0x79, 0x63, 0x79, 0x62, 0x7a,
-  0x62, 0x7a, 0x60, 0x78, 0x5d, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5c, 0x78,
-  0x5d, 0x78, 0x5c, 0x77, 0x5c, 0x77, 0x5a, 0x77, 0x59, 0x77, 0x5a, 0x77,
-  0x5c, 0x76, 0x5e, 0x76, 0x63, 0x76, 0x66, 0x75, 0x6e, 0x71, 0x71, 0x70,
-  0x76, 0x6f, 0x76, 0x6e, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x71,
-  0x7a, 0x71, 0x7b, 0x70, 0x7a, 0x72, 0x7b, 0x73, 0x7b, 0x75, 0x7d, 0x7c,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-  0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x6d, 0x6d, 0x6d, 0x6d,
-  0x6e, 0x6d, 0x6c, 0x6a, 0x6b, 0x68, 0x69, 0x65, 0x65, 0x63, 0x60, 0x61,
-  0x5c, 0x5f, 0x57, 0x5d, 0x4e, 0x5a, 0x4c, 0x58, 0x4b, 0x59, 0x45, 0x5a,
-  0x41, 0x5b, 0x3c, 0x61, 0x38, 0x67, 0x36, 0x67, 0x36, 0x67, 0x36, 0x67,
-  0x37, 0x68, 0x37, 0x6b, 0x38, 0x6b, 0x3a, 0x6d, 0x3e, 0x6e, 0x41, 0x6d,
-  0x44, 0x6e, 0x45, 0x6d, 0x47, 0x6e, 0x49, 0x70, 0x4d, 0x70, 0x51, 0x70,
-  0x54, 0x72, 0x57, 0x72, 0x59, 0x72, 0x58, 0x72, 0x58, 0x72, 0x59, 0x72,
-  0x57, 0x70, 0x56, 0x71, 0x53, 0x6f, 0x4f, 0x6d, 0x4b, 0x6b, 0x44, 0x6a,
-  0x47, 0x6b, 0x45, 0x6a, 0x46, 0x6a, 0x45, 0x6a, 0x42, 0x6a, 0x40, 0x69,
-  0x41, 0x66, 0x40, 0x63, 0x40, 0x61, 0x3e, 0x62, 0x3e, 0x62, 0x3c, 0x62,
-  0x3b, 0x65, 0x3a, 0x66, 0x3d, 0x67, 0x41, 0x68, 0x45, 0x68, 0x49, 0x69,
-  0x4a, 0x6a, 0x4d, 0x6b, 0x50, 0x6e, 0x54, 0x6f, 0x56, 0x71, 0x59, 0x70,
-  0x5a, 0x72, 0x5b, 0x72, 0x5a, 0x72, 0x57, 0x72, 0x56, 0x71, 0x56, 0x70,
-  0x56, 0x70, 0x56, 0x70, 0x56, 0x70, 0x55, 0x70, 0x55, 0x70, 0x56, 0x70,
-  0x57, 0x70, 0x59, 0x70, 0x5a, 0x70, 0x5a, 0x71, 0x5b, 0x72, 0x5a, 0x72,
-  0x58, 0x72, 0x58, 0x72, 0x59, 0x73, 0x56, 0x72, 0x55, 0x72, 0x52, 0x72,
-  0x50, 0x70, 0x50, 0x70, 0x4e, 0x72, 0x4d, 0x72, 0x50, 0x72, 0x54, 0x73,
-  0x56, 0x74, 0x59, 0x76, 0x5b, 0x77, 0x5d, 0x77, 0x5e, 0x77, 0x5f, 0x78,
-  0x62, 0x79, 0x62, 0x78, 0x62, 0x78, 0x63, 0x7a, 0x63, 0x7a, 0x60, 0x78,
-  0x5e, 0x78, 0x5b, 0x77, 0x5b, 0x76, 0x5c, 0x77, 0x5c, 0x78, 0x5b, 0x78,
-  0x5b, 0x77, 0x5b, 0x78, 0x5a, 0x77, 0x5b, 0x76, 0x5e, 0x75, 0x62, 0x76,
-  0x67, 0x75, 0x6b, 0x73, 0x72, 0x71, 0x74, 0x70, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x71, 0x77, 0x71, 0x77, 0x70, 0x77, 0x6f,
-  0x77, 0x6f, 0x78, 0x6e, 0x79, 0x6f, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x70,
-  0x7a, 0x72, 0x7a, 0x74, 0x7a, 0x74, 0x7d, 0x7b, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x6b, 0x6d, 0x6c, 0x6d, 0x6c, 0x6c, 0x69, 0x69,
-  0x67, 0x67, 0x64, 0x65, 0x60, 0x61, 0x5b, 0x5e, 0x53, 0x5c, 0x4d, 0x5c,
-  0x4b, 0x57, 0x4c, 0x54, 0x4c, 0x54, 0x47, 0x55, 0x43, 0x59, 0x3d, 0x61,
-  0x39, 0x66, 0x37, 0x69, 0x36, 0x69, 0x36, 0x69, 0x36, 0x69, 0x36, 0x6a,
-  0x39, 0x6a, 0x3d, 0x6d, 0x41, 0x6e, 0x44, 0x6d, 0x45, 0x6d, 0x47, 0x6e,
-  0x4b, 0x6f, 0x4d, 0x71, 0x50, 0x71, 0x54, 0x71, 0x55, 0x73, 0x58, 0x73,
-  0x59, 0x74, 0x59, 0x74, 0x58, 0x72, 0x59, 0x72, 0x57, 0x70, 0x56, 0x70,
-  0x53, 0x70, 0x4e, 0x6d, 0x49, 0x6b, 0x44, 0x6b, 0x47, 0x6b, 0x47, 0x6a,
-  0x46, 0x6a, 0x44, 0x69, 0x42, 0x6a, 0x40, 0x68, 0x41, 0x65, 0x40, 0x62,
-  0x40, 0x60, 0x3e, 0x61, 0x3e, 0x62, 0x3c, 0x61, 0x3a, 0x64, 0x3a, 0x66,
-  0x3d, 0x67, 0x41, 0x67, 0x45, 0x68, 0x4a, 0x69, 0x4a, 0x6a, 0x4c, 0x6a,
-  0x4f, 0x6e, 0x54, 0x6f, 0x56, 0x71, 0x59, 0x70, 0x5b, 0x72, 0x5a, 0x72,
-  0x5a, 0x72, 0x57, 0x72, 0x56, 0x71, 0x56, 0x70, 0x56, 0x70, 0x56, 0x71,
-  0x56, 0x71, 0x56, 0x71, 0x56, 0x70, 0x57, 0x70, 0x57, 0x70, 0x5a, 0x70,
-  0x5b, 0x70, 0x5b, 0x71, 0x5b, 0x72, 0x5a, 0x72, 0x58, 0x72, 0x58, 0x72,
-  0x58, 0x72, 0x55, 0x72, 0x54, 0x72, 0x52, 0x72, 0x50, 0x70, 0x50, 0x70,
-  0x4e, 0x73, 0x4d, 0x72, 0x50, 0x73, 0x54, 0x73, 0x56, 0x74, 0x5a, 0x75,
-  0x5c, 0x77, 0x5e, 0x77, 0x5f, 0x78, 0x60, 0x78, 0x62, 0x78, 0x62, 0x78,
-  0x62, 0x78, 0x62, 0x7a, 0x62, 0x7a, 0x61, 0x78, 0x5e, 0x78, 0x5b, 0x77,
-  0x5b, 0x77, 0x5c, 0x78, 0x5d, 0x78, 0x5c, 0x78, 0x5b, 0x78, 0x5c, 0x78,
-  0x5b, 0x77, 0x5c, 0x76, 0x60, 0x75, 0x66, 0x76, 0x6a, 0x74, 0x6e, 0x72,
-  0x75, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f,
-  0x79, 0x6f, 0x7a, 0x70, 0x7b, 0x70, 0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x72, 0x7a, 0x74,
-  0x7a, 0x75, 0x7d, 0x7b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x6a, 0x6c, 0x68, 0x6b, 0x69, 0x69, 0x65, 0x66, 0x62, 0x64, 0x5e, 0x62,
-  0x58, 0x5f, 0x51, 0x5c, 0x49, 0x5a, 0x47, 0x59, 0x4a, 0x54, 0x4c, 0x51,
-  0x4d, 0x50, 0x4a, 0x53, 0x46, 0x56, 0x40, 0x5f, 0x3c, 0x65, 0x39, 0x68,
-  0x37, 0x6b, 0x38, 0x6b, 0x3a, 0x6a, 0x3b, 0x6b, 0x3b, 0x6b, 0x40, 0x6c,
-  0x43, 0x6d, 0x47, 0x6e, 0x48, 0x6f, 0x4b, 0x6f, 0x4f, 0x71, 0x51, 0x73,
-  0x53, 0x72, 0x56, 0x72, 0x57, 0x74, 0x59, 0x75, 0x58, 0x75, 0x58, 0x75,
-  0x58, 0x73, 0x57, 0x72, 0x56, 0x71, 0x55, 0x70, 0x51, 0x6f, 0x4d, 0x6d,
-  0x4a, 0x6b, 0x47, 0x6b, 0x48, 0x6b, 0x48, 0x6a, 0x46, 0x6b, 0x43, 0x6a,
-  0x40, 0x68, 0x40, 0x65, 0x41, 0x62, 0x40, 0x60, 0x40, 0x5f, 0x3e, 0x62,
-  0x3e, 0x62, 0x3c, 0x61, 0x3b, 0x65, 0x3b, 0x67, 0x3e, 0x67, 0x42, 0x68,
-  0x46, 0x68, 0x49, 0x6a, 0x4b, 0x6b, 0x4d, 0x6a, 0x4f, 0x6c, 0x53, 0x6f,
-  0x56, 0x71, 0x58, 0x70, 0x5a, 0x72, 0x59, 0x72, 0x59, 0x72, 0x57, 0x71,
-  0x56, 0x71, 0x56, 0x70, 0x56, 0x70, 0x56, 0x71, 0x56, 0x71, 0x55, 0x71,
-  0x55, 0x70, 0x55, 0x70, 0x57, 0x70, 0x59, 0x71, 0x59, 0x71, 0x59, 0x72,
-  0x59, 0x72, 0x59, 0x71, 0x59, 0x72, 0x58, 0x72, 0x58, 0x72, 0x56, 0x72,
-  0x55, 0x72, 0x53, 0x72, 0x50, 0x71, 0x50, 0x72, 0x4e, 0x73, 0x4d, 0x72,
-  0x50, 0x73, 0x54, 0x73, 0x56, 0x74, 0x58, 0x75, 0x5b, 0x77, 0x5d, 0x77,
-  0x5f, 0x77, 0x5f, 0x78, 0x61, 0x78, 0x62, 0x78, 0x62, 0x78, 0x62, 0x79,
-  0x62, 0x79, 0x60, 0x78, 0x5e, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5c, 0x78,
-  0x5c, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5d, 0x77, 0x5e, 0x76, 0x5f, 0x76,
-  0x65, 0x75, 0x6a, 0x75, 0x6f, 0x72, 0x73, 0x71, 0x77, 0x70, 0x78, 0x70,
-  0x78, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x79, 0x70,
-  0x79, 0x70, 0x79, 0x71, 0x79, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x74, 0x7c, 0x75, 0x7d, 0x7b,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x68, 0x6b, 0x65, 0x68,
-  0x65, 0x66, 0x60, 0x64, 0x5d, 0x62, 0x57, 0x5f, 0x50, 0x5d, 0x49, 0x5b,
-  0x46, 0x58, 0x47, 0x56, 0x49, 0x53, 0x4a, 0x50, 0x4d, 0x4f, 0x4d, 0x52,
-  0x4a, 0x54, 0x43, 0x5d, 0x3f, 0x65, 0x3b, 0x65, 0x3a, 0x6c, 0x3e, 0x6c,
-  0x3f, 0x6b, 0x40, 0x6c, 0x3e, 0x6c, 0x41, 0x6d, 0x45, 0x6e, 0x48, 0x6f,
-  0x4a, 0x71, 0x4d, 0x71, 0x50, 0x73, 0x52, 0x73, 0x55, 0x72, 0x57, 0x73,
-  0x58, 0x74, 0x58, 0x75, 0x58, 0x75, 0x59, 0x75, 0x58, 0x74, 0x56, 0x72,
-  0x55, 0x71, 0x53, 0x70, 0x50, 0x6d, 0x4c, 0x6c, 0x4a, 0x6c, 0x48, 0x6b,
-  0x49, 0x6b, 0x48, 0x6b, 0x45, 0x6b, 0x41, 0x6b, 0x3f, 0x67, 0x40, 0x63,
-  0x41, 0x60, 0x41, 0x60, 0x41, 0x61, 0x3e, 0x62, 0x3e, 0x62, 0x3d, 0x62,
-  0x3c, 0x65, 0x3b, 0x67, 0x3f, 0x68, 0x44, 0x69, 0x46, 0x68, 0x48, 0x6a,
-  0x4b, 0x6b, 0x4c, 0x6b, 0x4f, 0x6b, 0x52, 0x6e, 0x55, 0x70, 0x58, 0x70,
-  0x58, 0x72, 0x58, 0x72, 0x57, 0x71, 0x57, 0x70, 0x56, 0x70, 0x56, 0x70,
-  0x56, 0x70, 0x56, 0x71, 0x55, 0x71, 0x55, 0x70, 0x54, 0x70, 0x55, 0x70,
-  0x56, 0x70, 0x57, 0x71, 0x57, 0x72, 0x57, 0x72, 0x58, 0x72, 0x58, 0x72,
-  0x58, 0x73, 0x58, 0x73, 0x58, 0x73, 0x56, 0x72, 0x56, 0x72, 0x53, 0x72,
-  0x50, 0x73, 0x50, 0x72, 0x4d, 0x72, 0x4d, 0x72, 0x51, 0x74, 0x54, 0x73,
-  0x55, 0x73, 0x57, 0x76, 0x5a, 0x77, 0x5c, 0x77, 0x5f, 0x77, 0x5f, 0x77,
-  0x5f, 0x77, 0x60, 0x78, 0x61, 0x78, 0x61, 0x78, 0x60, 0x78, 0x5e, 0x77,
-  0x5d, 0x77, 0x5c, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77,
-  0x5b, 0x78, 0x5e, 0x76, 0x5f, 0x75, 0x63, 0x75, 0x6a, 0x74, 0x6d, 0x73,
-  0x72, 0x70, 0x76, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x71, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x78, 0x70, 0x78, 0x70, 0x77, 0x70,
-  0x78, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x71, 0x7a, 0x70, 0x7b, 0x70,
-  0x7a, 0x6f, 0x7c, 0x74, 0x7d, 0x76, 0x7e, 0x7b, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x64, 0x6a, 0x62, 0x67, 0x61, 0x65, 0x5b, 0x63,
-  0x57, 0x61, 0x4e, 0x5e, 0x47, 0x5a, 0x46, 0x57, 0x47, 0x54, 0x47, 0x52,
-  0x49, 0x51, 0x4a, 0x51, 0x4c, 0x4f, 0x4e, 0x50, 0x4c, 0x52, 0x47, 0x5c,
-  0x42, 0x63, 0x3d, 0x65, 0x40, 0x6b, 0x45, 0x6d, 0x46, 0x6d, 0x45, 0x6e,
-  0x43, 0x6e, 0x46, 0x6f, 0x46, 0x6f, 0x48, 0x6f, 0x4a, 0x71, 0x4d, 0x71,
-  0x52, 0x73, 0x54, 0x72, 0x57, 0x74, 0x59, 0x75, 0x58, 0x74, 0x58, 0x75,
-  0x58, 0x75, 0x58, 0x75, 0x58, 0x74, 0x56, 0x72, 0x53, 0x72, 0x51, 0x70,
-  0x4e, 0x6d, 0x4a, 0x6c, 0x48, 0x6c, 0x47, 0x6b, 0x49, 0x6b, 0x48, 0x6b,
-  0x45, 0x6b, 0x40, 0x6a, 0x3f, 0x67, 0x40, 0x64, 0x40, 0x61, 0x40, 0x60,
-  0x40, 0x61, 0x3e, 0x62, 0x3d, 0x62, 0x3d, 0x62, 0x3c, 0x65, 0x3b, 0x67,
-  0x3f, 0x68, 0x44, 0x69, 0x45, 0x68, 0x47, 0x69, 0x49, 0x6b, 0x4b, 0x6b,
-  0x4f, 0x6c, 0x53, 0x6e, 0x55, 0x70, 0x58, 0x70, 0x59, 0x72, 0x58, 0x72,
-  0x57, 0x70, 0x57, 0x70, 0x57, 0x70, 0x56, 0x70, 0x56, 0x70, 0x56, 0x70,
-  0x55, 0x71, 0x55, 0x70, 0x55, 0x70, 0x55, 0x70, 0x56, 0x70, 0x58, 0x71,
-  0x57, 0x72, 0x57, 0x72, 0x58, 0x72, 0x58, 0x72, 0x58, 0x73, 0x58, 0x74,
-  0x58, 0x73, 0x56, 0x73, 0x55, 0x72, 0x52, 0x72, 0x50, 0x72, 0x50, 0x72,
-  0x4d, 0x72, 0x4d, 0x72, 0x4f, 0x73, 0x52, 0x73, 0x54, 0x73, 0x57, 0x76,
-  0x5a, 0x78, 0x5c, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5e, 0x78, 0x5e, 0x78,
-  0x5f, 0x78, 0x5f, 0x78, 0x5e, 0x78, 0x5c, 0x77, 0x5c, 0x77, 0x5c, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5d, 0x77, 0x60, 0x76,
-  0x62, 0x76, 0x67, 0x74, 0x6c, 0x72, 0x71, 0x72, 0x75, 0x70, 0x76, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x71,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x6f, 0x7c, 0x74,
-  0x7c, 0x76, 0x7d, 0x7b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x61, 0x67, 0x5e, 0x64, 0x5b, 0x63, 0x54, 0x60, 0x4e, 0x5f, 0x47, 0x5b,
-  0x45, 0x56, 0x46, 0x53, 0x48, 0x50, 0x48, 0x4f, 0x49, 0x50, 0x4a, 0x51,
-  0x4d, 0x4f, 0x4f, 0x4f, 0x50, 0x51, 0x4b, 0x5a, 0x45, 0x61, 0x41, 0x64,
-  0x47, 0x6a, 0x4c, 0x6d, 0x4c, 0x6f, 0x4b, 0x70, 0x48, 0x70, 0x4a, 0x70,
-  0x49, 0x71, 0x48, 0x70, 0x4a, 0x70, 0x4e, 0x71, 0x54, 0x73, 0x56, 0x73,
-  0x58, 0x75, 0x5a, 0x76, 0x5a, 0x75, 0x59, 0x75, 0x58, 0x75, 0x58, 0x75,
-  0x58, 0x74, 0x56, 0x72, 0x52, 0x71, 0x4f, 0x6f, 0x4c, 0x6d, 0x49, 0x6d,
-  0x49, 0x6d, 0x49, 0x6b, 0x4a, 0x6b, 0x49, 0x6c, 0x42, 0x6b, 0x3f, 0x6a,
-  0x3f, 0x66, 0x40, 0x63, 0x41, 0x61, 0x40, 0x5e, 0x40, 0x60, 0x3f, 0x61,
-  0x3e, 0x62, 0x3e, 0x63, 0x3c, 0x65, 0x3c, 0x66, 0x3e, 0x67, 0x42, 0x68,
-  0x44, 0x68, 0x47, 0x69, 0x47, 0x6b, 0x4b, 0x6a, 0x4e, 0x6c, 0x52, 0x6e,
-  0x54, 0x70, 0x56, 0x70, 0x58, 0x72, 0x58, 0x72, 0x58, 0x71, 0x57, 0x70,
-  0x57, 0x71, 0x56, 0x71, 0x56, 0x71, 0x57, 0x71, 0x56, 0x71, 0x55, 0x70,
-  0x55, 0x70, 0x56, 0x70, 0x56, 0x70, 0x58, 0x71, 0x57, 0x72, 0x58, 0x72,
-  0x59, 0x72, 0x59, 0x72, 0x58, 0x73, 0x58, 0x73, 0x57, 0x73, 0x57, 0x73,
-  0x56, 0x73, 0x53, 0x72, 0x51, 0x72, 0x50, 0x72, 0x4e, 0x72, 0x4d, 0x72,
-  0x4e, 0x72, 0x51, 0x73, 0x54, 0x74, 0x58, 0x76, 0x59, 0x76, 0x5b, 0x76,
-  0x5d, 0x77, 0x5d, 0x77, 0x5c, 0x78, 0x5d, 0x78, 0x5c, 0x78, 0x5c, 0x78,
-  0x5c, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5c, 0x77, 0x5e, 0x77, 0x62, 0x76, 0x66, 0x75, 0x6c, 0x73,
-  0x70, 0x71, 0x75, 0x70, 0x77, 0x70, 0x76, 0x70, 0x77, 0x70, 0x77, 0x71,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x78, 0x70,
-  0x78, 0x71, 0x78, 0x70, 0x79, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x6e, 0x7c, 0x72, 0x7c, 0x76, 0x7e, 0x7b,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x60, 0x65, 0x5b, 0x63,
-  0x58, 0x62, 0x4e, 0x5f, 0x48, 0x5e, 0x45, 0x59, 0x46, 0x53, 0x47, 0x51,
-  0x49, 0x4e, 0x49, 0x4f, 0x49, 0x50, 0x4c, 0x50, 0x4d, 0x50, 0x50, 0x4e,
-  0x52, 0x50, 0x4f, 0x58, 0x47, 0x5f, 0x45, 0x64, 0x49, 0x69, 0x4d, 0x6b,
-  0x4e, 0x6e, 0x4e, 0x70, 0x4c, 0x71, 0x4b, 0x70, 0x4a, 0x70, 0x49, 0x70,
-  0x4b, 0x70, 0x4e, 0x71, 0x55, 0x73, 0x57, 0x74, 0x58, 0x74, 0x5a, 0x76,
-  0x5b, 0x76, 0x5b, 0x75, 0x58, 0x75, 0x59, 0x75, 0x57, 0x73, 0x55, 0x70,
-  0x51, 0x6e, 0x4d, 0x6d, 0x4b, 0x6c, 0x4a, 0x6d, 0x4a, 0x6d, 0x4a, 0x6c,
-  0x4b, 0x6d, 0x48, 0x6d, 0x40, 0x6c, 0x3e, 0x69, 0x40, 0x65, 0x40, 0x60,
-  0x40, 0x60, 0x40, 0x5d, 0x40, 0x5f, 0x3f, 0x60, 0x3e, 0x62, 0x3e, 0x65,
-  0x3d, 0x66, 0x3d, 0x65, 0x3d, 0x66, 0x40, 0x68, 0x44, 0x69, 0x47, 0x69,
-  0x48, 0x6a, 0x4b, 0x69, 0x4e, 0x6c, 0x51, 0x6e, 0x53, 0x6f, 0x56, 0x71,
-  0x57, 0x72, 0x59, 0x72, 0x58, 0x72, 0x57, 0x72, 0x57, 0x72, 0x57, 0x72,
-  0x57, 0x72, 0x57, 0x72, 0x56, 0x71, 0x56, 0x70, 0x56, 0x70, 0x57, 0x70,
-  0x56, 0x70, 0x57, 0x72, 0x58, 0x73, 0x57, 0x73, 0x58, 0x72, 0x59, 0x72,
-  0x58, 0x73, 0x58, 0x73, 0x58, 0x73, 0x58, 0x73, 0x57, 0x73, 0x54, 0x73,
-  0x52, 0x72, 0x4f, 0x72, 0x4e, 0x72, 0x4c, 0x72, 0x4e, 0x72, 0x51, 0x73,
-  0x54, 0x74, 0x58, 0x75, 0x58, 0x75, 0x59, 0x75, 0x5c, 0x76, 0x5d, 0x77,
-  0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77,
-  0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5c, 0x77, 0x5b, 0x77,
-  0x5e, 0x76, 0x64, 0x75, 0x68, 0x75, 0x70, 0x73, 0x73, 0x71, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x78, 0x71, 0x78, 0x71, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x70, 0x79, 0x70, 0x78, 0x6f,
-  0x79, 0x70, 0x7b, 0x71, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x6f, 0x7b, 0x70, 0x7d, 0x75, 0x7e, 0x7b, 0x80, 0x80, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x5e, 0x65, 0x59, 0x63, 0x53, 0x60, 0x48, 0x5d,
-  0x44, 0x5c, 0x46, 0x57, 0x48, 0x54, 0x49, 0x52, 0x4a, 0x4e, 0x4b, 0x4e,
-  0x4c, 0x50, 0x4e, 0x4f, 0x4f, 0x51, 0x50, 0x50, 0x51, 0x52, 0x50, 0x58,
-  0x4b, 0x5f, 0x4a, 0x64, 0x4f, 0x6a, 0x51, 0x6c, 0x52, 0x6f, 0x52, 0x70,
-  0x50, 0x71, 0x4d, 0x70, 0x4c, 0x70, 0x4a, 0x70, 0x4c, 0x70, 0x4e, 0x71,
-  0x52, 0x73, 0x55, 0x74, 0x58, 0x73, 0x5a, 0x76, 0x5b, 0x75, 0x5b, 0x75,
-  0x58, 0x74, 0x58, 0x75, 0x55, 0x73, 0x53, 0x71, 0x4f, 0x6f, 0x4c, 0x6d,
-  0x49, 0x6d, 0x48, 0x6d, 0x49, 0x6d, 0x4a, 0x6c, 0x4a, 0x6d, 0x46, 0x6d,
-  0x3f, 0x6b, 0x3e, 0x67, 0x3f, 0x63, 0x40, 0x60, 0x40, 0x60, 0x40, 0x5f,
-  0x40, 0x61, 0x3f, 0x62, 0x3f, 0x65, 0x3e, 0x66, 0x3d, 0x65, 0x3c, 0x65,
-  0x3d, 0x67, 0x40, 0x69, 0x44, 0x68, 0x47, 0x69, 0x48, 0x6a, 0x4b, 0x6a,
-  0x4f, 0x6c, 0x52, 0x6e, 0x54, 0x6f, 0x56, 0x72, 0x57, 0x72, 0x59, 0x72,
-  0x59, 0x72, 0x59, 0x72, 0x59, 0x73, 0x59, 0x73, 0x58, 0x72, 0x57, 0x72,
-  0x57, 0x71, 0x56, 0x70, 0x56, 0x70, 0x56, 0x70, 0x56, 0x70, 0x57, 0x71,
-  0x58, 0x72, 0x57, 0x72, 0x58, 0x72, 0x5a, 0x72, 0x5a, 0x73, 0x5a, 0x73,
-  0x5a, 0x74, 0x5b, 0x74, 0x59, 0x73, 0x56, 0x73, 0x54, 0x72, 0x51, 0x72,
-  0x50, 0x72, 0x4e, 0x72, 0x4e, 0x72, 0x51, 0x73, 0x53, 0x74, 0x56, 0x75,
-  0x57, 0x76, 0x59, 0x75, 0x5d, 0x76, 0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77,
-  0x5d, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77,
-  0x5b, 0x77, 0x5a, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x60, 0x75, 0x67, 0x74,
-  0x6d, 0x73, 0x74, 0x72, 0x76, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f,
-  0x77, 0x71, 0x77, 0x71, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x78, 0x70, 0x78, 0x70, 0x78, 0x6f, 0x79, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x6f, 0x7a, 0x6f, 0x79, 0x71,
-  0x7a, 0x75, 0x7d, 0x7b, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x5d, 0x65, 0x58, 0x63, 0x4f, 0x60, 0x44, 0x5c, 0x44, 0x5a, 0x47, 0x55,
-  0x4a, 0x53, 0x4a, 0x52, 0x4b, 0x4f, 0x4d, 0x4f, 0x4e, 0x50, 0x4f, 0x50,
-  0x50, 0x51, 0x51, 0x53, 0x51, 0x54, 0x51, 0x58, 0x4f, 0x5f, 0x4e, 0x64,
-  0x54, 0x6a, 0x54, 0x6c, 0x54, 0x6f, 0x55, 0x70, 0x52, 0x71, 0x50, 0x70,
-  0x4d, 0x70, 0x4b, 0x70, 0x4b, 0x70, 0x4d, 0x70, 0x51, 0x73, 0x53, 0x73,
-  0x57, 0x74, 0x5a, 0x76, 0x5b, 0x76, 0x5b, 0x75, 0x59, 0x74, 0x58, 0x75,
-  0x54, 0x72, 0x52, 0x71, 0x4d, 0x6f, 0x4a, 0x6d, 0x48, 0x6d, 0x47, 0x6c,
-  0x49, 0x6c, 0x4a, 0x6c, 0x4a, 0x6d, 0x44, 0x6d, 0x3e, 0x6a, 0x3e, 0x65,
-  0x40, 0x61, 0x40, 0x60, 0x41, 0x60, 0x40, 0x61, 0x40, 0x63, 0x3f, 0x64,
-  0x3f, 0x66, 0x3f, 0x66, 0x3e, 0x66, 0x3d, 0x65, 0x3d, 0x67, 0x40, 0x69,
-  0x44, 0x68, 0x47, 0x68, 0x48, 0x6a, 0x4a, 0x6a, 0x4e, 0x6c, 0x52, 0x6e,
-  0x54, 0x6f, 0x55, 0x71, 0x57, 0x72, 0x5a, 0x72, 0x5b, 0x72, 0x5b, 0x72,
-  0x5a, 0x73, 0x5a, 0x73, 0x58, 0x72, 0x58, 0x72, 0x57, 0x71, 0x56, 0x70,
-  0x56, 0x70, 0x56, 0x70, 0x56, 0x70, 0x57, 0x71, 0x57, 0x72, 0x57, 0x72,
-  0x58, 0x72, 0x5b, 0x73, 0x5c, 0x73, 0x5c, 0x73, 0x5c, 0x76, 0x5c, 0x75,
-  0x5b, 0x73, 0x57, 0x73, 0x55, 0x72, 0x53, 0x72, 0x51, 0x72, 0x50, 0x72,
-  0x4e, 0x73, 0x51, 0x72, 0x52, 0x73, 0x55, 0x75, 0x57, 0x75, 0x5a, 0x75,
-  0x5d, 0x77, 0x5d, 0x78, 0x5d, 0x78, 0x5d, 0x78, 0x5c, 0x78, 0x5b, 0x77,
-  0x5b, 0x77, 0x5a, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x5a, 0x77,
-  0x5c, 0x77, 0x5e, 0x77, 0x62, 0x76, 0x6a, 0x73, 0x70, 0x71, 0x77, 0x70,
-  0x77, 0x71, 0x77, 0x6f, 0x78, 0x6f, 0x77, 0x6f, 0x77, 0x71, 0x77, 0x71,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x78, 0x70, 0x78, 0x71,
-  0x77, 0x70, 0x78, 0x6f, 0x78, 0x6f, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x71, 0x7a, 0x6d, 0x7a, 0x6f, 0x78, 0x71, 0x7a, 0x75, 0x7d, 0x7a,
-  0x80, 0x80, 0x80, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x5c, 0x65, 0x58, 0x62,
-  0x4b, 0x5f, 0x45, 0x59, 0x46, 0x58, 0x49, 0x52, 0x4c, 0x4f, 0x4b, 0x51,
-  0x4c, 0x50, 0x4e, 0x4e, 0x50, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53,
-  0x52, 0x56, 0x51, 0x5a, 0x51, 0x60, 0x52, 0x63, 0x58, 0x67, 0x56, 0x6a,
-  0x55, 0x6e, 0x57, 0x6f, 0x55, 0x71, 0x53, 0x72, 0x50, 0x72, 0x4b, 0x71,
-  0x4a, 0x70, 0x4a, 0x70, 0x4f, 0x72, 0x52, 0x72, 0x58, 0x73, 0x5a, 0x76,
-  0x5b, 0x75, 0x5b, 0x75, 0x5a, 0x75, 0x58, 0x73, 0x55, 0x71, 0x51, 0x70,
-  0x4d, 0x6e, 0x49, 0x6e, 0x47, 0x6d, 0x49, 0x6c, 0x4b, 0x6d, 0x4a, 0x6e,
-  0x48, 0x6d, 0x42, 0x6c, 0x3d, 0x67, 0x3e, 0x64, 0x40, 0x61, 0x41, 0x62,
-  0x41, 0x62, 0x40, 0x61, 0x41, 0x64, 0x40, 0x65, 0x40, 0x65, 0x3f, 0x66,
-  0x3e, 0x68, 0x3e, 0x68, 0x3d, 0x67, 0x3e, 0x67, 0x43, 0x68, 0x48, 0x69,
-  0x4a, 0x6a, 0x4b, 0x6a, 0x4f, 0x6e, 0x53, 0x6f, 0x55, 0x6f, 0x58, 0x72,
-  0x5a, 0x74, 0x5b, 0x74, 0x5c, 0x74, 0x5c, 0x74, 0x5a, 0x72, 0x5a, 0x73,
-  0x59, 0x74, 0x58, 0x75, 0x56, 0x73, 0x57, 0x72, 0x57, 0x72, 0x57, 0x72,
-  0x57, 0x72, 0x57, 0x73, 0x57, 0x73, 0x58, 0x74, 0x5b, 0x74, 0x5c, 0x74,
-  0x5c, 0x75, 0x5d, 0x75, 0x5b, 0x76, 0x5c, 0x76, 0x5c, 0x75, 0x59, 0x75,
-  0x58, 0x72, 0x56, 0x72, 0x53, 0x72, 0x51, 0x73, 0x50, 0x73, 0x50, 0x72,
-  0x52, 0x72, 0x55, 0x73, 0x57, 0x73, 0x58, 0x75, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x78, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77,
-  0x5a, 0x77, 0x59, 0x78, 0x58, 0x77, 0x59, 0x76, 0x5d, 0x75, 0x5f, 0x76,
-  0x66, 0x74, 0x6f, 0x73, 0x73, 0x72, 0x76, 0x70, 0x77, 0x71, 0x77, 0x70,
-  0x77, 0x6f, 0x77, 0x6f, 0x76, 0x70, 0x76, 0x71, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x78, 0x72, 0x78, 0x71, 0x78, 0x70,
-  0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x6f,
-  0x7a, 0x70, 0x7a, 0x71, 0x7a, 0x74, 0x7d, 0x7b, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x59, 0x63, 0x52, 0x60, 0x48, 0x5d, 0x47, 0x57,
-  0x49, 0x55, 0x4c, 0x50, 0x4d, 0x4e, 0x4d, 0x50, 0x4f, 0x51, 0x50, 0x51,
-  0x52, 0x50, 0x53, 0x51, 0x52, 0x53, 0x53, 0x55, 0x53, 0x58, 0x52, 0x5a,
-  0x52, 0x5f, 0x58, 0x63, 0x5e, 0x66, 0x5c, 0x68, 0x5a, 0x6b, 0x5a, 0x6e,
-  0x57, 0x71, 0x55, 0x72, 0x53, 0x72, 0x4d, 0x71, 0x4b, 0x70, 0x4a, 0x71,
-  0x4d, 0x72, 0x50, 0x72, 0x56, 0x73, 0x58, 0x75, 0x5a, 0x75, 0x5a, 0x75,
-  0x5a, 0x76, 0x58, 0x73, 0x53, 0x71, 0x4f, 0x6f, 0x4c, 0x6e, 0x49, 0x6e,
-  0x45, 0x6d, 0x48, 0x6c, 0x49, 0x6d, 0x48, 0x6e, 0x44, 0x6e, 0x3f, 0x6b,
-  0x3d, 0x67, 0x3e, 0x64, 0x40, 0x62, 0x41, 0x62, 0x41, 0x62, 0x41, 0x63,
-  0x41, 0x65, 0x41, 0x68, 0x41, 0x67, 0x40, 0x67, 0x3e, 0x67, 0x3e, 0x68,
-  0x3d, 0x68, 0x3e, 0x67, 0x42, 0x68, 0x49, 0x69, 0x4b, 0x6a, 0x4b, 0x6a,
-  0x51, 0x6e, 0x55, 0x6f, 0x58, 0x71, 0x5a, 0x73, 0x5d, 0x75, 0x5d, 0x75,
-  0x5d, 0x74, 0x5c, 0x75, 0x5b, 0x74, 0x5b, 0x74, 0x5c, 0x75, 0x5a, 0x75,
-  0x58, 0x74, 0x58, 0x73, 0x58, 0x73, 0x57, 0x73, 0x57, 0x72, 0x57, 0x73,
-  0x57, 0x73, 0x59, 0x74, 0x5c, 0x75, 0x5c, 0x75, 0x5c, 0x75, 0x5e, 0x76,
-  0x5d, 0x75, 0x5e, 0x75, 0x5e, 0x75, 0x5c, 0x75, 0x5b, 0x74, 0x58, 0x75,
-  0x55, 0x73, 0x53, 0x72, 0x51, 0x73, 0x50, 0x73, 0x52, 0x72, 0x54, 0x73,
-  0x57, 0x73, 0x58, 0x75, 0x5b, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x59, 0x78,
-  0x58, 0x77, 0x5a, 0x76, 0x5f, 0x75, 0x63, 0x75, 0x6a, 0x74, 0x72, 0x73,
-  0x76, 0x72, 0x77, 0x70, 0x77, 0x71, 0x77, 0x71, 0x77, 0x6f, 0x77, 0x6f,
-  0x76, 0x71, 0x75, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x71, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x71, 0x78, 0x72, 0x78, 0x71, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70,
-  0x78, 0x70, 0x7a, 0x70, 0x7a, 0x71, 0x7b, 0x72, 0x7b, 0x72, 0x7a, 0x72,
-  0x7a, 0x73, 0x7d, 0x7b, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x57, 0x61, 0x4d, 0x5e, 0x46, 0x5c, 0x49, 0x55, 0x4c, 0x52, 0x4e, 0x4f,
-  0x4f, 0x4e, 0x50, 0x51, 0x51, 0x52, 0x52, 0x52, 0x54, 0x50, 0x54, 0x50,
-  0x53, 0x55, 0x53, 0x57, 0x53, 0x59, 0x52, 0x5a, 0x53, 0x5e, 0x59, 0x62,
-  0x5f, 0x66, 0x5f, 0x67, 0x5e, 0x6a, 0x5c, 0x6e, 0x58, 0x71, 0x57, 0x73,
-  0x54, 0x73, 0x50, 0x71, 0x4d, 0x70, 0x4b, 0x71, 0x4c, 0x72, 0x4e, 0x72,
-  0x55, 0x73, 0x57, 0x75, 0x58, 0x76, 0x59, 0x75, 0x5a, 0x75, 0x57, 0x74,
-  0x51, 0x72, 0x4e, 0x6f, 0x4c, 0x6e, 0x48, 0x6d, 0x45, 0x6d, 0x46, 0x6c,
-  0x48, 0x6d, 0x47, 0x6e, 0x42, 0x6e, 0x3d, 0x6c, 0x3d, 0x68, 0x3d, 0x63,
-  0x40, 0x62, 0x41, 0x62, 0x41, 0x62, 0x40, 0x65, 0x40, 0x67, 0x41, 0x69,
-  0x41, 0x69, 0x40, 0x68, 0x3f, 0x67, 0x3f, 0x67, 0x3e, 0x68, 0x3e, 0x67,
-  0x43, 0x68, 0x49, 0x69, 0x4b, 0x6a, 0x4c, 0x6a, 0x53, 0x6d, 0x57, 0x6f,
-  0x5a, 0x72, 0x5c, 0x75, 0x5e, 0x75, 0x5e, 0x75, 0x5d, 0x75, 0x5c, 0x75,
-  0x5d, 0x76, 0x5d, 0x76, 0x5e, 0x75, 0x5c, 0x74, 0x5a, 0x73, 0x5a, 0x73,
-  0x59, 0x72, 0x57, 0x72, 0x57, 0x72, 0x57, 0x72, 0x56, 0x73, 0x58, 0x74,
-  0x5c, 0x75, 0x5c, 0x75, 0x5c, 0x75, 0x5e, 0x75, 0x5f, 0x75, 0x60, 0x75,
-  0x60, 0x75, 0x5d, 0x75, 0x5c, 0x76, 0x59, 0x76, 0x57, 0x73, 0x55, 0x72,
-  0x52, 0x73, 0x50, 0x73, 0x52, 0x72, 0x54, 0x73, 0x57, 0x73, 0x58, 0x75,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5a, 0x77, 0x5a, 0x77, 0x59, 0x77, 0x58, 0x77, 0x5b, 0x76,
-  0x61, 0x75, 0x66, 0x76, 0x6d, 0x74, 0x74, 0x73, 0x77, 0x72, 0x78, 0x70,
-  0x76, 0x70, 0x76, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x76, 0x70, 0x75, 0x70,
-  0x78, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x71,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x78, 0x72,
-  0x78, 0x71, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x71,
-  0x7a, 0x71, 0x7b, 0x73, 0x7b, 0x73, 0x7a, 0x72, 0x7a, 0x73, 0x7c, 0x7b,
-  0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x54, 0x5f, 0x49, 0x5b,
-  0x48, 0x59, 0x4c, 0x52, 0x4e, 0x51, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52,
-  0x53, 0x51, 0x54, 0x50, 0x55, 0x50, 0x55, 0x53, 0x55, 0x58, 0x54, 0x59,
-  0x54, 0x59, 0x53, 0x5b, 0x52, 0x60, 0x57, 0x64, 0x62, 0x65, 0x64, 0x67,
-  0x61, 0x6a, 0x5f, 0x6d, 0x5c, 0x70, 0x58, 0x72, 0x55, 0x72, 0x52, 0x71,
-  0x4f, 0x70, 0x4b, 0x70, 0x4c, 0x70, 0x4f, 0x70, 0x54, 0x73, 0x58, 0x75,
-  0x58, 0x76, 0x58, 0x75, 0x58, 0x73, 0x55, 0x72, 0x50, 0x70, 0x4d, 0x6f,
-  0x4b, 0x6f, 0x48, 0x6e, 0x46, 0x6e, 0x46, 0x6d, 0x47, 0x6d, 0x44, 0x6d,
-  0x3f, 0x6d, 0x3c, 0x6b, 0x3c, 0x66, 0x3e, 0x63, 0x40, 0x60, 0x41, 0x5f,
-  0x41, 0x62, 0x40, 0x66, 0x40, 0x69, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x69,
-  0x40, 0x66, 0x40, 0x66, 0x3d, 0x66, 0x3d, 0x66, 0x43, 0x68, 0x49, 0x69,
-  0x4b, 0x6a, 0x4f, 0x6c, 0x53, 0x6e, 0x57, 0x70, 0x5b, 0x72, 0x5d, 0x74,
-  0x5f, 0x75, 0x5f, 0x75, 0x5e, 0x75, 0x5d, 0x75, 0x5e, 0x75, 0x5e, 0x75,
-  0x5d, 0x74, 0x5c, 0x74, 0x5b, 0x74, 0x5a, 0x74, 0x59, 0x73, 0x58, 0x71,
-  0x58, 0x72, 0x57, 0x73, 0x58, 0x75, 0x59, 0x75, 0x5c, 0x75, 0x5e, 0x76,
-  0x5f, 0x77, 0x5f, 0x77, 0x62, 0x77, 0x62, 0x77, 0x60, 0x77, 0x5d, 0x77,
-  0x5e, 0x76, 0x5b, 0x75, 0x58, 0x75, 0x56, 0x74, 0x54, 0x73, 0x51, 0x73,
-  0x52, 0x73, 0x55, 0x73, 0x58, 0x74, 0x59, 0x75, 0x5b, 0x76, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x58, 0x76, 0x5a, 0x76, 0x5d, 0x76, 0x63, 0x74, 0x69, 0x73,
-  0x6f, 0x72, 0x75, 0x72, 0x77, 0x72, 0x77, 0x71, 0x77, 0x71, 0x77, 0x70,
-  0x77, 0x6e, 0x77, 0x6e, 0x77, 0x6f, 0x77, 0x70, 0x78, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x78, 0x70, 0x77, 0x71, 0x77, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70,
-  0x78, 0x70, 0x78, 0x70, 0x79, 0x70, 0x7a, 0x71, 0x7a, 0x71, 0x7b, 0x72,
-  0x7b, 0x72, 0x7b, 0x72, 0x7a, 0x73, 0x7c, 0x79, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x4f, 0x5d, 0x48, 0x59, 0x4c, 0x55, 0x50, 0x51,
-  0x51, 0x51, 0x54, 0x50, 0x54, 0x54, 0x54, 0x55, 0x55, 0x53, 0x55, 0x52,
-  0x55, 0x53, 0x56, 0x56, 0x55, 0x5a, 0x53, 0x5c, 0x54, 0x5c, 0x53, 0x5d,
-  0x52, 0x62, 0x54, 0x65, 0x5f, 0x65, 0x64, 0x67, 0x65, 0x6b, 0x63, 0x6b,
-  0x60, 0x6d, 0x5b, 0x70, 0x58, 0x70, 0x55, 0x70, 0x51, 0x70, 0x4d, 0x70,
-  0x4c, 0x70, 0x4d, 0x70, 0x51, 0x72, 0x55, 0x74, 0x56, 0x74, 0x56, 0x74,
-  0x56, 0x72, 0x53, 0x72, 0x4f, 0x6f, 0x4d, 0x6f, 0x4a, 0x6f, 0x49, 0x6f,
-  0x46, 0x6e, 0x45, 0x6e, 0x45, 0x6d, 0x41, 0x6d, 0x3d, 0x6c, 0x3b, 0x69,
-  0x3d, 0x65, 0x3e, 0x62, 0x40, 0x60, 0x41, 0x61, 0x41, 0x64, 0x40, 0x67,
-  0x40, 0x69, 0x40, 0x6a, 0x40, 0x6a, 0x40, 0x69, 0x41, 0x65, 0x40, 0x65,
-  0x3e, 0x65, 0x3d, 0x65, 0x42, 0x67, 0x49, 0x69, 0x4b, 0x6a, 0x50, 0x6c,
-  0x55, 0x6f, 0x59, 0x71, 0x5c, 0x72, 0x5e, 0x74, 0x60, 0x76, 0x5f, 0x75,
-  0x5e, 0x75, 0x5e, 0x75, 0x5d, 0x75, 0x5d, 0x75, 0x5b, 0x74, 0x5a, 0x74,
-  0x59, 0x75, 0x58, 0x75, 0x58, 0x74, 0x57, 0x72, 0x58, 0x72, 0x5a, 0x74,
-  0x59, 0x75, 0x5a, 0x75, 0x5c, 0x76, 0x5f, 0x76, 0x60, 0x78, 0x5f, 0x77,
-  0x62, 0x77, 0x62, 0x77, 0x62, 0x77, 0x5f, 0x77, 0x5f, 0x75, 0x5d, 0x75,
-  0x5a, 0x75, 0x58, 0x75, 0x55, 0x73, 0x53, 0x73, 0x52, 0x73, 0x54, 0x72,
-  0x57, 0x74, 0x58, 0x75, 0x5b, 0x76, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5a, 0x76,
-  0x5c, 0x75, 0x5f, 0x75, 0x65, 0x73, 0x6c, 0x72, 0x71, 0x72, 0x76, 0x72,
-  0x77, 0x72, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x78, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x70, 0x77, 0x70,
-  0x77, 0x71, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70,
-  0x78, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x79, 0x72, 0x79, 0x72, 0x7a, 0x72,
-  0x7a, 0x73, 0x7c, 0x79, 0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-  0x4d, 0x5c, 0x4a, 0x57, 0x50, 0x53, 0x53, 0x51, 0x54, 0x52, 0x56, 0x50,
-  0x56, 0x52, 0x56, 0x53, 0x57, 0x55, 0x56, 0x56, 0x56, 0x55, 0x56, 0x57,
-  0x54, 0x5c, 0x53, 0x5f, 0x54, 0x5f, 0x53, 0x5e, 0x52, 0x63, 0x52, 0x66,
-  0x5d, 0x67, 0x63, 0x68, 0x67, 0x6a, 0x66, 0x6a, 0x63, 0x6c, 0x5e, 0x6f,
-  0x5b, 0x6f, 0x57, 0x70, 0x52, 0x70, 0x4f, 0x70, 0x4d, 0x70, 0x4b, 0x71,
-  0x4e, 0x72, 0x53, 0x74, 0x54, 0x73, 0x55, 0x73, 0x54, 0x73, 0x52, 0x72,
-  0x50, 0x6f, 0x4e, 0x6f, 0x4b, 0x6f, 0x49, 0x6f, 0x45, 0x6e, 0x43, 0x6e,
-  0x43, 0x6d, 0x3e, 0x6c, 0x3b, 0x6b, 0x3b, 0x67, 0x3d, 0x64, 0x3e, 0x62,
-  0x40, 0x60, 0x41, 0x63, 0x40, 0x65, 0x41, 0x67, 0x41, 0x69, 0x40, 0x6a,
-  0x40, 0x6a, 0x40, 0x69, 0x41, 0x66, 0x41, 0x65, 0x3f, 0x65, 0x3d, 0x65,
-  0x41, 0x68, 0x48, 0x6a, 0x4b, 0x6a, 0x51, 0x6c, 0x56, 0x6f, 0x5a, 0x71,
-  0x5c, 0x72, 0x5e, 0x74, 0x5f, 0x76, 0x5f, 0x76, 0x5e, 0x75, 0x5e, 0x75,
-  0x5c, 0x75, 0x5b, 0x75, 0x59, 0x74, 0x58, 0x75, 0x57, 0x75, 0x57, 0x75,
-  0x56, 0x75, 0x56, 0x74, 0x59, 0x74, 0x5c, 0x74, 0x5b, 0x75, 0x5b, 0x75,
-  0x5c, 0x75, 0x5e, 0x76, 0x5f, 0x77, 0x60, 0x77, 0x62, 0x77, 0x63, 0x76,
-  0x63, 0x77, 0x60, 0x77, 0x61, 0x75, 0x5f, 0x75, 0x5b, 0x75, 0x5a, 0x75,
-  0x57, 0x74, 0x55, 0x73, 0x53, 0x73, 0x54, 0x72, 0x57, 0x74, 0x59, 0x75,
-  0x5b, 0x76, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x76, 0x5e, 0x75, 0x61, 0x75,
-  0x67, 0x74, 0x6d, 0x72, 0x73, 0x72, 0x77, 0x72, 0x77, 0x72, 0x77, 0x71,
-  0x77, 0x70, 0x77, 0x71, 0x77, 0x71, 0x77, 0x71, 0x77, 0x6e, 0x77, 0x6e,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x78, 0x70,
-  0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x71,
-  0x7a, 0x70, 0x78, 0x72, 0x78, 0x72, 0x7a, 0x72, 0x7a, 0x73, 0x7c, 0x78,
-  0x80, 0x7f, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x4d, 0x5a, 0x51, 0x53,
-  0x55, 0x52, 0x56, 0x53, 0x57, 0x53, 0x58, 0x52, 0x58, 0x52, 0x58, 0x53,
-  0x57, 0x56, 0x57, 0x57, 0x56, 0x59, 0x55, 0x5c, 0x54, 0x5f, 0x53, 0x62,
-  0x53, 0x61, 0x52, 0x62, 0x51, 0x63, 0x51, 0x67, 0x5b, 0x68, 0x62, 0x6a,
-  0x67, 0x6b, 0x69, 0x6a, 0x66, 0x6b, 0x62, 0x6f, 0x5f, 0x6f, 0x5b, 0x6f,
-  0x57, 0x6f, 0x53, 0x70, 0x4f, 0x71, 0x4b, 0x71, 0x4c, 0x72, 0x50, 0x72,
-  0x53, 0x73, 0x53, 0x73, 0x52, 0x72, 0x50, 0x72, 0x4f, 0x70, 0x4d, 0x70,
-  0x4a, 0x6f, 0x49, 0x6f, 0x46, 0x6e, 0x42, 0x6d, 0x41, 0x6e, 0x3c, 0x6c,
-  0x3b, 0x6a, 0x3b, 0x66, 0x3e, 0x63, 0x40, 0x62, 0x41, 0x62, 0x40, 0x63,
-  0x3f, 0x67, 0x3f, 0x6a, 0x40, 0x6a, 0x41, 0x6b, 0x3f, 0x6a, 0x40, 0x69,
-  0x42, 0x66, 0x41, 0x65, 0x3f, 0x65, 0x3d, 0x66, 0x41, 0x69, 0x49, 0x69,
-  0x4b, 0x6a, 0x50, 0x6d, 0x57, 0x70, 0x5a, 0x72, 0x5c, 0x75, 0x5d, 0x74,
-  0x5e, 0x76, 0x5e, 0x76, 0x5e, 0x74, 0x5c, 0x73, 0x58, 0x73, 0x55, 0x71,
-  0x55, 0x71, 0x57, 0x73, 0x57, 0x75, 0x57, 0x75, 0x57, 0x77, 0x59, 0x77,
-  0x5a, 0x76, 0x5b, 0x75, 0x5c, 0x74, 0x5c, 0x75, 0x5c, 0x76, 0x5c, 0x76,
-  0x5e, 0x77, 0x5f, 0x77, 0x60, 0x78, 0x61, 0x78, 0x62, 0x78, 0x62, 0x77,
-  0x60, 0x76, 0x5d, 0x77, 0x5b, 0x75, 0x59, 0x75, 0x58, 0x75, 0x56, 0x74,
-  0x54, 0x74, 0x54, 0x74, 0x57, 0x75, 0x58, 0x75, 0x5a, 0x77, 0x5b, 0x78,
-  0x5b, 0x77, 0x5c, 0x78, 0x5c, 0x78, 0x5b, 0x78, 0x5b, 0x78, 0x5c, 0x77,
-  0x5c, 0x78, 0x5c, 0x77, 0x60, 0x75, 0x63, 0x74, 0x6a, 0x74, 0x70, 0x73,
-  0x74, 0x73, 0x77, 0x73, 0x77, 0x72, 0x77, 0x71, 0x77, 0x71, 0x77, 0x71,
-  0x78, 0x71, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70,
-  0x78, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x72,
-  0x78, 0x72, 0x78, 0x70, 0x78, 0x70, 0x78, 0x72, 0x79, 0x71, 0x78, 0x72,
-  0x78, 0x72, 0x79, 0x72, 0x79, 0x74, 0x7a, 0x78, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x50, 0x58, 0x56, 0x51, 0x58, 0x52, 0x58, 0x53,
-  0x58, 0x53, 0x59, 0x52, 0x59, 0x52, 0x58, 0x55, 0x57, 0x58, 0x57, 0x5a,
-  0x55, 0x5c, 0x54, 0x5e, 0x54, 0x60, 0x53, 0x62, 0x53, 0x63, 0x51, 0x63,
-  0x51, 0x63, 0x50, 0x66, 0x58, 0x67, 0x5f, 0x69, 0x64, 0x6a, 0x68, 0x69,
-  0x67, 0x6b, 0x65, 0x6e, 0x62, 0x6e, 0x5e, 0x6f, 0x5b, 0x6f, 0x56, 0x70,
-  0x51, 0x71, 0x4d, 0x70, 0x4c, 0x72, 0x4e, 0x72, 0x50, 0x73, 0x50, 0x72,
-  0x4f, 0x72, 0x4d, 0x72, 0x4d, 0x71, 0x4b, 0x70, 0x4a, 0x70, 0x48, 0x6f,
-  0x46, 0x6e, 0x42, 0x6e, 0x3f, 0x6d, 0x3c, 0x6b, 0x3a, 0x68, 0x3c, 0x66,
-  0x3f, 0x63, 0x41, 0x62, 0x41, 0x62, 0x40, 0x64, 0x3f, 0x69, 0x3f, 0x6c,
-  0x41, 0x6b, 0x41, 0x6c, 0x3f, 0x6a, 0x40, 0x6a, 0x42, 0x66, 0x42, 0x65,
-  0x40, 0x65, 0x3e, 0x66, 0x40, 0x69, 0x48, 0x69, 0x4b, 0x6b, 0x51, 0x6d,
-  0x57, 0x70, 0x5a, 0x72, 0x5c, 0x75, 0x5d, 0x75, 0x5e, 0x76, 0x5e, 0x75,
-  0x5c, 0x73, 0x58, 0x72, 0x55, 0x70, 0x56, 0x6e, 0x59, 0x70, 0x5a, 0x72,
-  0x59, 0x72, 0x56, 0x73, 0x58, 0x76, 0x5b, 0x76, 0x59, 0x76, 0x58, 0x76,
-  0x5a, 0x76, 0x5e, 0x77, 0x61, 0x78, 0x61, 0x77, 0x61, 0x78, 0x60, 0x78,
-  0x61, 0x78, 0x61, 0x78, 0x62, 0x78, 0x62, 0x78, 0x5e, 0x77, 0x5d, 0x77,
-  0x5b, 0x75, 0x5a, 0x75, 0x58, 0x75, 0x56, 0x75, 0x55, 0x75, 0x55, 0x74,
-  0x57, 0x75, 0x58, 0x75, 0x59, 0x77, 0x5a, 0x78, 0x5a, 0x78, 0x5b, 0x78,
-  0x5b, 0x78, 0x5b, 0x78, 0x5b, 0x78, 0x5d, 0x78, 0x5d, 0x78, 0x5d, 0x77,
-  0x62, 0x74, 0x65, 0x74, 0x6d, 0x75, 0x72, 0x74, 0x75, 0x73, 0x77, 0x73,
-  0x77, 0x72, 0x77, 0x71, 0x77, 0x71, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x71,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x71,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x73, 0x77, 0x72, 0x78, 0x70,
-  0x78, 0x70, 0x78, 0x72, 0x78, 0x72, 0x78, 0x72, 0x78, 0x72, 0x78, 0x72,
-  0x77, 0x74, 0x79, 0x78, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x56, 0x55, 0x58, 0x52, 0x59, 0x51, 0x5a, 0x51, 0x5a, 0x52, 0x5a, 0x53,
-  0x5a, 0x54, 0x59, 0x57, 0x57, 0x5b, 0x57, 0x5d, 0x56, 0x5e, 0x55, 0x5d,
-  0x54, 0x60, 0x53, 0x64, 0x52, 0x63, 0x51, 0x63, 0x51, 0x63, 0x4f, 0x66,
-  0x53, 0x67, 0x5b, 0x69, 0x61, 0x6a, 0x65, 0x69, 0x67, 0x6b, 0x68, 0x6d,
-  0x66, 0x6d, 0x61, 0x6e, 0x5e, 0x6f, 0x5a, 0x70, 0x55, 0x71, 0x51, 0x70,
-  0x4d, 0x72, 0x4b, 0x72, 0x4c, 0x71, 0x4e, 0x71, 0x4e, 0x72, 0x4c, 0x72,
-  0x4b, 0x70, 0x49, 0x70, 0x48, 0x6f, 0x46, 0x70, 0x45, 0x6f, 0x40, 0x6e,
-  0x3c, 0x6d, 0x3a, 0x69, 0x3b, 0x66, 0x3c, 0x63, 0x3f, 0x62, 0x40, 0x62,
-  0x40, 0x62, 0x3f, 0x65, 0x3f, 0x6a, 0x41, 0x6d, 0x43, 0x6d, 0x41, 0x6c,
-  0x3e, 0x6a, 0x40, 0x69, 0x42, 0x66, 0x42, 0x65, 0x40, 0x65, 0x3e, 0x66,
-  0x3f, 0x68, 0x46, 0x69, 0x4b, 0x6b, 0x51, 0x6d, 0x57, 0x70, 0x5a, 0x72,
-  0x5b, 0x74, 0x5d, 0x75, 0x5e, 0x76, 0x5e, 0x75, 0x5a, 0x73, 0x56, 0x72,
-  0x57, 0x70, 0x59, 0x72, 0x5b, 0x72, 0x5a, 0x70, 0x57, 0x6f, 0x55, 0x70,
-  0x56, 0x73, 0x59, 0x75, 0x5a, 0x74, 0x60, 0x77, 0x64, 0x78, 0x67, 0x78,
-  0x6a, 0x79, 0x6a, 0x79, 0x67, 0x79, 0x63, 0x79, 0x63, 0x78, 0x63, 0x78,
-  0x62, 0x78, 0x63, 0x78, 0x68, 0x77, 0x62, 0x77, 0x59, 0x75, 0x59, 0x75,
-  0x5a, 0x75, 0x56, 0x75, 0x57, 0x74, 0x57, 0x75, 0x58, 0x75, 0x58, 0x76,
-  0x59, 0x77, 0x5a, 0x77, 0x5b, 0x77, 0x5b, 0x78, 0x5b, 0x78, 0x5b, 0x78,
-  0x5b, 0x78, 0x5d, 0x78, 0x5c, 0x78, 0x5d, 0x77, 0x63, 0x74, 0x68, 0x74,
-  0x70, 0x74, 0x75, 0x73, 0x77, 0x73, 0x78, 0x73, 0x77, 0x72, 0x77, 0x71,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x6f, 0x77, 0x6f, 0x78, 0x70, 0x78, 0x71, 0x77, 0x70, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x72, 0x77, 0x71, 0x78, 0x70, 0x78, 0x71, 0x78, 0x72,
-  0x78, 0x72, 0x78, 0x72, 0x78, 0x72, 0x76, 0x72, 0x76, 0x75, 0x79, 0x78,
-  0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x58, 0x53, 0x59, 0x53,
-  0x5a, 0x52, 0x5a, 0x54, 0x5a, 0x54, 0x5a, 0x54, 0x5a, 0x54, 0x59, 0x59,
-  0x58, 0x5a, 0x57, 0x5d, 0x55, 0x5f, 0x54, 0x5f, 0x53, 0x62, 0x51, 0x65,
-  0x51, 0x65, 0x50, 0x65, 0x50, 0x65, 0x4e, 0x66, 0x4f, 0x68, 0x55, 0x69,
-  0x5f, 0x69, 0x64, 0x6a, 0x68, 0x6a, 0x6c, 0x6c, 0x69, 0x6d, 0x66, 0x6e,
-  0x63, 0x6e, 0x5d, 0x6e, 0x58, 0x6e, 0x54, 0x6f, 0x50, 0x71, 0x4a, 0x71,
-  0x4a, 0x70, 0x4c, 0x70, 0x4c, 0x70, 0x4a, 0x70, 0x48, 0x6f, 0x47, 0x70,
-  0x45, 0x6f, 0x43, 0x6e, 0x3f, 0x6e, 0x3c, 0x6e, 0x3a, 0x6c, 0x3a, 0x69,
-  0x3b, 0x66, 0x3d, 0x62, 0x3f, 0x60, 0x40, 0x61, 0x40, 0x63, 0x3e, 0x66,
-  0x3d, 0x6a, 0x41, 0x6e, 0x44, 0x6e, 0x42, 0x6e, 0x3e, 0x6b, 0x41, 0x69,
-  0x42, 0x66, 0x42, 0x65, 0x41, 0x65, 0x3f, 0x65, 0x3e, 0x68, 0x43, 0x6a,
-  0x4a, 0x6a, 0x51, 0x6d, 0x55, 0x6f, 0x59, 0x72, 0x5d, 0x74, 0x5d, 0x74,
-  0x60, 0x76, 0x5b, 0x74, 0x55, 0x74, 0x55, 0x73, 0x58, 0x72, 0x59, 0x74,
-  0x57, 0x72, 0x55, 0x6f, 0x55, 0x6d, 0x54, 0x6f, 0x55, 0x71, 0x5b, 0x71,
-  0x64, 0x72, 0x74, 0x75, 0x75, 0x76, 0x74, 0x77, 0x72, 0x78, 0x6e, 0x78,
-  0x6a, 0x79, 0x65, 0x79, 0x63, 0x77, 0x62, 0x76, 0x62, 0x76, 0x70, 0x75,
-  0x7f, 0x74, 0x6e, 0x74, 0x5c, 0x79, 0x5b, 0x79, 0x5a, 0x75, 0x59, 0x75,
-  0x58, 0x75, 0x57, 0x75, 0x57, 0x76, 0x58, 0x76, 0x59, 0x77, 0x5b, 0x78,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5c, 0x79, 0x5d, 0x78, 0x5c, 0x78,
-  0x5e, 0x78, 0x60, 0x77, 0x66, 0x76, 0x6b, 0x75, 0x73, 0x75, 0x77, 0x74,
-  0x78, 0x73, 0x77, 0x73, 0x77, 0x73, 0x77, 0x72, 0x77, 0x72, 0x77, 0x72,
-  0x77, 0x72, 0x77, 0x72, 0x77, 0x71, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x70,
-  0x76, 0x70, 0x76, 0x71, 0x76, 0x70, 0x76, 0x70, 0x76, 0x70, 0x76, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x71,
-  0x78, 0x71, 0x77, 0x71, 0x78, 0x72, 0x78, 0x72, 0x78, 0x72, 0x78, 0x73,
-  0x78, 0x73, 0x76, 0x72, 0x76, 0x75, 0x79, 0x78, 0x7f, 0x7e, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x80, 0x58, 0x54, 0x58, 0x54, 0x59, 0x53, 0x59, 0x56,
-  0x59, 0x55, 0x59, 0x54, 0x59, 0x53, 0x59, 0x59, 0x58, 0x59, 0x56, 0x5c,
-  0x54, 0x5f, 0x54, 0x60, 0x52, 0x62, 0x50, 0x65, 0x50, 0x65, 0x4f, 0x66,
-  0x4f, 0x66, 0x4e, 0x65, 0x4e, 0x68, 0x51, 0x68, 0x5d, 0x68, 0x62, 0x6a,
-  0x66, 0x6a, 0x6b, 0x6b, 0x6a, 0x6d, 0x68, 0x6e, 0x66, 0x6e, 0x61, 0x6d,
-  0x5b, 0x6d, 0x57, 0x6e, 0x53, 0x70, 0x4c, 0x70, 0x49, 0x70, 0x4a, 0x6f,
-  0x4a, 0x6f, 0x47, 0x6f, 0x46, 0x6f, 0x44, 0x6f, 0x42, 0x6e, 0x40, 0x6d,
-  0x3b, 0x6c, 0x3a, 0x6c, 0x39, 0x6b, 0x3a, 0x69, 0x3b, 0x66, 0x3d, 0x62,
-  0x40, 0x5f, 0x41, 0x60, 0x40, 0x64, 0x3e, 0x67, 0x3e, 0x69, 0x42, 0x6e,
-  0x44, 0x6e, 0x42, 0x6f, 0x3f, 0x6b, 0x41, 0x68, 0x43, 0x64, 0x43, 0x64,
-  0x41, 0x64, 0x40, 0x65, 0x3e, 0x68, 0x42, 0x6a, 0x49, 0x6a, 0x50, 0x6d,
-  0x55, 0x70, 0x59, 0x72, 0x5c, 0x75, 0x5c, 0x75, 0x5f, 0x75, 0x58, 0x73,
-  0x51, 0x74, 0x54, 0x74, 0x58, 0x72, 0x56, 0x72, 0x54, 0x71, 0x54, 0x6f,
-  0x54, 0x6e, 0x53, 0x6f, 0x5b, 0x71, 0x6a, 0x72, 0x75, 0x73, 0x7f, 0x75,
-  0x7b, 0x74, 0x77, 0x75, 0x74, 0x76, 0x6f, 0x76, 0x6b, 0x78, 0x66, 0x78,
-  0x63, 0x76, 0x67, 0x74, 0x6b, 0x73, 0x7e, 0x76, 0x85, 0x76, 0x70, 0x79,
-  0x61, 0x7d, 0x5e, 0x7c, 0x5a, 0x75, 0x5b, 0x76, 0x59, 0x75, 0x57, 0x75,
-  0x58, 0x76, 0x58, 0x77, 0x5a, 0x78, 0x5c, 0x78, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5d, 0x79, 0x5d, 0x79, 0x5d, 0x78, 0x5f, 0x78, 0x62, 0x77,
-  0x69, 0x78, 0x6d, 0x76, 0x74, 0x75, 0x77, 0x74, 0x77, 0x73, 0x77, 0x73,
-  0x77, 0x73, 0x77, 0x73, 0x77, 0x73, 0x77, 0x74, 0x77, 0x72, 0x77, 0x72,
-  0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x75, 0x71, 0x75, 0x70,
-  0x75, 0x70, 0x75, 0x70, 0x75, 0x70, 0x75, 0x70, 0x76, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x77, 0x72,
-  0x77, 0x72, 0x78, 0x72, 0x78, 0x72, 0x78, 0x73, 0x78, 0x74, 0x78, 0x72,
-  0x77, 0x75, 0x7a, 0x78, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-  0x58, 0x53, 0x58, 0x53, 0x58, 0x53, 0x57, 0x56, 0x57, 0x55, 0x57, 0x54,
-  0x57, 0x54, 0x57, 0x58, 0x56, 0x5a, 0x54, 0x5d, 0x53, 0x5f, 0x52, 0x60,
-  0x51, 0x62, 0x50, 0x65, 0x50, 0x65, 0x4f, 0x66, 0x4e, 0x66, 0x4e, 0x65,
-  0x4e, 0x69, 0x4e, 0x68, 0x57, 0x68, 0x5e, 0x6a, 0x61, 0x6a, 0x67, 0x6a,
-  0x6a, 0x6b, 0x6a, 0x6d, 0x69, 0x6e, 0x67, 0x6e, 0x61, 0x6e, 0x5d, 0x6e,
-  0x57, 0x6e, 0x50, 0x6e, 0x4a, 0x6e, 0x45, 0x6e, 0x43, 0x6f, 0x41, 0x6f,
-  0x41, 0x6d, 0x3f, 0x6d, 0x3e, 0x6c, 0x3c, 0x6b, 0x39, 0x6a, 0x39, 0x6a,
-  0x38, 0x6a, 0x39, 0x68, 0x3b, 0x65, 0x3d, 0x62, 0x40, 0x5f, 0x41, 0x5f,
-  0x40, 0x65, 0x3e, 0x69, 0x42, 0x6c, 0x47, 0x6e, 0x45, 0x6e, 0x41, 0x6e,
-  0x3e, 0x6c, 0x40, 0x68, 0x42, 0x64, 0x43, 0x64, 0x42, 0x65, 0x41, 0x65,
-  0x3e, 0x68, 0x41, 0x6a, 0x46, 0x6a, 0x4f, 0x6d, 0x55, 0x6f, 0x59, 0x71,
-  0x5a, 0x75, 0x5a, 0x75, 0x5b, 0x73, 0x54, 0x71, 0x4e, 0x73, 0x54, 0x74,
-  0x56, 0x72, 0x53, 0x73, 0x52, 0x73, 0x53, 0x71, 0x53, 0x6f, 0x55, 0x6f,
-  0x5f, 0x72, 0x6a, 0x74, 0x6d, 0x75, 0x73, 0x76, 0x76, 0x75, 0x7a, 0x75,
-  0x79, 0x74, 0x73, 0x75, 0x6c, 0x76, 0x68, 0x76, 0x67, 0x76, 0x72, 0x73,
-  0x7e, 0x74, 0x83, 0x78, 0x79, 0x7d, 0x67, 0x81, 0x5e, 0x81, 0x61, 0x7f,
-  0x5e, 0x77, 0x5a, 0x76, 0x5a, 0x76, 0x59, 0x75, 0x5a, 0x77, 0x5b, 0x78,
-  0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5d, 0x78,
-  0x5d, 0x78, 0x5f, 0x78, 0x61, 0x78, 0x64, 0x78, 0x6a, 0x78, 0x6f, 0x77,
-  0x75, 0x75, 0x78, 0x74, 0x77, 0x73, 0x77, 0x73, 0x77, 0x73, 0x77, 0x73,
-  0x77, 0x73, 0x77, 0x73, 0x77, 0x72, 0x77, 0x72, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x75, 0x70, 0x75, 0x70, 0x76, 0x71, 0x75, 0x71,
-  0x75, 0x71, 0x75, 0x70, 0x76, 0x71, 0x77, 0x71, 0x77, 0x71, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x77, 0x72, 0x77, 0x72, 0x78, 0x72,
-  0x78, 0x72, 0x78, 0x72, 0x78, 0x73, 0x79, 0x73, 0x79, 0x74, 0x7a, 0x77,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x57, 0x53, 0x57, 0x53,
-  0x58, 0x52, 0x57, 0x55, 0x56, 0x54, 0x57, 0x55, 0x56, 0x54, 0x55, 0x58,
-  0x54, 0x5a, 0x54, 0x5b, 0x52, 0x5d, 0x51, 0x5e, 0x50, 0x61, 0x50, 0x63,
-  0x50, 0x64, 0x4e, 0x66, 0x4e, 0x66, 0x4d, 0x65, 0x4d, 0x68, 0x4d, 0x68,
-  0x52, 0x69, 0x59, 0x69, 0x5e, 0x69, 0x65, 0x68, 0x69, 0x69, 0x6b, 0x6c,
-  0x6b, 0x6e, 0x6b, 0x6e, 0x66, 0x6e, 0x62, 0x6d, 0x5b, 0x6c, 0x54, 0x6c,
-  0x4b, 0x6c, 0x42, 0x6d, 0x40, 0x6f, 0x3e, 0x6f, 0x3e, 0x6c, 0x3d, 0x6c,
-  0x3b, 0x6a, 0x3a, 0x6a, 0x39, 0x69, 0x39, 0x69, 0x38, 0x67, 0x3a, 0x65,
-  0x3b, 0x64, 0x3e, 0x62, 0x40, 0x60, 0x40, 0x60, 0x3f, 0x66, 0x3e, 0x6b,
-  0x43, 0x6d, 0x48, 0x6e, 0x47, 0x6d, 0x42, 0x6e, 0x3e, 0x6b, 0x40, 0x68,
-  0x43, 0x64, 0x43, 0x64, 0x42, 0x65, 0x40, 0x65, 0x3e, 0x67, 0x40, 0x69,
-  0x45, 0x6a, 0x4f, 0x6c, 0x55, 0x6f, 0x58, 0x71, 0x59, 0x74, 0x59, 0x74,
-  0x58, 0x71, 0x51, 0x70, 0x4d, 0x72, 0x54, 0x74, 0x55, 0x73, 0x54, 0x73,
-  0x53, 0x74, 0x53, 0x71, 0x54, 0x6e, 0x59, 0x6f, 0x63, 0x72, 0x67, 0x74,
-  0x65, 0x76, 0x65, 0x77, 0x70, 0x75, 0x79, 0x74, 0x7a, 0x73, 0x77, 0x74,
-  0x70, 0x74, 0x6b, 0x75, 0x6c, 0x77, 0x75, 0x75, 0x84, 0x77, 0x7c, 0x78,
-  0x6e, 0x7e, 0x5f, 0x81, 0x5b, 0x83, 0x6b, 0x82, 0x68, 0x7a, 0x5a, 0x75,
-  0x5b, 0x76, 0x5b, 0x76, 0x5c, 0x76, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77,
-  0x5b, 0x77, 0x5c, 0x77, 0x5c, 0x77, 0x5d, 0x78, 0x5e, 0x78, 0x60, 0x78,
-  0x63, 0x78, 0x66, 0x77, 0x6c, 0x76, 0x71, 0x75, 0x76, 0x75, 0x78, 0x74,
-  0x78, 0x73, 0x77, 0x73, 0x77, 0x72, 0x77, 0x73, 0x77, 0x73, 0x77, 0x73,
-  0x77, 0x72, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x76, 0x70, 0x76, 0x70, 0x76, 0x6f, 0x76, 0x6f, 0x76, 0x70, 0x76, 0x70,
-  0x77, 0x70, 0x78, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x6f,
-  0x77, 0x70, 0x77, 0x71, 0x78, 0x71, 0x78, 0x71, 0x78, 0x71, 0x79, 0x71,
-  0x79, 0x73, 0x7a, 0x74, 0x7a, 0x74, 0x7b, 0x75, 0x7e, 0x7e, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x56, 0x50, 0x57, 0x50, 0x58, 0x4f, 0x57, 0x51,
-  0x57, 0x51, 0x57, 0x52, 0x56, 0x55, 0x55, 0x57, 0x53, 0x59, 0x53, 0x5a,
-  0x52, 0x5b, 0x51, 0x5d, 0x50, 0x5f, 0x4f, 0x61, 0x4f, 0x63, 0x4e, 0x66,
-  0x4e, 0x66, 0x4d, 0x66, 0x4d, 0x66, 0x4d, 0x67, 0x4f, 0x68, 0x54, 0x68,
-  0x5b, 0x68, 0x62, 0x68, 0x65, 0x69, 0x6a, 0x6c, 0x6c, 0x6c, 0x6d, 0x6d,
-  0x6a, 0x6e, 0x68, 0x6d, 0x61, 0x6d, 0x5a, 0x6c, 0x51, 0x6c, 0x45, 0x6c,
-  0x3e, 0x6d, 0x3b, 0x6e, 0x3c, 0x6c, 0x3c, 0x6a, 0x3b, 0x69, 0x3b, 0x69,
-  0x3b, 0x68, 0x3a, 0x67, 0x3a, 0x65, 0x3b, 0x63, 0x3c, 0x63, 0x3e, 0x62,
-  0x40, 0x61, 0x3f, 0x62, 0x3f, 0x68, 0x3f, 0x6b, 0x43, 0x6d, 0x48, 0x6e,
-  0x49, 0x6e, 0x42, 0x6c, 0x3e, 0x6a, 0x40, 0x67, 0x43, 0x64, 0x44, 0x65,
-  0x43, 0x65, 0x41, 0x64, 0x3f, 0x65, 0x3e, 0x67, 0x44, 0x68, 0x4e, 0x6b,
-  0x54, 0x6e, 0x57, 0x70, 0x58, 0x72, 0x58, 0x72, 0x57, 0x70, 0x4f, 0x70,
-  0x4d, 0x71, 0x54, 0x75, 0x55, 0x75, 0x5a, 0x72, 0x58, 0x72, 0x51, 0x70,
-  0x58, 0x72, 0x70, 0x74, 0x6e, 0x74, 0x69, 0x77, 0x66, 0x79, 0x63, 0x78,
-  0x67, 0x75, 0x6e, 0x73, 0x76, 0x73, 0x7e, 0x73, 0x78, 0x74, 0x6c, 0x76,
-  0x6a, 0x76, 0x73, 0x75, 0x7e, 0x75, 0x74, 0x7d, 0x67, 0x80, 0x5d, 0x7e,
-  0x63, 0x83, 0x78, 0x81, 0x6f, 0x7b, 0x5a, 0x75, 0x5b, 0x77, 0x5d, 0x78,
-  0x5c, 0x76, 0x5b, 0x75, 0x5b, 0x76, 0x5b, 0x77, 0x5c, 0x77, 0x5d, 0x77,
-  0x5d, 0x77, 0x5d, 0x78, 0x5f, 0x78, 0x61, 0x78, 0x66, 0x77, 0x69, 0x77,
-  0x6e, 0x74, 0x74, 0x74, 0x77, 0x74, 0x78, 0x73, 0x78, 0x73, 0x78, 0x72,
-  0x78, 0x72, 0x77, 0x72, 0x77, 0x72, 0x77, 0x72, 0x78, 0x70, 0x78, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6d, 0x77, 0x6e, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f,
-  0x78, 0x6f, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x70, 0x7a, 0x72, 0x7a, 0x73,
-  0x7a, 0x73, 0x7b, 0x74, 0x7e, 0x7d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-  0x57, 0x4f, 0x57, 0x4f, 0x57, 0x4e, 0x57, 0x4f, 0x56, 0x50, 0x56, 0x53,
-  0x55, 0x55, 0x54, 0x57, 0x53, 0x5a, 0x53, 0x5a, 0x52, 0x5b, 0x51, 0x5d,
-  0x50, 0x5f, 0x4f, 0x62, 0x4f, 0x63, 0x4e, 0x63, 0x4d, 0x63, 0x4d, 0x65,
-  0x4d, 0x66, 0x4d, 0x65, 0x4d, 0x66, 0x4f, 0x68, 0x54, 0x68, 0x5d, 0x69,
-  0x62, 0x6a, 0x68, 0x6d, 0x6c, 0x6c, 0x6f, 0x6d, 0x6e, 0x6e, 0x6c, 0x6d,
-  0x67, 0x6d, 0x61, 0x6d, 0x59, 0x6a, 0x4c, 0x6a, 0x3f, 0x6b, 0x3a, 0x6b,
-  0x3c, 0x6a, 0x3c, 0x68, 0x3d, 0x68, 0x3d, 0x68, 0x3c, 0x66, 0x3b, 0x65,
-  0x3b, 0x64, 0x3b, 0x63, 0x3c, 0x63, 0x3f, 0x61, 0x40, 0x62, 0x3f, 0x64,
-  0x3e, 0x69, 0x40, 0x6b, 0x45, 0x6e, 0x48, 0x6e, 0x48, 0x6e, 0x41, 0x6c,
-  0x3f, 0x69, 0x41, 0x68, 0x43, 0x64, 0x43, 0x64, 0x43, 0x65, 0x42, 0x64,
-  0x40, 0x65, 0x3e, 0x68, 0x41, 0x68, 0x49, 0x6b, 0x52, 0x6e, 0x56, 0x70,
-  0x56, 0x72, 0x57, 0x72, 0x55, 0x70, 0x4d, 0x70, 0x4e, 0x71, 0x53, 0x74,
-  0x56, 0x75, 0x5d, 0x73, 0x51, 0x6f, 0x47, 0x74, 0x63, 0x7d, 0x74, 0x7f,
-  0x69, 0x7c, 0x5f, 0x7d, 0x5f, 0x7c, 0x65, 0x79, 0x61, 0x77, 0x63, 0x74,
-  0x72, 0x73, 0x7d, 0x73, 0x7b, 0x74, 0x71, 0x76, 0x6d, 0x76, 0x6d, 0x73,
-  0x6f, 0x75, 0x69, 0x80, 0x61, 0x7e, 0x61, 0x7b, 0x77, 0x7f, 0x84, 0x80,
-  0x6f, 0x7b, 0x5c, 0x75, 0x5c, 0x77, 0x5d, 0x78, 0x5c, 0x77, 0x5b, 0x75,
-  0x5b, 0x76, 0x5c, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5f, 0x78,
-  0x61, 0x78, 0x63, 0x77, 0x67, 0x78, 0x6c, 0x77, 0x72, 0x74, 0x76, 0x74,
-  0x77, 0x75, 0x78, 0x73, 0x78, 0x73, 0x78, 0x72, 0x78, 0x72, 0x77, 0x72,
-  0x77, 0x72, 0x77, 0x72, 0x78, 0x70, 0x78, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x71, 0x78, 0x71, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6e, 0x77, 0x6e,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x70,
-  0x78, 0x70, 0x7a, 0x70, 0x7a, 0x71, 0x7a, 0x71, 0x7a, 0x71, 0x7b, 0x73,
-  0x7f, 0x7d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x56, 0x52, 0x56, 0x52,
-  0x57, 0x51, 0x56, 0x53, 0x55, 0x54, 0x55, 0x56, 0x54, 0x57, 0x53, 0x57,
-  0x53, 0x5a, 0x53, 0x5b, 0x52, 0x5b, 0x50, 0x5e, 0x50, 0x60, 0x4f, 0x61,
-  0x4e, 0x63, 0x4d, 0x63, 0x4d, 0x63, 0x4d, 0x66, 0x4d, 0x66, 0x4c, 0x65,
-  0x4d, 0x65, 0x4e, 0x67, 0x51, 0x68, 0x5a, 0x68, 0x5f, 0x6a, 0x66, 0x6b,
-  0x6b, 0x6c, 0x6f, 0x6d, 0x71, 0x6e, 0x6f, 0x6d, 0x6b, 0x6d, 0x64, 0x6d,
-  0x5d, 0x6a, 0x50, 0x69, 0x42, 0x6a, 0x3b, 0x6a, 0x3c, 0x69, 0x3c, 0x67,
-  0x3e, 0x67, 0x3e, 0x67, 0x3d, 0x65, 0x3d, 0x64, 0x3c, 0x63, 0x3b, 0x63,
-  0x3c, 0x63, 0x3e, 0x62, 0x3f, 0x63, 0x3e, 0x65, 0x3f, 0x6a, 0x42, 0x6b,
-  0x46, 0x6d, 0x49, 0x6e, 0x48, 0x6e, 0x41, 0x6c, 0x3f, 0x69, 0x41, 0x68,
-  0x44, 0x65, 0x44, 0x64, 0x43, 0x65, 0x42, 0x64, 0x40, 0x65, 0x3e, 0x67,
-  0x3f, 0x69, 0x46, 0x6c, 0x50, 0x6f, 0x54, 0x71, 0x55, 0x72, 0x56, 0x72,
-  0x53, 0x71, 0x4c, 0x70, 0x4f, 0x72, 0x53, 0x75, 0x54, 0x75, 0x59, 0x72,
-  0x45, 0x71, 0x47, 0x7b, 0x66, 0x83, 0x62, 0x87, 0x62, 0x87, 0x5d, 0x7f,
-  0x59, 0x7d, 0x63, 0x7b, 0x61, 0x79, 0x62, 0x77, 0x70, 0x73, 0x76, 0x73,
-  0x78, 0x74, 0x75, 0x76, 0x74, 0x76, 0x6b, 0x75, 0x66, 0x76, 0x62, 0x7b,
-  0x61, 0x7c, 0x68, 0x7a, 0x77, 0x7d, 0x74, 0x80, 0x66, 0x7c, 0x5d, 0x75,
-  0x5d, 0x77, 0x5d, 0x78, 0x5c, 0x77, 0x5c, 0x75, 0x5b, 0x76, 0x5b, 0x77,
-  0x5c, 0x78, 0x5d, 0x77, 0x5d, 0x77, 0x60, 0x78, 0x62, 0x78, 0x64, 0x77,
-  0x68, 0x77, 0x6f, 0x77, 0x75, 0x75, 0x77, 0x74, 0x77, 0x75, 0x78, 0x74,
-  0x78, 0x73, 0x78, 0x72, 0x78, 0x72, 0x77, 0x72, 0x77, 0x72, 0x77, 0x72,
-  0x78, 0x70, 0x78, 0x70, 0x77, 0x70, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6e, 0x77, 0x6e, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f,
-  0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x71, 0x78, 0x71, 0x7a, 0x70,
-  0x7b, 0x71, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x72, 0x7f, 0x7d, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x53, 0x55, 0x53, 0x54, 0x55, 0x51, 0x54, 0x56,
-  0x54, 0x56, 0x54, 0x56, 0x53, 0x59, 0x53, 0x59, 0x52, 0x5a, 0x52, 0x5c,
-  0x51, 0x5d, 0x4f, 0x5f, 0x4f, 0x60, 0x4f, 0x61, 0x4e, 0x63, 0x4d, 0x65,
-  0x4c, 0x65, 0x4c, 0x66, 0x4c, 0x65, 0x4c, 0x66, 0x4d, 0x67, 0x4e, 0x67,
-  0x4f, 0x67, 0x54, 0x68, 0x5b, 0x68, 0x63, 0x69, 0x68, 0x6b, 0x6e, 0x6d,
-  0x72, 0x6f, 0x72, 0x6f, 0x70, 0x6f, 0x68, 0x6c, 0x62, 0x6b, 0x54, 0x68,
-  0x48, 0x68, 0x3e, 0x68, 0x3c, 0x68, 0x3c, 0x68, 0x3e, 0x67, 0x3f, 0x65,
-  0x3e, 0x64, 0x3d, 0x64, 0x3d, 0x63, 0x3d, 0x63, 0x3d, 0x63, 0x3f, 0x63,
-  0x3f, 0x65, 0x3e, 0x68, 0x3e, 0x6b, 0x44, 0x6e, 0x46, 0x6e, 0x4b, 0x6d,
-  0x48, 0x6e, 0x40, 0x6b, 0x3f, 0x69, 0x41, 0x68, 0x43, 0x65, 0x44, 0x65,
-  0x44, 0x66, 0x43, 0x65, 0x41, 0x65, 0x3f, 0x66, 0x3f, 0x69, 0x46, 0x6e,
-  0x4e, 0x71, 0x50, 0x73, 0x54, 0x72, 0x53, 0x72, 0x4d, 0x72, 0x4c, 0x72,
-  0x4f, 0x74, 0x50, 0x77, 0x51, 0x75, 0x4d, 0x72, 0x45, 0x73, 0x52, 0x7d,
-  0x67, 0x83, 0x61, 0x87, 0x50, 0x8c, 0x57, 0x85, 0x53, 0x7f, 0x5d, 0x7c,
-  0x61, 0x80, 0x65, 0x7f, 0x73, 0x75, 0x76, 0x74, 0x76, 0x74, 0x74, 0x74,
-  0x72, 0x75, 0x6c, 0x77, 0x6a, 0x77, 0x62, 0x76, 0x63, 0x78, 0x72, 0x7c,
-  0x73, 0x7e, 0x66, 0x7e, 0x5f, 0x79, 0x5d, 0x77, 0x5d, 0x77, 0x5e, 0x77,
-  0x5d, 0x77, 0x5d, 0x77, 0x5c, 0x77, 0x5b, 0x77, 0x5b, 0x77, 0x5d, 0x77,
-  0x5f, 0x77, 0x62, 0x78, 0x64, 0x78, 0x69, 0x78, 0x6d, 0x78, 0x73, 0x78,
-  0x77, 0x77, 0x78, 0x75, 0x78, 0x74, 0x78, 0x76, 0x78, 0x75, 0x78, 0x74,
-  0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x72, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x78, 0x70, 0x76, 0x70, 0x75, 0x70, 0x78, 0x6f, 0x77, 0x6f,
-  0x76, 0x6f, 0x76, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f,
-  0x78, 0x6f, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x6f, 0x7b, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x72, 0x7e, 0x7c, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x53, 0x55, 0x53, 0x54, 0x54, 0x52, 0x53, 0x57, 0x54, 0x57, 0x54, 0x56,
-  0x53, 0x58, 0x53, 0x59, 0x52, 0x5a, 0x51, 0x5c, 0x50, 0x5d, 0x4e, 0x5e,
-  0x4e, 0x60, 0x4e, 0x60, 0x4e, 0x63, 0x4c, 0x66, 0x4c, 0x66, 0x4b, 0x65,
-  0x4c, 0x65, 0x4c, 0x67, 0x4c, 0x67, 0x4d, 0x67, 0x4f, 0x67, 0x51, 0x68,
-  0x56, 0x68, 0x5f, 0x69, 0x65, 0x6b, 0x6a, 0x6e, 0x70, 0x70, 0x72, 0x70,
-  0x72, 0x70, 0x6e, 0x6e, 0x68, 0x6d, 0x5b, 0x69, 0x50, 0x67, 0x44, 0x68,
-  0x3c, 0x68, 0x3c, 0x68, 0x3e, 0x66, 0x3f, 0x63, 0x3f, 0x62, 0x3f, 0x63,
-  0x3e, 0x63, 0x3e, 0x63, 0x3e, 0x64, 0x3e, 0x64, 0x3e, 0x66, 0x3d, 0x6a,
-  0x3e, 0x6c, 0x44, 0x6e, 0x46, 0x6e, 0x4a, 0x6e, 0x47, 0x6d, 0x3e, 0x6b,
-  0x3e, 0x68, 0x41, 0x67, 0x43, 0x64, 0x44, 0x65, 0x44, 0x66, 0x43, 0x66,
-  0x41, 0x65, 0x3f, 0x66, 0x41, 0x68, 0x48, 0x6e, 0x4e, 0x71, 0x50, 0x73,
-  0x52, 0x73, 0x51, 0x73, 0x4e, 0x72, 0x50, 0x71, 0x51, 0x73, 0x4f, 0x75,
-  0x4d, 0x74, 0x49, 0x74, 0x4e, 0x77, 0x60, 0x7b, 0x8a, 0x83, 0x88, 0x86,
-  0x5b, 0x8a, 0x51, 0x8b, 0x55, 0x85, 0x58, 0x7b, 0x61, 0x82, 0x67, 0x81,
-  0x7b, 0x75, 0x7d, 0x75, 0x78, 0x75, 0x74, 0x75, 0x71, 0x75, 0x70, 0x74,
-  0x71, 0x74, 0x68, 0x74, 0x67, 0x79, 0x75, 0x7d, 0x75, 0x7d, 0x67, 0x78,
-  0x5d, 0x76, 0x5d, 0x77, 0x5d, 0x77, 0x5d, 0x77, 0x5e, 0x77, 0x5d, 0x77,
-  0x5d, 0x77, 0x5c, 0x77, 0x5d, 0x77, 0x5f, 0x76, 0x61, 0x77, 0x65, 0x78,
-  0x67, 0x78, 0x6b, 0x78, 0x70, 0x78, 0x75, 0x78, 0x78, 0x77, 0x78, 0x76,
-  0x78, 0x75, 0x78, 0x75, 0x78, 0x75, 0x78, 0x74, 0x78, 0x73, 0x78, 0x73,
-  0x78, 0x73, 0x78, 0x72, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x76, 0x70, 0x75, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x76, 0x6f, 0x75, 0x6f,
-  0x76, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x70,
-  0x78, 0x70, 0x7a, 0x6f, 0x7b, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x72,
-  0x7e, 0x7b, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x52, 0x55, 0x53, 0x54,
-  0x52, 0x54, 0x52, 0x58, 0x53, 0x57, 0x54, 0x56, 0x54, 0x57, 0x53, 0x57,
-  0x51, 0x59, 0x51, 0x5c, 0x50, 0x5d, 0x4f, 0x5e, 0x4e, 0x60, 0x4e, 0x61,
-  0x4e, 0x62, 0x4c, 0x65, 0x4c, 0x65, 0x4c, 0x66, 0x4c, 0x66, 0x4c, 0x67,
-  0x4c, 0x67, 0x4d, 0x67, 0x4f, 0x67, 0x50, 0x67, 0x53, 0x67, 0x5b, 0x69,
-  0x62, 0x6a, 0x68, 0x6d, 0x6e, 0x6f, 0x72, 0x70, 0x74, 0x71, 0x73, 0x6f,
-  0x6e, 0x6e, 0x62, 0x6b, 0x58, 0x68, 0x4c, 0x68, 0x3e, 0x69, 0x3b, 0x68,
-  0x3e, 0x65, 0x3f, 0x62, 0x40, 0x61, 0x40, 0x61, 0x40, 0x63, 0x3f, 0x64,
-  0x3f, 0x65, 0x3e, 0x66, 0x3e, 0x68, 0x3d, 0x6b, 0x3f, 0x6e, 0x44, 0x6e,
-  0x46, 0x6e, 0x48, 0x6e, 0x46, 0x6e, 0x3e, 0x6c, 0x3e, 0x68, 0x40, 0x68,
-  0x43, 0x65, 0x44, 0x65, 0x44, 0x66, 0x44, 0x66, 0x42, 0x65, 0x41, 0x65,
-  0x43, 0x68, 0x49, 0x6e, 0x4f, 0x71, 0x51, 0x73, 0x51, 0x74, 0x52, 0x74,
-  0x54, 0x72, 0x64, 0x72, 0x6e, 0x73, 0x60, 0x75, 0x4f, 0x74, 0x55, 0x77,
-  0x5e, 0x79, 0x66, 0x7a, 0x8c, 0x80, 0x8e, 0x81, 0x72, 0x85, 0x61, 0x8a,
-  0x69, 0x85, 0x61, 0x7d, 0x6c, 0x81, 0x69, 0x7e, 0x7c, 0x76, 0x82, 0x77,
-  0x7a, 0x76, 0x71, 0x77, 0x6a, 0x78, 0x6c, 0x77, 0x70, 0x77, 0x6a, 0x78,
-  0x6c, 0x7b, 0x77, 0x7e, 0x75, 0x7c, 0x69, 0x79, 0x5c, 0x77, 0x5d, 0x77,
-  0x5e, 0x77, 0x5e, 0x77, 0x5e, 0x77, 0x5e, 0x77, 0x5d, 0x77, 0x5e, 0x77,
-  0x5f, 0x77, 0x60, 0x77, 0x63, 0x77, 0x68, 0x78, 0x6a, 0x78, 0x6e, 0x78,
-  0x73, 0x78, 0x77, 0x78, 0x79, 0x77, 0x79, 0x77, 0x78, 0x77, 0x78, 0x76,
-  0x78, 0x75, 0x79, 0x74, 0x78, 0x73, 0x78, 0x73, 0x78, 0x72, 0x78, 0x72,
-  0x77, 0x71, 0x77, 0x70, 0x78, 0x70, 0x78, 0x71, 0x76, 0x70, 0x76, 0x71,
-  0x77, 0x70, 0x78, 0x6f, 0x76, 0x6f, 0x75, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x70, 0x78, 0x70, 0x7a, 0x6f,
-  0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x73, 0x7e, 0x7b, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x7f, 0x51, 0x54, 0x51, 0x54, 0x51, 0x57, 0x51, 0x58,
-  0x52, 0x57, 0x53, 0x57, 0x53, 0x58, 0x54, 0x57, 0x52, 0x59, 0x51, 0x5c,
-  0x51, 0x5f, 0x4f, 0x60, 0x4e, 0x61, 0x4e, 0x62, 0x4e, 0x62, 0x4c, 0x64,
-  0x4c, 0x66, 0x4c, 0x67, 0x4c, 0x67, 0x4c, 0x67, 0x4c, 0x67, 0x4d, 0x65,
-  0x4e, 0x66, 0x4f, 0x67, 0x50, 0x67, 0x57, 0x69, 0x60, 0x6a, 0x66, 0x6c,
-  0x6e, 0x6f, 0x71, 0x71, 0x75, 0x70, 0x77, 0x70, 0x74, 0x6f, 0x6a, 0x6c,
-  0x60, 0x69, 0x56, 0x67, 0x47, 0x68, 0x3f, 0x68, 0x3c, 0x65, 0x3e, 0x63,
-  0x40, 0x63, 0x41, 0x63, 0x41, 0x63, 0x40, 0x64, 0x40, 0x66, 0x3f, 0x67,
-  0x3d, 0x6a, 0x3c, 0x6b, 0x40, 0x6f, 0x44, 0x6e, 0x46, 0x6e, 0x46, 0x6e,
-  0x43, 0x6e, 0x3d, 0x6c, 0x3e, 0x69, 0x40, 0x69, 0x42, 0x67, 0x43, 0x66,
-  0x44, 0x66, 0x44, 0x66, 0x43, 0x65, 0x42, 0x66, 0x45, 0x69, 0x4b, 0x70,
-  0x52, 0x73, 0x54, 0x73, 0x54, 0x73, 0x57, 0x75, 0x5f, 0x76, 0x73, 0x76,
-  0x80, 0x79, 0x73, 0x77, 0x56, 0x77, 0x63, 0x7d, 0x62, 0x7b, 0x5c, 0x7e,
-  0x76, 0x80, 0x80, 0x80, 0x73, 0x84, 0x6e, 0x86, 0x73, 0x85, 0x6f, 0x82,
-  0x7b, 0x83, 0x71, 0x7f, 0x72, 0x79, 0x7c, 0x78, 0x78, 0x79, 0x67, 0x7b,
-  0x64, 0x7c, 0x65, 0x7f, 0x68, 0x84, 0x68, 0x86, 0x6e, 0x7f, 0x7a, 0x7e,
-  0x6f, 0x7d, 0x65, 0x7d, 0x5c, 0x78, 0x5e, 0x78, 0x5f, 0x78, 0x5f, 0x78,
-  0x5f, 0x77, 0x5f, 0x77, 0x5e, 0x77, 0x5f, 0x77, 0x61, 0x77, 0x63, 0x77,
-  0x65, 0x77, 0x6a, 0x77, 0x6e, 0x77, 0x72, 0x78, 0x77, 0x77, 0x7a, 0x77,
-  0x7b, 0x78, 0x7a, 0x77, 0x7a, 0x77, 0x7a, 0x76, 0x7a, 0x75, 0x7a, 0x74,
-  0x7a, 0x74, 0x79, 0x73, 0x77, 0x73, 0x78, 0x72, 0x78, 0x72, 0x78, 0x72,
-  0x77, 0x72, 0x77, 0x72, 0x77, 0x70, 0x77, 0x71, 0x78, 0x71, 0x77, 0x71,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x71, 0x7b, 0x72,
-  0x79, 0x73, 0x7a, 0x74, 0x7e, 0x7d, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x51, 0x55, 0x51, 0x55, 0x51, 0x57, 0x52, 0x58, 0x53, 0x58, 0x53, 0x58,
-  0x53, 0x59, 0x53, 0x58, 0x52, 0x5a, 0x51, 0x5d, 0x50, 0x5f, 0x4f, 0x60,
-  0x4e, 0x62, 0x4e, 0x62, 0x4e, 0x62, 0x4c, 0x65, 0x4c, 0x67, 0x4c, 0x67,
-  0x4b, 0x67, 0x4c, 0x67, 0x4d, 0x67, 0x4d, 0x66, 0x4e, 0x66, 0x4f, 0x67,
-  0x51, 0x67, 0x56, 0x69, 0x5c, 0x6a, 0x64, 0x6b, 0x6b, 0x6d, 0x6f, 0x70,
-  0x75, 0x70, 0x78, 0x70, 0x76, 0x70, 0x6e, 0x6d, 0x66, 0x6b, 0x5c, 0x68,
-  0x4e, 0x68, 0x45, 0x68, 0x3d, 0x67, 0x3d, 0x64, 0x40, 0x63, 0x42, 0x63,
-  0x41, 0x62, 0x41, 0x65, 0x41, 0x66, 0x3f, 0x68, 0x3d, 0x6a, 0x3c, 0x6b,
-  0x40, 0x6e, 0x42, 0x6e, 0x45, 0x6e, 0x44, 0x6e, 0x40, 0x6e, 0x3c, 0x6c,
-  0x3e, 0x6a, 0x40, 0x69, 0x42, 0x68, 0x43, 0x66, 0x44, 0x65, 0x45, 0x65,
-  0x44, 0x65, 0x42, 0x66, 0x45, 0x69, 0x4c, 0x70, 0x54, 0x73, 0x55, 0x72,
-  0x55, 0x74, 0x5c, 0x77, 0x66, 0x78, 0x6e, 0x7a, 0x76, 0x7b, 0x73, 0x78,
-  0x5b, 0x7b, 0x61, 0x7e, 0x5e, 0x7b, 0x57, 0x81, 0x5e, 0x83, 0x64, 0x83,
-  0x5c, 0x85, 0x68, 0x85, 0x70, 0x83, 0x6e, 0x81, 0x70, 0x82, 0x6a, 0x80,
-  0x70, 0x7d, 0x79, 0x7b, 0x76, 0x80, 0x68, 0x86, 0x68, 0x88, 0x66, 0x89,
-  0x66, 0x8a, 0x6a, 0x86, 0x73, 0x80, 0x78, 0x7e, 0x6c, 0x7d, 0x63, 0x7d,
-  0x5e, 0x78, 0x60, 0x78, 0x60, 0x78, 0x60, 0x78, 0x60, 0x77, 0x60, 0x77,
-  0x60, 0x77, 0x62, 0x77, 0x64, 0x77, 0x65, 0x77, 0x68, 0x77, 0x6d, 0x77,
-  0x71, 0x77, 0x76, 0x77, 0x79, 0x77, 0x7b, 0x77, 0x7b, 0x77, 0x7b, 0x77,
-  0x7b, 0x77, 0x7a, 0x76, 0x7b, 0x75, 0x7a, 0x75, 0x7a, 0x75, 0x79, 0x74,
-  0x78, 0x73, 0x78, 0x73, 0x78, 0x72, 0x78, 0x72, 0x77, 0x72, 0x77, 0x72,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x77, 0x71, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x71, 0x7b, 0x72, 0x79, 0x73, 0x7a, 0x74,
-  0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x51, 0x57, 0x51, 0x58,
-  0x51, 0x58, 0x51, 0x58, 0x52, 0x59, 0x53, 0x5a, 0x53, 0x59, 0x53, 0x5a,
-  0x52, 0x5c, 0x51, 0x5f, 0x50, 0x60, 0x4f, 0x60, 0x4f, 0x62, 0x4e, 0x62,
-  0x4e, 0x62, 0x4c, 0x64, 0x4c, 0x67, 0x4c, 0x67, 0x4b, 0x67, 0x4c, 0x67,
-  0x4c, 0x67, 0x4d, 0x66, 0x4e, 0x66, 0x4f, 0x67, 0x51, 0x67, 0x54, 0x69,
-  0x58, 0x6b, 0x60, 0x6a, 0x67, 0x6b, 0x6c, 0x6d, 0x75, 0x70, 0x77, 0x70,
-  0x77, 0x72, 0x74, 0x6f, 0x6d, 0x6d, 0x64, 0x6a, 0x58, 0x68, 0x4f, 0x68,
-  0x41, 0x68, 0x3d, 0x66, 0x40, 0x64, 0x42, 0x63, 0x42, 0x62, 0x42, 0x65,
-  0x42, 0x67, 0x3f, 0x68, 0x3e, 0x6a, 0x3d, 0x6b, 0x3f, 0x6d, 0x41, 0x6e,
-  0x42, 0x6e, 0x40, 0x6e, 0x3c, 0x6d, 0x3b, 0x6c, 0x3e, 0x6a, 0x3f, 0x69,
-  0x42, 0x67, 0x43, 0x65, 0x44, 0x66, 0x44, 0x66, 0x44, 0x65, 0x42, 0x66,
-  0x45, 0x69, 0x4d, 0x70, 0x56, 0x72, 0x57, 0x72, 0x5a, 0x76, 0x5d, 0x78,
-  0x66, 0x79, 0x72, 0x7f, 0x77, 0x83, 0x76, 0x80, 0x5c, 0x80, 0x53, 0x7f,
-  0x50, 0x7b, 0x53, 0x7d, 0x54, 0x85, 0x4d, 0x87, 0x55, 0x86, 0x6e, 0x83,
-  0x68, 0x81, 0x62, 0x7f, 0x64, 0x80, 0x65, 0x7f, 0x70, 0x80, 0x7a, 0x82,
-  0x76, 0x85, 0x6a, 0x89, 0x69, 0x88, 0x67, 0x85, 0x65, 0x82, 0x6f, 0x81,
-  0x7b, 0x81, 0x73, 0x7e, 0x67, 0x7c, 0x62, 0x7c, 0x5f, 0x78, 0x62, 0x78,
-  0x62, 0x78, 0x61, 0x78, 0x62, 0x78, 0x62, 0x77, 0x63, 0x77, 0x66, 0x77,
-  0x68, 0x77, 0x69, 0x77, 0x6d, 0x77, 0x73, 0x77, 0x77, 0x78, 0x7b, 0x77,
-  0x7b, 0x77, 0x7b, 0x77, 0x7b, 0x77, 0x7b, 0x77, 0x7b, 0x77, 0x7a, 0x76,
-  0x7a, 0x76, 0x7a, 0x75, 0x7a, 0x75, 0x79, 0x74, 0x78, 0x72, 0x78, 0x73,
-  0x78, 0x72, 0x78, 0x72, 0x77, 0x72, 0x77, 0x72, 0x77, 0x71, 0x77, 0x70,
-  0x77, 0x71, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f,
-  0x79, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x71, 0x7a, 0x72, 0x79, 0x73, 0x7a, 0x74, 0x7e, 0x7d, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x52, 0x56, 0x51, 0x59, 0x51, 0x59, 0x51, 0x59,
-  0x52, 0x5a, 0x53, 0x5a, 0x53, 0x58, 0x53, 0x5b, 0x52, 0x5f, 0x51, 0x5f,
-  0x50, 0x60, 0x50, 0x61, 0x50, 0x62, 0x4e, 0x60, 0x4e, 0x61, 0x4d, 0x66,
-  0x4e, 0x66, 0x4c, 0x67, 0x4b, 0x67, 0x4c, 0x67, 0x4c, 0x67, 0x4d, 0x66,
-  0x4d, 0x66, 0x4f, 0x66, 0x50, 0x65, 0x53, 0x66, 0x56, 0x69, 0x5c, 0x6a,
-  0x67, 0x6a, 0x6c, 0x6c, 0x73, 0x6e, 0x77, 0x70, 0x78, 0x71, 0x78, 0x70,
-  0x74, 0x6e, 0x68, 0x6c, 0x5f, 0x69, 0x57, 0x69, 0x48, 0x68, 0x3e, 0x67,
-  0x3f, 0x64, 0x41, 0x62, 0x42, 0x62, 0x43, 0x64, 0x42, 0x66, 0x40, 0x68,
-  0x3e, 0x69, 0x3c, 0x6a, 0x3d, 0x6c, 0x40, 0x6d, 0x41, 0x6e, 0x3e, 0x6c,
-  0x3b, 0x6c, 0x3b, 0x6a, 0x3d, 0x6a, 0x3f, 0x69, 0x41, 0x66, 0x42, 0x66,
-  0x44, 0x68, 0x45, 0x66, 0x44, 0x65, 0x44, 0x66, 0x45, 0x6a, 0x4d, 0x70,
-  0x5a, 0x71, 0x65, 0x72, 0x64, 0x77, 0x5d, 0x79, 0x63, 0x78, 0x7a, 0x80,
-  0x82, 0x86, 0x75, 0x84, 0x59, 0x80, 0x4b, 0x7e, 0x47, 0x79, 0x4f, 0x79,
-  0x62, 0x81, 0x64, 0x82, 0x6b, 0x82, 0x75, 0x82, 0x62, 0x80, 0x5a, 0x7c,
-  0x61, 0x7e, 0x67, 0x7f, 0x6c, 0x81, 0x73, 0x85, 0x75, 0x86, 0x6e, 0x85,
-  0x6a, 0x84, 0x66, 0x84, 0x66, 0x83, 0x72, 0x82, 0x7d, 0x82, 0x6c, 0x7d,
-  0x5e, 0x79, 0x5f, 0x7e, 0x63, 0x7a, 0x64, 0x79, 0x63, 0x79, 0x61, 0x7a,
-  0x61, 0x79, 0x63, 0x78, 0x66, 0x78, 0x67, 0x77, 0x69, 0x77, 0x6d, 0x77,
-  0x72, 0x78, 0x76, 0x78, 0x79, 0x78, 0x7d, 0x78, 0x7d, 0x77, 0x7c, 0x77,
-  0x7c, 0x77, 0x7c, 0x76, 0x7c, 0x76, 0x7b, 0x75, 0x7a, 0x75, 0x7b, 0x75,
-  0x7a, 0x75, 0x7a, 0x74, 0x7b, 0x73, 0x7a, 0x73, 0x78, 0x72, 0x78, 0x72,
-  0x77, 0x72, 0x77, 0x73, 0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x70, 0x7b, 0x70, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x71,
-  0x7a, 0x74, 0x7a, 0x74, 0x7e, 0x7c, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x52, 0x56, 0x52, 0x58, 0x51, 0x59, 0x51, 0x5a, 0x52, 0x5a, 0x53, 0x5a,
-  0x54, 0x57, 0x53, 0x5b, 0x52, 0x60, 0x51, 0x5f, 0x51, 0x60, 0x51, 0x62,
-  0x50, 0x62, 0x4e, 0x62, 0x4e, 0x63, 0x4d, 0x66, 0x4d, 0x65, 0x4c, 0x67,
-  0x4b, 0x67, 0x4c, 0x67, 0x4c, 0x67, 0x4d, 0x66, 0x4d, 0x66, 0x4e, 0x65,
-  0x50, 0x64, 0x52, 0x65, 0x55, 0x67, 0x5b, 0x69, 0x66, 0x6a, 0x6b, 0x6c,
-  0x73, 0x6d, 0x77, 0x6f, 0x78, 0x71, 0x78, 0x70, 0x75, 0x6f, 0x6c, 0x6d,
-  0x64, 0x6a, 0x5d, 0x6a, 0x52, 0x68, 0x44, 0x67, 0x40, 0x65, 0x40, 0x63,
-  0x42, 0x63, 0x43, 0x64, 0x42, 0x66, 0x41, 0x68, 0x3e, 0x6a, 0x3d, 0x6a,
-  0x3c, 0x6c, 0x3e, 0x6e, 0x3e, 0x6e, 0x3c, 0x6c, 0x3a, 0x6c, 0x3b, 0x6a,
-  0x3d, 0x6a, 0x3f, 0x69, 0x41, 0x67, 0x42, 0x66, 0x44, 0x67, 0x45, 0x66,
-  0x44, 0x64, 0x43, 0x65, 0x44, 0x6a, 0x4f, 0x70, 0x6a, 0x73, 0x79, 0x76,
-  0x6a, 0x77, 0x5d, 0x77, 0x69, 0x78, 0x81, 0x82, 0x83, 0x85, 0x61, 0x86,
-  0x4d, 0x80, 0x48, 0x7c, 0x45, 0x77, 0x47, 0x78, 0x44, 0x82, 0x54, 0x82,
-  0x5d, 0x80, 0x60, 0x80, 0x56, 0x7f, 0x5b, 0x7c, 0x6c, 0x7e, 0x67, 0x7e,
-  0x6a, 0x7f, 0x6e, 0x82, 0x73, 0x85, 0x72, 0x85, 0x6d, 0x85, 0x67, 0x85,
-  0x69, 0x84, 0x74, 0x81, 0x7b, 0x7e, 0x68, 0x7b, 0x56, 0x7c, 0x5b, 0x82,
-  0x63, 0x7b, 0x64, 0x7a, 0x63, 0x7a, 0x62, 0x7a, 0x62, 0x79, 0x65, 0x78,
-  0x67, 0x78, 0x68, 0x77, 0x6c, 0x77, 0x70, 0x77, 0x75, 0x78, 0x79, 0x78,
-  0x7b, 0x78, 0x7d, 0x77, 0x7e, 0x77, 0x7d, 0x77, 0x7c, 0x77, 0x7c, 0x76,
-  0x7c, 0x75, 0x7b, 0x75, 0x7b, 0x75, 0x7b, 0x75, 0x7b, 0x75, 0x7a, 0x74,
-  0x7a, 0x73, 0x7a, 0x72, 0x77, 0x72, 0x78, 0x72, 0x77, 0x72, 0x77, 0x73,
-  0x77, 0x71, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f,
-  0x78, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70,
-  0x7b, 0x70, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x72, 0x7b, 0x73, 0x7a, 0x73,
-  0x7e, 0x7c, 0x81, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x53, 0x58, 0x53, 0x55,
-  0x52, 0x59, 0x51, 0x5a, 0x52, 0x5a, 0x53, 0x5a, 0x53, 0x57, 0x53, 0x5b,
-  0x52, 0x60, 0x51, 0x5f, 0x51, 0x60, 0x51, 0x62, 0x50, 0x63, 0x4f, 0x65,
-  0x4f, 0x65, 0x4d, 0x65, 0x4d, 0x65, 0x4c, 0x67, 0x4b, 0x67, 0x4b, 0x67,
-  0x4b, 0x67, 0x4d, 0x66, 0x4d, 0x66, 0x4d, 0x65, 0x4f, 0x65, 0x52, 0x64,
-  0x56, 0x65, 0x5b, 0x68, 0x64, 0x6b, 0x6a, 0x6c, 0x73, 0x6d, 0x77, 0x6f,
-  0x78, 0x70, 0x78, 0x71, 0x77, 0x71, 0x72, 0x6f, 0x6d, 0x6c, 0x65, 0x6c,
-  0x5a, 0x69, 0x51, 0x68, 0x44, 0x66, 0x40, 0x65, 0x41, 0x64, 0x42, 0x64,
-  0x42, 0x66, 0x41, 0x68, 0x3f, 0x69, 0x3d, 0x69, 0x3b, 0x6c, 0x3a, 0x6e,
-  0x3a, 0x6e, 0x3a, 0x6d, 0x39, 0x6c, 0x3a, 0x6a, 0x3c, 0x6a, 0x3e, 0x69,
-  0x41, 0x66, 0x41, 0x66, 0x43, 0x67, 0x45, 0x66, 0x44, 0x65, 0x42, 0x65,
-  0x44, 0x69, 0x53, 0x71, 0x78, 0x77, 0x80, 0x7c, 0x66, 0x7d, 0x5d, 0x7a,
-  0x73, 0x7b, 0x8b, 0x88, 0x7f, 0x86, 0x51, 0x89, 0x47, 0x86, 0x43, 0x7e,
-  0x3c, 0x77, 0x3e, 0x78, 0x2e, 0x86, 0x2e, 0x87, 0x38, 0x82, 0x49, 0x7e,
-  0x54, 0x7c, 0x69, 0x7e, 0x70, 0x7f, 0x6a, 0x7f, 0x62, 0x7d, 0x61, 0x7c,
-  0x6b, 0x82, 0x72, 0x86, 0x71, 0x86, 0x67, 0x85, 0x68, 0x84, 0x74, 0x81,
-  0x73, 0x7d, 0x5e, 0x7d, 0x56, 0x7e, 0x5e, 0x80, 0x64, 0x7a, 0x63, 0x7a,
-  0x63, 0x7a, 0x64, 0x7a, 0x64, 0x79, 0x67, 0x78, 0x6a, 0x78, 0x6d, 0x77,
-  0x70, 0x77, 0x74, 0x77, 0x78, 0x77, 0x7d, 0x78, 0x7f, 0x78, 0x7d, 0x77,
-  0x7e, 0x78, 0x7c, 0x77, 0x7c, 0x77, 0x7c, 0x76, 0x7c, 0x75, 0x7b, 0x75,
-  0x7b, 0x75, 0x7a, 0x75, 0x7a, 0x75, 0x7a, 0x74, 0x7a, 0x73, 0x79, 0x72,
-  0x77, 0x72, 0x78, 0x72, 0x77, 0x72, 0x77, 0x72, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f, 0x77, 0x6f,
-  0x77, 0x6f, 0x77, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x78, 0x6f, 0x79, 0x6f,
-  0x79, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x6f,
-  0x7b, 0x71, 0x7b, 0x72, 0x7a, 0x70, 0x7a, 0x71, 0x7e, 0x7c, 0x81, 0x7f,
-  0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x7f, 0x80, 0x54, 0x59, 0x54, 0x56, 0x53, 0x58, 0x52, 0x5b,
-  0x52, 0x5b, 0x53, 0x5b, 0x53, 0x59, 0x52, 0x5c, 0x52, 0x5f, 0x52, 0x5f,
-  0x51, 0x60, 0x50, 0x62, 0x50, 0x63, 0x50, 0x64, 0x4f, 0x65, 0x4e, 0x66,
-  0x4e, 0x66, 0x4d, 0x66, 0x4c, 0x66, 0x4c, 0x67, 0x4b, 0x67, 0x4c, 0x68,
-  0x4d, 0x66, 0x4d, 0x65, 0x4f, 0x65, 0x52, 0x65, 0x56, 0x65, 0x5b, 0x67,
-  0x64, 0x6a, 0x6a, 0x6c, 0x72, 0x6e, 0x77, 0x70, 0x78, 0x70, 0x78, 0x71,
-  0x77, 0x71, 0x76, 0x70, 0x70, 0x6d, 0x68, 0x6c, 0x5e, 0x6a, 0x56, 0x68,
-  0x48, 0x66, 0x40, 0x66, 0x40, 0x65, 0x40, 0x65, 0x41, 0x67, 0x40, 0x67,
-  0x3f, 0x69, 0x3d, 0x6a, 0x3b, 0x6b, 0x39, 0x6c, 0x39, 0x6c, 0x39, 0x6b,
-  0x39, 0x6b, 0x3a, 0x6b, 0x3c, 0x69, 0x3d, 0x69, 0x3f, 0x66, 0x40, 0x66,
-  0x42, 0x67, 0x44, 0x65, 0x44, 0x63, 0x43, 0x65, 0x44, 0x6a, 0x52, 0x72,
-  0x7a, 0x7c, 0x81, 0x82, 0x62, 0x82, 0x5f, 0x7b, 0x79, 0x7c, 0x8a, 0x88,
-  0x76, 0x86, 0x4b, 0x8c, 0x44, 0x8b, 0x3f, 0x82, 0x32, 0x7c, 0x36, 0x7a,
-  0x31, 0x88, 0x2f, 0x89, 0x31, 0x83, 0x4d, 0x7e, 0x61, 0x7c, 0x6c, 0x7d,
-  0x73, 0x80, 0x6d, 0x7f, 0x61, 0x7e, 0x61, 0x7e, 0x6b, 0x7f, 0x70, 0x83,
-  0x71, 0x84, 0x68, 0x84, 0x65, 0x84, 0x6e, 0x82, 0x66, 0x7f, 0x56, 0x80,
-  0x5a, 0x7c, 0x61, 0x7b, 0x65, 0x7a, 0x65, 0x7a, 0x65, 0x79, 0x66, 0x79,
-  0x67, 0x78, 0x6a, 0x78, 0x6d, 0x78, 0x70, 0x77, 0x73, 0x77, 0x77, 0x77,
-  0x7d, 0x77, 0x7f, 0x78, 0x80, 0x77, 0x7e, 0x77, 0x7e, 0x77, 0x7d, 0x77,
-  0x7d, 0x78, 0x7d, 0x76, 0x7d, 0x75, 0x7c, 0x74, 0x7b, 0x75, 0x7b, 0x75,
-  0x7b, 0x74, 0x7b, 0x74, 0x7a, 0x73, 0x7a, 0x72, 0x79, 0x72, 0x79, 0x72,
-  0x77, 0x72, 0x77, 0x72, 0x77, 0x71, 0x77, 0x71, 0x78, 0x6f, 0x77, 0x6f,
-  0x77, 0x70, 0x78, 0x70, 0x78, 0x70, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x6f,
-  0x78, 0x6f, 0x79, 0x6f, 0x79, 0x6f, 0x79, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f,
-  0x7b, 0x6f, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x71, 0x7b, 0x71,
-  0x7b, 0x6f, 0x7a, 0x70, 0x7e, 0x7c, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-  0x54, 0x5b, 0x54, 0x59, 0x53, 0x5a, 0x53, 0x5d, 0x52, 0x5d, 0x52, 0x5d,
-  0x52, 0x5d, 0x52, 0x5e, 0x51, 0x60, 0x52, 0x5f, 0x52, 0x60, 0x51, 0x62,
-  0x51, 0x62, 0x51, 0x64, 0x50, 0x65, 0x4f, 0x65, 0x4e, 0x66, 0x4d, 0x66,
-  0x4d, 0x65, 0x4c, 0x67, 0x4b, 0x67, 0x4c, 0x68, 0x4c, 0x66, 0x4d, 0x65,
-  0x4e, 0x65, 0x51, 0x65, 0x55, 0x65, 0x5b, 0x66, 0x65, 0x68, 0x6b, 0x6c,
-  0x71, 0x6f, 0x76, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x71, 0x6e, 0x6c, 0x6c, 0x64, 0x6a, 0x5b, 0x69, 0x51, 0x66, 0x44, 0x65,
-  0x40, 0x66, 0x3f, 0x67, 0x3f, 0x67, 0x3f, 0x67, 0x3f, 0x68, 0x3e, 0x6a,
-  0x3c, 0x6a, 0x3b, 0x6b, 0x3b, 0x6a, 0x39, 0x6a, 0x39, 0x6a, 0x39, 0x6b,
-  0x3b, 0x69, 0x3d, 0x68, 0x3f, 0x66, 0x40, 0x65, 0x41, 0x65, 0x43, 0x64,
-  0x44, 0x62, 0x44, 0x63, 0x44, 0x69, 0x52, 0x72, 0x80, 0x81, 0x8a, 0x85,
-  0x63, 0x82, 0x65, 0x7a, 0x79, 0x7d, 0x77, 0x85, 0x65, 0x84, 0x46, 0x8b,
-  0x34, 0x8c, 0x34, 0x85, 0x2d, 0x84, 0x31, 0x80, 0x2c, 0x88, 0x29, 0x89,
-  0x2b, 0x85, 0x3a, 0x82, 0x42, 0x81, 0x42, 0x7f, 0x49, 0x7e, 0x4f, 0x7c,
-  0x6f, 0x7f, 0x7b, 0x82, 0x6e, 0x81, 0x57, 0x80, 0x5c, 0x81, 0x5f, 0x80,
-  0x55, 0x81, 0x5d, 0x81, 0x53, 0x7f, 0x50, 0x7f, 0x60, 0x7c, 0x68, 0x7a,
-  0x65, 0x7a, 0x67, 0x7a, 0x67, 0x79, 0x6a, 0x78, 0x6c, 0x77, 0x6e, 0x77,
-  0x71, 0x77, 0x74, 0x77, 0x79, 0x77, 0x7b, 0x77, 0x7f, 0x77, 0x7f, 0x77,
-  0x7f, 0x77, 0x7f, 0x78, 0x7f, 0x77, 0x7d, 0x77, 0x7e, 0x77, 0x7e, 0x76,
-  0x7e, 0x75, 0x7d, 0x74, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x74, 0x7c, 0x74,
-  0x7b, 0x73, 0x7a, 0x73, 0x7a, 0x72, 0x79, 0x72, 0x78, 0x72, 0x78, 0x72,
-  0x77, 0x72, 0x77, 0x72, 0x77, 0x70, 0x77, 0x70, 0x78, 0x70, 0x78, 0x71,
-  0x78, 0x70, 0x78, 0x70, 0x78, 0x6f, 0x78, 0x6f, 0x79, 0x6f, 0x7b, 0x6f,
-  0x7a, 0x6f, 0x7a, 0x6f, 0x7b, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70,
-  0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7a, 0x70,
-  0x7d, 0x7b, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x54, 0x5f, 0x54, 0x5d,
-  0x54, 0x5c, 0x53, 0x5e, 0x52, 0x5e, 0x51, 0x5e, 0x51, 0x5e, 0x51, 0x60,
-  0x51, 0x61, 0x52, 0x61, 0x52, 0x61, 0x52, 0x62, 0x52, 0x61, 0x51, 0x65,
-  0x50, 0x66, 0x4f, 0x65, 0x4f, 0x66, 0x4e, 0x66, 0x4d, 0x66, 0x4c, 0x67,
-  0x4b, 0x67, 0x4c, 0x68, 0x4c, 0x66, 0x4d, 0x64, 0x4e, 0x65, 0x52, 0x65,
-  0x54, 0x65, 0x5a, 0x66, 0x65, 0x69, 0x6b, 0x6b, 0x71, 0x6f, 0x76, 0x6f,
-  0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x71, 0x75, 0x70, 0x72, 0x6e,
-  0x6b, 0x6b, 0x61, 0x69, 0x58, 0x66, 0x49, 0x66, 0x42, 0x66, 0x3e, 0x67,
-  0x3f, 0x67, 0x3f, 0x67, 0x40, 0x68, 0x3f, 0x6b, 0x3c, 0x6b, 0x3b, 0x6b,
-  0x3b, 0x6b, 0x39, 0x6b, 0x39, 0x6b, 0x39, 0x6b, 0x3b, 0x68, 0x3c, 0x68,
-  0x3e, 0x66, 0x3f, 0x64, 0x42, 0x63, 0x44, 0x62, 0x44, 0x62, 0x43, 0x64,
-  0x44, 0x6a, 0x53, 0x73, 0x80, 0x80, 0x85, 0x85, 0x5c, 0x82, 0x68, 0x7a,
-  0x7a, 0x7f, 0x6b, 0x83, 0x5d, 0x83, 0x54, 0x88, 0x35, 0x8a, 0x29, 0x88,
-  0x31, 0x88, 0x38, 0x86, 0x30, 0x88, 0x2b, 0x89, 0x30, 0x88, 0x2f, 0x88,
-  0x2a, 0x89, 0x29, 0x8d, 0x28, 0x89, 0x38, 0x84, 0x5b, 0x84, 0x5f, 0x85,
-  0x49, 0x86, 0x33, 0x85, 0x38, 0x84, 0x49, 0x7e, 0x49, 0x7d, 0x52, 0x7e,
-  0x4e, 0x7f, 0x56, 0x7f, 0x67, 0x7c, 0x6c, 0x7a, 0x66, 0x79, 0x66, 0x7a,
-  0x68, 0x79, 0x6b, 0x78, 0x6f, 0x77, 0x72, 0x77, 0x74, 0x77, 0x77, 0x77,
-  0x7d, 0x77, 0x7e, 0x77, 0x7e, 0x77, 0x7f, 0x78, 0x7f, 0x78, 0x7f, 0x78,
-  0x7f, 0x78, 0x7e, 0x77, 0x7e, 0x77, 0x7e, 0x76, 0x7d, 0x75, 0x7e, 0x75,
-  0x7e, 0x74, 0x7d, 0x75, 0x7d, 0x74, 0x7b, 0x73, 0x7a, 0x73, 0x7a, 0x72,
-  0x7a, 0x72, 0x7a, 0x71, 0x78, 0x71, 0x78, 0x72, 0x78, 0x72, 0x77, 0x72,
-  0x77, 0x70, 0x77, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70,
-  0x78, 0x70, 0x78, 0x6e, 0x79, 0x6f, 0x7a, 0x6e, 0x7a, 0x6f, 0x7b, 0x6f,
-  0x7b, 0x6f, 0x7a, 0x6f, 0x7a, 0x6f, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7b, 0x70, 0x7b, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7d, 0x7b, 0x7f, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x7f, 0x7f, 0x55, 0x61, 0x54, 0x60, 0x54, 0x5f, 0x53, 0x60,
-  0x52, 0x60, 0x51, 0x60, 0x51, 0x5f, 0x51, 0x61, 0x51, 0x63, 0x51, 0x62,
-  0x52, 0x61, 0x51, 0x62, 0x51, 0x62, 0x51, 0x64, 0x50, 0x64, 0x50, 0x64,
-  0x4f, 0x65, 0x4e, 0x65, 0x4d, 0x66, 0x4c, 0x67, 0x4b, 0x67, 0x4c, 0x68,
-  0x4c, 0x66, 0x4d, 0x65, 0x4e, 0x65, 0x51, 0x66, 0x55, 0x67, 0x5b, 0x67,
-  0x65, 0x69, 0x6c, 0x6c, 0x72, 0x6f, 0x76, 0x6f, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x78, 0x71, 0x76, 0x70, 0x75, 0x6f, 0x71, 0x6d, 0x67, 0x6a,
-  0x5d, 0x67, 0x51, 0x66, 0x48, 0x66, 0x3f, 0x68, 0x3d, 0x67, 0x3e, 0x67,
-  0x40, 0x68, 0x3f, 0x6a, 0x3c, 0x6a, 0x3b, 0x6b, 0x3b, 0x6a, 0x3a, 0x6a,
-  0x3a, 0x6a, 0x3a, 0x6a, 0x3b, 0x69, 0x3b, 0x68, 0x3e, 0x65, 0x3f, 0x63,
-  0x42, 0x62, 0x43, 0x62, 0x44, 0x61, 0x43, 0x66, 0x44, 0x6e, 0x51, 0x76,
-  0x6d, 0x7f, 0x67, 0x83, 0x4e, 0x81, 0x66, 0x7b, 0x7e, 0x80, 0x6c, 0x83,
-  0x60, 0x84, 0x6c, 0x85, 0x51, 0x87, 0x2a, 0x8a, 0x2a, 0x8b, 0x31, 0x89,
-  0x3b, 0x89, 0x3a, 0x8a, 0x3b, 0x8a, 0x37, 0x8b, 0x33, 0x8c, 0x33, 0x8d,
-  0x34, 0x8a, 0x36, 0x87, 0x39, 0x87, 0x3a, 0x87, 0x33, 0x88, 0x30, 0x88,
-  0x35, 0x85, 0x4a, 0x80, 0x52, 0x7f, 0x54, 0x7f, 0x5c, 0x7f, 0x6b, 0x80,
-  0x6a, 0x7c, 0x6a, 0x7a, 0x65, 0x7a, 0x66, 0x7c, 0x66, 0x7a, 0x6b, 0x78,
-  0x70, 0x77, 0x75, 0x77, 0x77, 0x77, 0x79, 0x77, 0x80, 0x77, 0x80, 0x77,
-  0x7f, 0x76, 0x7f, 0x76, 0x7f, 0x77, 0x80, 0x77, 0x7f, 0x77, 0x7d, 0x76,
-  0x7d, 0x76, 0x7e, 0x76, 0x7e, 0x76, 0x7e, 0x75, 0x7e, 0x74, 0x7e, 0x74,
-  0x7d, 0x74, 0x7c, 0x73, 0x7b, 0x73, 0x7b, 0x73, 0x7a, 0x72, 0x7a, 0x72,
-  0x79, 0x72, 0x79, 0x72, 0x77, 0x72, 0x76, 0x72, 0x77, 0x71, 0x77, 0x71,
-  0x78, 0x71, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x78, 0x70, 0x79, 0x70,
-  0x79, 0x70, 0x79, 0x6f, 0x79, 0x70, 0x7b, 0x6f, 0x7b, 0x6f, 0x7b, 0x6f,
-  0x7b, 0x6f, 0x7b, 0x70, 0x7b, 0x71, 0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7b, 0x71, 0x7d, 0x7c, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f,
-  0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-  0x55, 0x60, 0x55, 0x61, 0x53, 0x62, 0x53, 0x62, 0x52, 0x62, 0x51, 0x62,
-  0x51, 0x61, 0x51, 0x63, 0x51, 0x65, 0x51, 0x64, 0x51, 0x61, 0x51, 0x62,
-  0x51, 0x62, 0x51, 0x63, 0x51, 0x63, 0x50, 0x63, 0x51, 0x63, 0x4e, 0x65,
-  0x4d, 0x66, 0x4c, 0x67, 0x4c, 0x67, 0x4c, 0x68, 0x4c, 0x67, 0x4c, 0x65,
-  0x4e, 0x65, 0x51, 0x66, 0x56, 0x68, 0x5d, 0x67, 0x66, 0x69, 0x6e, 0x6c,
-  0x73, 0x6f, 0x76, 0x6f, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70,
-  0x76, 0x70, 0x76, 0x71, 0x74, 0x6f, 0x6c, 0x6c, 0x64, 0x69, 0x59, 0x67,
-  0x51, 0x68, 0x46, 0x68, 0x3f, 0x67, 0x3d, 0x67, 0x3e, 0x68, 0x3e, 0x68,
-  0x3e, 0x68, 0x3c, 0x69, 0x3b, 0x69, 0x3b, 0x68, 0x3b, 0x68, 0x3b, 0x68,
-  0x3b, 0x68, 0x3b, 0x67, 0x3d, 0x64, 0x3e, 0x63, 0x41, 0x61, 0x42, 0x60,
-  0x43, 0x60, 0x42, 0x68, 0x46, 0x72, 0x49, 0x79, 0x45, 0x7e, 0x44, 0x81,
-  0x4d, 0x7f, 0x68, 0x7b, 0x80, 0x82, 0x6a, 0x85, 0x68, 0x86, 0x78, 0x84,
-  0x76, 0x85, 0x4e, 0x8a, 0x26, 0x8e, 0x2a, 0x8c, 0x3a, 0x8b, 0x42, 0x89,
-  0x47, 0x87, 0x44, 0x88, 0x42, 0x88, 0x41, 0x89, 0x45, 0x88, 0x47, 0x87,
-  0x47, 0x86, 0x46, 0x86, 0x47, 0x85, 0x4d, 0x85, 0x51, 0x82, 0x53, 0x81,
-  0x51, 0x82, 0x60, 0x82, 0x75, 0x81, 0x73, 0x81, 0x6a, 0x7b, 0x6a, 0x79,
-  0x66, 0x79, 0x68, 0x7d, 0x62, 0x7d, 0x63, 0x7b, 0x6d, 0x77, 0x77, 0x75,
-  0x7e, 0x75, 0x80, 0x75, 0x82, 0x76, 0x81, 0x77, 0x7f, 0x75, 0x7f, 0x76,
-  0x7f, 0x78, 0x81, 0x74, 0x81, 0x74, 0x7e, 0x76, 0x7d, 0x75, 0x7f, 0x76,
-  0x80, 0x77, 0x7e, 0x75, 0x7e, 0x75, 0x7e, 0x73, 0x7d, 0x73, 0x7d, 0x73,
-  0x7d, 0x73, 0x7d, 0x73, 0x7b, 0x73, 0x7b, 0x73, 0x7a, 0x72, 0x7a, 0x72,
-  0x78, 0x72, 0x77, 0x72, 0x78, 0x72, 0x78, 0x72, 0x78, 0x71, 0x78, 0x70,
-  0x78, 0x70, 0x78, 0x70, 0x79, 0x70, 0x7a, 0x71, 0x7a, 0x71, 0x79, 0x71,
-  0x7a, 0x71, 0x7b, 0x6f, 0x7b, 0x6f, 0x7c, 0x70, 0x7d, 0x71, 0x7d, 0x70,
-  0x7d, 0x71, 0x7b, 0x70, 0x7b, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x72,
-  0x7e, 0x7b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x55, 0x60, 0x55, 0x60,
-  0x54, 0x63, 0x52, 0x63, 0x52, 0x63, 0x51, 0x63, 0x51, 0x61, 0x51, 0x63,
-  0x50, 0x65, 0x51, 0x64, 0x51, 0x61, 0x51, 0x62, 0x51, 0x62, 0x51, 0x63,
-  0x51, 0x63, 0x51, 0x63, 0x51, 0x63, 0x4f, 0x65, 0x4e, 0x66, 0x4c, 0x67,
-  0x4b, 0x67, 0x4c, 0x68, 0x4c, 0x66, 0x4c, 0x65, 0x4e, 0x65, 0x51, 0x67,
-  0x56, 0x67, 0x5d, 0x68, 0x67, 0x69, 0x6f, 0x6b, 0x73, 0x6f, 0x76, 0x6f,
-  0x77, 0x71, 0x77, 0x70, 0x77, 0x70, 0x77, 0x70, 0x76, 0x70, 0x76, 0x70,
-  0x75, 0x70, 0x70, 0x6d, 0x69, 0x6a, 0x61, 0x69, 0x5b, 0x69, 0x4e, 0x67,
-  0x46, 0x68, 0x3f, 0x67, 0x3d, 0x68, 0x3e, 0x68, 0x3e, 0x68, 0x3d, 0x68,
-  0x3c, 0x68, 0x3b, 0x68, 0x3b, 0x68, 0x3b, 0x67, 0x3b, 0x67, 0x3b, 0x66,
-  0x3d, 0x63, 0x3e, 0x63, 0x40, 0x61, 0x42, 0x60, 0x43, 0x60, 0x43, 0x69,
-  0x4b, 0x75, 0x4b, 0x7b, 0x3c, 0x7f, 0x44, 0x83, 0x53, 0x7f, 0x6d, 0x7c,
-  0x81, 0x84, 0x6c, 0x83, 0x69, 0x86, 0x70, 0x84, 0x7d, 0x82, 0x75, 0x87,
-  0x3a, 0x8d, 0x29, 0x90, 0x30, 0x8d, 0x47, 0x87, 0x56, 0x83, 0x57, 0x83,
-  0x55, 0x83, 0x4f, 0x82, 0x4f, 0x82, 0x4e, 0x83, 0x4f, 0x85, 0x51, 0x84,
-  0x4f, 0x82, 0x52, 0x81, 0x53, 0x81, 0x54, 0x81, 0x5b, 0x82, 0x71, 0x83,
-  0x79, 0x83, 0x6f, 0x80, 0x69, 0x7b, 0x6e, 0x79, 0x67, 0x76, 0x68, 0x7c,
-  0x5f, 0x81, 0x58, 0x80, 0x67, 0x75, 0x73, 0x72, 0x7e, 0x72, 0x7e, 0x74,
-  0x77, 0x78, 0x73, 0x7a, 0x71, 0x7a, 0x70, 0x7c, 0x6f, 0x7e, 0x75, 0x7a,
-  0x7f, 0x77, 0x80, 0x75, 0x7f, 0x76, 0x7f, 0x75, 0x7f, 0x75, 0x7e, 0x75,
-  0x7d, 0x75, 0x7d, 0x73, 0x7d, 0x72, 0x7d, 0x73, 0x7d, 0x73, 0x7c, 0x73,
-  0x7b, 0x73, 0x7b, 0x73, 0x7a, 0x72, 0x7a, 0x72, 0x79, 0x72, 0x78, 0x72,
-  0x78, 0x72, 0x78, 0x72, 0x78, 0x71, 0x77, 0x70, 0x79, 0x70, 0x7a, 0x70,
-  0x7a, 0x70, 0x7a, 0x70, 0x7a, 0x70, 0x7b, 0x71, 0x7b, 0x70, 0x7d, 0x6f,
-  0x7c, 0x6f, 0x7c, 0x70, 0x7c, 0x70, 0x7c, 0x70, 0x7d, 0x70, 0x7d, 0x70,
-  0x7d, 0x70, 0x7c, 0x71, 0x7c, 0x70, 0x7c, 0x72, 0x7e, 0x79, 0x7f, 0x7e,
-  0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x7f, 0x7f, 0x56, 0x61, 0x55, 0x60, 0x53, 0x63, 0x52, 0x65,
-  0x52, 0x65, 0x51, 0x64, 0x51, 0x62, 0x51, 0x63, 0x51, 0x65, 0x51, 0x63,
-  0x51, 0x62, 0x50, 0x62, 0x51, 0x63, 0x51, 0x64, 0x51, 0x64, 0x50, 0x64,
-  0x50, 0x64, 0x4e, 0x65, 0x4e, 0x66, 0x4d, 0x67, 0x4b, 0x67, 0x4c, 0x68,
-  0x4c, 0x67, 0x4c, 0x65, 0x4e, 0x65, 0x51, 0x67, 0x57, 0x68, 0x5e, 0x67,
-  0x69, 0x69, 0x70, 0x6c, 0x73, 0x6f, 0x75, 0x6f, 0x77, 0x70, 0x77, 0x70,
-  0x77, 0x70, 0x77, 0x70, 0x75, 0x70, 0x75, 0x70, 0x76, 0x70, 0x74, 0x6f,
-  0x6f, 0x6c, 0x6a, 0x6b, 0x64, 0x69, 0x59, 0x67, 0x51, 0x67, 0x48, 0x67,
-  0x3f, 0x67, 0x3e, 0x68, 0x3d, 0x67, 0x3d, 0x66, 0x3d, 0x66, 0x3c, 0x67,
-  0x3c, 0x68, 0x3c, 0x65, 0x3b, 0x65, 0x3b, 0x65, 0x3c, 0x63, 0x3d, 0x63,
-  0x3f, 0x62, 0x42, 0x61, 0x42, 0x60, 0x45, 0x68, 0x54, 0x72, 0x59, 0x7b,
-  0x55, 0x82, 0x5c, 0x85, 0x5b, 0x7d, 0x73, 0x7c, 0x7f, 0x84, 0x6c, 0x82,
-  0x5b, 0x86, 0x5f, 0x85, 0x78, 0x7c, 0x80, 0x7e, 0x6d, 0x87, 0x4f, 0x8c,
-  0x39, 0x8c, 0x50, 0x88, 0x5e, 0x82, 0x57, 0x80, 0x59, 0x80, 0x5c, 0x7e,
-  0x5b, 0x80, 0x59, 0x80, 0x5c, 0x7f, 0x62, 0x7e, 0x6b, 0x7e, 0x6d, 0x7e,
-  0x6f, 0x7d, 0x77, 0x7e, 0x78, 0x82, 0x6d, 0x8a, 0x6f, 0x86, 0x6e, 0x7f,
-  0x66, 0x7b, 0x6d, 0x79, 0x61, 0x75, 0x62, 0x7a, 0x5c, 0x82, 0x50, 0x83,
-  0x60, 0x72, 0x69, 0x6f, 0x70, 0x75, 0x6c, 0x7b, 0x68, 0x7f, 0x67, 0x81,
-  0x63, 0x84, 0x60, 0x88, 0x5f, 0x8b, 0x61, 0x8e, 0x6e, 0x83, 0x7d, 0x76,
-  0x81, 0x75, 0x7f, 0x74, 0x80, 0x74, 0x7f, 0x74, 0x7e, 0x74, 0x7e, 0x73,
-  0x7e, 0x73, 0x7d, 0x73, 0x7c, 0x73, 0x7c, 0x73, 0x7a, 0x73, 0x7a, 0x73,
-  0x7a, 0x72, 0x7a, 0x72, 0x7a, 0x72, 0x7a, 0x73, 0x79, 0x72, 0x78, 0x71,
-  0x78, 0x71, 0x78, 0x70, 0x7a, 0x70, 0x7b, 0x70, 0x7b, 0x70, 0x7b, 0x70,
-  0x7b, 0x70, 0x7c, 0x70, 0x7d, 0x70, 0x7e, 0x6f, 0x7e, 0x70, 0x7d, 0x70,
-  0x7e, 0x6f, 0x7d, 0x70, 0x7e, 0x70, 0x7e, 0x70, 0x7e, 0x70, 0x7e, 0x70,
-  0x7e, 0x70, 0x7d, 0x71, 0x7e, 0x79, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x56, 0x63, 0x54, 0x63, 0x54, 0x63, 0x52, 0x65, 0x51, 0x66, 0x51, 0x66,
-  0x51, 0x65, 0x51, 0x64, 0x50, 0x64, 0x50, 0x65, 0x50, 0x65, 0x50, 0x65,
-  0x50, 0x65, 0x50, 0x65, 0x50, 0x65, 0x50, 0x65, 0x50, 0x65, 0x4f, 0x65,
-  0x4e, 0x65, 0x4d, 0x66, 0x4b, 0x67, 0x4c, 0x67, 0x4c, 0x67, 0x4c, 0x67,
-  0x4d, 0x67, 0x52, 0x67, 0x59, 0x67, 0x60, 0x67, 0x6a, 0x69, 0x70, 0x6d,
-  0x72, 0x6f, 0x74, 0x70, 0x75, 0x6f, 0x76, 0x6f, 0x76, 0x70, 0x76, 0x70,
-  0x76, 0x6f, 0x75, 0x6f, 0x76, 0x6f, 0x76, 0x6f, 0x73, 0x6f, 0x6d, 0x6d,
-  0x68, 0x6b, 0x60, 0x68, 0x59, 0x67, 0x51, 0x67, 0x45, 0x68, 0x3e, 0x68,
-  0x3c, 0x66, 0x3d, 0x65, 0x3d, 0x65, 0x3d, 0x66, 0x3c, 0x65, 0x3c, 0x65,
-  0x3c, 0x65, 0x3c, 0x64, 0x3c, 0x63, 0x3d, 0x63, 0x3f, 0x62, 0x40, 0x60,
-  0x42, 0x5e, 0x49, 0x67, 0x5c, 0x72, 0x60, 0x7c, 0x68, 0x83, 0x6f, 0x84,
-  0x5d, 0x7b, 0x79, 0x79, 0x78, 0x7f, 0x62, 0x80, 0x55, 0x86, 0x62, 0x86,
-  0x77, 0x77, 0x79, 0x77, 0x7d, 0x80, 0x7a, 0x83, 0x65, 0x8c, 0x62, 0x8c,
-  0x65, 0x86, 0x63, 0x82, 0x64, 0x81, 0x62, 0x80, 0x64, 0x81, 0x6a, 0x81,
-  0x70, 0x7e, 0x76, 0x7d, 0x7d, 0x7e, 0x7f, 0x7d, 0x7e, 0x7d, 0x7f, 0x7d,
-  0x7a, 0x7e, 0x70, 0x85, 0x6d, 0x86, 0x6a, 0x81, 0x5f, 0x7c, 0x63, 0x7a,
-  0x5d, 0x78, 0x66, 0x77, 0x67, 0x77, 0x56, 0x7c, 0x5f, 0x6e, 0x61, 0x72,
-  0x68, 0x7d, 0x6a, 0x80, 0x6d, 0x80, 0x6c, 0x84, 0x66, 0x89, 0x5f, 0x8f,
-  0x5f, 0x91, 0x69, 0x8e, 0x69, 0x8a, 0x78, 0x7c, 0x80, 0x74, 0x7f, 0x74,
-  0x80, 0x74, 0x80, 0x74, 0x80, 0x73, 0x80, 0x73, 0x7f, 0x73, 0x7f, 0x73,
-  0x7d, 0x73, 0x7d, 0x72, 0x7b, 0x73, 0x7a, 0x73, 0x7b, 0x73, 0x7a, 0x73,
-  0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x72, 0x7a, 0x71, 0x7a, 0x72, 0x7a, 0x70,
-  0x7a, 0x70, 0x7b, 0x70, 0x7c, 0x70, 0x7d, 0x70, 0x7c, 0x70, 0x7d, 0x70,
-  0x7d, 0x71, 0x7e, 0x70, 0x7e, 0x70, 0x7f, 0x6f, 0x7f, 0x6e, 0x7f, 0x70,
-  0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7e, 0x70, 0x7d, 0x70, 0x7f, 0x70,
-  0x7f, 0x79, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x56, 0x65, 0x54, 0x65,
-  0x54, 0x64, 0x52, 0x67, 0x51, 0x67, 0x51, 0x67, 0x50, 0x66, 0x4f, 0x66,
-  0x4f, 0x66, 0x4e, 0x66, 0x4e, 0x66, 0x4e, 0x66, 0x4f, 0x66, 0x51, 0x65,
-  0x50, 0x65, 0x50, 0x65, 0x50, 0x65, 0x4f, 0x65, 0x4e, 0x65, 0x4d, 0x67,
-  0x4c, 0x67, 0x4c, 0x67, 0x4c, 0x67, 0x4b, 0x68, 0x4c, 0x69, 0x53, 0x68,
-  0x5b, 0x68, 0x61, 0x67, 0x6a, 0x6b, 0x70, 0x6e, 0x72, 0x6f, 0x74, 0x6f,
-  0x75, 0x6f, 0x76, 0x70, 0x76, 0x70, 0x76, 0x70, 0x76, 0x6f, 0x76, 0x6f,
-  0x76, 0x6f, 0x76, 0x6f, 0x75, 0x70, 0x70, 0x6f, 0x6b, 0x6d, 0x64, 0x6a,
-  0x5e, 0x67, 0x57, 0x67, 0x4d, 0x68, 0x44, 0x68, 0x3d, 0x66, 0x3d, 0x65,
-  0x3d, 0x66, 0x3c, 0x66, 0x3c, 0x66, 0x3c, 0x65, 0x3c, 0x65, 0x3c, 0x64,
-  0x3c, 0x63, 0x3c, 0x62, 0x3e, 0x62, 0x40, 0x5f, 0x42, 0x5b, 0x4b, 0x67,
-  0x61, 0x74, 0x63, 0x7a, 0x66, 0x83, 0x6b, 0x85, 0x58, 0x7a, 0x7a, 0x76,
-  0x76, 0x7b, 0x5e, 0x7c, 0x5a, 0x81, 0x6b, 0x85, 0x75, 0x74, 0x72, 0x74,
-  0x6a, 0x7f, 0x6b, 0x85, 0x63, 0x8f, 0x61, 0x92, 0x6a, 0x8c, 0x76, 0x82,
-  0x78, 0x7f, 0x74, 0x7f, 0x74, 0x7f, 0x77, 0x80, 0x7b, 0x7f, 0x7d, 0x7e,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7d, 0x7c, 0x7c, 0x78, 0x7c, 0x70, 0x80,
-  0x6d, 0x81, 0x69, 0x80, 0x5c, 0x7e, 0x61, 0x7c, 0x60, 0x7c, 0x6a, 0x78,
-  0x6e, 0x78, 0x5b, 0x7b, 0x5f, 0x73, 0x61, 0x78, 0x6d, 0x80, 0x72, 0x7f,
-  0x71, 0x80, 0x6f, 0x84, 0x65, 0x8c, 0x60, 0x90, 0x6e, 0x8d, 0x78, 0x82,
-  0x71, 0x83, 0x76, 0x7e, 0x7f, 0x76, 0x80, 0x74, 0x81, 0x74, 0x80, 0x74,
-  0x80, 0x73, 0x80, 0x73, 0x7f, 0x73, 0x7f, 0x73, 0x7d, 0x73, 0x7d, 0x73,
-  0x7d, 0x73, 0x7d, 0x73, 0x7b, 0x73, 0x7b, 0x73, 0x7a, 0x73, 0x7a, 0x73,
-  0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x72, 0x7a, 0x71, 0x7b, 0x72,
-  0x7c, 0x71, 0x7c, 0x70, 0x7c, 0x70, 0x7c, 0x70, 0x7d, 0x70, 0x7d, 0x70,
-  0x7d, 0x6f, 0x7f, 0x6f, 0x7f, 0x6f, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70,
-  0x7f, 0x71, 0x7e, 0x71, 0x7d, 0x70, 0x7e, 0x6f, 0x7f, 0x79, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x56, 0x66, 0x54, 0x66, 0x53, 0x66, 0x52, 0x68,
-  0x51, 0x68, 0x51, 0x68, 0x4f, 0x67, 0x4e, 0x67, 0x4e, 0x68, 0x4d, 0x67,
-  0x4d, 0x67, 0x4d, 0x67, 0x4e, 0x66, 0x50, 0x64, 0x50, 0x65, 0x50, 0x64,
-  0x51, 0x64, 0x4f, 0x65, 0x4f, 0x65, 0x4e, 0x66, 0x4c, 0x67, 0x4c, 0x67,
-  0x4b, 0x68, 0x4b, 0x69, 0x4c, 0x6a, 0x54, 0x69, 0x5c, 0x68, 0x62, 0x68,
-  0x6a, 0x6c, 0x6f, 0x6f, 0x72, 0x6f, 0x74, 0x6f, 0x75, 0x6f, 0x75, 0x6f,
-  0x75, 0x70, 0x75, 0x70, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x6f,
-  0x76, 0x71, 0x73, 0x70, 0x71, 0x6e, 0x69, 0x6b, 0x63, 0x69, 0x5f, 0x68,
-  0x58, 0x68, 0x50, 0x68, 0x44, 0x66, 0x3d, 0x65, 0x3d, 0x66, 0x3c, 0x66,
-  0x3c, 0x65, 0x3c, 0x64, 0x3c, 0x64, 0x3c, 0x63, 0x3c, 0x64, 0x3c, 0x62,
-  0x3d, 0x60, 0x3f, 0x61, 0x44, 0x60, 0x53, 0x6b, 0x66, 0x75, 0x69, 0x7a,
-  0x5e, 0x83, 0x5e, 0x85, 0x50, 0x7a, 0x6e, 0x72, 0x78, 0x76, 0x61, 0x78,
-  0x5e, 0x7b, 0x65, 0x81, 0x6e, 0x7d, 0x6a, 0x7e, 0x4e, 0x86, 0x4c, 0x89,
-  0x53, 0x8e, 0x59, 0x92, 0x66, 0x92, 0x7d, 0x83, 0x7e, 0x7f, 0x7b, 0x80,
-  0x7b, 0x80, 0x7b, 0x80, 0x7a, 0x7f, 0x7a, 0x7e, 0x79, 0x7e, 0x78, 0x7e,
-  0x79, 0x7d, 0x76, 0x7e, 0x72, 0x7f, 0x6d, 0x80, 0x69, 0x7c, 0x5f, 0x85,
-  0x56, 0x86, 0x5d, 0x84, 0x5f, 0x84, 0x5f, 0x87, 0x5b, 0x89, 0x5a, 0x82,
-  0x62, 0x7e, 0x67, 0x7f, 0x73, 0x7f, 0x78, 0x7f, 0x79, 0x80, 0x71, 0x87,
-  0x64, 0x90, 0x73, 0x8d, 0x7e, 0x85, 0x79, 0x7f, 0x70, 0x7c, 0x73, 0x79,
-  0x7b, 0x77, 0x7d, 0x75, 0x7f, 0x75, 0x80, 0x73, 0x80, 0x73, 0x80, 0x73,
-  0x7f, 0x73, 0x7e, 0x73, 0x7e, 0x73, 0x7e, 0x73, 0x7e, 0x73, 0x7e, 0x73,
-  0x7b, 0x73, 0x7b, 0x73, 0x7a, 0x73, 0x7a, 0x73, 0x7a, 0x75, 0x7b, 0x75,
-  0x7a, 0x75, 0x7a, 0x73, 0x7b, 0x72, 0x7b, 0x73, 0x7c, 0x72, 0x7c, 0x71,
-  0x7d, 0x70, 0x7d, 0x70, 0x7e, 0x70, 0x7d, 0x71, 0x7e, 0x70, 0x7f, 0x6f,
-  0x7f, 0x6f, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x70, 0x7f, 0x71, 0x7f, 0x73,
-  0x7d, 0x6f, 0x7e, 0x6e, 0x7f, 0x79, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x56, 0x65, 0x54, 0x67, 0x53, 0x68, 0x52, 0x67, 0x51, 0x66, 0x51, 0x65,
-  0x50, 0x66, 0x4e, 0x69, 0x4e, 0x68, 0x4d, 0x66, 0x4e, 0x67, 0x4e, 0x67,
-  0x4e, 0x66, 0x4f, 0x64, 0x50, 0x64, 0x50, 0x62, 0x50, 0x62, 0x4f, 0x65,
-  0x4f, 0x66, 0x4e, 0x66, 0x4d, 0x65, 0x4b, 0x66, 0x4b, 0x68, 0x4b, 0x69,
-  0x4e, 0x68, 0x56, 0x68, 0x5b, 0x68, 0x63, 0x69, 0x6c, 0x6c, 0x6f, 0x6e,
-  0x71, 0x6f, 0x73, 0x6f, 0x74, 0x6f, 0x74, 0x6f, 0x75, 0x6f, 0x75, 0x6e,
-  0x72, 0x6f, 0x72, 0x6f, 0x73, 0x6f, 0x72, 0x6f, 0x74, 0x70, 0x75, 0x70,
-  0x75, 0x70, 0x6e, 0x6c, 0x67, 0x6b, 0x63, 0x6a, 0x5a, 0x68, 0x55, 0x68,
-  0x4c, 0x66, 0x41, 0x66, 0x3e, 0x66, 0x3c, 0x66, 0x3b, 0x65, 0x3c, 0x62,
-  0x3c, 0x63, 0x3c, 0x63, 0x3b, 0x63, 0x3c, 0x60, 0x40, 0x62, 0x47, 0x6d,
-  0x51, 0x70, 0x5d, 0x76, 0x66, 0x79, 0x6a, 0x7b, 0x5f, 0x7f, 0x5f, 0x82,
-  0x44, 0x7d, 0x5e, 0x70, 0x71, 0x74, 0x64, 0x77, 0x69, 0x76, 0x64, 0x7c,
-  0x70, 0x85, 0x77, 0x88, 0x56, 0x8c, 0x57, 0x8c, 0x60, 0x8c, 0x56, 0x92,
-  0x5c, 0x94, 0x75, 0x85, 0x75, 0x82, 0x70, 0x84, 0x6f, 0x83, 0x6f, 0x83,
-  0x6e, 0x7f, 0x6f, 0x7f, 0x70, 0x80, 0x70, 0x80, 0x72, 0x80, 0x72, 0x7f,
-  0x70, 0x80, 0x6d, 0x7f, 0x67, 0x7d, 0x57, 0x8e, 0x51, 0x95, 0x54, 0x94,
-  0x55, 0x94, 0x4e, 0x94, 0x4a, 0x90, 0x5c, 0x80, 0x62, 0x82, 0x6b, 0x80,
-  0x77, 0x7f, 0x7c, 0x7e, 0x7a, 0x81, 0x6a, 0x8c, 0x67, 0x91, 0x7b, 0x8a,
-  0x7a, 0x83, 0x73, 0x83, 0x70, 0x7c, 0x74, 0x78, 0x75, 0x76, 0x76, 0x74,
-  0x77, 0x72, 0x7b, 0x70, 0x7f, 0x72, 0x81, 0x74, 0x7f, 0x73, 0x7d, 0x73,
-  0x7f, 0x73, 0x7f, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x75, 0x7d, 0x75,
-  0x7b, 0x74, 0x7b, 0x73, 0x7b, 0x75, 0x7a, 0x75, 0x7b, 0x73, 0x7b, 0x73,
-  0x7c, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7d, 0x73, 0x7e, 0x72, 0x7f, 0x70,
-  0x7f, 0x70, 0x80, 0x71, 0x80, 0x6f, 0x80, 0x6f, 0x80, 0x6f, 0x80, 0x6f,
-  0x80, 0x6f, 0x80, 0x6f, 0x80, 0x71, 0x80, 0x73, 0x80, 0x6f, 0x80, 0x70,
-  0x7f, 0x79, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x57, 0x65, 0x54, 0x67,
-  0x53, 0x67, 0x53, 0x67, 0x52, 0x67, 0x51, 0x67, 0x50, 0x66, 0x4f, 0x69,
-  0x4e, 0x69, 0x4d, 0x68, 0x4d, 0x68, 0x4d, 0x67, 0x4e, 0x67, 0x4f, 0x66,
-  0x4f, 0x65, 0x50, 0x64, 0x50, 0x64, 0x4f, 0x65, 0x4e, 0x66, 0x4e, 0x66,
-  0x4d, 0x66, 0x4c, 0x66, 0x4b, 0x68, 0x4b, 0x68, 0x50, 0x68, 0x57, 0x68,
-  0x5d, 0x68, 0x64, 0x69, 0x6c, 0x6c, 0x6f, 0x6e, 0x71, 0x6f, 0x73, 0x6f,
-  0x74, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x75, 0x6f, 0x73, 0x6f, 0x73, 0x6f,
-  0x73, 0x6f, 0x72, 0x6f, 0x74, 0x70, 0x76, 0x71, 0x76, 0x70, 0x71, 0x6d,
-  0x6d, 0x6c, 0x68, 0x6c, 0x5f, 0x69, 0x5b, 0x68, 0x53, 0x65, 0x4c, 0x66,
-  0x41, 0x65, 0x3e, 0x65, 0x3c, 0x65, 0x3c, 0x63, 0x3b, 0x63, 0x3d, 0x64,
-  0x3d, 0x62, 0x45, 0x68, 0x58, 0x79, 0x64, 0x82, 0x68, 0x82, 0x6a, 0x83,
-  0x69, 0x81, 0x68, 0x7e, 0x69, 0x7c, 0x6a, 0x7d, 0x4d, 0x7c, 0x49, 0x75,
-  0x62, 0x74, 0x66, 0x75, 0x6c, 0x76, 0x76, 0x7b, 0x68, 0x81, 0x6d, 0x86,
-  0x57, 0x8d, 0x5e, 0x8d, 0x65, 0x8c, 0x56, 0x90, 0x56, 0x8f, 0x65, 0x84,
-  0x69, 0x82, 0x68, 0x84, 0x68, 0x84, 0x67, 0x83, 0x67, 0x80, 0x67, 0x7f,
-  0x69, 0x80, 0x6b, 0x80, 0x6d, 0x80, 0x6e, 0x80, 0x6d, 0x7f, 0x6a, 0x7f,
-  0x67, 0x7e, 0x5e, 0x89, 0x55, 0x94, 0x52, 0x98, 0x4c, 0x9a, 0x4b, 0x8f,
-  0x53, 0x86, 0x60, 0x7e, 0x64, 0x82, 0x6d, 0x81, 0x76, 0x7f, 0x7a, 0x7e,
-  0x73, 0x84, 0x60, 0x8d, 0x70, 0x8f, 0x7d, 0x87, 0x76, 0x84, 0x70, 0x83,
-  0x73, 0x7e, 0x72, 0x7a, 0x71, 0x77, 0x70, 0x74, 0x70, 0x6f, 0x73, 0x6e,
-  0x79, 0x70, 0x7e, 0x73, 0x7f, 0x73, 0x7f, 0x73, 0x7f, 0x73, 0x7f, 0x73,
-  0x7d, 0x73, 0x7d, 0x73, 0x7c, 0x75, 0x7c, 0x74, 0x7b, 0x73, 0x7b, 0x73,
-  0x7a, 0x75, 0x7b, 0x75, 0x7a, 0x73, 0x7a, 0x73, 0x7c, 0x73, 0x7d, 0x73,
-  0x7d, 0x73, 0x7e, 0x73, 0x7e, 0x73, 0x7f, 0x72, 0x7f, 0x72, 0x80, 0x71,
-  0x80, 0x6f, 0x80, 0x6f, 0x80, 0x6f, 0x80, 0x6f, 0x80, 0x6f, 0x80, 0x6f,
-  0x80, 0x71, 0x80, 0x72, 0x80, 0x6f, 0x80, 0x71, 0x7f, 0x7a, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x80, 0x56, 0x65, 0x55, 0x67, 0x54, 0x67, 0x53, 0x68,
-  0x52, 0x68, 0x51, 0x69, 0x4f, 0x67, 0x4e, 0x69, 0x4d, 0x6a, 0x4d, 0x6a,
-  0x4d, 0x69, 0x4d, 0x68, 0x4d, 0x68, 0x4e, 0x67, 0x4e, 0x67, 0x4f, 0x66,
-  0x50, 0x66, 0x4f, 0x65, 0x4e, 0x66, 0x4e, 0x66, 0x4d, 0x66, 0x4c, 0x66,
-  0x4a, 0x68, 0x4c, 0x68, 0x52, 0x68, 0x59, 0x68, 0x5e, 0x68, 0x65, 0x69,
-  0x6c, 0x6c, 0x6f, 0x6e, 0x71, 0x70, 0x73, 0x6f, 0x74, 0x6f, 0x74, 0x6f,
-  0x74, 0x6f, 0x74, 0x6f, 0x73, 0x70, 0x73, 0x6f, 0x72, 0x6f, 0x72, 0x6e,
-  0x74, 0x70, 0x76, 0x70, 0x76, 0x71, 0x75, 0x6f, 0x73, 0x6e, 0x6d, 0x6e,
-  0x66, 0x6b, 0x62, 0x69, 0x5b, 0x66, 0x57, 0x66, 0x4c, 0x65, 0x40, 0x65,
-  0x3d, 0x65, 0x3c, 0x63, 0x3b, 0x63, 0x3c, 0x62, 0x47, 0x6d, 0x5c, 0x81,
-  0x6c, 0x8b, 0x6c, 0x89, 0x6f, 0x88, 0x75, 0x83, 0x79, 0x82, 0x6d, 0x83,
-  0x6b, 0x80, 0x67, 0x7e, 0x63, 0x7c, 0x53, 0x7c, 0x54, 0x79, 0x59, 0x7d,
-  0x55, 0x7c, 0x7c, 0x78, 0x71, 0x76, 0x56, 0x7d, 0x5b, 0x81, 0x66, 0x7e,
-  0x6b, 0x7e, 0x61, 0x81, 0x5e, 0x80, 0x66, 0x7c, 0x67, 0x7c, 0x66, 0x7f,
-  0x66, 0x80, 0x65, 0x80, 0x64, 0x80, 0x64, 0x7f, 0x66, 0x80, 0x6a, 0x80,
-  0x68, 0x80, 0x69, 0x80, 0x69, 0x80, 0x66, 0x80, 0x65, 0x7f, 0x63, 0x83,
-  0x5d, 0x88, 0x5b, 0x89, 0x51, 0x8b, 0x52, 0x81, 0x5b, 0x7d, 0x61, 0x81,
-  0x68, 0x84, 0x6f, 0x83, 0x75, 0x80, 0x77, 0x80, 0x6a, 0x88, 0x60, 0x8e,
-  0x76, 0x8f, 0x7a, 0x88, 0x75, 0x84, 0x72, 0x82, 0x72, 0x7f, 0x6e, 0x7c,
-  0x6e, 0x79, 0x6d, 0x79, 0x6d, 0x70, 0x6b, 0x6b, 0x70, 0x6e, 0x7a, 0x71,
-  0x7e, 0x72, 0x81, 0x73, 0x7f, 0x73, 0x7f, 0x73, 0x7d, 0x73, 0x7d, 0x73,
-  0x7c, 0x75, 0x7d, 0x75, 0x7b, 0x72, 0x7b, 0x73, 0x7b, 0x75, 0x7b, 0x75,
-  0x7a, 0x73, 0x7b, 0x73, 0x7c, 0x73, 0x7d, 0x73, 0x7d, 0x72, 0x7e, 0x72,
-  0x7e, 0x73, 0x7f, 0x74, 0x80, 0x73, 0x80, 0x71, 0x80, 0x6f, 0x80, 0x6f,
-  0x80, 0x6f, 0x81, 0x6f, 0x81, 0x6f, 0x80, 0x70, 0x80, 0x71, 0x80, 0x70,
-  0x80, 0x71, 0x7f, 0x72, 0x7f, 0x7a, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-  0x56, 0x66, 0x55, 0x66, 0x54, 0x66, 0x53, 0x68, 0x52, 0x69, 0x51, 0x6a,
-  0x50, 0x69, 0x4e, 0x6a, 0x4d, 0x6b, 0x4c, 0x6b, 0x4c, 0x6a, 0x4c, 0x68,
-  0x4c, 0x69, 0x4d, 0x68, 0x4d, 0x68, 0x4e, 0x66, 0x4e, 0x66, 0x4f, 0x65,
-  0x4e, 0x66, 0x4d, 0x66, 0x4d, 0x65, 0x4c, 0x67, 0x4b, 0x68, 0x4c, 0x68,
-  0x52, 0x68, 0x59, 0x69, 0x5f, 0x6a, 0x66, 0x6a, 0x6d, 0x6c, 0x6f, 0x6e,
-  0x72, 0x6f, 0x73, 0x6f, 0x73, 0x6f, 0x73, 0x6f, 0x73, 0x6f, 0x73, 0x6f,
-  0x72, 0x6f, 0x72, 0x6f, 0x72, 0x6e, 0x72, 0x6d, 0x73, 0x6f, 0x75, 0x70,
-  0x75, 0x70, 0x75, 0x6f, 0x74, 0x6f, 0x70, 0x6e, 0x68, 0x6c, 0x64, 0x6a,
-  0x5e, 0x67, 0x5a, 0x66, 0x54, 0x64, 0x47, 0x65, 0x41, 0x65, 0x3c, 0x65,
-  0x3b, 0x63, 0x3e, 0x63, 0x56, 0x7c, 0x69, 0x8c, 0x73, 0x88, 0x72, 0x88,
-  0x74, 0x89, 0x72, 0x85, 0x78, 0x84, 0x76, 0x83, 0x6c, 0x85, 0x66, 0x84,
-  0x65, 0x7e, 0x64, 0x7b, 0x56, 0x7b, 0x3e, 0x8b, 0x39, 0x8f, 0x67, 0x7f,
-  0x7d, 0x77, 0x63, 0x7a, 0x62, 0x7b, 0x67, 0x78, 0x6e, 0x77, 0x69, 0x78,
-  0x69, 0x77, 0x69, 0x78, 0x69, 0x7a, 0x67, 0x7c, 0x66, 0x7d, 0x65, 0x7f,
-  0x66, 0x7e, 0x65, 0x7d, 0x65, 0x80, 0x66, 0x7f, 0x66, 0x7e, 0x67, 0x80,
-  0x69, 0x81, 0x67, 0x80, 0x65, 0x80, 0x62, 0x84, 0x5d, 0x83, 0x5a, 0x82,
-  0x55, 0x81, 0x58, 0x7e, 0x5c, 0x7e, 0x62, 0x81, 0x6d, 0x82, 0x70, 0x83,
-  0x74, 0x82, 0x76, 0x84, 0x67, 0x8a, 0x66, 0x8e, 0x77, 0x8c, 0x74, 0x8a,
-  0x73, 0x86, 0x73, 0x82, 0x72, 0x7e, 0x6e, 0x7b, 0x6d, 0x79, 0x6e, 0x7c,
-  0x71, 0x75, 0x6a, 0x6b, 0x6b, 0x6b, 0x76, 0x6e, 0x7b, 0x71, 0x82, 0x74,
-  0x81, 0x72, 0x7f, 0x73, 0x7e, 0x74, 0x7e, 0x74, 0x7d, 0x75, 0x7e, 0x75,
-  0x7d, 0x74, 0x7c, 0x74, 0x7b, 0x75, 0x7b, 0x75, 0x7c, 0x75, 0x7c, 0x74,
-  0x7d, 0x72, 0x7d, 0x72, 0x7e, 0x72, 0x7f, 0x73, 0x7f, 0x73, 0x80, 0x73,
-  0x80, 0x72, 0x81, 0x70, 0x82, 0x70, 0x81, 0x6f, 0x82, 0x70, 0x82, 0x70,
-  0x82, 0x70, 0x81, 0x70, 0x80, 0x70, 0x81, 0x6f, 0x81, 0x72, 0x80, 0x74,
-  0x80, 0x78, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x56, 0x65, 0x55, 0x64,
-  0x54, 0x65, 0x54, 0x68, 0x52, 0x6a, 0x51, 0x6a, 0x51, 0x69, 0x4e, 0x6a,
-  0x4d, 0x6a, 0x4c, 0x6b, 0x4c, 0x6a, 0x4c, 0x6a, 0x4b, 0x6a, 0x4c, 0x68,
-  0x4d, 0x68, 0x4e, 0x66, 0x4e, 0x66, 0x4e, 0x66, 0x4d, 0x66, 0x4e, 0x66,
-  0x4d, 0x65, 0x4c, 0x67, 0x4c, 0x68, 0x4c, 0x68, 0x51, 0x68, 0x5a, 0x69,
-  0x61, 0x6a, 0x68, 0x6a, 0x6d, 0x6c, 0x6f, 0x6e, 0x72, 0x6f, 0x72, 0x6f,
-  0x73, 0x6f, 0x72, 0x6f, 0x73, 0x6f, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x70,
-  0x72, 0x6e, 0x71, 0x6d, 0x72, 0x6f, 0x73, 0x6f, 0x73, 0x6e, 0x73, 0x6e,
-  0x73, 0x6e, 0x71, 0x6d, 0x6d, 0x6e, 0x6a, 0x6c, 0x65, 0x69, 0x60, 0x68,
-  0x5b, 0x66, 0x52, 0x65, 0x4b, 0x65, 0x42, 0x63, 0x41, 0x64, 0x4c, 0x6e,
-  0x67, 0x86, 0x71, 0x82, 0x74, 0x7b, 0x79, 0x80, 0x82, 0x81, 0x7e, 0x83,
-  0x79, 0x87, 0x76, 0x87, 0x6f, 0x88, 0x68, 0x89, 0x65, 0x84, 0x64, 0x7f,
-  0x62, 0x7c, 0x47, 0x84, 0x32, 0x90, 0x3b, 0x96, 0x58, 0x8d, 0x67, 0x7f,
-  0x66, 0x7d, 0x5f, 0x7f, 0x56, 0x83, 0x5b, 0x81, 0x66, 0x7a, 0x68, 0x76,
-  0x68, 0x78, 0x68, 0x7b, 0x65, 0x7e, 0x65, 0x7e, 0x66, 0x7c, 0x66, 0x7b,
-  0x65, 0x7b, 0x65, 0x7a, 0x64, 0x7b, 0x65, 0x7d, 0x66, 0x7d, 0x68, 0x80,
-  0x66, 0x82, 0x62, 0x82, 0x5c, 0x81, 0x58, 0x81, 0x55, 0x80, 0x5a, 0x7f,
-  0x5d, 0x80, 0x67, 0x80, 0x6f, 0x80, 0x70, 0x82, 0x73, 0x84, 0x73, 0x85,
-  0x64, 0x8c, 0x72, 0x8e, 0x7a, 0x85, 0x70, 0x87, 0x6d, 0x83, 0x6f, 0x7e,
-  0x6f, 0x7b, 0x6d, 0x7c, 0x72, 0x7b, 0x77, 0x7f, 0x7e, 0x7d, 0x75, 0x74,
-  0x68, 0x6c, 0x6f, 0x6c, 0x76, 0x6f, 0x7d, 0x73, 0x7f, 0x73, 0x80, 0x73,
-  0x7f, 0x75, 0x7f, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x7e, 0x75, 0x7e, 0x75,
-  0x7c, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7c, 0x75, 0x7d, 0x74, 0x7d, 0x74,
-  0x7e, 0x73, 0x7f, 0x73, 0x80, 0x72, 0x80, 0x72, 0x80, 0x72, 0x82, 0x70,
-  0x82, 0x70, 0x82, 0x6f, 0x82, 0x6f, 0x82, 0x70, 0x82, 0x70, 0x82, 0x70,
-  0x82, 0x70, 0x83, 0x6f, 0x81, 0x71, 0x80, 0x73, 0x80, 0x78, 0x80, 0x7e,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-  0x7f, 0x80, 0x7f, 0x80, 0x55, 0x63, 0x56, 0x63, 0x55, 0x65, 0x54, 0x68,
-  0x53, 0x6a, 0x52, 0x6b, 0x50, 0x69, 0x4f, 0x69, 0x4d, 0x6a, 0x4d, 0x6b,
-  0x4c, 0x6a, 0x4c, 0x6a, 0x4c, 0x6a, 0x4c, 0x67, 0x4c, 0x68, 0x4d, 0x66,
-  0x4e, 0x66, 0x4e, 0x66, 0x4e, 0x66, 0x4e, 0x66, 0x4d, 0x66, 0x4c, 0x68,
-  0x4c, 0x68, 0x4d, 0x68, 0x51, 0x68, 0x5a, 0x69, 0x63, 0x6a, 0x69, 0x6a,
-  0x6d, 0x6c, 0x6f, 0x6e, 0x72, 0x70, 0x73, 0x70, 0x73, 0x6f, 0x73, 0x6f,
-  0x73, 0x70, 0x73, 0x70, 0x72, 0x70, 0x72, 0x70, 0x72, 0x6e, 0x72, 0x6d,
-  0x72, 0x6f, 0x71, 0x6f, 0x72, 0x6e, 0x71, 0x6c, 0x71, 0x6c, 0x71, 0x6e,
-  0x71, 0x6e, 0x6f, 0x6e, 0x6a, 0x6b, 0x67, 0x6a, 0x62, 0x67, 0x5a, 0x65,
-  0x56, 0x65, 0x4c, 0x62, 0x4d, 0x65, 0x5a, 0x77, 0x6f, 0x83, 0x73, 0x7c,
-  0x74, 0x7b, 0x7c, 0x7d, 0x81, 0x7d, 0x85, 0x80, 0x86, 0x83, 0x75, 0x89,
-  0x74, 0x89, 0x6e, 0x8b, 0x65, 0x89, 0x63, 0x84, 0x67, 0x80, 0x60, 0x79,
-  0x4e, 0x7c, 0x30, 0x96, 0x3a, 0x97, 0x5d, 0x7b, 0x59, 0x81, 0x50, 0x8b,
-  0x3c, 0x97, 0x3c, 0x99, 0x50, 0x89, 0x69, 0x73, 0x69, 0x75, 0x68, 0x7a,
-  0x65, 0x7e, 0x65, 0x7e, 0x66, 0x7a, 0x66, 0x7a, 0x65, 0x7b, 0x65, 0x7b,
-  0x63, 0x7d, 0x63, 0x7e, 0x63, 0x7d, 0x68, 0x82, 0x63, 0x82, 0x5e, 0x7f,
-  0x58, 0x80, 0x58, 0x80, 0x57, 0x7f, 0x5b, 0x7f, 0x5f, 0x80, 0x6b, 0x80,
-  0x6f, 0x80, 0x70, 0x82, 0x73, 0x84, 0x70, 0x85, 0x60, 0x8b, 0x7d, 0x8b,
-  0x7e, 0x83, 0x6b, 0x84, 0x6a, 0x80, 0x6d, 0x7e, 0x6c, 0x7e, 0x6e, 0x7e,
-  0x7c, 0x7e, 0x85, 0x7e, 0x83, 0x80, 0x80, 0x7d, 0x6a, 0x6e, 0x6b, 0x6b,
-  0x71, 0x6e, 0x78, 0x73, 0x7d, 0x73, 0x80, 0x73, 0x7e, 0x74, 0x7f, 0x75,
-  0x7d, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x7e, 0x74, 0x7d, 0x75, 0x7c, 0x75,
-  0x7c, 0x75, 0x7c, 0x74, 0x7d, 0x75, 0x7d, 0x76, 0x7e, 0x74, 0x7f, 0x73,
-  0x7f, 0x72, 0x80, 0x72, 0x81, 0x72, 0x82, 0x70, 0x82, 0x70, 0x82, 0x70,
-  0x82, 0x6f, 0x82, 0x71, 0x82, 0x71, 0x84, 0x70, 0x84, 0x70, 0x83, 0x6f,
-  0x81, 0x6f, 0x80, 0x70, 0x80, 0x78, 0x80, 0x7e, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-  0x56, 0x60, 0x56, 0x61, 0x56, 0x63, 0x55, 0x66, 0x54, 0x67, 0x52, 0x6a,
-  0x50, 0x69, 0x4f, 0x6a, 0x4d, 0x6b, 0x4d, 0x6b, 0x4c, 0x6a, 0x4b, 0x6a,
-  0x4b, 0x6a, 0x4b, 0x69, 0x4b, 0x69, 0x4c, 0x67, 0x4d, 0x65, 0x4e, 0x66,
-  0x4d, 0x65, 0x4d, 0x66, 0x4d, 0x67, 0x4c, 0x68, 0x4b, 0x68, 0x4c, 0x69,
-  0x51, 0x69, 0x5c, 0x69, 0x63, 0x69, 0x69, 0x6b, 0x6d, 0x6d, 0x6f, 0x6d,
-  0x71, 0x6e, 0x71, 0x6f, 0x73, 0x6e, 0x72, 0x6e, 0x71, 0x6f, 0x71, 0x6e,
-  0x71, 0x6e, 0x71, 0x6f, 0x71, 0x6e, 0x71, 0x6e, 0x71, 0x6e, 0x71, 0x6e,
-  0x71, 0x6d, 0x70, 0x6c, 0x6f, 0x6d, 0x70, 0x6e, 0x71, 0x6e, 0x70, 0x6e,
-  0x6e, 0x6c, 0x6b, 0x6a, 0x66, 0x69, 0x61, 0x66, 0x5c, 0x64, 0x56, 0x63,
-  0x57, 0x6a, 0x5f, 0x7b, 0x73, 0x7d, 0x78, 0x7c, 0x7a, 0x7d, 0x83, 0x7e,
-  0x80, 0x80, 0x81, 0x80, 0x83, 0x82, 0x7f, 0x89, 0x77, 0x89, 0x72, 0x89,
-  0x66, 0x8c, 0x62, 0x86, 0x60, 0x83, 0x61, 0x7c, 0x5e, 0x76, 0x4b, 0x7e,
-  0x50, 0x80, 0x62, 0x6f, 0x55, 0x7b, 0x42, 0x8d, 0x31, 0x9e, 0x35, 0x9f,
-  0x4f, 0x88, 0x6b, 0x72, 0x6b, 0x74, 0x67, 0x78, 0x66, 0x7a, 0x65, 0x7b,
-  0x64, 0x7a, 0x64, 0x7a, 0x64, 0x7a, 0x63, 0x7a, 0x63, 0x7c, 0x62, 0x7c,
-  0x63, 0x7d, 0x67, 0x82, 0x62, 0x83, 0x5b, 0x80, 0x57, 0x80, 0x5b, 0x80,
-  0x5b, 0x82, 0x5c, 0x83, 0x62, 0x83, 0x6d, 0x80, 0x6e, 0x81, 0x70, 0x83,
-  0x73, 0x85, 0x6e, 0x86, 0x61, 0x88, 0x83, 0x8a, 0x7a, 0x83, 0x67, 0x85,
-  0x68, 0x81, 0x6a, 0x80, 0x6a, 0x80, 0x73, 0x7f, 0x84, 0x7d, 0x8b, 0x7c,
-  0x84, 0x7f, 0x83, 0x7f, 0x6f, 0x73, 0x69, 0x6d, 0x6e, 0x6f, 0x74, 0x71,
-  0x7a, 0x73, 0x7f, 0x74, 0x7f, 0x75, 0x7e, 0x74, 0x7d, 0x75, 0x7e, 0x75,
-  0x7e, 0x75, 0x7e, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75,
-  0x7e, 0x76, 0x7e, 0x76, 0x7f, 0x75, 0x7f, 0x74, 0x80, 0x73, 0x81, 0x72,
-  0x81, 0x73, 0x83, 0x72, 0x82, 0x70, 0x83, 0x6f, 0x83, 0x6f, 0x84, 0x70,
-  0x84, 0x6f, 0x85, 0x6f, 0x86, 0x70, 0x83, 0x70, 0x81, 0x6e, 0x81, 0x70,
-  0x80, 0x76, 0x7f, 0x7d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x57, 0x5e, 0x56, 0x61,
-  0x56, 0x62, 0x56, 0x64, 0x55, 0x65, 0x52, 0x67, 0x50, 0x69, 0x4f, 0x6b,
-  0x4d, 0x6b, 0x4c, 0x6b, 0x4b, 0x6a, 0x4a, 0x6b, 0x4b, 0x6a, 0x4b, 0x6a,
-  0x4b, 0x6a, 0x4b, 0x69, 0x4b, 0x66, 0x4c, 0x66, 0x4c, 0x66, 0x4c, 0x67,
-  0x4b, 0x68, 0x4b, 0x68, 0x4b, 0x68, 0x4c, 0x67, 0x51, 0x67, 0x5d, 0x68,
-  0x64, 0x69, 0x68, 0x6c, 0x6e, 0x6d, 0x6f, 0x6d, 0x70, 0x6e, 0x70, 0x6e,
-  0x72, 0x6d, 0x72, 0x6d, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
-  0x70, 0x6e, 0x70, 0x6e, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d,
-  0x6f, 0x6d, 0x6f, 0x6e, 0x6f, 0x6e, 0x70, 0x6e, 0x70, 0x6d, 0x6f, 0x6b,
-  0x6b, 0x6c, 0x68, 0x69, 0x62, 0x66, 0x5e, 0x68, 0x60, 0x70, 0x6c, 0x7a,
-  0x78, 0x7c, 0x7b, 0x7e, 0x7f, 0x7d, 0x7f, 0x80, 0x7e, 0x83, 0x77, 0x87,
-  0x77, 0x8d, 0x81, 0x89, 0x7c, 0x88, 0x75, 0x86, 0x65, 0x8b, 0x61, 0x88,
-  0x60, 0x83, 0x61, 0x80, 0x62, 0x7b, 0x5e, 0x76, 0x5e, 0x72, 0x60, 0x71,
-  0x5d, 0x77, 0x4d, 0x82, 0x3a, 0x93, 0x43, 0x94, 0x5f, 0x82, 0x67, 0x78,
-  0x67, 0x76, 0x66, 0x74, 0x65, 0x76, 0x65, 0x78, 0x63, 0x79, 0x63, 0x78,
-  0x63, 0x77, 0x63, 0x78, 0x63, 0x78, 0x63, 0x79, 0x63, 0x7b, 0x65, 0x7e,
-  0x65, 0x82, 0x5f, 0x80, 0x5a, 0x83, 0x5d, 0x85, 0x5e, 0x85, 0x5f, 0x85,
-  0x69, 0x84, 0x6f, 0x7f, 0x6d, 0x84, 0x70, 0x86, 0x73, 0x87, 0x69, 0x8a,
-  0x64, 0x88, 0x85, 0x88, 0x77, 0x82, 0x64, 0x85, 0x65, 0x82, 0x68, 0x80,
-  0x68, 0x7f, 0x7c, 0x7f, 0x8a, 0x7d, 0x8d, 0x7c, 0x84, 0x7f, 0x82, 0x7f,
-  0x74, 0x77, 0x65, 0x70, 0x69, 0x71, 0x6e, 0x71, 0x74, 0x73, 0x7a, 0x74,
-  0x7e, 0x74, 0x7e, 0x74, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75,
-  0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x7f, 0x75,
-  0x80, 0x75, 0x80, 0x75, 0x80, 0x74, 0x82, 0x73, 0x82, 0x73, 0x82, 0x73,
-  0x83, 0x70, 0x85, 0x6f, 0x85, 0x6f, 0x85, 0x6e, 0x85, 0x6f, 0x86, 0x6f,
-  0x85, 0x6f, 0x83, 0x70, 0x82, 0x6e, 0x82, 0x71, 0x80, 0x75, 0x7e, 0x7c,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x57, 0x5f, 0x56, 0x61, 0x56, 0x61, 0x56, 0x64,
-  0x55, 0x65, 0x52, 0x66, 0x50, 0x69, 0x4f, 0x6b, 0x4e, 0x6b, 0x4d, 0x6a,
-  0x4b, 0x6b, 0x4a, 0x6c, 0x4b, 0x6b, 0x4b, 0x69, 0x4b, 0x6a, 0x4a, 0x6a,
-  0x4a, 0x68, 0x4b, 0x67, 0x4b, 0x68, 0x4c, 0x67, 0x4b, 0x67, 0x4b, 0x68,
-  0x4b, 0x69, 0x4d, 0x66, 0x53, 0x66, 0x5e, 0x67, 0x63, 0x69, 0x69, 0x6c,
-  0x6e, 0x6d, 0x6f, 0x6d, 0x70, 0x6e, 0x70, 0x6e, 0x71, 0x6e, 0x72, 0x6e,
-  0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x71, 0x6e,
-  0x6f, 0x6e, 0x6d, 0x6e, 0x6e, 0x6e, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6e,
-  0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x72, 0x6d, 0x71, 0x6d, 0x6c, 0x6a,
-  0x67, 0x6a, 0x62, 0x6b, 0x66, 0x73, 0x73, 0x79, 0x7a, 0x7b, 0x7c, 0x7e,
-  0x7f, 0x7f, 0x7b, 0x81, 0x7d, 0x81, 0x75, 0x87, 0x72, 0x8e, 0x7b, 0x8b,
-  0x80, 0x88, 0x7a, 0x86, 0x6b, 0x89, 0x61, 0x88, 0x60, 0x85, 0x61, 0x81,
-  0x62, 0x7e, 0x5f, 0x7a, 0x5e, 0x74, 0x5f, 0x75, 0x5f, 0x79, 0x58, 0x7c,
-  0x53, 0x81, 0x54, 0x81, 0x60, 0x7b, 0x64, 0x78, 0x63, 0x74, 0x63, 0x72,
-  0x63, 0x75, 0x64, 0x77, 0x66, 0x78, 0x65, 0x77, 0x63, 0x76, 0x63, 0x76,
-  0x63, 0x77, 0x62, 0x78, 0x61, 0x79, 0x63, 0x7d, 0x63, 0x81, 0x5f, 0x7e,
-  0x5e, 0x81, 0x5e, 0x85, 0x60, 0x86, 0x62, 0x85, 0x6b, 0x82, 0x72, 0x7e,
-  0x6f, 0x83, 0x6d, 0x87, 0x6c, 0x8a, 0x62, 0x8d, 0x68, 0x8a, 0x84, 0x84,
-  0x76, 0x82, 0x62, 0x86, 0x62, 0x82, 0x69, 0x81, 0x71, 0x7f, 0x7f, 0x7f,
-  0x89, 0x7d, 0x8b, 0x7d, 0x83, 0x7f, 0x81, 0x7f, 0x78, 0x79, 0x61, 0x72,
-  0x64, 0x73, 0x6a, 0x72, 0x6f, 0x72, 0x76, 0x74, 0x7c, 0x75, 0x7f, 0x74,
-  0x7e, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7d, 0x75,
-  0x7d, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x7f, 0x75, 0x7f, 0x75, 0x80, 0x75,
-  0x80, 0x74, 0x82, 0x72, 0x82, 0x73, 0x82, 0x72, 0x83, 0x70, 0x85, 0x6f,
-  0x86, 0x6f, 0x85, 0x6f, 0x85, 0x6f, 0x86, 0x6f, 0x85, 0x6f, 0x84, 0x70,
-  0x83, 0x6e, 0x83, 0x71, 0x80, 0x75, 0x7f, 0x7d, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x58, 0x5e, 0x57, 0x5e, 0x57, 0x60, 0x56, 0x63, 0x55, 0x63, 0x54, 0x64,
-  0x52, 0x69, 0x50, 0x6b, 0x4f, 0x6a, 0x4d, 0x6a, 0x4c, 0x6c, 0x4b, 0x6d,
-  0x4a, 0x6c, 0x49, 0x6a, 0x49, 0x6a, 0x49, 0x6a, 0x4a, 0x6a, 0x4a, 0x69,
-  0x4a, 0x68, 0x4b, 0x67, 0x4b, 0x67, 0x4b, 0x67, 0x4b, 0x67, 0x4e, 0x66,
-  0x56, 0x65, 0x60, 0x66, 0x65, 0x69, 0x69, 0x6b, 0x6d, 0x6c, 0x6f, 0x6b,
-  0x70, 0x6c, 0x70, 0x6c, 0x70, 0x6d, 0x70, 0x6d, 0x70, 0x6e, 0x6f, 0x6e,
-  0x70, 0x6d, 0x70, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6e, 0x6d, 0x6d, 0x6d,
-  0x6e, 0x6d, 0x6e, 0x6d, 0x6e, 0x6d, 0x6e, 0x6d, 0x6f, 0x6d, 0x70, 0x6d,
-  0x72, 0x6d, 0x75, 0x6e, 0x75, 0x6e, 0x6f, 0x6d, 0x69, 0x6d, 0x67, 0x6e,
-  0x6b, 0x75, 0x73, 0x7a, 0x77, 0x7c, 0x7b, 0x7d, 0x7f, 0x7e, 0x7d, 0x80,
-  0x7a, 0x83, 0x78, 0x84, 0x76, 0x85, 0x71, 0x8c, 0x7f, 0x89, 0x81, 0x85,
-  0x73, 0x87, 0x5f, 0x8b, 0x5e, 0x89, 0x60, 0x85, 0x60, 0x84, 0x5f, 0x7e,
-  0x5f, 0x7a, 0x60, 0x7a, 0x5e, 0x7b, 0x5c, 0x7a, 0x5f, 0x74, 0x5e, 0x71,
-  0x62, 0x70, 0x62, 0x6f, 0x62, 0x6f, 0x62, 0x6f, 0x62, 0x72, 0x64, 0x74,
-  0x66, 0x77, 0x65, 0x77, 0x63, 0x75, 0x63, 0x74, 0x63, 0x74, 0x63, 0x76,
-  0x61, 0x79, 0x60, 0x7b, 0x5b, 0x7b, 0x5a, 0x7b, 0x5e, 0x7d, 0x5d, 0x81,
-  0x60, 0x83, 0x64, 0x83, 0x6a, 0x7f, 0x75, 0x7c, 0x74, 0x80, 0x6a, 0x88,
-  0x63, 0x8b, 0x5d, 0x8b, 0x6d, 0x8b, 0x7b, 0x88, 0x74, 0x82, 0x62, 0x85,
-  0x64, 0x83, 0x6e, 0x7f, 0x80, 0x7d, 0x82, 0x7f, 0x86, 0x7c, 0x89, 0x7b,
-  0x82, 0x7f, 0x81, 0x80, 0x7b, 0x7b, 0x60, 0x73, 0x60, 0x73, 0x65, 0x72,
-  0x69, 0x72, 0x71, 0x74, 0x79, 0x74, 0x7d, 0x75, 0x7e, 0x75, 0x7d, 0x75,
-  0x7d, 0x75, 0x7e, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x7d, 0x75, 0x7d, 0x75,
-  0x7e, 0x75, 0x7e, 0x75, 0x7f, 0x75, 0x80, 0x75, 0x80, 0x74, 0x82, 0x72,
-  0x82, 0x73, 0x83, 0x71, 0x85, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x86, 0x6f,
-  0x86, 0x6f, 0x86, 0x6f, 0x87, 0x6f, 0x85, 0x70, 0x85, 0x70, 0x83, 0x71,
-  0x7f, 0x75, 0x7e, 0x7c, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x59, 0x5d, 0x58, 0x5d,
-  0x57, 0x5f, 0x56, 0x61, 0x56, 0x61, 0x54, 0x63, 0x53, 0x68, 0x51, 0x69,
-  0x4f, 0x68, 0x4d, 0x69, 0x4c, 0x6c, 0x4b, 0x6d, 0x49, 0x6d, 0x49, 0x6a,
-  0x49, 0x6a, 0x49, 0x69, 0x49, 0x6a, 0x49, 0x69, 0x4a, 0x68, 0x49, 0x67,
-  0x49, 0x67, 0x4b, 0x67, 0x4b, 0x67, 0x4e, 0x66, 0x57, 0x66, 0x62, 0x66,
-  0x66, 0x68, 0x68, 0x6a, 0x6c, 0x6b, 0x6e, 0x6a, 0x6f, 0x6b, 0x6f, 0x6b,
-  0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6d, 0x6f, 0x6c,
-  0x6d, 0x6c, 0x6d, 0x6c, 0x6e, 0x6c, 0x6e, 0x6d, 0x6e, 0x6c, 0x6e, 0x6d,
-  0x6e, 0x6d, 0x6d, 0x6c, 0x6e, 0x6c, 0x6f, 0x6c, 0x72, 0x6d, 0x75, 0x6e,
-  0x75, 0x6e, 0x6e, 0x6e, 0x67, 0x6e, 0x69, 0x71, 0x70, 0x77, 0x76, 0x7c,
-  0x78, 0x7d, 0x78, 0x7e, 0x79, 0x7d, 0x7a, 0x7f, 0x78, 0x85, 0x77, 0x86,
-  0x77, 0x88, 0x6f, 0x89, 0x7a, 0x87, 0x80, 0x87, 0x70, 0x86, 0x5b, 0x8b,
-  0x5e, 0x89, 0x61, 0x86, 0x5f, 0x87, 0x60, 0x81, 0x62, 0x7d, 0x63, 0x7c,
-  0x5e, 0x7a, 0x5d, 0x77, 0x5f, 0x70, 0x60, 0x6e, 0x61, 0x6d, 0x62, 0x6e,
-  0x62, 0x6e, 0x62, 0x6e, 0x62, 0x70, 0x62, 0x72, 0x62, 0x73, 0x62, 0x75,
-  0x61, 0x75, 0x61, 0x75, 0x63, 0x73, 0x63, 0x76, 0x61, 0x79, 0x5d, 0x79,
-  0x58, 0x76, 0x58, 0x78, 0x5a, 0x7d, 0x5a, 0x7f, 0x5f, 0x80, 0x63, 0x7f,
-  0x6a, 0x7d, 0x78, 0x7c, 0x73, 0x80, 0x6a, 0x89, 0x62, 0x8a, 0x5c, 0x8a,
-  0x6f, 0x8d, 0x75, 0x8f, 0x70, 0x84, 0x62, 0x84, 0x68, 0x83, 0x74, 0x7e,
-  0x84, 0x7b, 0x85, 0x7d, 0x88, 0x7b, 0x89, 0x7a, 0x81, 0x7f, 0x81, 0x80,
-  0x7b, 0x7c, 0x61, 0x73, 0x5f, 0x73, 0x62, 0x73, 0x65, 0x72, 0x6d, 0x74,
-  0x76, 0x73, 0x7c, 0x75, 0x7e, 0x75, 0x7e, 0x75, 0x7e, 0x75, 0x7e, 0x75,
-  0x7e, 0x74, 0x7e, 0x74, 0x7d, 0x75, 0x7c, 0x76, 0x7e, 0x75, 0x7f, 0x74,
-  0x7f, 0x75, 0x80, 0x75, 0x80, 0x74, 0x82, 0x73, 0x82, 0x72, 0x84, 0x71,
-  0x87, 0x6e, 0x87, 0x6e, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f,
-  0x88, 0x6f, 0x85, 0x6f, 0x84, 0x71, 0x83, 0x70, 0x7f, 0x75, 0x7e, 0x7c,
-  0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x80, 0x7f, 0x80, 0x7f, 0x57, 0x5e, 0x58, 0x5e, 0x57, 0x5e, 0x57, 0x61,
-  0x57, 0x62, 0x54, 0x63, 0x53, 0x67, 0x52, 0x68, 0x50, 0x68, 0x4e, 0x69,
-  0x4c, 0x6c, 0x4b, 0x6d, 0x49, 0x6d, 0x49, 0x6a, 0x49, 0x6b, 0x49, 0x6a,
-  0x49, 0x6a, 0x49, 0x69, 0x49, 0x69, 0x49, 0x67, 0x49, 0x67, 0x4a, 0x67,
-  0x4b, 0x67, 0x4e, 0x66, 0x57, 0x65, 0x61, 0x66, 0x64, 0x69, 0x66, 0x6b,
-  0x6a, 0x6b, 0x6c, 0x6b, 0x6e, 0x6b, 0x6d, 0x6b, 0x6f, 0x6d, 0x6f, 0x6d,
-  0x6f, 0x6e, 0x6f, 0x6d, 0x70, 0x6d, 0x70, 0x6d, 0x6e, 0x6d, 0x6e, 0x6d,
-  0x6e, 0x6c, 0x6e, 0x6d, 0x6e, 0x6d, 0x6e, 0x6d, 0x6e, 0x6d, 0x6d, 0x6d,
-  0x6d, 0x6d, 0x6f, 0x6c, 0x73, 0x6d, 0x75, 0x6e, 0x75, 0x6e, 0x6c, 0x6e,
-  0x65, 0x6e, 0x69, 0x72, 0x77, 0x77, 0x80, 0x7a, 0x82, 0x7f, 0x7e, 0x80,
-  0x78, 0x7f, 0x76, 0x7f, 0x73, 0x82, 0x75, 0x85, 0x72, 0x88, 0x6c, 0x8a,
-  0x76, 0x89, 0x7b, 0x8b, 0x75, 0x85, 0x63, 0x87, 0x5e, 0x8a, 0x5f, 0x88,
-  0x5e, 0x87, 0x62, 0x83, 0x68, 0x81, 0x65, 0x7d, 0x5e, 0x7b, 0x5d, 0x77,
-  0x5f, 0x6e, 0x60, 0x6d, 0x61, 0x6c, 0x63, 0x6e, 0x63, 0x6e, 0x62, 0x6d,
-  0x62, 0x6f, 0x61, 0x6f, 0x60, 0x70, 0x5f, 0x73, 0x60, 0x77, 0x5f, 0x79,
-  0x5f, 0x76, 0x5f, 0x75, 0x5f, 0x77, 0x5b, 0x77, 0x58, 0x77, 0x58, 0x79,
-  0x58, 0x7d, 0x5a, 0x7d, 0x60, 0x7c, 0x63, 0x7c, 0x6b, 0x7c, 0x76, 0x7e,
-  0x6f, 0x83, 0x66, 0x8b, 0x5c, 0x8a, 0x57, 0x89, 0x6d, 0x8c, 0x73, 0x8f,
-  0x71, 0x85, 0x5f, 0x86, 0x68, 0x81, 0x7b, 0x7e, 0x84, 0x7b, 0x88, 0x7b,
-  0x8c, 0x79, 0x8a, 0x79, 0x81, 0x7f, 0x81, 0x80, 0x7a, 0x7c, 0x5f, 0x73,
-  0x5d, 0x72, 0x61, 0x71, 0x63, 0x70, 0x67, 0x72, 0x72, 0x74, 0x7a, 0x75,
-  0x7e, 0x75, 0x7e, 0x75, 0x7e, 0x75, 0x7d, 0x75, 0x7b, 0x75, 0x7b, 0x74,
-  0x7d, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x7f, 0x74, 0x7f, 0x75, 0x80, 0x75,
-  0x81, 0x74, 0x82, 0x73, 0x82, 0x73, 0x85, 0x71, 0x87, 0x6e, 0x87, 0x6f,
-  0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x85, 0x6f,
-  0x84, 0x71, 0x83, 0x70, 0x80, 0x75, 0x7f, 0x7c, 0x7f, 0x80, 0x7f, 0x7f,
-  0x80, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x7f,
-  0x57, 0x60, 0x58, 0x60, 0x57, 0x5e, 0x57, 0x61, 0x57, 0x62, 0x54, 0x64,
-  0x53, 0x66, 0x51, 0x66, 0x4f, 0x67, 0x4e, 0x69, 0x4d, 0x6b, 0x4b, 0x6d,
-  0x4a, 0x6c, 0x49, 0x6b, 0x49, 0x6b, 0x49, 0x6a, 0x49, 0x6a, 0x49, 0x69,
-  0x49, 0x69, 0x49, 0x68, 0x49, 0x67, 0x4a, 0x68, 0x4b, 0x68, 0x4d, 0x66,
-  0x57, 0x65, 0x60, 0x66, 0x63, 0x68, 0x65, 0x6a, 0x69, 0x6b, 0x6a, 0x6b,
-  0x6c, 0x6b, 0x6c, 0x6b, 0x6f, 0x6c, 0x6f, 0x6d, 0x6f, 0x6e, 0x6f, 0x6e,
-  0x6f, 0x6d, 0x6f, 0x6d, 0x6e, 0x6d, 0x6e, 0x6c, 0x6e, 0x6d, 0x6e, 0x6c,
-  0x6e, 0x6c, 0x6e, 0x6c, 0x6e, 0x6d, 0x6e, 0x6d, 0x6d, 0x6c, 0x6f, 0x6d,
-  0x72, 0x6d, 0x75, 0x6e, 0x75, 0x6e, 0x6a, 0x6d, 0x64, 0x6d, 0x6a, 0x71,
-  0x7c, 0x75, 0x88, 0x74, 0x89, 0x81, 0x86, 0x83, 0x7e, 0x80, 0x75, 0x80,
-  0x6f, 0x84, 0x70, 0x82, 0x6f, 0x82, 0x6e, 0x8a, 0x71, 0x88, 0x74, 0x8c,
-  0x74, 0x84, 0x64, 0x85, 0x58, 0x8e, 0x5b, 0x8c, 0x5c, 0x88, 0x63, 0x84,
-  0x6c, 0x83, 0x67, 0x7f, 0x5f, 0x7e, 0x5d, 0x7b, 0x5f, 0x6e, 0x60, 0x6b,
-  0x61, 0x6b, 0x62, 0x6e, 0x62, 0x6e, 0x62, 0x6c, 0x62, 0x6d, 0x62, 0x70,
-  0x62, 0x73, 0x61, 0x74, 0x5f, 0x78, 0x5e, 0x7d, 0x5d, 0x79, 0x5d, 0x75,
-  0x5d, 0x76, 0x5a, 0x76, 0x58, 0x77, 0x58, 0x79, 0x59, 0x7e, 0x5e, 0x7b,
-  0x62, 0x79, 0x63, 0x79, 0x69, 0x7a, 0x71, 0x80, 0x6b, 0x85, 0x64, 0x8b,
-  0x59, 0x88, 0x54, 0x84, 0x69, 0x88, 0x70, 0x8c, 0x74, 0x83, 0x5d, 0x87,
-  0x67, 0x80, 0x7e, 0x7f, 0x85, 0x7b, 0x8b, 0x79, 0x8f, 0x77, 0x8c, 0x78,
-  0x81, 0x7f, 0x81, 0x80, 0x7a, 0x7c, 0x5f, 0x73, 0x5c, 0x73, 0x60, 0x71,
-  0x61, 0x6f, 0x63, 0x71, 0x6e, 0x73, 0x79, 0x75, 0x7e, 0x75, 0x7e, 0x75,
-  0x7e, 0x74, 0x7d, 0x74, 0x7a, 0x75, 0x7a, 0x75, 0x7c, 0x75, 0x7d, 0x76,
-  0x7e, 0x75, 0x7f, 0x75, 0x80, 0x75, 0x80, 0x75, 0x81, 0x74, 0x82, 0x73,
-  0x82, 0x73, 0x84, 0x71, 0x86, 0x6e, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f,
-  0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x85, 0x6f, 0x85, 0x71, 0x83, 0x71,
-  0x7f, 0x75, 0x7f, 0x7b, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-  0x7f, 0x7e, 0x80, 0x7e, 0x80, 0x7f, 0x80, 0x7f, 0x57, 0x5f, 0x57, 0x5f,
-  0x57, 0x5f, 0x57, 0x61, 0x56, 0x62, 0x55, 0x64, 0x54, 0x65, 0x52, 0x65,
-  0x50, 0x68, 0x4f, 0x69, 0x4d, 0x6b, 0x4b, 0x6d, 0x4a, 0x6c, 0x49, 0x6a,
-  0x49, 0x6a, 0x49, 0x6a, 0x49, 0x6b, 0x49, 0x69, 0x49, 0x6a, 0x49, 0x69,
-  0x49, 0x69, 0x49, 0x69, 0x4a, 0x68, 0x4e, 0x66, 0x58, 0x66, 0x60, 0x66,
-  0x62, 0x68, 0x64, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 0x6b, 0x6a, 0x6c, 0x6a,
-  0x6e, 0x6b, 0x6f, 0x6c, 0x6e, 0x6d, 0x6e, 0x6d, 0x6f, 0x6c, 0x6e, 0x6c,
-  0x6e, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6c, 0x6d, 0x6d,
-  0x6d, 0x6d, 0x6e, 0x6d, 0x6f, 0x6b, 0x70, 0x6b, 0x74, 0x6d, 0x76, 0x6e,
-  0x75, 0x6e, 0x68, 0x6d, 0x61, 0x6e, 0x6b, 0x73, 0x80, 0x74, 0x8b, 0x75,
-  0x91, 0x84, 0x8e, 0x82, 0x83, 0x80, 0x7c, 0x81, 0x72, 0x83, 0x6d, 0x82,
-  0x6e, 0x84, 0x71, 0x87, 0x71, 0x89, 0x74, 0x8b, 0x74, 0x86, 0x5f, 0x89,
-  0x56, 0x90, 0x5c, 0x89, 0x60, 0x86, 0x66, 0x83, 0x6a, 0x80, 0x68, 0x7e,
-  0x61, 0x7f, 0x5c, 0x7b, 0x5d, 0x6d, 0x5f, 0x6b, 0x61, 0x6b, 0x62, 0x6c,
-  0x62, 0x6c, 0x62, 0x6c, 0x62, 0x6d, 0x63, 0x70, 0x61, 0x74, 0x60, 0x74,
-  0x5e, 0x76, 0x5c, 0x7b, 0x5d, 0x78, 0x5d, 0x74, 0x5d, 0x74, 0x5c, 0x75,
-  0x5a, 0x77, 0x5a, 0x78, 0x5b, 0x7a, 0x5f, 0x79, 0x64, 0x7a, 0x64, 0x7b,
-  0x67, 0x7c, 0x6d, 0x82, 0x68, 0x87, 0x63, 0x8b, 0x59, 0x86, 0x54, 0x84,
-  0x66, 0x85, 0x72, 0x8a, 0x73, 0x84, 0x5b, 0x88, 0x6a, 0x81, 0x7f, 0x7f,
-  0x86, 0x7c, 0x8a, 0x79, 0x8e, 0x79, 0x8a, 0x7a, 0x82, 0x7f, 0x80, 0x80,
-  0x79, 0x7c, 0x60, 0x73, 0x5e, 0x72, 0x60, 0x71, 0x61, 0x70, 0x64, 0x71,
-  0x6d, 0x72, 0x75, 0x75, 0x7d, 0x75, 0x7d, 0x75, 0x7c, 0x74, 0x7b, 0x74,
-  0x7b, 0x74, 0x7b, 0x74, 0x7b, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7e, 0x75,
-  0x7f, 0x75, 0x80, 0x75, 0x82, 0x74, 0x83, 0x73, 0x84, 0x73, 0x85, 0x71,
-  0x87, 0x6e, 0x88, 0x6f, 0x88, 0x6f, 0x87, 0x6e, 0x87, 0x6e, 0x88, 0x6f,
-  0x87, 0x6f, 0x86, 0x6f, 0x86, 0x6f, 0x84, 0x70, 0x7f, 0x74, 0x7e, 0x7c,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x80, 0x7f, 0x80, 0x7f, 0x56, 0x60, 0x56, 0x60, 0x57, 0x61, 0x56, 0x60,
-  0x56, 0x61, 0x55, 0x62, 0x54, 0x63, 0x52, 0x65, 0x50, 0x68, 0x50, 0x69,
-  0x4d, 0x6a, 0x4c, 0x6b, 0x4b, 0x6b, 0x49, 0x69, 0x49, 0x6a, 0x48, 0x6b,
-  0x48, 0x6b, 0x48, 0x6a, 0x48, 0x69, 0x48, 0x6a, 0x48, 0x6a, 0x48, 0x6a,
-  0x49, 0x68, 0x50, 0x66, 0x59, 0x66, 0x5f, 0x66, 0x61, 0x69, 0x64, 0x6a,
-  0x68, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6c, 0x6a, 0x6d, 0x6a, 0x6e, 0x6b,
-  0x6d, 0x6d, 0x6d, 0x6c, 0x6e, 0x6a, 0x6e, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b,
-  0x6d, 0x6a, 0x6d, 0x6a, 0x6d, 0x6b, 0x6d, 0x6d, 0x6c, 0x6d, 0x6e, 0x6d,
-  0x71, 0x6b, 0x73, 0x6c, 0x75, 0x6e, 0x75, 0x6f, 0x6e, 0x73, 0x66, 0x76,
-  0x61, 0x75, 0x6f, 0x74, 0x84, 0x73, 0x8b, 0x78, 0x95, 0x86, 0x93, 0x81,
-  0x8c, 0x81, 0x8d, 0x88, 0x7f, 0x83, 0x6b, 0x84, 0x6b, 0x85, 0x6c, 0x86,
-  0x6c, 0x8c, 0x76, 0x89, 0x75, 0x87, 0x5b, 0x8c, 0x59, 0x8d, 0x64, 0x83,
-  0x6a, 0x82, 0x70, 0x7f, 0x6e, 0x7d, 0x6a, 0x7d, 0x65, 0x7d, 0x5d, 0x7a,
-  0x5c, 0x6e, 0x5f, 0x6b, 0x61, 0x6a, 0x62, 0x6a, 0x62, 0x6a, 0x62, 0x6b,
-  0x62, 0x6b, 0x62, 0x6e, 0x5f, 0x72, 0x5e, 0x72, 0x5d, 0x74, 0x5b, 0x75,
-  0x5d, 0x74, 0x5d, 0x72, 0x5d, 0x74, 0x5d, 0x75, 0x5c, 0x74, 0x5c, 0x74,
-  0x5d, 0x75, 0x5f, 0x76, 0x66, 0x7b, 0x69, 0x7d, 0x68, 0x7d, 0x68, 0x82,
-  0x63, 0x87, 0x5f, 0x8a, 0x5b, 0x84, 0x57, 0x81, 0x5d, 0x81, 0x6d, 0x86,
-  0x75, 0x84, 0x5f, 0x86, 0x73, 0x81, 0x82, 0x7f, 0x88, 0x7d, 0x88, 0x7b,
-  0x8a, 0x7b, 0x89, 0x7c, 0x83, 0x7f, 0x80, 0x80, 0x74, 0x7c, 0x5f, 0x72,
-  0x5f, 0x72, 0x5f, 0x71, 0x60, 0x6f, 0x64, 0x6f, 0x6a, 0x71, 0x70, 0x74,
-  0x7b, 0x75, 0x7d, 0x75, 0x7b, 0x73, 0x7a, 0x73, 0x7a, 0x72, 0x7a, 0x72,
-  0x7a, 0x73, 0x7a, 0x72, 0x7b, 0x72, 0x7d, 0x73, 0x7e, 0x74, 0x80, 0x75,
-  0x82, 0x74, 0x84, 0x73, 0x86, 0x73, 0x86, 0x71, 0x88, 0x6e, 0x88, 0x6f,
-  0x89, 0x6f, 0x88, 0x6e, 0x88, 0x6e, 0x88, 0x6f, 0x88, 0x6f, 0x87, 0x70,
-  0x87, 0x70, 0x85, 0x70, 0x80, 0x74, 0x7e, 0x7c, 0x80, 0x7f, 0x80, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x56, 0x61, 0x56, 0x61, 0x56, 0x60, 0x57, 0x61, 0x56, 0x61, 0x55, 0x61,
-  0x55, 0x63, 0x53, 0x66, 0x51, 0x67, 0x51, 0x67, 0x4f, 0x69, 0x4d, 0x6a,
-  0x4b, 0x6a, 0x49, 0x6a, 0x49, 0x6a, 0x48, 0x6b, 0x48, 0x6b, 0x49, 0x6a,
-  0x4a, 0x6a, 0x49, 0x6a, 0x49, 0x6a, 0x48, 0x6a, 0x49, 0x68, 0x52, 0x66,
-  0x5a, 0x65, 0x5d, 0x66, 0x62, 0x68, 0x65, 0x6a, 0x68, 0x6a, 0x69, 0x6a,
-  0x6a, 0x6a, 0x6c, 0x6a, 0x6d, 0x6b, 0x6f, 0x6b, 0x6d, 0x6d, 0x6e, 0x6d,
-  0x6e, 0x6b, 0x6e, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6b, 0x6d, 0x6a,
-  0x6d, 0x6c, 0x6d, 0x6d, 0x6c, 0x6d, 0x6e, 0x6d, 0x72, 0x6d, 0x73, 0x6e,
-  0x71, 0x71, 0x6e, 0x76, 0x68, 0x7d, 0x67, 0x81, 0x64, 0x7e, 0x74, 0x72,
-  0x84, 0x72, 0x89, 0x78, 0x93, 0x86, 0x92, 0x84, 0x91, 0x85, 0x93, 0x88,
-  0x8a, 0x83, 0x6f, 0x85, 0x6d, 0x83, 0x6a, 0x88, 0x65, 0x8b, 0x70, 0x86,
-  0x73, 0x87, 0x62, 0x8c, 0x62, 0x87, 0x69, 0x80, 0x6e, 0x7f, 0x75, 0x7b,
-  0x74, 0x7b, 0x6d, 0x7b, 0x66, 0x7b, 0x5f, 0x7a, 0x5d, 0x6f, 0x5f, 0x6a,
-  0x61, 0x69, 0x63, 0x68, 0x62, 0x68, 0x62, 0x69, 0x62, 0x6a, 0x61, 0x6c,
-  0x5d, 0x6e, 0x5d, 0x6f, 0x5d, 0x71, 0x5b, 0x6f, 0x5d, 0x70, 0x5d, 0x6f,
-  0x5d, 0x73, 0x5d, 0x73, 0x5e, 0x71, 0x5e, 0x70, 0x5f, 0x71, 0x5f, 0x75,
-  0x63, 0x7b, 0x6a, 0x7c, 0x6b, 0x7d, 0x68, 0x82, 0x60, 0x86, 0x5c, 0x88,
-  0x59, 0x81, 0x58, 0x7e, 0x59, 0x7c, 0x65, 0x81, 0x78, 0x83, 0x68, 0x83,
-  0x74, 0x7e, 0x82, 0x81, 0x86, 0x80, 0x85, 0x7e, 0x86, 0x7e, 0x88, 0x7c,
-  0x84, 0x7e, 0x7e, 0x7f, 0x6f, 0x7a, 0x5f, 0x72, 0x5f, 0x73, 0x5f, 0x71,
-  0x61, 0x6e, 0x63, 0x6e, 0x67, 0x70, 0x6d, 0x72, 0x78, 0x75, 0x7d, 0x75,
-  0x7c, 0x72, 0x7a, 0x72, 0x78, 0x70, 0x78, 0x71, 0x78, 0x70, 0x78, 0x71,
-  0x79, 0x71, 0x7c, 0x71, 0x7e, 0x73, 0x81, 0x75, 0x82, 0x74, 0x84, 0x73,
-  0x86, 0x73, 0x86, 0x71, 0x88, 0x6e, 0x88, 0x6f, 0x88, 0x70, 0x88, 0x6e,
-  0x88, 0x6e, 0x88, 0x6f, 0x88, 0x6f, 0x87, 0x71, 0x87, 0x72, 0x86, 0x71,
-  0x82, 0x74, 0x7f, 0x7c, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x56, 0x63, 0x56, 0x62,
-  0x56, 0x60, 0x57, 0x60, 0x57, 0x5f, 0x56, 0x60, 0x56, 0x62, 0x54, 0x65,
-  0x52, 0x67, 0x52, 0x67, 0x50, 0x68, 0x4e, 0x6a, 0x4c, 0x69, 0x4b, 0x69,
-  0x4a, 0x6a, 0x49, 0x6b, 0x48, 0x6b, 0x49, 0x6a, 0x49, 0x6a, 0x49, 0x6b,
-  0x49, 0x6b, 0x48, 0x6a, 0x49, 0x68, 0x52, 0x67, 0x59, 0x67, 0x5e, 0x67,
-  0x61, 0x68, 0x64, 0x69, 0x67, 0x68, 0x69, 0x69, 0x6a, 0x69, 0x6c, 0x6a,
-  0x6e, 0x6a, 0x70, 0x6b, 0x6e, 0x6c, 0x6e, 0x6c, 0x6d, 0x6b, 0x6d, 0x6a,
-  0x6c, 0x6a, 0x6c, 0x6b, 0x6c, 0x6b, 0x6c, 0x6a, 0x6c, 0x6b, 0x6c, 0x6c,
-  0x6d, 0x6c, 0x70, 0x6c, 0x72, 0x6b, 0x6e, 0x6e, 0x69, 0x77, 0x67, 0x80,
-  0x67, 0x84, 0x66, 0x86, 0x65, 0x82, 0x77, 0x73, 0x85, 0x73, 0x8a, 0x79,
-  0x91, 0x82, 0x8f, 0x81, 0x8f, 0x84, 0x90, 0x85, 0x8e, 0x7e, 0x79, 0x82,
-  0x71, 0x83, 0x6b, 0x87, 0x60, 0x8c, 0x6b, 0x86, 0x73, 0x86, 0x75, 0x88,
-  0x6f, 0x81, 0x6a, 0x7c, 0x6f, 0x7b, 0x74, 0x79, 0x76, 0x7a, 0x71, 0x7a,
-  0x69, 0x79, 0x62, 0x79, 0x60, 0x72, 0x60, 0x6c, 0x60, 0x6a, 0x61, 0x6a,
-  0x62, 0x6a, 0x63, 0x68, 0x62, 0x68, 0x61, 0x69, 0x5e, 0x6b, 0x5d, 0x6c,
-  0x5c, 0x6f, 0x5b, 0x6e, 0x5d, 0x6e, 0x5d, 0x6d, 0x5d, 0x6e, 0x5d, 0x6e,
-  0x5e, 0x6e, 0x5f, 0x6e, 0x5e, 0x71, 0x60, 0x75, 0x62, 0x7b, 0x66, 0x7d,
-  0x69, 0x7f, 0x68, 0x84, 0x60, 0x87, 0x59, 0x87, 0x56, 0x81, 0x56, 0x7d,
-  0x5b, 0x79, 0x61, 0x7d, 0x77, 0x81, 0x6b, 0x81, 0x6c, 0x7e, 0x78, 0x81,
-  0x80, 0x80, 0x82, 0x7f, 0x88, 0x7e, 0x8b, 0x7d, 0x81, 0x7e, 0x77, 0x7a,
-  0x6b, 0x77, 0x60, 0x71, 0x5f, 0x71, 0x5f, 0x6e, 0x61, 0x6d, 0x62, 0x6d,
-  0x65, 0x6f, 0x6a, 0x72, 0x75, 0x74, 0x7c, 0x74, 0x7b, 0x72, 0x79, 0x71,
-  0x77, 0x71, 0x77, 0x71, 0x77, 0x70, 0x77, 0x6f, 0x77, 0x71, 0x7a, 0x71,
-  0x7c, 0x72, 0x7f, 0x74, 0x81, 0x73, 0x83, 0x72, 0x85, 0x72, 0x87, 0x71,
-  0x89, 0x6f, 0x89, 0x6e, 0x89, 0x6e, 0x89, 0x6e, 0x89, 0x6e, 0x88, 0x6f,
-  0x88, 0x6e, 0x88, 0x70, 0x87, 0x70, 0x86, 0x6f, 0x81, 0x73, 0x7f, 0x7b,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x55, 0x66, 0x56, 0x63, 0x56, 0x61, 0x56, 0x61,
-  0x57, 0x5e, 0x57, 0x60, 0x56, 0x62, 0x55, 0x64, 0x53, 0x66, 0x52, 0x66,
-  0x51, 0x67, 0x50, 0x68, 0x4d, 0x67, 0x4b, 0x69, 0x4a, 0x6b, 0x49, 0x6a,
-  0x48, 0x6a, 0x48, 0x6a, 0x48, 0x6a, 0x48, 0x6a, 0x47, 0x6a, 0x48, 0x6a,
-  0x48, 0x68, 0x51, 0x67, 0x58, 0x68, 0x5f, 0x68, 0x5f, 0x68, 0x62, 0x67,
-  0x64, 0x67, 0x66, 0x67, 0x68, 0x68, 0x6a, 0x68, 0x6d, 0x68, 0x6f, 0x6b,
-  0x6e, 0x6a, 0x6e, 0x6b, 0x6d, 0x6a, 0x6d, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b,
-  0x6a, 0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x6e, 0x6a, 0x70, 0x6b,
-  0x6e, 0x6e, 0x69, 0x75, 0x65, 0x80, 0x65, 0x85, 0x65, 0x85, 0x64, 0x88,
-  0x64, 0x84, 0x77, 0x78, 0x86, 0x77, 0x8a, 0x76, 0x8f, 0x78, 0x91, 0x78,
-  0x8f, 0x7e, 0x92, 0x80, 0x95, 0x78, 0x88, 0x7d, 0x78, 0x81, 0x6d, 0x85,
-  0x5f, 0x8d, 0x6a, 0x88, 0x75, 0x85, 0x7f, 0x81, 0x77, 0x7c, 0x70, 0x79,
-  0x73, 0x78, 0x72, 0x78, 0x78, 0x7a, 0x77, 0x7a, 0x72, 0x79, 0x69, 0x78,
-  0x63, 0x75, 0x60, 0x70, 0x5e, 0x6d, 0x60, 0x6b, 0x63, 0x6a, 0x63, 0x67,
-  0x63, 0x67, 0x61, 0x67, 0x60, 0x68, 0x5f, 0x6a, 0x5d, 0x6b, 0x5d, 0x6b,
-  0x5e, 0x6c, 0x5e, 0x6c, 0x5e, 0x6c, 0x5e, 0x6c, 0x5b, 0x6c, 0x5e, 0x6e,
-  0x5f, 0x73, 0x62, 0x76, 0x66, 0x7c, 0x67, 0x7f, 0x67, 0x82, 0x62, 0x86,
-  0x5c, 0x87, 0x58, 0x85, 0x54, 0x81, 0x56, 0x7d, 0x5b, 0x78, 0x5d, 0x79,
-  0x74, 0x7e, 0x6c, 0x7c, 0x68, 0x7f, 0x69, 0x80, 0x72, 0x7e, 0x78, 0x7c,
-  0x80, 0x7c, 0x80, 0x7d, 0x74, 0x7d, 0x73, 0x73, 0x68, 0x73, 0x5d, 0x70,
-  0x5f, 0x6e, 0x60, 0x6c, 0x60, 0x6d, 0x61, 0x6c, 0x64, 0x6f, 0x68, 0x73,
-  0x70, 0x74, 0x78, 0x72, 0x78, 0x71, 0x77, 0x71, 0x75, 0x70, 0x75, 0x70,
-  0x75, 0x6f, 0x75, 0x6e, 0x76, 0x70, 0x78, 0x70, 0x7a, 0x70, 0x7d, 0x70,
-  0x80, 0x71, 0x82, 0x72, 0x84, 0x72, 0x87, 0x71, 0x8a, 0x70, 0x8a, 0x6e,
-  0x89, 0x6d, 0x8a, 0x6e, 0x89, 0x6e, 0x88, 0x6e, 0x88, 0x6e, 0x88, 0x6d,
-  0x88, 0x6e, 0x86, 0x6d, 0x80, 0x73, 0x7e, 0x7a, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x56, 0x66, 0x56, 0x63, 0x56, 0x62, 0x56, 0x62, 0x57, 0x5f, 0x57, 0x60,
-  0x56, 0x63, 0x55, 0x64, 0x54, 0x66, 0x53, 0x65, 0x52, 0x66, 0x51, 0x67,
-  0x4e, 0x66, 0x4c, 0x69, 0x4b, 0x6b, 0x49, 0x6a, 0x48, 0x6a, 0x48, 0x6a,
-  0x48, 0x6a, 0x47, 0x6a, 0x47, 0x6a, 0x48, 0x6a, 0x48, 0x68, 0x50, 0x67,
-  0x56, 0x67, 0x5d, 0x68, 0x5e, 0x68, 0x60, 0x68, 0x63, 0x67, 0x65, 0x67,
-  0x67, 0x68, 0x69, 0x68, 0x6b, 0x68, 0x6e, 0x6b, 0x6e, 0x6b, 0x6e, 0x6b,
-  0x6d, 0x6a, 0x6d, 0x6a, 0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6a, 0x6b, 0x6a,
-  0x6a, 0x6a, 0x6b, 0x6b, 0x6d, 0x6a, 0x6d, 0x6c, 0x68, 0x72, 0x63, 0x7a,
-  0x63, 0x85, 0x64, 0x86, 0x64, 0x87, 0x60, 0x87, 0x62, 0x83, 0x76, 0x79,
-  0x86, 0x79, 0x89, 0x77, 0x8e, 0x76, 0x90, 0x78, 0x92, 0x7b, 0x94, 0x7b,
-  0x95, 0x78, 0x8f, 0x7a, 0x82, 0x7e, 0x6f, 0x83, 0x5e, 0x8b, 0x6a, 0x88,
-  0x74, 0x84, 0x7b, 0x7e, 0x75, 0x7a, 0x72, 0x77, 0x74, 0x78, 0x72, 0x78,
-  0x76, 0x7a, 0x78, 0x7a, 0x77, 0x79, 0x71, 0x78, 0x65, 0x78, 0x62, 0x75,
-  0x60, 0x6f, 0x61, 0x6c, 0x62, 0x6a, 0x63, 0x68, 0x62, 0x69, 0x62, 0x68,
-  0x61, 0x68, 0x61, 0x6a, 0x60, 0x68, 0x60, 0x69, 0x60, 0x6a, 0x60, 0x6b,
-  0x60, 0x6c, 0x5f, 0x6d, 0x5c, 0x6e, 0x5f, 0x70, 0x63, 0x74, 0x65, 0x78,
-  0x67, 0x7d, 0x68, 0x80, 0x68, 0x83, 0x5f, 0x88, 0x57, 0x87, 0x55, 0x84,
-  0x53, 0x81, 0x54, 0x7e, 0x5a, 0x78, 0x5c, 0x78, 0x74, 0x7d, 0x70, 0x7b,
-  0x69, 0x7d, 0x63, 0x80, 0x69, 0x7d, 0x6f, 0x7a, 0x76, 0x7a, 0x75, 0x7b,
-  0x72, 0x7b, 0x75, 0x71, 0x65, 0x71, 0x5e, 0x6f, 0x5f, 0x6e, 0x60, 0x6d,
-  0x61, 0x6d, 0x60, 0x6c, 0x62, 0x6f, 0x66, 0x72, 0x6d, 0x74, 0x74, 0x72,
-  0x76, 0x70, 0x76, 0x70, 0x73, 0x6e, 0x73, 0x6e, 0x73, 0x6e, 0x73, 0x6d,
-  0x74, 0x6e, 0x77, 0x6e, 0x79, 0x6f, 0x7c, 0x6f, 0x7e, 0x70, 0x82, 0x72,
-  0x84, 0x72, 0x87, 0x70, 0x8a, 0x70, 0x8a, 0x6e, 0x89, 0x6e, 0x89, 0x6e,
-  0x89, 0x6e, 0x88, 0x6d, 0x88, 0x6e, 0x88, 0x6e, 0x88, 0x6e, 0x86, 0x6f,
-  0x80, 0x75, 0x7e, 0x7a, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x55, 0x65, 0x55, 0x62,
-  0x56, 0x63, 0x57, 0x63, 0x57, 0x60, 0x56, 0x5f, 0x56, 0x61, 0x56, 0x63,
-  0x55, 0x64, 0x54, 0x64, 0x53, 0x65, 0x52, 0x65, 0x50, 0x65, 0x4e, 0x69,
-  0x4c, 0x6a, 0x4a, 0x69, 0x4a, 0x69, 0x49, 0x6a, 0x4a, 0x6a, 0x49, 0x6a,
-  0x48, 0x6a, 0x48, 0x69, 0x49, 0x68, 0x4f, 0x68, 0x55, 0x67, 0x5b, 0x67,
-  0x5d, 0x67, 0x60, 0x67, 0x63, 0x66, 0x64, 0x66, 0x66, 0x67, 0x68, 0x67,
-  0x6a, 0x68, 0x6c, 0x6a, 0x6d, 0x6b, 0x6d, 0x6b, 0x6b, 0x69, 0x6c, 0x6a,
-  0x6b, 0x6b, 0x6a, 0x6b, 0x6a, 0x6b, 0x6a, 0x6a, 0x69, 0x69, 0x6b, 0x6a,
-  0x6e, 0x6b, 0x6a, 0x6d, 0x62, 0x75, 0x5e, 0x7c, 0x5f, 0x85, 0x62, 0x86,
-  0x61, 0x85, 0x5c, 0x81, 0x5f, 0x7d, 0x75, 0x78, 0x84, 0x79, 0x87, 0x78,
-  0x8d, 0x76, 0x8d, 0x78, 0x91, 0x78, 0x95, 0x77, 0x95, 0x78, 0x8f, 0x77,
-  0x8b, 0x7a, 0x70, 0x82, 0x5c, 0x88, 0x67, 0x88, 0x72, 0x83, 0x74, 0x7a,
-  0x6f, 0x78, 0x72, 0x77, 0x74, 0x77, 0x71, 0x78, 0x70, 0x79, 0x74, 0x79,
-  0x77, 0x79, 0x77, 0x78, 0x70, 0x7a, 0x6b, 0x79, 0x67, 0x76, 0x63, 0x72,
-  0x62, 0x71, 0x62, 0x6f, 0x62, 0x6d, 0x62, 0x6a, 0x62, 0x68, 0x62, 0x68,
-  0x63, 0x66, 0x64, 0x67, 0x62, 0x69, 0x62, 0x6a, 0x63, 0x6c, 0x61, 0x6d,
-  0x62, 0x6f, 0x64, 0x72, 0x66, 0x76, 0x65, 0x79, 0x63, 0x7e, 0x62, 0x82,
-  0x63, 0x85, 0x5a, 0x89, 0x54, 0x87, 0x55, 0x82, 0x54, 0x7e, 0x54, 0x7d,
-  0x59, 0x79, 0x5b, 0x77, 0x71, 0x7b, 0x71, 0x80, 0x6b, 0x7f, 0x6a, 0x7d,
-  0x68, 0x7d, 0x6d, 0x7d, 0x70, 0x7d, 0x6d, 0x7b, 0x70, 0x78, 0x6e, 0x72,
-  0x64, 0x73, 0x62, 0x70, 0x60, 0x6e, 0x60, 0x6c, 0x5f, 0x6b, 0x5f, 0x6c,
-  0x61, 0x6f, 0x64, 0x73, 0x6a, 0x74, 0x71, 0x71, 0x75, 0x6f, 0x75, 0x6d,
-  0x72, 0x6c, 0x73, 0x6d, 0x71, 0x6c, 0x72, 0x6c, 0x72, 0x6d, 0x75, 0x6d,
-  0x77, 0x6d, 0x7a, 0x6f, 0x7d, 0x70, 0x82, 0x72, 0x83, 0x71, 0x86, 0x6f,
-  0x8a, 0x6f, 0x8a, 0x6e, 0x89, 0x6e, 0x8a, 0x6d, 0x8a, 0x6d, 0x89, 0x6e,
-  0x88, 0x6e, 0x89, 0x6e, 0x89, 0x6e, 0x87, 0x6e, 0x81, 0x74, 0x7f, 0x7a,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x7d, 0x7f, 0x7e, 0x55, 0x64, 0x55, 0x61, 0x55, 0x62, 0x57, 0x63,
-  0x56, 0x63, 0x56, 0x5f, 0x57, 0x5d, 0x57, 0x5f, 0x55, 0x61, 0x55, 0x63,
-  0x54, 0x65, 0x52, 0x65, 0x51, 0x66, 0x4e, 0x68, 0x4c, 0x68, 0x4b, 0x68,
-  0x4b, 0x68, 0x4c, 0x6a, 0x4c, 0x6a, 0x4b, 0x69, 0x49, 0x69, 0x48, 0x68,
-  0x49, 0x68, 0x4e, 0x68, 0x55, 0x67, 0x5b, 0x67, 0x5d, 0x66, 0x60, 0x66,
-  0x63, 0x66, 0x65, 0x66, 0x66, 0x66, 0x69, 0x65, 0x6b, 0x68, 0x6b, 0x68,
-  0x6b, 0x6a, 0x6b, 0x6a, 0x69, 0x68, 0x6b, 0x6a, 0x6c, 0x6c, 0x6a, 0x6c,
-  0x6a, 0x6c, 0x68, 0x6a, 0x68, 0x68, 0x6b, 0x69, 0x6c, 0x6b, 0x66, 0x6f,
-  0x5e, 0x78, 0x5d, 0x7e, 0x5d, 0x83, 0x5e, 0x82, 0x5b, 0x7f, 0x57, 0x7b,
-  0x5a, 0x77, 0x72, 0x7a, 0x80, 0x7d, 0x88, 0x77, 0x8d, 0x75, 0x8e, 0x77,
-  0x91, 0x77, 0x92, 0x76, 0x91, 0x77, 0x90, 0x78, 0x8c, 0x7b, 0x72, 0x84,
-  0x61, 0x86, 0x69, 0x85, 0x6c, 0x80, 0x6c, 0x76, 0x6b, 0x77, 0x73, 0x77,
-  0x74, 0x78, 0x6f, 0x78, 0x6e, 0x79, 0x71, 0x79, 0x74, 0x79, 0x76, 0x79,
-  0x76, 0x7a, 0x72, 0x7a, 0x6b, 0x7a, 0x65, 0x78, 0x63, 0x77, 0x62, 0x76,
-  0x62, 0x73, 0x62, 0x6c, 0x63, 0x68, 0x62, 0x68, 0x63, 0x6a, 0x65, 0x6c,
-  0x63, 0x69, 0x64, 0x6a, 0x63, 0x6a, 0x61, 0x6b, 0x64, 0x6f, 0x65, 0x74,
-  0x64, 0x78, 0x64, 0x79, 0x61, 0x7e, 0x5f, 0x82, 0x5f, 0x85, 0x58, 0x87,
-  0x55, 0x86, 0x58, 0x80, 0x58, 0x7a, 0x58, 0x7b, 0x59, 0x7a, 0x59, 0x75,
-  0x6b, 0x79, 0x73, 0x81, 0x67, 0x80, 0x6e, 0x7b, 0x69, 0x7b, 0x6f, 0x7e,
-  0x6d, 0x7d, 0x6b, 0x7a, 0x6e, 0x76, 0x66, 0x75, 0x67, 0x76, 0x63, 0x73,
-  0x61, 0x6f, 0x5e, 0x6c, 0x5d, 0x6a, 0x5e, 0x6b, 0x60, 0x70, 0x62, 0x74,
-  0x68, 0x73, 0x6f, 0x6f, 0x74, 0x6e, 0x74, 0x6b, 0x72, 0x6c, 0x72, 0x6c,
-  0x70, 0x6c, 0x70, 0x6c, 0x72, 0x6d, 0x74, 0x6c, 0x74, 0x6c, 0x79, 0x6e,
-  0x7c, 0x70, 0x80, 0x70, 0x83, 0x70, 0x86, 0x6e, 0x89, 0x6f, 0x8a, 0x6e,
-  0x8a, 0x6e, 0x8a, 0x6c, 0x8a, 0x6c, 0x8a, 0x6e, 0x89, 0x6e, 0x89, 0x6e,
-  0x8a, 0x6e, 0x88, 0x6d, 0x83, 0x72, 0x80, 0x79, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x55, 0x66, 0x55, 0x63, 0x55, 0x64, 0x56, 0x65, 0x56, 0x63, 0x56, 0x5f,
-  0x57, 0x5c, 0x57, 0x5d, 0x57, 0x5f, 0x56, 0x61, 0x54, 0x64, 0x53, 0x65,
-  0x51, 0x66, 0x50, 0x66, 0x4e, 0x67, 0x4b, 0x68, 0x4b, 0x68, 0x4b, 0x6a,
-  0x4c, 0x6a, 0x4b, 0x6a, 0x49, 0x6a, 0x48, 0x69, 0x48, 0x68, 0x4c, 0x68,
-  0x53, 0x68, 0x5a, 0x66, 0x5c, 0x65, 0x5e, 0x66, 0x61, 0x66, 0x63, 0x66,
-  0x66, 0x65, 0x68, 0x65, 0x6a, 0x68, 0x6a, 0x68, 0x69, 0x6a, 0x69, 0x6a,
-  0x6b, 0x6b, 0x6d, 0x6d, 0x6e, 0x6f, 0x6b, 0x70, 0x6b, 0x6f, 0x6d, 0x6e,
-  0x6c, 0x6c, 0x69, 0x6b, 0x68, 0x6b, 0x61, 0x70, 0x5a, 0x79, 0x5b, 0x7e,
-  0x5b, 0x7f, 0x59, 0x7d, 0x56, 0x7a, 0x55, 0x77, 0x58, 0x75, 0x6e, 0x7a,
-  0x7e, 0x7e, 0x85, 0x7a, 0x8d, 0x77, 0x8e, 0x78, 0x90, 0x77, 0x92, 0x77,
-  0x90, 0x7a, 0x8a, 0x7d, 0x81, 0x80, 0x6f, 0x82, 0x65, 0x87, 0x6c, 0x85,
-  0x69, 0x7f, 0x66, 0x75, 0x6e, 0x77, 0x73, 0x77, 0x72, 0x78, 0x6f, 0x78,
-  0x6e, 0x7a, 0x6d, 0x7b, 0x70, 0x7b, 0x73, 0x7b, 0x76, 0x7a, 0x76, 0x7a,
-  0x72, 0x7a, 0x6b, 0x7a, 0x68, 0x7a, 0x64, 0x79, 0x63, 0x74, 0x62, 0x6f,
-  0x62, 0x6d, 0x62, 0x6d, 0x61, 0x6f, 0x63, 0x71, 0x63, 0x6d, 0x63, 0x6c,
-  0x63, 0x6c, 0x61, 0x6d, 0x66, 0x71, 0x66, 0x76, 0x66, 0x79, 0x66, 0x7b,
-  0x61, 0x7f, 0x5f, 0x82, 0x5e, 0x84, 0x59, 0x83, 0x57, 0x81, 0x5a, 0x7a,
-  0x5b, 0x75, 0x5b, 0x77, 0x5c, 0x79, 0x5a, 0x75, 0x62, 0x79, 0x77, 0x80,
-  0x6a, 0x7e, 0x6c, 0x79, 0x71, 0x79, 0x6d, 0x7a, 0x6d, 0x79, 0x6e, 0x77,
-  0x68, 0x75, 0x64, 0x75, 0x69, 0x76, 0x64, 0x73, 0x61, 0x71, 0x5e, 0x6e,
-  0x5e, 0x6c, 0x5d, 0x6d, 0x5e, 0x70, 0x60, 0x74, 0x65, 0x73, 0x6c, 0x6f,
-  0x72, 0x6e, 0x72, 0x6b, 0x70, 0x6b, 0x70, 0x6b, 0x6f, 0x6b, 0x6e, 0x6b,
-  0x70, 0x6b, 0x72, 0x6b, 0x73, 0x6a, 0x76, 0x6c, 0x7b, 0x6e, 0x7e, 0x6f,
-  0x81, 0x6f, 0x86, 0x6f, 0x89, 0x6f, 0x89, 0x6e, 0x89, 0x6e, 0x8a, 0x6c,
-  0x8a, 0x6c, 0x8a, 0x6e, 0x89, 0x6e, 0x89, 0x6e, 0x8a, 0x6e, 0x88, 0x6d,
-  0x83, 0x72, 0x80, 0x79, 0x7f, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x55, 0x67, 0x55, 0x65,
-  0x55, 0x65, 0x55, 0x66, 0x56, 0x64, 0x56, 0x5f, 0x57, 0x5e, 0x57, 0x60,
-  0x57, 0x60, 0x57, 0x60, 0x55, 0x62, 0x54, 0x64, 0x53, 0x65, 0x52, 0x65,
-  0x50, 0x65, 0x4d, 0x67, 0x4b, 0x68, 0x4b, 0x6a, 0x4b, 0x6a, 0x4b, 0x6a,
-  0x49, 0x6a, 0x49, 0x69, 0x49, 0x68, 0x4b, 0x67, 0x50, 0x67, 0x57, 0x66,
-  0x5b, 0x65, 0x5c, 0x65, 0x60, 0x65, 0x62, 0x65, 0x66, 0x66, 0x69, 0x66,
-  0x6a, 0x67, 0x69, 0x68, 0x68, 0x6b, 0x68, 0x6c, 0x6d, 0x6f, 0x6f, 0x71,
-  0x70, 0x72, 0x6d, 0x73, 0x6d, 0x73, 0x72, 0x72, 0x70, 0x71, 0x68, 0x6e,
-  0x64, 0x6b, 0x61, 0x71, 0x5c, 0x7a, 0x5a, 0x7d, 0x59, 0x7d, 0x58, 0x7d,
-  0x57, 0x7a, 0x58, 0x77, 0x5a, 0x78, 0x69, 0x79, 0x74, 0x7b, 0x7e, 0x7d,
-  0x85, 0x7d, 0x87, 0x7c, 0x89, 0x7c, 0x89, 0x7d, 0x82, 0x80, 0x78, 0x82,
-  0x74, 0x82, 0x6d, 0x7f, 0x66, 0x85, 0x71, 0x84, 0x6a, 0x81, 0x69, 0x78,
-  0x72, 0x78, 0x73, 0x78, 0x72, 0x78, 0x6f, 0x78, 0x6c, 0x7c, 0x68, 0x7d,
-  0x6a, 0x7d, 0x6f, 0x7c, 0x72, 0x7c, 0x73, 0x7b, 0x75, 0x78, 0x75, 0x77,
-  0x72, 0x79, 0x6a, 0x7a, 0x66, 0x77, 0x64, 0x73, 0x62, 0x72, 0x61, 0x71,
-  0x60, 0x70, 0x63, 0x71, 0x63, 0x70, 0x64, 0x71, 0x67, 0x73, 0x67, 0x73,
-  0x68, 0x74, 0x69, 0x78, 0x68, 0x7b, 0x68, 0x7d, 0x62, 0x7f, 0x60, 0x83,
-  0x5d, 0x84, 0x5b, 0x7e, 0x59, 0x7a, 0x5b, 0x75, 0x5a, 0x70, 0x5a, 0x72,
-  0x5d, 0x77, 0x5c, 0x75, 0x58, 0x78, 0x77, 0x7e, 0x71, 0x7d, 0x6b, 0x76,
-  0x74, 0x72, 0x73, 0x77, 0x73, 0x72, 0x6e, 0x70, 0x62, 0x75, 0x65, 0x76,
-  0x6a, 0x75, 0x64, 0x74, 0x60, 0x73, 0x5e, 0x70, 0x5e, 0x6e, 0x5d, 0x6e,
-  0x5c, 0x71, 0x5e, 0x74, 0x62, 0x73, 0x68, 0x6e, 0x6f, 0x6d, 0x71, 0x6b,
-  0x6e, 0x6a, 0x6f, 0x69, 0x6d, 0x69, 0x6d, 0x69, 0x6d, 0x69, 0x70, 0x69,
-  0x71, 0x69, 0x75, 0x6a, 0x79, 0x6c, 0x7c, 0x6d, 0x80, 0x6e, 0x85, 0x6f,
-  0x89, 0x6f, 0x8a, 0x6e, 0x8a, 0x6d, 0x8b, 0x6c, 0x8a, 0x6c, 0x8a, 0x6d,
-  0x89, 0x6d, 0x89, 0x6e, 0x89, 0x6e, 0x89, 0x6d, 0x83, 0x73, 0x80, 0x79,
-  0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7f, 0x7d, 0x7f, 0x7e, 0x54, 0x66, 0x55, 0x64, 0x55, 0x64, 0x55, 0x65,
-  0x56, 0x63, 0x57, 0x60, 0x57, 0x5e, 0x57, 0x5f, 0x57, 0x60, 0x57, 0x60,
-  0x56, 0x60, 0x55, 0x61, 0x54, 0x63, 0x53, 0x65, 0x50, 0x65, 0x4e, 0x67,
-  0x4c, 0x67, 0x4b, 0x69, 0x4b, 0x69, 0x4b, 0x69, 0x4b, 0x6a, 0x4a, 0x68,
-  0x4a, 0x68, 0x4c, 0x67, 0x4e, 0x66, 0x54, 0x65, 0x59, 0x65, 0x5b, 0x65,
-  0x5f, 0x65, 0x63, 0x65, 0x66, 0x66, 0x68, 0x66, 0x68, 0x67, 0x68, 0x6a,
-  0x67, 0x6d, 0x69, 0x6f, 0x6e, 0x71, 0x71, 0x73, 0x71, 0x73, 0x6f, 0x74,
-  0x6f, 0x74, 0x73, 0x74, 0x73, 0x73, 0x6c, 0x71, 0x65, 0x6e, 0x63, 0x70,
-  0x60, 0x78, 0x5b, 0x7b, 0x58, 0x7d, 0x57, 0x7c, 0x59, 0x79, 0x5a, 0x77,
-  0x5a, 0x78, 0x67, 0x78, 0x6e, 0x7b, 0x78, 0x7d, 0x7d, 0x80, 0x7e, 0x81,
-  0x7e, 0x80, 0x7b, 0x81, 0x79, 0x81, 0x70, 0x82, 0x6b, 0x82, 0x71, 0x80,
-  0x6a, 0x81, 0x77, 0x7d, 0x6b, 0x7e, 0x71, 0x7b, 0x76, 0x7a, 0x74, 0x7a,
-  0x74, 0x78, 0x6e, 0x78, 0x6a, 0x7d, 0x65, 0x7e, 0x65, 0x7d, 0x6a, 0x7c,
-  0x6e, 0x7c, 0x6f, 0x7c, 0x72, 0x79, 0x73, 0x77, 0x74, 0x78, 0x71, 0x79,
-  0x6c, 0x7a, 0x69, 0x77, 0x65, 0x75, 0x62, 0x74, 0x62, 0x72, 0x64, 0x70,
-  0x63, 0x72, 0x66, 0x74, 0x68, 0x75, 0x6c, 0x74, 0x6a, 0x77, 0x6b, 0x7a,
-  0x6a, 0x7c, 0x68, 0x7d, 0x62, 0x7e, 0x60, 0x85, 0x5e, 0x84, 0x5c, 0x7b,
-  0x5a, 0x77, 0x5b, 0x75, 0x59, 0x70, 0x59, 0x71, 0x5d, 0x74, 0x5d, 0x74,
-  0x55, 0x76, 0x6d, 0x7b, 0x77, 0x7e, 0x6e, 0x76, 0x71, 0x70, 0x74, 0x72,
-  0x72, 0x70, 0x67, 0x70, 0x5f, 0x74, 0x67, 0x76, 0x6b, 0x75, 0x64, 0x74,
-  0x5f, 0x73, 0x5d, 0x71, 0x5e, 0x6e, 0x5e, 0x6f, 0x5c, 0x72, 0x5d, 0x74,
-  0x62, 0x72, 0x66, 0x6d, 0x6c, 0x6c, 0x6d, 0x6a, 0x6d, 0x69, 0x6d, 0x69,
-  0x6b, 0x68, 0x6b, 0x68, 0x6b, 0x67, 0x6d, 0x67, 0x71, 0x69, 0x75, 0x6a,
-  0x77, 0x6a, 0x7c, 0x6b, 0x80, 0x6d, 0x83, 0x6e, 0x88, 0x6e, 0x8a, 0x6c,
-  0x8c, 0x6c, 0x8b, 0x6b, 0x8a, 0x6b, 0x8a, 0x6c, 0x8b, 0x6c, 0x8a, 0x6e,
-  0x89, 0x6e, 0x89, 0x6d, 0x84, 0x74, 0x80, 0x7a, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7d, 0x7f, 0x7e,
-  0x4f, 0x68, 0x54, 0x66, 0x55, 0x65, 0x55, 0x65, 0x56, 0x63, 0x57, 0x61,
-  0x58, 0x5d, 0x57, 0x5f, 0x57, 0x61, 0x57, 0x60, 0x57, 0x60, 0x56, 0x61,
-  0x54, 0x63, 0x53, 0x65, 0x51, 0x65, 0x50, 0x67, 0x4d, 0x68, 0x4c, 0x68,
-  0x4c, 0x68, 0x4c, 0x69, 0x4b, 0x6a, 0x4a, 0x68, 0x4a, 0x67, 0x4b, 0x66,
-  0x4c, 0x65, 0x51, 0x65, 0x55, 0x65, 0x58, 0x65, 0x5d, 0x65, 0x60, 0x65,
-  0x62, 0x64, 0x65, 0x65, 0x64, 0x68, 0x64, 0x6b, 0x66, 0x6f, 0x6b, 0x72,
-  0x71, 0x74, 0x72, 0x75, 0x73, 0x76, 0x71, 0x76, 0x6f, 0x76, 0x71, 0x76,
-  0x73, 0x76, 0x71, 0x73, 0x6c, 0x70, 0x69, 0x71, 0x67, 0x75, 0x63, 0x77,
-  0x5a, 0x79, 0x5a, 0x79, 0x5d, 0x77, 0x5e, 0x75, 0x5d, 0x76, 0x63, 0x74,
-  0x73, 0x78, 0x71, 0x7b, 0x75, 0x7e, 0x76, 0x7f, 0x75, 0x7f, 0x74, 0x80,
-  0x71, 0x81, 0x6b, 0x83, 0x6c, 0x81, 0x72, 0x80, 0x72, 0x7f, 0x7e, 0x77,
-  0x6e, 0x7b, 0x74, 0x79, 0x77, 0x7a, 0x74, 0x7a, 0x72, 0x78, 0x6f, 0x78,
-  0x6d, 0x7b, 0x69, 0x7c, 0x64, 0x7b, 0x65, 0x7b, 0x67, 0x7b, 0x69, 0x7b,
-  0x6c, 0x79, 0x70, 0x78, 0x72, 0x78, 0x76, 0x79, 0x74, 0x7a, 0x6f, 0x79,
-  0x6d, 0x78, 0x6c, 0x78, 0x67, 0x76, 0x67, 0x74, 0x68, 0x73, 0x6b, 0x76,
-  0x6b, 0x76, 0x71, 0x76, 0x6f, 0x79, 0x69, 0x7c, 0x66, 0x7f, 0x64, 0x7f,
-  0x61, 0x7f, 0x61, 0x85, 0x5f, 0x84, 0x5b, 0x7b, 0x5b, 0x76, 0x5b, 0x73,
-  0x59, 0x6f, 0x58, 0x70, 0x5a, 0x71, 0x5c, 0x72, 0x57, 0x74, 0x5a, 0x76,
-  0x6e, 0x7b, 0x76, 0x7b, 0x6f, 0x76, 0x6f, 0x71, 0x67, 0x70, 0x60, 0x70,
-  0x5e, 0x72, 0x68, 0x75, 0x6b, 0x75, 0x64, 0x74, 0x5f, 0x73, 0x5e, 0x72,
-  0x5e, 0x70, 0x5e, 0x71, 0x5a, 0x74, 0x59, 0x76, 0x60, 0x73, 0x65, 0x6f,
-  0x69, 0x6c, 0x6a, 0x69, 0x6b, 0x67, 0x6b, 0x67, 0x6a, 0x68, 0x69, 0x68,
-  0x69, 0x67, 0x6b, 0x67, 0x6f, 0x68, 0x73, 0x68, 0x75, 0x68, 0x7a, 0x6b,
-  0x7e, 0x6d, 0x81, 0x6d, 0x87, 0x6c, 0x8a, 0x6c, 0x8c, 0x6c, 0x8a, 0x6b,
-  0x8a, 0x6b, 0x8b, 0x6c, 0x8b, 0x6c, 0x8a, 0x6e, 0x89, 0x6e, 0x89, 0x6e,
-  0x85, 0x74, 0x81, 0x7a, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x4b, 0x6a, 0x52, 0x68,
-  0x55, 0x65, 0x55, 0x65, 0x56, 0x64, 0x56, 0x60, 0x58, 0x5d, 0x58, 0x5f,
-  0x57, 0x60, 0x56, 0x60, 0x57, 0x61, 0x56, 0x61, 0x55, 0x64, 0x53, 0x65,
-  0x52, 0x65, 0x51, 0x67, 0x4e, 0x67, 0x4c, 0x68, 0x4c, 0x68, 0x4b, 0x69,
-  0x4b, 0x6a, 0x4a, 0x68, 0x4a, 0x67, 0x4b, 0x66, 0x4b, 0x65, 0x4f, 0x66,
-  0x52, 0x65, 0x55, 0x64, 0x5b, 0x65, 0x5e, 0x65, 0x5f, 0x63, 0x61, 0x63,
-  0x61, 0x69, 0x61, 0x6d, 0x64, 0x70, 0x6c, 0x73, 0x72, 0x74, 0x74, 0x76,
-  0x75, 0x78, 0x73, 0x77, 0x6f, 0x77, 0x6e, 0x77, 0x71, 0x77, 0x70, 0x75,
-  0x6e, 0x73, 0x6e, 0x71, 0x6d, 0x71, 0x69, 0x73, 0x5e, 0x76, 0x5d, 0x77,
-  0x5f, 0x75, 0x61, 0x74, 0x61, 0x74, 0x60, 0x71, 0x72, 0x75, 0x73, 0x78,
-  0x75, 0x78, 0x78, 0x78, 0x70, 0x7e, 0x70, 0x82, 0x71, 0x82, 0x6d, 0x81,
-  0x71, 0x7f, 0x6d, 0x7e, 0x73, 0x81, 0x7c, 0x7b, 0x6a, 0x7a, 0x75, 0x77,
-  0x77, 0x79, 0x74, 0x7a, 0x70, 0x79, 0x71, 0x78, 0x71, 0x7a, 0x6c, 0x7a,
-  0x67, 0x79, 0x66, 0x79, 0x66, 0x7b, 0x68, 0x7b, 0x6c, 0x79, 0x6f, 0x78,
-  0x70, 0x78, 0x75, 0x79, 0x74, 0x7a, 0x71, 0x7b, 0x74, 0x7c, 0x75, 0x7b,
-  0x70, 0x79, 0x6d, 0x77, 0x6d, 0x75, 0x6f, 0x77, 0x6f, 0x77, 0x74, 0x77,
-  0x72, 0x7b, 0x67, 0x7d, 0x62, 0x80, 0x61, 0x80, 0x60, 0x80, 0x60, 0x85,
-  0x5e, 0x84, 0x5b, 0x7b, 0x5a, 0x75, 0x5a, 0x71, 0x5a, 0x6d, 0x58, 0x6e,
-  0x57, 0x70, 0x5b, 0x70, 0x59, 0x72, 0x52, 0x73, 0x5a, 0x77, 0x6d, 0x7a,
-  0x69, 0x76, 0x66, 0x71, 0x63, 0x70, 0x60, 0x6f, 0x5c, 0x70, 0x64, 0x74,
-  0x67, 0x75, 0x62, 0x74, 0x5f, 0x73, 0x5d, 0x72, 0x5e, 0x72, 0x5e, 0x72,
-  0x59, 0x75, 0x56, 0x77, 0x5e, 0x75, 0x62, 0x70, 0x66, 0x6c, 0x67, 0x69,
-  0x69, 0x66, 0x69, 0x66, 0x68, 0x67, 0x68, 0x68, 0x67, 0x68, 0x6a, 0x68,
-  0x6d, 0x68, 0x72, 0x67, 0x73, 0x68, 0x78, 0x6b, 0x7d, 0x6c, 0x80, 0x6b,
-  0x86, 0x6b, 0x8a, 0x6c, 0x8c, 0x6d, 0x8a, 0x6a, 0x8a, 0x6b, 0x8a, 0x6c,
-  0x8b, 0x6c, 0x8a, 0x6e, 0x8a, 0x6e, 0x89, 0x6e, 0x84, 0x74, 0x80, 0x7a,
-  0x7f, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e,
-  0x7f, 0x7e, 0x7f, 0x7e, 0x4e, 0x6b, 0x4d, 0x6b, 0x52, 0x68, 0x54, 0x65,
-  0x55, 0x64, 0x56, 0x62, 0x57, 0x60, 0x57, 0x62, 0x56, 0x63, 0x56, 0x62,
-  0x56, 0x61, 0x56, 0x61, 0x56, 0x63, 0x54, 0x65, 0x52, 0x66, 0x51, 0x67,
-  0x4e, 0x67, 0x4d, 0x67, 0x4b, 0x69, 0x4c, 0x6b, 0x4c, 0x69, 0x4b, 0x68,
-  0x4a, 0x69, 0x4c, 0x67, 0x4c, 0x65, 0x50, 0x65, 0x52, 0x66, 0x53, 0x65,
-  0x57, 0x65, 0x5b, 0x65, 0x5f, 0x63, 0x61, 0x65, 0x60, 0x6c, 0x63, 0x70,
-  0x66, 0x72, 0x6c, 0x73, 0x72, 0x73, 0x75, 0x75, 0x77, 0x77, 0x77, 0x77,
-  0x73, 0x76, 0x6d, 0x76, 0x6b, 0x76, 0x6e, 0x76, 0x6c, 0x74, 0x6e, 0x72,
-  0x70, 0x72, 0x6f, 0x73, 0x64, 0x76, 0x5f, 0x76, 0x62, 0x75, 0x63, 0x73,
-  0x63, 0x73, 0x62, 0x72, 0x6a, 0x72, 0x73, 0x76, 0x78, 0x76, 0x7b, 0x77,
-  0x73, 0x7e, 0x6f, 0x83, 0x71, 0x81, 0x70, 0x80, 0x70, 0x7e, 0x6b, 0x80,
-  0x76, 0x81, 0x72, 0x7e, 0x69, 0x7a, 0x75, 0x79, 0x77, 0x79, 0x76, 0x78,
-  0x72, 0x77, 0x70, 0x77, 0x70, 0x78, 0x6d, 0x78, 0x68, 0x77, 0x67, 0x76,
-  0x69, 0x7b, 0x6a, 0x7c, 0x6c, 0x7c, 0x6d, 0x7b, 0x6d, 0x7b, 0x71, 0x7a,
-  0x71, 0x7a, 0x6e, 0x7c, 0x71, 0x7e, 0x75, 0x7e, 0x74, 0x7d, 0x70, 0x7a,
-  0x70, 0x79, 0x71, 0x79, 0x70, 0x78, 0x70, 0x79, 0x6e, 0x7b, 0x64, 0x7f,
-  0x61, 0x80, 0x60, 0x80, 0x5e, 0x81, 0x5e, 0x83, 0x5e, 0x81, 0x5d, 0x7c,
-  0x5c, 0x78, 0x5a, 0x73, 0x5c, 0x6d, 0x59, 0x6d, 0x56, 0x70, 0x5a, 0x6e,
-  0x58, 0x70, 0x54, 0x72, 0x54, 0x77, 0x60, 0x7b, 0x65, 0x76, 0x63, 0x70,
-  0x66, 0x70, 0x61, 0x6f, 0x5a, 0x70, 0x62, 0x74, 0x63, 0x76, 0x60, 0x75,
-  0x5e, 0x73, 0x5c, 0x71, 0x5d, 0x72, 0x5d, 0x72, 0x59, 0x75, 0x57, 0x77,
-  0x5c, 0x75, 0x62, 0x74, 0x64, 0x70, 0x65, 0x6a, 0x66, 0x67, 0x66, 0x65,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x65, 0x69, 0x66, 0x6c, 0x67, 0x71, 0x67,
-  0x74, 0x68, 0x77, 0x69, 0x7a, 0x6a, 0x7f, 0x6a, 0x84, 0x6b, 0x88, 0x6d,
-  0x8a, 0x6d, 0x8a, 0x6c, 0x8a, 0x6c, 0x8a, 0x6e, 0x8b, 0x6f, 0x8a, 0x70,
-  0x8a, 0x6e, 0x88, 0x6e, 0x83, 0x76, 0x80, 0x7a, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7d, 0x7f, 0x7d,
-  0x55, 0x6b, 0x4a, 0x6b, 0x4e, 0x69, 0x54, 0x66, 0x55, 0x65, 0x56, 0x62,
-  0x56, 0x61, 0x56, 0x63, 0x56, 0x65, 0x56, 0x63, 0x56, 0x62, 0x56, 0x62,
-  0x56, 0x61, 0x54, 0x63, 0x52, 0x65, 0x51, 0x66, 0x4f, 0x65, 0x4f, 0x66,
-  0x4c, 0x69, 0x4b, 0x6b, 0x4c, 0x69, 0x4b, 0x68, 0x4b, 0x69, 0x4c, 0x67,
-  0x4d, 0x65, 0x4e, 0x65, 0x4e, 0x64, 0x4f, 0x64, 0x54, 0x63, 0x58, 0x64,
-  0x5d, 0x65, 0x5f, 0x6a, 0x60, 0x6f, 0x64, 0x72, 0x67, 0x73, 0x6c, 0x73,
-  0x72, 0x73, 0x76, 0x75, 0x79, 0x77, 0x7a, 0x77, 0x77, 0x76, 0x6f, 0x75,
-  0x6a, 0x76, 0x6c, 0x75, 0x6c, 0x75, 0x6c, 0x74, 0x6f, 0x73, 0x73, 0x73,
-  0x6a, 0x76, 0x62, 0x77, 0x63, 0x74, 0x63, 0x73, 0x63, 0x73, 0x67, 0x73,
-  0x65, 0x71, 0x6a, 0x76, 0x74, 0x77, 0x79, 0x78, 0x75, 0x7d, 0x71, 0x80,
-  0x71, 0x7f, 0x6e, 0x7f, 0x6c, 0x7d, 0x6d, 0x7f, 0x75, 0x82, 0x67, 0x7f,
-  0x6c, 0x7a, 0x75, 0x7a, 0x77, 0x79, 0x77, 0x77, 0x73, 0x76, 0x70, 0x76,
-  0x6f, 0x76, 0x6d, 0x76, 0x69, 0x75, 0x68, 0x74, 0x6a, 0x79, 0x6b, 0x7a,
-  0x6b, 0x7a, 0x6c, 0x7b, 0x6d, 0x7c, 0x6e, 0x7e, 0x6d, 0x7f, 0x6a, 0x7f,
-  0x6a, 0x80, 0x6d, 0x80, 0x6e, 0x7f, 0x6e, 0x7d, 0x6f, 0x7c, 0x6f, 0x7c,
-  0x6e, 0x7b, 0x6b, 0x7c, 0x67, 0x7e, 0x61, 0x81, 0x60, 0x81, 0x60, 0x81,
-  0x5f, 0x82, 0x5f, 0x82, 0x5f, 0x81, 0x5e, 0x7e, 0x5d, 0x7a, 0x5b, 0x73,
-  0x5d, 0x6c, 0x5a, 0x6c, 0x54, 0x6f, 0x56, 0x6c, 0x56, 0x6e, 0x55, 0x70,
-  0x54, 0x72, 0x5d, 0x79, 0x65, 0x76, 0x65, 0x71, 0x68, 0x70, 0x61, 0x71,
-  0x57, 0x71, 0x5e, 0x74, 0x5e, 0x75, 0x5e, 0x76, 0x5c, 0x74, 0x5a, 0x72,
-  0x5b, 0x73, 0x5c, 0x73, 0x59, 0x75, 0x57, 0x77, 0x5a, 0x77, 0x61, 0x76,
-  0x64, 0x73, 0x63, 0x6c, 0x63, 0x68, 0x63, 0x65, 0x65, 0x65, 0x64, 0x66,
-  0x65, 0x65, 0x67, 0x65, 0x6a, 0x66, 0x6f, 0x68, 0x73, 0x68, 0x76, 0x69,
-  0x78, 0x68, 0x7d, 0x6a, 0x83, 0x6b, 0x86, 0x6d, 0x88, 0x6d, 0x89, 0x6d,
-  0x8a, 0x6d, 0x89, 0x6d, 0x89, 0x6f, 0x88, 0x6e, 0x88, 0x6c, 0x88, 0x6b,
-  0x84, 0x74, 0x81, 0x7c, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7d, 0x7f, 0x7e, 0x57, 0x6b, 0x4e, 0x6b,
-  0x4c, 0x69, 0x53, 0x66, 0x55, 0x65, 0x56, 0x62, 0x56, 0x60, 0x56, 0x63,
-  0x56, 0x65, 0x56, 0x64, 0x56, 0x61, 0x56, 0x62, 0x56, 0x61, 0x54, 0x61,
-  0x53, 0x63, 0x51, 0x64, 0x50, 0x64, 0x4f, 0x64, 0x4c, 0x67, 0x4b, 0x6a,
-  0x4b, 0x69, 0x4b, 0x68, 0x4b, 0x69, 0x4c, 0x67, 0x4d, 0x65, 0x4f, 0x64,
-  0x4f, 0x63, 0x4f, 0x63, 0x53, 0x62, 0x57, 0x62, 0x5c, 0x65, 0x5e, 0x6d,
-  0x60, 0x70, 0x63, 0x73, 0x67, 0x73, 0x6b, 0x73, 0x71, 0x73, 0x75, 0x75,
-  0x7a, 0x77, 0x7b, 0x78, 0x79, 0x76, 0x72, 0x75, 0x6c, 0x75, 0x69, 0x75,
-  0x6c, 0x75, 0x6b, 0x75, 0x6f, 0x74, 0x74, 0x73, 0x6e, 0x76, 0x65, 0x77,
-  0x63, 0x74, 0x63, 0x73, 0x63, 0x73, 0x69, 0x72, 0x66, 0x71, 0x63, 0x76,
-  0x6f, 0x77, 0x75, 0x78, 0x74, 0x7c, 0x70, 0x7e, 0x6f, 0x7e, 0x71, 0x7e,
-  0x6d, 0x7b, 0x71, 0x7e, 0x6f, 0x84, 0x61, 0x7f, 0x6e, 0x7a, 0x75, 0x7a,
-  0x77, 0x79, 0x77, 0x77, 0x73, 0x75, 0x70, 0x74, 0x6f, 0x75, 0x6d, 0x74,
-  0x6a, 0x74, 0x69, 0x73, 0x6a, 0x78, 0x6b, 0x77, 0x6b, 0x77, 0x6d, 0x7a,
-  0x6f, 0x7d, 0x71, 0x7f, 0x6e, 0x7f, 0x6b, 0x80, 0x6a, 0x81, 0x6a, 0x81,
-  0x6e, 0x80, 0x70, 0x7e, 0x6e, 0x7e, 0x6d, 0x7d, 0x6b, 0x7e, 0x68, 0x7f,
-  0x63, 0x81, 0x5f, 0x81, 0x61, 0x82, 0x60, 0x82, 0x60, 0x82, 0x60, 0x82,
-  0x60, 0x82, 0x5e, 0x7f, 0x5e, 0x7b, 0x5d, 0x74, 0x5d, 0x6b, 0x59, 0x6a,
-  0x55, 0x6d, 0x58, 0x6b, 0x57, 0x6d, 0x55, 0x6e, 0x53, 0x6e, 0x5b, 0x76,
-  0x63, 0x76, 0x67, 0x71, 0x6a, 0x70, 0x63, 0x72, 0x55, 0x73, 0x5a, 0x74,
-  0x5b, 0x75, 0x5b, 0x77, 0x5b, 0x76, 0x58, 0x74, 0x59, 0x74, 0x5b, 0x74,
-  0x59, 0x75, 0x57, 0x77, 0x5b, 0x78, 0x62, 0x78, 0x63, 0x74, 0x62, 0x6d,
-  0x62, 0x68, 0x62, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x66, 0x66,
-  0x69, 0x67, 0x6d, 0x67, 0x71, 0x68, 0x73, 0x68, 0x77, 0x68, 0x7b, 0x6a,
-  0x82, 0x6b, 0x85, 0x6d, 0x87, 0x6c, 0x89, 0x6c, 0x8a, 0x6c, 0x88, 0x6b,
-  0x88, 0x6d, 0x88, 0x6d, 0x87, 0x6b, 0x86, 0x6a, 0x82, 0x70, 0x7f, 0x77,
-  0x7e, 0x7e, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7f, 0x7e, 0x59, 0x6c, 0x56, 0x6b, 0x50, 0x6a, 0x50, 0x68,
-  0x53, 0x66, 0x56, 0x63, 0x56, 0x62, 0x56, 0x63, 0x55, 0x64, 0x56, 0x64,
-  0x57, 0x62, 0x56, 0x62, 0x56, 0x62, 0x55, 0x61, 0x54, 0x62, 0x53, 0x63,
-  0x51, 0x65, 0x50, 0x66, 0x4d, 0x68, 0x4c, 0x69, 0x4b, 0x68, 0x4b, 0x68,
-  0x4b, 0x68, 0x4c, 0x67, 0x4d, 0x66, 0x4f, 0x63, 0x51, 0x62, 0x51, 0x61,
-  0x54, 0x62, 0x57, 0x63, 0x5c, 0x67, 0x5e, 0x6f, 0x61, 0x72, 0x64, 0x73,
-  0x67, 0x73, 0x6c, 0x73, 0x72, 0x74, 0x75, 0x75, 0x7a, 0x78, 0x7c, 0x78,
-  0x7b, 0x77, 0x76, 0x77, 0x70, 0x77, 0x67, 0x75, 0x68, 0x74, 0x6a, 0x75,
-  0x70, 0x75, 0x77, 0x75, 0x73, 0x77, 0x6a, 0x77, 0x65, 0x75, 0x64, 0x72,
-  0x64, 0x72, 0x69, 0x73, 0x68, 0x72, 0x61, 0x74, 0x65, 0x77, 0x6b, 0x78,
-  0x72, 0x79, 0x73, 0x79, 0x6f, 0x77, 0x71, 0x79, 0x71, 0x7c, 0x74, 0x80,
-  0x66, 0x82, 0x64, 0x7d, 0x72, 0x7a, 0x77, 0x7a, 0x77, 0x78, 0x75, 0x75,
-  0x72, 0x74, 0x70, 0x73, 0x6f, 0x73, 0x6f, 0x73, 0x6d, 0x73, 0x6d, 0x73,
-  0x6d, 0x74, 0x6e, 0x73, 0x6c, 0x76, 0x6d, 0x79, 0x6f, 0x7c, 0x72, 0x7e,
-  0x71, 0x7d, 0x6f, 0x7e, 0x6d, 0x81, 0x6c, 0x82, 0x6f, 0x81, 0x73, 0x7e,
-  0x70, 0x7d, 0x6c, 0x7e, 0x6b, 0x7f, 0x66, 0x81, 0x62, 0x83, 0x5e, 0x82,
-  0x5e, 0x83, 0x5f, 0x84, 0x61, 0x84, 0x63, 0x84, 0x60, 0x84, 0x5d, 0x82,
-  0x5f, 0x7d, 0x5f, 0x73, 0x5f, 0x6c, 0x5c, 0x6b, 0x5b, 0x6a, 0x5b, 0x6a,
-  0x5b, 0x6b, 0x57, 0x6d, 0x58, 0x6e, 0x5d, 0x73, 0x5f, 0x75, 0x64, 0x72,
-  0x6b, 0x6f, 0x64, 0x6f, 0x56, 0x73, 0x57, 0x74, 0x59, 0x75, 0x59, 0x77,
-  0x5a, 0x78, 0x5a, 0x78, 0x58, 0x76, 0x59, 0x77, 0x58, 0x77, 0x58, 0x77,
-  0x5b, 0x78, 0x62, 0x78, 0x62, 0x76, 0x60, 0x70, 0x60, 0x6b, 0x60, 0x67,
-  0x61, 0x66, 0x62, 0x66, 0x63, 0x66, 0x64, 0x66, 0x68, 0x67, 0x6d, 0x67,
-  0x70, 0x67, 0x73, 0x68, 0x76, 0x68, 0x7a, 0x6a, 0x7f, 0x6a, 0x82, 0x6b,
-  0x85, 0x6c, 0x87, 0x6d, 0x88, 0x6c, 0x86, 0x6c, 0x85, 0x6c, 0x84, 0x6d,
-  0x82, 0x6c, 0x80, 0x6c, 0x7a, 0x6f, 0x77, 0x71, 0x77, 0x74, 0x78, 0x77,
-  0x7c, 0x7b, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x7e,
-  0x5c, 0x6d, 0x5a, 0x6b, 0x54, 0x6b, 0x4e, 0x69, 0x51, 0x66, 0x55, 0x63,
-  0x56, 0x63, 0x55, 0x63, 0x55, 0x63, 0x56, 0x63, 0x56, 0x63, 0x56, 0x62,
-  0x56, 0x62, 0x55, 0x62, 0x56, 0x62, 0x53, 0x64, 0x51, 0x66, 0x50, 0x68,
-  0x4d, 0x67, 0x4c, 0x68, 0x4b, 0x68, 0x4b, 0x68, 0x4b, 0x68, 0x4c, 0x67,
-  0x4d, 0x66, 0x4f, 0x63, 0x51, 0x62, 0x51, 0x62, 0x54, 0x63, 0x58, 0x64,
-  0x5e, 0x69, 0x60, 0x70, 0x62, 0x72, 0x65, 0x72, 0x69, 0x73, 0x6e, 0x73,
-  0x72, 0x75, 0x76, 0x76, 0x79, 0x78, 0x7c, 0x78, 0x7c, 0x77, 0x78, 0x78,
-  0x73, 0x78, 0x68, 0x76, 0x67, 0x74, 0x69, 0x74, 0x6f, 0x75, 0x77, 0x76,
-  0x77, 0x78, 0x6e, 0x77, 0x66, 0x74, 0x65, 0x72, 0x65, 0x72, 0x6a, 0x73,
-  0x69, 0x72, 0x62, 0x73, 0x5f, 0x7b, 0x64, 0x7d, 0x6c, 0x78, 0x72, 0x75,
-  0x72, 0x74, 0x74, 0x76, 0x74, 0x7d, 0x6a, 0x83, 0x62, 0x81, 0x6c, 0x7e,
-  0x76, 0x7a, 0x76, 0x7a, 0x76, 0x78, 0x73, 0x75, 0x71, 0x74, 0x70, 0x73,
-  0x70, 0x72, 0x70, 0x72, 0x6f, 0x72, 0x6f, 0x72, 0x70, 0x72, 0x70, 0x71,
-  0x69, 0x78, 0x66, 0x7c, 0x69, 0x7d, 0x70, 0x7e, 0x72, 0x7d, 0x72, 0x7d,
-  0x71, 0x7f, 0x6f, 0x81, 0x6f, 0x80, 0x73, 0x7e, 0x71, 0x7d, 0x6c, 0x7d,
-  0x6a, 0x7f, 0x65, 0x81, 0x63, 0x82, 0x5e, 0x82, 0x5b, 0x83, 0x5d, 0x84,
-  0x61, 0x85, 0x65, 0x85, 0x62, 0x83, 0x5f, 0x7f, 0x5f, 0x7c, 0x60, 0x72,
-  0x5f, 0x6e, 0x5f, 0x6b, 0x5f, 0x69, 0x5e, 0x6a, 0x5f, 0x6a, 0x5d, 0x6d,
-  0x5e, 0x70, 0x5e, 0x70, 0x5d, 0x72, 0x5f, 0x73, 0x6a, 0x71, 0x66, 0x70,
-  0x56, 0x74, 0x56, 0x74, 0x5a, 0x75, 0x5a, 0x76, 0x5c, 0x78, 0x5e, 0x78,
-  0x5c, 0x76, 0x5a, 0x77, 0x58, 0x78, 0x58, 0x78, 0x5b, 0x78, 0x62, 0x77,
-  0x63, 0x78, 0x60, 0x72, 0x5f, 0x6c, 0x5f, 0x67, 0x5f, 0x65, 0x62, 0x66,
-  0x63, 0x66, 0x64, 0x65, 0x68, 0x67, 0x6b, 0x68, 0x6e, 0x68, 0x72, 0x68,
-  0x74, 0x69, 0x78, 0x6a, 0x7b, 0x6a, 0x7e, 0x6a, 0x81, 0x6b, 0x83, 0x6d,
-  0x82, 0x6d, 0x82, 0x6d, 0x80, 0x6d, 0x7c, 0x6c, 0x7a, 0x6d, 0x78, 0x6d,
-  0x74, 0x6e, 0x6f, 0x6f, 0x6e, 0x6f, 0x6f, 0x6f, 0x71, 0x72, 0x78, 0x76,
-  0x7b, 0x7a, 0x7d, 0x7c, 0x7e, 0x7e, 0x7f, 0x7f, 0x5d, 0x6e, 0x5b, 0x6b,
-  0x57, 0x6a, 0x4e, 0x68, 0x51, 0x66, 0x55, 0x63, 0x56, 0x62, 0x55, 0x63,
-  0x55, 0x63, 0x56, 0x63, 0x55, 0x63, 0x55, 0x61, 0x55, 0x62, 0x55, 0x62,
-  0x56, 0x62, 0x53, 0x64, 0x51, 0x66, 0x4f, 0x67, 0x4e, 0x67, 0x4c, 0x68,
-  0x4b, 0x68, 0x4b, 0x68, 0x4b, 0x69, 0x4c, 0x68, 0x4d, 0x66, 0x4f, 0x64,
-  0x50, 0x64, 0x52, 0x63, 0x54, 0x62, 0x58, 0x64, 0x5f, 0x6b, 0x62, 0x72,
-  0x64, 0x72, 0x67, 0x72, 0x6a, 0x72, 0x6f, 0x72, 0x72, 0x76, 0x75, 0x76,
-  0x79, 0x77, 0x7b, 0x78, 0x7c, 0x77, 0x77, 0x77, 0x73, 0x77, 0x69, 0x76,
-  0x68, 0x74, 0x68, 0x74, 0x6d, 0x75, 0x75, 0x76, 0x79, 0x78, 0x71, 0x77,
-  0x66, 0x74, 0x65, 0x72, 0x64, 0x72, 0x6a, 0x73, 0x69, 0x72, 0x62, 0x73,
-  0x5d, 0x7a, 0x5f, 0x7d, 0x66, 0x7c, 0x6d, 0x7a, 0x73, 0x78, 0x6f, 0x7b,
-  0x68, 0x80, 0x5f, 0x80, 0x61, 0x7f, 0x6f, 0x7e, 0x77, 0x7a, 0x74, 0x7a,
-  0x74, 0x78, 0x72, 0x75, 0x70, 0x74, 0x70, 0x72, 0x70, 0x71, 0x70, 0x70,
-  0x70, 0x70, 0x6f, 0x71, 0x71, 0x70, 0x70, 0x72, 0x65, 0x7b, 0x63, 0x7f,
-  0x67, 0x7f, 0x70, 0x7e, 0x74, 0x7e, 0x75, 0x7d, 0x74, 0x7e, 0x72, 0x80,
-  0x71, 0x80, 0x72, 0x7e, 0x71, 0x7d, 0x6b, 0x7d, 0x69, 0x7e, 0x63, 0x81,
-  0x61, 0x82, 0x5c, 0x82, 0x5a, 0x83, 0x5b, 0x84, 0x5f, 0x84, 0x62, 0x85,
-  0x61, 0x81, 0x60, 0x7c, 0x60, 0x79, 0x60, 0x72, 0x60, 0x6f, 0x60, 0x6b,
-  0x60, 0x69, 0x61, 0x6a, 0x61, 0x6a, 0x5e, 0x6e, 0x5e, 0x73, 0x5e, 0x71,
-  0x5e, 0x73, 0x5f, 0x76, 0x64, 0x74, 0x64, 0x72, 0x56, 0x75, 0x58, 0x75,
-  0x5c, 0x76, 0x5d, 0x75, 0x5f, 0x77, 0x62, 0x77, 0x60, 0x74, 0x5b, 0x75,
-  0x58, 0x78, 0x58, 0x78, 0x5b, 0x78, 0x62, 0x78, 0x64, 0x79, 0x61, 0x73,
-  0x5f, 0x6c, 0x5f, 0x66, 0x60, 0x65, 0x62, 0x66, 0x63, 0x65, 0x65, 0x65,
-  0x67, 0x67, 0x6a, 0x68, 0x6c, 0x68, 0x70, 0x69, 0x73, 0x68, 0x75, 0x6a,
-  0x78, 0x6a, 0x7b, 0x6a, 0x7e, 0x6b, 0x7e, 0x6c, 0x7e, 0x6d, 0x7d, 0x6d,
-  0x7b, 0x6d, 0x77, 0x6c, 0x74, 0x6d, 0x73, 0x6c, 0x6e, 0x6d, 0x69, 0x6e,
-  0x67, 0x6e, 0x68, 0x6e, 0x69, 0x70, 0x6e, 0x71, 0x72, 0x74, 0x77, 0x77,
-  0x7c, 0x7a, 0x7f, 0x7e, 0x60, 0x6e, 0x5c, 0x6b, 0x58, 0x6a, 0x4f, 0x69,
-  0x50, 0x67, 0x55, 0x64, 0x56, 0x63, 0x56, 0x62, 0x55, 0x62, 0x55, 0x63,
-  0x55, 0x63, 0x56, 0x62, 0x55, 0x62, 0x55, 0x62, 0x55, 0x63, 0x53, 0x62,
-  0x52, 0x64, 0x50, 0x66, 0x4f, 0x66, 0x4e, 0x68, 0x4c, 0x69, 0x4b, 0x68,
-  0x4c, 0x68, 0x4c, 0x67, 0x4e, 0x65, 0x50, 0x64, 0x50, 0x64, 0x52, 0x62,
-  0x55, 0x62, 0x59, 0x64, 0x60, 0x6d, 0x62, 0x73, 0x64, 0x74, 0x67, 0x74,
-  0x6b, 0x74, 0x70, 0x74, 0x73, 0x75, 0x76, 0x75, 0x79, 0x78, 0x7b, 0x78,
-  0x7b, 0x78, 0x79, 0x79, 0x74, 0x79, 0x6b, 0x77, 0x69, 0x75, 0x67, 0x74,
-  0x6a, 0x74, 0x73, 0x76, 0x7a, 0x78, 0x73, 0x77, 0x66, 0x75, 0x66, 0x71,
-  0x67, 0x71, 0x6a, 0x73, 0x6a, 0x73, 0x62, 0x72, 0x5f, 0x74, 0x5d, 0x77,
-  0x5e, 0x7f, 0x64, 0x81, 0x61, 0x7f, 0x60, 0x7f, 0x5f, 0x80, 0x5b, 0x7b,
-  0x63, 0x7a, 0x6a, 0x7a, 0x71, 0x78, 0x71, 0x78, 0x73, 0x77, 0x72, 0x76,
-  0x71, 0x72, 0x6f, 0x71, 0x70, 0x71, 0x71, 0x71, 0x71, 0x70, 0x6f, 0x70,
-  0x70, 0x6f, 0x6f, 0x73, 0x68, 0x7b, 0x68, 0x7d, 0x6c, 0x7d, 0x74, 0x7c,
-  0x77, 0x7d, 0x78, 0x7c, 0x77, 0x7c, 0x76, 0x7e, 0x74, 0x80, 0x72, 0x7f,
-  0x6f, 0x7d, 0x6a, 0x7f, 0x68, 0x81, 0x63, 0x82, 0x5f, 0x82, 0x5b, 0x82,
-  0x5a, 0x82, 0x5b, 0x83, 0x5c, 0x84, 0x5e, 0x81, 0x60, 0x7c, 0x63, 0x7a,
-  0x62, 0x75, 0x61, 0x72, 0x61, 0x6f, 0x62, 0x6c, 0x62, 0x69, 0x64, 0x69,
-  0x62, 0x6b, 0x5c, 0x71, 0x5d, 0x76, 0x5f, 0x76, 0x5f, 0x76, 0x5f, 0x78,
-  0x5f, 0x76, 0x61, 0x74, 0x59, 0x77, 0x59, 0x76, 0x5a, 0x75, 0x5d, 0x73,
-  0x61, 0x74, 0x65, 0x76, 0x62, 0x73, 0x5c, 0x74, 0x58, 0x77, 0x59, 0x78,
-  0x5d, 0x78, 0x63, 0x78, 0x64, 0x7a, 0x63, 0x76, 0x60, 0x6e, 0x5f, 0x69,
-  0x61, 0x66, 0x63, 0x66, 0x64, 0x66, 0x64, 0x66, 0x66, 0x66, 0x68, 0x67,
-  0x6b, 0x67, 0x6f, 0x68, 0x71, 0x68, 0x72, 0x6a, 0x75, 0x6a, 0x78, 0x6a,
-  0x79, 0x6b, 0x7a, 0x6b, 0x7a, 0x6b, 0x78, 0x6c, 0x76, 0x6c, 0x72, 0x6c,
-  0x70, 0x6c, 0x6d, 0x6b, 0x68, 0x6b, 0x64, 0x6c, 0x60, 0x6b, 0x60, 0x6c,
-  0x62, 0x6e, 0x64, 0x6e, 0x67, 0x6c, 0x6e, 0x6e, 0x75, 0x70, 0x7a, 0x78,
-  0x60, 0x6e, 0x5b, 0x6b, 0x58, 0x6a, 0x50, 0x6a, 0x51, 0x68, 0x55, 0x65,
-  0x56, 0x63, 0x55, 0x63, 0x55, 0x63, 0x55, 0x63, 0x55, 0x64, 0x56, 0x64,
-  0x55, 0x62, 0x55, 0x63, 0x54, 0x63, 0x53, 0x60, 0x53, 0x62, 0x51, 0x65,
-  0x50, 0x65, 0x4f, 0x67, 0x4c, 0x68, 0x4c, 0x67, 0x4c, 0x67, 0x4d, 0x67,
-  0x4f, 0x65, 0x50, 0x64, 0x50, 0x63, 0x53, 0x62, 0x56, 0x63, 0x5a, 0x65,
-  0x5f, 0x6e, 0x62, 0x74, 0x64, 0x74, 0x67, 0x75, 0x6a, 0x75, 0x70, 0x75,
-  0x74, 0x74, 0x76, 0x76, 0x7a, 0x78, 0x7b, 0x78, 0x7b, 0x7a, 0x7a, 0x7a,
-  0x75, 0x7a, 0x6c, 0x78, 0x68, 0x77, 0x67, 0x75, 0x69, 0x73, 0x71, 0x76,
-  0x78, 0x78, 0x71, 0x77, 0x67, 0x74, 0x68, 0x70, 0x68, 0x70, 0x6b, 0x72,
-  0x6a, 0x73, 0x62, 0x72, 0x61, 0x73, 0x5e, 0x76, 0x5d, 0x7c, 0x64, 0x80,
-  0x5e, 0x7f, 0x5f, 0x7d, 0x5f, 0x7c, 0x5d, 0x7a, 0x64, 0x79, 0x67, 0x79,
-  0x6b, 0x77, 0x6d, 0x77, 0x72, 0x75, 0x73, 0x74, 0x71, 0x71, 0x6e, 0x70,
-  0x6d, 0x71, 0x6f, 0x72, 0x71, 0x71, 0x6f, 0x70, 0x6e, 0x70, 0x6e, 0x74,
-  0x6d, 0x79, 0x70, 0x7a, 0x74, 0x7a, 0x78, 0x7b, 0x78, 0x7c, 0x78, 0x7c,
-  0x78, 0x7c, 0x78, 0x7d, 0x75, 0x7f, 0x72, 0x7f, 0x6e, 0x7e, 0x69, 0x82,
-  0x67, 0x83, 0x63, 0x83, 0x5e, 0x82, 0x5c, 0x82, 0x5a, 0x81, 0x5c, 0x83,
-  0x5c, 0x83, 0x5e, 0x7d, 0x61, 0x7a, 0x64, 0x7a, 0x62, 0x75, 0x60, 0x71,
-  0x63, 0x70, 0x65, 0x6e, 0x64, 0x6a, 0x65, 0x69, 0x62, 0x6c, 0x5c, 0x73,
-  0x5d, 0x77, 0x5f, 0x76, 0x5f, 0x76, 0x60, 0x7a, 0x5f, 0x77, 0x60, 0x75,
-  0x5b, 0x78, 0x57, 0x77, 0x58, 0x73, 0x5b, 0x71, 0x5e, 0x71, 0x64, 0x73,
-  0x64, 0x73, 0x5f, 0x73, 0x58, 0x76, 0x59, 0x78, 0x5d, 0x78, 0x63, 0x78,
-  0x64, 0x7a, 0x63, 0x78, 0x61, 0x6f, 0x61, 0x6a, 0x62, 0x68, 0x64, 0x67,
-  0x65, 0x68, 0x65, 0x67, 0x65, 0x67, 0x68, 0x68, 0x6a, 0x68, 0x6d, 0x69,
-  0x6f, 0x69, 0x70, 0x6a, 0x73, 0x6a, 0x76, 0x6a, 0x76, 0x6a, 0x77, 0x6a,
-  0x77, 0x6a, 0x75, 0x6a, 0x72, 0x6a, 0x6f, 0x6b, 0x6d, 0x6a, 0x68, 0x6a,
-  0x64, 0x6b, 0x61, 0x6b, 0x5d, 0x6b, 0x5c, 0x6b, 0x5d, 0x6c, 0x5e, 0x6c,
-  0x60, 0x6b, 0x68, 0x6b, 0x6e, 0x6d, 0x73, 0x6f, 0x60, 0x6d, 0x5b, 0x6a,
-  0x58, 0x6a, 0x51, 0x6a, 0x52, 0x68, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65,
-  0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x64, 0x55, 0x62, 0x54, 0x63,
-  0x54, 0x63, 0x54, 0x60, 0x53, 0x61, 0x51, 0x65, 0x50, 0x65, 0x4f, 0x65,
-  0x4d, 0x66, 0x4c, 0x67, 0x4c, 0x67, 0x4e, 0x67, 0x4f, 0x64, 0x50, 0x63,
-  0x52, 0x64, 0x54, 0x62, 0x58, 0x65, 0x5b, 0x67, 0x5f, 0x70, 0x62, 0x75,
-  0x64, 0x75, 0x67, 0x75, 0x6a, 0x75, 0x70, 0x74, 0x74, 0x73, 0x76, 0x76,
-  0x7a, 0x78, 0x7b, 0x78, 0x7b, 0x79, 0x79, 0x7a, 0x74, 0x7b, 0x6c, 0x7a,
-  0x68, 0x79, 0x67, 0x77, 0x68, 0x75, 0x6f, 0x76, 0x76, 0x78, 0x70, 0x77,
-  0x68, 0x74, 0x68, 0x70, 0x68, 0x71, 0x6a, 0x72, 0x6b, 0x73, 0x64, 0x72,
-  0x63, 0x73, 0x61, 0x75, 0x5f, 0x7b, 0x64, 0x7e, 0x5e, 0x7d, 0x5e, 0x7b,
-  0x5e, 0x7b, 0x5e, 0x78, 0x63, 0x77, 0x67, 0x77, 0x6c, 0x77, 0x6e, 0x77,
-  0x72, 0x74, 0x73, 0x73, 0x73, 0x71, 0x70, 0x70, 0x6d, 0x72, 0x70, 0x72,
-  0x71, 0x71, 0x6f, 0x70, 0x6e, 0x71, 0x70, 0x74, 0x72, 0x77, 0x74, 0x78,
-  0x76, 0x78, 0x78, 0x7b, 0x77, 0x7c, 0x78, 0x7c, 0x78, 0x7d, 0x78, 0x7d,
-  0x74, 0x7e, 0x72, 0x7e, 0x6e, 0x80, 0x68, 0x83, 0x65, 0x83, 0x62, 0x82,
-  0x5e, 0x82, 0x5b, 0x81, 0x5a, 0x81, 0x5c, 0x83, 0x5d, 0x82, 0x5e, 0x7c,
-  0x61, 0x7b, 0x61, 0x7d, 0x5f, 0x78, 0x5e, 0x73, 0x61, 0x72, 0x65, 0x72,
-  0x64, 0x6d, 0x65, 0x6a, 0x61, 0x6e, 0x5b, 0x73, 0x5b, 0x76, 0x5f, 0x75,
-  0x5a, 0x78, 0x5e, 0x7b, 0x63, 0x79, 0x62, 0x78, 0x5d, 0x79, 0x58, 0x7a,
-  0x56, 0x77, 0x56, 0x74, 0x58, 0x72, 0x5f, 0x71, 0x61, 0x73, 0x5f, 0x73,
-  0x56, 0x76, 0x58, 0x78, 0x5d, 0x78, 0x5f, 0x78, 0x63, 0x7a, 0x63, 0x77,
-  0x62, 0x70, 0x63, 0x6a, 0x63, 0x69, 0x65, 0x69, 0x67, 0x69, 0x66, 0x69,
-  0x66, 0x69, 0x68, 0x69, 0x6a, 0x6a, 0x6b, 0x6a, 0x6d, 0x6a, 0x6f, 0x6a,
-  0x72, 0x6a, 0x73, 0x6a, 0x73, 0x6a, 0x72, 0x6a, 0x72, 0x6b, 0x70, 0x69,
-  0x6e, 0x68, 0x6b, 0x69, 0x68, 0x68, 0x64, 0x6a, 0x5f, 0x6b, 0x5c, 0x6b,
-  0x57, 0x6a, 0x56, 0x6b, 0x57, 0x6c, 0x59, 0x6d, 0x5b, 0x6e, 0x5f, 0x6d,
-  0x64, 0x6d, 0x69, 0x6c, 0x5d, 0x6c, 0x5b, 0x6a, 0x56, 0x6a, 0x52, 0x6a,
-  0x54, 0x67, 0x55, 0x65, 0x56, 0x65, 0x55, 0x66, 0x54, 0x66, 0x55, 0x66,
-  0x55, 0x65, 0x55, 0x63, 0x55, 0x63, 0x54, 0x64, 0x54, 0x64, 0x53, 0x63,
-  0x53, 0x62, 0x51, 0x64, 0x50, 0x64, 0x4f, 0x65, 0x4d, 0x65, 0x4c, 0x66,
-  0x4d, 0x66, 0x4e, 0x67, 0x4f, 0x65, 0x51, 0x63, 0x53, 0x63, 0x54, 0x63,
-  0x58, 0x66, 0x5c, 0x68, 0x5f, 0x71, 0x63, 0x76, 0x65, 0x74, 0x67, 0x74,
-  0x6a, 0x74, 0x6f, 0x75, 0x74, 0x76, 0x76, 0x77, 0x7a, 0x78, 0x7a, 0x78,
-  0x7b, 0x79, 0x79, 0x7a, 0x74, 0x7b, 0x6c, 0x7b, 0x69, 0x7a, 0x68, 0x78,
-  0x67, 0x76, 0x6c, 0x76, 0x73, 0x78, 0x6e, 0x77, 0x69, 0x74, 0x69, 0x70,
-  0x68, 0x70, 0x69, 0x72, 0x69, 0x73, 0x63, 0x72, 0x64, 0x73, 0x65, 0x73,
-  0x61, 0x78, 0x5e, 0x7c, 0x5b, 0x7b, 0x5c, 0x7a, 0x5f, 0x79, 0x61, 0x77,
-  0x65, 0x77, 0x69, 0x78, 0x70, 0x78, 0x71, 0x78, 0x73, 0x74, 0x73, 0x72,
-  0x73, 0x71, 0x72, 0x70, 0x70, 0x71, 0x71, 0x71, 0x70, 0x71, 0x6e, 0x71,
-  0x6e, 0x71, 0x72, 0x74, 0x75, 0x76, 0x76, 0x78, 0x76, 0x78, 0x77, 0x7a,
-  0x77, 0x7b, 0x77, 0x7b, 0x78, 0x7c, 0x77, 0x7b, 0x75, 0x7c, 0x73, 0x7c,
-  0x6f, 0x80, 0x68, 0x83, 0x64, 0x83, 0x60, 0x83, 0x5e, 0x83, 0x5c, 0x83,
-  0x5b, 0x83, 0x5b, 0x84, 0x5b, 0x82, 0x5e, 0x7b, 0x61, 0x7a, 0x5e, 0x7c,
-  0x5b, 0x79, 0x5d, 0x78, 0x60, 0x75, 0x60, 0x74, 0x60, 0x73, 0x61, 0x70,
-  0x5f, 0x70, 0x58, 0x72, 0x58, 0x77, 0x61, 0x77, 0x5b, 0x7c, 0x59, 0x7f,
-  0x69, 0x7a, 0x66, 0x77, 0x5f, 0x7b, 0x56, 0x7d, 0x53, 0x7d, 0x53, 0x7a,
-  0x56, 0x77, 0x5a, 0x74, 0x5c, 0x73, 0x5a, 0x74, 0x54, 0x77, 0x55, 0x78,
-  0x5c, 0x79, 0x5e, 0x78, 0x60, 0x7b, 0x62, 0x78, 0x63, 0x6e, 0x64, 0x6a,
-  0x66, 0x6a, 0x66, 0x6a, 0x67, 0x6a, 0x67, 0x6a, 0x68, 0x6a, 0x69, 0x6a,
-  0x69, 0x6a, 0x69, 0x6a, 0x6a, 0x6a, 0x6d, 0x6a, 0x6e, 0x6a, 0x6f, 0x6a,
-  0x6f, 0x6a, 0x6e, 0x69, 0x6c, 0x69, 0x69, 0x68, 0x67, 0x68, 0x64, 0x68,
-  0x62, 0x68, 0x5f, 0x69, 0x5b, 0x6a, 0x58, 0x6a, 0x53, 0x6a, 0x53, 0x6b,
-  0x54, 0x6d, 0x55, 0x6d, 0x56, 0x6e, 0x58, 0x6d, 0x5b, 0x6d, 0x60, 0x70,
-  0x5c, 0x6c, 0x59, 0x6c, 0x54, 0x6b, 0x54, 0x69, 0x55, 0x67, 0x55, 0x66,
-  0x55, 0x65, 0x54, 0x65, 0x53, 0x66, 0x54, 0x66, 0x54, 0x65, 0x54, 0x64,
-  0x54, 0x65, 0x54, 0x65, 0x54, 0x65, 0x53, 0x65, 0x53, 0x63, 0x50, 0x64,
-  0x50, 0x64, 0x4f, 0x64, 0x4d, 0x65, 0x4d, 0x66, 0x4d, 0x65, 0x4e, 0x66,
-  0x50, 0x66, 0x52, 0x62, 0x53, 0x63, 0x53, 0x65, 0x58, 0x66, 0x5c, 0x69,
-  0x5f, 0x70, 0x64, 0x75, 0x64, 0x73, 0x67, 0x73, 0x6a, 0x74, 0x6f, 0x76,
-  0x75, 0x78, 0x77, 0x78, 0x79, 0x78, 0x7a, 0x78, 0x7a, 0x79, 0x78, 0x7a,
-  0x74, 0x7a, 0x6e, 0x7b, 0x69, 0x7a, 0x67, 0x78, 0x65, 0x78, 0x69, 0x77,
-  0x71, 0x77, 0x6d, 0x77, 0x69, 0x74, 0x6b, 0x6f, 0x69, 0x6e, 0x69, 0x71,
-  0x69, 0x71, 0x63, 0x72, 0x63, 0x72, 0x64, 0x72, 0x62, 0x76, 0x5e, 0x7a,
-  0x5c, 0x7b, 0x5d, 0x79, 0x60, 0x78, 0x62, 0x78, 0x67, 0x78, 0x6c, 0x78,
-  0x72, 0x78, 0x72, 0x78, 0x73, 0x75, 0x73, 0x74, 0x73, 0x72, 0x72, 0x72,
-  0x70, 0x72, 0x70, 0x71, 0x6f, 0x71, 0x6d, 0x72, 0x6e, 0x72, 0x72, 0x74,
-  0x76, 0x76, 0x77, 0x78, 0x77, 0x78, 0x77, 0x79, 0x77, 0x7a, 0x77, 0x7a,
-  0x77, 0x7b, 0x76, 0x7b, 0x74, 0x7b, 0x75, 0x7b, 0x73, 0x7e, 0x6a, 0x84,
-  0x64, 0x84, 0x5f, 0x84, 0x5e, 0x85, 0x5c, 0x84, 0x5b, 0x84, 0x5b, 0x84,
-  0x59, 0x84, 0x5d, 0x7c, 0x61, 0x79, 0x5e, 0x79, 0x5b, 0x7a, 0x5d, 0x7a,
-  0x60, 0x77, 0x60, 0x76, 0x5d, 0x78, 0x5d, 0x75, 0x5d, 0x73, 0x54, 0x77,
-  0x52, 0x7b, 0x5e, 0x7d, 0x5c, 0x80, 0x59, 0x81, 0x68, 0x79, 0x66, 0x78,
-  0x5f, 0x7f, 0x53, 0x7e, 0x4f, 0x7e, 0x54, 0x7d, 0x55, 0x7a, 0x59, 0x77,
-  0x5b, 0x75, 0x59, 0x75, 0x55, 0x77, 0x55, 0x79, 0x5b, 0x7b, 0x5d, 0x7a,
-  0x5f, 0x7b, 0x61, 0x77, 0x63, 0x6d, 0x65, 0x6a, 0x67, 0x6a, 0x67, 0x6a,
-  0x68, 0x6b, 0x68, 0x6b, 0x69, 0x6b, 0x6a, 0x6b, 0x69, 0x6a, 0x68, 0x69,
-  0x69, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6a, 0x6c, 0x6a, 0x6b, 0x68,
-  0x68, 0x68, 0x66, 0x69, 0x64, 0x68, 0x61, 0x68, 0x5e, 0x68, 0x5c, 0x69,
-  0x59, 0x6a, 0x56, 0x6a, 0x53, 0x6b, 0x53, 0x6b, 0x52, 0x6c, 0x52, 0x6d,
-  0x55, 0x6f, 0x56, 0x6e, 0x58, 0x6c, 0x5d, 0x6e, 0x5b, 0x6d, 0x57, 0x69,
-  0x57, 0x67, 0x57, 0x68, 0x56, 0x66, 0x55, 0x66, 0x54, 0x65, 0x54, 0x65,
-  0x54, 0x65, 0x54, 0x65, 0x54, 0x66, 0x54, 0x66, 0x54, 0x66, 0x54, 0x65,
-  0x54, 0x65, 0x53, 0x65, 0x52, 0x62, 0x50, 0x64, 0x50, 0x64, 0x4f, 0x65,
-  0x4d, 0x66, 0x4d, 0x66, 0x4d, 0x66, 0x4e, 0x66, 0x50, 0x66, 0x52, 0x63,
-  0x54, 0x63, 0x53, 0x65, 0x58, 0x67, 0x5b, 0x69, 0x5f, 0x6e, 0x64, 0x73,
-  0x65, 0x73, 0x67, 0x72, 0x6a, 0x73, 0x6f, 0x76, 0x75, 0x78, 0x76, 0x78,
-  0x79, 0x78, 0x7a, 0x77, 0x7a, 0x79, 0x77, 0x7a, 0x76, 0x7a, 0x71, 0x79,
-  0x6c, 0x78, 0x68, 0x78, 0x66, 0x78, 0x68, 0x77, 0x6c, 0x77, 0x69, 0x77,
-  0x68, 0x74, 0x6b, 0x71, 0x6c, 0x71, 0x68, 0x70, 0x64, 0x70, 0x63, 0x71,
-  0x64, 0x72, 0x64, 0x72, 0x62, 0x76, 0x5f, 0x7b, 0x5e, 0x7b, 0x5f, 0x79,
-  0x60, 0x78, 0x64, 0x78, 0x6b, 0x78, 0x6f, 0x78, 0x73, 0x78, 0x73, 0x78,
-  0x73, 0x77, 0x73, 0x75, 0x72, 0x74, 0x72, 0x74, 0x72, 0x73, 0x73, 0x74,
-  0x71, 0x73, 0x6f, 0x74, 0x6d, 0x74, 0x72, 0x76, 0x78, 0x78, 0x77, 0x78,
-  0x77, 0x78, 0x77, 0x79, 0x77, 0x7a, 0x77, 0x7b, 0x77, 0x7b, 0x76, 0x7b,
-  0x75, 0x7b, 0x75, 0x7a, 0x77, 0x7e, 0x6d, 0x84, 0x65, 0x86, 0x5f, 0x86,
-  0x5e, 0x86, 0x5b, 0x86, 0x5b, 0x86, 0x5b, 0x86, 0x58, 0x85, 0x5b, 0x7e,
-  0x61, 0x7a, 0x60, 0x7a, 0x5d, 0x7a, 0x60, 0x7a, 0x60, 0x79, 0x5d, 0x7a,
-  0x5c, 0x7c, 0x5c, 0x7b, 0x5a, 0x79, 0x51, 0x7d, 0x50, 0x7e, 0x57, 0x83,
-  0x5b, 0x82, 0x61, 0x7c, 0x64, 0x79, 0x65, 0x7c, 0x5e, 0x81, 0x50, 0x7e,
-  0x4c, 0x7d, 0x51, 0x7e, 0x53, 0x7c, 0x57, 0x7a, 0x5a, 0x79, 0x5d, 0x79,
-  0x5b, 0x79, 0x59, 0x7c, 0x5a, 0x7c, 0x5d, 0x79, 0x5f, 0x79, 0x62, 0x76,
-  0x64, 0x6d, 0x67, 0x6a, 0x69, 0x6d, 0x69, 0x6d, 0x6a, 0x6d, 0x6a, 0x6d,
-  0x6a, 0x6d, 0x6a, 0x6d, 0x69, 0x6c, 0x68, 0x6b, 0x69, 0x6b, 0x69, 0x6b,
-  0x69, 0x6b, 0x68, 0x6a, 0x69, 0x6a, 0x67, 0x68, 0x65, 0x68, 0x62, 0x68,
-  0x60, 0x68, 0x5d, 0x68, 0x5b, 0x69, 0x58, 0x69, 0x55, 0x6a, 0x53, 0x6a,
-  0x53, 0x6a, 0x52, 0x6a, 0x51, 0x6a, 0x52, 0x6b, 0x55, 0x6e, 0x57, 0x6d,
-  0x58, 0x6a, 0x59, 0x6c, 0x5a, 0x69, 0x5b, 0x64, 0x5b, 0x64, 0x58, 0x67,
-  0x56, 0x66, 0x55, 0x65, 0x54, 0x66, 0x54, 0x66, 0x54, 0x66, 0x54, 0x66,
-  0x54, 0x66, 0x54, 0x67, 0x54, 0x67, 0x54, 0x64, 0x54, 0x64, 0x53, 0x65,
-  0x53, 0x63, 0x51, 0x65, 0x50, 0x65, 0x4f, 0x65, 0x4d, 0x66, 0x4e, 0x66,
-  0x4e, 0x66, 0x4f, 0x66, 0x51, 0x66, 0x53, 0x63, 0x54, 0x62, 0x54, 0x65,
-  0x58, 0x67, 0x5b, 0x69, 0x5e, 0x6d, 0x64, 0x72, 0x64, 0x73, 0x67, 0x73,
-  0x69, 0x74, 0x6e, 0x76, 0x74, 0x78, 0x76, 0x78, 0x79, 0x78, 0x7a, 0x78,
-  0x7a, 0x79, 0x77, 0x79, 0x76, 0x79, 0x74, 0x78, 0x70, 0x78, 0x6e, 0x78,
-  0x6b, 0x77, 0x6a, 0x77, 0x6a, 0x77, 0x67, 0x77, 0x67, 0x75, 0x6b, 0x72,
-  0x6d, 0x72, 0x63, 0x6f, 0x5c, 0x6f, 0x61, 0x71, 0x64, 0x72, 0x64, 0x72,
-  0x62, 0x76, 0x60, 0x7a, 0x5f, 0x7b, 0x5f, 0x7a, 0x60, 0x78, 0x65, 0x78,
-  0x6e, 0x78, 0x72, 0x78, 0x75, 0x78, 0x75, 0x78, 0x73, 0x78, 0x73, 0x77,
-  0x72, 0x76, 0x73, 0x75, 0x74, 0x75, 0x74, 0x75, 0x73, 0x75, 0x71, 0x75,
-  0x6d, 0x76, 0x73, 0x78, 0x79, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x79,
-  0x77, 0x7a, 0x77, 0x7a, 0x77, 0x7b, 0x76, 0x7b, 0x75, 0x7a, 0x75, 0x7b,
-  0x75, 0x7e, 0x6a, 0x84, 0x64, 0x87, 0x5f, 0x87, 0x5e, 0x87, 0x5d, 0x87,
-  0x5c, 0x87, 0x5c, 0x88, 0x57, 0x87, 0x5a, 0x7f, 0x5e, 0x7b, 0x5c, 0x7a,
-  0x5d, 0x7a, 0x61, 0x7a, 0x60, 0x7c, 0x5c, 0x7d, 0x5b, 0x7f, 0x5c, 0x7e,
-  0x5a, 0x7d, 0x54, 0x7d, 0x54, 0x7c, 0x57, 0x83, 0x61, 0x7f, 0x67, 0x78,
-  0x63, 0x79, 0x66, 0x7c, 0x5d, 0x7e, 0x4e, 0x7c, 0x4a, 0x7d, 0x4f, 0x7d,
-  0x52, 0x7d, 0x55, 0x7c, 0x59, 0x7c, 0x5f, 0x7c, 0x5e, 0x7b, 0x5d, 0x7d,
-  0x5b, 0x7c, 0x5c, 0x79, 0x5f, 0x78, 0x62, 0x75, 0x66, 0x6c, 0x68, 0x69,
-  0x6b, 0x6e, 0x6b, 0x6e, 0x6b, 0x6e, 0x6c, 0x6e, 0x6b, 0x6e, 0x6a, 0x6e,
-  0x6a, 0x6e, 0x69, 0x6d, 0x68, 0x6d, 0x67, 0x6c, 0x67, 0x6b, 0x66, 0x6a,
-  0x65, 0x6a, 0x64, 0x69, 0x61, 0x68, 0x5f, 0x68, 0x5d, 0x69, 0x5a, 0x69,
-  0x58, 0x68, 0x56, 0x6a, 0x53, 0x6b, 0x52, 0x6a, 0x53, 0x6a, 0x54, 0x6a,
-  0x54, 0x69, 0x54, 0x6a, 0x55, 0x6a, 0x58, 0x6a, 0x58, 0x6a, 0x58, 0x6c,
-  0x5e, 0x66, 0x5d, 0x66, 0x5b, 0x64, 0x58, 0x67, 0x56, 0x66, 0x55, 0x65,
-  0x54, 0x67, 0x54, 0x68, 0x54, 0x68, 0x54, 0x67, 0x54, 0x66, 0x54, 0x65,
-  0x54, 0x66, 0x53, 0x66, 0x53, 0x65, 0x53, 0x65, 0x53, 0x65, 0x51, 0x65,
-  0x51, 0x64, 0x4f, 0x63, 0x4e, 0x65, 0x4e, 0x66, 0x4e, 0x66, 0x4f, 0x66,
-  0x51, 0x64, 0x54, 0x62, 0x54, 0x64, 0x55, 0x66, 0x59, 0x67, 0x5b, 0x68,
-  0x5e, 0x6d, 0x62, 0x72, 0x63, 0x73, 0x66, 0x74, 0x6a, 0x75, 0x6c, 0x75,
-  0x72, 0x77, 0x73, 0x77, 0x77, 0x77, 0x7a, 0x78, 0x79, 0x78, 0x77, 0x78,
-  0x77, 0x78, 0x78, 0x78, 0x72, 0x78, 0x6f, 0x77, 0x6d, 0x77, 0x6f, 0x78,
-  0x6e, 0x78, 0x6c, 0x78, 0x6a, 0x78, 0x69, 0x75, 0x6a, 0x73, 0x5d, 0x70,
-  0x56, 0x72, 0x5e, 0x73, 0x61, 0x74, 0x62, 0x74, 0x61, 0x77, 0x60, 0x79,
-  0x5e, 0x7a, 0x5c, 0x7b, 0x5e, 0x7a, 0x65, 0x79, 0x6d, 0x7b, 0x71, 0x7a,
-  0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x73, 0x78, 0x72, 0x78, 0x74, 0x77,
-  0x75, 0x78, 0x75, 0x78, 0x75, 0x77, 0x75, 0x77, 0x73, 0x79, 0x78, 0x7a,
-  0x78, 0x79, 0x77, 0x79, 0x77, 0x7a, 0x76, 0x7a, 0x77, 0x7a, 0x78, 0x7a,
-  0x77, 0x7b, 0x75, 0x7a, 0x74, 0x7a, 0x74, 0x7c, 0x73, 0x7f, 0x68, 0x85,
-  0x62, 0x88, 0x5f, 0x88, 0x60, 0x88, 0x5f, 0x88, 0x5e, 0x88, 0x5e, 0x88,
-  0x59, 0x87, 0x58, 0x7f, 0x5c, 0x7c, 0x5d, 0x7c, 0x5f, 0x7d, 0x60, 0x7d,
-  0x60, 0x7d, 0x5b, 0x7e, 0x5a, 0x7e, 0x5d, 0x7f, 0x5a, 0x7e, 0x57, 0x7e,
-  0x5a, 0x7f, 0x64, 0x7d, 0x71, 0x78, 0x6e, 0x79, 0x6a, 0x7c, 0x6d, 0x7e,
-  0x5c, 0x7c, 0x50, 0x7b, 0x4d, 0x7b, 0x53, 0x79, 0x53, 0x79, 0x54, 0x7b,
-  0x58, 0x7c, 0x5d, 0x7d, 0x60, 0x7c, 0x61, 0x7c, 0x60, 0x7c, 0x60, 0x7a,
-  0x60, 0x77, 0x63, 0x73, 0x67, 0x6c, 0x69, 0x6a, 0x6b, 0x6e, 0x6b, 0x6e,
-  0x6b, 0x6f, 0x6b, 0x6f, 0x6b, 0x6f, 0x6b, 0x6f, 0x6a, 0x6f, 0x67, 0x6e,
-  0x66, 0x6d, 0x65, 0x6c, 0x63, 0x6c, 0x63, 0x6b, 0x60, 0x6a, 0x60, 0x6a,
-  0x5d, 0x6a, 0x5c, 0x69, 0x5a, 0x6a, 0x57, 0x6a, 0x56, 0x69, 0x56, 0x6a,
-  0x54, 0x6b, 0x54, 0x6b, 0x55, 0x6a, 0x55, 0x6a, 0x55, 0x6b, 0x55, 0x6b,
-  0x56, 0x6a, 0x56, 0x6b, 0x58, 0x6c, 0x5a, 0x6c, 0x60, 0x62, 0x5e, 0x62,
-  0x5b, 0x63, 0x58, 0x65, 0x55, 0x65, 0x55, 0x66, 0x54, 0x66, 0x54, 0x66,
-  0x54, 0x66, 0x54, 0x65, 0x54, 0x65, 0x54, 0x65, 0x53, 0x66, 0x53, 0x67,
-  0x53, 0x65, 0x53, 0x65, 0x53, 0x65, 0x51, 0x65, 0x51, 0x64, 0x50, 0x63,
-  0x4e, 0x65, 0x4e, 0x64, 0x4f, 0x63, 0x51, 0x64, 0x53, 0x62, 0x55, 0x62,
-  0x53, 0x64, 0x55, 0x67, 0x5a, 0x68, 0x5b, 0x68, 0x5e, 0x6b, 0x62, 0x70,
-  0x63, 0x73, 0x66, 0x74, 0x68, 0x75, 0x6a, 0x75, 0x70, 0x77, 0x72, 0x77,
-  0x76, 0x78, 0x79, 0x78, 0x78, 0x78, 0x77, 0x78, 0x77, 0x79, 0x77, 0x7a,
-  0x6d, 0x7a, 0x68, 0x78, 0x6b, 0x78, 0x6e, 0x78, 0x72, 0x78, 0x73, 0x78,
-  0x73, 0x78, 0x6e, 0x79, 0x6b, 0x77, 0x5f, 0x72, 0x58, 0x77, 0x5b, 0x77,
-  0x5f, 0x76, 0x5f, 0x76, 0x5f, 0x79, 0x5f, 0x7b, 0x5e, 0x7c, 0x5b, 0x7d,
-  0x5c, 0x7c, 0x63, 0x7a, 0x69, 0x7b, 0x6d, 0x7b, 0x71, 0x7a, 0x71, 0x7a,
-  0x71, 0x7a, 0x71, 0x7a, 0x70, 0x7a, 0x72, 0x7a, 0x74, 0x7b, 0x73, 0x7c,
-  0x74, 0x7b, 0x75, 0x7a, 0x76, 0x7b, 0x7b, 0x7c, 0x78, 0x7c, 0x77, 0x7b,
-  0x77, 0x7b, 0x76, 0x7b, 0x77, 0x7a, 0x79, 0x7a, 0x77, 0x7b, 0x74, 0x7b,
-  0x73, 0x7c, 0x73, 0x7e, 0x6d, 0x81, 0x64, 0x87, 0x62, 0x88, 0x5f, 0x88,
-  0x60, 0x86, 0x5f, 0x86, 0x5f, 0x86, 0x60, 0x86, 0x5d, 0x87, 0x59, 0x83,
-  0x5a, 0x7f, 0x60, 0x7e, 0x60, 0x7e, 0x5f, 0x7e, 0x5e, 0x7e, 0x59, 0x7e,
-  0x58, 0x7d, 0x5c, 0x7d, 0x5b, 0x7d, 0x61, 0x7e, 0x68, 0x7b, 0x73, 0x73,
-  0x79, 0x75, 0x75, 0x7c, 0x70, 0x7e, 0x6e, 0x7c, 0x5b, 0x77, 0x51, 0x78,
-  0x53, 0x77, 0x57, 0x74, 0x57, 0x75, 0x56, 0x78, 0x58, 0x7a, 0x5b, 0x7c,
-  0x60, 0x7e, 0x62, 0x7e, 0x63, 0x7c, 0x63, 0x7a, 0x5f, 0x77, 0x61, 0x73,
-  0x66, 0x6f, 0x68, 0x6d, 0x69, 0x6d, 0x6a, 0x6e, 0x69, 0x6f, 0x69, 0x6f,
-  0x6a, 0x6f, 0x69, 0x6f, 0x69, 0x6f, 0x65, 0x6e, 0x64, 0x6d, 0x64, 0x6c,
-  0x61, 0x6c, 0x5f, 0x6b, 0x5c, 0x6a, 0x5c, 0x6a, 0x59, 0x6a, 0x58, 0x6a,
-  0x56, 0x69, 0x54, 0x6b, 0x54, 0x6b, 0x54, 0x6b, 0x55, 0x6b, 0x55, 0x6b,
-  0x55, 0x6b, 0x55, 0x6b, 0x57, 0x6b, 0x56, 0x6a, 0x55, 0x6a, 0x56, 0x6b,
-  0x58, 0x6b, 0x5b, 0x6a, 0x61, 0x5f, 0x5e, 0x5f, 0x5b, 0x62, 0x58, 0x63,
-  0x56, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x64, 0x55, 0x64,
-  0x54, 0x64, 0x54, 0x65, 0x54, 0x66, 0x53, 0x66, 0x53, 0x65, 0x53, 0x65,
-  0x53, 0x65, 0x51, 0x64, 0x51, 0x64, 0x50, 0x63, 0x4f, 0x64, 0x4e, 0x63,
-  0x50, 0x62, 0x52, 0x63, 0x53, 0x62, 0x55, 0x61, 0x53, 0x65, 0x55, 0x67,
-  0x5a, 0x67, 0x5c, 0x67, 0x5e, 0x6b, 0x62, 0x70, 0x63, 0x73, 0x66, 0x74,
-  0x66, 0x75, 0x69, 0x75, 0x6e, 0x77, 0x71, 0x77, 0x74, 0x78, 0x77, 0x78,
-  0x77, 0x78, 0x77, 0x78, 0x77, 0x7a, 0x71, 0x7b, 0x66, 0x7b, 0x63, 0x7a,
-  0x67, 0x79, 0x69, 0x78, 0x6f, 0x78, 0x72, 0x77, 0x76, 0x78, 0x76, 0x7b,
-  0x72, 0x79, 0x66, 0x77, 0x5e, 0x78, 0x5b, 0x77, 0x5f, 0x77, 0x5f, 0x77,
-  0x5d, 0x7a, 0x5e, 0x7d, 0x5e, 0x7e, 0x5b, 0x7e, 0x5b, 0x7d, 0x61, 0x7b,
-  0x67, 0x7b, 0x6b, 0x7b, 0x70, 0x7b, 0x70, 0x7c, 0x70, 0x7b, 0x6f, 0x7b,
-  0x6f, 0x7b, 0x71, 0x7c, 0x73, 0x7d, 0x73, 0x7e, 0x75, 0x7d, 0x75, 0x7c,
-  0x75, 0x7d, 0x78, 0x7e, 0x76, 0x7d, 0x77, 0x7c, 0x78, 0x7c, 0x76, 0x7b,
-  0x77, 0x7a, 0x79, 0x7a, 0x77, 0x7a, 0x74, 0x7b, 0x72, 0x7e, 0x71, 0x80,
-  0x68, 0x82, 0x62, 0x87, 0x62, 0x88, 0x5f, 0x88, 0x5f, 0x85, 0x5f, 0x85,
-  0x60, 0x85, 0x60, 0x85, 0x5f, 0x86, 0x59, 0x85, 0x58, 0x81, 0x5e, 0x7f,
-  0x5f, 0x7e, 0x5d, 0x7d, 0x5c, 0x7d, 0x58, 0x7e, 0x59, 0x7d, 0x60, 0x7c,
-  0x60, 0x7c, 0x69, 0x79, 0x71, 0x75, 0x74, 0x75, 0x75, 0x7a, 0x75, 0x7d,
-  0x70, 0x7a, 0x6b, 0x78, 0x5a, 0x75, 0x52, 0x76, 0x58, 0x75, 0x59, 0x72,
-  0x5a, 0x73, 0x59, 0x76, 0x58, 0x78, 0x58, 0x7b, 0x5c, 0x7f, 0x5e, 0x7f,
-  0x60, 0x7c, 0x60, 0x79, 0x5e, 0x7a, 0x60, 0x78, 0x65, 0x72, 0x66, 0x70,
-  0x68, 0x6e, 0x68, 0x6e, 0x67, 0x6f, 0x68, 0x6f, 0x68, 0x6f, 0x68, 0x6f,
-  0x68, 0x6e, 0x64, 0x6e, 0x63, 0x6d, 0x63, 0x6c, 0x5f, 0x6c, 0x5d, 0x6b,
-  0x5a, 0x6a, 0x59, 0x6a, 0x56, 0x6a, 0x55, 0x6a, 0x53, 0x6a, 0x53, 0x6c,
-  0x53, 0x6c, 0x54, 0x6b, 0x55, 0x6b, 0x56, 0x6c, 0x55, 0x6d, 0x56, 0x6c,
-  0x58, 0x6b, 0x57, 0x6b, 0x56, 0x6b, 0x56, 0x6a, 0x58, 0x6a, 0x5a, 0x6a,
-  0x62, 0x5d, 0x5e, 0x5f, 0x5b, 0x63, 0x58, 0x63, 0x56, 0x65, 0x56, 0x65,
-  0x56, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x54, 0x66,
-  0x54, 0x66, 0x53, 0x65, 0x53, 0x65, 0x51, 0x65, 0x51, 0x65, 0x51, 0x64,
-  0x51, 0x62, 0x51, 0x63, 0x50, 0x64, 0x4f, 0x63, 0x51, 0x63, 0x53, 0x62,
-  0x54, 0x61, 0x55, 0x63, 0x54, 0x66, 0x56, 0x67, 0x5a, 0x68, 0x5c, 0x68,
-  0x5e, 0x6c, 0x61, 0x71, 0x63, 0x72, 0x66, 0x74, 0x67, 0x75, 0x69, 0x76,
-  0x6e, 0x77, 0x72, 0x78, 0x73, 0x79, 0x75, 0x79, 0x76, 0x79, 0x76, 0x78,
-  0x76, 0x79, 0x6e, 0x7a, 0x66, 0x7a, 0x61, 0x7b, 0x60, 0x7b, 0x62, 0x7b,
-  0x68, 0x78, 0x6d, 0x78, 0x73, 0x78, 0x7a, 0x7b, 0x7c, 0x7b, 0x74, 0x7c,
-  0x6b, 0x7a, 0x60, 0x78, 0x5c, 0x7b, 0x5d, 0x7b, 0x5c, 0x7c, 0x5b, 0x7f,
-  0x5b, 0x80, 0x5a, 0x80, 0x5b, 0x81, 0x5f, 0x7e, 0x65, 0x7b, 0x69, 0x7d,
-  0x6e, 0x7c, 0x6f, 0x7c, 0x6e, 0x7b, 0x6a, 0x7b, 0x69, 0x7c, 0x6c, 0x7c,
-  0x6f, 0x7c, 0x71, 0x7e, 0x71, 0x7f, 0x72, 0x7e, 0x73, 0x7f, 0x71, 0x7f,
-  0x6f, 0x7e, 0x71, 0x7d, 0x72, 0x7d, 0x71, 0x7c, 0x72, 0x7c, 0x74, 0x7c,
-  0x71, 0x7c, 0x6f, 0x7d, 0x6c, 0x82, 0x68, 0x84, 0x63, 0x86, 0x62, 0x87,
-  0x61, 0x87, 0x60, 0x87, 0x5f, 0x85, 0x5f, 0x85, 0x5f, 0x84, 0x5f, 0x84,
-  0x60, 0x85, 0x5a, 0x85, 0x58, 0x84, 0x5a, 0x7f, 0x5c, 0x7c, 0x5c, 0x7c,
-  0x5c, 0x7c, 0x5b, 0x7c, 0x5d, 0x7c, 0x67, 0x7c, 0x6c, 0x7c, 0x71, 0x78,
-  0x74, 0x78, 0x76, 0x7b, 0x79, 0x77, 0x77, 0x77, 0x6d, 0x74, 0x65, 0x74,
-  0x57, 0x77, 0x56, 0x74, 0x5a, 0x74, 0x5b, 0x73, 0x5a, 0x74, 0x5a, 0x76,
-  0x58, 0x77, 0x56, 0x7a, 0x57, 0x7d, 0x59, 0x7c, 0x5c, 0x7d, 0x5e, 0x7c,
-  0x5d, 0x7e, 0x5e, 0x82, 0x62, 0x7b, 0x65, 0x76, 0x66, 0x72, 0x64, 0x73,
-  0x62, 0x72, 0x64, 0x70, 0x66, 0x6f, 0x66, 0x6e, 0x66, 0x6e, 0x63, 0x6d,
-  0x61, 0x6d, 0x5f, 0x6c, 0x5d, 0x6c, 0x5b, 0x6c, 0x56, 0x69, 0x55, 0x6b,
-  0x53, 0x6b, 0x52, 0x6b, 0x52, 0x6b, 0x52, 0x6c, 0x52, 0x6c, 0x53, 0x6d,
-  0x54, 0x6c, 0x54, 0x6d, 0x54, 0x6d, 0x54, 0x6d, 0x55, 0x6c, 0x56, 0x6c,
-  0x57, 0x6b, 0x57, 0x6a, 0x57, 0x6a, 0x58, 0x6a, 0x63, 0x5b, 0x5e, 0x5e,
-  0x5b, 0x63, 0x59, 0x63, 0x57, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65,
-  0x55, 0x65, 0x55, 0x65, 0x54, 0x65, 0x54, 0x66, 0x53, 0x66, 0x53, 0x65,
-  0x52, 0x65, 0x51, 0x65, 0x51, 0x65, 0x51, 0x64, 0x51, 0x62, 0x51, 0x62,
-  0x50, 0x63, 0x4f, 0x64, 0x51, 0x64, 0x54, 0x62, 0x54, 0x61, 0x55, 0x63,
-  0x53, 0x66, 0x55, 0x67, 0x58, 0x68, 0x5b, 0x68, 0x5d, 0x6b, 0x5f, 0x70,
-  0x62, 0x72, 0x65, 0x74, 0x66, 0x75, 0x68, 0x76, 0x6c, 0x77, 0x70, 0x78,
-  0x73, 0x7a, 0x75, 0x7a, 0x76, 0x79, 0x74, 0x78, 0x73, 0x79, 0x70, 0x79,
-  0x6e, 0x79, 0x69, 0x77, 0x60, 0x78, 0x5e, 0x79, 0x64, 0x79, 0x68, 0x79,
-  0x6f, 0x79, 0x74, 0x7b, 0x7b, 0x7b, 0x7f, 0x7b, 0x79, 0x7b, 0x67, 0x7a,
-  0x57, 0x7c, 0x58, 0x7d, 0x5a, 0x7f, 0x59, 0x81, 0x59, 0x81, 0x59, 0x82,
-  0x59, 0x83, 0x5d, 0x80, 0x63, 0x7d, 0x66, 0x7f, 0x69, 0x7d, 0x6b, 0x7d,
-  0x69, 0x7d, 0x66, 0x7d, 0x65, 0x7e, 0x65, 0x7e, 0x66, 0x7d, 0x68, 0x7f,
-  0x6a, 0x80, 0x6e, 0x80, 0x6f, 0x80, 0x6a, 0x80, 0x67, 0x7f, 0x68, 0x7f,
-  0x69, 0x7f, 0x6b, 0x7e, 0x6c, 0x7f, 0x6a, 0x80, 0x66, 0x81, 0x65, 0x81,
-  0x64, 0x85, 0x62, 0x87, 0x62, 0x87, 0x62, 0x87, 0x61, 0x87, 0x60, 0x87,
-  0x60, 0x85, 0x60, 0x85, 0x60, 0x84, 0x60, 0x84, 0x60, 0x85, 0x5c, 0x85,
-  0x59, 0x85, 0x5b, 0x7f, 0x5d, 0x7b, 0x5d, 0x7b, 0x5e, 0x79, 0x60, 0x77,
-  0x65, 0x7b, 0x70, 0x7c, 0x72, 0x7d, 0x75, 0x7e, 0x76, 0x7c, 0x79, 0x75,
-  0x78, 0x75, 0x73, 0x74, 0x6c, 0x72, 0x62, 0x75, 0x54, 0x79, 0x57, 0x75,
-  0x5a, 0x75, 0x5b, 0x75, 0x5a, 0x76, 0x59, 0x77, 0x57, 0x78, 0x55, 0x7b,
-  0x57, 0x7c, 0x59, 0x7c, 0x59, 0x7d, 0x5b, 0x80, 0x5c, 0x83, 0x5c, 0x88,
-  0x5c, 0x84, 0x61, 0x7f, 0x60, 0x79, 0x5f, 0x78, 0x60, 0x75, 0x62, 0x74,
-  0x64, 0x72, 0x63, 0x6f, 0x64, 0x6e, 0x63, 0x6e, 0x61, 0x6f, 0x5e, 0x6f,
-  0x5c, 0x6f, 0x5a, 0x6d, 0x55, 0x6a, 0x53, 0x6a, 0x51, 0x6b, 0x51, 0x6b,
-  0x51, 0x6b, 0x50, 0x6c, 0x50, 0x6d, 0x52, 0x6d, 0x52, 0x6d, 0x53, 0x6d,
-  0x53, 0x6d, 0x53, 0x6d, 0x55, 0x6c, 0x55, 0x6c, 0x56, 0x6a, 0x56, 0x6a,
-  0x55, 0x6b, 0x56, 0x6b, 0x63, 0x5a, 0x5f, 0x5c, 0x5c, 0x62, 0x59, 0x63,
-  0x57, 0x64, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65, 0x55, 0x65,
-  0x54, 0x65, 0x54, 0x65, 0x53, 0x65, 0x53, 0x65, 0x52, 0x65, 0x51, 0x65,
-  0x51, 0x65, 0x51, 0x64, 0x51, 0x62, 0x51, 0x62, 0x50, 0x63, 0x50, 0x63,
-  0x51, 0x63, 0x54, 0x62, 0x55, 0x62, 0x53, 0x63, 0x53, 0x65, 0x54, 0x67,
-  0x56, 0x67, 0x58, 0x68, 0x5b, 0x69, 0x5e, 0x6e, 0x61, 0x72, 0x63, 0x74,
-  0x64, 0x75, 0x67, 0x75, 0x6b, 0x77, 0x6e, 0x78, 0x73, 0x7a, 0x75, 0x7a,
-  0x76, 0x79, 0x72, 0x78, 0x6d, 0x78, 0x6c, 0x7a, 0x6f, 0x79, 0x70, 0x78,
-  0x6b, 0x78, 0x66, 0x78, 0x60, 0x7b, 0x63, 0x7b, 0x6a, 0x7b, 0x70, 0x7b,
-  0x74, 0x7b, 0x7a, 0x7a, 0x7c, 0x7c, 0x74, 0x7c, 0x5f, 0x7e, 0x58, 0x80,
-  0x59, 0x82, 0x57, 0x83, 0x57, 0x83, 0x57, 0x83, 0x57, 0x84, 0x5b, 0x82,
-  0x60, 0x81, 0x63, 0x82, 0x65, 0x7f, 0x67, 0x7e, 0x64, 0x80, 0x62, 0x80,
-  0x65, 0x7f, 0x63, 0x7f, 0x62, 0x7e, 0x65, 0x80, 0x65, 0x81, 0x69, 0x81,
-  0x6f, 0x81, 0x69, 0x81, 0x64, 0x81, 0x65, 0x80, 0x66, 0x80, 0x67, 0x80,
-  0x65, 0x81, 0x63, 0x83, 0x61, 0x86, 0x60, 0x86, 0x61, 0x88, 0x62, 0x89,
-  0x62, 0x87, 0x62, 0x87, 0x61, 0x87, 0x61, 0x87, 0x62, 0x85, 0x61, 0x85,
-  0x62, 0x84, 0x62, 0x84, 0x62, 0x85, 0x5d, 0x85, 0x5b, 0x84, 0x5d, 0x7f,
-  0x5f, 0x7a, 0x5f, 0x79, 0x62, 0x78, 0x66, 0x79, 0x6c, 0x7d, 0x72, 0x7c,
-  0x74, 0x7c, 0x78, 0x78, 0x79, 0x74, 0x77, 0x70, 0x70, 0x70, 0x6e, 0x6f,
-  0x69, 0x71, 0x60, 0x76, 0x58, 0x7a, 0x59, 0x77, 0x5a, 0x77, 0x5b, 0x76,
-  0x5a, 0x77, 0x59, 0x7a, 0x55, 0x7a, 0x55, 0x7c, 0x58, 0x7c, 0x5a, 0x7c,
-  0x5c, 0x7e, 0x5f, 0x83, 0x5f, 0x87, 0x60, 0x8d, 0x5e, 0x8d, 0x5a, 0x88,
-  0x59, 0x80, 0x5b, 0x7c, 0x5e, 0x78, 0x60, 0x77, 0x61, 0x74, 0x60, 0x71,
-  0x62, 0x70, 0x63, 0x70, 0x61, 0x70, 0x5e, 0x72, 0x5c, 0x71, 0x59, 0x6f,
-  0x54, 0x6c, 0x52, 0x6b, 0x4f, 0x6b, 0x4f, 0x6b, 0x50, 0x6a, 0x4f, 0x6b,
-  0x50, 0x6c, 0x50, 0x6c, 0x50, 0x6d, 0x51, 0x6d, 0x54, 0x6d, 0x54, 0x6c,
-  0x55, 0x6c, 0x55, 0x6b, 0x55, 0x6a, 0x55, 0x6b, 0x55, 0x6b, 0x54, 0x6b,
-  0x63, 0x5d, 0x5f, 0x5e, 0x5d, 0x61, 0x59, 0x64, 0x57, 0x65, 0x55, 0x65,
-  0x55, 0x64, 0x56, 0x63, 0x56, 0x62, 0x55, 0x63, 0x54, 0x65, 0x54, 0x65,
-  0x53, 0x65, 0x52, 0x65, 0x52, 0x65, 0x51, 0x66, 0x51, 0x66, 0x51, 0x64,
-  0x51, 0x63, 0x50, 0x63, 0x51, 0x63, 0x51, 0x62, 0x52, 0x62, 0x55, 0x61,
-  0x55, 0x62, 0x53, 0x64, 0x52, 0x65, 0x53, 0x65, 0x54, 0x65, 0x54, 0x67,
-  0x58, 0x68, 0x5e, 0x6d, 0x61, 0x73, 0x63, 0x75, 0x64, 0x75, 0x67, 0x75,
-  0x6a, 0x77, 0x6c, 0x78, 0x71, 0x7a, 0x73, 0x7a, 0x73, 0x78, 0x6f, 0x78,
-  0x6b, 0x79, 0x6a, 0x79, 0x6e, 0x7a, 0x71, 0x7b, 0x71, 0x7a, 0x6e, 0x79,
-  0x65, 0x7b, 0x60, 0x7d, 0x64, 0x7e, 0x6e, 0x7d, 0x73, 0x7b, 0x71, 0x7b,
-  0x71, 0x7d, 0x77, 0x7d, 0x71, 0x7d, 0x62, 0x81, 0x63, 0x8a, 0x69, 0x89,
-  0x61, 0x86, 0x58, 0x88, 0x57, 0x89, 0x55, 0x88, 0x5c, 0x85, 0x63, 0x85,
-  0x68, 0x84, 0x69, 0x7e, 0x67, 0x7f, 0x65, 0x82, 0x68, 0x7f, 0x67, 0x7c,
-  0x67, 0x7d, 0x68, 0x7e, 0x68, 0x7f, 0x69, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f,
-  0x69, 0x7f, 0x66, 0x7f, 0x64, 0x7e, 0x63, 0x81, 0x61, 0x83, 0x5f, 0x86,
-  0x5f, 0x89, 0x5f, 0x89, 0x60, 0x89, 0x63, 0x89, 0x65, 0x86, 0x62, 0x86,
-  0x62, 0x87, 0x65, 0x87, 0x66, 0x86, 0x66, 0x86, 0x64, 0x85, 0x64, 0x85,
-  0x63, 0x86, 0x60, 0x84, 0x5d, 0x81, 0x5f, 0x7c, 0x61, 0x7a, 0x64, 0x7b,
-  0x68, 0x7e, 0x6b, 0x80, 0x71, 0x7d, 0x75, 0x79, 0x78, 0x75, 0x78, 0x70,
-  0x75, 0x6e, 0x6f, 0x6f, 0x6a, 0x70, 0x67, 0x71, 0x62, 0x73, 0x5e, 0x77,
-  0x5a, 0x7a, 0x56, 0x7a, 0x56, 0x79, 0x59, 0x76, 0x59, 0x76, 0x57, 0x79,
-  0x53, 0x7b, 0x54, 0x7d, 0x5a, 0x7d, 0x5b, 0x7c, 0x5e, 0x7f, 0x62, 0x85,
-  0x64, 0x8a, 0x68, 0x8e, 0x66, 0x90, 0x58, 0x8d, 0x55, 0x84, 0x5a, 0x7f,
-  0x5d, 0x78, 0x5e, 0x77, 0x5d, 0x77, 0x5d, 0x73, 0x62, 0x73, 0x63, 0x75,
-  0x61, 0x75, 0x60, 0x76, 0x5e, 0x75, 0x5a, 0x72, 0x56, 0x70, 0x53, 0x70,
-  0x51, 0x6e, 0x4c, 0x6d, 0x4c, 0x6c, 0x4c, 0x6b, 0x4d, 0x6b, 0x4e, 0x6b,
-  0x50, 0x6b, 0x51, 0x6b, 0x53, 0x6b, 0x55, 0x6c, 0x54, 0x6d, 0x54, 0x6c,
-  0x54, 0x6c, 0x54, 0x6c, 0x54, 0x6d, 0x54, 0x6c, 0x62, 0x5e, 0x5e, 0x60,
-  0x5d, 0x61, 0x59, 0x64, 0x57, 0x65, 0x55, 0x65, 0x55, 0x64, 0x56, 0x63,
-  0x56, 0x61, 0x56, 0x62, 0x54, 0x65, 0x53, 0x65, 0x53, 0x65, 0x52, 0x65,
-  0x52, 0x65, 0x51, 0x65, 0x51, 0x65, 0x51, 0x63, 0x51, 0x63, 0x50, 0x63,
-  0x51, 0x64, 0x51, 0x62, 0x53, 0x62, 0x55, 0x61, 0x55, 0x61, 0x53, 0x65,
-  0x52, 0x66, 0x52, 0x65, 0x53, 0x65, 0x53, 0x67, 0x56, 0x67, 0x5d, 0x6d,
-  0x60, 0x72, 0x63, 0x75, 0x64, 0x75, 0x66, 0x75, 0x69, 0x77, 0x6b, 0x77,
-  0x6f, 0x78, 0x70, 0x79, 0x70, 0x77, 0x6e, 0x79, 0x6c, 0x7a, 0x6b, 0x7a,
-  0x6e, 0x7b, 0x70, 0x7c, 0x6f, 0x7b, 0x70, 0x7a, 0x6b, 0x7a, 0x62, 0x7a,
-  0x5f, 0x80, 0x68, 0x7e, 0x73, 0x7c, 0x73, 0x7c, 0x6c, 0x7d, 0x70, 0x7d,
-  0x7a, 0x7d, 0x71, 0x7f, 0x68, 0x88, 0x76, 0x8a, 0x74, 0x87, 0x6a, 0x8b,
-  0x65, 0x8e, 0x5c, 0x8e, 0x5d, 0x8c, 0x62, 0x8c, 0x6a, 0x88, 0x6a, 0x82,
-  0x6b, 0x81, 0x68, 0x83, 0x66, 0x80, 0x69, 0x7b, 0x69, 0x7c, 0x69, 0x7d,
-  0x6a, 0x7e, 0x6a, 0x7f, 0x6b, 0x7d, 0x6b, 0x7c, 0x68, 0x7c, 0x64, 0x7c,
-  0x64, 0x7c, 0x64, 0x7f, 0x63, 0x82, 0x61, 0x86, 0x61, 0x87, 0x61, 0x87,
-  0x62, 0x87, 0x65, 0x87, 0x66, 0x85, 0x63, 0x85, 0x64, 0x86, 0x66, 0x86,
-  0x68, 0x86, 0x68, 0x86, 0x66, 0x85, 0x66, 0x85, 0x65, 0x85, 0x62, 0x82,
-  0x61, 0x80, 0x63, 0x7e, 0x65, 0x7f, 0x6a, 0x80, 0x70, 0x7e, 0x72, 0x7c,
-  0x74, 0x78, 0x76, 0x74, 0x77, 0x71, 0x74, 0x70, 0x70, 0x6f, 0x6b, 0x6f,
-  0x67, 0x71, 0x65, 0x72, 0x61, 0x74, 0x60, 0x77, 0x58, 0x7b, 0x51, 0x7d,
-  0x54, 0x7a, 0x5c, 0x76, 0x59, 0x76, 0x54, 0x79, 0x54, 0x7b, 0x54, 0x7d,
-  0x59, 0x7c, 0x5b, 0x7c, 0x5f, 0x7f, 0x65, 0x83, 0x67, 0x88, 0x6a, 0x8c,
-  0x69, 0x8d, 0x58, 0x8d, 0x54, 0x85, 0x58, 0x7f, 0x5d, 0x79, 0x5e, 0x78,
-  0x5c, 0x78, 0x5a, 0x77, 0x5e, 0x77, 0x63, 0x79, 0x64, 0x7b, 0x61, 0x7d,
-  0x60, 0x7c, 0x5d, 0x79, 0x5a, 0x77, 0x59, 0x76, 0x57, 0x74, 0x50, 0x71,
-  0x4d, 0x6f, 0x4c, 0x6c, 0x4b, 0x6c, 0x4c, 0x6b, 0x4f, 0x6b, 0x50, 0x6b,
-  0x51, 0x6b, 0x54, 0x6b, 0x53, 0x6d, 0x53, 0x6c, 0x54, 0x6d, 0x54, 0x6d,
-  0x54, 0x6d, 0x54, 0x6c, 0x63, 0x60, 0x5f, 0x61, 0x5d, 0x61, 0x59, 0x64,
-  0x58, 0x65, 0x56, 0x65, 0x56, 0x64, 0x57, 0x63, 0x56, 0x62, 0x56, 0x63,
-  0x54, 0x65, 0x53, 0x65, 0x53, 0x65, 0x53, 0x65, 0x53, 0x65, 0x52, 0x63,
-  0x51, 0x63, 0x51, 0x63, 0x51, 0x63, 0x50, 0x63, 0x51, 0x63, 0x51, 0x62,
-  0x54, 0x62, 0x54, 0x61, 0x54, 0x61, 0x53, 0x65, 0x53, 0x66, 0x53, 0x65,
-  0x53, 0x66, 0x53, 0x67, 0x55, 0x64, 0x5b, 0x6b, 0x60, 0x73, 0x63, 0x75,
-  0x62, 0x75, 0x64, 0x75, 0x67, 0x77, 0x69, 0x77, 0x6c, 0x77, 0x6c, 0x77,
-  0x6b, 0x77, 0x6d, 0x78, 0x6c, 0x7a, 0x6b, 0x7a, 0x6d, 0x7a, 0x6e, 0x7b,
-  0x6c, 0x7b, 0x6d, 0x7c, 0x6c, 0x7b, 0x66, 0x79, 0x61, 0x7c, 0x5d, 0x80,
-  0x68, 0x7e, 0x74, 0x7c, 0x73, 0x7c, 0x6c, 0x7d, 0x71, 0x7d, 0x76, 0x7d,
-  0x72, 0x80, 0x6a, 0x87, 0x71, 0x8b, 0x7b, 0x89, 0x7c, 0x89, 0x78, 0x8a,
-  0x72, 0x8b, 0x70, 0x8a, 0x71, 0x87, 0x71, 0x85, 0x71, 0x85, 0x6e, 0x88,
-  0x6d, 0x86, 0x6d, 0x82, 0x70, 0x83, 0x70, 0x82, 0x6f, 0x82, 0x6e, 0x81,
-  0x6c, 0x80, 0x6c, 0x80, 0x6d, 0x7f, 0x6b, 0x7d, 0x69, 0x7d, 0x66, 0x7e,
-  0x67, 0x80, 0x66, 0x83, 0x63, 0x85, 0x64, 0x85, 0x66, 0x85, 0x69, 0x85,
-  0x68, 0x83, 0x65, 0x83, 0x66, 0x84, 0x68, 0x84, 0x6c, 0x84, 0x6c, 0x84,
-  0x6a, 0x83, 0x6a, 0x82, 0x69, 0x83, 0x66, 0x81, 0x66, 0x80, 0x68, 0x83,
-  0x6e, 0x82, 0x74, 0x7c, 0x79, 0x76, 0x78, 0x73, 0x76, 0x72, 0x78, 0x74,
-  0x75, 0x72, 0x6e, 0x6e, 0x6b, 0x6f, 0x69, 0x6f, 0x65, 0x71, 0x63, 0x72,
-  0x62, 0x74, 0x60, 0x76, 0x56, 0x7d, 0x55, 0x80, 0x58, 0x7a, 0x5c, 0x74,
-  0x59, 0x76, 0x54, 0x79, 0x54, 0x7b, 0x55, 0x7d, 0x57, 0x7c, 0x5c, 0x7c,
-  0x69, 0x77, 0x73, 0x77, 0x72, 0x79, 0x6f, 0x7c, 0x6a, 0x80, 0x5a, 0x88,
-  0x53, 0x85, 0x56, 0x7f, 0x5c, 0x7a, 0x5e, 0x7b, 0x5c, 0x7b, 0x55, 0x7e,
-  0x58, 0x80, 0x62, 0x85, 0x6b, 0x8a, 0x6b, 0x89, 0x6a, 0x88, 0x68, 0x85,
-  0x65, 0x82, 0x63, 0x7f, 0x61, 0x7e, 0x5b, 0x7a, 0x56, 0x74, 0x4d, 0x6e,
-  0x48, 0x6e, 0x48, 0x6c, 0x4d, 0x6b, 0x4e, 0x6b, 0x4f, 0x6b, 0x51, 0x6b,
-  0x50, 0x6c, 0x51, 0x6d, 0x52, 0x6d, 0x52, 0x6d, 0x52, 0x6c, 0x52, 0x6c,
-  0x64, 0x61, 0x60, 0x61, 0x5d, 0x62, 0x59, 0x64, 0x58, 0x63, 0x57, 0x63,
-  0x57, 0x63, 0x57, 0x62, 0x56, 0x61, 0x56, 0x62, 0x56, 0x62, 0x55, 0x64,
-  0x53, 0x65, 0x53, 0x64, 0x53, 0x64, 0x51, 0x62, 0x51, 0x63, 0x51, 0x63,
-  0x50, 0x63, 0x50, 0x63, 0x51, 0x63, 0x51, 0x61, 0x54, 0x60, 0x54, 0x60,
-  0x53, 0x61, 0x53, 0x65, 0x53, 0x65, 0x53, 0x64, 0x54, 0x64, 0x54, 0x64,
-  0x55, 0x63, 0x58, 0x67, 0x60, 0x72, 0x63, 0x77, 0x62, 0x76, 0x63, 0x75,
-  0x67, 0x77, 0x69, 0x78, 0x68, 0x77, 0x6a, 0x76, 0x67, 0x76, 0x6a, 0x79,
-  0x6a, 0x7a, 0x6c, 0x7a, 0x6d, 0x7a, 0x6e, 0x7a, 0x6b, 0x7b, 0x69, 0x7c,
-  0x67, 0x7c, 0x69, 0x7b, 0x66, 0x7a, 0x5b, 0x7f, 0x5d, 0x82, 0x70, 0x7f,
-  0x79, 0x7c, 0x71, 0x7d, 0x65, 0x7f, 0x6a, 0x7e, 0x76, 0x7e, 0x6e, 0x84,
-  0x65, 0x8c, 0x71, 0x8a, 0x7d, 0x86, 0x7f, 0x86, 0x7f, 0x86, 0x7e, 0x85,
-  0x7e, 0x85, 0x80, 0x83, 0x7e, 0x85, 0x7e, 0x86, 0x7f, 0x84, 0x7e, 0x86,
-  0x7b, 0x86, 0x7a, 0x87, 0x79, 0x8a, 0x75, 0x8c, 0x73, 0x8b, 0x78, 0x8a,
-  0x7c, 0x88, 0x7a, 0x84, 0x76, 0x84, 0x6e, 0x82, 0x6a, 0x80, 0x67, 0x81,
-  0x64, 0x83, 0x65, 0x84, 0x6a, 0x83, 0x6d, 0x84, 0x6b, 0x82, 0x69, 0x82,
-  0x69, 0x84, 0x6a, 0x84, 0x6e, 0x81, 0x6f, 0x82, 0x6d, 0x80, 0x6d, 0x80,
-  0x6b, 0x81, 0x68, 0x82, 0x68, 0x84, 0x6d, 0x85, 0x75, 0x7d, 0x79, 0x74,
-  0x78, 0x70, 0x72, 0x71, 0x75, 0x74, 0x78, 0x76, 0x72, 0x70, 0x6c, 0x6d,
-  0x69, 0x6f, 0x67, 0x6f, 0x65, 0x71, 0x63, 0x71, 0x65, 0x73, 0x5f, 0x75,
-  0x58, 0x7f, 0x5c, 0x83, 0x5d, 0x7a, 0x5b, 0x75, 0x57, 0x77, 0x54, 0x79,
-  0x54, 0x7b, 0x56, 0x7e, 0x57, 0x7f, 0x5f, 0x7c, 0x70, 0x70, 0x7a, 0x6a,
-  0x79, 0x6a, 0x77, 0x6c, 0x73, 0x72, 0x64, 0x7e, 0x56, 0x84, 0x57, 0x81,
-  0x5b, 0x7d, 0x5b, 0x7e, 0x5b, 0x7f, 0x54, 0x81, 0x54, 0x84, 0x62, 0x8d,
-  0x6c, 0x92, 0x70, 0x91, 0x72, 0x8e, 0x71, 0x8d, 0x70, 0x89, 0x6b, 0x86,
-  0x6a, 0x86, 0x67, 0x82, 0x5f, 0x79, 0x51, 0x70, 0x48, 0x6d, 0x49, 0x6c,
-  0x4c, 0x6d, 0x4b, 0x6d, 0x4c, 0x6c, 0x4c, 0x6c, 0x4e, 0x6d, 0x4e, 0x6d,
-  0x4f, 0x6e, 0x4e, 0x6e, 0x4f, 0x6b, 0x50, 0x6c, 0x63, 0x60, 0x60, 0x60,
-  0x5d, 0x62, 0x59, 0x64, 0x58, 0x63, 0x56, 0x63, 0x56, 0x63, 0x56, 0x61,
-  0x56, 0x60, 0x56, 0x61, 0x56, 0x60, 0x56, 0x62, 0x54, 0x64, 0x53, 0x63,
-  0x53, 0x63, 0x51, 0x63, 0x51, 0x63, 0x51, 0x63, 0x50, 0x63, 0x50, 0x63,
-  0x51, 0x63, 0x52, 0x61, 0x53, 0x60, 0x54, 0x60, 0x53, 0x61, 0x52, 0x64,
-  0x52, 0x64, 0x52, 0x64, 0x54, 0x63, 0x53, 0x63, 0x53, 0x63, 0x56, 0x66,
-  0x5f, 0x70, 0x63, 0x76, 0x63, 0x75, 0x63, 0x75, 0x67, 0x77, 0x68, 0x78,
-  0x66, 0x76, 0x68, 0x75, 0x65, 0x77, 0x67, 0x7b, 0x69, 0x7c, 0x6c, 0x7b,
-  0x6d, 0x7b, 0x70, 0x7b, 0x6d, 0x7c, 0x68, 0x7d, 0x65, 0x7c, 0x69, 0x7b,
-  0x67, 0x7b, 0x66, 0x7a, 0x5d, 0x7d, 0x66, 0x81, 0x73, 0x80, 0x76, 0x7f,
-  0x6b, 0x7f, 0x65, 0x80, 0x6e, 0x81, 0x70, 0x83, 0x60, 0x8d, 0x63, 0x91,
-  0x71, 0x8d, 0x7a, 0x86, 0x7a, 0x87, 0x7a, 0x87, 0x7d, 0x84, 0x80, 0x82,
-  0x80, 0x82, 0x80, 0x81, 0x80, 0x81, 0x80, 0x83, 0x7f, 0x81, 0x7e, 0x82,
-  0x7e, 0x86, 0x7c, 0x88, 0x76, 0x8a, 0x78, 0x8a, 0x7b, 0x89, 0x7c, 0x89,
-  0x7d, 0x89, 0x7a, 0x89, 0x75, 0x87, 0x6f, 0x85, 0x69, 0x85, 0x69, 0x84,
-  0x6d, 0x82, 0x6e, 0x82, 0x6c, 0x83, 0x69, 0x83, 0x69, 0x84, 0x69, 0x84,
-  0x6a, 0x84, 0x6c, 0x83, 0x6c, 0x82, 0x6c, 0x82, 0x6a, 0x83, 0x6d, 0x7f,
-  0x70, 0x7d, 0x74, 0x78, 0x78, 0x74, 0x72, 0x75, 0x6a, 0x74, 0x68, 0x72,
-  0x72, 0x74, 0x73, 0x72, 0x6f, 0x6e, 0x6b, 0x6d, 0x67, 0x6e, 0x64, 0x6f,
-  0x63, 0x72, 0x63, 0x72, 0x63, 0x74, 0x5d, 0x76, 0x5b, 0x85, 0x5f, 0x84,
-  0x5e, 0x7b, 0x5a, 0x76, 0x57, 0x77, 0x55, 0x7a, 0x53, 0x7b, 0x55, 0x7e,
-  0x59, 0x7f, 0x64, 0x79, 0x76, 0x68, 0x80, 0x5f, 0x7e, 0x5f, 0x7e, 0x60,
-  0x79, 0x67, 0x6b, 0x76, 0x5a, 0x82, 0x58, 0x82, 0x59, 0x7f, 0x59, 0x81,
-  0x59, 0x82, 0x54, 0x81, 0x56, 0x81, 0x63, 0x89, 0x6c, 0x90, 0x6f, 0x92,
-  0x72, 0x90, 0x72, 0x90, 0x72, 0x8e, 0x71, 0x8c, 0x72, 0x8c, 0x6d, 0x86,
-  0x66, 0x7b, 0x5d, 0x6d, 0x56, 0x67, 0x54, 0x68, 0x53, 0x6a, 0x52, 0x6a,
-  0x52, 0x68, 0x52, 0x69, 0x51, 0x6a, 0x50, 0x6a, 0x50, 0x6b, 0x50, 0x6b,
-  0x50, 0x69, 0x53, 0x69, 0x62, 0x60, 0x60, 0x60, 0x5c, 0x63, 0x5a, 0x63,
-  0x59, 0x63, 0x57, 0x63, 0x57, 0x63, 0x56, 0x61, 0x56, 0x61, 0x56, 0x61,
-  0x56, 0x5f, 0x55, 0x61, 0x54, 0x62, 0x53, 0x63, 0x53, 0x63, 0x51, 0x63,
-  0x51, 0x63, 0x51, 0x63, 0x50, 0x63, 0x50, 0x63, 0x51, 0x63, 0x52, 0x61,
-  0x53, 0x60, 0x54, 0x60, 0x53, 0x61, 0x53, 0x62, 0x53, 0x62, 0x52, 0x62,
-  0x51, 0x63, 0x52, 0x63, 0x51, 0x63, 0x53, 0x66, 0x5b, 0x6f, 0x63, 0x75,
-  0x63, 0x75, 0x63, 0x75, 0x65, 0x77, 0x66, 0x77, 0x64, 0x76, 0x66, 0x75,
-  0x63, 0x78, 0x65, 0x7d, 0x66, 0x7e, 0x66, 0x7d, 0x68, 0x7d, 0x6c, 0x7d,
-  0x6a, 0x7d, 0x67, 0x7c, 0x63, 0x7c, 0x69, 0x7d, 0x6e, 0x7d, 0x6a, 0x7d,
-  0x62, 0x7e, 0x62, 0x7f, 0x6a, 0x81, 0x70, 0x81, 0x67, 0x80, 0x69, 0x80,
-  0x6a, 0x85, 0x67, 0x8a, 0x5c, 0x95, 0x61, 0x97, 0x65, 0x92, 0x68, 0x8c,
-  0x75, 0x87, 0x79, 0x85, 0x79, 0x82, 0x7a, 0x7f, 0x7e, 0x7d, 0x7f, 0x7d,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x80, 0x7c, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-  0x7d, 0x84, 0x7c, 0x84, 0x7c, 0x85, 0x7b, 0x86, 0x7c, 0x87, 0x79, 0x88,
-  0x78, 0x8a, 0x77, 0x8a, 0x71, 0x89, 0x6e, 0x89, 0x6f, 0x87, 0x6d, 0x87,
-  0x69, 0x85, 0x66, 0x85, 0x66, 0x85, 0x67, 0x85, 0x67, 0x85, 0x6a, 0x7f,
-  0x6d, 0x7c, 0x6e, 0x7c, 0x6e, 0x79, 0x72, 0x74, 0x74, 0x72, 0x75, 0x75,
-  0x76, 0x77, 0x6b, 0x79, 0x60, 0x78, 0x64, 0x76, 0x73, 0x73, 0x6f, 0x71,
-  0x6b, 0x6e, 0x67, 0x6c, 0x64, 0x6e, 0x61, 0x71, 0x62, 0x74, 0x65, 0x74,
-  0x61, 0x76, 0x5b, 0x7a, 0x5e, 0x87, 0x5e, 0x80, 0x5e, 0x7b, 0x5d, 0x77,
-  0x5f, 0x78, 0x58, 0x7a, 0x54, 0x7b, 0x57, 0x7d, 0x5d, 0x7b, 0x6c, 0x72,
-  0x7e, 0x60, 0x83, 0x57, 0x82, 0x56, 0x81, 0x56, 0x7c, 0x60, 0x6e, 0x73,
-  0x5e, 0x82, 0x5a, 0x81, 0x57, 0x80, 0x58, 0x83, 0x57, 0x84, 0x54, 0x81,
-  0x5a, 0x7e, 0x69, 0x7d, 0x72, 0x7e, 0x75, 0x83, 0x72, 0x8a, 0x71, 0x8d,
-  0x71, 0x8f, 0x73, 0x8f, 0x73, 0x8f, 0x72, 0x83, 0x71, 0x74, 0x70, 0x64,
-  0x6d, 0x5f, 0x6c, 0x60, 0x69, 0x62, 0x68, 0x63, 0x68, 0x62, 0x68, 0x63,
-  0x66, 0x64, 0x64, 0x64, 0x63, 0x65, 0x63, 0x65, 0x63, 0x65, 0x65, 0x65,
-  0x61, 0x61, 0x60, 0x60, 0x5d, 0x62, 0x5a, 0x63, 0x57, 0x63, 0x56, 0x63,
-  0x56, 0x63, 0x56, 0x62, 0x56, 0x60, 0x56, 0x60, 0x57, 0x5e, 0x56, 0x5f,
-  0x54, 0x62, 0x53, 0x62, 0x53, 0x63, 0x51, 0x64, 0x51, 0x63, 0x51, 0x63,
-  0x51, 0x63, 0x50, 0x63, 0x51, 0x63, 0x51, 0x61, 0x53, 0x60, 0x53, 0x61,
-  0x52, 0x62, 0x52, 0x62, 0x52, 0x61, 0x52, 0x62, 0x50, 0x63, 0x50, 0x64,
-  0x50, 0x65, 0x52, 0x66, 0x5a, 0x6d, 0x62, 0x74, 0x63, 0x76, 0x63, 0x76,
-  0x64, 0x77, 0x65, 0x77, 0x64, 0x76, 0x65, 0x76, 0x62, 0x79, 0x65, 0x7d,
-  0x62, 0x7d, 0x60, 0x7e, 0x62, 0x7f, 0x66, 0x80, 0x66, 0x7f, 0x66, 0x7d,
-  0x61, 0x7c, 0x69, 0x7e, 0x74, 0x81, 0x69, 0x89, 0x5f, 0x86, 0x64, 0x7e,
-  0x6c, 0x7f, 0x69, 0x7f, 0x63, 0x7f, 0x6e, 0x7e, 0x6d, 0x89, 0x6e, 0x8c,
-  0x61, 0x8e, 0x61, 0x90, 0x61, 0x8f, 0x5b, 0x90, 0x68, 0x8d, 0x70, 0x88,
-  0x7b, 0x82, 0x80, 0x7e, 0x80, 0x7e, 0x80, 0x7e, 0x7f, 0x7b, 0x7d, 0x76,
-  0x7e, 0x73, 0x80, 0x73, 0x7e, 0x76, 0x7e, 0x78, 0x80, 0x7d, 0x80, 0x7f,
-  0x7f, 0x80, 0x7d, 0x82, 0x7b, 0x83, 0x7a, 0x83, 0x7b, 0x85, 0x7b, 0x88,
-  0x76, 0x89, 0x72, 0x89, 0x70, 0x8a, 0x6d, 0x89, 0x6a, 0x86, 0x67, 0x85,
-  0x68, 0x83, 0x69, 0x82, 0x6c, 0x7f, 0x6d, 0x7a, 0x70, 0x74, 0x71, 0x73,
-  0x71, 0x70, 0x6f, 0x72, 0x6c, 0x76, 0x6c, 0x7e, 0x71, 0x80, 0x6c, 0x7c,
-  0x62, 0x7a, 0x68, 0x78, 0x71, 0x73, 0x6c, 0x71, 0x69, 0x6e, 0x65, 0x6d,
-  0x62, 0x6f, 0x60, 0x73, 0x63, 0x75, 0x67, 0x74, 0x60, 0x76, 0x5c, 0x7b,
-  0x5e, 0x82, 0x5d, 0x7c, 0x5f, 0x7b, 0x62, 0x79, 0x63, 0x78, 0x58, 0x7a,
-  0x55, 0x7c, 0x59, 0x7c, 0x62, 0x78, 0x71, 0x6f, 0x80, 0x5e, 0x83, 0x56,
-  0x82, 0x54, 0x80, 0x56, 0x7b, 0x60, 0x6e, 0x76, 0x62, 0x84, 0x5c, 0x82,
-  0x58, 0x81, 0x57, 0x84, 0x56, 0x85, 0x55, 0x81, 0x5c, 0x7c, 0x6f, 0x72,
-  0x7a, 0x6d, 0x7c, 0x72, 0x76, 0x7e, 0x75, 0x83, 0x74, 0x89, 0x72, 0x8a,
-  0x72, 0x8a, 0x76, 0x7d, 0x78, 0x6d, 0x79, 0x5f, 0x78, 0x5b, 0x79, 0x5c,
-  0x78, 0x5e, 0x77, 0x5f, 0x76, 0x5f, 0x76, 0x60, 0x76, 0x62, 0x75, 0x62,
-  0x73, 0x62, 0x73, 0x62, 0x72, 0x63, 0x74, 0x63, 0x60, 0x64, 0x60, 0x62,
-  0x5d, 0x61, 0x59, 0x63, 0x57, 0x63, 0x56, 0x63, 0x57, 0x62, 0x57, 0x62,
-  0x56, 0x60, 0x57, 0x5f, 0x57, 0x5e, 0x57, 0x5f, 0x55, 0x61, 0x54, 0x61,
-  0x53, 0x61, 0x51, 0x63, 0x51, 0x61, 0x51, 0x63, 0x51, 0x63, 0x51, 0x61,
-  0x51, 0x63, 0x51, 0x61, 0x52, 0x60, 0x51, 0x62, 0x51, 0x63, 0x50, 0x62,
-  0x4f, 0x61, 0x4f, 0x63, 0x4d, 0x65, 0x4e, 0x65, 0x53, 0x67, 0x56, 0x67,
-  0x5b, 0x6a, 0x61, 0x74, 0x64, 0x78, 0x62, 0x77, 0x62, 0x76, 0x63, 0x77,
-  0x64, 0x76, 0x63, 0x77, 0x63, 0x7a, 0x62, 0x7a, 0x60, 0x7d, 0x64, 0x84,
-  0x64, 0x83, 0x66, 0x83, 0x66, 0x82, 0x67, 0x80, 0x64, 0x7e, 0x6a, 0x80,
-  0x6d, 0x82, 0x60, 0x83, 0x64, 0x7e, 0x6d, 0x7c, 0x6d, 0x7c, 0x67, 0x7c,
-  0x6a, 0x83, 0x6a, 0x85, 0x6c, 0x93, 0x7c, 0x90, 0x71, 0x8d, 0x64, 0x8b,
-  0x5c, 0x8a, 0x57, 0x8c, 0x5a, 0x8f, 0x5d, 0x8f, 0x6a, 0x8a, 0x71, 0x84,
-  0x74, 0x83, 0x77, 0x83, 0x7b, 0x7d, 0x82, 0x6e, 0x80, 0x69, 0x80, 0x6a,
-  0x84, 0x67, 0x84, 0x64, 0x84, 0x64, 0x83, 0x68, 0x83, 0x6a, 0x84, 0x6e,
-  0x82, 0x70, 0x81, 0x73, 0x81, 0x74, 0x80, 0x75, 0x7d, 0x7b, 0x7b, 0x7e,
-  0x77, 0x7e, 0x75, 0x7d, 0x73, 0x7a, 0x71, 0x77, 0x71, 0x77, 0x72, 0x74,
-  0x72, 0x73, 0x72, 0x70, 0x74, 0x6e, 0x74, 0x71, 0x70, 0x75, 0x65, 0x79,
-  0x60, 0x7f, 0x61, 0x80, 0x66, 0x81, 0x6a, 0x7f, 0x65, 0x7c, 0x6e, 0x78,
-  0x6e, 0x72, 0x6a, 0x71, 0x67, 0x6e, 0x62, 0x6f, 0x5f, 0x72, 0x60, 0x74,
-  0x66, 0x74, 0x68, 0x72, 0x5e, 0x76, 0x5b, 0x7b, 0x5d, 0x7d, 0x5e, 0x7c,
-  0x61, 0x7b, 0x64, 0x79, 0x62, 0x78, 0x59, 0x7a, 0x58, 0x7b, 0x60, 0x78,
-  0x6c, 0x70, 0x79, 0x67, 0x82, 0x59, 0x84, 0x54, 0x83, 0x54, 0x80, 0x57,
-  0x7c, 0x63, 0x70, 0x7c, 0x67, 0x89, 0x61, 0x87, 0x5d, 0x83, 0x5a, 0x83,
-  0x58, 0x80, 0x56, 0x7d, 0x5d, 0x78, 0x74, 0x67, 0x81, 0x60, 0x84, 0x60,
-  0x81, 0x66, 0x7f, 0x6b, 0x7b, 0x73, 0x79, 0x76, 0x79, 0x75, 0x7d, 0x6c,
-  0x7f, 0x63, 0x82, 0x59, 0x83, 0x58, 0x82, 0x5a, 0x83, 0x5b, 0x82, 0x5c,
-  0x81, 0x5c, 0x80, 0x5d, 0x80, 0x60, 0x80, 0x60, 0x7f, 0x5e, 0x7f, 0x5f,
-  0x7e, 0x60, 0x7e, 0x5f, 0x60, 0x66, 0x60, 0x63, 0x5d, 0x63, 0x59, 0x65,
-  0x57, 0x64, 0x56, 0x63, 0x57, 0x62, 0x56, 0x62, 0x57, 0x60, 0x57, 0x5f,
-  0x57, 0x5e, 0x57, 0x5f, 0x55, 0x60, 0x54, 0x60, 0x54, 0x60, 0x52, 0x62,
-  0x51, 0x60, 0x51, 0x61, 0x51, 0x61, 0x51, 0x5f, 0x51, 0x62, 0x51, 0x61,
-  0x51, 0x60, 0x50, 0x62, 0x4f, 0x63, 0x4f, 0x63, 0x4d, 0x63, 0x4d, 0x64,
-  0x4f, 0x67, 0x52, 0x66, 0x58, 0x68, 0x5a, 0x67, 0x5d, 0x69, 0x63, 0x73,
-  0x64, 0x78, 0x62, 0x77, 0x60, 0x75, 0x62, 0x77, 0x63, 0x76, 0x63, 0x77,
-  0x64, 0x78, 0x61, 0x7b, 0x63, 0x81, 0x6d, 0x88, 0x6c, 0x85, 0x6a, 0x85,
-  0x67, 0x84, 0x66, 0x82, 0x66, 0x7f, 0x64, 0x80, 0x64, 0x7d, 0x67, 0x78,
-  0x6e, 0x7b, 0x70, 0x81, 0x69, 0x84, 0x68, 0x8b, 0x6b, 0x96, 0x68, 0x99,
-  0x68, 0x9d, 0x7a, 0x98, 0x7a, 0x94, 0x6e, 0x8e, 0x62, 0x8c, 0x5a, 0x88,
-  0x60, 0x87, 0x62, 0x87, 0x61, 0x86, 0x60, 0x86, 0x60, 0x86, 0x63, 0x86,
-  0x68, 0x84, 0x7e, 0x6c, 0x85, 0x60, 0x84, 0x63, 0x8d, 0x5f, 0x8e, 0x5b,
-  0x8c, 0x56, 0x89, 0x57, 0x88, 0x5a, 0x89, 0x5a, 0x8a, 0x5a, 0x88, 0x5b,
-  0x88, 0x5a, 0x88, 0x58, 0x85, 0x5e, 0x83, 0x64, 0x80, 0x68, 0x7d, 0x68,
-  0x77, 0x6b, 0x74, 0x69, 0x75, 0x6a, 0x76, 0x67, 0x79, 0x64, 0x79, 0x68,
-  0x79, 0x77, 0x79, 0x7d, 0x72, 0x7e, 0x62, 0x7a, 0x60, 0x7d, 0x5e, 0x7e,
-  0x5f, 0x7e, 0x63, 0x7e, 0x6b, 0x7e, 0x73, 0x79, 0x6d, 0x70, 0x69, 0x6f,
-  0x65, 0x70, 0x5f, 0x71, 0x5e, 0x73, 0x61, 0x74, 0x68, 0x70, 0x66, 0x71,
-  0x5d, 0x76, 0x5b, 0x7a, 0x5d, 0x7c, 0x60, 0x7b, 0x62, 0x7b, 0x64, 0x79,
-  0x62, 0x78, 0x5c, 0x78, 0x60, 0x77, 0x68, 0x74, 0x75, 0x6b, 0x7f, 0x5f,
-  0x85, 0x54, 0x84, 0x53, 0x83, 0x54, 0x80, 0x58, 0x7d, 0x66, 0x70, 0x7f,
-  0x69, 0x8e, 0x67, 0x8c, 0x62, 0x87, 0x5f, 0x82, 0x5c, 0x7e, 0x59, 0x7b,
-  0x60, 0x78, 0x76, 0x66, 0x83, 0x5c, 0x87, 0x56, 0x88, 0x57, 0x86, 0x59,
-  0x83, 0x5d, 0x82, 0x60, 0x82, 0x60, 0x84, 0x5c, 0x86, 0x58, 0x88, 0x54,
-  0x89, 0x54, 0x89, 0x56, 0x89, 0x57, 0x89, 0x58, 0x89, 0x59, 0x88, 0x59,
-  0x87, 0x5a, 0x87, 0x5b, 0x87, 0x5b, 0x87, 0x5b, 0x86, 0x5b, 0x86, 0x5a,
-  0x60, 0x67, 0x5f, 0x65, 0x5c, 0x64, 0x59, 0x66, 0x57, 0x65, 0x56, 0x63,
-  0x56, 0x62, 0x56, 0x62, 0x57, 0x61, 0x57, 0x5f, 0x57, 0x5e, 0x57, 0x5e,
-  0x56, 0x5f, 0x55, 0x5e, 0x54, 0x5f, 0x52, 0x60, 0x52, 0x5f, 0x51, 0x5f,
-  0x51, 0x5f, 0x51, 0x5f, 0x51, 0x61, 0x52, 0x60, 0x51, 0x60, 0x4f, 0x62,
-  0x4d, 0x63, 0x4c, 0x65, 0x4d, 0x65, 0x4f, 0x65, 0x56, 0x67, 0x5a, 0x67,
-  0x5c, 0x67, 0x5e, 0x67, 0x5f, 0x68, 0x64, 0x71, 0x64, 0x77, 0x62, 0x77,
-  0x5e, 0x76, 0x5f, 0x78, 0x62, 0x77, 0x63, 0x78, 0x61, 0x78, 0x62, 0x7c,
-  0x68, 0x83, 0x73, 0x87, 0x71, 0x83, 0x6d, 0x85, 0x6b, 0x84, 0x6a, 0x82,
-  0x6c, 0x81, 0x6f, 0x82, 0x71, 0x82, 0x74, 0x87, 0x72, 0x8e, 0x6e, 0x93,
-  0x6b, 0x97, 0x6d, 0x9b, 0x6c, 0xa0, 0x6b, 0xa3, 0x67, 0xa4, 0x70, 0x9e,
-  0x76, 0x98, 0x73, 0x91, 0x6d, 0x8e, 0x67, 0x87, 0x69, 0x85, 0x6a, 0x86,
-  0x67, 0x8a, 0x67, 0x8d, 0x67, 0x8a, 0x69, 0x8a, 0x6a, 0x8b, 0x7c, 0x6e,
-  0x86, 0x5d, 0x87, 0x5f, 0x8d, 0x5b, 0x8f, 0x56, 0x8e, 0x51, 0x8b, 0x52,
-  0x89, 0x56, 0x8a, 0x56, 0x8c, 0x54, 0x8f, 0x51, 0x8f, 0x51, 0x8e, 0x50,
-  0x8b, 0x52, 0x88, 0x55, 0x84, 0x5b, 0x81, 0x5e, 0x7f, 0x61, 0x80, 0x5e,
-  0x84, 0x58, 0x86, 0x55, 0x87, 0x54, 0x81, 0x67, 0x7c, 0x81, 0x7b, 0x82,
-  0x77, 0x80, 0x65, 0x78, 0x62, 0x7a, 0x60, 0x7d, 0x5d, 0x7d, 0x5d, 0x7e,
-  0x6d, 0x7e, 0x74, 0x79, 0x6b, 0x70, 0x68, 0x6f, 0x63, 0x72, 0x5e, 0x72,
-  0x5d, 0x74, 0x62, 0x73, 0x68, 0x6e, 0x64, 0x71, 0x5b, 0x77, 0x59, 0x79,
-  0x5d, 0x7a, 0x61, 0x7a, 0x63, 0x7b, 0x64, 0x79, 0x61, 0x77, 0x60, 0x76,
-  0x64, 0x77, 0x6c, 0x73, 0x7d, 0x65, 0x86, 0x57, 0x87, 0x51, 0x85, 0x51,
-  0x83, 0x55, 0x80, 0x58, 0x7c, 0x63, 0x71, 0x7d, 0x6b, 0x91, 0x6b, 0x90,
-  0x67, 0x8c, 0x64, 0x87, 0x60, 0x82, 0x5d, 0x80, 0x61, 0x7c, 0x71, 0x6c,
-  0x7e, 0x5f, 0x85, 0x59, 0x89, 0x56, 0x8a, 0x56, 0x88, 0x57, 0x88, 0x59,
-  0x88, 0x59, 0x89, 0x55, 0x8b, 0x55, 0x8b, 0x53, 0x8b, 0x52, 0x8a, 0x53,
-  0x8a, 0x54, 0x8a, 0x55, 0x8b, 0x56, 0x8b, 0x57, 0x8b, 0x58, 0x8b, 0x58,
-  0x8a, 0x5a, 0x89, 0x59, 0x89, 0x57, 0x88, 0x57, 0x61, 0x68, 0x5d, 0x65,
-  0x5b, 0x65, 0x58, 0x65, 0x56, 0x66, 0x55, 0x64, 0x56, 0x63, 0x56, 0x62,
-  0x57, 0x60, 0x58, 0x5f, 0x58, 0x5d, 0x58, 0x5d, 0x57, 0x5d, 0x56, 0x5e,
-  0x55, 0x5d, 0x52, 0x60, 0x53, 0x60, 0x53, 0x5f, 0x53, 0x5d, 0x53, 0x5f,
-  0x51, 0x62, 0x51, 0x61, 0x50, 0x61, 0x4e, 0x61, 0x4b, 0x62, 0x4c, 0x65,
-  0x51, 0x66, 0x57, 0x66, 0x5d, 0x67, 0x5e, 0x68, 0x5e, 0x67, 0x61, 0x67,
-  0x61, 0x68, 0x63, 0x6f, 0x64, 0x75, 0x62, 0x77, 0x5c, 0x77, 0x5d, 0x78,
-  0x62, 0x77, 0x62, 0x79, 0x60, 0x7a, 0x63, 0x7d, 0x6d, 0x83, 0x74, 0x86,
-  0x70, 0x87, 0x6e, 0x8a, 0x77, 0x8b, 0x7c, 0x88, 0x79, 0x89, 0x7b, 0x8d,
-  0x78, 0x93, 0x72, 0x97, 0x6f, 0x99, 0x6f, 0x9c, 0x6f, 0x9d, 0x71, 0x9e,
-  0x70, 0xa2, 0x6e, 0xa4, 0x6b, 0xa4, 0x71, 0x9f, 0x76, 0x9a, 0x73, 0x95,
-  0x6f, 0x93, 0x6e, 0x8d, 0x6e, 0x8d, 0x6e, 0x8f, 0x71, 0x90, 0x71, 0x91,
-  0x70, 0x8e, 0x71, 0x8c, 0x72, 0x8b, 0x7b, 0x6f, 0x85, 0x5c, 0x87, 0x5d,
-  0x8b, 0x5b, 0x8d, 0x56, 0x90, 0x50, 0x8f, 0x4f, 0x8b, 0x53, 0x8a, 0x58,
-  0x8c, 0x56, 0x90, 0x50, 0x93, 0x4d, 0x93, 0x4b, 0x91, 0x49, 0x8e, 0x4b,
-  0x87, 0x59, 0x81, 0x63, 0x80, 0x68, 0x85, 0x5f, 0x8c, 0x50, 0x8c, 0x4f,
-  0x8d, 0x50, 0x88, 0x5d, 0x7b, 0x80, 0x7b, 0x80, 0x79, 0x80, 0x6d, 0x7b,
-  0x63, 0x79, 0x63, 0x7d, 0x61, 0x7d, 0x5d, 0x7d, 0x6c, 0x7f, 0x70, 0x7a,
-  0x68, 0x72, 0x67, 0x70, 0x62, 0x73, 0x5d, 0x73, 0x5e, 0x73, 0x66, 0x71,
-  0x67, 0x6e, 0x61, 0x72, 0x5b, 0x78, 0x59, 0x79, 0x5f, 0x78, 0x63, 0x79,
-  0x63, 0x79, 0x62, 0x79, 0x62, 0x77, 0x63, 0x75, 0x65, 0x7b, 0x6f, 0x75,
-  0x84, 0x5b, 0x8a, 0x4f, 0x87, 0x50, 0x87, 0x50, 0x83, 0x55, 0x80, 0x59,
-  0x7d, 0x5d, 0x76, 0x77, 0x6e, 0x90, 0x6e, 0x92, 0x6e, 0x8f, 0x6c, 0x8b,
-  0x69, 0x88, 0x63, 0x87, 0x60, 0x84, 0x66, 0x79, 0x71, 0x6e, 0x7c, 0x62,
-  0x88, 0x57, 0x8b, 0x53, 0x8b, 0x53, 0x8c, 0x54, 0x8c, 0x52, 0x8d, 0x50,
-  0x8d, 0x52, 0x8c, 0x53, 0x8d, 0x52, 0x8c, 0x52, 0x8c, 0x53, 0x8c, 0x54,
-  0x8c, 0x54, 0x8c, 0x55, 0x8d, 0x56, 0x8c, 0x56, 0x8c, 0x57, 0x8c, 0x57,
-  0x8c, 0x56, 0x8d, 0x56, 0x64, 0x68, 0x5d, 0x65, 0x5b, 0x65, 0x58, 0x65,
-  0x56, 0x65, 0x55, 0x64, 0x56, 0x63, 0x57, 0x62, 0x57, 0x60, 0x58, 0x5e,
-  0x58, 0x5c, 0x58, 0x5d, 0x57, 0x5d, 0x56, 0x5d, 0x55, 0x5c, 0x52, 0x60,
-  0x53, 0x61, 0x53, 0x5f, 0x53, 0x5c, 0x53, 0x5e, 0x51, 0x61, 0x50, 0x61,
-  0x4e, 0x60, 0x4c, 0x61, 0x4b, 0x62, 0x4f, 0x65, 0x55, 0x65, 0x5a, 0x66,
-  0x5d, 0x68, 0x5f, 0x6a, 0x60, 0x69, 0x62, 0x69, 0x62, 0x69, 0x64, 0x6d,
-  0x64, 0x72, 0x62, 0x76, 0x5e, 0x77, 0x5e, 0x77, 0x63, 0x77, 0x61, 0x79,
-  0x5f, 0x7a, 0x62, 0x7d, 0x6c, 0x83, 0x75, 0x80, 0x70, 0x88, 0x6e, 0x91,
-  0x76, 0x93, 0x7b, 0x91, 0x79, 0x91, 0x79, 0x93, 0x76, 0x97, 0x72, 0x97,
-  0x71, 0x99, 0x70, 0x9c, 0x70, 0x9c, 0x71, 0x9d, 0x70, 0xa0, 0x6e, 0xa2,
-  0x6b, 0xa3, 0x72, 0x9c, 0x77, 0x98, 0x75, 0x96, 0x71, 0x96, 0x70, 0x93,
-  0x72, 0x92, 0x73, 0x92, 0x77, 0x8e, 0x76, 0x8f, 0x73, 0x8e, 0x73, 0x8c,
-  0x75, 0x89, 0x7b, 0x6f, 0x83, 0x5d, 0x85, 0x5b, 0x87, 0x5e, 0x88, 0x5a,
-  0x8d, 0x53, 0x8f, 0x4f, 0x8d, 0x50, 0x8b, 0x55, 0x8b, 0x57, 0x8e, 0x53,
-  0x93, 0x4c, 0x95, 0x49, 0x95, 0x44, 0x95, 0x44, 0x8c, 0x51, 0x82, 0x60,
-  0x80, 0x67, 0x87, 0x5a, 0x8e, 0x4a, 0x8b, 0x50, 0x8c, 0x51, 0x8a, 0x56,
-  0x7b, 0x7c, 0x7a, 0x81, 0x7a, 0x80, 0x72, 0x7b, 0x67, 0x79, 0x64, 0x7b,
-  0x62, 0x7c, 0x5f, 0x7d, 0x6c, 0x7e, 0x6c, 0x7a, 0x65, 0x72, 0x65, 0x72,
-  0x62, 0x74, 0x5e, 0x74, 0x60, 0x74, 0x67, 0x71, 0x65, 0x6e, 0x61, 0x71,
-  0x5b, 0x78, 0x5a, 0x78, 0x60, 0x77, 0x64, 0x77, 0x63, 0x78, 0x63, 0x78,
-  0x63, 0x78, 0x63, 0x7a, 0x65, 0x80, 0x72, 0x74, 0x86, 0x54, 0x89, 0x4c,
-  0x87, 0x4f, 0x87, 0x4f, 0x84, 0x52, 0x82, 0x59, 0x81, 0x57, 0x7a, 0x6d,
-  0x70, 0x8c, 0x6f, 0x92, 0x71, 0x90, 0x71, 0x8d, 0x71, 0x8d, 0x69, 0x8d,
-  0x63, 0x8b, 0x63, 0x84, 0x68, 0x7e, 0x74, 0x6c, 0x86, 0x58, 0x8b, 0x52,
-  0x8b, 0x52, 0x8c, 0x53, 0x8c, 0x51, 0x8d, 0x4f, 0x8d, 0x51, 0x8c, 0x52,
-  0x8d, 0x52, 0x8d, 0x53, 0x8c, 0x53, 0x8c, 0x53, 0x8c, 0x52, 0x8c, 0x53,
-  0x8d, 0x55, 0x8c, 0x55, 0x8d, 0x56, 0x8d, 0x55, 0x8c, 0x54, 0x8c, 0x54,
-  0x67, 0x68, 0x5e, 0x66, 0x59, 0x65, 0x58, 0x64, 0x56, 0x65, 0x55, 0x64,
-  0x55, 0x63, 0x56, 0x62, 0x57, 0x5e, 0x58, 0x5c, 0x58, 0x5c, 0x58, 0x5d,
-  0x57, 0x5d, 0x56, 0x5a, 0x55, 0x5a, 0x53, 0x5f, 0x53, 0x60, 0x53, 0x5f,
-  0x53, 0x5c, 0x52, 0x5c, 0x50, 0x60, 0x4f, 0x61, 0x4d, 0x61, 0x4a, 0x62,
-  0x4b, 0x63, 0x54, 0x64, 0x5b, 0x65, 0x5e, 0x67, 0x60, 0x6a, 0x61, 0x6b,
-  0x62, 0x6a, 0x63, 0x6a, 0x64, 0x6b, 0x66, 0x6b, 0x64, 0x6e, 0x63, 0x76,
-  0x5f, 0x78, 0x60, 0x77, 0x65, 0x77, 0x60, 0x7a, 0x5c, 0x7b, 0x63, 0x7c,
-  0x6f, 0x7f, 0x7d, 0x77, 0x7c, 0x7e, 0x74, 0x90, 0x75, 0x91, 0x76, 0x91,
-  0x77, 0x92, 0x77, 0x93, 0x75, 0x95, 0x74, 0x96, 0x73, 0x97, 0x72, 0x98,
-  0x72, 0x98, 0x72, 0x9b, 0x70, 0x9e, 0x6f, 0xa0, 0x6b, 0xa0, 0x71, 0x9a,
-  0x79, 0x96, 0x7a, 0x95, 0x7a, 0x92, 0x77, 0x94, 0x76, 0x93, 0x76, 0x90,
-  0x78, 0x8d, 0x78, 0x8d, 0x78, 0x8e, 0x77, 0x8c, 0x79, 0x87, 0x7b, 0x6f,
-  0x81, 0x5f, 0x84, 0x59, 0x83, 0x60, 0x83, 0x60, 0x89, 0x57, 0x8e, 0x4f,
-  0x91, 0x4b, 0x8f, 0x4d, 0x8c, 0x51, 0x8b, 0x55, 0x91, 0x4e, 0x97, 0x46,
-  0x9a, 0x40, 0x9c, 0x3d, 0x93, 0x45, 0x86, 0x58, 0x80, 0x64, 0x8c, 0x52,
-  0x93, 0x42, 0x8c, 0x4e, 0x8c, 0x51, 0x8d, 0x4f, 0x7c, 0x75, 0x7a, 0x81,
-  0x7a, 0x7f, 0x77, 0x7c, 0x6e, 0x78, 0x63, 0x79, 0x61, 0x7b, 0x60, 0x7d,
-  0x6b, 0x7e, 0x67, 0x7a, 0x62, 0x73, 0x62, 0x73, 0x61, 0x76, 0x5f, 0x76,
-  0x62, 0x75, 0x68, 0x71, 0x64, 0x6f, 0x61, 0x72, 0x5a, 0x78, 0x5d, 0x77,
-  0x62, 0x75, 0x63, 0x76, 0x63, 0x77, 0x65, 0x77, 0x65, 0x79, 0x64, 0x81,
-  0x66, 0x84, 0x77, 0x73, 0x88, 0x51, 0x89, 0x4d, 0x87, 0x4e, 0x88, 0x4d,
-  0x86, 0x4f, 0x83, 0x58, 0x85, 0x55, 0x80, 0x5e, 0x73, 0x80, 0x71, 0x8c,
-  0x70, 0x8e, 0x72, 0x8f, 0x73, 0x91, 0x71, 0x8f, 0x6e, 0x8e, 0x6a, 0x8d,
-  0x69, 0x8d, 0x72, 0x78, 0x87, 0x57, 0x8b, 0x50, 0x8a, 0x50, 0x8c, 0x52,
-  0x8c, 0x4f, 0x8d, 0x4e, 0x8d, 0x4f, 0x8d, 0x52, 0x8d, 0x53, 0x8d, 0x52,
-  0x8d, 0x53, 0x8d, 0x53, 0x8d, 0x52, 0x8c, 0x52, 0x8d, 0x53, 0x8c, 0x52,
-  0x8d, 0x54, 0x8d, 0x54, 0x8c, 0x53, 0x8c, 0x53, 0x68, 0x68, 0x61, 0x68,
-  0x58, 0x66, 0x56, 0x64, 0x55, 0x65, 0x54, 0x65, 0x53, 0x64, 0x55, 0x62,
-  0x56, 0x5e, 0x57, 0x5d, 0x57, 0x5d, 0x56, 0x5e, 0x56, 0x5d, 0x56, 0x5a,
-  0x55, 0x5a, 0x54, 0x5e, 0x54, 0x5d, 0x52, 0x5f, 0x53, 0x5c, 0x52, 0x5b,
-  0x50, 0x61, 0x4d, 0x62, 0x4b, 0x63, 0x49, 0x65, 0x4f, 0x65, 0x5b, 0x64,
-  0x5e, 0x65, 0x61, 0x68, 0x63, 0x6a, 0x63, 0x6a, 0x64, 0x6b, 0x64, 0x6a,
-  0x66, 0x6b, 0x65, 0x6a, 0x65, 0x6d, 0x65, 0x73, 0x61, 0x78, 0x60, 0x79,
-  0x63, 0x79, 0x5e, 0x7b, 0x5f, 0x7a, 0x71, 0x77, 0x7f, 0x75, 0x84, 0x73,
-  0x80, 0x7a, 0x76, 0x91, 0x75, 0x90, 0x76, 0x8f, 0x78, 0x91, 0x79, 0x91,
-  0x77, 0x93, 0x76, 0x95, 0x76, 0x96, 0x74, 0x97, 0x74, 0x98, 0x73, 0x98,
-  0x71, 0x9b, 0x6e, 0x9f, 0x6a, 0x96, 0x6d, 0x9b, 0x79, 0x97, 0x7b, 0x93,
-  0x7a, 0x91, 0x77, 0x93, 0x76, 0x94, 0x76, 0x92, 0x78, 0x8f, 0x78, 0x8d,
-  0x7a, 0x8c, 0x79, 0x8b, 0x79, 0x84, 0x7b, 0x6c, 0x7f, 0x61, 0x84, 0x58,
-  0x83, 0x5b, 0x82, 0x5f, 0x88, 0x57, 0x8e, 0x4c, 0x95, 0x47, 0x95, 0x46,
-  0x91, 0x49, 0x8c, 0x52, 0x8e, 0x52, 0x97, 0x47, 0x9d, 0x3e, 0x9c, 0x3b,
-  0x9a, 0x3f, 0x8d, 0x4b, 0x82, 0x5f, 0x8f, 0x4d, 0x98, 0x3d, 0x8e, 0x4b,
-  0x8b, 0x52, 0x8e, 0x4b, 0x7f, 0x6d, 0x7a, 0x7e, 0x7b, 0x7f, 0x7b, 0x7d,
-  0x74, 0x7c, 0x64, 0x7a, 0x61, 0x7a, 0x5f, 0x7e, 0x69, 0x7f, 0x63, 0x7b,
-  0x60, 0x74, 0x60, 0x74, 0x5f, 0x75, 0x60, 0x75, 0x65, 0x73, 0x68, 0x70,
-  0x64, 0x71, 0x60, 0x73, 0x5b, 0x77, 0x62, 0x76, 0x63, 0x74, 0x63, 0x74,
-  0x64, 0x75, 0x67, 0x78, 0x68, 0x7d, 0x67, 0x86, 0x6c, 0x82, 0x7c, 0x6d,
-  0x87, 0x50, 0x87, 0x4e, 0x87, 0x4f, 0x89, 0x4d, 0x86, 0x4f, 0x83, 0x57,
-  0x85, 0x55, 0x85, 0x56, 0x7a, 0x72, 0x75, 0x83, 0x71, 0x8b, 0x72, 0x8e,
-  0x72, 0x91, 0x72, 0x91, 0x72, 0x90, 0x6f, 0x92, 0x6f, 0x8e, 0x77, 0x77,
-  0x86, 0x53, 0x8a, 0x4d, 0x8b, 0x4e, 0x8c, 0x50, 0x8c, 0x50, 0x8e, 0x4e,
-  0x8e, 0x50, 0x8d, 0x52, 0x8e, 0x54, 0x8e, 0x53, 0x8e, 0x53, 0x8d, 0x52,
-  0x8d, 0x51, 0x8d, 0x51, 0x8d, 0x50, 0x8d, 0x4f, 0x8d, 0x52, 0x8c, 0x54,
-  0x8b, 0x54, 0x8b, 0x53, 0x68, 0x68, 0x61, 0x68, 0x58, 0x68, 0x55, 0x65,
-  0x54, 0x65, 0x53, 0x66, 0x53, 0x64, 0x55, 0x62, 0x56, 0x60, 0x57, 0x5f,
-  0x57, 0x5d, 0x57, 0x5e, 0x56, 0x5d, 0x56, 0x5c, 0x55, 0x5c, 0x54, 0x5e,
-  0x54, 0x5d, 0x53, 0x5e, 0x53, 0x5d, 0x52, 0x5d, 0x50, 0x60, 0x4d, 0x61,
-  0x4b, 0x63, 0x4e, 0x65, 0x54, 0x65, 0x5d, 0x65, 0x60, 0x66, 0x63, 0x69,
-  0x64, 0x6a, 0x64, 0x6a, 0x65, 0x6a, 0x66, 0x6b, 0x67, 0x6b, 0x67, 0x6b,
-  0x66, 0x6e, 0x66, 0x70, 0x62, 0x78, 0x60, 0x78, 0x68, 0x76, 0x6f, 0x72,
-  0x79, 0x72, 0x82, 0x73, 0x85, 0x73, 0x85, 0x73, 0x82, 0x76, 0x7b, 0x88,
-  0x77, 0x91, 0x78, 0x90, 0x78, 0x8d, 0x7a, 0x8e, 0x77, 0x92, 0x76, 0x97,
-  0x76, 0x97, 0x75, 0x96, 0x75, 0x97, 0x73, 0x98, 0x6f, 0x96, 0x70, 0x8d,
-  0x76, 0x7c, 0x79, 0x85, 0x7b, 0x8e, 0x78, 0x97, 0x77, 0x97, 0x75, 0x96,
-  0x75, 0x95, 0x76, 0x93, 0x78, 0x90, 0x78, 0x8f, 0x79, 0x8c, 0x7b, 0x81,
-  0x7c, 0x71, 0x7e, 0x65, 0x80, 0x65, 0x83, 0x5b, 0x88, 0x51, 0x87, 0x57,
-  0x8a, 0x55, 0x92, 0x48, 0x98, 0x42, 0x99, 0x3f, 0x97, 0x41, 0x92, 0x4c,
-  0x8e, 0x52, 0x94, 0x4b, 0x9d, 0x3f, 0x9d, 0x3c, 0x9c, 0x41, 0x98, 0x40,
-  0x88, 0x56, 0x90, 0x49, 0x9a, 0x38, 0x8f, 0x47, 0x8a, 0x52, 0x90, 0x49,
-  0x84, 0x64, 0x7d, 0x77, 0x7c, 0x7e, 0x7c, 0x7d, 0x78, 0x7e, 0x69, 0x7b,
-  0x64, 0x7b, 0x5f, 0x7f, 0x66, 0x7f, 0x60, 0x7b, 0x5e, 0x75, 0x5f, 0x74,
-  0x62, 0x75, 0x64, 0x74, 0x67, 0x72, 0x67, 0x70, 0x64, 0x71, 0x5f, 0x74,
-  0x5e, 0x78, 0x63, 0x76, 0x63, 0x74, 0x63, 0x74, 0x65, 0x75, 0x68, 0x7b,
-  0x6a, 0x82, 0x6e, 0x82, 0x78, 0x77, 0x82, 0x61, 0x87, 0x51, 0x87, 0x50,
-  0x87, 0x4f, 0x89, 0x4d, 0x87, 0x4e, 0x83, 0x56, 0x86, 0x55, 0x86, 0x50,
-  0x84, 0x58, 0x7c, 0x6e, 0x74, 0x84, 0x72, 0x8a, 0x72, 0x8e, 0x72, 0x8e,
-  0x71, 0x8d, 0x73, 0x8c, 0x75, 0x84, 0x7d, 0x6b, 0x88, 0x50, 0x8a, 0x4e,
-  0x8b, 0x4e, 0x8c, 0x4e, 0x8c, 0x4e, 0x8d, 0x4d, 0x8e, 0x4f, 0x8d, 0x51,
-  0x8d, 0x53, 0x8e, 0x52, 0x8e, 0x51, 0x8e, 0x51, 0x8e, 0x50, 0x8e, 0x50,
-  0x8e, 0x4f, 0x8e, 0x4d, 0x8e, 0x4e, 0x8e, 0x52, 0x8c, 0x52, 0x8c, 0x52,
-  0x67, 0x68, 0x61, 0x68, 0x59, 0x6a, 0x53, 0x67, 0x52, 0x66, 0x51, 0x66,
-  0x52, 0x64, 0x54, 0x61, 0x56, 0x61, 0x56, 0x61, 0x56, 0x5e, 0x57, 0x5d,
-  0x56, 0x5d, 0x55, 0x5e, 0x55, 0x5e, 0x54, 0x5e, 0x54, 0x5e, 0x54, 0x5c,
-  0x53, 0x5f, 0x52, 0x60, 0x4f, 0x5f, 0x4c, 0x60, 0x4e, 0x63, 0x56, 0x65,
-  0x5b, 0x65, 0x5f, 0x66, 0x63, 0x68, 0x65, 0x6a, 0x65, 0x6a, 0x66, 0x6a,
-  0x67, 0x6b, 0x67, 0x6b, 0x67, 0x6b, 0x68, 0x6b, 0x69, 0x6d, 0x6b, 0x6d,
-  0x72, 0x71, 0x75, 0x71, 0x81, 0x70, 0x86, 0x70, 0x87, 0x71, 0x85, 0x75,
-  0x85, 0x76, 0x85, 0x77, 0x84, 0x77, 0x81, 0x7c, 0x7a, 0x89, 0x79, 0x8e,
-  0x79, 0x8d, 0x7a, 0x8e, 0x77, 0x90, 0x74, 0x95, 0x75, 0x93, 0x77, 0x8f,
-  0x79, 0x89, 0x7d, 0x82, 0x82, 0x77, 0x84, 0x6f, 0x8a, 0x68, 0x8b, 0x6a,
-  0x88, 0x72, 0x7c, 0x82, 0x78, 0x89, 0x76, 0x90, 0x75, 0x95, 0x75, 0x93,
-  0x78, 0x8e, 0x79, 0x89, 0x7d, 0x77, 0x83, 0x5d, 0x87, 0x51, 0x8b, 0x4f,
-  0x85, 0x5a, 0x82, 0x5f, 0x91, 0x4c, 0x94, 0x4b, 0x90, 0x50, 0x99, 0x42,
-  0x9d, 0x3e, 0x9c, 0x3d, 0x9d, 0x3c, 0x99, 0x41, 0x90, 0x4b, 0x90, 0x4d,
-  0x9d, 0x41, 0xa0, 0x3a, 0x9b, 0x41, 0x9b, 0x48, 0x91, 0x48, 0x90, 0x49,
-  0x9b, 0x39, 0x91, 0x46, 0x8b, 0x52, 0x93, 0x47, 0x8a, 0x58, 0x80, 0x6d,
-  0x7d, 0x7b, 0x7e, 0x7d, 0x7c, 0x7e, 0x6f, 0x7e, 0x68, 0x7c, 0x60, 0x7e,
-  0x63, 0x7f, 0x5b, 0x7b, 0x5a, 0x75, 0x5f, 0x75, 0x68, 0x74, 0x6a, 0x71,
-  0x69, 0x6f, 0x65, 0x6f, 0x62, 0x71, 0x5d, 0x76, 0x62, 0x79, 0x63, 0x77,
-  0x63, 0x74, 0x65, 0x74, 0x67, 0x75, 0x6a, 0x7b, 0x6e, 0x7f, 0x7a, 0x70,
-  0x87, 0x5e, 0x89, 0x52, 0x87, 0x52, 0x87, 0x52, 0x87, 0x4e, 0x89, 0x4c,
-  0x89, 0x4c, 0x86, 0x53, 0x88, 0x54, 0x88, 0x52, 0x8a, 0x4a, 0x87, 0x54,
-  0x80, 0x6b, 0x7b, 0x76, 0x79, 0x7f, 0x79, 0x83, 0x78, 0x82, 0x7a, 0x7d,
-  0x7e, 0x71, 0x85, 0x59, 0x8a, 0x4d, 0x8a, 0x4e, 0x8a, 0x4d, 0x8d, 0x4c,
-  0x8c, 0x4c, 0x8d, 0x4b, 0x8e, 0x4c, 0x8d, 0x4e, 0x8e, 0x51, 0x8e, 0x50,
-  0x8d, 0x4f, 0x8e, 0x4e, 0x90, 0x4d, 0x90, 0x4e, 0x90, 0x4c, 0x90, 0x4a,
-  0x90, 0x4b, 0x90, 0x4e, 0x8f, 0x50, 0x8f, 0x4f, 0x66, 0x6a, 0x60, 0x6a,
-  0x5b, 0x69, 0x52, 0x68, 0x51, 0x67, 0x51, 0x65, 0x51, 0x64, 0x53, 0x62,
-  0x55, 0x60, 0x55, 0x60, 0x56, 0x60, 0x57, 0x5d, 0x56, 0x5d, 0x55, 0x5e,
-  0x55, 0x5e, 0x54, 0x5f, 0x53, 0x5f, 0x54, 0x5c, 0x53, 0x5e, 0x52, 0x5e,
-  0x4f, 0x5e, 0x4d, 0x61, 0x51, 0x64, 0x5b, 0x65, 0x5f, 0x66, 0x62, 0x69,
-  0x65, 0x6a, 0x67, 0x6a, 0x66, 0x6b, 0x66, 0x6b, 0x69, 0x6d, 0x67, 0x6b,
-  0x68, 0x6a, 0x70, 0x6a, 0x77, 0x68, 0x7d, 0x6a, 0x85, 0x6e, 0x86, 0x6f,
-  0x86, 0x72, 0x85, 0x72, 0x85, 0x76, 0x85, 0x78, 0x84, 0x78, 0x84, 0x79,
-  0x84, 0x79, 0x84, 0x73, 0x80, 0x7b, 0x7a, 0x89, 0x77, 0x8f, 0x78, 0x90,
-  0x76, 0x90, 0x77, 0x8c, 0x7c, 0x86, 0x81, 0x79, 0x87, 0x71, 0x8b, 0x6d,
-  0x8d, 0x6c, 0x8c, 0x6e, 0x8a, 0x6e, 0x8a, 0x6d, 0x8a, 0x6b, 0x87, 0x6b,
-  0x85, 0x6b, 0x83, 0x6e, 0x7d, 0x7b, 0x7d, 0x7a, 0x7c, 0x70, 0x7f, 0x67,
-  0x86, 0x57, 0x8d, 0x4a, 0x93, 0x47, 0x98, 0x47, 0x92, 0x47, 0x89, 0x58,
-  0x92, 0x4e, 0x9a, 0x4b, 0x95, 0x4f, 0x9c, 0x42, 0x9d, 0x43, 0x9d, 0x45,
-  0x9d, 0x41, 0x9b, 0x3b, 0x94, 0x42, 0x91, 0x4c, 0x98, 0x46, 0x9f, 0x3b,
-  0xa0, 0x3b, 0x99, 0x51, 0x97, 0x42, 0x8f, 0x49, 0x99, 0x3d, 0x95, 0x42,
-  0x8b, 0x51, 0x93, 0x46, 0x8d, 0x4f, 0x83, 0x63, 0x7f, 0x75, 0x7e, 0x7e,
-  0x7d, 0x7e, 0x74, 0x80, 0x6a, 0x7d, 0x63, 0x7e, 0x60, 0x7f, 0x59, 0x7a,
-  0x5a, 0x77, 0x61, 0x76, 0x69, 0x72, 0x6d, 0x6e, 0x69, 0x6c, 0x64, 0x70,
-  0x60, 0x73, 0x5c, 0x78, 0x62, 0x78, 0x64, 0x76, 0x63, 0x73, 0x66, 0x72,
-  0x67, 0x75, 0x6e, 0x7a, 0x77, 0x74, 0x87, 0x5e, 0x8d, 0x52, 0x8a, 0x4d,
-  0x86, 0x52, 0x87, 0x51, 0x89, 0x4b, 0x89, 0x49, 0x89, 0x4b, 0x86, 0x52,
-  0x88, 0x53, 0x88, 0x53, 0x89, 0x4d, 0x8b, 0x47, 0x89, 0x51, 0x86, 0x61,
-  0x82, 0x6a, 0x81, 0x70, 0x82, 0x70, 0x83, 0x6a, 0x85, 0x5f, 0x8a, 0x4c,
-  0x89, 0x4a, 0x8a, 0x4c, 0x8a, 0x4c, 0x8d, 0x4b, 0x8d, 0x4b, 0x8f, 0x4a,
-  0x8f, 0x4a, 0x8f, 0x4c, 0x8e, 0x4f, 0x8f, 0x4f, 0x8f, 0x4c, 0x8f, 0x4a,
-  0x91, 0x4a, 0x91, 0x4b, 0x92, 0x4b, 0x91, 0x48, 0x91, 0x49, 0x91, 0x4b,
-  0x90, 0x4e, 0x93, 0x49, 0x65, 0x6a, 0x61, 0x6a, 0x5d, 0x69, 0x52, 0x68,
-  0x50, 0x67, 0x50, 0x65, 0x51, 0x64, 0x52, 0x63, 0x54, 0x60, 0x55, 0x60,
-  0x55, 0x60, 0x56, 0x5e, 0x55, 0x5c, 0x55, 0x5e, 0x55, 0x5d, 0x54, 0x5e,
-  0x54, 0x5e, 0x54, 0x5b, 0x53, 0x5d, 0x52, 0x5d, 0x4f, 0x5e, 0x4e, 0x61,
-  0x55, 0x64, 0x5d, 0x65, 0x60, 0x66, 0x63, 0x69, 0x66, 0x6a, 0x67, 0x6a,
-  0x67, 0x6a, 0x67, 0x6a, 0x6c, 0x6b, 0x72, 0x67, 0x79, 0x69, 0x82, 0x6b,
-  0x86, 0x6c, 0x86, 0x6f, 0x86, 0x72, 0x85, 0x74, 0x84, 0x76, 0x85, 0x76,
-  0x84, 0x77, 0x85, 0x77, 0x84, 0x77, 0x84, 0x76, 0x83, 0x76, 0x85, 0x70,
-  0x8a, 0x6b, 0x87, 0x72, 0x80, 0x7d, 0x7f, 0x7f, 0x82, 0x79, 0x87, 0x6f,
-  0x89, 0x6d, 0x8b, 0x6c, 0x8b, 0x6d, 0x8b, 0x6f, 0x8a, 0x70, 0x8a, 0x71,
-  0x88, 0x71, 0x88, 0x70, 0x88, 0x6f, 0x89, 0x6d, 0x8a, 0x6a, 0x8a, 0x66,
-  0x8f, 0x5b, 0x92, 0x5c, 0x8a, 0x5b, 0x89, 0x54, 0x8f, 0x54, 0x94, 0x55,
-  0x95, 0x55, 0x97, 0x54, 0x99, 0x51, 0x95, 0x4c, 0x95, 0x4c, 0x9a, 0x4a,
-  0x96, 0x56, 0x97, 0x47, 0x9b, 0x48, 0x9b, 0x4b, 0x9b, 0x48, 0x9c, 0x3f,
-  0x9a, 0x3d, 0x96, 0x46, 0x95, 0x4b, 0x9b, 0x45, 0x9f, 0x3b, 0x9b, 0x43,
-  0x97, 0x48, 0x93, 0x41, 0x95, 0x40, 0x95, 0x40, 0x8c, 0x50, 0x93, 0x46,
-  0x91, 0x49, 0x88, 0x5b, 0x86, 0x65, 0x83, 0x74, 0x7d, 0x7e, 0x78, 0x80,
-  0x72, 0x80, 0x67, 0x80, 0x5b, 0x7f, 0x58, 0x79, 0x5e, 0x79, 0x63, 0x78,
-  0x6a, 0x72, 0x6c, 0x6e, 0x68, 0x6d, 0x62, 0x72, 0x5e, 0x74, 0x5e, 0x79,
-  0x64, 0x77, 0x65, 0x76, 0x65, 0x74, 0x67, 0x6f, 0x6b, 0x73, 0x7a, 0x6f,
-  0x83, 0x64, 0x8c, 0x57, 0x8d, 0x4f, 0x8a, 0x4d, 0x88, 0x51, 0x88, 0x50,
-  0x89, 0x4b, 0x89, 0x49, 0x8a, 0x48, 0x88, 0x50, 0x88, 0x51, 0x88, 0x51,
-  0x89, 0x4f, 0x8b, 0x4a, 0x8d, 0x46, 0x8d, 0x4e, 0x8c, 0x53, 0x8b, 0x56,
-  0x8c, 0x57, 0x8d, 0x52, 0x8d, 0x4d, 0x8d, 0x45, 0x8b, 0x47, 0x8b, 0x4a,
-  0x8b, 0x4a, 0x8e, 0x4a, 0x8f, 0x4a, 0x8f, 0x4a, 0x8f, 0x4a, 0x8f, 0x4b,
-  0x8e, 0x4d, 0x8f, 0x4e, 0x8f, 0x4c, 0x90, 0x4a, 0x90, 0x4a, 0x90, 0x4b,
-  0x91, 0x4a, 0x92, 0x46, 0x92, 0x45, 0x92, 0x46, 0x92, 0x47, 0x94, 0x41,
-  0x66, 0x69, 0x60, 0x6a, 0x5e, 0x69, 0x54, 0x68, 0x50, 0x67, 0x4f, 0x65,
-  0x51, 0x64, 0x53, 0x63, 0x54, 0x61, 0x54, 0x61, 0x54, 0x60, 0x55, 0x5e,
-  0x54, 0x5d, 0x55, 0x5d, 0x55, 0x5d, 0x54, 0x5c, 0x53, 0x5c, 0x54, 0x59,
-  0x54, 0x5b, 0x52, 0x5c, 0x4f, 0x5e, 0x51, 0x61, 0x59, 0x63, 0x5f, 0x65,
-  0x62, 0x67, 0x63, 0x69, 0x65, 0x6a, 0x66, 0x69, 0x6c, 0x68, 0x75, 0x68,
-  0x7f, 0x6a, 0x85, 0x6e, 0x86, 0x6f, 0x85, 0x70, 0x84, 0x72, 0x84, 0x74,
-  0x85, 0x72, 0x85, 0x74, 0x85, 0x76, 0x84, 0x76, 0x84, 0x77, 0x84, 0x78,
-  0x85, 0x78, 0x84, 0x79, 0x84, 0x78, 0x84, 0x77, 0x86, 0x71, 0x87, 0x6f,
-  0x89, 0x6f, 0x8a, 0x6f, 0x89, 0x6e, 0x8b, 0x6c, 0x8a, 0x6c, 0x8a, 0x6d,
-  0x8a, 0x70, 0x89, 0x71, 0x88, 0x71, 0x87, 0x73, 0x86, 0x74, 0x86, 0x74,
-  0x86, 0x74, 0x86, 0x73, 0x87, 0x71, 0x87, 0x6d, 0x8a, 0x64, 0x8f, 0x5c,
-  0x8e, 0x62, 0x90, 0x53, 0x96, 0x57, 0x95, 0x66, 0x92, 0x65, 0x94, 0x5e,
-  0x95, 0x59, 0x99, 0x52, 0x99, 0x49, 0x9b, 0x48, 0x96, 0x5b, 0x94, 0x54,
-  0x99, 0x4a, 0x99, 0x52, 0x99, 0x51, 0x9a, 0x49, 0x9a, 0x3e, 0x99, 0x3e,
-  0x92, 0x49, 0x96, 0x4b, 0x9e, 0x3f, 0x9e, 0x36, 0x9a, 0x4b, 0x9a, 0x3b,
-  0x9a, 0x36, 0x95, 0x40, 0x8d, 0x51, 0x93, 0x46, 0x96, 0x43, 0x8d, 0x51,
-  0x8d, 0x55, 0x8f, 0x58, 0x85, 0x6b, 0x7c, 0x7c, 0x74, 0x83, 0x66, 0x82,
-  0x57, 0x7d, 0x5a, 0x78, 0x5f, 0x7b, 0x65, 0x7a, 0x6b, 0x75, 0x69, 0x6e,
-  0x66, 0x6d, 0x61, 0x74, 0x5e, 0x77, 0x5f, 0x79, 0x65, 0x77, 0x67, 0x76,
-  0x67, 0x73, 0x67, 0x70, 0x70, 0x72, 0x87, 0x5f, 0x8c, 0x56, 0x8d, 0x51,
-  0x8c, 0x4c, 0x8a, 0x4c, 0x8a, 0x4f, 0x8a, 0x4e, 0x89, 0x4b, 0x89, 0x49,
-  0x8c, 0x45, 0x89, 0x4c, 0x88, 0x4f, 0x88, 0x4f, 0x89, 0x52, 0x8b, 0x51,
-  0x8f, 0x45, 0x91, 0x43, 0x93, 0x47, 0x93, 0x49, 0x93, 0x49, 0x93, 0x48,
-  0x93, 0x46, 0x91, 0x42, 0x8e, 0x46, 0x8d, 0x49, 0x8e, 0x49, 0x91, 0x4a,
-  0x91, 0x4a, 0x8f, 0x4b, 0x8f, 0x4a, 0x8f, 0x4a, 0x8f, 0x4b, 0x8f, 0x4e,
-  0x8f, 0x4c, 0x8f, 0x4a, 0x90, 0x4b, 0x90, 0x4a, 0x91, 0x48, 0x92, 0x45,
-  0x94, 0x45, 0x93, 0x45, 0x94, 0x43, 0x97, 0x3e, 0x63, 0x6a, 0x5f, 0x6a,
-  0x5c, 0x68, 0x53, 0x67, 0x4f, 0x67, 0x4f, 0x66, 0x50, 0x65, 0x52, 0x64,
-  0x54, 0x62, 0x54, 0x61, 0x54, 0x60, 0x54, 0x5f, 0x54, 0x5d, 0x54, 0x5d,
-  0x54, 0x5e, 0x54, 0x5c, 0x53, 0x5c, 0x54, 0x59, 0x54, 0x5b, 0x52, 0x5b,
-  0x4e, 0x5f, 0x51, 0x62, 0x58, 0x64, 0x60, 0x66, 0x63, 0x67, 0x63, 0x68,
-  0x66, 0x68, 0x6c, 0x67, 0x7b, 0x68, 0x84, 0x6b, 0x87, 0x70, 0x87, 0x73,
-  0x86, 0x74, 0x84, 0x74, 0x84, 0x74, 0x85, 0x75, 0x85, 0x74, 0x84, 0x74,
-  0x85, 0x76, 0x84, 0x76, 0x84, 0x77, 0x85, 0x78, 0x84, 0x79, 0x83, 0x7a,
-  0x83, 0x79, 0x84, 0x78, 0x83, 0x76, 0x85, 0x76, 0x88, 0x77, 0x87, 0x75,
-  0x86, 0x75, 0x87, 0x73, 0x87, 0x72, 0x87, 0x70, 0x88, 0x70, 0x88, 0x70,
-  0x87, 0x6f, 0x87, 0x71, 0x86, 0x74, 0x86, 0x74, 0x85, 0x75, 0x85, 0x75,
-  0x86, 0x73, 0x86, 0x70, 0x87, 0x6c, 0x89, 0x62, 0x8e, 0x5e, 0x91, 0x58,
-  0x96, 0x55, 0x92, 0x6a, 0x90, 0x69, 0x91, 0x61, 0x93, 0x5b, 0x96, 0x5a,
-  0x98, 0x4b, 0x9a, 0x47, 0x98, 0x58, 0x92, 0x63, 0x96, 0x4e, 0x9a, 0x50,
-  0x9a, 0x53, 0x98, 0x4f, 0x99, 0x46, 0x99, 0x3f, 0x94, 0x43, 0x94, 0x4a,
-  0x9e, 0x40, 0xa0, 0x36, 0x9c, 0x44, 0x9a, 0x48, 0x9c, 0x3b, 0x96, 0x3f,
-  0x8c, 0x50, 0x91, 0x48, 0x96, 0x41, 0x91, 0x4a, 0x8f, 0x51, 0x94, 0x4b,
-  0x8e, 0x57, 0x7d, 0x75, 0x70, 0x86, 0x60, 0x84, 0x57, 0x7c, 0x5b, 0x77,
-  0x5e, 0x7c, 0x65, 0x7b, 0x6a, 0x74, 0x68, 0x6e, 0x63, 0x6f, 0x60, 0x76,
-  0x5e, 0x78, 0x63, 0x79, 0x67, 0x76, 0x66, 0x74, 0x66, 0x73, 0x69, 0x73,
-  0x76, 0x6e, 0x8b, 0x59, 0x8f, 0x53, 0x8d, 0x4e, 0x8b, 0x4d, 0x89, 0x4d,
-  0x89, 0x4e, 0x8a, 0x4d, 0x8a, 0x4b, 0x8c, 0x48, 0x8d, 0x44, 0x8a, 0x49,
-  0x8a, 0x4f, 0x8a, 0x4e, 0x8a, 0x51, 0x8a, 0x51, 0x8d, 0x4b, 0x91, 0x44,
-  0x92, 0x43, 0x94, 0x43, 0x95, 0x44, 0x96, 0x44, 0x96, 0x43, 0x93, 0x42,
-  0x8e, 0x48, 0x8e, 0x49, 0x8f, 0x49, 0x90, 0x4a, 0x90, 0x4a, 0x91, 0x4a,
-  0x91, 0x4a, 0x90, 0x49, 0x8f, 0x4c, 0x8f, 0x4d, 0x8f, 0x4c, 0x90, 0x4a,
-  0x91, 0x4b, 0x91, 0x4a, 0x92, 0x47, 0x92, 0x46, 0x92, 0x47, 0x93, 0x47,
-  0x94, 0x45, 0x97, 0x40, 0x60, 0x6a, 0x5e, 0x6a, 0x5a, 0x69, 0x52, 0x66,
-  0x4d, 0x66, 0x4e, 0x67, 0x50, 0x66, 0x50, 0x65, 0x53, 0x63, 0x53, 0x62,
-  0x54, 0x61, 0x54, 0x5f, 0x54, 0x5f, 0x54, 0x5d, 0x54, 0x5f, 0x54, 0x5d,
-  0x54, 0x5d, 0x54, 0x5a, 0x54, 0x5a, 0x51, 0x5a, 0x4d, 0x5f, 0x52, 0x63,
-  0x58, 0x65, 0x5f, 0x67, 0x5f, 0x67, 0x67, 0x67, 0x74, 0x68, 0x7f, 0x6b,
-  0x86, 0x70, 0x86, 0x72, 0x85, 0x73, 0x85, 0x72, 0x86, 0x75, 0x85, 0x75,
-  0x84, 0x75, 0x84, 0x74, 0x85, 0x75, 0x84, 0x75, 0x84, 0x77, 0x85, 0x77,
-  0x84, 0x77, 0x84, 0x76, 0x83, 0x76, 0x82, 0x76, 0x83, 0x76, 0x85, 0x77,
-  0x85, 0x75, 0x86, 0x73, 0x86, 0x73, 0x86, 0x74, 0x86, 0x74, 0x87, 0x75,
-  0x87, 0x75, 0x87, 0x73, 0x87, 0x73, 0x87, 0x72, 0x87, 0x72, 0x87, 0x73,
-  0x87, 0x73, 0x86, 0x73, 0x85, 0x75, 0x86, 0x75, 0x87, 0x73, 0x87, 0x70,
-  0x87, 0x6d, 0x87, 0x6b, 0x8c, 0x61, 0x8e, 0x5e, 0x94, 0x52, 0x93, 0x60,
-  0x90, 0x6a, 0x90, 0x65, 0x92, 0x61, 0x95, 0x5c, 0x97, 0x54, 0x98, 0x4b,
-  0x9a, 0x4d, 0x95, 0x61, 0x93, 0x5f, 0x99, 0x49, 0x9a, 0x49, 0x98, 0x54,
-  0x98, 0x50, 0x9a, 0x47, 0x98, 0x3d, 0x95, 0x44, 0x9b, 0x44, 0xa3, 0x38,
-  0x9f, 0x39, 0x97, 0x52, 0x96, 0x4f, 0x95, 0x45, 0x8c, 0x4e, 0x8f, 0x4a,
-  0x94, 0x43, 0x94, 0x44, 0x93, 0x4b, 0x96, 0x46, 0x95, 0x4b, 0x7a, 0x72,
-  0x63, 0x8a, 0x59, 0x85, 0x5b, 0x7b, 0x5c, 0x79, 0x60, 0x7d, 0x67, 0x7b,
-  0x68, 0x72, 0x66, 0x6e, 0x62, 0x72, 0x60, 0x77, 0x5f, 0x79, 0x65, 0x78,
-  0x68, 0x76, 0x66, 0x73, 0x68, 0x73, 0x6e, 0x73, 0x80, 0x63, 0x8f, 0x52,
-  0x8f, 0x4f, 0x8d, 0x4a, 0x8a, 0x4d, 0x89, 0x4d, 0x89, 0x4c, 0x89, 0x4c,
-  0x8b, 0x4a, 0x8d, 0x45, 0x8e, 0x41, 0x8b, 0x44, 0x8a, 0x4d, 0x8b, 0x4e,
-  0x8b, 0x51, 0x8a, 0x51, 0x8c, 0x4e, 0x8e, 0x48, 0x91, 0x43, 0x94, 0x41,
-  0x95, 0x41, 0x95, 0x43, 0x95, 0x45, 0x92, 0x47, 0x8e, 0x4b, 0x8f, 0x4a,
-  0x8f, 0x4a, 0x8f, 0x4b, 0x90, 0x4a, 0x91, 0x48, 0x92, 0x49, 0x91, 0x49,
-  0x90, 0x4b, 0x90, 0x4b, 0x90, 0x4a, 0x91, 0x4a, 0x91, 0x49, 0x92, 0x49,
-  0x91, 0x49, 0x91, 0x49, 0x91, 0x48, 0x92, 0x48, 0x93, 0x46, 0x95, 0x43,
-  0x5f, 0x6a, 0x5d, 0x6a, 0x5b, 0x69, 0x52, 0x66, 0x4d, 0x66, 0x4e, 0x67,
-  0x50, 0x66, 0x50, 0x65, 0x52, 0x63, 0x53, 0x62, 0x53, 0x61, 0x54, 0x5f,
-  0x54, 0x5f, 0x54, 0x5e, 0x54, 0x5c, 0x54, 0x5d, 0x54, 0x5d, 0x54, 0x5a,
-  0x54, 0x5a, 0x52, 0x5a, 0x4e, 0x60, 0x54, 0x63, 0x5a, 0x65, 0x5e, 0x67,
-  0x61, 0x67, 0x77, 0x69, 0x82, 0x6f, 0x86, 0x73, 0x86, 0x74, 0x86, 0x74,
-  0x86, 0x72, 0x86, 0x72, 0x86, 0x75, 0x86, 0x75, 0x84, 0x75, 0x84, 0x74,
-  0x85, 0x75, 0x85, 0x75, 0x84, 0x77, 0x84, 0x78, 0x84, 0x77, 0x84, 0x76,
-  0x83, 0x77, 0x82, 0x77, 0x83, 0x77, 0x84, 0x78, 0x84, 0x77, 0x84, 0x76,
-  0x85, 0x76, 0x84, 0x76, 0x84, 0x76, 0x86, 0x74, 0x87, 0x74, 0x87, 0x73,
-  0x87, 0x73, 0x87, 0x73, 0x87, 0x74, 0x87, 0x74, 0x87, 0x73, 0x86, 0x74,
-  0x85, 0x75, 0x86, 0x75, 0x87, 0x73, 0x87, 0x70, 0x87, 0x70, 0x87, 0x71,
-  0x89, 0x68, 0x8b, 0x5f, 0x93, 0x54, 0x94, 0x56, 0x90, 0x67, 0x90, 0x68,
-  0x91, 0x64, 0x93, 0x5f, 0x95, 0x59, 0x97, 0x52, 0x99, 0x48, 0x99, 0x51,
-  0x93, 0x67, 0x95, 0x52, 0x98, 0x48, 0x97, 0x52, 0x96, 0x53, 0x98, 0x4d,
-  0x9b, 0x40, 0x99, 0x3c, 0x98, 0x45, 0xa2, 0x38, 0xa2, 0x33, 0x99, 0x4d,
-  0x95, 0x54, 0x96, 0x46, 0x8c, 0x4c, 0x8f, 0x4b, 0x92, 0x45, 0x94, 0x42,
-  0x95, 0x45, 0x98, 0x44, 0x96, 0x4c, 0x72, 0x77, 0x57, 0x8a, 0x56, 0x82,
-  0x5d, 0x7b, 0x5e, 0x7b, 0x63, 0x7e, 0x6a, 0x7a, 0x68, 0x6f, 0x64, 0x70,
-  0x62, 0x73, 0x61, 0x77, 0x62, 0x79, 0x66, 0x79, 0x67, 0x75, 0x65, 0x73,
-  0x6a, 0x73, 0x74, 0x71, 0x87, 0x59, 0x8e, 0x4e, 0x8e, 0x4b, 0x8d, 0x46,
-  0x8a, 0x4c, 0x89, 0x4b, 0x89, 0x4a, 0x89, 0x4b, 0x8b, 0x4a, 0x8d, 0x41,
-  0x8f, 0x3d, 0x8d, 0x40, 0x8a, 0x4b, 0x8b, 0x4f, 0x8b, 0x53, 0x8b, 0x53,
-  0x8a, 0x50, 0x8c, 0x4d, 0x8f, 0x48, 0x92, 0x44, 0x93, 0x45, 0x92, 0x48,
-  0x91, 0x4b, 0x8f, 0x4d, 0x8f, 0x4d, 0x8f, 0x4b, 0x8f, 0x4b, 0x90, 0x4b,
-  0x90, 0x4b, 0x91, 0x49, 0x91, 0x49, 0x90, 0x48, 0x90, 0x49, 0x91, 0x49,
-  0x92, 0x49, 0x92, 0x48, 0x91, 0x47, 0x91, 0x48, 0x91, 0x49, 0x91, 0x49,
-  0x92, 0x4a, 0x91, 0x49, 0x91, 0x46, 0x94, 0x46, 0x5e, 0x6a, 0x5c, 0x69,
-  0x59, 0x67, 0x51, 0x66, 0x4c, 0x67, 0x4c, 0x66, 0x4f, 0x66, 0x4f, 0x66,
-  0x51, 0x64, 0x52, 0x63, 0x53, 0x61, 0x54, 0x5f, 0x54, 0x60, 0x54, 0x5f,
-  0x54, 0x5c, 0x55, 0x5b, 0x55, 0x5a, 0x54, 0x59, 0x54, 0x5a, 0x52, 0x5a,
-  0x4e, 0x60, 0x53, 0x62, 0x5b, 0x64, 0x64, 0x65, 0x71, 0x68, 0x83, 0x70,
-  0x85, 0x73, 0x84, 0x75, 0x84, 0x74, 0x85, 0x73, 0x85, 0x73, 0x85, 0x73,
-  0x85, 0x75, 0x85, 0x75, 0x84, 0x74, 0x84, 0x75, 0x85, 0x76, 0x85, 0x76,
-  0x85, 0x78, 0x85, 0x78, 0x84, 0x78, 0x83, 0x78, 0x83, 0x78, 0x82, 0x79,
-  0x83, 0x79, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x79,
-  0x84, 0x78, 0x85, 0x77, 0x85, 0x77, 0x86, 0x74, 0x86, 0x73, 0x87, 0x73,
-  0x87, 0x72, 0x87, 0x72, 0x88, 0x73, 0x86, 0x73, 0x85, 0x73, 0x86, 0x74,
-  0x87, 0x73, 0x87, 0x71, 0x87, 0x70, 0x87, 0x70, 0x88, 0x6c, 0x89, 0x66,
-  0x8e, 0x5b, 0x95, 0x50, 0x92, 0x5f, 0x8f, 0x6a, 0x8f, 0x65, 0x92, 0x61,
-  0x94, 0x5c, 0x96, 0x57, 0x97, 0x4b, 0x98, 0x48, 0x96, 0x59, 0x93, 0x61,
-  0x96, 0x54, 0x97, 0x4d, 0x96, 0x54, 0x98, 0x52, 0x9a, 0x47, 0x9c, 0x3b,
-  0x99, 0x3f, 0x9c, 0x3d, 0xa1, 0x33, 0x9a, 0x48, 0x96, 0x50, 0x99, 0x41,
-  0x8d, 0x4a, 0x8f, 0x4a, 0x91, 0x46, 0x94, 0x42, 0x97, 0x42, 0x98, 0x42,
-  0x8f, 0x52, 0x66, 0x81, 0x54, 0x86, 0x55, 0x81, 0x5b, 0x7c, 0x5f, 0x7d,
-  0x64, 0x7d, 0x6a, 0x76, 0x68, 0x6e, 0x62, 0x72, 0x61, 0x76, 0x61, 0x77,
-  0x61, 0x7a, 0x66, 0x79, 0x66, 0x74, 0x64, 0x73, 0x6c, 0x73, 0x7e, 0x64,
-  0x8d, 0x52, 0x8f, 0x4b, 0x8f, 0x46, 0x8e, 0x46, 0x8b, 0x49, 0x8b, 0x49,
-  0x8a, 0x49, 0x8a, 0x49, 0x8b, 0x48, 0x8e, 0x41, 0x90, 0x3c, 0x8e, 0x41,
-  0x8b, 0x4a, 0x8a, 0x50, 0x8a, 0x55, 0x8a, 0x54, 0x8b, 0x50, 0x8c, 0x4d,
-  0x8d, 0x4a, 0x8f, 0x4b, 0x90, 0x4c, 0x8f, 0x4f, 0x8e, 0x51, 0x8d, 0x50,
-  0x8e, 0x4d, 0x8f, 0x4a, 0x8f, 0x49, 0x91, 0x49, 0x91, 0x4a, 0x92, 0x49,
-  0x92, 0x49, 0x91, 0x48, 0x90, 0x49, 0x91, 0x49, 0x93, 0x48, 0x92, 0x47,
-  0x92, 0x46, 0x92, 0x46, 0x91, 0x48, 0x92, 0x48, 0x92, 0x49, 0x92, 0x49,
-  0x91, 0x46, 0x92, 0x47, 0x5d, 0x6b, 0x5b, 0x68, 0x57, 0x66, 0x4f, 0x66,
-  0x4a, 0x67, 0x4b, 0x64, 0x4d, 0x65, 0x4f, 0x65, 0x50, 0x65, 0x50, 0x63,
-  0x52, 0x61, 0x53, 0x5f, 0x53, 0x5e, 0x54, 0x5e, 0x54, 0x5c, 0x56, 0x59,
-  0x56, 0x57, 0x55, 0x57, 0x53, 0x5a, 0x50, 0x5a, 0x4e, 0x60, 0x53, 0x62,
-  0x5c, 0x60, 0x79, 0x66, 0x84, 0x6e, 0x84, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x75, 0x84, 0x74, 0x84, 0x75, 0x84, 0x75, 0x84, 0x75, 0x84, 0x75,
-  0x84, 0x76, 0x85, 0x76, 0x85, 0x78, 0x85, 0x78, 0x85, 0x79, 0x85, 0x78,
-  0x83, 0x78, 0x83, 0x78, 0x83, 0x78, 0x83, 0x78, 0x83, 0x78, 0x83, 0x78,
-  0x84, 0x78, 0x85, 0x78, 0x84, 0x78, 0x85, 0x78, 0x85, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x77, 0x85, 0x77, 0x86, 0x75, 0x86, 0x73, 0x87, 0x70,
-  0x88, 0x70, 0x87, 0x71, 0x86, 0x71, 0x86, 0x72, 0x87, 0x72, 0x87, 0x71,
-  0x87, 0x70, 0x87, 0x70, 0x88, 0x6c, 0x87, 0x6b, 0x8a, 0x65, 0x91, 0x51,
-  0x92, 0x53, 0x8f, 0x68, 0x8f, 0x67, 0x91, 0x63, 0x93, 0x5f, 0x95, 0x5b,
-  0x96, 0x53, 0x97, 0x4a, 0x99, 0x48, 0x96, 0x59, 0x95, 0x5c, 0x97, 0x4b,
-  0x98, 0x4f, 0x96, 0x54, 0x98, 0x4e, 0x9b, 0x41, 0x9c, 0x39, 0x99, 0x41,
-  0x9e, 0x37, 0x9b, 0x44, 0x97, 0x51, 0x9a, 0x3e, 0x91, 0x48, 0x8f, 0x4a,
-  0x91, 0x46, 0x94, 0x42, 0x98, 0x3f, 0x96, 0x44, 0x82, 0x62, 0x5a, 0x88,
-  0x55, 0x83, 0x57, 0x80, 0x5b, 0x7d, 0x60, 0x7f, 0x65, 0x7b, 0x66, 0x72,
-  0x66, 0x6e, 0x5e, 0x75, 0x60, 0x79, 0x63, 0x79, 0x60, 0x7b, 0x64, 0x79,
-  0x62, 0x73, 0x60, 0x76, 0x6f, 0x72, 0x87, 0x56, 0x91, 0x4b, 0x90, 0x45,
-  0x90, 0x41, 0x8f, 0x44, 0x8d, 0x45, 0x8e, 0x45, 0x8c, 0x46, 0x8c, 0x46,
-  0x8d, 0x44, 0x8f, 0x40, 0x90, 0x3c, 0x8e, 0x43, 0x8c, 0x4d, 0x8a, 0x51,
-  0x8a, 0x56, 0x8b, 0x54, 0x8b, 0x50, 0x8d, 0x4c, 0x8d, 0x4b, 0x8d, 0x4d,
-  0x8d, 0x4f, 0x8d, 0x51, 0x8d, 0x52, 0x8d, 0x4f, 0x8e, 0x4b, 0x90, 0x48,
-  0x90, 0x46, 0x92, 0x47, 0x92, 0x49, 0x92, 0x49, 0x92, 0x48, 0x92, 0x48,
-  0x92, 0x48, 0x93, 0x48, 0x93, 0x46, 0x93, 0x44, 0x95, 0x44, 0x94, 0x44,
-  0x93, 0x45, 0x93, 0x46, 0x93, 0x46, 0x93, 0x46, 0x93, 0x45, 0x93, 0x45,
-  0x5a, 0x6b, 0x57, 0x68, 0x55, 0x66, 0x4d, 0x66, 0x48, 0x65, 0x4a, 0x62,
-  0x4d, 0x63, 0x4f, 0x63, 0x50, 0x63, 0x51, 0x61, 0x52, 0x60, 0x53, 0x5f,
-  0x53, 0x5d, 0x54, 0x5c, 0x54, 0x5a, 0x56, 0x59, 0x56, 0x57, 0x55, 0x57,
-  0x52, 0x5a, 0x50, 0x5a, 0x4d, 0x60, 0x53, 0x64, 0x67, 0x61, 0x83, 0x6d,
-  0x86, 0x73, 0x84, 0x76, 0x85, 0x76, 0x85, 0x76, 0x85, 0x76, 0x85, 0x76,
-  0x85, 0x76, 0x85, 0x76, 0x84, 0x75, 0x84, 0x75, 0x84, 0x78, 0x85, 0x78,
-  0x85, 0x77, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x83, 0x78, 0x83, 0x78,
-  0x83, 0x78, 0x83, 0x78, 0x83, 0x78, 0x82, 0x78, 0x84, 0x78, 0x85, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x85, 0x78, 0x85, 0x77, 0x85, 0x76, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x74, 0x85, 0x71, 0x86, 0x6f, 0x87, 0x70,
-  0x87, 0x70, 0x87, 0x71, 0x87, 0x72, 0x87, 0x72, 0x87, 0x70, 0x87, 0x70,
-  0x88, 0x6e, 0x89, 0x6c, 0x89, 0x69, 0x8d, 0x5c, 0x8f, 0x54, 0x90, 0x65,
-  0x8f, 0x6a, 0x92, 0x64, 0x92, 0x61, 0x93, 0x5e, 0x95, 0x59, 0x96, 0x51,
-  0x97, 0x48, 0x99, 0x4a, 0x99, 0x52, 0x97, 0x4e, 0x97, 0x47, 0x95, 0x52,
-  0x97, 0x53, 0x9a, 0x4a, 0x9b, 0x39, 0x9b, 0x3f, 0x9b, 0x3d, 0x9d, 0x3e,
-  0x97, 0x4f, 0x9a, 0x3d, 0x94, 0x44, 0x90, 0x4a, 0x91, 0x46, 0x94, 0x42,
-  0x97, 0x3e, 0x91, 0x4c, 0x75, 0x73, 0x58, 0x88, 0x57, 0x84, 0x59, 0x81,
-  0x5d, 0x7f, 0x61, 0x80, 0x65, 0x79, 0x63, 0x71, 0x63, 0x70, 0x5b, 0x77,
-  0x5e, 0x7a, 0x66, 0x7a, 0x5f, 0x79, 0x62, 0x77, 0x5f, 0x75, 0x5e, 0x7a,
-  0x73, 0x6e, 0x8b, 0x50, 0x92, 0x47, 0x90, 0x42, 0x90, 0x3e, 0x8f, 0x41,
-  0x8f, 0x42, 0x8f, 0x42, 0x8e, 0x44, 0x8e, 0x44, 0x8f, 0x41, 0x91, 0x3d,
-  0x91, 0x3b, 0x8e, 0x43, 0x8c, 0x4e, 0x8a, 0x53, 0x8a, 0x56, 0x8b, 0x54,
-  0x8b, 0x51, 0x8d, 0x4e, 0x8d, 0x4d, 0x8d, 0x4f, 0x8d, 0x51, 0x8d, 0x51,
-  0x8e, 0x4f, 0x8f, 0x4d, 0x90, 0x49, 0x90, 0x47, 0x90, 0x44, 0x91, 0x45,
-  0x91, 0x48, 0x92, 0x49, 0x92, 0x49, 0x92, 0x47, 0x93, 0x47, 0x94, 0x46,
-  0x94, 0x43, 0x95, 0x41, 0x96, 0x41, 0x96, 0x42, 0x95, 0x44, 0x94, 0x44,
-  0x94, 0x43, 0x94, 0x44, 0x95, 0x44, 0x95, 0x44, 0x57, 0x6a, 0x54, 0x68,
-  0x52, 0x66, 0x4a, 0x65, 0x47, 0x65, 0x49, 0x63, 0x4c, 0x62, 0x4e, 0x62,
-  0x50, 0x62, 0x51, 0x61, 0x52, 0x5f, 0x52, 0x5e, 0x53, 0x5d, 0x55, 0x59,
-  0x55, 0x58, 0x55, 0x58, 0x55, 0x56, 0x55, 0x56, 0x52, 0x58, 0x50, 0x59,
-  0x4f, 0x5f, 0x5c, 0x60, 0x7c, 0x69, 0x83, 0x74, 0x84, 0x75, 0x85, 0x78,
-  0x85, 0x78, 0x85, 0x78, 0x85, 0x78, 0x85, 0x78, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x78, 0x85, 0x78, 0x84, 0x78, 0x84, 0x78,
-  0x83, 0x79, 0x83, 0x79, 0x83, 0x79, 0x83, 0x79, 0x83, 0x79, 0x82, 0x78,
-  0x83, 0x78, 0x83, 0x78, 0x84, 0x78, 0x85, 0x78, 0x85, 0x78, 0x84, 0x77,
-  0x84, 0x78, 0x84, 0x75, 0x84, 0x76, 0x84, 0x74, 0x85, 0x74, 0x85, 0x75,
-  0x84, 0x74, 0x85, 0x73, 0x85, 0x73, 0x86, 0x71, 0x87, 0x6f, 0x87, 0x70,
-  0x87, 0x70, 0x88, 0x70, 0x87, 0x70, 0x87, 0x70, 0x88, 0x6f, 0x88, 0x6d,
-  0x88, 0x6a, 0x89, 0x64, 0x8c, 0x5e, 0x91, 0x5e, 0x90, 0x67, 0x91, 0x66,
-  0x91, 0x61, 0x92, 0x60, 0x93, 0x5c, 0x94, 0x56, 0x96, 0x50, 0x97, 0x46,
-  0x99, 0x46, 0x99, 0x50, 0x96, 0x49, 0x96, 0x4f, 0x96, 0x57, 0x97, 0x55,
-  0x9a, 0x43, 0x9b, 0x39, 0x97, 0x44, 0x9d, 0x3a, 0x9a, 0x4a, 0x9a, 0x3e,
-  0x96, 0x3e, 0x90, 0x4a, 0x91, 0x47, 0x93, 0x44, 0x97, 0x40, 0x7f, 0x64,
-  0x61, 0x84, 0x58, 0x85, 0x5a, 0x83, 0x5b, 0x80, 0x5e, 0x80, 0x63, 0x80,
-  0x65, 0x76, 0x62, 0x6f, 0x5f, 0x73, 0x5a, 0x79, 0x5f, 0x7b, 0x66, 0x7b,
-  0x61, 0x78, 0x5f, 0x75, 0x5c, 0x76, 0x5d, 0x7a, 0x7d, 0x62, 0x8f, 0x49,
-  0x92, 0x43, 0x90, 0x3f, 0x91, 0x3d, 0x90, 0x3e, 0x91, 0x3f, 0x91, 0x3f,
-  0x90, 0x41, 0x90, 0x40, 0x90, 0x3e, 0x91, 0x3b, 0x91, 0x3b, 0x8e, 0x43,
-  0x8b, 0x51, 0x8a, 0x55, 0x8a, 0x57, 0x8b, 0x55, 0x8c, 0x52, 0x8d, 0x4f,
-  0x8d, 0x4e, 0x8e, 0x50, 0x8d, 0x51, 0x8d, 0x50, 0x8e, 0x4d, 0x90, 0x4a,
-  0x90, 0x4a, 0x8f, 0x47, 0x91, 0x41, 0x92, 0x42, 0x92, 0x45, 0x93, 0x48,
-  0x93, 0x47, 0x94, 0x45, 0x95, 0x43, 0x95, 0x42, 0x96, 0x3f, 0x96, 0x3e,
-  0x97, 0x3d, 0x97, 0x3f, 0x96, 0x42, 0x96, 0x41, 0x96, 0x40, 0x96, 0x41,
-  0x96, 0x42, 0x97, 0x43, 0x55, 0x6a, 0x53, 0x67, 0x51, 0x64, 0x49, 0x64,
-  0x46, 0x64, 0x49, 0x65, 0x4c, 0x62, 0x4e, 0x62, 0x4f, 0x60, 0x50, 0x60,
-  0x51, 0x5f, 0x51, 0x5e, 0x52, 0x5d, 0x55, 0x57, 0x55, 0x56, 0x54, 0x56,
-  0x54, 0x58, 0x55, 0x55, 0x52, 0x57, 0x52, 0x59, 0x55, 0x5b, 0x73, 0x62,
-  0x83, 0x71, 0x84, 0x74, 0x85, 0x75, 0x85, 0x78, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x79, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x83, 0x7a, 0x82, 0x7a, 0x82, 0x7a, 0x82, 0x7a,
-  0x83, 0x7b, 0x83, 0x7a, 0x83, 0x7a, 0x83, 0x77, 0x84, 0x78, 0x84, 0x77,
-  0x85, 0x77, 0x86, 0x79, 0x85, 0x78, 0x84, 0x77, 0x84, 0x77, 0x84, 0x77,
-  0x84, 0x77, 0x85, 0x75, 0x86, 0x75, 0x86, 0x73, 0x86, 0x72, 0x85, 0x73,
-  0x85, 0x73, 0x86, 0x72, 0x87, 0x70, 0x88, 0x6f, 0x88, 0x6d, 0x87, 0x6e,
-  0x88, 0x70, 0x88, 0x70, 0x88, 0x6e, 0x88, 0x6c, 0x89, 0x6a, 0x8a, 0x68,
-  0x8b, 0x63, 0x8e, 0x58, 0x90, 0x5f, 0x90, 0x65, 0x92, 0x62, 0x93, 0x5f,
-  0x92, 0x5d, 0x93, 0x58, 0x95, 0x52, 0x97, 0x4a, 0x98, 0x44, 0x98, 0x4a,
-  0x97, 0x4b, 0x97, 0x4b, 0x96, 0x57, 0x95, 0x57, 0x99, 0x4c, 0x9a, 0x3a,
-  0x96, 0x44, 0x9c, 0x3b, 0x9d, 0x44, 0x99, 0x44, 0x96, 0x3b, 0x90, 0x4a,
-  0x91, 0x48, 0x93, 0x45, 0x97, 0x47, 0x6e, 0x79, 0x58, 0x88, 0x57, 0x85,
-  0x59, 0x82, 0x5c, 0x80, 0x60, 0x81, 0x64, 0x7f, 0x65, 0x74, 0x62, 0x6e,
-  0x5d, 0x75, 0x5c, 0x7a, 0x60, 0x7a, 0x64, 0x7b, 0x62, 0x78, 0x5f, 0x75,
-  0x5c, 0x77, 0x62, 0x78, 0x87, 0x58, 0x91, 0x45, 0x91, 0x41, 0x92, 0x3e,
-  0x91, 0x3e, 0x92, 0x3e, 0x93, 0x3e, 0x93, 0x3f, 0x91, 0x40, 0x91, 0x3f,
-  0x91, 0x3c, 0x91, 0x3b, 0x90, 0x3c, 0x8e, 0x43, 0x89, 0x55, 0x89, 0x57,
-  0x89, 0x58, 0x8a, 0x55, 0x8c, 0x50, 0x8e, 0x4f, 0x8e, 0x50, 0x8d, 0x50,
-  0x8d, 0x50, 0x8f, 0x4f, 0x8f, 0x4c, 0x90, 0x4a, 0x8f, 0x4d, 0x90, 0x49,
-  0x92, 0x3f, 0x92, 0x3e, 0x92, 0x43, 0x94, 0x46, 0x94, 0x44, 0x96, 0x43,
-  0x95, 0x40, 0x96, 0x3f, 0x97, 0x3e, 0x97, 0x3c, 0x98, 0x3c, 0x98, 0x3f,
-  0x97, 0x40, 0x97, 0x3f, 0x97, 0x3e, 0x97, 0x3e, 0x97, 0x3e, 0x97, 0x40,
-  0x54, 0x68, 0x51, 0x65, 0x4f, 0x63, 0x4a, 0x63, 0x47, 0x63, 0x49, 0x63,
-  0x4b, 0x62, 0x4d, 0x62, 0x50, 0x60, 0x50, 0x60, 0x51, 0x5f, 0x51, 0x5d,
-  0x52, 0x5d, 0x53, 0x5b, 0x54, 0x58, 0x54, 0x57, 0x54, 0x5c, 0x53, 0x59,
-  0x52, 0x57, 0x52, 0x59, 0x63, 0x5b, 0x80, 0x6e, 0x83, 0x76, 0x85, 0x74,
-  0x85, 0x75, 0x85, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x85, 0x77, 0x85, 0x77, 0x84, 0x77,
-  0x83, 0x7a, 0x83, 0x7a, 0x82, 0x7a, 0x82, 0x7a, 0x82, 0x7a, 0x83, 0x7a,
-  0x83, 0x79, 0x83, 0x78, 0x84, 0x78, 0x85, 0x78, 0x85, 0x77, 0x85, 0x76,
-  0x86, 0x76, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x86, 0x75, 0x85, 0x73, 0x85, 0x73, 0x85, 0x72, 0x85, 0x72, 0x86, 0x71,
-  0x87, 0x70, 0x87, 0x6f, 0x88, 0x6d, 0x88, 0x6e, 0x88, 0x6f, 0x88, 0x6f,
-  0x88, 0x6e, 0x88, 0x6c, 0x89, 0x6b, 0x89, 0x69, 0x8a, 0x66, 0x8d, 0x5c,
-  0x90, 0x58, 0x90, 0x5f, 0x92, 0x62, 0x92, 0x5f, 0x92, 0x5d, 0x94, 0x59,
-  0x95, 0x55, 0x95, 0x51, 0x96, 0x49, 0x97, 0x46, 0x98, 0x4e, 0x97, 0x48,
-  0x96, 0x54, 0x95, 0x58, 0x97, 0x54, 0x99, 0x46, 0x98, 0x41, 0x9a, 0x3f,
-  0x9d, 0x3e, 0x98, 0x4a, 0x98, 0x3a, 0x90, 0x4b, 0x90, 0x4c, 0x92, 0x4a,
-  0x88, 0x5d, 0x60, 0x85, 0x59, 0x88, 0x58, 0x84, 0x5a, 0x82, 0x5f, 0x82,
-  0x66, 0x81, 0x66, 0x7d, 0x62, 0x74, 0x61, 0x73, 0x5d, 0x78, 0x5e, 0x7a,
-  0x62, 0x7a, 0x64, 0x7b, 0x62, 0x78, 0x5f, 0x75, 0x62, 0x75, 0x70, 0x6d,
-  0x8c, 0x4e, 0x91, 0x42, 0x91, 0x3f, 0x91, 0x3d, 0x91, 0x3e, 0x91, 0x3e,
-  0x92, 0x3e, 0x92, 0x3e, 0x92, 0x3e, 0x93, 0x3e, 0x92, 0x3c, 0x91, 0x3c,
-  0x90, 0x3c, 0x8e, 0x46, 0x89, 0x56, 0x89, 0x59, 0x8a, 0x57, 0x8c, 0x54,
-  0x8e, 0x4e, 0x8f, 0x4d, 0x90, 0x4c, 0x8e, 0x4a, 0x90, 0x4b, 0x91, 0x49,
-  0x91, 0x47, 0x91, 0x49, 0x90, 0x4c, 0x8f, 0x48, 0x92, 0x3f, 0x92, 0x3c,
-  0x93, 0x41, 0x94, 0x46, 0x95, 0x44, 0x95, 0x41, 0x95, 0x3e, 0x96, 0x3d,
-  0x97, 0x3c, 0x97, 0x3b, 0x98, 0x3c, 0x98, 0x3f, 0x97, 0x40, 0x97, 0x3f,
-  0x97, 0x3c, 0x97, 0x3c, 0x97, 0x3c, 0x97, 0x3f, 0x52, 0x66, 0x50, 0x64,
-  0x4e, 0x62, 0x4b, 0x61, 0x48, 0x61, 0x49, 0x62, 0x4b, 0x61, 0x4c, 0x62,
-  0x4f, 0x62, 0x50, 0x61, 0x51, 0x5f, 0x51, 0x5e, 0x52, 0x5d, 0x52, 0x5d,
-  0x53, 0x5b, 0x54, 0x5a, 0x54, 0x5a, 0x52, 0x5a, 0x51, 0x58, 0x56, 0x57,
-  0x78, 0x66, 0x84, 0x73, 0x85, 0x75, 0x84, 0x74, 0x85, 0x75, 0x85, 0x77,
-  0x85, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77,
-  0x84, 0x78, 0x85, 0x78, 0x85, 0x78, 0x84, 0x78, 0x82, 0x79, 0x83, 0x7a,
-  0x83, 0x7a, 0x83, 0x7a, 0x83, 0x7a, 0x83, 0x7a, 0x83, 0x79, 0x83, 0x78,
-  0x83, 0x78, 0x85, 0x78, 0x85, 0x77, 0x85, 0x75, 0x85, 0x76, 0x86, 0x74,
-  0x86, 0x73, 0x87, 0x73, 0x87, 0x73, 0x86, 0x74, 0x86, 0x75, 0x86, 0x74,
-  0x86, 0x73, 0x86, 0x72, 0x86, 0x70, 0x86, 0x70, 0x87, 0x70, 0x87, 0x6f,
-  0x88, 0x6e, 0x88, 0x6e, 0x88, 0x6d, 0x88, 0x6d, 0x88, 0x6f, 0x88, 0x6d,
-  0x89, 0x6d, 0x89, 0x69, 0x89, 0x66, 0x8b, 0x62, 0x8e, 0x58, 0x8f, 0x58,
-  0x91, 0x61, 0x93, 0x5f, 0x92, 0x5c, 0x93, 0x5b, 0x94, 0x58, 0x94, 0x57,
-  0x95, 0x53, 0x96, 0x49, 0x97, 0x46, 0x96, 0x46, 0x97, 0x50, 0x95, 0x5a,
-  0x95, 0x5c, 0x97, 0x53, 0x99, 0x41, 0x97, 0x43, 0x9c, 0x3c, 0x98, 0x4b,
-  0x9a, 0x3f, 0x91, 0x4d, 0x8b, 0x58, 0x84, 0x61, 0x6b, 0x7e, 0x5b, 0x8b,
-  0x5c, 0x88, 0x5a, 0x85, 0x5b, 0x84, 0x62, 0x84, 0x6c, 0x81, 0x67, 0x7b,
-  0x5f, 0x74, 0x5f, 0x78, 0x5d, 0x7a, 0x61, 0x79, 0x63, 0x79, 0x63, 0x7b,
-  0x63, 0x77, 0x5f, 0x74, 0x69, 0x71, 0x80, 0x5d, 0x91, 0x45, 0x91, 0x40,
-  0x91, 0x3e, 0x91, 0x3d, 0x92, 0x3e, 0x92, 0x3e, 0x93, 0x3f, 0x93, 0x3e,
-  0x94, 0x3c, 0x94, 0x3e, 0x92, 0x3d, 0x91, 0x3b, 0x91, 0x3d, 0x8d, 0x4b,
-  0x89, 0x58, 0x88, 0x5b, 0x8b, 0x58, 0x8e, 0x52, 0x91, 0x48, 0x92, 0x40,
-  0x94, 0x3d, 0x95, 0x3e, 0x95, 0x3e, 0x95, 0x3e, 0x95, 0x3d, 0x94, 0x40,
-  0x93, 0x44, 0x91, 0x45, 0x92, 0x40, 0x93, 0x3d, 0x93, 0x40, 0x93, 0x44,
-  0x93, 0x44, 0x95, 0x42, 0x96, 0x3d, 0x97, 0x3c, 0x97, 0x3a, 0x98, 0x3b,
-  0x98, 0x3d, 0x97, 0x3f, 0x97, 0x40, 0x97, 0x42, 0x96, 0x41, 0x96, 0x40,
-  0x97, 0x41, 0x97, 0x42, 0x4f, 0x65, 0x4f, 0x64, 0x4d, 0x62, 0x49, 0x62,
-  0x47, 0x62, 0x49, 0x62, 0x4a, 0x60, 0x4c, 0x61, 0x4e, 0x63, 0x50, 0x61,
-  0x51, 0x5f, 0x51, 0x5e, 0x52, 0x5c, 0x53, 0x5b, 0x53, 0x5b, 0x53, 0x59,
-  0x53, 0x57, 0x52, 0x5a, 0x51, 0x57, 0x5d, 0x56, 0x81, 0x6d, 0x85, 0x73,
-  0x86, 0x74, 0x84, 0x75, 0x85, 0x75, 0x85, 0x76, 0x85, 0x78, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x78,
-  0x85, 0x7a, 0x84, 0x7a, 0x82, 0x7a, 0x83, 0x7a, 0x83, 0x7a, 0x83, 0x7a,
-  0x83, 0x7a, 0x83, 0x7a, 0x83, 0x79, 0x83, 0x78, 0x84, 0x78, 0x85, 0x78,
-  0x85, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x75, 0x86, 0x73, 0x87, 0x72,
-  0x87, 0x72, 0x88, 0x71, 0x88, 0x74, 0x88, 0x73, 0x88, 0x72, 0x88, 0x71,
-  0x88, 0x71, 0x87, 0x70, 0x87, 0x6f, 0x87, 0x6f, 0x88, 0x6e, 0x88, 0x6d,
-  0x88, 0x6c, 0x87, 0x6c, 0x88, 0x6f, 0x88, 0x6e, 0x89, 0x6d, 0x8a, 0x69,
-  0x8a, 0x66, 0x8b, 0x63, 0x8c, 0x5c, 0x8d, 0x56, 0x91, 0x5d, 0x93, 0x5e,
-  0x93, 0x5c, 0x92, 0x5b, 0x94, 0x58, 0x95, 0x56, 0x95, 0x55, 0x95, 0x4d,
-  0x97, 0x45, 0x96, 0x45, 0x98, 0x4e, 0x96, 0x59, 0x95, 0x5d, 0x95, 0x59,
-  0x98, 0x44, 0x96, 0x44, 0x9b, 0x3e, 0x9b, 0x47, 0x9a, 0x47, 0x91, 0x4e,
-  0x78, 0x6a, 0x6d, 0x79, 0x5f, 0x88, 0x5c, 0x88, 0x5e, 0x88, 0x63, 0x88,
-  0x64, 0x86, 0x65, 0x84, 0x6e, 0x80, 0x65, 0x7a, 0x5e, 0x76, 0x60, 0x79,
-  0x5e, 0x7b, 0x62, 0x79, 0x63, 0x7b, 0x63, 0x7b, 0x63, 0x75, 0x61, 0x73,
-  0x72, 0x68, 0x89, 0x53, 0x92, 0x43, 0x91, 0x3f, 0x90, 0x3e, 0x92, 0x3e,
-  0x94, 0x3e, 0x94, 0x3f, 0x94, 0x40, 0x95, 0x3e, 0x95, 0x3c, 0x93, 0x40,
-  0x91, 0x3f, 0x91, 0x3b, 0x91, 0x3e, 0x8c, 0x50, 0x89, 0x59, 0x88, 0x5c,
-  0x8c, 0x55, 0x91, 0x4a, 0x95, 0x3f, 0x95, 0x3b, 0x96, 0x39, 0x97, 0x39,
-  0x96, 0x3b, 0x95, 0x3c, 0x95, 0x3c, 0x96, 0x3b, 0x96, 0x3d, 0x95, 0x40,
-  0x92, 0x42, 0x94, 0x43, 0x94, 0x41, 0x92, 0x41, 0x92, 0x44, 0x96, 0x42,
-  0x98, 0x3d, 0x98, 0x39, 0x98, 0x39, 0x98, 0x3a, 0x98, 0x3b, 0x98, 0x3e,
-  0x97, 0x41, 0x96, 0x44, 0x95, 0x43, 0x95, 0x42, 0x97, 0x42, 0x97, 0x43,
-  0x4a, 0x63, 0x49, 0x63, 0x47, 0x61, 0x47, 0x61, 0x47, 0x62, 0x49, 0x62,
-  0x4a, 0x60, 0x4c, 0x61, 0x4e, 0x62, 0x4f, 0x60, 0x51, 0x5f, 0x51, 0x5e,
-  0x52, 0x5b, 0x53, 0x5b, 0x53, 0x5b, 0x53, 0x59, 0x53, 0x57, 0x52, 0x58,
-  0x57, 0x57, 0x6f, 0x5d, 0x85, 0x71, 0x86, 0x73, 0x86, 0x74, 0x84, 0x76,
-  0x84, 0x75, 0x84, 0x76, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77,
-  0x84, 0x78, 0x84, 0x78, 0x85, 0x78, 0x85, 0x78, 0x85, 0x7a, 0x85, 0x7a,
-  0x82, 0x7a, 0x82, 0x7a, 0x82, 0x7a, 0x82, 0x7a, 0x82, 0x7a, 0x83, 0x7a,
-  0x83, 0x79, 0x83, 0x78, 0x83, 0x78, 0x84, 0x78, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x78, 0x85, 0x75, 0x86, 0x73, 0x87, 0x72, 0x87, 0x72, 0x88, 0x6f,
-  0x88, 0x6e, 0x88, 0x6f, 0x88, 0x71, 0x88, 0x70, 0x88, 0x6f, 0x88, 0x6e,
-  0x88, 0x6e, 0x87, 0x6d, 0x88, 0x6c, 0x88, 0x6c, 0x88, 0x6c, 0x88, 0x6c,
-  0x88, 0x6c, 0x88, 0x6c, 0x89, 0x6b, 0x89, 0x6b, 0x8a, 0x68, 0x8a, 0x65,
-  0x8b, 0x61, 0x8e, 0x5b, 0x8f, 0x55, 0x91, 0x59, 0x93, 0x5d, 0x92, 0x5b,
-  0x94, 0x59, 0x95, 0x57, 0x95, 0x56, 0x95, 0x51, 0x97, 0x4a, 0x97, 0x44,
-  0x95, 0x4a, 0x96, 0x52, 0x95, 0x5d, 0x95, 0x5c, 0x97, 0x48, 0x97, 0x43,
-  0x99, 0x40, 0x9c, 0x40, 0x98, 0x4f, 0x8d, 0x4f, 0x63, 0x7e, 0x5b, 0x86,
-  0x5b, 0x85, 0x5d, 0x88, 0x60, 0x89, 0x70, 0x89, 0x6f, 0x87, 0x69, 0x84,
-  0x6b, 0x80, 0x63, 0x7a, 0x5f, 0x7b, 0x5c, 0x7c, 0x5d, 0x7c, 0x5f, 0x7d,
-  0x61, 0x7f, 0x64, 0x7b, 0x64, 0x72, 0x66, 0x6e, 0x82, 0x57, 0x90, 0x49,
-  0x93, 0x41, 0x93, 0x3e, 0x92, 0x3d, 0x94, 0x3e, 0x95, 0x3e, 0x95, 0x3e,
-  0x94, 0x3e, 0x95, 0x3e, 0x94, 0x3d, 0x92, 0x42, 0x92, 0x44, 0x92, 0x40,
-  0x8f, 0x44, 0x8c, 0x55, 0x8a, 0x5b, 0x8d, 0x54, 0x92, 0x45, 0x95, 0x3e,
-  0x94, 0x3d, 0x93, 0x40, 0x94, 0x41, 0x95, 0x40, 0x95, 0x41, 0x95, 0x42,
-  0x96, 0x42, 0x98, 0x3d, 0x98, 0x3a, 0x96, 0x3c, 0x94, 0x43, 0x94, 0x44,
-  0x94, 0x41, 0x94, 0x3f, 0x94, 0x3f, 0x96, 0x3a, 0x98, 0x39, 0x98, 0x39,
-  0x98, 0x3b, 0x97, 0x3c, 0x96, 0x3c, 0x96, 0x3f, 0x97, 0x42, 0x96, 0x42,
-  0x95, 0x42, 0x96, 0x42, 0x97, 0x41, 0x97, 0x40, 0x45, 0x61, 0x45, 0x61,
-  0x44, 0x5f, 0x46, 0x5f, 0x47, 0x61, 0x49, 0x62, 0x4b, 0x60, 0x4c, 0x62,
-  0x4e, 0x62, 0x4f, 0x60, 0x51, 0x5f, 0x51, 0x5e, 0x52, 0x5b, 0x53, 0x5b,
-  0x53, 0x5b, 0x53, 0x59, 0x53, 0x57, 0x53, 0x56, 0x61, 0x58, 0x7a, 0x66,
-  0x86, 0x71, 0x86, 0x72, 0x86, 0x74, 0x84, 0x75, 0x84, 0x75, 0x84, 0x76,
-  0x84, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x85, 0x78, 0x85, 0x7a, 0x85, 0x7a, 0x82, 0x7a, 0x83, 0x7a,
-  0x82, 0x7a, 0x83, 0x7a, 0x83, 0x7a, 0x83, 0x7a, 0x82, 0x79, 0x82, 0x78,
-  0x83, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x75,
-  0x85, 0x73, 0x87, 0x73, 0x87, 0x72, 0x88, 0x71, 0x88, 0x6f, 0x88, 0x6e,
-  0x88, 0x6f, 0x88, 0x6e, 0x88, 0x6d, 0x89, 0x6d, 0x8a, 0x6c, 0x88, 0x6b,
-  0x88, 0x6a, 0x88, 0x6c, 0x88, 0x6d, 0x88, 0x6c, 0x88, 0x6a, 0x88, 0x6b,
-  0x89, 0x69, 0x89, 0x6c, 0x8a, 0x6a, 0x8a, 0x66, 0x8c, 0x61, 0x8e, 0x5f,
-  0x8e, 0x55, 0x8f, 0x56, 0x92, 0x5c, 0x92, 0x5c, 0x93, 0x5a, 0x95, 0x58,
-  0x96, 0x57, 0x95, 0x53, 0x96, 0x4d, 0x98, 0x44, 0x94, 0x45, 0x97, 0x4c,
-  0x95, 0x5c, 0x95, 0x5f, 0x97, 0x4b, 0x97, 0x41, 0x97, 0x40, 0x9d, 0x39,
-  0x97, 0x4f, 0x93, 0x4f, 0x66, 0x7f, 0x5b, 0x88, 0x59, 0x82, 0x5e, 0x87,
-  0x5f, 0x8a, 0x68, 0x8b, 0x6b, 0x88, 0x66, 0x85, 0x67, 0x7f, 0x61, 0x7a,
-  0x61, 0x7e, 0x5a, 0x7f, 0x5b, 0x7c, 0x5e, 0x80, 0x60, 0x82, 0x66, 0x7b,
-  0x65, 0x6f, 0x6e, 0x67, 0x8b, 0x4e, 0x92, 0x45, 0x95, 0x3f, 0x95, 0x3d,
-  0x94, 0x3d, 0x94, 0x3e, 0x94, 0x3e, 0x95, 0x3d, 0x94, 0x3c, 0x95, 0x3d,
-  0x95, 0x3f, 0x93, 0x43, 0x92, 0x49, 0x92, 0x44, 0x8c, 0x4a, 0x8c, 0x58,
-  0x8b, 0x58, 0x91, 0x48, 0x94, 0x3d, 0x93, 0x3f, 0x91, 0x43, 0x91, 0x43,
-  0x93, 0x43, 0x94, 0x43, 0x94, 0x44, 0x95, 0x44, 0x96, 0x42, 0x99, 0x3e,
-  0x99, 0x38, 0x98, 0x3a, 0x95, 0x42, 0x94, 0x44, 0x94, 0x41, 0x95, 0x3e,
-  0x95, 0x3b, 0x97, 0x38, 0x98, 0x3b, 0x98, 0x3d, 0x98, 0x40, 0x97, 0x41,
-  0x95, 0x42, 0x95, 0x44, 0x97, 0x43, 0x96, 0x41, 0x95, 0x42, 0x95, 0x42,
-  0x97, 0x40, 0x97, 0x3f, 0x44, 0x60, 0x43, 0x5e, 0x44, 0x5d, 0x47, 0x5f,
-  0x48, 0x60, 0x49, 0x61, 0x4c, 0x60, 0x4d, 0x62, 0x4f, 0x64, 0x50, 0x62,
-  0x51, 0x61, 0x51, 0x5f, 0x52, 0x5c, 0x53, 0x5d, 0x53, 0x5d, 0x53, 0x57,
-  0x53, 0x55, 0x54, 0x55, 0x6d, 0x5d, 0x83, 0x6c, 0x85, 0x71, 0x86, 0x74,
-  0x85, 0x76, 0x85, 0x74, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x76,
-  0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x78,
-  0x85, 0x78, 0x85, 0x78, 0x84, 0x78, 0x84, 0x79, 0x84, 0x79, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x85, 0x78, 0x85, 0x77, 0x85, 0x76, 0x86, 0x75,
-  0x86, 0x75, 0x86, 0x73, 0x86, 0x70, 0x87, 0x6f, 0x88, 0x6d, 0x88, 0x6c,
-  0x88, 0x6c, 0x88, 0x6c, 0x89, 0x6b, 0x8a, 0x69, 0x8b, 0x6a, 0x88, 0x6a,
-  0x89, 0x6c, 0x89, 0x6b, 0x8a, 0x6b, 0x8a, 0x6b, 0x89, 0x6a, 0x89, 0x6b,
-  0x8a, 0x6b, 0x8b, 0x67, 0x8d, 0x63, 0x8e, 0x60, 0x8e, 0x59, 0x8f, 0x53,
-  0x90, 0x59, 0x92, 0x5b, 0x94, 0x59, 0x95, 0x58, 0x94, 0x58, 0x95, 0x56,
-  0x95, 0x51, 0x97, 0x47, 0x95, 0x43, 0x95, 0x4a, 0x96, 0x59, 0x94, 0x60,
-  0x97, 0x4f, 0x96, 0x41, 0x99, 0x40, 0x9e, 0x39, 0x9a, 0x44, 0x97, 0x4f,
-  0x73, 0x7b, 0x61, 0x8a, 0x5b, 0x81, 0x5e, 0x85, 0x5c, 0x89, 0x64, 0x8c,
-  0x6e, 0x8c, 0x6a, 0x86, 0x63, 0x81, 0x60, 0x80, 0x5d, 0x81, 0x5a, 0x7f,
-  0x5c, 0x7e, 0x5d, 0x82, 0x60, 0x81, 0x65, 0x78, 0x68, 0x6f, 0x77, 0x62,
-  0x8f, 0x4a, 0x92, 0x44, 0x94, 0x3f, 0x95, 0x3e, 0x95, 0x3f, 0x94, 0x41,
-  0x94, 0x40, 0x95, 0x3e, 0x94, 0x3d, 0x94, 0x3f, 0x93, 0x43, 0x90, 0x49,
-  0x90, 0x4c, 0x90, 0x46, 0x8e, 0x4c, 0x8d, 0x55, 0x8f, 0x4f, 0x93, 0x40,
-  0x92, 0x41, 0x92, 0x44, 0x93, 0x45, 0x94, 0x43, 0x95, 0x42, 0x96, 0x43,
-  0x95, 0x45, 0x96, 0x44, 0x97, 0x41, 0x9a, 0x3c, 0x9a, 0x38, 0x9a, 0x38,
-  0x99, 0x3f, 0x95, 0x45, 0x94, 0x40, 0x95, 0x3c, 0x96, 0x3c, 0x96, 0x3d,
-  0x96, 0x40, 0x95, 0x42, 0x95, 0x44, 0x94, 0x44, 0x94, 0x45, 0x94, 0x46,
-  0x96, 0x45, 0x96, 0x43, 0x97, 0x42, 0x97, 0x40, 0x98, 0x40, 0x98, 0x40,
-  0x43, 0x60, 0x44, 0x5d, 0x46, 0x5c, 0x47, 0x5e, 0x49, 0x61, 0x4a, 0x61,
-  0x4d, 0x60, 0x4e, 0x62, 0x50, 0x64, 0x51, 0x62, 0x51, 0x5f, 0x52, 0x5f,
-  0x52, 0x5e, 0x53, 0x5d, 0x54, 0x5d, 0x53, 0x59, 0x53, 0x57, 0x58, 0x56,
-  0x7b, 0x63, 0x87, 0x6f, 0x86, 0x72, 0x85, 0x74, 0x85, 0x75, 0x85, 0x75,
-  0x86, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x76, 0x85, 0x77, 0x85, 0x77,
-  0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x78, 0x84, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x85, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x85, 0x77, 0x84, 0x78, 0x85, 0x75, 0x85, 0x75, 0x86, 0x74,
-  0x85, 0x72, 0x86, 0x70, 0x87, 0x6e, 0x87, 0x6d, 0x88, 0x6c, 0x89, 0x6c,
-  0x8a, 0x6a, 0x8a, 0x68, 0x8b, 0x69, 0x8a, 0x69, 0x8a, 0x6a, 0x8a, 0x6a,
-  0x8b, 0x6a, 0x8b, 0x6a, 0x8a, 0x6a, 0x8a, 0x6a, 0x8a, 0x69, 0x8b, 0x66,
-  0x8d, 0x65, 0x8d, 0x61, 0x8f, 0x5b, 0x8f, 0x55, 0x90, 0x56, 0x92, 0x58,
-  0x94, 0x58, 0x94, 0x58, 0x94, 0x58, 0x95, 0x57, 0x95, 0x54, 0x97, 0x4c,
-  0x96, 0x44, 0x94, 0x46, 0x95, 0x54, 0x93, 0x5e, 0x97, 0x52, 0x95, 0x43,
-  0x98, 0x3f, 0x9e, 0x3a, 0x9c, 0x3d, 0x98, 0x51, 0x80, 0x70, 0x6a, 0x85,
-  0x61, 0x82, 0x60, 0x83, 0x5f, 0x86, 0x63, 0x89, 0x72, 0x8b, 0x72, 0x89,
-  0x67, 0x8a, 0x5d, 0x8d, 0x56, 0x85, 0x5a, 0x80, 0x5f, 0x82, 0x61, 0x84,
-  0x65, 0x80, 0x68, 0x77, 0x6f, 0x6a, 0x83, 0x57, 0x94, 0x46, 0x94, 0x42,
-  0x94, 0x3f, 0x94, 0x3d, 0x94, 0x3e, 0x94, 0x42, 0x94, 0x42, 0x94, 0x40,
-  0x94, 0x41, 0x93, 0x44, 0x90, 0x4a, 0x90, 0x4c, 0x8f, 0x4b, 0x90, 0x48,
-  0x91, 0x4a, 0x91, 0x48, 0x94, 0x40, 0x91, 0x42, 0x91, 0x46, 0x92, 0x46,
-  0x94, 0x44, 0x97, 0x41, 0x97, 0x40, 0x98, 0x41, 0x97, 0x43, 0x98, 0x42,
-  0x99, 0x3f, 0x9a, 0x3c, 0x9a, 0x3b, 0x9a, 0x3a, 0x9a, 0x3c, 0x96, 0x43,
-  0x96, 0x41, 0x96, 0x3a, 0x94, 0x3c, 0x94, 0x45, 0x94, 0x48, 0x93, 0x48,
-  0x92, 0x47, 0x93, 0x47, 0x94, 0x46, 0x94, 0x46, 0x95, 0x45, 0x96, 0x43,
-  0x97, 0x42, 0x97, 0x3f, 0x98, 0x3d, 0x98, 0x3d, 0x44, 0x60, 0x44, 0x5d,
-  0x46, 0x5c, 0x48, 0x5e, 0x49, 0x61, 0x4c, 0x61, 0x4f, 0x60, 0x4f, 0x62,
-  0x50, 0x63, 0x51, 0x62, 0x52, 0x5e, 0x52, 0x5e, 0x52, 0x5f, 0x53, 0x5d,
-  0x53, 0x5d, 0x53, 0x5a, 0x52, 0x58, 0x5c, 0x59, 0x83, 0x67, 0x88, 0x6f,
-  0x86, 0x71, 0x85, 0x74, 0x85, 0x75, 0x85, 0x75, 0x86, 0x75, 0x86, 0x75,
-  0x85, 0x75, 0x85, 0x76, 0x84, 0x78, 0x84, 0x77, 0x85, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x78, 0x84, 0x77, 0x84, 0x78,
-  0x84, 0x78, 0x85, 0x78, 0x85, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x75, 0x85, 0x75, 0x86, 0x76, 0x86, 0x73, 0x85, 0x72,
-  0x85, 0x6f, 0x86, 0x6e, 0x88, 0x6d, 0x89, 0x6c, 0x8a, 0x6a, 0x89, 0x68,
-  0x8a, 0x67, 0x8c, 0x68, 0x8a, 0x69, 0x8a, 0x68, 0x8b, 0x68, 0x8a, 0x68,
-  0x8a, 0x6a, 0x89, 0x6a, 0x8a, 0x68, 0x8b, 0x65, 0x8d, 0x66, 0x8d, 0x62,
-  0x8e, 0x5d, 0x8f, 0x58, 0x90, 0x53, 0x93, 0x54, 0x94, 0x58, 0x94, 0x58,
-  0x94, 0x58, 0x95, 0x58, 0x95, 0x54, 0x97, 0x50, 0x96, 0x46, 0x94, 0x44,
-  0x95, 0x50, 0x93, 0x5d, 0x97, 0x54, 0x94, 0x44, 0x97, 0x3f, 0x9c, 0x3b,
-  0x9c, 0x40, 0x98, 0x50, 0x84, 0x66, 0x6c, 0x82, 0x64, 0x84, 0x63, 0x82,
-  0x63, 0x83, 0x62, 0x86, 0x6c, 0x89, 0x72, 0x8c, 0x70, 0x91, 0x61, 0x96,
-  0x56, 0x88, 0x5a, 0x80, 0x63, 0x85, 0x66, 0x87, 0x69, 0x81, 0x6b, 0x78,
-  0x74, 0x65, 0x8a, 0x4f, 0x94, 0x45, 0x94, 0x42, 0x95, 0x3f, 0x93, 0x3c,
-  0x94, 0x3d, 0x94, 0x40, 0x94, 0x3f, 0x94, 0x3d, 0x94, 0x3f, 0x93, 0x43,
-  0x93, 0x46, 0x95, 0x44, 0x95, 0x40, 0x95, 0x40, 0x94, 0x40, 0x94, 0x40,
-  0x94, 0x41, 0x91, 0x46, 0x92, 0x48, 0x92, 0x47, 0x95, 0x43, 0x98, 0x3f,
-  0x99, 0x3e, 0x99, 0x40, 0x98, 0x42, 0x99, 0x40, 0x9b, 0x3d, 0x9b, 0x3c,
-  0x9a, 0x3e, 0x9a, 0x3c, 0x99, 0x3a, 0x98, 0x3d, 0x98, 0x3d, 0x98, 0x3d,
-  0x94, 0x42, 0x91, 0x48, 0x92, 0x4b, 0x92, 0x4b, 0x91, 0x4a, 0x92, 0x48,
-  0x94, 0x47, 0x94, 0x47, 0x95, 0x45, 0x96, 0x43, 0x97, 0x42, 0x97, 0x3e,
-  0x98, 0x3a, 0x98, 0x3a, 0x45, 0x61, 0x44, 0x60, 0x46, 0x60, 0x49, 0x5f,
-  0x4b, 0x5f, 0x4e, 0x60, 0x50, 0x60, 0x51, 0x62, 0x52, 0x64, 0x53, 0x62,
-  0x52, 0x5f, 0x51, 0x60, 0x51, 0x60, 0x52, 0x5f, 0x52, 0x5e, 0x50, 0x5c,
-  0x51, 0x5c, 0x5f, 0x5c, 0x84, 0x6c, 0x88, 0x6f, 0x88, 0x70, 0x87, 0x73,
-  0x86, 0x73, 0x87, 0x73, 0x87, 0x74, 0x86, 0x74, 0x86, 0x75, 0x85, 0x75,
-  0x85, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x85, 0x79, 0x85, 0x78,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x78, 0x85, 0x78, 0x84, 0x77,
-  0x84, 0x77, 0x84, 0x77, 0x83, 0x78, 0x86, 0x77, 0x86, 0x77, 0x85, 0x76,
-  0x85, 0x76, 0x86, 0x76, 0x86, 0x75, 0x85, 0x73, 0x85, 0x72, 0x86, 0x71,
-  0x87, 0x6e, 0x88, 0x6c, 0x89, 0x6b, 0x89, 0x69, 0x89, 0x67, 0x8c, 0x65,
-  0x8b, 0x65, 0x89, 0x66, 0x89, 0x67, 0x8c, 0x66, 0x8c, 0x68, 0x8b, 0x69,
-  0x8a, 0x68, 0x8a, 0x66, 0x8c, 0x65, 0x8d, 0x62, 0x8e, 0x5d, 0x8e, 0x5b,
-  0x8e, 0x55, 0x91, 0x51, 0x93, 0x55, 0x93, 0x58, 0x93, 0x58, 0x94, 0x59,
-  0x96, 0x55, 0x96, 0x52, 0x96, 0x4a, 0x95, 0x44, 0x96, 0x4b, 0x96, 0x5b,
-  0x97, 0x54, 0x94, 0x45, 0x95, 0x41, 0x9c, 0x3c, 0x9d, 0x47, 0x99, 0x4f,
-  0x8b, 0x5b, 0x71, 0x79, 0x67, 0x83, 0x67, 0x83, 0x65, 0x82, 0x64, 0x83,
-  0x65, 0x87, 0x6f, 0x8e, 0x7a, 0x95, 0x68, 0x9a, 0x58, 0x8a, 0x59, 0x83,
-  0x64, 0x86, 0x68, 0x87, 0x6b, 0x80, 0x6d, 0x75, 0x7d, 0x5d, 0x8f, 0x4a,
-  0x92, 0x45, 0x93, 0x41, 0x94, 0x3e, 0x94, 0x3c, 0x95, 0x3c, 0x95, 0x3c,
-  0x96, 0x3a, 0x96, 0x3b, 0x96, 0x3c, 0x96, 0x3d, 0x97, 0x3e, 0x98, 0x3c,
-  0x99, 0x3a, 0x97, 0x39, 0x95, 0x3d, 0x93, 0x43, 0x91, 0x49, 0x91, 0x49,
-  0x92, 0x48, 0x93, 0x47, 0x97, 0x43, 0x9a, 0x3f, 0x99, 0x3d, 0x99, 0x3f,
-  0x99, 0x40, 0x99, 0x3f, 0x9a, 0x3d, 0x9a, 0x3f, 0x9a, 0x3e, 0x9a, 0x3b,
-  0x9a, 0x3b, 0x9a, 0x3b, 0x9a, 0x3b, 0x98, 0x40, 0x94, 0x47, 0x91, 0x4a,
-  0x91, 0x4c, 0x91, 0x4d, 0x92, 0x4c, 0x92, 0x4b, 0x92, 0x49, 0x93, 0x48,
-  0x95, 0x46, 0x96, 0x42, 0x96, 0x3e, 0x97, 0x3c, 0x99, 0x39, 0x98, 0x36,
-  0x47, 0x61, 0x45, 0x61, 0x47, 0x62, 0x49, 0x5f, 0x4c, 0x5f, 0x4f, 0x60,
-  0x52, 0x5f, 0x53, 0x61, 0x53, 0x64, 0x54, 0x63, 0x53, 0x60, 0x51, 0x60,
-  0x51, 0x60, 0x52, 0x5f, 0x51, 0x5f, 0x50, 0x5e, 0x51, 0x5d, 0x69, 0x5f,
-  0x87, 0x6c, 0x88, 0x6e, 0x88, 0x6f, 0x87, 0x73, 0x87, 0x73, 0x87, 0x72,
-  0x87, 0x73, 0x86, 0x74, 0x85, 0x74, 0x85, 0x75, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x78, 0x86, 0x78, 0x86, 0x78, 0x86, 0x77, 0x86, 0x77,
-  0x86, 0x77, 0x85, 0x78, 0x85, 0x77, 0x85, 0x75, 0x85, 0x76, 0x85, 0x76,
-  0x85, 0x76, 0x86, 0x76, 0x86, 0x75, 0x86, 0x75, 0x85, 0x75, 0x86, 0x75,
-  0x86, 0x75, 0x85, 0x73, 0x85, 0x73, 0x86, 0x73, 0x87, 0x6f, 0x87, 0x6d,
-  0x88, 0x6c, 0x89, 0x6a, 0x89, 0x68, 0x8b, 0x64, 0x8c, 0x61, 0x8b, 0x61,
-  0x8b, 0x65, 0x8c, 0x66, 0x8c, 0x66, 0x8d, 0x66, 0x8c, 0x66, 0x8b, 0x66,
-  0x8d, 0x64, 0x8c, 0x61, 0x8d, 0x5e, 0x8d, 0x5c, 0x8d, 0x59, 0x8f, 0x53,
-  0x91, 0x51, 0x92, 0x55, 0x92, 0x57, 0x94, 0x58, 0x96, 0x56, 0x95, 0x53,
-  0x95, 0x4c, 0x95, 0x44, 0x96, 0x48, 0x96, 0x57, 0x97, 0x54, 0x94, 0x45,
-  0x94, 0x44, 0x9c, 0x3a, 0x9d, 0x44, 0x99, 0x52, 0x91, 0x56, 0x78, 0x70,
-  0x69, 0x82, 0x67, 0x82, 0x64, 0x81, 0x64, 0x82, 0x65, 0x85, 0x70, 0x8f,
-  0x7e, 0x95, 0x6f, 0x99, 0x5c, 0x8c, 0x5a, 0x85, 0x62, 0x85, 0x69, 0x85,
-  0x6a, 0x7f, 0x6f, 0x70, 0x84, 0x57, 0x92, 0x48, 0x92, 0x43, 0x94, 0x41,
-  0x94, 0x3e, 0x95, 0x3d, 0x96, 0x3c, 0x97, 0x3c, 0x97, 0x3c, 0x96, 0x3c,
-  0x97, 0x3c, 0x97, 0x3d, 0x97, 0x3e, 0x97, 0x3d, 0x98, 0x3b, 0x95, 0x3d,
-  0x94, 0x42, 0x91, 0x47, 0x91, 0x4a, 0x91, 0x4a, 0x93, 0x48, 0x95, 0x46,
-  0x98, 0x41, 0x99, 0x3d, 0x99, 0x3d, 0x99, 0x3f, 0x99, 0x40, 0x99, 0x3e,
-  0x99, 0x3d, 0x99, 0x40, 0x99, 0x3e, 0x9a, 0x3b, 0x9a, 0x3c, 0x9a, 0x3d,
-  0x9a, 0x3c, 0x97, 0x3d, 0x95, 0x42, 0x93, 0x48, 0x92, 0x4b, 0x93, 0x4e,
-  0x93, 0x4c, 0x93, 0x4b, 0x93, 0x48, 0x94, 0x46, 0x96, 0x42, 0x96, 0x3d,
-  0x97, 0x3b, 0x98, 0x3a, 0x99, 0x39, 0x99, 0x38, 0x4a, 0x61, 0x48, 0x61,
-  0x48, 0x61, 0x4c, 0x60, 0x4e, 0x5f, 0x52, 0x5f, 0x54, 0x60, 0x54, 0x61,
-  0x55, 0x65, 0x56, 0x65, 0x54, 0x62, 0x51, 0x60, 0x51, 0x60, 0x51, 0x5f,
-  0x51, 0x5f, 0x50, 0x60, 0x52, 0x5f, 0x70, 0x63, 0x87, 0x6b, 0x87, 0x6c,
-  0x88, 0x70, 0x87, 0x73, 0x87, 0x73, 0x86, 0x73, 0x87, 0x73, 0x86, 0x74,
-  0x85, 0x75, 0x85, 0x75, 0x85, 0x77, 0x85, 0x77, 0x84, 0x77, 0x85, 0x77,
-  0x84, 0x79, 0x84, 0x79, 0x84, 0x79, 0x84, 0x79, 0x84, 0x78, 0x84, 0x78,
-  0x85, 0x78, 0x86, 0x78, 0x85, 0x77, 0x85, 0x77, 0x85, 0x76, 0x85, 0x75,
-  0x85, 0x75, 0x86, 0x74, 0x87, 0x74, 0x86, 0x73, 0x86, 0x74, 0x85, 0x74,
-  0x86, 0x74, 0x85, 0x73, 0x86, 0x73, 0x85, 0x73, 0x85, 0x73, 0x85, 0x73,
-  0x85, 0x73, 0x86, 0x73, 0x87, 0x71, 0x87, 0x6f, 0x87, 0x6e, 0x88, 0x6a,
-  0x8a, 0x68, 0x8a, 0x66, 0x8c, 0x63, 0x8d, 0x5f, 0x8e, 0x62, 0x8c, 0x66,
-  0x8c, 0x65, 0x8d, 0x65, 0x8d, 0x65, 0x8d, 0x65, 0x8d, 0x64, 0x8c, 0x61,
-  0x8d, 0x5f, 0x8d, 0x5d, 0x8c, 0x5b, 0x8d, 0x57, 0x90, 0x4f, 0x93, 0x4f,
-  0x92, 0x53, 0x94, 0x57, 0x95, 0x56, 0x95, 0x54, 0x95, 0x4c, 0x95, 0x43,
-  0x96, 0x44, 0x96, 0x50, 0x97, 0x54, 0x94, 0x45, 0x92, 0x46, 0x9a, 0x3c,
-  0x9d, 0x3d, 0x99, 0x53, 0x95, 0x55, 0x81, 0x67, 0x6a, 0x81, 0x66, 0x80,
-  0x62, 0x80, 0x62, 0x81, 0x65, 0x85, 0x75, 0x8f, 0x82, 0x95, 0x79, 0x97,
-  0x61, 0x8f, 0x5b, 0x86, 0x5f, 0x83, 0x6a, 0x81, 0x6b, 0x7b, 0x73, 0x69,
-  0x8c, 0x50, 0x92, 0x45, 0x92, 0x41, 0x93, 0x41, 0x94, 0x3f, 0x95, 0x3e,
-  0x95, 0x3e, 0x96, 0x3e, 0x97, 0x3e, 0x97, 0x3e, 0x97, 0x3e, 0x97, 0x3f,
-  0x97, 0x3f, 0x97, 0x3e, 0x96, 0x3e, 0x94, 0x42, 0x93, 0x47, 0x90, 0x49,
-  0x91, 0x4a, 0x92, 0x4a, 0x94, 0x47, 0x96, 0x44, 0x99, 0x3f, 0x99, 0x3b,
-  0x99, 0x3c, 0x99, 0x3f, 0x99, 0x41, 0x99, 0x3e, 0x99, 0x3d, 0x99, 0x42,
-  0x9a, 0x3f, 0x9a, 0x3d, 0x9a, 0x3d, 0x9a, 0x3e, 0x9a, 0x3e, 0x99, 0x3e,
-  0x97, 0x3f, 0x95, 0x41, 0x95, 0x43, 0x95, 0x46, 0x95, 0x46, 0x96, 0x43,
-  0x98, 0x40, 0x98, 0x3e, 0x97, 0x3b, 0x98, 0x39, 0x99, 0x39, 0x99, 0x39,
-  0x99, 0x39, 0x99, 0x3b, 0x4d, 0x61, 0x4b, 0x61, 0x4a, 0x60, 0x4e, 0x60,
-  0x51, 0x5f, 0x55, 0x5d, 0x57, 0x5e, 0x56, 0x61, 0x58, 0x64, 0x58, 0x65,
-  0x55, 0x63, 0x53, 0x62, 0x53, 0x61, 0x52, 0x60, 0x51, 0x60, 0x51, 0x60,
-  0x56, 0x5d, 0x78, 0x64, 0x88, 0x6c, 0x88, 0x6b, 0x89, 0x6f, 0x87, 0x71,
-  0x87, 0x71, 0x87, 0x72, 0x87, 0x72, 0x87, 0x73, 0x86, 0x74, 0x86, 0x74,
-  0x85, 0x76, 0x85, 0x76, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x84, 0x77,
-  0x84, 0x77, 0x85, 0x77, 0x85, 0x78, 0x85, 0x79, 0x85, 0x78, 0x85, 0x78,
-  0x85, 0x78, 0x85, 0x77, 0x85, 0x77, 0x86, 0x75, 0x86, 0x75, 0x87, 0x74,
-  0x87, 0x74, 0x88, 0x73, 0x87, 0x73, 0x87, 0x73, 0x87, 0x72, 0x87, 0x71,
-  0x87, 0x71, 0x87, 0x72, 0x87, 0x73, 0x87, 0x72, 0x86, 0x73, 0x87, 0x72,
-  0x87, 0x71, 0x87, 0x70, 0x86, 0x6f, 0x87, 0x6e, 0x88, 0x6c, 0x88, 0x69,
-  0x8a, 0x65, 0x8b, 0x61, 0x8d, 0x5f, 0x8d, 0x62, 0x8c, 0x64, 0x8e, 0x62,
-  0x8e, 0x62, 0x8e, 0x63, 0x8d, 0x64, 0x8d, 0x62, 0x8d, 0x60, 0x8d, 0x5e,
-  0x8d, 0x5b, 0x8d, 0x5a, 0x8f, 0x52, 0x92, 0x4c, 0x92, 0x50, 0x94, 0x56,
-  0x95, 0x57, 0x95, 0x54, 0x95, 0x4e, 0x96, 0x44, 0x96, 0x42, 0x97, 0x4a,
-  0x98, 0x52, 0x95, 0x46, 0x91, 0x48, 0x98, 0x41, 0x9c, 0x3d, 0x98, 0x4f,
-  0x97, 0x5b, 0x89, 0x62, 0x69, 0x80, 0x63, 0x7f, 0x61, 0x7f, 0x62, 0x81,
-  0x66, 0x86, 0x7b, 0x8f, 0x8a, 0x93, 0x86, 0x94, 0x6d, 0x91, 0x60, 0x88,
-  0x5d, 0x81, 0x67, 0x7d, 0x68, 0x7a, 0x78, 0x64, 0x92, 0x4b, 0x92, 0x44,
-  0x92, 0x42, 0x93, 0x41, 0x94, 0x40, 0x95, 0x40, 0x95, 0x41, 0x95, 0x40,
-  0x95, 0x3f, 0x95, 0x3f, 0x95, 0x3e, 0x95, 0x40, 0x97, 0x3f, 0x97, 0x3d,
-  0x96, 0x41, 0x93, 0x47, 0x91, 0x4a, 0x90, 0x4a, 0x91, 0x4a, 0x92, 0x48,
-  0x96, 0x45, 0x97, 0x42, 0x99, 0x3d, 0x99, 0x3d, 0x99, 0x3c, 0x98, 0x3e,
-  0x99, 0x40, 0x99, 0x40, 0x98, 0x41, 0x99, 0x44, 0x9a, 0x40, 0x9a, 0x3d,
-  0x9a, 0x3e, 0x9b, 0x3e, 0x9a, 0x3f, 0x98, 0x42, 0x96, 0x44, 0x96, 0x41,
-  0x97, 0x3e, 0x96, 0x3d, 0x97, 0x3c, 0x98, 0x3b, 0x99, 0x3a, 0x99, 0x39,
-  0x99, 0x3a, 0x99, 0x3b, 0x98, 0x3c, 0x97, 0x3c, 0x98, 0x3d, 0x98, 0x3e,
-  0x4f, 0x62, 0x4d, 0x62, 0x4c, 0x60, 0x50, 0x61, 0x53, 0x60, 0x57, 0x5d,
-  0x59, 0x5e, 0x58, 0x61, 0x59, 0x63, 0x5a, 0x63, 0x56, 0x63, 0x55, 0x63,
-  0x55, 0x60, 0x55, 0x61, 0x55, 0x60, 0x54, 0x5f, 0x5c, 0x5c, 0x81, 0x63,
-  0x89, 0x6d, 0x89, 0x6c, 0x8a, 0x6e, 0x88, 0x70, 0x88, 0x70, 0x88, 0x71,
-  0x88, 0x72, 0x87, 0x72, 0x87, 0x73, 0x87, 0x73, 0x85, 0x75, 0x85, 0x75,
-  0x86, 0x78, 0x86, 0x77, 0x86, 0x77, 0x86, 0x77, 0x86, 0x77, 0x86, 0x77,
-  0x86, 0x78, 0x86, 0x79, 0x85, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x77,
-  0x84, 0x77, 0x85, 0x77, 0x85, 0x76, 0x86, 0x76, 0x86, 0x75, 0x86, 0x74,
-  0x87, 0x74, 0x88, 0x73, 0x88, 0x73, 0x88, 0x72, 0x88, 0x72, 0x88, 0x72,
-  0x88, 0x72, 0x88, 0x72, 0x87, 0x72, 0x87, 0x71, 0x87, 0x70, 0x87, 0x70,
-  0x87, 0x6f, 0x87, 0x70, 0x87, 0x6f, 0x87, 0x6b, 0x89, 0x66, 0x89, 0x64,
-  0x8b, 0x5d, 0x8e, 0x5d, 0x8e, 0x60, 0x8d, 0x62, 0x8d, 0x61, 0x8d, 0x62,
-  0x8d, 0x65, 0x8d, 0x63, 0x8e, 0x61, 0x8d, 0x5f, 0x8d, 0x5c, 0x8d, 0x5a,
-  0x8e, 0x56, 0x90, 0x4e, 0x92, 0x4f, 0x94, 0x54, 0x95, 0x57, 0x95, 0x53,
-  0x95, 0x50, 0x96, 0x47, 0x96, 0x41, 0x96, 0x46, 0x98, 0x50, 0x96, 0x46,
-  0x91, 0x49, 0x96, 0x43, 0x9b, 0x43, 0x98, 0x4f, 0x98, 0x5d, 0x8c, 0x61,
-  0x68, 0x7e, 0x63, 0x7e, 0x60, 0x7f, 0x60, 0x82, 0x67, 0x86, 0x7c, 0x8f,
-  0x89, 0x92, 0x88, 0x93, 0x74, 0x90, 0x64, 0x88, 0x5e, 0x81, 0x61, 0x7c,
-  0x63, 0x7a, 0x79, 0x62, 0x91, 0x49, 0x91, 0x45, 0x92, 0x44, 0x93, 0x43,
-  0x94, 0x42, 0x94, 0x42, 0x95, 0x42, 0x95, 0x40, 0x95, 0x3f, 0x95, 0x3e,
-  0x95, 0x3e, 0x95, 0x40, 0x96, 0x40, 0x96, 0x3f, 0x95, 0x44, 0x92, 0x49,
-  0x92, 0x4b, 0x91, 0x4b, 0x91, 0x4a, 0x93, 0x47, 0x97, 0x44, 0x97, 0x41,
-  0x98, 0x3f, 0x99, 0x43, 0x98, 0x3f, 0x98, 0x3e, 0x98, 0x40, 0x98, 0x40,
-  0x98, 0x43, 0x99, 0x43, 0x9a, 0x3f, 0x9a, 0x3d, 0x9b, 0x3e, 0x9c, 0x3f,
-  0x99, 0x41, 0x96, 0x46, 0x94, 0x49, 0x95, 0x48, 0x95, 0x44, 0x95, 0x42,
-  0x96, 0x40, 0x96, 0x3f, 0x97, 0x3e, 0x97, 0x3e, 0x98, 0x3f, 0x97, 0x40,
-  0x96, 0x41, 0x95, 0x41, 0x96, 0x41, 0x96, 0x43, 0x53, 0x62, 0x51, 0x62,
-  0x4f, 0x61, 0x54, 0x61, 0x57, 0x60, 0x5b, 0x5d, 0x5c, 0x5e, 0x5a, 0x61,
-  0x5c, 0x63, 0x5c, 0x64, 0x59, 0x63, 0x59, 0x62, 0x59, 0x60, 0x5b, 0x61,
-  0x5b, 0x61, 0x5a, 0x60, 0x66, 0x5d, 0x87, 0x67, 0x89, 0x6d, 0x89, 0x6c,
-  0x8a, 0x6f, 0x88, 0x71, 0x88, 0x70, 0x88, 0x71, 0x88, 0x72, 0x87, 0x73,
-  0x87, 0x73, 0x86, 0x73, 0x85, 0x76, 0x85, 0x75, 0x85, 0x78, 0x85, 0x78,
-  0x85, 0x78, 0x85, 0x77, 0x85, 0x78, 0x85, 0x78, 0x86, 0x78, 0x86, 0x78,
-  0x84, 0x79, 0x84, 0x78, 0x84, 0x78, 0x84, 0x77, 0x84, 0x78, 0x83, 0x79,
-  0x83, 0x78, 0x85, 0x78, 0x85, 0x77, 0x84, 0x76, 0x85, 0x76, 0x86, 0x75,
-  0x86, 0x75, 0x86, 0x74, 0x86, 0x74, 0x86, 0x72, 0x86, 0x72, 0x86, 0x72,
-  0x87, 0x72, 0x87, 0x71, 0x87, 0x71, 0x88, 0x71, 0x87, 0x6f, 0x87, 0x6f,
-  0x87, 0x6f, 0x87, 0x6c, 0x87, 0x6b, 0x87, 0x69, 0x89, 0x63, 0x8b, 0x5e,
-  0x8e, 0x5c, 0x8c, 0x5f, 0x8d, 0x60, 0x8d, 0x60, 0x8d, 0x62, 0x8e, 0x63,
-  0x8d, 0x62, 0x8d, 0x5f, 0x8d, 0x5d, 0x8d, 0x5c, 0x8d, 0x59, 0x8e, 0x51,
-  0x8f, 0x4e, 0x93, 0x4f, 0x94, 0x55, 0x95, 0x53, 0x95, 0x52, 0x96, 0x4c,
-  0x96, 0x42, 0x95, 0x44, 0x98, 0x4d, 0x96, 0x46, 0x91, 0x49, 0x92, 0x47,
-  0x9a, 0x43, 0x98, 0x4e, 0x9a, 0x55, 0x8d, 0x57, 0x68, 0x7c, 0x67, 0x7d,
-  0x64, 0x7d, 0x64, 0x82, 0x6b, 0x88, 0x7c, 0x8f, 0x84, 0x92, 0x84, 0x93,
-  0x76, 0x91, 0x68, 0x8a, 0x61, 0x7f, 0x5f, 0x7c, 0x60, 0x7a, 0x77, 0x63,
-  0x8f, 0x4a, 0x91, 0x46, 0x92, 0x46, 0x93, 0x45, 0x94, 0x44, 0x94, 0x43,
-  0x95, 0x42, 0x95, 0x41, 0x96, 0x41, 0x95, 0x40, 0x95, 0x40, 0x95, 0x41,
-  0x94, 0x42, 0x94, 0x44, 0x93, 0x49, 0x90, 0x4a, 0x91, 0x4b, 0x91, 0x4b,
-  0x93, 0x48, 0x95, 0x46, 0x97, 0x42, 0x98, 0x41, 0x97, 0x44, 0x97, 0x47,
-  0x97, 0x40, 0x97, 0x3f, 0x97, 0x40, 0x97, 0x41, 0x98, 0x42, 0x99, 0x41,
-  0x9a, 0x3e, 0x9a, 0x3e, 0x9b, 0x41, 0x9a, 0x43, 0x97, 0x45, 0x92, 0x4c,
-  0x90, 0x4e, 0x90, 0x4f, 0x90, 0x4d, 0x91, 0x4d, 0x92, 0x4b, 0x92, 0x4a,
-  0x93, 0x48, 0x93, 0x48, 0x93, 0x48, 0x94, 0x48, 0x94, 0x49, 0x95, 0x49,
-  0x95, 0x49, 0x94, 0x4b, 0x55, 0x63, 0x53, 0x63, 0x51, 0x61, 0x56, 0x5f,
-  0x59, 0x5f, 0x5e, 0x5d, 0x5e, 0x5e, 0x5a, 0x61, 0x5c, 0x63, 0x5c, 0x63,
-  0x5b, 0x63, 0x5b, 0x61, 0x5c, 0x60, 0x5f, 0x61, 0x5f, 0x61, 0x5e, 0x5f,
-  0x6d, 0x5e, 0x88, 0x69, 0x8a, 0x6c, 0x8a, 0x6c, 0x89, 0x6e, 0x89, 0x71,
-  0x88, 0x70, 0x88, 0x71, 0x88, 0x72, 0x88, 0x73, 0x87, 0x74, 0x87, 0x73,
-  0x86, 0x75, 0x86, 0x75, 0x85, 0x76, 0x86, 0x77, 0x85, 0x77, 0x85, 0x77,
-  0x86, 0x77, 0x86, 0x77, 0x86, 0x77, 0x86, 0x77, 0x85, 0x78, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x84, 0x78, 0x83, 0x79, 0x83, 0x78, 0x84, 0x78,
-  0x84, 0x78, 0x84, 0x77, 0x84, 0x76, 0x85, 0x75, 0x84, 0x75, 0x85, 0x74,
-  0x85, 0x74, 0x85, 0x72, 0x85, 0x72, 0x86, 0x71, 0x87, 0x71, 0x87, 0x70,
-  0x87, 0x70, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6e, 0x87, 0x6d, 0x87, 0x6c,
-  0x86, 0x6c, 0x86, 0x6c, 0x87, 0x69, 0x89, 0x64, 0x8b, 0x5e, 0x8e, 0x59,
-  0x8e, 0x5b, 0x8e, 0x5e, 0x8f, 0x60, 0x8e, 0x64, 0x8d, 0x63, 0x8d, 0x5f,
-  0x8e, 0x5e, 0x8e, 0x5d, 0x8d, 0x5b, 0x8d, 0x55, 0x8d, 0x4f, 0x92, 0x4c,
-  0x95, 0x53, 0x95, 0x53, 0x95, 0x52, 0x96, 0x4f, 0x97, 0x43, 0x95, 0x42,
-  0x98, 0x4b, 0x96, 0x45, 0x92, 0x49, 0x90, 0x49, 0x9a, 0x3f, 0x9b, 0x4a,
-  0x9b, 0x4c, 0x8f, 0x4e, 0x68, 0x7a, 0x69, 0x7a, 0x69, 0x7a, 0x69, 0x83,
-  0x6d, 0x88, 0x7d, 0x8f, 0x85, 0x93, 0x83, 0x93, 0x75, 0x91, 0x6a, 0x8a,
-  0x64, 0x7e, 0x62, 0x7b, 0x62, 0x7b, 0x74, 0x69, 0x8e, 0x4c, 0x91, 0x48,
-  0x92, 0x47, 0x92, 0x46, 0x93, 0x44, 0x95, 0x43, 0x96, 0x42, 0x95, 0x41,
-  0x95, 0x42, 0x95, 0x42, 0x96, 0x42, 0x94, 0x43, 0x92, 0x45, 0x92, 0x47,
-  0x91, 0x4b, 0x90, 0x4a, 0x90, 0x4b, 0x91, 0x4a, 0x93, 0x47, 0x97, 0x43,
-  0x97, 0x3f, 0x97, 0x41, 0x97, 0x45, 0x96, 0x44, 0x96, 0x3f, 0x97, 0x41,
-  0x97, 0x41, 0x98, 0x41, 0x98, 0x42, 0x9a, 0x3f, 0x9a, 0x3e, 0x99, 0x40,
-  0x99, 0x43, 0x97, 0x46, 0x95, 0x49, 0x90, 0x50, 0x8e, 0x52, 0x8e, 0x51,
-  0x8e, 0x51, 0x8f, 0x51, 0x8f, 0x50, 0x8f, 0x4f, 0x91, 0x4f, 0x91, 0x4e,
-  0x91, 0x4d, 0x92, 0x4d, 0x93, 0x4e, 0x93, 0x4e, 0x93, 0x4e, 0x93, 0x50,
-  0x56, 0x63, 0x54, 0x63, 0x54, 0x60, 0x59, 0x5d, 0x5c, 0x5c, 0x60, 0x5b,
-  0x5f, 0x5c, 0x5b, 0x60, 0x5b, 0x63, 0x5c, 0x63, 0x5c, 0x62, 0x5d, 0x60,
-  0x5d, 0x61, 0x60, 0x62, 0x62, 0x62, 0x60, 0x5f, 0x72, 0x60, 0x87, 0x68,
-  0x8a, 0x6b, 0x89, 0x6b, 0x89, 0x6d, 0x89, 0x6f, 0x8a, 0x6f, 0x89, 0x70,
-  0x88, 0x70, 0x88, 0x72, 0x88, 0x73, 0x88, 0x73, 0x88, 0x74, 0x88, 0x74,
-  0x87, 0x75, 0x86, 0x75, 0x87, 0x75, 0x87, 0x75, 0x87, 0x76, 0x86, 0x76,
-  0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x76,
-  0x85, 0x75, 0x85, 0x74, 0x85, 0x74, 0x85, 0x73, 0x85, 0x73, 0x86, 0x73,
-  0x86, 0x73, 0x86, 0x71, 0x87, 0x70, 0x86, 0x70, 0x86, 0x70, 0x86, 0x6f,
-  0x86, 0x6f, 0x87, 0x6f, 0x87, 0x6d, 0x87, 0x6b, 0x87, 0x6b, 0x87, 0x6b,
-  0x87, 0x6b, 0x87, 0x68, 0x89, 0x64, 0x8c, 0x5c, 0x8e, 0x5a, 0x8f, 0x5c,
-  0x91, 0x5d, 0x8f, 0x60, 0x8f, 0x62, 0x8f, 0x60, 0x8e, 0x5f, 0x8d, 0x5e,
-  0x8d, 0x5c, 0x8d, 0x58, 0x8d, 0x54, 0x90, 0x4b, 0x94, 0x4e, 0x95, 0x51,
-  0x96, 0x4f, 0x96, 0x4f, 0x97, 0x43, 0x98, 0x40, 0x98, 0x48, 0x96, 0x43,
-  0x92, 0x48, 0x90, 0x4a, 0x99, 0x41, 0x9e, 0x40, 0x9b, 0x44, 0x92, 0x4b,
-  0x6a, 0x7a, 0x68, 0x76, 0x6b, 0x77, 0x69, 0x81, 0x69, 0x85, 0x7d, 0x8f,
-  0x85, 0x93, 0x84, 0x92, 0x75, 0x90, 0x66, 0x88, 0x63, 0x7f, 0x63, 0x7c,
-  0x63, 0x7c, 0x6e, 0x6e, 0x8c, 0x4f, 0x91, 0x48, 0x91, 0x47, 0x92, 0x46,
-  0x92, 0x45, 0x95, 0x43, 0x95, 0x42, 0x95, 0x42, 0x94, 0x43, 0x94, 0x43,
-  0x95, 0x43, 0x94, 0x45, 0x91, 0x47, 0x91, 0x49, 0x91, 0x4b, 0x91, 0x4b,
-  0x90, 0x4b, 0x92, 0x48, 0x93, 0x44, 0x98, 0x41, 0x98, 0x41, 0x98, 0x44,
-  0x98, 0x44, 0x98, 0x40, 0x97, 0x40, 0x96, 0x42, 0x97, 0x41, 0x98, 0x41,
-  0x98, 0x40, 0x9a, 0x40, 0x97, 0x42, 0x97, 0x44, 0x96, 0x48, 0x94, 0x4a,
-  0x91, 0x4d, 0x8f, 0x52, 0x8f, 0x53, 0x8e, 0x53, 0x8e, 0x53, 0x8f, 0x52,
-  0x8f, 0x51, 0x90, 0x51, 0x90, 0x51, 0x90, 0x50, 0x91, 0x50, 0x90, 0x50,
-  0x90, 0x51, 0x90, 0x52, 0x90, 0x52, 0x90, 0x53, 0x56, 0x61, 0x54, 0x61,
-  0x57, 0x60, 0x5b, 0x5c, 0x5e, 0x59, 0x61, 0x5a, 0x61, 0x5c, 0x5c, 0x61,
-  0x5c, 0x64, 0x5c, 0x63, 0x5e, 0x62, 0x60, 0x60, 0x60, 0x61, 0x62, 0x62,
-  0x63, 0x62, 0x63, 0x61, 0x79, 0x61, 0x89, 0x68, 0x8b, 0x6b, 0x89, 0x6b,
-  0x89, 0x6e, 0x89, 0x6f, 0x89, 0x6f, 0x88, 0x70, 0x88, 0x70, 0x88, 0x71,
-  0x88, 0x71, 0x88, 0x72, 0x88, 0x72, 0x88, 0x73, 0x86, 0x74, 0x87, 0x75,
-  0x87, 0x76, 0x87, 0x75, 0x87, 0x76, 0x87, 0x75, 0x85, 0x76, 0x85, 0x75,
-  0x85, 0x74, 0x85, 0x74, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x86, 0x75,
-  0x86, 0x76, 0x85, 0x74, 0x85, 0x74, 0x84, 0x75, 0x85, 0x75, 0x84, 0x74,
-  0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x74, 0x85, 0x73, 0x85, 0x72,
-  0x87, 0x71, 0x87, 0x6e, 0x87, 0x6b, 0x87, 0x6c, 0x87, 0x6c, 0x87, 0x6a,
-  0x87, 0x6c, 0x8a, 0x67, 0x8b, 0x62, 0x8b, 0x5f, 0x8d, 0x5c, 0x8e, 0x5b,
-  0x8f, 0x5d, 0x8f, 0x5e, 0x8d, 0x60, 0x8d, 0x5e, 0x8d, 0x5c, 0x8d, 0x59,
-  0x8d, 0x57, 0x8e, 0x4e, 0x92, 0x49, 0x94, 0x4e, 0x95, 0x4e, 0x95, 0x4d,
-  0x97, 0x43, 0x99, 0x3e, 0x99, 0x41, 0x96, 0x42, 0x93, 0x47, 0x90, 0x4b,
-  0x95, 0x47, 0x9c, 0x3c, 0x9d, 0x40, 0x98, 0x47, 0x72, 0x75, 0x69, 0x76,
-  0x6b, 0x75, 0x6b, 0x7d, 0x69, 0x82, 0x7b, 0x8d, 0x84, 0x91, 0x83, 0x90,
-  0x74, 0x8e, 0x64, 0x87, 0x61, 0x81, 0x64, 0x7e, 0x66, 0x7e, 0x6c, 0x73,
-  0x8a, 0x53, 0x91, 0x4a, 0x91, 0x48, 0x92, 0x49, 0x93, 0x47, 0x93, 0x44,
-  0x93, 0x44, 0x94, 0x44, 0x94, 0x44, 0x94, 0x45, 0x92, 0x45, 0x93, 0x48,
-  0x91, 0x49, 0x91, 0x4b, 0x91, 0x4c, 0x91, 0x4c, 0x91, 0x4a, 0x94, 0x46,
-  0x97, 0x42, 0x99, 0x41, 0x98, 0x45, 0x98, 0x45, 0x98, 0x42, 0x98, 0x40,
-  0x97, 0x42, 0x96, 0x43, 0x97, 0x43, 0x98, 0x42, 0x98, 0x42, 0x96, 0x45,
-  0x93, 0x49, 0x93, 0x4b, 0x93, 0x4e, 0x92, 0x4f, 0x8f, 0x51, 0x8f, 0x54,
-  0x8e, 0x54, 0x8e, 0x55, 0x8e, 0x54, 0x8f, 0x52, 0x90, 0x51, 0x90, 0x51,
-  0x90, 0x52, 0x8f, 0x52, 0x90, 0x53, 0x8f, 0x55, 0x8e, 0x55, 0x8e, 0x56,
-  0x8e, 0x57, 0x8d, 0x57, 0x55, 0x61, 0x55, 0x5f, 0x58, 0x5e, 0x5c, 0x5d,
-  0x5f, 0x5b, 0x62, 0x5c, 0x63, 0x5c, 0x5e, 0x60, 0x5f, 0x64, 0x5e, 0x63,
-  0x60, 0x62, 0x63, 0x60, 0x62, 0x61, 0x63, 0x62, 0x65, 0x62, 0x65, 0x62,
-  0x7d, 0x62, 0x8a, 0x68, 0x8a, 0x6b, 0x89, 0x6b, 0x89, 0x6d, 0x89, 0x6f,
-  0x89, 0x6f, 0x89, 0x70, 0x88, 0x70, 0x88, 0x70, 0x88, 0x6f, 0x88, 0x70,
-  0x88, 0x71, 0x88, 0x72, 0x87, 0x74, 0x87, 0x74, 0x87, 0x75, 0x87, 0x76,
-  0x87, 0x76, 0x87, 0x75, 0x85, 0x76, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x75, 0x86, 0x75, 0x86, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x76, 0x85, 0x75, 0x86, 0x76, 0x86, 0x78, 0x86, 0x78, 0x85, 0x76,
-  0x85, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83, 0x76, 0x84, 0x77, 0x84, 0x77,
-  0x84, 0x77, 0x84, 0x76, 0x84, 0x75, 0x85, 0x74, 0x87, 0x73, 0x87, 0x71,
-  0x87, 0x70, 0x87, 0x70, 0x87, 0x6e, 0x87, 0x6c, 0x86, 0x6c, 0x88, 0x6b,
-  0x89, 0x69, 0x88, 0x64, 0x8a, 0x60, 0x8d, 0x5d, 0x8f, 0x5a, 0x8f, 0x5d,
-  0x8e, 0x5f, 0x8d, 0x5e, 0x8d, 0x5b, 0x8e, 0x58, 0x8e, 0x58, 0x8e, 0x54,
-  0x90, 0x49, 0x94, 0x4a, 0x95, 0x4c, 0x95, 0x4b, 0x98, 0x42, 0x99, 0x3c,
-  0x99, 0x3e, 0x95, 0x41, 0x92, 0x47, 0x90, 0x4b, 0x93, 0x49, 0x9a, 0x3f,
-  0x9e, 0x3e, 0x9c, 0x43, 0x7a, 0x72, 0x6e, 0x77, 0x6d, 0x73, 0x6b, 0x7a,
-  0x68, 0x80, 0x7a, 0x8c, 0x83, 0x8f, 0x83, 0x8e, 0x76, 0x8c, 0x68, 0x86,
-  0x63, 0x81, 0x64, 0x7f, 0x68, 0x7f, 0x6b, 0x75, 0x89, 0x55, 0x91, 0x4b,
-  0x91, 0x4a, 0x92, 0x4a, 0x92, 0x48, 0x92, 0x46, 0x92, 0x46, 0x93, 0x46,
-  0x94, 0x45, 0x93, 0x46, 0x91, 0x47, 0x92, 0x49, 0x91, 0x4a, 0x91, 0x4c,
-  0x91, 0x4c, 0x91, 0x4b, 0x93, 0x49, 0x96, 0x44, 0x9a, 0x41, 0x99, 0x42,
-  0x99, 0x43, 0x99, 0x41, 0x98, 0x40, 0x98, 0x41, 0x97, 0x44, 0x96, 0x45,
-  0x97, 0x45, 0x98, 0x46, 0x96, 0x48, 0x93, 0x4a, 0x91, 0x4e, 0x90, 0x50,
-  0x90, 0x52, 0x90, 0x52, 0x8e, 0x53, 0x8f, 0x55, 0x8e, 0x55, 0x8e, 0x55,
-  0x8e, 0x53, 0x8f, 0x52, 0x90, 0x51, 0x90, 0x51, 0x90, 0x52, 0x8f, 0x54,
-  0x8e, 0x56, 0x8d, 0x57, 0x8d, 0x58, 0x8c, 0x58, 0x8c, 0x59, 0x8c, 0x5a,
-  0x54, 0x62, 0x58, 0x5d, 0x5b, 0x5b, 0x5f, 0x5b, 0x62, 0x5c, 0x64, 0x5d,
-  0x63, 0x5d, 0x5f, 0x5f, 0x61, 0x64, 0x62, 0x63, 0x63, 0x62, 0x64, 0x61,
-  0x63, 0x62, 0x64, 0x63, 0x66, 0x63, 0x67, 0x62, 0x82, 0x64, 0x8b, 0x69,
-  0x8a, 0x6a, 0x8a, 0x6a, 0x8a, 0x6b, 0x89, 0x6e, 0x89, 0x6f, 0x89, 0x6f,
-  0x89, 0x6f, 0x8a, 0x6f, 0x8a, 0x6f, 0x8a, 0x70, 0x89, 0x70, 0x89, 0x71,
-  0x88, 0x73, 0x88, 0x73, 0x86, 0x74, 0x87, 0x75, 0x87, 0x75, 0x87, 0x74,
-  0x87, 0x76, 0x87, 0x75, 0x86, 0x77, 0x86, 0x77, 0x86, 0x77, 0x86, 0x77,
-  0x86, 0x77, 0x85, 0x77, 0x85, 0x77, 0x84, 0x77, 0x84, 0x77, 0x85, 0x77,
-  0x85, 0x78, 0x85, 0x78, 0x85, 0x78, 0x84, 0x77, 0x84, 0x77, 0x84, 0x77,
-  0x84, 0x78, 0x85, 0x76, 0x86, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x75, 0x85, 0x74, 0x85, 0x73, 0x85, 0x73, 0x85, 0x73, 0x86, 0x73,
-  0x87, 0x70, 0x87, 0x70, 0x87, 0x6e, 0x87, 0x6d, 0x87, 0x6c, 0x87, 0x68,
-  0x89, 0x68, 0x8a, 0x62, 0x8c, 0x5b, 0x8f, 0x5b, 0x8f, 0x5d, 0x8f, 0x5e,
-  0x8f, 0x5d, 0x8f, 0x5a, 0x8f, 0x59, 0x8d, 0x57, 0x8e, 0x4d, 0x95, 0x48,
-  0x95, 0x49, 0x96, 0x49, 0x99, 0x3f, 0x99, 0x3b, 0x9a, 0x3c, 0x93, 0x43,
-  0x91, 0x48, 0x91, 0x4b, 0x92, 0x4a, 0x99, 0x42, 0x9d, 0x3f, 0x9b, 0x41,
-  0x81, 0x6f, 0x72, 0x7c, 0x70, 0x75, 0x6d, 0x76, 0x6b, 0x7b, 0x79, 0x88,
-  0x83, 0x8f, 0x83, 0x8d, 0x7b, 0x8b, 0x6e, 0x85, 0x67, 0x7d, 0x66, 0x7f,
-  0x68, 0x7e, 0x67, 0x76, 0x86, 0x55, 0x90, 0x4d, 0x90, 0x4c, 0x91, 0x4b,
-  0x91, 0x47, 0x91, 0x47, 0x91, 0x48, 0x92, 0x46, 0x93, 0x47, 0x91, 0x47,
-  0x8f, 0x49, 0x90, 0x4a, 0x90, 0x4b, 0x90, 0x4c, 0x90, 0x4c, 0x91, 0x4a,
-  0x94, 0x47, 0x98, 0x43, 0x9a, 0x40, 0x9a, 0x41, 0x9c, 0x40, 0x9a, 0x3f,
-  0x98, 0x43, 0x96, 0x46, 0x94, 0x48, 0x94, 0x49, 0x93, 0x4a, 0x92, 0x4d,
-  0x91, 0x4f, 0x8f, 0x51, 0x8e, 0x54, 0x8d, 0x55, 0x8f, 0x53, 0x8e, 0x52,
-  0x8e, 0x53, 0x8f, 0x56, 0x8e, 0x56, 0x8f, 0x55, 0x8f, 0x52, 0x90, 0x51,
-  0x90, 0x51, 0x90, 0x51, 0x90, 0x54, 0x8e, 0x56, 0x8e, 0x58, 0x8c, 0x5a,
-  0x8a, 0x5a, 0x8b, 0x5b, 0x8c, 0x5c, 0x8c, 0x5b, 0x56, 0x61, 0x5a, 0x5c,
-  0x5d, 0x5b, 0x61, 0x5b, 0x63, 0x5c, 0x64, 0x5d, 0x64, 0x5d, 0x60, 0x5f,
-  0x63, 0x64, 0x64, 0x64, 0x63, 0x62, 0x64, 0x62, 0x64, 0x62, 0x64, 0x63,
-  0x66, 0x63, 0x6a, 0x62, 0x86, 0x65, 0x8b, 0x6a, 0x8a, 0x69, 0x8a, 0x6a,
-  0x8a, 0x6b, 0x8a, 0x6d, 0x8a, 0x6e, 0x89, 0x6e, 0x8a, 0x6f, 0x89, 0x6f,
-  0x89, 0x6f, 0x8a, 0x70, 0x8a, 0x71, 0x8a, 0x71, 0x88, 0x73, 0x87, 0x72,
-  0x86, 0x74, 0x87, 0x75, 0x87, 0x74, 0x87, 0x75, 0x87, 0x75, 0x87, 0x75,
-  0x85, 0x77, 0x85, 0x77, 0x86, 0x78, 0x86, 0x78, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x84, 0x78, 0x84, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x76,
-  0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x85, 0x75, 0x86, 0x73,
-  0x85, 0x72, 0x85, 0x72, 0x85, 0x73, 0x86, 0x73, 0x87, 0x70, 0x87, 0x70,
-  0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6f, 0x87, 0x6c, 0x88, 0x6c, 0x88, 0x69,
-  0x89, 0x64, 0x8b, 0x5e, 0x8e, 0x5c, 0x8f, 0x5e, 0x8f, 0x5d, 0x8f, 0x5b,
-  0x8f, 0x5a, 0x8e, 0x57, 0x8c, 0x52, 0x91, 0x47, 0x95, 0x45, 0x97, 0x46,
-  0x9a, 0x3c, 0x9a, 0x3b, 0x9a, 0x3b, 0x93, 0x43, 0x90, 0x48, 0x91, 0x4b,
-  0x92, 0x4a, 0x98, 0x42, 0x9c, 0x42, 0x9b, 0x3f, 0x85, 0x6a, 0x76, 0x7e,
-  0x74, 0x79, 0x71, 0x77, 0x70, 0x79, 0x78, 0x84, 0x82, 0x8d, 0x83, 0x8b,
-  0x7d, 0x89, 0x73, 0x87, 0x6a, 0x7c, 0x68, 0x7c, 0x66, 0x7e, 0x64, 0x78,
-  0x84, 0x57, 0x8f, 0x4d, 0x90, 0x4d, 0x91, 0x4c, 0x92, 0x48, 0x91, 0x48,
-  0x91, 0x48, 0x91, 0x48, 0x91, 0x48, 0x90, 0x48, 0x8f, 0x4a, 0x8f, 0x4c,
-  0x8f, 0x4c, 0x90, 0x4c, 0x90, 0x4c, 0x92, 0x4a, 0x95, 0x46, 0x98, 0x42,
-  0x99, 0x3e, 0x99, 0x3f, 0x99, 0x41, 0x97, 0x44, 0x95, 0x47, 0x93, 0x49,
-  0x91, 0x4c, 0x90, 0x4e, 0x90, 0x4f, 0x8e, 0x51, 0x8e, 0x55, 0x8d, 0x58,
-  0x8d, 0x57, 0x8d, 0x55, 0x8f, 0x52, 0x8e, 0x51, 0x8f, 0x53, 0x8e, 0x56,
-  0x8e, 0x56, 0x8f, 0x54, 0x90, 0x52, 0x8f, 0x52, 0x90, 0x52, 0x90, 0x52,
-  0x8e, 0x55, 0x8c, 0x57, 0x8c, 0x59, 0x8c, 0x5b, 0x8a, 0x5b, 0x8a, 0x5c,
-  0x8c, 0x5c, 0x8c, 0x5c, 0x58, 0x60, 0x5c, 0x5b, 0x5f, 0x5b, 0x62, 0x5b,
-  0x64, 0x5c, 0x64, 0x5d, 0x64, 0x5d, 0x5f, 0x5f, 0x63, 0x64, 0x65, 0x64,
-  0x63, 0x62, 0x63, 0x62, 0x63, 0x62, 0x64, 0x63, 0x65, 0x63, 0x6c, 0x62,
-  0x86, 0x66, 0x8a, 0x6a, 0x8a, 0x6a, 0x8a, 0x6a, 0x8a, 0x6b, 0x89, 0x6c,
-  0x89, 0x6c, 0x89, 0x6e, 0x89, 0x6f, 0x89, 0x6f, 0x89, 0x6f, 0x8a, 0x6f,
-  0x8a, 0x70, 0x8a, 0x71, 0x88, 0x72, 0x88, 0x72, 0x87, 0x74, 0x87, 0x75,
-  0x87, 0x75, 0x87, 0x75, 0x87, 0x75, 0x87, 0x75, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x84, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x77,
-  0x85, 0x77, 0x85, 0x77, 0x85, 0x77, 0x85, 0x76, 0x85, 0x75, 0x85, 0x75,
-  0x85, 0x75, 0x85, 0x75, 0x86, 0x75, 0x86, 0x74, 0x85, 0x72, 0x86, 0x72,
-  0x85, 0x72, 0x85, 0x72, 0x87, 0x70, 0x87, 0x70, 0x87, 0x71, 0x87, 0x71,
-  0x87, 0x71, 0x87, 0x6f, 0x87, 0x6c, 0x86, 0x6a, 0x87, 0x69, 0x89, 0x68,
-  0x8d, 0x60, 0x8f, 0x5d, 0x8f, 0x5d, 0x8f, 0x5b, 0x8f, 0x59, 0x8e, 0x57,
-  0x8a, 0x57, 0x8e, 0x4a, 0x95, 0x41, 0x99, 0x3f, 0x9a, 0x3b, 0x9a, 0x3c,
-  0x9a, 0x3b, 0x93, 0x44, 0x91, 0x4a, 0x91, 0x4b, 0x92, 0x4a, 0x98, 0x42,
-  0x9c, 0x3f, 0x9b, 0x3f, 0x87, 0x63, 0x7a, 0x7a, 0x79, 0x7b, 0x76, 0x78,
-  0x74, 0x78, 0x77, 0x80, 0x82, 0x8c, 0x83, 0x8a, 0x7f, 0x88, 0x77, 0x88,
-  0x6c, 0x7c, 0x6a, 0x79, 0x63, 0x7e, 0x63, 0x79, 0x83, 0x58, 0x8f, 0x4d,
-  0x90, 0x4c, 0x91, 0x4c, 0x92, 0x4a, 0x91, 0x49, 0x91, 0x4a, 0x90, 0x4a,
-  0x8f, 0x49, 0x8f, 0x4a, 0x8f, 0x4c, 0x8f, 0x4d, 0x8f, 0x4d, 0x8f, 0x4c,
-  0x90, 0x4c, 0x92, 0x4a, 0x95, 0x44, 0x97, 0x41, 0x97, 0x41, 0x97, 0x42,
-  0x96, 0x45, 0x95, 0x49, 0x92, 0x4c, 0x90, 0x4e, 0x8f, 0x50, 0x8e, 0x52,
-  0x8d, 0x53, 0x8b, 0x55, 0x8c, 0x58, 0x8b, 0x59, 0x8c, 0x56, 0x8d, 0x55,
-  0x8f, 0x52, 0x8e, 0x52, 0x8f, 0x54, 0x8e, 0x57, 0x8e, 0x56, 0x8f, 0x54,
-  0x8f, 0x53, 0x90, 0x53, 0x90, 0x53, 0x8f, 0x54, 0x8d, 0x57, 0x8a, 0x59,
-  0x89, 0x5a, 0x8a, 0x5c, 0x8a, 0x5c, 0x8b, 0x5c, 0x8c, 0x5c, 0x8c, 0x5c
-};
-unsigned int test_d3d9_nv12_yuv_len = 153600;
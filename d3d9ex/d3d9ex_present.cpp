@@ -1,6 +1,8 @@
 #include <array>
 #include <cstring>
+#include <iomanip>
 #include <iostream>
+#include <string>
 #include <vector>
 
 
@@ -8,6 +10,7 @@
 #include <d3d9.h>
 #include <d3dcompiler.h>
 
+#include "../common/bench.h"
 #include "../common/com.h"
 #include "../common/error.h"
 #include "../common/str.h"
@@ -17,6 +20,12 @@ struct Extent2D {
   uint32_t w, h;
 };
 
+struct PresentBenchConfig {
+  const char*   name;
+  D3DSWAPEFFECT swapEffect;
+  uint32_t      maxBackbufferCount;
+};
+
 class TriangleApp {
   
 public:
@@ -218,6 +227,123 @@ public:
     m_frameCounter++;
   }
   
+  /**
+   * \brief Measures PresentEx cost
+   *
+   * Sweeps swap effects, back buffer counts, maximum
+   * frame latencies and dirty region presents, always
+   * with an immediate present interval so that results
+   * are not bound by the display refresh rate. Only a
+   * clear is rendered per frame. Dirty regions only have
+   * an effect with the copy swap effect, so the other
+   * swap effects only use full presents.
+   * \param [in] frames Number of frames per configuration
+   * \returns Process exit code
+   */
+  int runBench(uint32_t frames) {
+    const std::array<PresentBenchConfig, 4> configs = {{
+      { "DISCARD", D3DSWAPEFFECT_DISCARD, 3 },
+      { "FLIP",    D3DSWAPEFFECT_FLIP,    3 },
+      { "FLIPEX",  D3DSWAPEFFECT_FLIPEX,  3 },
+      { "COPY",    D3DSWAPEFFECT_COPY,    1 },
+    }};
+
+    const std::array<UINT, 3> maxFrameLatencies = {{ 1, 3, 8 }};
+
+    // A few small rects in the top left corner
+    std::vector<char> dirtyRegionData(sizeof(RGNDATAHEADER) + 4 * sizeof(RECT));
+    auto dirtyRegion = reinterpret_cast<RGNDATA*>(dirtyRegionData.data());
+    dirtyRegion->rdh.dwSize = sizeof(RGNDATAHEADER);
+    dirtyRegion->rdh.iType = RDH_RECTANGLES;
+    dirtyRegion->rdh.nCount = 4;
+    dirtyRegion->rdh.nRgnSize = 4 * sizeof(RECT);
+    dirtyRegion->rdh.rcBound = RECT { 0, 0, 128, 128 };
+
+    auto dirtyRects = reinterpret_cast<RECT*>(dirtyRegion->Buffer);
+    dirtyRects[0] = RECT {  0,  0,  64,  64 };
+    dirtyRects[1] = RECT { 64,  0, 128,  64 };
+    dirtyRects[2] = RECT {  0, 64,  64, 128 };
+    dirtyRects[3] = RECT { 64, 64, 128, 128 };
+
+    m_presentInterval = D3DPRESENT_INTERVAL_IMMEDIATE;
+
+    RECT windowRect = { };
+    GetClientRect(m_window, &windowRect);
+
+    std::cout << "Present bench: " << (windowRect.right - windowRect.left) << "x"
+              << (windowRect.bottom - windowRect.top) << ", " << frames << " frames per configuration" << std::endl;
+
+    for (const auto& config : configs) {
+      for (uint32_t backbufferCount = 1; backbufferCount <= config.maxBackbufferCount; backbufferCount++) {
+        m_swapEffect = config.swapEffect;
+        m_backbufferCount = backbufferCount;
+
+        // Force a reset even if the window size did not change
+        m_windowSize = { 0, 0 };
+
+        try {
+          adjustBackBuffer();
+        } catch (const Error&) {
+          std::cout << "Bench: " << config.name << ", " << backbufferCount
+                    << " back buffer(s): unsupported" << std::endl;
+          continue;
+        }
+
+        Com<IDirect3DSurface9> backbuffer;
+        m_device->GetBackBuffer(0, 0, D3DBACKBUFFER_TYPE_MONO, &backbuffer);
+
+        for (UINT maxFrameLatency : maxFrameLatencies) {
+          for (uint32_t dirty = 0; dirty < (config.swapEffect == D3DSWAPEFFECT_COPY ? 2u : 1u); dirty++) {
+            m_device->SetMaximumFrameLatency(maxFrameLatency);
+
+            const RGNDATA* region = dirty ? dirtyRegion : nullptr;
+            bench::Stats presentStats;
+            uint32_t failed = 0;
+            uint32_t occluded = 0;
+
+            // Let the presentation queue fill up before
+            // taking samples so that it is in steady state
+            for (uint32_t i = 0; i < 16; i++) {
+              renderBenchFrame(backbuffer.ptr(), i);
+              presentBenchFrame(region);
+            }
+
+            bench::Timer timer;
+
+            for (uint32_t i = 0; i < frames; i++) {
+              pumpMessages();
+              renderBenchFrame(backbuffer.ptr(), i);
+
+              // Only time PresentEx itself, not the clear
+              bench::Timer presentTimer;
+              HRESULT status = presentBenchFrame(region);
+              presentStats.add(presentTimer.elapsedUs());
+
+              if (status == S_PRESENT_OCCLUDED)
+                occluded += 1;
+              else if (FAILED(status))
+                failed += 1;
+            }
+
+            double totalUs = timer.elapsedUs();
+
+            std::cout << "Bench: " << config.name << ", " << backbufferCount << " back buffer(s), "
+                      << "max latency " << maxFrameLatency << ", " << (dirty ? "dirty rects" : "full") << ": "
+                      << std::fixed << std::setprecision(1) << (1000000.0 * double(frames) / totalUs) << " frames/s";
+
+            if (failed || occluded)
+              std::cout << " (" << failed << " failed, " << occluded << " occluded)";
+
+            std::cout << std::endl
+                      << "  present: " << presentStats << std::endl;
+          }
+        }
+      }
+    }
+
+    return 0;
+  }
+
   void adjustBackBuffer() {
     RECT windowRect = { 0, 0, 1024, 600 };
     GetClientRect(m_window, &windowRect);
@@ -253,7 +379,7 @@ public:
         params.hDeviceWindow = m_window;
         params.MultiSampleQuality = 0;
         params.MultiSampleType = D3DMULTISAMPLE_NONE;
-        params.PresentationInterval = D3DPRESENT_INTERVAL_DEFAULT;
+        params.PresentationInterval = m_presentInterval;
         params.SwapEffect = m_swapEffect;
         params.Windowed = true;
       } else {
@@ -268,7 +394,7 @@ public:
         params.hDeviceWindow = m_window;
         params.MultiSampleQuality = 0;
         params.MultiSampleType = D3DMULTISAMPLE_NONE;
-        params.PresentationInterval = D3DPRESENT_INTERVAL_DEFAULT;
+        params.PresentationInterval = m_presentInterval;
         params.SwapEffect = m_swapEffect;
         params.Windowed = false;
       }
@@ -281,6 +407,7 @@ private:
   bool                          m_fullscreen = false;
   uint32_t                      m_backbufferCount = 1;
   D3DSWAPEFFECT                 m_swapEffect = D3DSWAPEFFECT_DISCARD;
+  UINT                          m_presentInterval = D3DPRESENT_INTERVAL_DEFAULT;
 
   Com<IDirect3D9Ex>             m_d3d;
   Com<IDirect3DDevice9Ex>       m_device;
@@ -289,7 +416,38 @@ private:
   Com<IDirect3DSurface9> m_frontBufferDataDefault;
 
   uint32_t m_frameCounter = 0;
-  
+
+  void renderBenchFrame(IDirect3DSurface9* backbuffer, uint32_t frame) {
+    m_device->BeginScene();
+    m_device->SetRenderTarget(0, backbuffer);
+    m_device->Clear(
+      0,
+      nullptr,
+      D3DCLEAR_TARGET,
+      COLORS[frame % COLORS.size()],
+      0,
+      0);
+    m_device->EndScene();
+  }
+
+  HRESULT presentBenchFrame(const RGNDATA* dirtyRegion) {
+    return m_device->PresentEx(
+      nullptr,
+      nullptr,
+      nullptr,
+      dirtyRegion,
+      0);
+  }
+
+  static void pumpMessages() {
+    MSG msg;
+
+    while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
+      TranslateMessage(&msg);
+      DispatchMessage(&msg);
+    }
+  }
+
 };
 
 LRESULT CALLBACK WindowProc(HWND hWnd,
@@ -298,6 +456,22 @@ LRESULT CALLBACK WindowProc(HWND hWnd,
                             LPARAM lParam);
 
 int main(int argc, char** argv) {
+  bool bench = false;
+  uint32_t benchFrames = 1000;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+
+    if (arg == "--bench") {
+      bench = true;
+    } else if (i + 1 < argc && arg == "--frames") {
+      benchFrames = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Usage: d3d9ex-present [--bench] [--frames n]" << std::endl;
+      return 1;
+    }
+  }
+
   HINSTANCE hInstance = GetModuleHandle(nullptr);
   int nCmdShow = SW_SHOWDEFAULT;
   HWND hWnd;
@@ -328,6 +502,9 @@ int main(int argc, char** argv) {
   
   try {
     TriangleApp app(hInstance, hWnd);
+
+    if (bench)
+      return app.runBench(benchFrames);
   
     while (true) {
       if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
@@ -1,12 +1,19 @@
+#include <filesystem>
+#include <iomanip>
 #include <iostream>
-#include <iterator>
 #include <fstream>
-#include <limits>
+#include <mutex>
+#include <set>
+#include <vector>
 
 #include <d3d11.h>
 #include <windows.h>
 
+#include "../common/batch.h"
+#include "../common/bench.h"
 #include "../common/com.h"
+#include "../common/dxbc.h"
+#include "../common/file.h"
 #include "../common/str.h"
 
 MIDL_INTERFACE("bb8a4fb9-3935-4762-b44b-35189a26414a")
@@ -22,68 +29,116 @@ struct __declspec(uuid("bb8a4fb9-3935-4762-b44b-35189a26414a")) ID3D11VkExtShade
 __CRT_UUID_DECL(ID3D11VkExtShader, 0xbb8a4fb9,0x3935,0x4762,0xb4,0x4b,0x35,0x18,0x9a,0x26,0x41,0x4a);
 #endif
 
-int main(int, char**) {
-  int     argc = 0;
-  LPWSTR* argv = CommandLineToArgvW(
-    GetCommandLineW(), &argc);  
-  
-  if (argc < 3) {
-    std::cerr << "Usage: dxbc-compiler input.dxbc output.spv" << std::endl;
-    return 1;
-  }
+struct ConvertJob {
+  std::filesystem::path inputFile;
+  std::filesystem::path outputFile;
+};
 
+struct ConvertResult {
+  bool        success = false;
+  double      timeUs  = 0.0;
+  std::string log;
+};
+
+Com<ID3D11Device> createDevice() {
   Com<ID3D11Device> device;
 
   HRESULT hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE,
     nullptr, 0, nullptr, 0, D3D11_SDK_VERSION, &device, nullptr, nullptr);
 
-  if (FAILED(hr)) {
-    std::cerr << "Failed to create D3D11 device" << std::endl;
-    return 1;
+  if (FAILED(hr))
+    return nullptr;
+
+  return device;
+}
+
+/**
+ * \brief Creates shader of the container's stage
+ *
+ * Picks the creation method from the program type token
+ * of the code chunk instead of trying every stage.
+ * \param [in] device D3D11 device
+ * \param [in] container Valid DXBC container
+ * \param [out] shader Created shader
+ * \returns \c true on success
+ */
+bool createShader(ID3D11Device* device, const dxbc::Container& container, Com<ID3D11DeviceChild>& shader) {
+  dxbc::ProgramType type;
+  uint32_t major, minor;
+
+  if (!container.getProgramInfo(type, major, minor))
+    return false;
+
+  const void* code = container.data();
+  size_t size = container.size();
+
+  HRESULT hr = E_INVALIDARG;
+
+  switch (type) {
+    case dxbc::ProgramType::Vertex: {
+      Com<ID3D11VertexShader> vs;
+      hr = device->CreateVertexShader(code, size, nullptr, &vs);
+      shader = vs.ptr();
+    } break;
+
+    case dxbc::ProgramType::Hull: {
+      Com<ID3D11HullShader> hs;
+      hr = device->CreateHullShader(code, size, nullptr, &hs);
+      shader = hs.ptr();
+    } break;
+
+    case dxbc::ProgramType::Domain: {
+      Com<ID3D11DomainShader> ds;
+      hr = device->CreateDomainShader(code, size, nullptr, &ds);
+      shader = ds.ptr();
+    } break;
+
+    case dxbc::ProgramType::Geometry: {
+      Com<ID3D11GeometryShader> gs;
+      hr = device->CreateGeometryShader(code, size, nullptr, &gs);
+      shader = gs.ptr();
+    } break;
+
+    case dxbc::ProgramType::Pixel: {
+      Com<ID3D11PixelShader> ps;
+      hr = device->CreatePixelShader(code, size, nullptr, &ps);
+      shader = ps.ptr();
+    } break;
+
+    case dxbc::ProgramType::Compute: {
+      Com<ID3D11ComputeShader> cs;
+      hr = device->CreateComputeShader(code, size, nullptr, &cs);
+      shader = cs.ptr();
+    } break;
   }
 
-  std::string ifileName = fromws(argv[1]);
-  std::ifstream ifile(ifileName, std::ios::binary);
-  ifile.ignore(std::numeric_limits<std::streamsize>::max());
-  std::streamsize length = ifile.gcount();
-  ifile.clear();
-  
-  ifile.seekg(0, std::ios_base::beg);
-  std::vector<char> dxbcCode(length);
-  ifile.read(dxbcCode.data(), length);
+  return SUCCEEDED(hr) && shader != nullptr;
+}
+
+ConvertResult convertShader(ID3D11Device* device, const ConvertJob& job, const MappedFile& dxbcCode) {
+  ConvertResult result;
+
+  // Don't verify the checksum, drivers accept patched
+  // shaders with zero or stale checksums just fine
+  dxbc::Container container(dxbcCode.data(), dxbcCode.size(), false);
+
+  if (!container.valid()) {
+    result.log = std::string("Invalid shader: ") + dxbc::errorString(container.error());
+    return result;
+  }
 
   Com<ID3D11DeviceChild> shader;
 
-  Com<ID3D11VertexShader> vs;
-  Com<ID3D11HullShader> hs;
-  Com<ID3D11DomainShader> ds;
-  Com<ID3D11GeometryShader> gs;
-  Com<ID3D11PixelShader> ps;
-  Com<ID3D11ComputeShader> cs;
-
-  if (SUCCEEDED(device->CreateVertexShader(dxbcCode.data(), dxbcCode.size(), nullptr, &vs)))
-    shader = vs.ptr();
-  else if (SUCCEEDED(device->CreateHullShader(dxbcCode.data(), dxbcCode.size(), nullptr, &hs)))
-    shader = hs.ptr();
-  else if (SUCCEEDED(device->CreateDomainShader(dxbcCode.data(), dxbcCode.size(), nullptr, &ds)))
-    shader = ds.ptr();
-  else if (SUCCEEDED(device->CreateGeometryShader(dxbcCode.data(), dxbcCode.size(), nullptr, &gs)))
-    shader = gs.ptr();
-  else if (SUCCEEDED(device->CreatePixelShader(dxbcCode.data(), dxbcCode.size(), nullptr, &ps)))
-    shader = ps.ptr();
-  else if (SUCCEEDED(device->CreateComputeShader(dxbcCode.data(), dxbcCode.size(), nullptr, &cs)))
-    shader = cs.ptr();
-
-  if (shader == nullptr) {
-    std::cerr << "Failed to create shader" << std::endl;
-    return 1;
+  if (!createShader(device, container, shader)) {
+    result.log = "Failed to create shader";
+    return result;
   }
 
   Com<ID3D11VkExtShader> extShader;
 
   if (FAILED(shader->QueryInterface(IID_PPV_ARGS(&extShader)))) {
-    std::cerr << "Failed to query ID3D11VkExtShader from shader" << std::endl;
-    return 1;
+    result.log = "Failed to query ID3D11VkExtShader from shader";
+    return result;
   }
 
   SIZE_T size = 0;
@@ -91,7 +146,196 @@ int main(int, char**) {
   std::vector<char> spirvCode(size);
   extShader->GetSpirvCode(&size, spirvCode.data());
 
-  std::ofstream ofile(fromws(argv[2]), std::ios::binary);
-  ofile.write(spirvCode.data(), size);
+  if (!writeFileAtomic(job.outputFile, spirvCode.data(), size)) {
+    result.log = "Failed to write " + job.outputFile.string();
+    return result;
+  }
+
+  result.success = true;
+  return result;
+}
+
+/**
+ * \brief Collects batch jobs
+ *
+ * The input is either a directory, which is searched
+ * recursively for .dxbc files, or a text file listing
+ * one input file per line. Outputs mirror the input
+ * layout under the output directory: paths relative to
+ * the input directory, or listed paths with any root
+ * removed. Listed paths that would leave the output
+ * directory, or that map to the same output twice, are
+ * rejected rather than overwriting each other.
+ */
+bool collectJobs(const std::filesystem::path& input, const std::filesystem::path& outputDir, std::vector<ConvertJob>& jobs) {
+  std::error_code ec;
+
+  if (std::filesystem::is_directory(input, ec)) {
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(input, ec)) {
+      if (!entry.is_regular_file(ec) || entry.path().extension() != ".dxbc")
+        continue;
+
+      ConvertJob job;
+      job.inputFile = entry.path();
+      job.outputFile = outputDir / entry.path().lexically_relative(input);
+      job.outputFile.replace_extension(".spv");
+      jobs.push_back(std::move(job));
+    }
+  } else {
+    std::ifstream list(input);
+
+    if (!list) {
+      std::cerr << "Failed to open " << input.string() << std::endl;
+      return false;
+    }
+
+    std::set<std::filesystem::path> outputs;
+    std::string line;
+
+    while (std::getline(list, line)) {
+      if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+
+      if (line.empty() || line[0] == '#')
+        continue;
+
+      ConvertJob job;
+      job.inputFile = line;
+
+      std::filesystem::path relative = job.inputFile.lexically_normal().relative_path();
+
+      if (relative.empty() || *relative.begin() == "..") {
+        std::cerr << "Cannot mirror " << line << " under " << outputDir.string() << std::endl;
+        return false;
+      }
+
+      job.outputFile = outputDir / relative;
+      job.outputFile.replace_extension(".spv");
+
+      if (!outputs.insert(job.outputFile).second) {
+        std::cerr << "Duplicate output " << job.outputFile.string() << " for " << line << std::endl;
+        return false;
+      }
+
+      jobs.push_back(std::move(job));
+    }
+  }
+
+  for (const auto& job : jobs)
+    std::filesystem::create_directories(job.outputFile.parent_path(), ec);
+
+  return true;
+}
+
+int runBatch(const std::filesystem::path& input, const std::filesystem::path& outputDir, uint32_t threadCount) {
+  std::vector<ConvertJob> jobs;
+
+  if (!collectJobs(input, outputDir, jobs))
+    return 1;
+
+  // One device for the whole batch, shader creation
+  // is free-threaded so all workers can share it
+  Com<ID3D11Device> device = createDevice();
+
+  if (device == nullptr) {
+    std::cerr << "Failed to create D3D11 device" << std::endl;
+    return 1;
+  }
+
+  std::vector<ConvertResult> results(jobs.size());
+  std::mutex logMutex;
+
+  bench::Timer timer;
+
+  threadCount = batch::runJobs(jobs.size(), threadCount, [&] (size_t index) {
+    bench::Timer jobTimer;
+
+    MappedFile dxbcCode(jobs[index].inputFile);
+
+    if (dxbcCode.valid())
+      results[index] = convertShader(device.ptr(), jobs[index], dxbcCode);
+    else
+      results[index].log = "Failed to read file";
+
+    results[index].timeUs = jobTimer.elapsedUs();
+
+    if (!results[index].success) {
+      std::lock_guard<std::mutex> lock(logMutex);
+      std::cerr << jobs[index].inputFile.string() << ": " << results[index].log << std::endl;
+    }
+  });
+
+  double totalUs = timer.elapsedUs();
+
+  bench::Stats stats;
+  uint32_t failed = 0;
+
+  for (const auto& result : results) {
+    if (result.success)
+      stats.add(result.timeUs);
+    else
+      failed += 1;
+  }
+
+  batch::printSummary(std::cout, "Converted", jobs.size(), 0, threadCount, totalUs, stats);
+
+  return failed ? 1 : 0;
+}
+
+int main(int, char**) {
+  int     argc = 0;
+  LPWSTR* argv = CommandLineToArgvW(
+    GetCommandLineW(), &argc);
+
+  std::vector<std::wstring> args;
+  uint32_t threadCount = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!batch::parseThreadCount(argc, argv, i, threadCount))
+      args.push_back(argv[i]);
+  }
+
+  if (args.size() == 3 && args[0] == L"--batch")
+    return runBatch(args[1], args[2], threadCount);
+
+  if (args.size() < 2) {
+    std::cerr << "Usage: dxbc-compiler input.dxbc output.spv" << std::endl
+              << "       dxbc-compiler --batch input-dir|list.txt output-dir [--threads n]" << std::endl;
+    return 1;
+  }
+
+  ConvertJob job;
+  job.inputFile = args[0];
+  job.outputFile = args[1];
+
+  MappedFile dxbcCode(job.inputFile);
+
+  if (!dxbcCode.valid()) {
+    std::cerr << "Failed to read " << fromws(args[0].c_str()) << std::endl;
+    return 1;
+  }
+
+  // Reject bad input before paying for device creation
+  dxbc::Container container(dxbcCode.data(), dxbcCode.size(), false);
+
+  if (!container.valid()) {
+    std::cerr << "Invalid shader: " << dxbc::errorString(container.error()) << std::endl;
+    return 1;
+  }
+
+  Com<ID3D11Device> device = createDevice();
+
+  if (device == nullptr) {
+    std::cerr << "Failed to create D3D11 device" << std::endl;
+    return 1;
+  }
+
+  ConvertResult result = convertShader(device.ptr(), job, dxbcCode);
+
+  if (!result.success) {
+    std::cerr << result.log << std::endl;
+    return 1;
+  }
+
   return 0;
 }
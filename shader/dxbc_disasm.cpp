@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <d3dcompiler.h>
 
@@ -7,46 +14,336 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include "../common/batch.h"
+#include "../common/bench.h"
+#include "../common/cache.h"
 #include "../common/com.h"
+#include "../common/dxbc.h"
+#include "../common/file.h"
+#include "../common/hash.h"
+#include "../common/str.h"
+#include "../common/version.h"
+
+constexpr UINT DisasmFlags = D3D_DISASM_ENABLE_INSTRUCTION_NUMBERING;
+
+/**
+ * \brief Disassembly archive header
+ *
+ * The archive starts with this header, followed by the
+ * disassembly of every shader in the order they finished,
+ * the entry table sorted by path, and the path strings.
+ * All offsets are relative to the start of the file.
+ */
+struct ArchiveHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t entryCount;
+  uint32_t reserved;
+  uint64_t tableOffset;
+  uint64_t stringOffset;
+};
+
+struct ArchiveEntry {
+  uint64_t inputHash;
+  uint64_t dataOffset;
+  uint32_t dataSize;
+  uint32_t pathOffset;
+  uint32_t pathSize;
+  uint32_t reserved;
+};
+
+constexpr uint32_t ArchiveMagic = dxbc::fourcc('D', 'X', 'D', 'A');
+constexpr uint32_t ArchiveVersion = 1;
+
+struct DisasmJob {
+  std::filesystem::path inputFile;
+  std::string           name;
+};
+
+struct DisasmResult {
+  bool          success = false;
+  bool          cached  = false;
+  double        timeUs  = 0.0;
+  ArchiveEntry  entry   = { };
+  std::string   log;
+};
+
+bool disassemble(const void* code, size_t size, Com<ID3DBlob>& assembly, std::string& log) {
+  // D3DDisassemble accepts zero or stale checksums, so
+  // only reject structurally broken containers here
+  dxbc::Container container(code, size, false);
+
+  if (!container.valid()) {
+    log = std::string("Invalid shader: ") + dxbc::errorString(container.error());
+    return false;
+  }
+
+  if (FAILED(D3DDisassemble(code, size, DisasmFlags, nullptr, &assembly))) {
+    log = "Failed to disassemble shader";
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Computes cache key for a shader
+ *
+ * Covers the shader binary, the disassembler flags
+ * and the d3dcompiler version.
+ */
+uint64_t getCacheKey(const MappedFile& code) {
+  static const std::string compilerVersion = getModuleVersion(L"d3dcompiler_47.dll");
+
+  Xxh64 hash;
+  hash.update(code.data(), code.size());
+  hash.update(&DisasmFlags, sizeof(DisasmFlags));
+  hash.update(compilerVersion);
+  return hash.digest();
+}
+
+/**
+ * \brief Disassembles a directory of shaders
+ *
+ * Disassembles all .dxbc files in the input directory in
+ * parallel, serving unchanged shaders from the cache, and
+ * streams the results into a single archive.
+ * \param [in] inputDir Directory to search recursively
+ * \param [in] archivePath Output archive
+ * \param [in] cache Disassembly cache, may be \c nullptr
+ * \param [in] threadCount Worker thread count, or 0
+ * \returns Process exit code
+ */
+int runCorpus(
+  const std::filesystem::path& inputDir,
+  const std::filesystem::path& archivePath,
+        DiskCache*             cache,
+        uint32_t               threadCount) {
+  std::vector<DisasmJob> jobs;
+  std::error_code ec;
+
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(inputDir, ec)) {
+    if (entry.is_regular_file(ec) && entry.path().extension() == ".dxbc")
+      jobs.push_back({ entry.path(), entry.path().lexically_relative(inputDir).generic_string() });
+  }
+
+  if (ec) {
+    std::cerr << "Failed to read " << inputDir.string() << std::endl;
+    return 1;
+  }
+
+  // Stream into a temp file and only rename it once the
+  // table is written, so that a failed run never leaves
+  // a truncated archive behind
+  std::filesystem::path tempPath = archivePath;
+  tempPath += ".tmp";
+
+  std::ofstream archive(tempPath, std::ios::binary | std::ios::trunc);
+
+  ArchiveHeader header = { };
+  header.magic   = ArchiveMagic;
+  header.version = ArchiveVersion;
+
+  if (!archive.write(reinterpret_cast<const char*>(&header), sizeof(header))) {
+    std::cerr << "Failed to write " << tempPath.string() << std::endl;
+    return 1;
+  }
+
+  uint64_t archiveOffset = sizeof(header);
+
+  std::vector<DisasmResult> results(jobs.size());
+  std::mutex archiveMutex;
+
+  bench::Timer timer;
+
+  threadCount = batch::runJobs(jobs.size(), threadCount, [&] (size_t index) {
+    const auto& job = jobs[index];
+    auto& result = results[index];
+
+    bench::Timer jobTimer;
+
+    MappedFile code(job.inputFile);
+
+    if (!code.valid()) {
+      result.log = "Failed to read shader";
+      return;
+    }
+
+    uint64_t key = getCacheKey(code);
+
+    Com<ID3DBlob> assembly;
+    MappedFile cachedText;
+    const void* text = nullptr;
+    size_t textSize = 0;
+
+    if (cache && cache->lookup(key, cachedText)) {
+      text = cachedText.data();
+      textSize = cachedText.size();
+      result.cached = true;
+    } else {
+      if (!disassemble(code.data(), code.size(), assembly, result.log))
+        return;
+
+      text = assembly->GetBufferPointer();
+      textSize = assembly->GetBufferSize();
+
+      if (cache)
+        cache->store(key, text, textSize);
+    }
+
+    result.entry.inputHash = key;
+    result.entry.dataSize = uint32_t(textSize);
+
+    { std::lock_guard<std::mutex> lock(archiveMutex);
+      result.entry.dataOffset = archiveOffset;
+      archive.write(reinterpret_cast<const char*>(text), textSize);
+      archiveOffset += textSize;
+    }
+
+    result.success = true;
+    result.timeUs = jobTimer.elapsedUs();
+  });
+
+  // Sort the table by path so that archives from
+  // different runs can be compared entry by entry
+  std::vector<size_t> order;
+
+  for (size_t i = 0; i < jobs.size(); i++) {
+    if (results[i].success)
+      order.push_back(i);
+  }
+
+  std::sort(order.begin(), order.end(), [&] (size_t a, size_t b) {
+    return jobs[a].name < jobs[b].name;
+  });
+
+  std::vector<ArchiveEntry> table;
+  std::string strings;
+
+  for (size_t i : order) {
+    ArchiveEntry entry = results[i].entry;
+    entry.pathOffset = uint32_t(strings.size());
+    entry.pathSize = uint32_t(jobs[i].name.size());
+    strings += jobs[i].name;
+    strings += '\0';
+    table.push_back(entry);
+  }
+
+  header.entryCount   = uint32_t(table.size());
+  header.tableOffset  = archiveOffset;
+  header.stringOffset = archiveOffset + sizeof(ArchiveEntry) * table.size();
+
+  archive.write(reinterpret_cast<const char*>(table.data()), sizeof(ArchiveEntry) * table.size());
+  archive.write(strings.data(), strings.size());
+  archive.seekp(0);
+  archive.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  archive.close();
+
+  if (!archive) {
+    std::cerr << "Failed to write " << tempPath.string() << std::endl;
+    std::filesystem::remove(tempPath, ec);
+    return 1;
+  }
+
+  std::filesystem::rename(tempPath, archivePath, ec);
+
+  if (ec) {
+    std::cerr << "Failed to write " << archivePath.string() << std::endl;
+    std::filesystem::remove(tempPath, ec);
+    return 1;
+  }
+
+  double totalUs = timer.elapsedUs();
+
+  bench::Stats stats;
+  uint32_t failed = 0;
+  uint32_t cached = 0;
+
+  for (size_t i = 0; i < jobs.size(); i++) {
+    if (results[i].success) {
+      stats.add(results[i].timeUs);
+      cached += results[i].cached ? 1 : 0;
+    } else {
+      std::cerr << jobs[i].name << ": " << results[i].log << std::endl;
+      failed += 1;
+    }
+  }
+
+  batch::printSummary(std::cout, "Disassembled", jobs.size(), cached, threadCount, totalUs, stats);
+
+  if (cache) {
+    cache->trim();
+    std::cout << "Cache: " << cache->stats() << std::endl;
+  }
+
+  return failed ? 1 : 0;
+}
 
 int main(int, char**) {
   int     argc = 0;
   LPWSTR* argv = CommandLineToArgvW(
     GetCommandLineW(), &argc);
 
-  if (argc < 2 || argc > 3) {
-    std::cerr << "Usage: dxbc-disasm input.dxbc [output]" << std::endl;
-    return 1;
+  std::vector<std::wstring> args;
+  std::wstring cacheDir;
+  uint64_t cacheSize = 1024ull << 20;
+  uint32_t threadCount = 0;
+
+  for (int i = 1; i < argc; i++) {
+    std::wstring arg = argv[i];
+
+    if (batch::parseThreadCount(argc, argv, i, threadCount))
+      continue;
+
+    if (arg == L"--cache" && i + 1 < argc)
+      cacheDir = argv[++i];
+    else if (arg == L"--cache-size" && i + 1 < argc)
+      cacheSize = std::stoull(argv[++i]) << 20;
+    else
+      args.push_back(arg);
   }
 
-  Com<ID3DBlob> assembly;
-  Com<ID3DBlob> binary;
+  if (args.size() == 3 && args[0] == L"--corpus") {
+    // Keep the cache next to the archive unless told
+    // otherwise, so that reruns only redo changed shaders
+    std::filesystem::path cachePath = cacheDir.empty()
+      ? std::filesystem::path(args[2] + L".cache")
+      : std::filesystem::path(cacheDir);
+
+    DiskCache cache(cachePath, ".txt", cacheSize);
+    return runCorpus(args[1], args[2], &cache, threadCount);
+  }
+
+  if (args.size() < 1 || args.size() > 2) {
+    std::cerr << "Usage: dxbc-disasm input.dxbc [output]" << std::endl
+              << "       dxbc-disasm --corpus input-dir archive [--threads n] [--cache dir] [--cache-size MB]" << std::endl;
+    return 1;
+  }
 
   // input file
-  if (FAILED(D3DReadFileToBlob(argv[1], &binary))) {
+  MappedFile binary(args[0]);
+
+  if (!binary.valid()) {
     std::cerr << "Failed to read shader" << std::endl;
     return 1;
   }
 
-  HRESULT hr = D3DDisassemble(
-    binary->GetBufferPointer(),
-    binary->GetBufferSize(),
-    D3D_DISASM_ENABLE_INSTRUCTION_NUMBERING, nullptr,
-    &assembly);
+  Com<ID3DBlob> assembly;
+  std::string log;
 
-  if (FAILED(hr)) {
-    std::cerr << "Failed to disassemble shader" << std::endl;
+  if (!disassemble(binary.data(), binary.size(), assembly, log)) {
+    std::cerr << log << std::endl;
     return 1;
   }
 
   // output file variant
-  if (argc == 3 && FAILED(D3DWriteBlobToFile(assembly.ptr(), argv[2], 1))) {
+  if (args.size() == 2 && !writeFileAtomic(args[1], assembly->GetBufferPointer(), assembly->GetBufferSize())) {
     std::cerr << "Failed to write shader" << std::endl;
     return 1;
   }
 
   // stdout variant
-  if (argc == 2) {
+  if (args.size() == 1) {
     std::string data((const char *)assembly->GetBufferPointer(), assembly->GetBufferSize());
     std::cout << data;
   }
@@ -1,8 +1,15 @@
+#include <array>
+#include <cctype>
 #include <iostream>
 #include <iomanip>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
-#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include <d3dcompiler.h>
@@ -11,101 +18,791 @@
 #include <windows.h>
 #include <windowsx.h>
 
+#include "../common/batch.h"
+#include "../common/bench.h"
+#include "../common/cache.h"
 #include "../common/com.h"
+#include "../common/dxbc.h"
+#include "../common/file.h"
+#include "../common/hash.h"
+#include "../common/hex.h"
 #include "../common/str.h"
+#include "../common/version.h"
 
-int main(int, char**) {
-  int     argc = 0;
-  LPWSTR* argv = CommandLineToArgvW(
-    GetCommandLineW(), &argc);  
-  
-  if (argc < 5) {
-    std::cerr << "Usage: hlsl-compiler target entrypoint input.hlsl output.dxbc [--strip] [--text]" << std::endl;
-    return 1;
+constexpr UINT CompileFlags =
+  D3DCOMPILE_OPTIMIZATION_LEVEL3 |
+  D3DCOMPILE_ENABLE_UNBOUNDED_DESCRIPTOR_TABLES;
+
+enum class OutputFormat {
+  Binary,   ///< Raw DXBC
+  Text,     ///< Dword hex literals
+  CArray,   ///< Complete C array definition
+  Embed,    ///< Byte hex literals, for #embed fallbacks
+};
+
+struct CompileJob {
+  std::string   target;
+  std::string   entryPoint;
+  std::string   inputFile;
+  std::string   outputFile;
+  bool          strip  = false;
+  bool          md     = false;
+  OutputFormat  format = OutputFormat::Binary;
+};
+
+struct CompileResult {
+  bool        success = false;
+  bool        cached  = false;
+  double      timeUs  = 0.0;
+  std::string log;
+};
+
+std::unique_ptr<DiskCache> g_cache;
+
+/**
+ * \brief Include file cache
+ *
+ * Keeps the contents of every header opened during
+ * the run, so that shaders in a batch that share
+ * headers only read each of them from disk once.
+ */
+class IncludeCache {
+
+public:
+
+  using Data = std::shared_ptr<const MappedFile>;
+
+  Data load(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto entry = m_files.find(path);
+
+    if (entry != m_files.end())
+      return entry->second;
+
+    auto data = std::make_shared<const MappedFile>(path);
+
+    if (!data->valid())
+      return nullptr;
+
+    m_files.insert({ path, data });
+    return data;
   }
 
-  bool strip = false;
-  bool text = false;
-
-  for (int i = 5; i < argc; i++) {
-    strip |= fromws(argv[i]) == "--strip";
-    text  |= fromws(argv[i]) == "--text";
-  }
-  
-  const LPWSTR target       = argv[1];
-  const LPWSTR entryPoint   = argv[2];
-  const LPWSTR inputFile    = argv[3];
-  const LPWSTR outputFile   = argv[4];
-  
-  std::ifstream ifile(fromws(inputFile), std::ios::binary);
-  ifile.ignore(std::numeric_limits<std::streamsize>::max());
-  std::streamsize length = ifile.gcount();
-  ifile.clear();
-  
-  ifile.seekg(0, std::ios_base::beg);
-  std::vector<char> hlslCode(length);
-  ifile.read(hlslCode.data(), length);
-  
-  Com<ID3DBlob> binary;
-  Com<ID3DBlob> errors;
-  
-  HRESULT hr = D3DCompile(
+private:
+
+  std::mutex                            m_mutex;
+  std::unordered_map<std::string, Data> m_files;
+
+};
+
+IncludeCache g_includeCache;
+
+/**
+ * \brief Include handler
+ *
+ * Resolves includes relative to the including file,
+ * or the working directory for the main source file,
+ * like the standard file include handler does. Every
+ * opened header is recorded for dependency files.
+ */
+class IncludeHandler : public ID3DInclude {
+
+public:
+
+  HRESULT STDMETHODCALLTYPE Open(
+          D3D_INCLUDE_TYPE  IncludeType,
+          LPCSTR            pFileName,
+          LPCVOID           pParentData,
+          LPCVOID*          ppData,
+          UINT*             pBytes) {
+    std::filesystem::path path = pFileName;
+
+    if (path.is_relative() && pParentData) {
+      auto parent = m_directories.find(pParentData);
+
+      if (parent != m_directories.end())
+        path = parent->second / path;
+    }
+
+    std::string name = path.lexically_normal().generic_string();
+    IncludeCache::Data data = g_includeCache.load(name);
+
+    if (!data)
+      return E_FAIL;
+
+    // Empty files do not have a unique data pointer
+    static const char empty = '\0';
+    LPCVOID ptr = data->size() ? LPCVOID(data->data()) : LPCVOID(&empty);
+
+    m_directories[ptr] = path.parent_path();
+    m_open.push_back(data);
+    m_includes.insert(name);
+
+    *ppData = ptr;
+    *pBytes = UINT(data->size());
+    return S_OK;
+  }
+
+  HRESULT STDMETHODCALLTYPE Close(
+          LPCVOID           pData) {
+    // Keep data alive until the job is done since the
+    // compiler may open the same header more than once
+    return S_OK;
+  }
+
+  const std::set<std::string>& includes() const {
+    return m_includes;
+  }
+
+private:
+
+  std::unordered_map<LPCVOID, std::filesystem::path>  m_directories;
+  std::vector<IncludeCache::Data>                     m_open;
+  std::set<std::string>                               m_includes;
+
+};
+
+std::string escapeDepfilePath(const std::string& path) {
+  std::string result;
+
+  for (char c : path) {
+    if (c == ' ' || c == '#')
+      result += '\\';
+    else if (c == '$')
+      result += '$';
+
+    result += c;
+  }
+
+  return result;
+}
+
+/**
+ * \brief Writes Makefile-style dependency file
+ *
+ * Written next to the output with a .d suffix, in
+ * the format ninja and make expect from -MD.
+ */
+bool writeDepfile(const CompileJob& job, const IncludeHandler& includes) {
+  std::ostringstream file;
+
+  file << escapeDepfilePath(job.outputFile) << ": " << escapeDepfilePath(job.inputFile);
+
+  for (const auto& include : includes.includes())
+    file << " \\" << std::endl << "  " << escapeDepfilePath(include);
+
+  file << std::endl;
+
+  std::string text = file.str();
+  return writeFileAtomic(job.outputFile + ".d", text.data(), text.size());
+}
+
+/**
+ * \brief Computes cache key for a job
+ *
+ * Hashes the preprocessed source so that changes
+ * to included files are picked up, along with all
+ * parameters that affect the compiled binary.
+ */
+bool getCacheKey(const CompileJob& job, const MappedFile& hlslCode, ID3DInclude* includes, uint64_t& key) {
+  // Part of the key so that updating the compiler
+  // invalidates previously cached shaders
+  static const std::string compilerVersion = getModuleVersion(L"d3dcompiler_47.dll");
+
+  Com<ID3DBlob> preprocessed;
+
+  HRESULT hr = D3DPreprocess(
     hlslCode.data(),
     hlslCode.size(),
-    "Shader", nullptr,
-    D3D_COMPILE_STANDARD_FILE_INCLUDE,
-    fromws(entryPoint).c_str(),
-    fromws(target).c_str(),
-    D3DCOMPILE_OPTIMIZATION_LEVEL3 |
-    D3DCOMPILE_ENABLE_UNBOUNDED_DESCRIPTOR_TABLES,
-    0, &binary, &errors);
-
-  if (FAILED(hr)) {
-    if (errors != nullptr)
-      std::cerr << reinterpret_cast<const char*>(errors->GetBufferPointer()) << std::endl;
-    return 1;
+    "Shader", nullptr, includes,
+    &preprocessed, nullptr);
+
+  if (FAILED(hr))
+    return false;
+
+  Xxh64 hash;
+  hash.update(preprocessed->GetBufferPointer(), preprocessed->GetBufferSize());
+  hash.update(job.target);
+  hash.update(job.entryPoint);
+  hash.update(&CompileFlags, sizeof(CompileFlags));
+  hash.update(compilerVersion);
+
+  key = hash.digest();
+  return true;
+}
+
+void parseFlag(CompileJob& job, const std::string& flag) {
+  job.strip |= flag == "--strip";
+  job.md    |= flag == "--md";
+
+  if (flag == "--text")
+    job.format = OutputFormat::Text;
+  else if (flag == "--c-array")
+    job.format = OutputFormat::CArray;
+  else if (flag == "--embed")
+    job.format = OutputFormat::Embed;
+}
+
+/**
+ * \brief Derives C array name for a job
+ *
+ * Uses the output file name without extension,
+ * or the entry point when writing to stdout.
+ */
+std::string getArrayName(const CompileJob& job) {
+  std::string name = job.outputFile == "-"
+    ? job.entryPoint
+    : std::filesystem::path(job.outputFile).stem().string();
+
+  for (char& c : name) {
+    if (!std::isalnum(uint8_t(c)))
+      c = '_';
+  }
+
+  if (name.empty() || std::isdigit(uint8_t(name[0])))
+    name.insert(0, "_");
+
+  return name;
+}
+
+/**
+ * \brief Drops reflection and debug chunks
+ *
+ * Meant to produce the same container as D3DStripShader
+ * with reflection and debug info stripped.
+ * \param [in] container Shader container
+ * \returns Re-signed container without those chunks
+ */
+std::vector<uint8_t> stripChunks(const dxbc::Container& container) {
+  return dxbc::filterChunks(container, [] (const dxbc::Chunk& chunk) {
+    return chunk.tag != dxbc::Tag::RDEF
+        && chunk.tag != dxbc::Tag::STAT
+        && chunk.tag != dxbc::Tag::SDBG
+        && chunk.tag != dxbc::Tag::SPDB;
+  });
+}
+
+/**
+ * \brief Strips reflection and debug chunks
+ *
+ * Strips natively rather than through D3DStripShader,
+ * since this only needs to drop chunks and re-sign the
+ * container. The compiler's own checksum is verified
+ * first, and D3DStripShader is used instead if our
+ * checksum disagrees with it.
+ * \param [in] data Shader binary
+ * \param [in] size Shader binary size, in bytes
+ * \param [out] strippedBlob Stripped shader binary
+ * \param [out] log Error message, or warning on success
+ * \returns \c true on success
+ */
+bool stripShader(const void* data, size_t size, Com<ID3DBlob>& strippedBlob, std::string& log) {
+  dxbc::Container container(data, size);
+
+  if (container.error() == dxbc::Error::BadChecksum) {
+    if (FAILED(D3DStripShader(data, size,
+        D3DCOMPILER_STRIP_REFLECTION_DATA | D3DCOMPILER_STRIP_DEBUG_INFO, &strippedBlob))) {
+      log = "Failed to strip shader";
+      return false;
+    }
+
+    log = "Warning: DXBC checksum does not match d3dcompiler, used D3DStripShader";
+    return true;
+  }
+
+  if (!container.valid()) {
+    log = std::string("Failed to strip shader: ") + dxbc::errorString(container.error());
+    return false;
+  }
+
+  std::vector<uint8_t> strippedCode = stripChunks(container);
+
+  if (FAILED(D3DCreateBlob(strippedCode.size(), &strippedBlob))) {
+    log = "Failed to strip shader";
+    return false;
   }
-  
-  if (strip) {
-    Com<ID3DBlob> strippedBlob;
 
-    hr = D3DStripShader(binary->GetBufferPointer(), binary->GetBufferSize(),
-      D3DCOMPILER_STRIP_REFLECTION_DATA | D3DCOMPILER_STRIP_DEBUG_INFO,
-      &strippedBlob);
+  std::memcpy(strippedBlob->GetBufferPointer(), strippedCode.data(), strippedCode.size());
+  return true;
+}
+
+/**
+ * \brief Writes compiled shader
+ *
+ * The text formats are rendered into a single buffer
+ * and written at once. The embed format is meant for
+ * compilers without #embed support:
+ *
+ *   static const unsigned char shader[] = {
+ *   #if __has_embed("shader.dxbc")
+ *   #embed "shader.dxbc"
+ *   #else
+ *   #include "shader.inc"
+ *   #endif
+ *   };
+ * \param [in] job Compile job
+ * \param [in] data Shader binary
+ * \param [in] size Shader binary size, in bytes
+ * \returns \c true on success
+ */
+bool writeOutput(const CompileJob& job, const void* data, size_t size) {
+  std::string text;
+
+  auto dwords = reinterpret_cast<const uint32_t*>(data);
+  auto bytes = reinterpret_cast<const uint8_t*>(data);
+
+  switch (job.format) {
+    case OutputFormat::Binary:
+      break;
+
+    case OutputFormat::Text:
+      text = hex::formatList(dwords, size / sizeof(uint32_t), { "", 8 });
+      break;
+
+    case OutputFormat::CArray:
+      text = "static const uint32_t " + getArrayName(job) + "[] = {\n"
+        + hex::formatList(dwords, size / sizeof(uint32_t), { "  ", 8 })
+        + "};\n";
+      break;
+
+    case OutputFormat::Embed:
+      text = hex::formatList(bytes, size, { "", 16 });
+      break;
+  }
+
+  if (job.format != OutputFormat::Binary) {
+    data = text.data();
+    size = text.size();
+  }
+
+  if (job.outputFile == "-")
+    return bool(std::cout.write(reinterpret_cast<const char*>(data), size));
+
+  return writeFileAtomic(job.outputFile, data, size);
+}
+
+CompileResult compileShader(const CompileJob& job) {
+  CompileResult result;
+  bench::Timer timer;
+
+  MappedFile hlslCode(job.inputFile);
+
+  if (!hlslCode.valid()) {
+    result.log = "Failed to open " + job.inputFile;
+    return result;
+  }
+
+  Com<ID3DBlob> binary;
+  Com<ID3DBlob> errors;
+
+  IncludeHandler includes;
+
+  // The cache stores unstripped binaries so that
+  // stripped and unstripped jobs can share entries
+  uint64_t cacheKey = 0;
+  bool cacheable = g_cache && getCacheKey(job, hlslCode, &includes, cacheKey);
+
+  // Cache hits are consumed straight from the entry file,
+  // without copying them into a blob first
+  MappedFile cachedCode;
+
+  const void* code = nullptr;
+  size_t codeSize = 0;
+
+  if (cacheable && g_cache->lookup(cacheKey, cachedCode)) {
+    code = cachedCode.data();
+    codeSize = cachedCode.size();
+    result.cached = true;
+  } else {
+    HRESULT hr = D3DCompile(
+      hlslCode.data(),
+      hlslCode.size(),
+      "Shader", nullptr, &includes,
+      job.entryPoint.c_str(),
+      job.target.c_str(),
+      CompileFlags,
+      0, &binary, &errors);
 
     if (FAILED(hr)) {
-      std::cerr << "Failed to strip shader" << std::endl;
-      return 1;
+      if (errors != nullptr)
+        result.log = reinterpret_cast<const char*>(errors->GetBufferPointer());
+      return result;
     }
 
-    binary = strippedBlob;
+    code = binary->GetBufferPointer();
+    codeSize = binary->GetBufferSize();
+
+    if (cacheable)
+      g_cache->store(cacheKey, code, codeSize);
   }
 
-  std::ofstream file;
+  Com<ID3DBlob> stripped;
 
-  if (fromws(outputFile) != "-")
-    file = std::ofstream(fromws(outputFile), std::ios::binary | std::ios::trunc);
+  if (job.strip) {
+    if (!stripShader(code, codeSize, stripped, result.log))
+      return result;
 
-  std::ostream& outputStream = file.is_open() ? file : std::cout;
+    code = stripped->GetBufferPointer();
+    codeSize = stripped->GetBufferSize();
+  }
+
+  if (!writeOutput(job, code, codeSize)) {
+    result.log = "Failed to write " + job.outputFile;
+    return result;
+  }
+
+  if (job.md && !writeDepfile(job, includes)) {
+    result.log = "Failed to write " + job.outputFile + ".d";
+    return result;
+  }
+
+  result.success = true;
+  result.timeUs = timer.elapsedUs();
+  return result;
+}
 
-  if (text) {
-    auto data = reinterpret_cast<const uint32_t*>(binary->GetBufferPointer());
-    auto size = binary->GetBufferSize() / sizeof(uint32_t);
+/**
+ * \brief Parses a batch manifest
+ *
+ * Each non-empty line that does not start with '#'
+ * describes one job in the same form as the single
+ * shader command line:
+ *
+ *   target entrypoint input.hlsl output.dxbc [--strip] [--text|--c-array|--embed] [--md]
+ */
+bool parseManifest(const std::string& fileName, std::vector<CompileJob>& jobs) {
+  std::ifstream manifest(fileName);
 
-    outputStream << std::hex;
+  if (!manifest) {
+    std::cerr << "Failed to open " << fileName << std::endl;
+    return false;
+  }
+
+  std::string line;
+  uint32_t lineNumber = 0;
+
+  while (std::getline(manifest, line)) {
+    lineNumber += 1;
+
+    std::istringstream tokens(line);
+    CompileJob job;
 
-    for (uint32_t i = 0; i < size; i++) {
-      if (i && !(i & 0x7))
-        outputStream << std::endl;
-      else if (i)
-        outputStream << " ";
-      outputStream << "0x" << std::setfill('0') << std::setw(8) << data[i] << ",";
+    if (!(tokens >> job.target) || job.target[0] == '#')
+      continue;
+
+    if (!(tokens >> job.entryPoint >> job.inputFile >> job.outputFile)) {
+      std::cerr << fileName << ":" << lineNumber << ": Expected target, entry point, input and output" << std::endl;
+      return false;
     }
 
-    outputStream << std::endl;
-  } else {
-    outputStream.write(reinterpret_cast<const char*>(binary->GetBufferPointer()), binary->GetBufferSize());
+    std::string flag;
+
+    while (tokens >> flag)
+      parseFlag(job, flag);
+
+    jobs.push_back(std::move(job));
+  }
+
+  return true;
+}
+
+int runBatch(const std::string& manifest, uint32_t threadCount) {
+  std::vector<CompileJob> jobs;
+
+  if (!parseManifest(manifest, jobs))
+    return 1;
+
+  // d3dcompiler is thread-safe and loaded once per process, so
+  // workers share it and only keep their own per-job state
+  std::vector<CompileResult> results(jobs.size());
+  std::mutex logMutex;
+
+  bench::Timer timer;
+
+  threadCount = batch::runJobs(jobs.size(), threadCount, [&] (size_t index) {
+    results[index] = compileShader(jobs[index]);
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    const auto& job = jobs[index];
+    const auto& result = results[index];
+
+    if (result.success) {
+      std::cout << job.inputFile << " (" << job.target << ", " << job.entryPoint << "): "
+                << std::fixed << std::setprecision(1) << (result.timeUs / 1000.0) << " ms"
+                << (result.cached ? " (cached)" : "") << std::endl;
+
+      if (!result.log.empty())
+        std::cerr << result.log << std::endl;
+    } else {
+      std::cerr << job.inputFile << " (" << job.target << ", " << job.entryPoint << "): failed" << std::endl;
+
+      if (!result.log.empty())
+        std::cerr << result.log << std::endl;
+    }
+  });
+
+  double totalUs = timer.elapsedUs();
+
+  bench::Stats stats;
+  uint32_t failed = 0;
+  uint32_t cached = 0;
+
+  for (const auto& result : results) {
+    if (result.success) {
+      stats.add(result.timeUs);
+      cached += result.cached ? 1 : 0;
+    } else {
+      failed += 1;
+    }
+  }
+
+  batch::printSummary(std::cout, "Compiled", jobs.size(), cached, threadCount, totalUs, stats);
+
+  if (g_cache) {
+    g_cache->trim();
+    std::cout << "Cache: " << g_cache->stats() << std::endl;
   }
 
+  return failed ? 1 : 0;
+}
+
+/**
+ * \brief Checks native DXBC checksums against d3dcompiler
+ *
+ * Compiles generated shaders of increasing length, and strips
+ * each of them through D3DStripShader, until every class of
+ * MD5 tail length has been seen: tails that are a multiple of
+ * 64 bytes, tails under 56 bytes which fit the final block,
+ * and tails of 56 to 63 bytes which need an extra block.
+ * Also checks that the native strip path produces the
+ * exact same bytes as D3DStripShader for every shader.
+ * \param [in] count Number of shader lengths to compile
+ */
+int runVerifyChecksums(uint32_t count) {
+  static const char* targets[][2] = {
+    { "vs_4_0", "vs_main" }, { "vs_5_0", "vs_main" },
+    { "ps_4_0", "ps_main" }, { "ps_5_0", "ps_main" },
+  };
+
+  std::vector<std::vector<uint8_t>> corpus;
+  uint32_t stripCount = 0;
+  uint32_t stripMismatches = 0;
+
+  auto addBlob = [&corpus] (ID3DBlob* blob) {
+    auto data = reinterpret_cast<const uint8_t*>(blob->GetBufferPointer());
+    corpus.emplace_back(data, data + blob->GetBufferSize());
+  };
+
+  for (uint32_t n = 1; n <= count; n++) {
+    std::string source =
+      "cbuffer c : register(b0) { float4 consts; };\n"
+      "float4 run(float4 r) {\n";
+
+    for (uint32_t i = 0; i < n; i++)
+      source += "  r = r * r.yzwx + consts;\n";
+
+    source +=
+      "  return r;\n"
+      "}\n"
+      "float4 vs_main(float4 r : POSITION) : SV_POSITION { return run(r); }\n"
+      "float4 ps_main(float4 r : TEXCOORD0) : SV_TARGET { return run(r); }\n";
+
+    for (const auto& target : targets) {
+      Com<ID3DBlob> binary;
+      Com<ID3DBlob> stripped;
+
+      if (FAILED(D3DCompile(source.data(), source.size(), "Shader", nullptr, nullptr,
+          target[1], target[0], CompileFlags, 0, &binary, nullptr))) {
+        std::cerr << "Failed to compile " << target[0] << " shader with " << n << " instructions" << std::endl;
+        return 1;
+      }
+
+      addBlob(binary.ptr());
+
+      if (FAILED(D3DStripShader(binary->GetBufferPointer(), binary->GetBufferSize(),
+          D3DCOMPILER_STRIP_REFLECTION_DATA | D3DCOMPILER_STRIP_DEBUG_INFO, &stripped))) {
+        std::cerr << "Failed to strip " << target[0] << " shader with " << n << " instructions" << std::endl;
+        return 1;
+      }
+
+      addBlob(stripped.ptr());
+
+      // Checksums are covered separately, so this only
+      // needs the chunks to be parsed
+      dxbc::Container container(binary->GetBufferPointer(), binary->GetBufferSize(), false);
+      std::vector<uint8_t> nativeCode;
+
+      if (container.valid())
+        nativeCode = stripChunks(container);
+
+      stripCount += 1;
+
+      if (nativeCode.size() != stripped->GetBufferSize()
+       || std::memcmp(nativeCode.data(), stripped->GetBufferPointer(), nativeCode.size()))
+        stripMismatches += 1;
+    }
+  }
+
+  static const char* classNames[] = {
+    "tail multiple of 64 bytes",
+    "tail under 56 bytes",
+    "tail of 56-63 bytes",
+  };
+
+  std::array<uint32_t, 3> shaders = { };
+  std::array<uint32_t, 3> scalarMismatches = { };
+  std::array<uint32_t, 3> batchedMismatches = { };
+
+  std::vector<const void*> data;
+  std::vector<size_t> sizes;
+  size_t totalSize = 0;
+
+  for (const auto& shader : corpus) {
+    data.push_back(shader.data());
+    sizes.push_back(shader.size());
+    totalSize += shader.size();
+  }
+
+  std::vector<uint32_t> scalar(4 * corpus.size());
+  std::vector<uint32_t> batched(4 * corpus.size());
+
+  for (size_t i = 0; i < corpus.size(); i++)
+    dxbc::computeChecksum(data[i], sizes[i], &scalar[4 * i]);
+
+  dxbc::computeChecksums(corpus.size(), data.data(), sizes.data(), batched.data());
+
+  for (size_t i = 0; i < corpus.size(); i++) {
+    size_t tail = (sizes[i] - dxbc::ChecksumOffset) % 64;
+    size_t index = tail ? (tail < 56 ? 1 : 2) : 0;
+
+    const uint8_t* stored = corpus[i].data() + 4;
+
+    shaders[index] += 1;
+    scalarMismatches[index] += std::memcmp(&scalar[4 * i], stored, 16) ? 1 : 0;
+    batchedMismatches[index] += std::memcmp(&batched[4 * i], stored, 16) ? 1 : 0;
+  }
+
+  // Both paths are timed on the same real corpus
+  auto measureGBs = [totalSize] (const auto& proc) {
+    uint32_t iterations = 0;
+    bench::Timer timer;
+
+    while (timer.elapsedUs() < 500000.0 || !iterations) {
+      proc();
+      iterations += 1;
+    }
+
+    return double(totalSize) * double(iterations) / (timer.elapsedUs() * 1000.0);
+  };
+
+  double scalarGBs = measureGBs([&] () {
+    for (size_t i = 0; i < corpus.size(); i++)
+      dxbc::computeChecksum(data[i], sizes[i], &scalar[4 * i]);
+  });
+
+  double batchedGBs = measureGBs([&] () {
+    dxbc::computeChecksums(corpus.size(), data.data(), sizes.data(), batched.data());
+  });
+
+  std::cout << "d3dcompiler_47.dll " << getModuleVersion(L"d3dcompiler_47.dll") << ": "
+            << corpus.size() << " shaders, " << totalSize << " bytes" << std::endl;
+
+  bool success = true;
+
+  for (size_t i = 0; i < shaders.size(); i++) {
+    std::cout << "  " << std::left << std::setw(26) << classNames[i] << std::right
+              << std::setw(6) << shaders[i] << " shaders, "
+              << scalarMismatches[i] << " scalar / "
+              << batchedMismatches[i] << " multi-buffer mismatches" << std::endl;
+
+    if (!shaders[i]) {
+      std::cerr << "No shaders with " << classNames[i] << ", increase count" << std::endl;
+      success = false;
+    }
+
+    if (scalarMismatches[i] || batchedMismatches[i])
+      success = false;
+  }
+
+  std::cout << "  native strip:" << std::setw(19) << stripCount << " shaders, "
+            << stripMismatches << " differ from D3DStripShader" << std::endl;
+
+  if (stripMismatches)
+    success = false;
+
+  std::cout << std::fixed << std::setprecision(3)
+            << "  scalar:       " << scalarGBs << " GB/s" << std::endl
+            << "  multi-buffer: " << batchedGBs << " GB/s" << std::endl;
+
+  return success ? 0 : 1;
+}
+
+int main(int, char**) {
+  int     argc = 0;
+  LPWSTR* argv = CommandLineToArgvW(
+    GetCommandLineW(), &argc);
+
+  // Split options that apply to the whole run
+  // from positional arguments and job flags
+  std::vector<std::string> args;
+  std::string cacheDir;
+  uint64_t cacheSize = 256ull << 20;
+  uint32_t threadCount = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (batch::parseThreadCount(argc, argv, i, threadCount))
+      continue;
+
+    std::string arg = fromws(argv[i]);
+
+    if (arg == "--cache" && i + 1 < argc)
+      cacheDir = fromws(argv[++i]);
+    else if (arg == "--cache-size" && i + 1 < argc)
+      cacheSize = std::stoull(fromws(argv[++i])) << 20;
+    else
+      args.push_back(std::move(arg));
+  }
+
+  if (!cacheDir.empty())
+    g_cache = std::make_unique<DiskCache>(cacheDir, ".dxbc", cacheSize);
+
+  if (args.size() == 2 && args[0] == "--batch")
+    return runBatch(args[1], threadCount);
+
+  if (!args.empty() && args.size() <= 2 && args[0] == "--verify-checksums")
+    return runVerifyChecksums(args.size() == 2 ? std::stoul(args[1]) : 64);
+
+  if (args.size() < 4) {
+    std::cerr << "Usage: hlsl-compiler target entrypoint input.hlsl output.dxbc [--strip] [--text|--c-array|--embed] [--md] [cache options]" << std::endl
+              << "       hlsl-compiler --batch manifest.txt [--threads n] [cache options]" << std::endl
+              << "       hlsl-compiler --verify-checksums [count]" << std::endl
+              << "Cache options: --cache dir [--cache-size MB]" << std::endl;
+    return 1;
+  }
+
+  CompileJob job;
+  job.target     = args[0];
+  job.entryPoint = args[1];
+  job.inputFile  = args[2];
+  job.outputFile = args[3];
+
+  for (size_t i = 4; i < args.size(); i++)
+    parseFlag(job, args[i]);
+
+  CompileResult result = compileShader(job);
+
+  if (!result.log.empty())
+    std::cerr << result.log << std::endl;
+
+  if (!result.success)
+    return 1;
+
+  // Scanning the cache directory on every invocation would
+  // add up quickly, so only trim once the stores recorded
+  // since the last trim may have pushed it over its limit
+  if (g_cache && g_cache->stats().stores)
+    g_cache->trimIfNeeded();
+
   return 0;
 }
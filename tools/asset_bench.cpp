@@ -0,0 +1,87 @@
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "../common/asset.h"
+
+using clock_type = std::chrono::high_resolution_clock;
+
+// Size of the source text needed to embed the data as a
+// C array with one "0xNN, " entry per byte, which is what
+// compilers have to chew through when building the tests
+size_t embeddedSourceSize(size_t bytes) {
+  return bytes * 6;
+}
+
+void benchAsset(const char* path, const std::vector<uint8_t>& raw) {
+  std::cout << path << ": " << raw.size() << " bytes" << std::endl;
+
+  for (auto filter : { asset::Filter::None, asset::Filter::Delta }) {
+    auto t0 = clock_type::now();
+    auto packed = asset::compress(raw.data(), raw.size(), filter);
+    auto t1 = clock_type::now();
+
+    auto output = std::make_unique<uint8_t[]>(raw.size());
+
+    if (!asset::decompress(packed.data(), packed.size(), output.get(), raw.size())
+     || std::memcmp(output.get(), raw.data(), raw.size())) {
+      std::cerr << "  Round trip failed" << std::endl;
+      continue;
+    }
+
+    // Run decoder for at least half a second
+    size_t iterations = 0;
+    auto t2 = clock_type::now();
+    auto t3 = t2;
+
+    while (t3 - t2 < std::chrono::milliseconds(500)) {
+      for (uint32_t i = 0; i < 16; i++)
+        asset::decompress(packed.data(), packed.size(), output.get(), raw.size());
+
+      iterations += 16;
+      t3 = clock_type::now();
+    }
+
+    double compressMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double decodeS = std::chrono::duration<double>(t3 - t2).count();
+    double decodeMBs = double(raw.size()) * double(iterations) / (decodeS * 1048576.0);
+    double decodeUs = 1000000.0 * decodeS / double(iterations);
+
+    std::cout << "  " << (filter == asset::Filter::Delta ? "delta" : "plain") << ": "
+              << packed.size() << " bytes ("
+              << std::fixed << std::setprecision(1)
+              << (100.0 * double(packed.size()) / double(raw.size())) << "%), "
+              << "compress " << std::setprecision(2) << compressMs << " ms, "
+              << "decode " << decodeUs << " us (" << std::setprecision(0) << decodeMBs << " MB/s), "
+              << "source " << embeddedSourceSize(raw.size()) << " -> "
+              << embeddedSourceSize(packed.size()) << " bytes" << std::endl;
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: asset-bench input.raw [input.raw...]" << std::endl;
+    return 1;
+  }
+
+  for (int i = 1; i < argc; i++) {
+    std::ifstream ifile(argv[i], std::ios::binary);
+
+    if (!ifile) {
+      std::cerr << "Failed to open " << argv[i] << std::endl;
+      return 1;
+    }
+
+    std::vector<uint8_t> raw(
+      (std::istreambuf_iterator<char>(ifile)),
+      (std::istreambuf_iterator<char>()));
+
+    benchAsset(argv[i], raw);
+  }
+
+  return 0;
+}
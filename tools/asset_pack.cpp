@@ -0,0 +1,66 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../common/asset.h"
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    std::cerr << "Usage: asset-pack name input.raw output.h" << std::endl;
+    return 1;
+  }
+
+  std::string name = argv[1];
+
+  std::ifstream ifile(argv[2], std::ios::binary);
+
+  if (!ifile) {
+    std::cerr << "Failed to open " << argv[2] << std::endl;
+    return 1;
+  }
+
+  std::vector<uint8_t> raw(
+    (std::istreambuf_iterator<char>(ifile)),
+    (std::istreambuf_iterator<char>()));
+
+  // Image data usually compresses better after delta
+  // filtering, but keep whichever stream is smaller
+  std::vector<uint8_t> packed = asset::compress(raw.data(), raw.size(), asset::Filter::None);
+  std::vector<uint8_t> delta  = asset::compress(raw.data(), raw.size(), asset::Filter::Delta);
+
+  if (delta.size() < packed.size())
+    packed = std::move(delta);
+
+  std::ofstream ofile(argv[3], std::ios::binary | std::ios::trunc);
+
+  if (!ofile) {
+    std::cerr << "Failed to open " << argv[3] << std::endl;
+    return 1;
+  }
+
+  // Consumers include common/asset.h themselves since
+  // the generated header lives in the build directory
+  ofile << "#pragma once" << std::endl << std::endl
+        << "// Generated by asset-pack, " << raw.size() << " bytes raw" << std::endl
+        << "static const uint8_t " << name << "_data[] = {" << std::endl;
+
+  char hex[8];
+
+  for (size_t i = 0; i < packed.size(); i++) {
+    std::snprintf(hex, sizeof(hex), "0x%02x,", packed[i]);
+    ofile << ((i & 0x1F) ? "" : "  ") << hex << (((i & 0x1F) == 0x1F) ? "\n" : "");
+  }
+
+  ofile << std::endl << "};" << std::endl << std::endl
+        << "static asset::Asset " << name << "(" << name << "_data, sizeof(" << name << "_data));" << std::endl;
+
+  if (!ofile) {
+    std::cerr << "Failed to write " << argv[3] << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "../common/dxbc.h"
+
+using clock_type = std::chrono::high_resolution_clock;
+
+using Corpus = std::vector<std::vector<uint8_t>>;
+
+bool loadFile(const std::filesystem::path& path, Corpus& corpus) {
+  std::ifstream ifile(path, std::ios::binary);
+
+  if (!ifile)
+    return false;
+
+  std::vector<uint8_t> data(
+    (std::istreambuf_iterator<char>(ifile)),
+    (std::istreambuf_iterator<char>()));
+
+  // Skip anything that is not a DXBC container, so that
+  // shader cache directories can be passed in directly
+  dxbc::Container container(data.data(), data.size(), false);
+
+  if (!container.valid())
+    return false;
+
+  // The checksum only covers the container itself, not
+  // any trailing bytes that may follow it in the file
+  data.resize(container.size());
+
+  corpus.push_back(std::move(data));
+  return true;
+}
+
+// Containers with a single random code chunk, sized
+// log-uniformly between 256 bytes and 64 kB, which is
+// roughly the spread seen in game shader caches. These
+// are only useful for timing: the checksum field is left
+// zero, since signing them with computeChecksum would not
+// tell us anything about its correctness.
+void generateCorpus(size_t count, Corpus& corpus) {
+  std::mt19937 rng(0x44584243);
+  std::uniform_real_distribution<double> sizeDist(8.0, 16.0);
+
+  for (size_t i = 0; i < count; i++) {
+    uint32_t codeSize = uint32_t(std::exp2(sizeDist(rng))) & ~3u;
+    uint32_t totalSize = sizeof(dxbc::Header) + 4 + 8 + codeSize;
+
+    dxbc::Header header = { };
+    header.magic      = dxbc::Tag::DXBC;
+    header.version    = 1;
+    header.totalSize  = totalSize;
+    header.chunkCount = 1;
+
+    uint32_t chunk[3] = { uint32_t(sizeof(header) + 4), dxbc::Tag::SHEX, codeSize };
+
+    auto headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    auto chunkBytes = reinterpret_cast<const uint8_t*>(chunk);
+
+    std::vector<uint8_t> data;
+    data.reserve(totalSize);
+    data.insert(data.end(), headerBytes, headerBytes + sizeof(header));
+    data.insert(data.end(), chunkBytes, chunkBytes + sizeof(chunk));
+
+    while (data.size() < totalSize)
+      data.push_back(uint8_t(rng()));
+
+    corpus.push_back(std::move(data));
+  }
+}
+
+template<typename Proc>
+double measureGBs(size_t totalSize, const Proc& proc) {
+  // Run for at least half a second
+  size_t iterations = 0;
+  auto t0 = clock_type::now();
+  auto t1 = t0;
+
+  while (t1 - t0 < std::chrono::milliseconds(500)) {
+    proc();
+    iterations += 1;
+    t1 = clock_type::now();
+  }
+
+  double seconds = std::chrono::duration<double>(t1 - t0).count();
+  return double(totalSize) * double(iterations) / (seconds * 1.0e9);
+}
+
+int main(int argc, char** argv) {
+  Corpus corpus;
+
+  for (int i = 1; i < argc; i++) {
+    std::error_code ec;
+
+    if (std::filesystem::is_directory(argv[i], ec)) {
+      for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i], ec)) {
+        if (entry.is_regular_file(ec))
+          loadFile(entry.path(), corpus);
+      }
+    } else if (!loadFile(argv[i], corpus)) {
+      std::cerr << "Not a DXBC container: " << argv[i] << std::endl;
+    }
+  }
+
+  // Stored checksums can only be compared for shaders
+  // that were actually produced by d3dcompiler
+  bool synthetic = corpus.empty();
+
+  if (synthetic) {
+    std::cout << "No shaders given, using synthetic corpus, stored checksums not checked" << std::endl;
+    generateCorpus(4096, corpus);
+  }
+
+  std::vector<const void*> data;
+  std::vector<size_t> sizes;
+  size_t totalSize = 0;
+
+  for (const auto& shader : corpus) {
+    data.push_back(shader.data());
+    sizes.push_back(shader.size());
+    totalSize += shader.size();
+  }
+
+  std::vector<uint32_t> scalar(4 * corpus.size());
+  std::vector<uint32_t> batched(4 * corpus.size());
+
+  for (size_t i = 0; i < corpus.size(); i++)
+    dxbc::computeChecksum(data[i], sizes[i], &scalar[4 * i]);
+
+  dxbc::computeChecksums(corpus.size(), data.data(), sizes.data(), batched.data());
+
+  size_t mismatches = 0;
+  size_t invalid = 0;
+
+  for (size_t i = 0; i < corpus.size(); i++) {
+    if (std::memcmp(&scalar[4 * i], &batched[4 * i], 16))
+      mismatches += 1;
+
+    if (!synthetic && std::memcmp(&scalar[4 * i], corpus[i].data() + 4, 16))
+      invalid += 1;
+  }
+
+  std::cout << corpus.size() << " shaders, " << totalSize << " bytes" << std::endl;
+
+  if (mismatches)
+    std::cerr << "Multi-buffer checksum differs for " << mismatches << " shaders" << std::endl;
+
+  if (invalid)
+    std::cerr << "Stored checksum differs for " << invalid << " shaders" << std::endl;
+
+  double scalarGBs = measureGBs(totalSize, [&] () {
+    for (size_t i = 0; i < corpus.size(); i++)
+      dxbc::computeChecksum(data[i], sizes[i], &scalar[4 * i]);
+  });
+
+  double batchedGBs = measureGBs(totalSize, [&] () {
+    dxbc::computeChecksums(corpus.size(), data.data(), sizes.data(), batched.data());
+  });
+
+  std::cout << std::fixed << std::setprecision(3)
+            << "  scalar:       " << scalarGBs << " GB/s" << std::endl
+            << "  multi-buffer: " << batchedGBs << " GB/s" << std::endl;
+
+  return mismatches || invalid ? 1 : 0;
+}
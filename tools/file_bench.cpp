@@ -0,0 +1,89 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "../common/file.h"
+#include "../common/hash.h"
+
+using clock_type = std::chrono::high_resolution_clock;
+
+// What the shader tools used to do: scan the file once to
+// find its length, then seek back and read it into a vector
+uint64_t readStream(const std::filesystem::path& path) {
+  std::ifstream ifile(path, std::ios::binary);
+  ifile.ignore(std::numeric_limits<std::streamsize>::max());
+  std::streamsize length = ifile.gcount();
+  ifile.clear();
+
+  ifile.seekg(0, std::ios_base::beg);
+  std::vector<char> data(length);
+  ifile.read(data.data(), length);
+
+  return Xxh64::hash(data.data(), data.size());
+}
+
+uint64_t readMapped(const std::filesystem::path& path) {
+  MappedFile file(path);
+  return Xxh64::hash(file.data(), file.size());
+}
+
+template<typename Proc>
+double measureMs(const std::vector<std::filesystem::path>& files, uint64_t& checksum, const Proc& proc) {
+  auto t0 = clock_type::now();
+
+  checksum = 0;
+
+  for (const auto& file : files)
+    checksum ^= proc(file);
+
+  auto t1 = clock_type::now();
+  return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: file-bench dir [dir...]" << std::endl;
+    return 1;
+  }
+
+  std::vector<std::filesystem::path> files;
+  uint64_t totalSize = 0;
+
+  for (int i = 1; i < argc; i++) {
+    std::error_code ec;
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i], ec)) {
+      if (entry.is_regular_file(ec)) {
+        files.push_back(entry.path());
+        totalSize += entry.file_size(ec);
+      }
+    }
+  }
+
+  std::cout << files.size() << " files, " << totalSize << " bytes" << std::endl;
+
+  // Warm up the page cache so that both variants
+  // measure the same thing
+  uint64_t streamHash, mappedHash;
+  measureMs(files, streamHash, readStream);
+
+  for (uint32_t i = 0; i < 3; i++) {
+    double streamMs = measureMs(files, streamHash, readStream);
+    double mappedMs = measureMs(files, mappedHash, readMapped);
+
+    if (streamHash != mappedHash) {
+      std::cerr << "File contents differ" << std::endl;
+      return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "  ifstream: " << streamMs << " ms (" << (double(totalSize) / (1000.0 * streamMs)) << " MB/s), "
+              << "mapped: " << mappedMs << " ms (" << (double(totalSize) / (1000.0 * mappedMs)) << " MB/s)" << std::endl;
+  }
+
+  return 0;
+}
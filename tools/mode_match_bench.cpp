@@ -0,0 +1,110 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../common/modes.h"
+
+using clock_type = std::chrono::high_resolution_clock;
+
+// Resolutions on a coarse grid with some odd sizes mixed
+// in, common refresh rates in both integer and NTSC-style
+// rationals, and a few formats, scanline orders and scaling
+// modes, so that every matching step has something to do
+std::vector<modes::Mode> generateModes(uint32_t count) {
+  static const modes::Rational rates[] = {
+    { 24, 1 }, { 24000, 1001 }, { 30, 1 }, { 50, 1 },
+    { 60, 1 }, { 60000, 1001 }, { 75, 1 }, { 100, 1 },
+    { 120, 1 }, { 144, 1 }, { 143856, 1000 }, { 165, 1 },
+    { 240, 1 }, { 359981, 1000 },
+  };
+
+  static const uint32_t formats[] = { 28, 29, 87, 91, 24, 10 };
+
+  std::mt19937 rng(0x4d4f4445);
+  std::vector<modes::Mode> result;
+
+  for (uint32_t i = 0; i < count; i++) {
+    modes::Mode mode;
+    mode.width  = 320 + 8 * uint32_t(rng() % 900);
+    mode.height = 200 + 8 * uint32_t(rng() % 500);
+
+    if (!(rng() % 16)) {
+      mode.width  += rng() % 8;
+      mode.height += rng() % 8;
+    }
+
+    mode.refreshRate      = rates[rng() % std::size(rates)];
+    mode.format           = formats[rng() % std::size(formats)];
+    mode.scanlineOrdering = 1 + uint32_t(rng() % 3);
+    mode.scaling          = uint32_t(rng() % 3);
+    result.push_back(mode);
+  }
+
+  return result;
+}
+
+template<typename Proc>
+double measureUs(uint32_t count, const Proc& proc) {
+  auto t0 = clock_type::now();
+
+  for (uint32_t i = 0; i < count; i++)
+    proc(i);
+
+  auto t1 = clock_type::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / double(count);
+}
+
+int main(int argc, char** argv) {
+  uint32_t modeCount  = argc > 1 ? std::stoul(argv[1]) : 50000;
+  uint32_t queryCount = argc > 2 ? std::stoul(argv[2]) : 10000;
+
+  if (!modeCount || !queryCount) {
+    std::cerr << "Usage: mode-match-bench [modes] [queries]" << std::endl;
+    return 1;
+  }
+
+  auto list = generateModes(modeCount);
+  auto queries = modes::generateQueries(list, queryCount, modeCount);
+
+  modes::Mode desktop = { 1920, 1080, { 60, 1 }, 28, 1, 0 };
+
+  auto t0 = clock_type::now();
+  modes::ModeTable table(list);
+  auto t1 = clock_type::now();
+
+  std::vector<uint32_t> linear(queries.size());
+  std::vector<uint32_t> indexed(queries.size());
+
+  double linearUs = measureUs(queryCount, [&] (uint32_t i) {
+    linear[i] = modes::findClosestLinear(list, queries[i], desktop);
+  });
+
+  double indexedUs = measureUs(queryCount, [&] (uint32_t i) {
+    indexed[i] = table.findClosest(queries[i], desktop);
+  });
+
+  uint32_t mismatches = 0;
+
+  for (uint32_t i = 0; i < queryCount; i++) {
+    if (linear[i] != indexed[i] && mismatches++ < 10) {
+      const auto& q = queries[i];
+      std::cerr << "Mismatch for " << q.width << "x" << q.height << " @ "
+                << q.refreshRate.numerator << "/" << q.refreshRate.denominator
+                << ", format " << q.format << ", scanline " << q.scanlineOrdering
+                << ", scaling " << q.scaling << ": linear " << linear[i]
+                << ", indexed " << indexed[i] << std::endl;
+    }
+  }
+
+  std::cout << modeCount << " modes, " << queryCount << " queries" << std::endl
+            << std::fixed << std::setprecision(3)
+            << "  build:   " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms" << std::endl
+            << "  linear:  " << linearUs << " us/query" << std::endl
+            << "  indexed: " << indexedUs << " us/query" << std::endl
+            << "  mismatches: " << mismatches << std::endl;
+
+  return mismatches ? 1 : 0;
+}
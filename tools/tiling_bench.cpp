@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../common/tiling.h"
+
+using clock_type = std::chrono::high_resolution_clock;
+
+struct FormatInfo {
+  const char*         name;
+  tiling::ElementInfo element;
+};
+
+// One format per element size, plus block-compressed
+// formats, since shapes only depend on these properties
+const FormatInfo g_formats[] = {
+  { "R8",       {  1, 1, 1 } },
+  { "R16",      {  2, 1, 1 } },
+  { "RGBA8",    {  4, 1, 1 } },
+  { "RGBA16",   {  8, 1, 1 } },
+  { "RGBA32",   { 16, 1, 1 } },
+  { "BC1",      {  8, 4, 4 } },
+  { "BC3",      { 16, 4, 4 } },
+};
+
+struct KnownShape {
+  tiling::Dimension   dimension;
+  uint32_t            format;
+  tiling::TileShape   shape;
+};
+
+// Standard tile shapes in texels, as listed in the
+// D3D11.2 tiled resources documentation
+const KnownShape g_knownShapes[] = {
+  { tiling::Dimension::Texture2D, 0, { 256, 256,  1 } },
+  { tiling::Dimension::Texture2D, 1, { 256, 128,  1 } },
+  { tiling::Dimension::Texture2D, 2, { 128, 128,  1 } },
+  { tiling::Dimension::Texture2D, 3, { 128,  64,  1 } },
+  { tiling::Dimension::Texture2D, 4, {  64,  64,  1 } },
+  { tiling::Dimension::Texture2D, 5, { 512, 256,  1 } },
+  { tiling::Dimension::Texture2D, 6, { 256, 256,  1 } },
+  { tiling::Dimension::Texture3D, 0, {  64,  32, 32 } },
+  { tiling::Dimension::Texture3D, 1, {  32,  32, 32 } },
+  { tiling::Dimension::Texture3D, 2, {  32,  32, 16 } },
+  { tiling::Dimension::Texture3D, 3, {  32,  16, 16 } },
+  { tiling::Dimension::Texture3D, 4, {  16,  16, 16 } },
+  { tiling::Dimension::Texture3D, 5, { 128,  64, 16 } },
+  { tiling::Dimension::Texture3D, 6, {  64,  64, 16 } },
+};
+
+struct KnownTiling {
+  const char*           name;
+  tiling::ResourceDesc  desc;
+  uint32_t              tileCount;
+  uint32_t              standardMips;
+};
+
+// Hand-computed layouts, using the lower bound for the
+// number of tiles per packed mip tail
+const KnownTiling g_knownTilings[] = {
+  { "1024x1024 RGBA8, full mip chain",
+    { tiling::Dimension::Texture2D, { 4, 1, 1 }, 1024, 1024, 1, 11, 1 }, 86, 4 },
+  { "1024x1024 RGBA8, 6 slices, full mip chain",
+    { tiling::Dimension::Texture2D, { 4, 1, 1 }, 1024, 1024, 1, 11, 6 }, 516, 4 },
+  { "4096x2048 BC1, 1 mip",
+    { tiling::Dimension::Texture2D, { 8, 4, 4 }, 4096, 2048, 1, 1, 1 }, 64, 1 },
+  { "100x100 RGBA8, 1 mip",
+    { tiling::Dimension::Texture2D, { 4, 1, 1 }, 100, 100, 1, 1, 1 }, 1, 0 },
+  { "256x256x256 RGBA8, 1 mip",
+    { tiling::Dimension::Texture3D, { 4, 1, 1 }, 256, 256, 256, 1, 1 }, 1024, 1 },
+  { "1 MB buffer",
+    { tiling::Dimension::Buffer, { 1, 1, 1 }, 1u << 20, 1, 1, 1, 1 }, 16, 1 },
+  { "65537 byte buffer",
+    { tiling::Dimension::Buffer, { 1, 1, 1 }, 65537, 1, 1, 1, 1 }, 2, 1 },
+};
+
+class Checker {
+
+public:
+
+  void fail(const std::string& what) {
+    if (m_failures++ < 16)
+      std::cerr << what << std::endl;
+  }
+
+  uint32_t failures() const {
+    return m_failures;
+  }
+
+private:
+
+  uint32_t m_failures = 0;
+
+};
+
+std::string describe(const tiling::ResourceDesc& desc) {
+  return std::to_string(desc.width) + "x" + std::to_string(desc.height) + "x" + std::to_string(desc.depth)
+    + ", " + std::to_string(desc.format.elementSize) + " bytes per "
+    + std::to_string(desc.format.blockWidth) + "x" + std::to_string(desc.format.blockHeight) + " block"
+    + ", " + std::to_string(desc.mipLevels) + " mips, " + std::to_string(desc.arraySize) + " slices";
+}
+
+uint32_t getMaxMipCount(uint32_t w, uint32_t h, uint32_t d) {
+  uint32_t extent = std::max(std::max(w, h), d);
+  uint32_t count = 1;
+
+  while (extent > 1) {
+    extent >>= 1;
+    count += 1;
+  }
+
+  return count;
+}
+
+// Descriptor sweep over odd, power-of-two and large
+// extents, every mip count, and single and array textures
+std::vector<tiling::ResourceDesc> generateDescs() {
+  static const uint32_t extents2D[] = { 1, 3, 64, 100, 128, 255, 256, 1000, 1024, 4097, 16384 };
+  static const uint32_t extents3D[] = { 1, 17, 32, 64, 100, 256, 2048 };
+  static const uint32_t arraySizes[] = { 1, 6 };
+
+  std::vector<tiling::ResourceDesc> result;
+
+  for (const auto& format : g_formats) {
+    for (uint32_t w : extents2D) {
+      for (uint32_t h : extents2D) {
+        for (uint32_t a : arraySizes) {
+          for (uint32_t m = 1; m <= getMaxMipCount(w, h, 1); m++)
+            result.push_back({ tiling::Dimension::Texture2D, format.element, w, h, 1, m, a });
+        }
+      }
+    }
+
+    for (uint32_t w : extents3D) {
+      for (uint32_t h : extents3D) {
+        for (uint32_t d : extents3D) {
+          for (uint32_t m = 1; m <= getMaxMipCount(w, h, d); m++)
+            result.push_back({ tiling::Dimension::Texture3D, format.element, w, h, d, m, 1 });
+        }
+      }
+    }
+  }
+
+  for (uint32_t size = 1; size <= (1u << 30); size = size * 3 + 1)
+    result.push_back({ tiling::Dimension::Buffer, { 1, 1, 1 }, size, 1, 1, 1, 1 });
+
+  return result;
+}
+
+void checkInvariants(const tiling::ResourceDesc& desc, const tiling::ResourceTiling& tiling, Checker& checker) {
+  const auto& shape = tiling.shape;
+  const auto& fmt = desc.format;
+
+  // Every standard tile covers exactly 64 kB
+  uint64_t tileBytes = uint64_t(shape.width / fmt.blockWidth)
+                     * uint64_t(shape.height / fmt.blockHeight)
+                     * uint64_t(shape.depth) * fmt.elementSize;
+
+  if (tileBytes != tiling::TileSize)
+    checker.fail(describe(desc) + ": tile shape covers " + std::to_string(tileBytes) + " bytes");
+
+  if (tiling.subresources.size() != size_t(desc.mipLevels) * desc.arraySize) {
+    checker.fail(describe(desc) + ": got " + std::to_string(tiling.subresources.size()) + " subresources");
+    return;
+  }
+
+  if (tiling.standardMips + tiling.packedMips != desc.mipLevels)
+    checker.fail(describe(desc) + ": standard and packed mips do not add up");
+
+  // Standard subresources are laid out back to back, and
+  // each slice's mip tail follows its standard mips
+  uint32_t sliceTiles = tiling.tileCount / desc.arraySize;
+  uint32_t tileSum = 0;
+
+  for (uint32_t a = 0; a < desc.arraySize; a++) {
+    uint32_t nextTile = a * sliceTiles;
+
+    for (uint32_t m = 0; m < desc.mipLevels; m++) {
+      const auto& sub = tiling.subresources[a * desc.mipLevels + m];
+
+      if (m >= tiling.standardMips) {
+        if (sub.startTile != tiling::PackedTile)
+          checker.fail(describe(desc) + ": packed mip " + std::to_string(m) + " has a start tile");
+        continue;
+      }
+
+      uint32_t tiles = sub.widthInTiles * sub.heightInTiles * sub.depthInTiles;
+
+      if (sub.startTile != nextTile)
+        checker.fail(describe(desc) + ": mip " + std::to_string(m) + " of slice " + std::to_string(a) + " starts at tile " + std::to_string(sub.startTile));
+
+      if (desc.dimension != tiling::Dimension::Buffer
+       && (tiling::mipExtent(desc.width, m) < shape.width || tiling::mipExtent(desc.height, m) < shape.height))
+        checker.fail(describe(desc) + ": standard mip " + std::to_string(m) + " is smaller than a tile");
+
+      nextTile += tiles;
+      tileSum += tiles;
+    }
+
+    tileSum += tiling.packedTilesMin;
+  }
+
+  if (tileSum != tiling.tileCount)
+    checker.fail(describe(desc) + ": tile count " + std::to_string(tiling.tileCount) + ", subresources add up to " + std::to_string(tileSum));
+
+  if (tiling.packedMips && tiling.packedStartTile != tiling.sliceStandardTiles)
+    checker.fail(describe(desc) + ": mip tail does not follow the standard mips");
+}
+
+int main(int argc, char** argv) {
+  uint32_t passes = argc > 1 ? std::stoul(argv[1]) : 10;
+
+  if (!passes) {
+    std::cerr << "Usage: tiling-bench [passes]" << std::endl;
+    return 1;
+  }
+
+  Checker checker;
+  tiling::ResourceTiling tiling;
+
+  for (const auto& known : g_knownShapes) {
+    const auto& format = g_formats[known.format];
+    tiling::TileShape shape = { };
+
+    if (!tiling::getTileShape(known.dimension, format.element, shape)
+     || shape.width != known.shape.width || shape.height != known.shape.height || shape.depth != known.shape.depth) {
+      checker.fail(std::string(format.name) + (known.dimension == tiling::Dimension::Texture3D ? " 3D" : " 2D")
+        + ": got shape " + std::to_string(shape.width) + "x" + std::to_string(shape.height) + "x" + std::to_string(shape.depth));
+    }
+  }
+
+  for (const auto& known : g_knownTilings) {
+    if (!tiling::computeTiling(known.desc, tiling)
+     || tiling.tileCount != known.tileCount || tiling.standardMips != known.standardMips) {
+      checker.fail(std::string(known.name) + ": got " + std::to_string(tiling.tileCount) + " tiles, "
+        + std::to_string(tiling.standardMips) + " standard mips");
+    }
+  }
+
+  auto descs = generateDescs();
+
+  for (const auto& desc : descs) {
+    if (!tiling::computeTiling(desc, tiling))
+      checker.fail(describe(desc) + ": no standard shape");
+    else
+      checkInvariants(desc, tiling, checker);
+  }
+
+  // Time the model alone, separately from the checks
+  uint64_t tileSum = 0;
+
+  auto t0 = clock_type::now();
+
+  for (uint32_t i = 0; i < passes; i++) {
+    for (const auto& desc : descs) {
+      tiling::computeTiling(desc, tiling);
+      tileSum += tiling.tileCount;
+    }
+  }
+
+  auto t1 = clock_type::now();
+
+  double totalMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+  std::cout << std::size(g_knownShapes) << " known shapes, " << std::size(g_knownTilings) << " known layouts, "
+            << descs.size() << " swept descriptors: " << checker.failures() << " failures" << std::endl
+            << std::fixed << std::setprecision(3)
+            << "  sweep: " << (totalMs / double(passes)) << " ms per pass, "
+            << (1.0e6 * totalMs / double(passes * descs.size())) << " ns per descriptor"
+            << " (" << tileSum << " tiles)" << std::endl;
+
+  return checker.failures() ? 1 : 0;
+}